@@ -15,6 +15,20 @@
 /* source management */
 #define ADC_C
 
+/* ADS1115: registers */
+#define ADS1115_REG_CONV      0x00      /* conversion register */
+#define ADS1115_REG_CONFIG    0x01      /* config register */
+
+/* ADS1115: config register */
+#define ADS1115_MUX_AIN0      0x4000    /* AIN0 vs. Gnd */
+#define ADS1115_MUX_AIN1      0x5000    /* AIN1 vs. Gnd */
+#define ADS1115_MUX_AIN2      0x6000    /* AIN2 vs. Gnd */
+#define ADS1115_PGA_SHIFT     9         /* PGA bits (0: +/-6.144V - 5: +/-0.256V) */
+#define ADS1115_MODE_SINGLE   0x0100    /* single-shot mode (power-down) */
+#define ADS1115_DR_860        0x00E0    /* 860 SPS */
+#define ADS1115_DR_128        0x0080    /* 128 SPS (default) */
+#define ADS1115_COMP_OFF      0x0003    /* disable comparator */
+
 
 /*
  *  include header files
@@ -27,56 +41,83 @@
 #include "functions.h"        /* external functions */
 
 
+/*
+ *  function declarations (prototypes)
+ */
+
+void ADC_Settle(uint8_t Channel, uint8_t Timeout);
+
+
 /* ************************************************************************
  *   ADC
  * ************************************************************************ */
 
 
 /*
- *  read ADC channel and return voltage in mV
- *  - use Vcc as reference by default
- *  - switch to bandgap reference for low voltages (< 1.0V) to improve
- *    ADC resolution
- *  - with a 125kHz ADC clock a single conversion needs about 0.1ms
- *    with 25 samples we end up with about 2.6ms
+ *  convert sum of ADC readings to voltage in mV
+ *  - single sample: U = ADC reading * U_ref / 1024
  *
  *  requires:
- *  - Channel: ADC MUX input channel
- *    - ATmega328: register bits corresponding with MUX0-3
- *    - ATmega324/644/1284: register bits corresponding with MUX0-4
- *    - ATmega640/1280/2560: register bits corresponding with MUX0-4
- *      (todo: add MUX5 to support also ADC8-15)
+ *  - Value: sum of ADC readings
+ *  - Ref: register bits of voltage reference used
+ *  - Samples: number of ADC readings
+ *
+ *  returns:
+ *  - average voltage in mV
  */
 
-uint16_t ReadU(uint8_t Channel)
+uint16_t ADC_Voltage(uint32_t Value, uint8_t Ref, uint8_t Samples)
 {
   uint16_t          U;             /* return value (mV) */
-  uint8_t           Counter;       /* loop counter */
-  uint8_t           Ref;           /* voltage reference register bits */
-  uint32_t          Value;         /* ADC value */
-
-  /* AREF pin is connected to external buffer cap (1nF) */
 
-  #if 0
-  /* manage channels ADC8-15 (ATmega640/1280/2560) */
-  if (Channel & 0b00100000)        /* bit 6 set: ADC8-15 */
+  /* get voltage of reference used */
+  if (Ref == ADC_REF_BANDGAP)      /* bandgap reference */
   {
-    ADCSRB |= (1 << MUX5);         /* set MUX5 */
+    U = Cfg.Bandgap;                 /* voltage of bandgap reference */
   }
-  else                             /* bit 6 not set: ADC0-7 */
+  else                             /* Vcc as reference */
   {
-    ADCSRB &= ~(1 << MUX5);        /* clear MUX5 */
+    U = Cfg.Vcc;                     /* voltage of Vcc */   
   }
-  #endif
 
-  /* prepare bitfield for register: start with AVcc as voltage reference */
-  Channel &= ADC_CHAN_MASK;        /* filter reg bits for MUX channel */
-  Channel |= ADC_REF_VCC;          /* add bits for voltage reference: AVcc */
+  /* convert to voltage; */
+  Value *= U;                      /* ADC readings * U_ref */
+//  Value += 511 * Cfg.Samples;      /* automagic rounding */
+  Value /= 1024;                   /* / 1024 for 10bit ADC */
 
-sample:
+  /* de-sample to get average voltage */
+  Value /= Samples;
+  U = (uint16_t)Value;
+
+// todo: do we need a sanity check for U <= Vcc?
+
+  return U; 
+}
+
+
+
+/*
+ *  set voltage reference and wait for stabilization if it has changed
+ *
+ *  requires:
+ *  - Channel: register bits for ADMUX (channel and voltage reference)
+ *
+ *  returns:
+ *  - register bits of voltage reference
+ */
+
+uint8_t ADC_SetReference(uint8_t Channel)
+{
+  uint8_t           Ref;           /* voltage reference register bits */
 
   ADMUX = Channel;                 /* set input channel and U reference */
 
+  #ifdef ADC_CLOCK_PROFILES
+  /* set prescaler of current clock profile */
+  Ref = ADCSRA & ~ADC_CLOCK_MASK;  /* get other bits */
+  ADCSRA = Ref | Cfg.ADC_Clock;    /* and add prescaler bits */
+  #endif
+
   /*
    *  change of voltage reference
    *  - voltage needs some time to stabilize at buffer cap 
@@ -97,116 +138,1286 @@ sample:
       wait10ms();                    /* 10ms */
     #endif
 
-    #if 0
-    /* dummy conversion */
-    ADCSRA |= (1 << ADSC);         /* start conversion */
-    while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
-    #endif
-
     Cfg.Ref = Ref;                 /* update reference source */
   }
 
-  /* perform dummy conversion anyway */
-  ADCSRA |= (1 << ADSC);         /* start conversion */
-  while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+  return Ref;
+}
 
 
-  /*
-   *  sample ADC readings
-   */
 
-  Value = 0UL;                     /* reset sampling variable */
-  Counter = 0;                     /* reset counter */
+#ifdef ADC_CLOCK_PROFILES
 
-  while (Counter < Cfg.Samples)    /* take samples */
+/*
+ *  select ADC clock profile
+ *  - applies to ReadU() and related functions, special measurement 
+ *    functions with timing based on the ADC clock (e.g. ESR) use the
+ *    standard clock anyway
+ *  - reset to precise profile when done
+ *
+ *  requires:
+ *  - Profile: ADC_PRECISE or ADC_FAST
+ */
+
+void ADC_Profile(uint8_t Profile)
+{
+  if (Profile == ADC_FAST)         /* fast profile */
   {
-    ADCSRA |= (1 << ADSC);         /* start conversion */
-    while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+    Cfg.ADC_Clock = ADC_CLOCK_DIV_FAST;
+  }
+  else                             /* precise profile */
+  {
+    Cfg.ADC_Clock = ADC_CLOCK_DIV;
+  }
+}
 
-    Value += ADCW;                 /* add ADC reading */
+#endif
 
-    /* auto-switch voltage reference for low readings */
-    if (Counter == 4)                   /* 5 samples */
+
+
+#ifdef HW_ADS1115
+
+/*
+ *  ADS1115: write config register
+ *
+ *  requires:
+ *  - Config: register value
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 on any error
+ */
+
+uint8_t ADS1115_WriteConfig(uint16_t Config)
+{
+  uint8_t           Flag = 0;      /* return value */
+
+  #ifdef I2C_TWI_IRQ
+  I2C_Flush();                     /* wait for pending jobs (display) */
+  #endif
+
+  if (I2C_Start(I2C_START) == I2C_OK)                /* start */
+  {
+    I2C.Byte = ADS1115_I2C_ADDR << 1;                /* address (7 bit & write) */
+    if (I2C_WriteByte(I2C_ADDRESS) == I2C_ACK)       /* address slave */
     {
-      if ((uint16_t)Value < 1024)       /* < 1V (5V / 5 samples) */
+      I2C.Byte = ADS1115_REG_CONFIG;                 /* register pointer */
+      if (I2C_WriteByte(I2C_DATA) == I2C_ACK)
       {
-        if (Ref != ADC_REF_BANDGAP)     /* bandgap ref not selected */
+        I2C.Byte = (uint8_t)(Config >> 8);           /* MSB */
+        if (I2C_WriteByte(I2C_DATA) == I2C_ACK)
         {
-          if (Cfg.AutoScale == 1)       /* autoscaling enabled */
+          I2C.Byte = (uint8_t)Config;                /* LSB */
+          if (I2C_WriteByte(I2C_DATA) == I2C_ACK)
           {
-            Channel &= ~ADC_REF_MASK;     /* clear reference bits */
-            Channel |= ADC_REF_BANDGAP;   /* select bandgap reference */
+            Flag = 1;                                /* signal success */
+          }
+        }
+      }
+    }
+  }
 
-            goto sample;                /* re-run sampling */
+  I2C_Stop();                      /* stop */
+
+  return Flag;
+}
+
+
+
+/*
+ *  ADS1115: read conversion register
+ *
+ *  requires:
+ *  - Value: pointer to value to be set
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 on any error
+ */
+
+uint8_t ADS1115_ReadConversion(int16_t *Value)
+{
+  uint8_t           Flag = 0;      /* return value */
+  uint16_t          Data;          /* register value */
+
+  #ifdef I2C_TWI_IRQ
+  I2C_Flush();                     /* wait for pending jobs (display) */
+  #endif
+
+  if (I2C_Start(I2C_START) == I2C_OK)                /* start */
+  {
+    I2C.Byte = ADS1115_I2C_ADDR << 1;                /* address (7 bit & write) */
+    if (I2C_WriteByte(I2C_ADDRESS) == I2C_ACK)       /* address slave */
+    {
+      I2C.Byte = ADS1115_REG_CONV;                   /* register pointer */
+      if ((I2C_WriteByte(I2C_DATA) == I2C_ACK) &&
+          (I2C_Start(I2C_REPEATED_START) == I2C_OK))
+      {
+        I2C.Byte = (ADS1115_I2C_ADDR << 1) | 0x01;   /* address (7 bit & read) */
+        if ((I2C_WriteByte(I2C_ADDRESS) == I2C_ACK) &&
+            (I2C_ReadByte(I2C_ACK) == I2C_OK))
+        {
+          Data = I2C.Byte << 8;                      /* MSB */
+          if (I2C_ReadByte(I2C_NACK) == I2C_OK)
+          {
+            Data |= I2C.Byte;                        /* LSB */
+            *Value = (int16_t)Data;
+            Flag = 1;                                /* signal success */
           }
         }
       }
     }
+  }
 
-    Counter++;                     /* another sample done */
+  I2C_Stop();                      /* stop */
+
+  return Flag;
+}
+
+
+
+/*
+ *  select ADC backend for ReadU()
+ *  - external ADC applies to probe channels only, others are read by
+ *    the internal ADC anyway
+ *  - reset to internal ADC when done, which also stops the external
+ *    ADC's continuous conversion mode (power-down)
+ *
+ *  requires:
+ *  - Backend: ADC_INT or ADC_EXT
+ */
+
+void ADC_Backend(uint8_t Backend)
+{
+  if ((Backend == ADC_INT) && (Cfg.ADC_Backend == ADC_EXT))
+  {
+    /* default settings and single-shot mode to power down ADS1115 */
+    ADS1115_WriteConfig(ADS1115_MODE_SINGLE | ADS1115_DR_128 | (2 << ADS1115_PGA_SHIFT) | ADS1115_COMP_OFF);
   }
 
+  Cfg.ADC_Backend = Backend;
+}
 
-  /*
-   *  convert ADC reading to voltage
-   *  - single sample: U = ADC reading * U_ref / 1024
-   */
 
-  /* get voltage of reference used */
-  if (Ref == ADC_REF_BANDGAP)      /* bandgap reference */
+
+/*
+ *  read probe channel with external ADC and return voltage in 0.01mV
+ *  - ADS1115 in continuous conversion mode at 860 SPS
+ *  - data ready is timed: in continuous mode ALERT/RDY pulses just for
+ *    8s and the config register doesn't signal new conversions, so
+ *    we wait two conversion periods after changing MUX or PGA (skips
+ *    the conversion in progress) and one period between samples
+ *  - auto-scaling: the first sample with a full-scale range of 6.144V
+ *    selects the smallest range fitting the voltage (with 1/8 margin)
+ *  - 4 samples need about 7ms (9ms with a range change)
+ *
+ *  requires:
+ *  - Channel: ADC MUX input channel of a probe (TP1, TP2 or TP3)
+ *  - Samples: number of samples (1-16)
+ *
+ *  returns:
+ *  - voltage in 0.01mV
+ *  - ADC_EXT_ERROR on bus error or if channel isn't a probe
+ */
+
+uint32_t ReadU_Ext(uint8_t Channel, uint8_t Samples)
+{
+  uint32_t          U;             /* voltage */
+  uint16_t          Config;        /* config register bits */
+  uint16_t          Limit;         /* full-scale range (mV) */
+  uint8_t           Range = 0;     /* PGA range (0: 6.144V) */
+  uint8_t           Counter;       /* sample counter */
+  int16_t           Value;         /* single reading */
+  uint32_t          Sum;           /* sum of readings */
+
+  /* map probe channel to ADS1115 input */
+  Channel &= ADC_CHAN_MASK;        /* filter reg bits for MUX channel */
+  if (Channel == TP1) Config = ADS1115_MUX_AIN0;
+  else if (Channel == TP2) Config = ADS1115_MUX_AIN1;
+  else if (Channel == TP3) Config = ADS1115_MUX_AIN2;
+  else return ADC_EXT_ERROR;       /* no probe */
+
+  /* continuous conversion mode (MODE = 0) */
+  Config |= ADS1115_DR_860 | ADS1115_COMP_OFF;
+
+sample:
+
+  /* set input and range */
+  if (ADS1115_WriteConfig(Config | ((uint16_t)Range << ADS1115_PGA_SHIFT)) == 0)
   {
-    U = Cfg.Bandgap;                 /* voltage of bandgap reference */
+    return ADC_EXT_ERROR;          /* bus error */
   }
-  else                             /* Vcc as reference */
+
+  /* skip conversion in progress: two periods (with 10% tolerance) */
+  wait2ms();
+  wait500us();
+
+
+  /*
+   *  sample readings
+   */
+
+  Sum = 0;                         /* reset sum */
+  Counter = 0;                     /* reset counter */
+
+  while (Counter < Samples)        /* take samples */
   {
-    U = Cfg.Vcc;                     /* voltage of Vcc */   
+    if (Counter > 0)               /* not first sample */
+    {
+      /* wait for next conversion: one period (with 10% tolerance) */
+      wait1ms();
+      wait300us();
+    }
+
+    if (ADS1115_ReadConversion(&Value) == 0)
+    {
+      return ADC_EXT_ERROR;        /* bus error */
+    }
+
+    if (Value < 0) Value = 0;      /* slightly negative input */
+    Sum += (uint16_t)Value;        /* add reading */
+    Counter++;                     /* another sample done */
+
+    /* auto-scale with first reading */
+    if ((Counter == 1) && (Range == 0) && (Cfg.AutoScale == 1))
+    {
+      U = (uint32_t)Sum * 3 / 16;  /* mV (187.5V per step) */
+      Limit = 4096;                /* FSR of range #1 */
+
+      /* find smallest range with voltage below 7/8 of FSR */
+      while ((Range < 5) && (U < (Limit - Limit / 8)))
+      {
+        Range++;                   /* next range */
+        Limit /= 2;                /* halve FSR */
+      }
+
+      if (Range > 0) goto sample;  /* re-run sampling */
+    }
   }
 
-  /* convert to voltage; */
-  Value *= U;                      /* ADC readings * U_ref */
-//  Value += 511 * Cfg.Samples;      /* automagic rounding */
-  Value /= 1024;                   /* / 1024 for 10bit ADC */
 
-  /* de-sample to get average voltage */
-  Value /= Cfg.Samples;
-  U = (uint16_t)Value;
+  /*
+   *  convert readings to voltage
+   *  - U = reading * FSR / 32768
+   *  - FSR in 256mV steps: 24 for 6.144V, 16 for 4.096V ... 1 for 0.256V
+   *    U (0.01mV) = reading * FSR_256 * 25 / 32
+   */
 
-// todo: do we need a sanity check for U <= Vcc?
+  if (Range == 0) Limit = 24;      /* 6.144V */
+  else Limit = 32 >> Range;        /* 4.096V - 0.256V */
 
-  return U; 
+  U = Sum * 25;
+  U *= Limit;                      /* * FSR (256mV) */
+  U /= 32;
+  U /= Samples;                    /* average */
+
+  return U;
 }
 
+#endif
 
 
-/* ************************************************************************
- *   convenience functions
- * ************************************************************************ */
 
+#ifdef ADC_ADAPTIVE
 
 /*
- *  wait 5ms and then read ADC
- *  - same as ReadU()
+ *  check if mean of ADC readings is within confidence bound
+ *  - for adaptive sample count
+ *  - uses deviations from the first reading to keep numbers small
+ *  - checks 2 sigma of mean: 4 * var / n < B^2
+ *    with n * n * var = n * Sum2 - Sum^2
+ *    -> 4 * (n * Sum2 - Sum^2) / n < B^2 * n^2
+ *  - B is given by ADC_ADAPTIVE (in ADC steps)
+ *
+ *  requires:
+ *  - Samples: number of readings
+ *  - Sum: sum of deviations
+ *  - Sum2: sum of squared deviations
+ *
+ *  returns:
+ *  - 0 if not stable yet
+ *  - 1 if stable
  */
 
-uint16_t ReadU_5ms(uint8_t Channel)
+uint8_t ADC_Stable(uint8_t Samples, int32_t Sum, uint32_t Sum2)
 {
-   wait5ms();       /* wait 5ms */
+  uint8_t           Flag = 0;      /* return value */
+  uint32_t          Var;           /* scaled variance */
+  uint32_t          Limit;         /* scaled bound */
+
+  /* very noisy or drifting: prevent overflow and keep sampling */
+  if ((Sum < 4096) && (Sum > -4096) && (Sum2 < 1000000))
+  {
+    Var = Sum2 * Samples;          /* n * Sum2 */
+    Var -= (uint32_t)(Sum * Sum);  /* - Sum^2 */
+    Var *= 4;                      /* 2 sigma */
+    Var /= Samples;                /* / n */
+
+    Limit = (uint16_t)Samples * Samples;     /* n^2 */
+    Limit *= (ADC_ADAPTIVE * ADC_ADAPTIVE);  /* * B^2 */
 
-   return (ReadU(Channel));
+    if (Var < Limit) Flag = 1;     /* within bound */
+  }
+
+  return Flag;
 }
 
+#endif
+
+
 
+#ifndef ADC_INTERRUPT
 
 /*
- *  wait 20ms and then read ADC
- *  - same as ReadU()
+ *  read ADC channel based on sampling descriptor and return voltage in mV
+ *  - use Vcc as reference by default
+ *  - switch to bandgap reference for low voltages (< 1.0V) to improve
+ *    ADC resolution (SAMPLE_REF_AUTO and Cfg.AutoScale)
+ *  - with a 125kHz ADC clock a single conversion needs about 0.1ms
+ *    with 25 samples we end up with about 2.6ms
+ *  - doesn't change Cfg.Samples or Cfg.AutoScale
+ *
+ *  requires:
+ *  - Channel: ADC MUX input channel
+ *    - ATmega328: register bits corresponding with MUX0-3
+ *    - ATmega324/644/1284: register bits corresponding with MUX0-4
+ *    - ATmega640/1280/2560: register bits corresponding with MUX0-4
+ *      (todo: add MUX5 to support also ADC8-15)
+ *  - Desc: sampling descriptor (see SAMPLE_* in common.h)
+ *    number of samples (0 for Cfg.Samples) and flags for reference
+ *    policy, settle mode and precision class
  */
 
-uint16_t ReadU_20ms(uint8_t Channel)
+uint16_t ReadU_Desc(uint8_t Channel, uint16_t Desc)
 {
-  wait20ms();       /* wait 20ms */
+  uint16_t          U;             /* return value (mV) */
+  uint8_t           Counter;       /* loop counter */
+  uint8_t           Samples;       /* number of samples */
+  uint8_t           Ref;           /* voltage reference register bits */
+  uint32_t          Value;         /* ADC value */
+  #ifdef ADC_ADAPTIVE
+  uint16_t          Sample;        /* single ADC reading */
+  uint16_t          First = 0;     /* first ADC reading */
+  int16_t           Diff;          /* deviation from first reading */
+  int32_t           Sum;           /* sum of deviations */
+  uint32_t          Sum2;          /* sum of squared deviations */
+  #endif
+
+  /* number of samples */
+  Samples = (uint8_t)(Desc & SAMPLE_COUNT_MASK);
+  if (Samples == 0) Samples = Cfg.Samples;   /* default */
+
+  /* reference policy */
+  if (Cfg.AutoScale == 0) Desc |= SAMPLE_REF_VCC;  /* autoscaling disabled */
+
+  /* settle mode */
+  if (Desc & SAMPLE_SETTLE_20MS)        /* 20ms */
+  {
+    ADC_Settle(Channel, 20);
+  }
+  else if (Desc & SAMPLE_SETTLE_5MS)    /* 5ms */
+  {
+    ADC_Settle(Channel, 5);
+  }
+
+  #ifdef HW_ADS1115
+  if (Cfg.ADC_Backend == ADC_EXT)       /* external ADC selected */
+  {
+    Value = ReadU_Ext(Channel, ADS1115_SAMPLES);
+    if (Value != ADC_EXT_ERROR)         /* got voltage */
+    {
+      Value += 50;                      /* rounding */
+      return (uint16_t)(Value / 100);   /* 0.01mV -> mV */
+    }
+    /* otherwise fall back to internal ADC */
+  }
+  #endif
 
-  return (ReadU(Channel));
+  /* AREF pin is connected to external buffer cap (1nF) */
+
+  #if 0
+  /* manage channels ADC8-15 (ATmega640/1280/2560) */
+  if (Channel & 0b00100000)        /* bit 6 set: ADC8-15 */
+  {
+    ADCSRB |= (1 << MUX5);         /* set MUX5 */
+  }
+  else                             /* bit 6 not set: ADC0-7 */
+  {
+    ADCSRB &= ~(1 << MUX5);        /* clear MUX5 */
+  }
+  #endif
+
+  /* prepare bitfield for register: start with AVcc as voltage reference */
+  Channel &= ADC_CHAN_MASK;        /* filter reg bits for MUX channel */
+  Channel |= ADC_REF_VCC;          /* add bits for voltage reference: AVcc */
+
+sample:
+
+  /* set channel and reference, wait for reference to stabilize */
+  Ref = ADC_SetReference(Channel);
+
+  /* perform dummy conversion anyway */
+  ADCSRA |= (1 << ADSC);         /* start conversion */
+  while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_ADC]++;         /* count conversion */
+  #endif
+
+
+  /*
+   *  sample ADC readings
+   */
+
+  Value = 0UL;                     /* reset sampling variable */
+  Counter = 0;                     /* reset counter */
+  #ifdef ADC_ADAPTIVE
+  Sum = 0;                         /* reset sum of deviations */
+  Sum2 = 0UL;                      /* reset sum of squared deviations */
+  #endif
+
+  while (Counter < Samples)        /* take samples */
+  {
+    ADCSRA |= (1 << ADSC);         /* start conversion */
+    while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+    #ifdef SW_PERF_COUNTERS
+    PerfCount[PERF_ADC]++;       /* count conversion */
+    #endif
+
+    #ifdef ADC_ADAPTIVE
+    Sample = ADCW;                 /* get ADC reading */
+    Value += Sample;               /* add ADC reading */
+
+    /* track deviations from first reading */
+    if (Counter == 0) First = Sample;
+    Diff = (int16_t)(Sample - First);
+    Sum += Diff;
+    Sum2 += (int32_t)Diff * Diff;
+    #else
+    Value += ADCW;                 /* add ADC reading */
+    #endif
+
+    /* auto-switch voltage reference for low readings */
+    if (Counter == 4)                   /* 5 samples */
+    {
+      if ((uint16_t)Value < 1024)       /* < 1V (5V / 5 samples) */
+      {
+        if (Ref != ADC_REF_BANDGAP)     /* bandgap ref not selected */
+        {
+          if (! (Desc & SAMPLE_REF_VCC))     /* autoscaling enabled */
+          {
+            Channel &= ~ADC_REF_MASK;     /* clear reference bits */
+            Channel |= ADC_REF_BANDGAP;   /* select bandgap reference */
+
+            goto sample;                /* re-run sampling */
+          }
+        }
+      }
+    }
+
+    Counter++;                     /* another sample done */
+
+    #ifdef ADC_ADAPTIVE
+    /* early termination for stable readings (after 5 samples) */
+    if ((Counter >= 5) && ! (Desc & SAMPLE_FULL))
+    {
+      if (ADC_Stable(Counter, Sum, Sum2)) break;
+    }
+    #endif
+  }
+
+
+  /* convert ADC readings to voltage */
+  U = ADC_Voltage(Value, Ref, Counter);
+
+  return U; 
+}
+
+
+
+/*
+ *  read ADC channel and return voltage in mV
+ *  - default sampling (Cfg.Samples, auto-scaling)
+ *
+ *  requires:
+ *  - Channel: ADC MUX input channel (see ReadU_Desc())
+ */
+
+uint16_t ReadU(uint8_t Channel)
+{
+  return ReadU_Desc(Channel, SAMPLE_STD);
+}
+
+#endif
+
+
+
+/*
+ *  read several probe channels in one pass and return voltages in mV
+ *  - samples of the selected channels are interleaved and share the 
+ *    voltage reference setup
+ *  - first conversion of each channel serves as dummy conversion
+ *  - switches to bandgap reference for low voltages (< 1.0V) like
+ *    ReadU(), while all low channels are re-sampled together in a
+ *    second pass
+ *  - meant for low impedance sources (e.g. Rl or RiL), since the MUX
+ *    changes with each conversion
+ *
+ *  requires:
+ *  - Mask: channels to read (bitfield)
+ *    READ_CH_1 for Probes.Ch_1, READ_CH_2 for Probes.Ch_2 and
+ *    READ_CH_3 for Probes.Ch_3
+ *  - U: pointer to array of 3 voltages (mV) to be set
+ *    U[0] for probe-1, U[1] for probe-2 and U[2] for probe-3
+ *    (unselected channels are not changed)
+ */
+
+void ReadU_Multi(uint8_t Mask, uint16_t *U)
+{
+  uint8_t           Channel[3];    /* ADC MUX input channels */
+  uint8_t           Ref;           /* voltage reference register bits */
+  uint8_t           Low = 0;       /* channels requiring bandgap reference */
+  uint8_t           Counter;       /* sample counter */
+  uint8_t           n;             /* counter */
+  uint32_t          Value[3];      /* ADC values */
+
+  /* get channels */
+  Channel[0] = Probes.Ch_1 & ADC_CHAN_MASK;
+  Channel[1] = Probes.Ch_2 & ADC_CHAN_MASK;
+  Channel[2] = Probes.Ch_3 & ADC_CHAN_MASK;
+
+  Mask &= (READ_CH_1 | READ_CH_2 | READ_CH_3);    /* filter bits */
+  Ref = ADC_REF_VCC;               /* start with AVcc as voltage reference */
+
+  while (Mask)                     /* pass for selected channels */
+  {
+    /* reset sampling variables */
+    Value[0] = 0UL;
+    Value[1] = 0UL;
+    Value[2] = 0UL;
+    Counter = 0;                   /* round #0 is the dummy conversion */
+
+    /*
+     *  sample ADC readings
+     *  - one conversion per channel and round
+     */
+
+    while ((Counter <= Cfg.Samples) && Mask)
+    {
+      for (n = 0; n < 3; n++)      /* loop through channels */
+      {
+        if (Mask & (1 << n))       /* channel selected */
+        {
+          /* set channel and reference, wait for reference to stabilize */
+          ADC_SetReference(Channel[n] | Ref);
+
+          ADCSRA |= (1 << ADSC);         /* start conversion */
+          while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+          #ifdef SW_PERF_COUNTERS
+          PerfCount[PERF_ADC]++;         /* count conversion */
+          #endif
+
+          /* add ADC reading (except for dummy conversion) */
+          if (Counter > 0) Value[n] += ADCW;
+        }
+      }
+
+      /* auto-switch voltage reference for low readings */
+      if (Counter == 5)                 /* 5 samples */
+      {
+        if ((Ref != ADC_REF_BANDGAP) && (Cfg.AutoScale == 1))
+        {
+          for (n = 0; n < 3; n++)       /* loop through channels */
+          {
+            if (Mask & (1 << n))        /* channel selected */
+            {
+              if ((uint16_t)Value[n] < 1024)   /* < 1V (5V / 5 samples) */
+              {
+                Low |= (1 << n);        /* re-run with bandgap ref */
+              }
+            }
+          }
+
+          Mask &= ~Low;                 /* remove low channels */
+        }
+      }
+
+      Counter++;                   /* next round */
+    }
+
+    /* convert ADC readings to voltages */
+    for (n = 0; n < 3; n++)        /* loop through channels */
+    {
+      if (Mask & (1 << n))         /* channel selected */
+      {
+        U[n] = ADC_Voltage(Value[n], Ref, Cfg.Samples);
+      }
+    }
+
+    /* next pass: low channels with bandgap reference */
+    Mask = Low;
+    Low = 0;
+    Ref = ADC_REF_BANDGAP;
+  }
+}
+
+
+
+/*
+ *  read ADC channel and return raw sum of readings
+ *  - fast path for comparisons with a fixed threshold, skips the
+ *    conversion to mV
+ *  - uses Vcc as reference (no auto-scaling) and Cfg.Samples samples
+ *  - get threshold via ADC_Counts(), once before a loop or after a
+ *    change of Cfg.Vcc or Cfg.Samples
+ *
+ *  requires:
+ *  - Channel: ADC MUX input channel (see ReadU())
+ *
+ *  returns:
+ *  - sum of ADC readings
+ */
+
+uint32_t ReadU_Raw(uint8_t Channel)
+{
+  uint8_t           Counter = 0;   /* loop counter */
+  uint32_t          Value = 0UL;   /* sum of ADC readings */
+
+  /* prepare bitfield for register: AVcc as voltage reference */
+  Channel &= ADC_CHAN_MASK;        /* filter reg bits for MUX channel */
+  Channel |= ADC_REF_VCC;          /* add bits for voltage reference: AVcc */
+
+  /* set channel and reference, wait for reference to stabilize */
+  ADC_SetReference(Channel);
+
+  /* perform dummy conversion anyway */
+  ADCSRA |= (1 << ADSC);           /* start conversion */
+  while (ADCSRA & (1 << ADSC));    /* wait until conversion is done */
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_ADC]++;         /* count conversion */
+  #endif
+
+  while (Counter < Cfg.Samples)    /* take samples */
+  {
+    ADCSRA |= (1 << ADSC);         /* start conversion */
+    while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+    #ifdef SW_PERF_COUNTERS
+    PerfCount[PERF_ADC]++;       /* count conversion */
+    #endif
+
+    Value += ADCW;                 /* add ADC reading */
+    Counter++;                     /* another sample done */
+  }
+
+  return Value;
+}
+
+
+
+/*
+ *  convert voltage threshold to raw sum of ADC readings
+ *  - for comparisons with ReadU_Raw()
+ *  - Counts = U * 1024 * Samples / Vcc
+ *
+ *  requires:
+ *  - U: voltage threshold in mV (max. 5V)
+ *
+ *  returns:
+ *  - sum of ADC readings matching U
+ */
+
+uint32_t ADC_Counts(uint16_t U)
+{
+  uint32_t          Value;         /* return value */
+
+  Value = U;
+  Value *= 1024;                   /* * 1024 for 10bit ADC */
+  Value *= Cfg.Samples;            /* * number of samples */
+  Value /= Cfg.Vcc;                /* / U_ref */
+
+  return Value;
+}
+
+
+
+#ifdef ADC_OVERSAMPLING
+
+/*
+ *  read ADC channel with increased resolution by oversampling and
+ *  decimation and return voltage in 0.1mV
+ *  - for n additional bits 4^n samples are added and the sum is
+ *    shifted right by n bits
+ *  - requires some noise of at least 1 LSB as dither, which is provided
+ *    by the ADC's and Vcc's inherent noise (there's no dedicated dither
+ *    source)
+ *  - switches to bandgap reference for low voltages (< 1.0V) like ReadU()
+ *  - 3 additional bits (13 bits) need 64 samples, i.e. about 7ms
+ *
+ *  requires:
+ *  - Channel: ADC MUX input channel (see ReadU())
+ *  - Bits: number of additional bits (1-3)
+ *
+ *  returns:
+ *  - voltage in 0.1mV
+ */
+
+uint16_t ReadU_HiRes(uint8_t Channel, uint8_t Bits)
+{
+  uint8_t           Ref;           /* voltage reference register bits */
+  uint8_t           Samples;       /* number of samples */
+  uint8_t           Counter;       /* loop counter */
+  uint32_t          Value;         /* ADC value */
+
+  /* limit additional bits to prevent an overflow */
+  if (Bits > 3) Bits = 3;
+  Samples = 1 << (Bits * 2);       /* 4^n samples */
+
+  /* prepare bitfield for register: start with AVcc as voltage reference */
+  Channel &= ADC_CHAN_MASK;        /* filter reg bits for MUX channel */
+  Channel |= ADC_REF_VCC;          /* add bits for voltage reference: AVcc */
+
+sample:
+
+  /* set channel and reference, wait for reference to stabilize */
+  Ref = ADC_SetReference(Channel);
+
+  /* perform dummy conversion anyway */
+  ADCSRA |= (1 << ADSC);           /* start conversion */
+  while (ADCSRA & (1 << ADSC));    /* wait until conversion is done */
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_ADC]++;         /* count conversion */
+  #endif
+
+  /*
+   *  sample ADC readings
+   */
+
+  Value = 0UL;                     /* reset sampling variable */
+  Counter = 0;                     /* reset counter */
+
+  while (Counter < Samples)        /* take samples */
+  {
+    ADCSRA |= (1 << ADSC);         /* start conversion */
+    while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+    #ifdef SW_PERF_COUNTERS
+    PerfCount[PERF_ADC]++;       /* count conversion */
+    #endif
+
+    Value += ADCW;                 /* add ADC reading */
+
+    /* auto-switch voltage reference for low readings */
+    if (Counter == 3)                   /* 4 samples (minimum) */
+    {
+      if ((uint16_t)Value < 820)        /* < 1V (5V / 4 samples) */
+      {
+        if (Ref != ADC_REF_BANDGAP)     /* bandgap ref not selected */
+        {
+          if (Cfg.AutoScale == 1)       /* autoscaling enabled */
+          {
+            Channel &= ~ADC_REF_MASK;     /* clear reference bits */
+            Channel |= ADC_REF_BANDGAP;   /* select bandgap reference */
+
+            goto sample;                /* re-run sampling */
+          }
+        }
+      }
+    }
+
+    Counter++;                     /* another sample done */
+  }
+
+  /* decimation: 10 + n bits */
+  Value >>= Bits;
+
+  /*
+   *  convert ADC reading to voltage
+   *  - U = ADC reading * U_ref / 2^(10 + n)
+   */
+
+  if (Ref == ADC_REF_BANDGAP)      /* bandgap reference */
+  {
+    Value *= Cfg.Bandgap;            /* * U_ref (mV) */
+  }
+  else                             /* Vcc as reference */
+  {
+    Value *= Cfg.Vcc;                /* * U_ref (mV) */
+  }
+
+  Value *= 10;                     /* scale to 0.1mV */
+  Value >>= (10 + Bits);           /* / 2^(10 + n) */
+
+  return (uint16_t)Value;
+}
+
+#endif
+
+
+
+#ifdef ADC_INTERRUPT
+
+/*
+ *  start sampling of ADC channel (interrupt driven)
+ *  - internal function for ADC_Start() and ADC_Ready()
+ *  - resets sampling variables and starts dummy conversion,
+ *    ISR takes care about the rest
+ *
+ *  requires:
+ *  - Channel: register bits for ADMUX (channel and voltage reference)
+ */
+
+void ADC_Run(uint8_t Channel)
+{
+  /* set channel and reference, wait for reference to stabilize */
+  ADC_SetReference(Channel);
+
+  /* reset sampling variables */
+  Sampling.Channel = Channel;
+  Sampling.Sum = 0UL;
+  Sampling.Counter = 0;
+  #ifdef ADC_ADAPTIVE
+  Sampling.DiffSum = 0;
+  Sampling.DiffSum2 = 0UL;
+  #endif
+  Sampling.State = SAMPLING_DUMMY;
+
+  /*
+   *  start dummy conversion
+   *  - clear a pending ADIF from any former polled conversion
+   *    (done by writing 1), otherwise the ISR would be triggered at 
+   *    once by an outdated result
+   */
+
+  ADCSRA |= (1 << ADIF) | (1 << ADIE) | (1 << ADSC);
+}
+
+
+
+/*
+ *  start interrupt driven sampling of ADC channel
+ *  - the ISR runs a dummy conversion and takes the samples while the
+ *    caller is free to do other things
+ *  - use ADC_Ready() to poll the state and ADC_Collect() to get the
+ *    voltage
+ *  - auto-switches to bandgap reference like ReadU_Desc()
+ *  - the settle mode of the sampling descriptor is ignored
+ *  - don't change probe settings while sampling and don't enter any
+ *    sleep mode stopping the ADC clock (e.g. via MilliSleep())
+ *  - enables interrupts, ADC_Collect() restores the former setting
+ *
+ *  requires:
+ *  - Channel: ADC MUX input channel (see ReadU())
+ *  - Desc: sampling descriptor (see ReadU_Desc())
+ */
+
+void ADC_Start(uint8_t Channel, uint16_t Desc)
+{
+  /* AREF pin is connected to external buffer cap (1nF) */
+
+  /* prepare bitfield for register: start with AVcc as voltage reference */
+  Channel &= ADC_CHAN_MASK;        /* filter reg bits for MUX channel */
+  Channel |= ADC_REF_VCC;          /* add bits for voltage reference: AVcc */
+
+  /* sampling descriptor */
+  Sampling.Samples = (uint8_t)(Desc & SAMPLE_COUNT_MASK);
+  if (Sampling.Samples == 0) Sampling.Samples = Cfg.Samples;   /* default */
+
+  Sampling.Flags = 0;              /* reset flags */
+  if ((Desc & SAMPLE_REF_VCC) || (Cfg.AutoScale == 0))
+  {
+    Sampling.Flags |= SAMPLING_VCC;     /* no autoscaling */
+  }
+  if (Desc & SAMPLE_FULL)
+  {
+    Sampling.Flags |= SAMPLING_FULL;    /* no early termination */
+  }
+
+  /* manage interrupts */
+  if (SREG & (1 << SREG_I))        /* if interrupts are already enabled */
+  {
+    Sampling.Flags |= SAMPLING_INT;     /* keep that in mind */
+  }
+  else                             /* otherwise */
+  {
+    sei();                              /* enable interrupts */
+  }
+
+  ADC_Run(Channel);                /* start sampling */
+}
+
+
+
+/*
+ *  check state of interrupt driven sampling
+ *  - also restarts sampling with bandgap reference when requested
+ *    by the ISR (auto-scaling)
+ *
+ *  returns:
+ *  - 0 if sampling is still in progress
+ *  - 1 if sampling is done
+ */
+
+uint8_t ADC_Ready(void)
+{
+  uint8_t           Flag = 0;      /* return value */
+  uint8_t           Channel;       /* register bits for ADMUX */
+
+  if (Sampling.State == SAMPLING_SWITCH)     /* change of reference */
+  {
+    /*
+     *  The ISR has detected a low voltage. Stabilizing the new reference
+     *  voltage takes some time, so we do that here and not within the ISR.
+     */
+
+    Channel = Sampling.Channel;
+    Channel &= ~ADC_REF_MASK;           /* clear reference bits */
+    Channel |= ADC_REF_BANDGAP;         /* select bandgap reference */
+
+    ADC_Run(Channel);                   /* re-run sampling */
+  }
+  else if (Sampling.State == SAMPLING_DONE)  /* all samples taken */
+  {
+    Flag = 1;                           /* signal "done" */
+  }
+
+  return Flag;
+}
+
+
+
+/*
+ *  wait for interrupt driven sampling to finish and return voltage
+ *  - requires a former call of ADC_Start()
+ *  - with ADC_NOISE_REDUCTION samples based on the bandgap reference
+ *    are taken in ADC Noise Reduction sleep mode
+ *
+ *  returns:
+ *  - voltage in mV
+ */
+
+uint16_t ADC_Collect(void)
+{
+  uint16_t          U;             /* return value (mV) */
+
+  while (ADC_Ready() == 0)         /* wait until sampling is done */
+  {
+    #ifdef ADC_NOISE_REDUCTION
+    /*
+     *  Low voltages (bandgap reference) are affected by digital noise
+     *  of the running MCU core. Entering the ADC Noise Reduction mode
+     *  starts a conversion automatically and the ADC ISR wakes us up.
+     *  - sleep only when the next sample is due, otherwise an extra
+     *    conversion would be started
+     *  - sei directly followed by sleep prevents a lost wake-up
+     */
+
+    if ((Sampling.Channel & ADC_REF_MASK) == ADC_REF_BANDGAP)
+    {
+      Sampling.Flags |= SAMPLING_SLEEP;      /* ISR: don't start conversion */
+      set_sleep_mode(SLEEP_MODE_ADC);        /* set sleep mode */
+
+      cli();                                 /* disable interrupts */
+      if ((Sampling.State == SAMPLING_RUN) && ! (ADCSRA & (1 << ADSC)))
+      {
+        sleep_enable();                      /* enable sleep */
+        sei();                               /* enable interrupts */
+        sleep_cpu();                         /* sleep, start conversion */
+        /* woken up */
+        sleep_disable();                     /* disable sleep */
+      }
+      sei();                                 /* enable interrupts */
+    }
+    #endif
+  }
+
+  #if defined (ADC_NOISE_REDUCTION) && defined (SAVE_POWER)
+  set_sleep_mode(Cfg.SleepMode);   /* restore default sleep mode */
+  #endif
+
+  Sampling.State = SAMPLING_IDLE;  /* reset state */
+
+  if (! (Sampling.Flags & SAMPLING_INT))     /* interrupts were disabled */
+  {
+    cli();                              /* restore former setting */
+  }
+
+  /* convert ADC readings to voltage */
+  U = ADC_Voltage(Sampling.Sum, Sampling.Channel & ADC_REF_MASK, Sampling.Counter);
+
+  return U;
+}
+
+
+
+/*
+ *  read ADC channel based on sampling descriptor and return voltage in mV
+ *  - interrupt driven version
+ *  - see polling version above for details
+ *
+ *  requires:
+ *  - Channel: ADC MUX input channel
+ *  - Desc: sampling descriptor (see SAMPLE_* in common.h)
+ */
+
+uint16_t ReadU_Desc(uint8_t Channel, uint16_t Desc)
+{
+  #ifdef HW_ADS1115
+  uint32_t          Value;         /* voltage of external ADC */
+  #endif
+
+  /* settle mode */
+  if (Desc & SAMPLE_SETTLE_20MS)        /* 20ms */
+  {
+    ADC_Settle(Channel, 20);
+  }
+  else if (Desc & SAMPLE_SETTLE_5MS)    /* 5ms */
+  {
+    ADC_Settle(Channel, 5);
+  }
+
+  #ifdef HW_ADS1115
+  if (Cfg.ADC_Backend == ADC_EXT)       /* external ADC selected */
+  {
+    Value = ReadU_Ext(Channel, ADS1115_SAMPLES);
+    if (Value != ADC_EXT_ERROR)         /* got voltage */
+    {
+      Value += 50;                      /* rounding */
+      return (uint16_t)(Value / 100);   /* 0.01mV -> mV */
+    }
+    /* otherwise fall back to internal ADC */
+  }
+  #endif
+
+  ADC_Start(Channel, Desc);        /* start sampling */
+
+  return ADC_Collect();            /* wait and get voltage */
+}
+
+
+
+/*
+ *  read ADC channel and return voltage in mV
+ *  - default sampling (Cfg.Samples, auto-scaling)
+ *
+ *  requires:
+ *  - Channel: ADC MUX input channel
+ */
+
+uint16_t ReadU(uint8_t Channel)
+{
+  return ReadU_Desc(Channel, SAMPLE_STD);
+}
+
+
+
+/*
+ *  ISR for ADC (conversion complete)
+ */
+
+ISR(ADC_vect, ISR_BLOCK)
+{
+  uint8_t           Flag = 1;      /* control flag */
+  #ifdef ADC_ADAPTIVE
+  uint16_t          Sample;        /* single ADC reading */
+  int16_t           Diff;          /* deviation from first reading */
+  #endif
+
+  /*
+   *  hints:
+   *  - the ADIF interrupt flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_ADC]++;      /* count ADC conversion */
+  #endif
+
+  if (Sampling.State == SAMPLING_DUMMY)      /* dummy conversion done */
+  {
+    Sampling.State = SAMPLING_RUN;      /* start sampling */
+  }
+  else if (Sampling.State == SAMPLING_RUN)   /* sample */
+  {
+    #ifdef ADC_ADAPTIVE
+    Sample = ADCW;                      /* get ADC reading */
+    Sampling.Sum += Sample;             /* add ADC reading */
+
+    /* track deviations from first reading */
+    if (Sampling.Counter == 0) Sampling.First = Sample;
+    Diff = (int16_t)(Sample - Sampling.First);
+    Sampling.DiffSum += Diff;
+    Sampling.DiffSum2 += (int32_t)Diff * Diff;
+    #else
+    Sampling.Sum += ADCW;               /* add ADC reading */
+    #endif
+    Sampling.Counter++;                 /* another sample done */
+
+    /* auto-switch voltage reference for low readings */
+    if (Sampling.Counter == 5)          /* 5 samples */
+    {
+      if ((uint16_t)Sampling.Sum < 1024)     /* < 1V (5V / 5 samples) */
+      {
+        /* bandgap ref not selected and autoscaling enabled */
+        if (((Sampling.Channel & ADC_REF_MASK) != ADC_REF_BANDGAP) &&
+            ! (Sampling.Flags & SAMPLING_VCC))
+        {
+          /* request change of reference */
+          Sampling.State = SAMPLING_SWITCH;
+          Flag = 0;                     /* stop sampling */
+        }
+      }
+    }
+
+    /* all samples taken (unless switch of reference is pending) */
+    if ((Sampling.State != SAMPLING_SWITCH) &&
+        (Sampling.Counter >= Sampling.Samples))
+    {
+      Sampling.State = SAMPLING_DONE;   /* signal "done" */
+      Flag = 0;                         /* stop sampling */
+    }
+    #ifdef ADC_ADAPTIVE
+    /* early termination for stable readings (after 5 samples) */
+    else if ((Flag) && (Sampling.Counter >= 5) &&
+             ! (Sampling.Flags & SAMPLING_FULL))
+    {
+      if (ADC_Stable(Sampling.Counter, Sampling.DiffSum, Sampling.DiffSum2))
+      {
+        Sampling.State = SAMPLING_DONE; /* signal "done" */
+        Flag = 0;                       /* stop sampling */
+      }
+    }
+    #endif
+  }
+  else                                       /* stray conversion */
+  {
+    Flag = 0;                           /* stop sampling */
+  }
+
+  if (Flag == 0)             /* stop */
+  {
+    ADCSRA &= ~(1 << ADIE);             /* disable ADC interrupt */
+  }
+  #ifdef ADC_NOISE_REDUCTION
+  else if (Sampling.Flags & SAMPLING_SLEEP)  /* sleep mode starts conversion */
+  {
+    /* ADC_Collect() enters ADC Noise Reduction mode for next sample */
+  }
+  #endif
+  else                       /* keep sampling */
+  {
+    ADCSRA |= (1 << ADSC);              /* start next conversion */
+  }
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   convenience functions
+ * ************************************************************************ */
+
+
+/*
+ *  wait for voltage to settle
+ *  - settle mode of ReadU_Desc()
+ *  - with ADC_SETTLE: takes quick readings (SAMPLE_QUICK) about every
+ *    1ms until three consecutive readings agree within ADC_SETTLE (in mV)
+ *  - otherwise: fixed delay of 5ms or 20ms
+ *
+ *  requires:
+ *  - Channel: ADC MUX input channel (see ReadU())
+ *  - Timeout: max. time to wait (in ms)
+ */
+
+void ADC_Settle(uint8_t Channel, uint8_t Timeout)
+{
+  #ifdef ADC_SETTLE
+  uint8_t           Hits = 0;      /* counter for matching readings */
+  uint16_t          U;             /* current voltage */
+  uint16_t          U_Old;         /* former voltage */
+  uint16_t          Diff;          /* voltage difference */
+
+  U_Old = ReadU_Desc(Channel, SAMPLE_QUICK);      /* first reading */
+
+  while (Timeout > 0)              /* loop until timeout */
+  {
+    wait500us();                   /* wait 0.5ms */
+    U = ReadU_Desc(Channel, SAMPLE_QUICK);   /* get voltage */
+    Timeout--;                     /* about 1ms passed */
+
+    /* get difference */
+    if (U > U_Old) Diff = U - U_Old;
+    else Diff = U_Old - U;
+
+    if (Diff <= ADC_SETTLE)        /* within threshold */
+    {
+      Hits++;                      /* another match */
+      if (Hits >= 2) break;        /* three matching readings */
+    }
+    else                           /* still changing */
+    {
+      Hits = 0;                    /* reset counter */
+    }
+
+    U_Old = U;                     /* update former voltage */
+  }
+  #else
+  if (Timeout >= 20) settle20ms(); /* wait 20ms */
+  else settle5ms();                /* wait 5ms */
+  #endif
+}
+
+
+
+#ifdef ADC_SETTLE
+
+/*
+ *  wait for voltage to settle and then read ADC
+ *  - timeout replaces the fixed delay of ReadU_5ms() and ReadU_20ms()
+ *  - suitable for low impedance nodes, a slowly charging node (e.g.
+ *    large cap) might look settled
+ *
+ *  requires:
+ *  - Channel: ADC MUX input channel (see ReadU())
+ *  - Timeout: max. time to wait (in ms)
+ *
+ *  returns:
+ *  - voltage in mV
+ */
+
+uint16_t ReadU_Settled(uint8_t Channel, uint8_t Timeout)
+{
+  ADC_Settle(Channel, Timeout);    /* wait for voltage to settle */
+
+  return (ReadU(Channel));         /* final reading */
+}
+
+#endif
+
+
+
+/*
+ *  wait 5ms and then read ADC
+ *  - same as ReadU()
+ *  - with ADC_SETTLE: wait until voltage settles (timeout 5ms)
+ */
+
+uint16_t ReadU_5ms(uint8_t Channel)
+{
+  return (ReadU_Desc(Channel, SAMPLE_STD | SAMPLE_SETTLE_5MS));
+}
+
+
+
+/*
+ *  wait 20ms and then read ADC
+ *  - same as ReadU()
+ *  - with ADC_SETTLE: wait until voltage settles (timeout 20ms)
+ */
+
+uint16_t ReadU_20ms(uint8_t Channel)
+{
+  return (ReadU_Desc(Channel, SAMPLE_STD | SAMPLE_SETTLE_20MS));
 }
 
 
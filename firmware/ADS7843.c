@@ -18,6 +18,9 @@
  *  - max. SPI clock
  *    - ADS7843: 2.5 MHz
  *    - XPT2046: 2.5 MHz
+ *  - optional pen interrupt (TOUCH_PCINT)
+ *    /PENIRQ triggers a pin change interrupt, and the controller is
+ *    read via SPI only after a touch event has been signaled
  */
 
 
@@ -34,6 +37,9 @@
 /* source management */
 #define TOUCH_DRIVER_C
 
+/* number of samples for median filter (odd number, max. 7) */
+#define TOUCH_SAMPLES         5
+
 
 /*
  *  include header files
@@ -47,6 +53,62 @@
 #include "ADS7843.h"          /* ADS7843 specifics */
 
 
+#ifdef TOUCH_PCINT
+
+/*
+ *  pin change interrupt for /PENIRQ
+ */
+
+#define BIT_PC_PIN       (TOUCH_PCINT % 8)   /* bit in mask register */
+
+/* PCINT0-7 */
+#if (TOUCH_PCINT >= 0) && (TOUCH_PCINT <= 7)
+  #define BIT_PC_IRQ     PCIE0          /* Pin Change Interrupt Enable 0 */
+  #define BIT_PC_FLAG    PCIF0          /* Pin Change Interrupt Flag 0 */
+  #define REG_PC_MASK    PCMSK0         /* Pin Change Mask Register 0 */
+  #define ISR_PINCHANGE  PCINT0_vect    /* ISR */
+#endif
+
+/* PCINT8-15 */
+#if (TOUCH_PCINT >= 8) && (TOUCH_PCINT <= 15)
+  #define BIT_PC_IRQ     PCIE1          /* Pin Change Interrupt Enable 1 */
+  #define BIT_PC_FLAG    PCIF1          /* Pin Change Interrupt Flag 1 */
+  #define REG_PC_MASK    PCMSK1         /* Pin Change Mask Register 1 */
+  #define ISR_PINCHANGE  PCINT1_vect    /* ISR */
+#endif
+
+/* PCINT16-23 */
+#if (TOUCH_PCINT >= 16) && (TOUCH_PCINT <= 23)
+  #define BIT_PC_IRQ     PCIE2          /* Pin Change Interrupt Enable 2 */
+  #define BIT_PC_FLAG    PCIF2          /* Pin Change Interrupt Flag 2 */
+  #define REG_PC_MASK    PCMSK2         /* Pin Change Mask Register 2 */
+  #define ISR_PINCHANGE  PCINT2_vect    /* ISR */
+#endif
+
+/* PCINT24-31 */
+#if (TOUCH_PCINT >= 24) && (TOUCH_PCINT <= 31)
+  #define BIT_PC_IRQ     PCIE3          /* Pin Change Interrupt Enable 3 */
+  #define BIT_PC_FLAG    PCIF3          /* Pin Change Interrupt Flag 3 */
+  #define REG_PC_MASK    PCMSK3         /* Pin Change Mask Register 3 */
+  #define ISR_PINCHANGE  PCINT3_vect    /* ISR */
+#endif
+
+/* other users of the same ISR */
+#if defined (SERIAL_BITBANG) && ((TOUCH_PCINT / 8) == (SERIAL_PCINT / 8))
+  #error <<< Touch: bit-bang serial uses same PCINT bank! >>>
+#endif
+
+#if defined (SW_IR_RX_PCINT) && ((TOUCH_PCINT / 8) == (IR_PCINT / 8))
+  #error <<< Touch: IR detector edge capture uses same PCINT bank! >>>
+#endif
+
+#if defined (SW_DHTXX_PCINT) && ((TOUCH_PCINT / 8) == ((ADC_PCINT + TP2) / 8))
+  #error <<< Touch: DHTxx edge capture uses same PCINT bank! >>>
+#endif
+
+#endif
+
+
 /*
  *  local variables
  */
@@ -57,6 +119,11 @@ uint8_t             ClockRate;     /* SPI clock rate bits */
 uint8_t             OldClockRate;  /* SPI clock rate bits */
 #endif
 
+#ifdef TOUCH_PCINT
+/* pen interrupt */
+volatile uint8_t    TouchEvent = 0;     /* touch event flag */
+#endif
+
 
 
 /* ************************************************************************
@@ -198,21 +265,65 @@ void Touch_DeselectChip(void)
 
 
 
+/*
+ *  get median of samples
+ *  - sorts samples (insertion sort)
+ *
+ *  requires:
+ *  - Data: pointer to array of TOUCH_SAMPLES values
+ *
+ *  returns:
+ *  - median
+ */
+
+uint16_t Touch_Median(uint16_t *Data)
+{
+  uint8_t           n, m;     /* counters */
+  uint16_t          Value;    /* temp. value */
+
+  n = 1;
+  while (n < TOUCH_SAMPLES)
+  {
+    Value = Data[n];          /* get value */
+    m = n;
+
+    /* shift larger values up */
+    while ((m > 0) && (Data[m - 1] > Value))
+    {
+      Data[m] = Data[m - 1];
+      m--;
+    }
+
+    Data[m] = Value;          /* insert value */
+    n++;                      /* next value */
+  }
+
+  return Data[TOUCH_SAMPLES / 2];    /* middle value */
+}
+
+
+
 /*
  *  get X and Y values from controller
+ *  - takes median of several samples to remove jitter and outliers
  */
 
 void Touch_Read_XY(void)
 {
-  uint8_t           n = 1;    /* counter */
-  uint16_t          X = 0;    /* raw X position */
-  uint16_t          Y = 0;    /* raw Y position */
+  uint8_t           n = 0;    /* counter */
+  uint16_t          X[TOUCH_SAMPLES];   /* raw X positions */
+  uint16_t          Y[TOUCH_SAMPLES];   /* raw Y positions */
 
   /*
    *  We use the differential reference and 12 bit resolution
    *  - hint: power mode "always on" disables /PEN_IRQ
    */
 
+  #ifdef TOUCH_PCINT
+  /* conversions toggle /PENIRQ */
+  REG_PC_MASK &= ~(1 << BIT_PC_PIN);    /* disable /PENIRQ pin */
+  #endif
+
   Touch_SelectChip();                   /* select chip */
 
   /*
@@ -224,35 +335,30 @@ void Touch_Read_XY(void)
    *    - send Cmd2 in third byte
    */
 
-  /*
-   *  todo:
-   *  - don't just average 4 samples
-   *  - check if positions are within some margin window
-   *  - add return value (flag)?
-   */
-
-  while (n <= 4)              /* take 4 samples */
+  while (n < TOUCH_SAMPLES)   /* take samples */
   {
     /* get raw X value */
-    X += Touch_Xfer(FLAG_STARTBIT | FLAG_CHAN_X | FLAG_DFR | FLAG_PWR_ALWAYS);
+    X[n] = Touch_Xfer(FLAG_STARTBIT | FLAG_CHAN_X | FLAG_DFR | FLAG_PWR_ALWAYS);
 
     /* get raw Y value */
-    Y += Touch_Xfer(FLAG_STARTBIT | FLAG_CHAN_Y | FLAG_DFR | FLAG_PWR_ALWAYS);
+    Y[n] = Touch_Xfer(FLAG_STARTBIT | FLAG_CHAN_Y | FLAG_DFR | FLAG_PWR_ALWAYS);
 
     n++;            /* next round */
   }
 
-  X /= 4;           /* calculate average */
-  Y /= 4;           /* calculate average */
-
   /* dummy conversion to enable /PEN_IRQ again */
   Touch_Xfer(FLAG_STARTBIT | FLAG_CHAN_X | FLAG_SER | FLAG_PWR_DOWN_1);
 
   Touch_DeselectChip();                 /* disable chip */
 
+  #ifdef TOUCH_PCINT
+  PCIFR = (1 << BIT_PC_FLAG);           /* clear interrupt flag */
+  REG_PC_MASK |= (1 << BIT_PC_PIN);     /* enable /PENIRQ pin again */
+  #endif
+
   /* update global variables */
-  UI.TouchRaw_X = X;
-  UI.TouchRaw_Y = Y;
+  UI.TouchRaw_X = Touch_Median(X);
+  UI.TouchRaw_Y = Touch_Median(Y);
 }
 
 
@@ -452,10 +558,47 @@ void Touch_Init(void)
   Touch_Xfer(FLAG_STARTBIT | FLAG_CHAN_X | FLAG_SER| FLAG_PWR_DOWN_1);
 
   Touch_DeselectChip();                 /* disable chip */
+
+  #ifdef TOUCH_PCINT
+  /* enable pin change interrupt for /PENIRQ */
+  REG_PC_MASK |= (1 << BIT_PC_PIN);     /* enable /PENIRQ pin */
+  PCIFR = (1 << BIT_PC_FLAG);           /* clear interrupt flag */
+  PCICR |= (1 << BIT_PC_IRQ);           /* enable pin change interrupt */
+  #endif
 }
 
 
 
+#ifdef TOUCH_PCINT
+
+/*
+ *  ISR for pin change of /PENIRQ
+ *  - signals touch event when /PENIRQ is low
+ *  - also wakes up the MCU from sleep mode
+ */
+
+ISR(ISR_PINCHANGE, ISR_BLOCK)
+{
+  /*
+   *  hints:
+   *  - the interrupt flag is cleared automatically
+   *  - all other interrupts are disabled
+   */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_PCINT]++;    /* count ISR call */
+  #endif
+
+  if (! (TOUCH_PIN & (1 << TOUCH_PEN)))    /* /PENIRQ low */
+  {
+    TouchEvent = 1;           /* signal touch event */
+  }
+}
+
+#endif
+
+
+
 /*
  *  check touch screen and get position when touched
  *
@@ -469,9 +612,22 @@ uint8_t Touch_Check(void)
   uint8_t           Flag = 0;      /* return value */
   uint8_t           Test;
 
+  #ifdef TOUCH_PCINT
+  /* no pen interrupt: screen not touched */
+  if (TouchEvent == 0) return Flag;
+  #endif
+
   /* check for /PEN_IRQ */
   Test = TOUCH_PIN;                /* read port */
   Test &= (1 << TOUCH_PEN);        /* filter /PEN_IRQ */
+
+  #ifdef TOUCH_PCINT
+  if (Test)                        /* /PEN_IRQ high */
+  {
+    TouchEvent = 0;                /* pen released */
+  }
+  #endif
+
   if (Test == 0)                   /* /PEN_IRQ low */
   {
     /* touch event */
@@ -522,6 +678,9 @@ uint8_t Touch_AdjustPos(uint8_t Char_X, uint8_t Char_Y)
     /* check test key (to abort adjustment) */
     if (!(BUTTON_PIN & (1 << TEST_BUTTON)))  /* test button pressed */
     {
+      #ifdef INPUT_QUEUE
+      Key_Flush();            /* key press is processed already */
+      #endif
       break;                  /* abort */
     }
 
@@ -702,6 +861,16 @@ uint8_t Touch_Adjust(void)
  *   clean-up of local constants
  * ************************************************************************ */
 
+/* local constants */
+#undef TOUCH_SAMPLES
+#ifdef TOUCH_PCINT
+  #undef BIT_PC_PIN
+  #undef BIT_PC_IRQ
+  #undef BIT_PC_FLAG
+  #undef REG_PC_MASK
+  #undef ISR_PINCHANGE
+#endif
+
 /* source management */
 #undef TOUCH_DRIVER_C
 
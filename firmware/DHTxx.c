@@ -55,6 +55,78 @@
 #include "functions.h"        /* external functions */
 
 
+#ifdef SW_DHTXX_PCINT
+
+/*
+ *  edge capture
+ *  - response: 3 edges (low 80s, high 80s)
+ *  - data: 2 edges per bit (40 bits)
+ *  - end: 1 edge (release after last low pulse of 50s)
+ *  - max. number of edges: DHT_MAX_EDGES (see common.h)
+ */
+
+/* Data pin (probe-2) and its PCINT# */
+#define DHT_PCINT_PIN    (ADC_PCINT + TP2)
+
+/* pin change interrupt bank */
+#define BIT_PC_PIN       (DHT_PCINT_PIN % 8) /* bit in mask register */
+
+/* PCINT0-7 */
+#if (DHT_PCINT_PIN >= 0) && (DHT_PCINT_PIN <= 7)
+  #define BIT_PC_IRQ     PCIE0          /* Pin Change Interrupt Enable 0 */
+  #define BIT_PC_FLAG    PCIF0          /* Pin Change Interrupt Flag 0 */
+  #define REG_PC_MASK    PCMSK0         /* Pin Change Mask Register 0 */
+  #define ISR_PINCHANGE  PCINT0_vect    /* ISR */
+#endif
+
+/* PCINT8-15 */
+#if (DHT_PCINT_PIN >= 8) && (DHT_PCINT_PIN <= 15)
+  #define BIT_PC_IRQ     PCIE1          /* Pin Change Interrupt Enable 1 */
+  #define BIT_PC_FLAG    PCIF1          /* Pin Change Interrupt Flag 1 */
+  #define REG_PC_MASK    PCMSK1         /* Pin Change Mask Register 1 */
+  #define ISR_PINCHANGE  PCINT1_vect    /* ISR */
+#endif
+
+/* PCINT16-23 */
+#if (DHT_PCINT_PIN >= 16) && (DHT_PCINT_PIN <= 23)
+  #define BIT_PC_IRQ     PCIE2          /* Pin Change Interrupt Enable 2 */
+  #define BIT_PC_FLAG    PCIF2          /* Pin Change Interrupt Flag 2 */
+  #define REG_PC_MASK    PCMSK2         /* Pin Change Mask Register 2 */
+  #define ISR_PINCHANGE  PCINT2_vect    /* ISR */
+#endif
+
+/* PCINT24-31 */
+#if (DHT_PCINT_PIN >= 24) && (DHT_PCINT_PIN <= 31)
+  #define BIT_PC_IRQ     PCIE3          /* Pin Change Interrupt Enable 3 */
+  #define BIT_PC_FLAG    PCIF3          /* Pin Change Interrupt Flag 3 */
+  #define REG_PC_MASK    PCMSK3         /* Pin Change Mask Register 3 */
+  #define ISR_PINCHANGE  PCINT3_vect    /* ISR */
+#endif
+
+/* other users of the same ISR */
+#if defined (SERIAL_BITBANG) && ((DHT_PCINT_PIN / 8) == (SERIAL_PCINT / 8))
+  #error <<< DHTxx: bit-bang serial uses same PCINT bank! >>>
+#endif
+
+#if defined (SW_IR_RX_PCINT) && defined (SW_IR_RECEIVER)
+  #error <<< DHTxx: IR detector edge capture uses same PCINT bank! >>>
+#elif defined (SW_IR_RX_PCINT) && ((IR_PCINT / 8) == (DHT_PCINT_PIN / 8))
+  #error <<< DHTxx: IR detector edge capture uses same PCINT bank! >>>
+#endif
+
+
+/*
+ *  local variables
+ */
+
+/* edge capture */
+volatile uint8_t    DHT_Edges;                    /* number of edges */
+/* time stamps of edges, kept in scratch arena */
+#define DHT_Stamps          ((volatile uint16_t *)Scratch)
+
+#endif
+
+
 
 /* ************************************************************************
  *   low level functions
@@ -128,77 +200,49 @@ uint8_t DHTxx_Probes(void)
 
 
 
+#ifndef SW_DHTXX_PCINT
+
 /*
- *  wait for DATA line to be pulled down by sensor
+ *  wait for level change of DATA line
+ *  - measures time with s time stamp (Timer1)
  *
  *  requires:
- *  - Timeout: timeout (in 10s steps)
+ *  - Level: level to wait for
+ *    0 - low (pulled down by sensor)
+ *    1 - high (released by sensor)
+ *  - Timeout: timeout (in time stamp ticks, see TIMESTAMP_TICKS())
  *
  *  returns:
  *  - 0  error or timeout exceeded
- *  - >0 time (in 10s steps)
+ *  - >0 time (in time stamp ticks)
  */
 
-uint8_t DHTxx_WaitPullDown(uint8_t Timeout)
+uint16_t DHTxx_WaitLevel(uint8_t Level, uint16_t Timeout)
 {
-  uint8_t           Ticks = 0;     /* return value */
+  uint16_t          Ticks = 0;     /* return value */
+  uint16_t          Start;         /* start time */
+  uint16_t          Time;          /* elapsed time */
+
+  if (Level) Level = (1 << TP2);   /* convert into bit mask */
+
+  Start = TCNT1;                   /* get time stamp */
 
-  while (Timeout > 0)
+  while (1)
   {
-    wait10us();                    /* wait 10s */
-    Ticks++;                       /* increase time */
+    Time = TCNT1 - Start;          /* elapsed time */
 
-    if (! (ADC_PIN & (1 << TP2)))  /* check for low level of probe-2 */
+    /* check level of probe-2 */
+    if ((ADC_PIN & (1 << TP2)) == Level)
     {
+      Ticks = Time;                /* save time */
+      if (Ticks == 0) Ticks = 1;   /* prevent false timeout */
       break;                       /* end loop */
     }
 
-    Timeout--;                     /* decrease timeout */
-  }
-
-  /* manage timeout */
-  if (Timeout == 0)           /* timeout exceeded */
-  {
-    Ticks = 0;                /* reset time */
-  }
-
-  return Ticks;
-}
-
-
-
-/*
- *  wait for DATA line to be released by sensor
- *
- *  requires:
- *  - Timeout: timeout (in 10s steps)
- *
- *  returns:
- *  - 0  error or timeout exceeded
- *  - >0 time (in 10s steps)
- */
-
-uint8_t DHTxx_WaitRelease(uint8_t Timeout)
-{
-  uint8_t           Ticks = 0;     /* return value */
-
-  while (Timeout > 0)
-  {
-    wait10us();                    /* wait 10s */
-    Ticks++;                       /* increase time */
-
-    if (ADC_PIN & (1 << TP2))      /* check for high level of probe-2 */
+    if (Time >= Timeout)           /* timeout exceeded */
     {
       break;                       /* end loop */
     }
-
-    Timeout--;                     /* decrease timeout */
-  }
-
-  /* manage timeout */
-  if (Timeout == 0)           /* timeout exceeded */
-  {
-    Ticks = 0;                /* reset time */
   }
 
   return Ticks;
@@ -220,7 +264,7 @@ uint8_t DHTxx_WaitRelease(uint8_t Timeout)
 uint8_t DHTxx_GetData(uint8_t *Data)
 {
   uint8_t           Flag = 0;      /* return value */
-  uint8_t           Ticks;         /* time ticks (in 10s) */
+  uint16_t          Ticks;         /* time (in time stamp ticks) */
   uint8_t           Bytes = 0;     /* byte counter */
   uint8_t           Bits = 1;      /* bits counter */
   uint8_t           Byte;          /* data byte */
@@ -240,6 +284,8 @@ uint8_t DHTxx_GetData(uint8_t *Data)
 
     wait20ms();                         /* wait 20ms */
 
+    Timestamp_Start();                  /* start time stamp */
+
     /* and release Data line */
     /* change probe-2 back to input mode */
     ADC_DDR &= ~(1 << TP2);             /* clear bit */
@@ -253,19 +299,19 @@ uint8_t DHTxx_GetData(uint8_t *Data)
      */
 
     /* wait up to 40s for sensor to pull down DATA line */
-    Ticks = DHTxx_WaitPullDown(5);
+    Ticks = DHTxx_WaitLevel(0, TIMESTAMP_TICKS(50));
 
     if (Ticks > 0)                 /* time ok */
     {
       /* wait about 80s for sensor to release DATA line */
-      Ticks = DHTxx_WaitRelease(9);
+      Ticks = DHTxx_WaitLevel(1, TIMESTAMP_TICKS(90));
 
-      if (Ticks >= 6)              /* time ok */
+      if (Ticks >= TIMESTAMP_TICKS(50))   /* time ok */
       {
         /* wait about 80s for sensor to pull down DATA line again */
-        Ticks = DHTxx_WaitPullDown(9);
+        Ticks = DHTxx_WaitLevel(0, TIMESTAMP_TICKS(90));
 
-        if (Ticks >= 6)            /* time ok */
+        if (Ticks >= TIMESTAMP_TICKS(50)) /* time ok */
         {
           Bytes = 5;               /* read 5 data bytes */
         }
@@ -291,20 +337,20 @@ uint8_t DHTxx_GetData(uint8_t *Data)
     while (Bits > 0)               /* 8 bits */
     {
       /* wait about 50s for sensor to release Data line */
-      Ticks = DHTxx_WaitRelease(6);
+      Ticks = DHTxx_WaitLevel(1, TIMESTAMP_TICKS(60));
 
-      if (Ticks >= 4)              /* time ok */
+      if (Ticks >= TIMESTAMP_TICKS(30))   /* time ok */
       {
         /* wait up to 70s for sensor to pull down Data line again */
-        Ticks = DHTxx_WaitPullDown(8);
+        Ticks = DHTxx_WaitLevel(0, TIMESTAMP_TICKS(80));
 
-        if (Ticks >= 6)            /* 70 s -> 1 */
+        if (Ticks >= TIMESTAMP_TICKS(50)) /* 70 s -> 1 */
         {
           /* set bit */
           Byte <<= 1;              /* shift one bit left */
           Byte |= 0b00000001;      /* set bit */
         }
-        else if ((Ticks >= 1) && (Ticks <= 3))    /* 26-28s -> 0 */
+        else if ((Ticks >= 1) && (Ticks < TIMESTAMP_TICKS(40)))  /* 26-28s -> 0 */
         {
           /* clear bit */
           Byte <<= 1;              /* shift one bit left */
@@ -332,17 +378,202 @@ after_loop:
   if ((Bytes == 0) && (Bits == 0))   /* got all bytes */
   {
     /* wait about 50s for sensor to release Data line */
-    Ticks = DHTxx_WaitRelease(6);
+    Ticks = DHTxx_WaitLevel(1, TIMESTAMP_TICKS(60));
 
-    if (Ticks >= 4)                /* time ok */
+    if (Ticks >= TIMESTAMP_TICKS(30))     /* time ok */
     {
       Flag = 1;                    /* signal success */
     }
   }
 
+  Timestamp_Stop();                /* stop time stamp */
+
+  return Flag;
+}
+
+#endif
+
+
+
+#ifdef SW_DHTXX_PCINT
+
+/*
+ *  ISR for pin change of Data line (probe-2)
+ *  - saves time stamp (Timer1) of each edge
+ */
+
+ISR(ISR_PINCHANGE, ISR_BLOCK)
+{
+  uint16_t          Stamp;              /* time stamp */
+  uint8_t           n;                  /* counter */
+
+  /*
+   *  hints:
+   *  - the interrupt flag is cleared automatically
+   *  - all other interrupts are disabled
+   */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_PCINT]++;    /* count ISR call */
+  #endif
+
+  Stamp = TCNT1;                   /* get time stamp */
+
+  n = DHT_Edges;
+  if (n < DHT_MAX_EDGES)           /* prevent buffer overflow */
+  {
+    DHT_Stamps[n] = Stamp;         /* save time stamp */
+    DHT_Edges = n + 1;             /* got another one */
+  }
+}
+
+
+
+/*
+ *  trigger sensor and read measurements
+ *  - captures time stamps of all edges via pin change interrupt
+ *    and decodes the frame afterwards
+ *  - bits are classified by their period (falling edge to falling
+ *    edge), so a delayed time stamp of a rising edge doesn't matter
+ *    and a delayed falling edge affects two periods by the same
+ *    amount in opposite directions
+ *
+ *  requires:
+ *  - Data: pointer to array of 5 bytes
+ *
+ *  returns:
+ *  - 0 on any error
+ *  - 1 on success
+ */
+
+uint8_t DHTxx_GetData(uint8_t *Data)
+{
+  uint8_t           Flag = 0;      /* return value */
+  uint16_t          Ticks;         /* time (in time stamp ticks) */
+  uint8_t           n;             /* edge counter */
+  uint8_t           Bits;          /* bits counter */
+  uint8_t           Byte = 0;      /* data byte */
+
+  /* make sure that Data line is pulled up (by external resistor) */
+  if (! (ADC_PIN & (1 << TP2)))    /* low level of probe-2 */
+  {
+    return Flag;                   /* signal error */
+  }
+
+  /*
+   *  send start signal:
+   *  - pull down Data line for >18ms
+   *  - release Data line again
+   */
+
+  /* pull down Data line */
+  /* change probe-2 to output mode (port pin is low) */
+  ADC_DDR |= (1 << TP2);                /* set bit */
+
+  wait20ms();                           /* wait 20ms */
+
+  DHT_Edges = 0;                        /* reset edge counter */
+  Timestamp_Start();                    /* start time stamp */
+
+  /* enable pin change interrupt for probe-2 */
+  REG_PC_MASK |= (1 << BIT_PC_PIN);     /* enable Data pin */
+  PCIFR = (1 << BIT_PC_FLAG);           /* clear interrupt flag */
+  PCICR |= (1 << BIT_PC_IRQ);           /* enable pin change interrupt */
+
+  /* and release Data line */
+  /* change probe-2 back to input mode */
+  ADC_DDR &= ~(1 << TP2);               /* clear bit */
+
+  /*
+   *  wait for frame
+   *  - response 160s + 40 bits with max. 120s + 50s < 5ms
+   */
+
+  while ((DHT_Edges < DHT_MAX_EDGES) && (TCNT1 < TIMESTAMP_TICKS(6000)))
+  {
+    /* keep waiting */
+  }
+
+  /* disable pin change interrupt */
+  PCICR &= ~(1 << BIT_PC_IRQ);          /* disable pin change interrupt */
+  REG_PC_MASK &= ~(1 << BIT_PC_PIN);    /* disable Data pin */
+
+  Timestamp_Stop();                     /* stop time stamp */
+
+  if (DHT_Edges < DHT_MAX_EDGES)        /* missing edges */
+  {
+    return Flag;                        /* signal error */
+  }
+
+
+  /*
+   *  check response:
+   *  - sensor pulls down Data line for 80s (edge #0 to #1)
+   *  - releases Data line for 80s (edge #1 to #2)
+   */
+
+  Ticks = DHT_Stamps[1] - DHT_Stamps[0];
+  if ((Ticks < TIMESTAMP_TICKS(50)) || (Ticks > TIMESTAMP_TICKS(110)))
+  {
+    return Flag;                        /* signal error */
+  }
+
+  Ticks = DHT_Stamps[2] - DHT_Stamps[1];
+  if ((Ticks < TIMESTAMP_TICKS(50)) || (Ticks > TIMESTAMP_TICKS(110)))
+  {
+    return Flag;                        /* signal error */
+  }
+
+
+  /*
+   *  decode 5 bytes (40 bits) data:
+   *  - each bit starts with pull-down of Data line for 50s
+   *  - 0 is indicated by release of Data for 26-28s (period 77s)
+   *  - 1 is indicated by release of Data for 70s (period 120s)
+   *  - bit order: MSB
+   */
+
+  n = 2;                           /* falling edge of first bit */
+  Bits = 0;
+
+  while (Bits < 40)                /* 40 bits */
+  {
+    /* period from falling edge to next falling edge */
+    Ticks = DHT_Stamps[n + 2] - DHT_Stamps[n];
+
+    if ((Ticks < TIMESTAMP_TICKS(55)) || (Ticks > TIMESTAMP_TICKS(150)))
+    {
+      return Flag;                 /* timing issue */
+    }
+
+    Byte <<= 1;                    /* shift one bit left */
+    if (Ticks >= TIMESTAMP_TICKS(98))   /* 120s -> 1 */
+    {
+      Byte |= 0b00000001;          /* set bit */
+    }
+
+    Bits++;                        /* next bit */
+    n += 2;                        /* next falling edge */
+
+    if ((Bits % 8) == 0)           /* got a full byte */
+    {
+      *Data = Byte;                /* save byte to data buffer */
+      Data++;                      /* next byte of data buffer */
+    }
+  }
+
+  /* sensor releases Data line after 50s (edge #82 to #83) */
+  Ticks = DHT_Stamps[83] - DHT_Stamps[82];
+  if (Ticks >= TIMESTAMP_TICKS(30))     /* time ok */
+  {
+    Flag = 1;                      /* signal success */
+  }
+
   return Flag;
 }
 
+#endif
+
 
 
 /* ************************************************************************
@@ -590,6 +821,14 @@ uint8_t DHTxx_Tool(void)
     return 0;                 /* exit tool and signal error */
   }
 
+  #ifdef SW_DHTXX_PCINT
+  /* buffer for edge capture */
+  if (Scratch_Acquire(SCRATCH_DHTXX) == NULL)
+  {
+    return 0;                 /* exit tool and signal error */
+  }
+  #endif
+
   DHTxx_DisplaySensor(Sensor, Mode);    /* update display */
   LCD_ClearLine2();                     /* clear line #2 */
   MilliSleep(1000);                     /* power-up delay for sensor */
@@ -693,6 +932,10 @@ uint8_t DHTxx_Tool(void)
     }
   }
 
+  #ifdef SW_DHTXX_PCINT
+  Scratch_Release(SCRATCH_DHTXX);       /* free buffer */
+  #endif
+
   return 1;                   /* signal success */
 }
 
@@ -704,6 +947,15 @@ uint8_t DHTxx_Tool(void)
 
 
 /* local constants */
+#ifdef SW_DHTXX_PCINT
+  #undef DHT_Stamps
+  #undef DHT_PCINT_PIN
+  #undef BIT_PC_PIN
+  #undef BIT_PC_IRQ
+  #undef BIT_PC_FLAG
+  #undef REG_PC_MASK
+  #undef ISR_PINCHANGE
+#endif
 #undef DHT_11
 #undef DHT_22
 #undef MODE_MANUAL
@@ -18,9 +18,11 @@
  *    DB6    LCD_DB6 (default: LCD_PORT pin #2)
  *    DB7    LCD_DB7 (default: LCD_PORT pin #3)
  *    RS     LCD_RS
- *    R/W    Gnd
+ *    R/W    Gnd or LCD_RW (optional)
  *    E      LCD_EN1
- *  - write only since R/W is hardwired to Gnd
+ *  - write only when R/W is hardwired to Gnd
+ *  - with LCD_RW and LCD_PIN the busy flag is polled instead of
+ *    waiting the worst-case processing time
  *  - max. clock for parallel interface: 2 MHz
  *  - pin assignment for PCF8574 backpack
  *    DB4    LCD_DB4 (default: P4)
@@ -111,9 +113,68 @@ void LCD_BusSetup(void)
 
   LCD_DDR |= (1 << LCD_RS) | (1 << LCD_EN1) | (1 << LCD_DB4) | (1 << LCD_DB5) | (1 << LCD_DB6) | (1 << LCD_DB7);
 
+  #ifdef LCD_RW
+  /* optional R/W line */
+  LCD_DDR |= (1 << LCD_RW);
+  #endif
+
   /* LCD_EN1 should be low by default */
+  /* LCD_RW should be low by default (write mode) */
+}
+
+
+
+#ifdef LCD_BUSY_FLAG
+
+/*
+ *  wait until LCD isn't busy anymore
+ *  - reads busy flag (DB7) in 4 bit mode
+ *  - keeps state of RS
+ *  - timeout after about 5ms
+ */
+
+void LCD_WaitBusy(void)
+{
+  uint8_t           RS;            /* state of RS */
+  uint8_t           Busy;          /* busy flag */
+  uint16_t          Timeout = 1000;     /* timeout counter */
+
+  /* save state of RS */
+  RS = LCD_PORT & (1 << LCD_RS);
+
+  /* data lines: input mode without pull-up resistors */
+  LCD_DDR &= ~((1 << LCD_DB4) | (1 << LCD_DB5) | (1 << LCD_DB6) | (1 << LCD_DB7));
+  LCD_PORT &= ~((1 << LCD_DB4) | (1 << LCD_DB5) | (1 << LCD_DB6) | (1 << LCD_DB7) | (1 << LCD_RS));
+
+  /* read mode for busy flag and address counter: RS low, R/W high */
+  LCD_PORT |= (1 << LCD_RW);       /* set R/W high */
+
+  do
+  {
+    /* upper nibble: busy flag and bits 6-4 of address counter */
+    LCD_PORT |= (1 << LCD_EN1);    /* set EN1 high */
+    wait1us();                     /* data delay time */
+    Busy = LCD_PIN & (1 << LCD_DB7);    /* read busy flag */
+    LCD_PORT &= ~(1 << LCD_EN1);   /* set EN1 low */
+    wait1us();                     /* enable cycle time */
+
+    /* lower nibble: bits 3-0 of address counter (ignored) */
+    LCD_PORT |= (1 << LCD_EN1);    /* set EN1 high */
+    wait1us();                     /* data delay time */
+    LCD_PORT &= ~(1 << LCD_EN1);   /* set EN1 low */
+    wait1us();                     /* enable cycle time */
+
+    Timeout--;                     /* decrease timeout */
+  } while (Busy && Timeout);
+
+  /* back to write mode */
+  LCD_PORT &= ~(1 << LCD_RW);      /* set R/W low */
+  LCD_PORT |= RS;                  /* restore RS */
+  LCD_DDR |= (1 << LCD_DB4) | (1 << LCD_DB5) | (1 << LCD_DB6) | (1 << LCD_DB7);
 }
 
+#endif
+
 
 
 /*
@@ -168,6 +229,11 @@ void LCD_SendByte(uint8_t Byte)
 {
   uint8_t           Nibble;
 
+  #ifdef LCD_BUSY_FLAG
+  /* wait for the LCD to finish the last command or data */
+  LCD_WaitBusy();
+  #endif
+
   /* send upper nibble (bits 4-7) */
   Nibble = (Byte >> 4) & 0x0F;          /* get upper nibble */
   LCD_SendNibble(Nibble);
@@ -176,7 +242,9 @@ void LCD_SendByte(uint8_t Byte)
   Nibble = Byte & 0x0F;                 /* get lower nibble */
   LCD_SendNibble(Nibble);
 
+  #ifndef LCD_BUSY_FLAG
   wait50us();            /* LCD needs some time for processing */
+  #endif
 
   /* clear data lines on port */  
   Nibble = ~((1 << LCD_DB4) | (1 << LCD_DB5) | (1 << LCD_DB6) | (1 << LCD_DB7));
@@ -692,10 +760,15 @@ void LCD_DisplaySetup(void)
 void LCD_Clear(void)
 {
   LCD_Cmd(CMD_CLEAR_DISPLAY);      /* send clear command */
+
+  #ifdef LCD_BUSY_FLAG
+  /* next command or data will wait for the LCD (busy flag) */
+  #else
   MilliSleep(2);                   /* LCD needs some time for processing */
 
   /* If the first characters in the first line are missing your display
      has a slow controller. Increase the delay to 3-5 ms. */
+  #endif
 
   /* reset character position */
   UI.CharPos_X = 1;
@@ -22,6 +22,7 @@
  *    I2C_FAST_MODE      400kHz
  *  - Don't forget the pull up resistors for SDA and SCL!
  *    Usually 2-10kOhms for 5V.
+ *  - I2C_TWI_IRQ: interrupt driven job queue for hardware TWI
  */
 
 
@@ -263,6 +264,10 @@ uint8_t I2C_WriteByte(uint8_t Type)
 
   Byte = I2C.Byte;            /* get byte */
 
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_BUS]++;      /* count byte */
+  #endif
+
   /* bit-bang 8 bits */
   while (n > 0)               /* 8 bits */
   {
@@ -713,6 +718,250 @@ void I2C_Stop(void)
 
 #ifdef I2C_HARDWARE
 
+
+#ifdef I2C_TWI_IRQ
+
+/*
+ *  local constants
+ */
+
+#define I2C_QUEUE_SIZE        4    /* number of jobs */
+
+
+/*
+ *  local variables
+ */
+
+/* job queue */
+I2C_Job_Type        I2C_Jobs[I2C_QUEUE_SIZE];     /* jobs */
+uint8_t             I2C_JobHead;        /* next free slot */
+volatile uint8_t    I2C_JobTail;        /* job being processed */
+volatile uint8_t    I2C_JobCount;       /* number of queued jobs */
+volatile uint8_t    I2C_JobPos;         /* byte position in job's buffer */
+
+
+
+/*
+ *  queue I2C job (transaction)
+ *  - waits for a free slot if the queue is full
+ *  - jobs are processed in the background by the TWI interrupt
+ *  - the data buffer must stay valid (and unchanged for writes) until
+ *    the job is done, i.e. the callback is run or I2C_Busy() returns 0
+ *  - requires global interrupts to be enabled
+ *
+ *  requires:
+ *  - Address: 7 bit slave address
+ *  - Data: pointer to data buffer
+ *  - Size: number of bytes to write/read (read: min. 1)
+ *  - Mode:
+ *    I2C_JOB_WRITE   write data to slave
+ *    I2C_JOB_READ    read data from slave
+ *    I2C_JOB_NOSTOP  next job follows with a repeated start
+ *                    (e.g. write register address and read data)
+ *  - Callback: pointer to function run after job is done (or NULL)
+ *    gets I2C_OK on success or I2C_ERROR on any error
+ *    hint: the function is run in interrupt context and mustn't
+ *          queue new jobs
+ */
+
+void I2C_Queue(uint8_t Address, uint8_t *Data, uint8_t Size, uint8_t Mode, void (*Callback)(uint8_t))
+{
+  I2C_Job_Type      *Job;               /* pointer to job */
+  uint8_t           Old_SREG;           /* status register */
+
+  /* wait for a free slot */
+  while (I2C_JobCount >= I2C_QUEUE_SIZE)
+  {
+    wdt_reset();              /* reset watchdog */
+  }
+
+  /* set up job */
+  Job = &I2C_Jobs[I2C_JobHead];
+  Job->Address = Address;
+  Job->Data = Data;
+  Job->Size = Size;
+  Job->Mode = Mode;
+  Job->Callback = Callback;
+
+  /* next free slot */
+  I2C_JobHead++;
+  if (I2C_JobHead >= I2C_QUEUE_SIZE) I2C_JobHead = 0;
+
+  Old_SREG = SREG;            /* save status register */
+  cli();                      /* disable interrupts */
+
+  I2C_JobCount++;             /* one more job */
+
+  if (I2C_JobCount == 1)      /* queue was idle */
+  {
+    /* wait for any pending stop condition */
+    while (TWCR & (1 << TWSTO));
+
+    /* start condition with TWI interrupt enabled */
+    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTA) | (1 << TWIE);
+  }
+
+  SREG = Old_SREG;            /* restore status register */
+}
+
+
+
+/*
+ *  check for queued jobs
+ *
+ *  returns:
+ *  - number of jobs pending
+ */
+
+uint8_t I2C_Busy(void)
+{
+  return I2C_JobCount;
+}
+
+
+
+/*
+ *  wait until all queued jobs are done
+ */
+
+void I2C_Flush(void)
+{
+  /* wait for queue to become empty */
+  while (I2C_JobCount)
+  {
+    wdt_reset();              /* reset watchdog */
+  }
+
+  /* wait for final stop condition */
+  while (TWCR & (1 << TWSTO));
+}
+
+
+
+/*
+ *  ISR for TWI
+ *  - processes current job of queue
+ *  - starts next job when current job is done
+ */
+
+ISR(TWI_vect, ISR_BLOCK)
+{
+  I2C_Job_Type      *Job;               /* pointer to job */
+  uint8_t           Status;             /* TWI status */
+  uint8_t           Ctrl;               /* control bits */
+  uint8_t           Pos;                /* byte position */
+  uint8_t           Done = 0;           /* job done flag */
+  uint8_t           Result = I2C_ERROR; /* job result */
+
+  /*
+   *  hints:
+   *  - the interrupt is triggered by TWINT
+   *  - TWINT has to be cleared by writing a 1
+   *  - all other interrupts are disabled
+   */
+
+  Job = &I2C_Jobs[I2C_JobTail];         /* current job */
+  Pos = I2C_JobPos;                     /* current byte position */
+
+  /* get status and filter status bits */
+  Status = TWSR & ((1 << TWS7) | (1 << TWS6) | (1 << TWS5) | (1 << TWS4) | (1 << TWS3));
+
+  /* default: continue with interrupt enabled */
+  Ctrl = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+
+  switch (Status)
+  {
+    case 0x08:                /* start */
+    case 0x10:                /* repeated start */
+      Pos = 0;                          /* reset position */
+      Status = Job->Address << 1;       /* 7 bit address & write */
+      if (Job->Mode & I2C_JOB_READ)     /* read */
+      {
+        Status |= 0b00000001;           /* set read bit */
+      }
+      TWDR = Status;                    /* send address */
+      break;
+
+    case 0x18:                /* SLA+W & ACK */
+    case 0x28:                /* data & ACK */
+      if (Pos < Job->Size)              /* more data */
+      {
+        TWDR = Job->Data[Pos];          /* send next byte */
+        Pos++;                          /* next byte */
+      }
+      else                              /* all data sent */
+      {
+        Result = I2C_OK;
+        Done = 1;
+      }
+      break;
+
+    case 0x50:                /* data read & ACK */
+      Job->Data[Pos] = TWDR;            /* save byte */
+      Pos++;                            /* next byte */
+      /* fall through */
+
+    case 0x40:                /* SLA+R & ACK */
+      if ((Pos + 1) < Job->Size)        /* more bytes to follow */
+      {
+        Ctrl |= (1 << TWEA);            /* respond with ACK */
+      }
+      /* else: respond to last byte with NACK */
+      break;
+
+    case 0x58:                /* data read & NACK (last byte) */
+      Job->Data[Pos] = TWDR;            /* save byte */
+      Pos++;                            /* next byte */
+      Result = I2C_OK;
+      Done = 1;
+      break;
+
+    default:                  /* NACK, arbitration lost or bus error */
+      Done = 1;                         /* keep default "bus error" */
+      break;
+  }
+
+  I2C_JobPos = Pos;                     /* save position */
+
+  if (Done)                   /* job done */
+  {
+    if (Job->Callback)                  /* callback set */
+    {
+      Job->Callback(Result);            /* run callback */
+    }
+
+    /* next job */
+    Status = I2C_JobTail + 1;
+    if (Status >= I2C_QUEUE_SIZE) Status = 0;
+    I2C_JobTail = Status;
+    I2C_JobCount--;
+
+    if (I2C_JobCount)                   /* more jobs */
+    {
+      if ((Result == I2C_OK) && (Job->Mode & I2C_JOB_NOSTOP))
+      {
+        Ctrl |= (1 << TWSTA);           /* repeated start */
+      }
+      else
+      {
+        /* stop followed by start */
+        Ctrl |= (1 << TWSTO) | (1 << TWSTA);
+      }
+    }
+    else                                /* queue empty */
+    {
+      /* stop condition and disable interrupt */
+      Ctrl = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO);
+    }
+  }
+
+  TWCR = Ctrl;                /* proceed */
+}
+
+#endif
+
+
+
 /*
  *  set up TWI
  *
@@ -766,6 +1015,14 @@ uint8_t I2C_Start(uint8_t Type)
   uint8_t           Flag = I2C_ERROR;   /* return value */
   uint8_t           Bits;               /* bits */
 
+  #ifdef I2C_TWI_IRQ
+  /* don't interfere with queued jobs */
+  if (Type == I2C_START)      /* new communication */
+  {
+    I2C_Flush();              /* wait until all jobs are done */
+  }
+  #endif
+
   /*
    *  MCU's state maschine for TWI:
    *  - Start for new communication
@@ -845,6 +1102,10 @@ uint8_t I2C_WriteByte(uint8_t Type)
 
   Bits = I2C.Byte;            /* get byte */
 
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_BUS]++;      /* count byte */
+  #endif
+
   /* set status register bits */
   if (Type == I2C_DATA)            /* data byte */
   {
@@ -998,10 +1259,253 @@ void I2C_Stop(void)
 
 
 
+/* ************************************************************************
+ *   tools
+ * ************************************************************************ */
+
+
+#ifdef SW_I2C_SCAN
+
+/*
+ *  local constants
+ */
+
+#define I2C_TEST_RUNS        16    /* test transactions per bus speed */
+
+
+
+/*
+ *  probe slave address
+ *  - address slave (write) and end transfer
+ *
+ *  requires:
+ *  - Address: 7 bit slave address
+ *
+ *  returns:
+ *  - 1 if slave responds with ACK
+ *  - 0 on NACK or bus error
+ */
+
+uint8_t I2C_Probe(uint8_t Address)
+{
+  uint8_t           Flag = 0;      /* return value */
+
+  if (I2C_Start(I2C_START) == I2C_OK)             /* start */
+  {
+    I2C.Byte = Address << 1;            /* address (7 bit & write) */
+
+    if (I2C_WriteByte(I2C_ADDRESS) == I2C_ACK)    /* address slave */
+    {
+      Flag = 1;                         /* got ACK */
+    }
+  }
+
+  I2C_Stop();                           /* stop */
+
+  return Flag;
+}
+
+
+
+/*
+ *  run test transactions with current bus speed
+ *  - measures time of transactions with s time stamp (Timer1)
+ *
+ *  requires:
+ *  - Address: 7 bit slave address
+ *  - Time: pointer to time per transaction (in s)
+ *
+ *  returns:
+ *  - 1 if all transactions were ACKed
+ *  - 0 on any error
+ */
+
+uint8_t I2C_Test(uint8_t Address, uint16_t *Time)
+{
+  uint8_t           Flag = 1;      /* return value */
+  uint8_t           n;             /* counter */
+  uint32_t          Value;         /* time */
+
+  #ifdef I2C_TWI_IRQ
+  I2C_Flush();                     /* finish queued jobs */
+  #endif
+
+  Timestamp_Start();               /* start time stamp */
+
+  n = I2C_TEST_RUNS;
+  while (n > 0)
+  {
+    if (I2C_Probe(Address) == 0)   /* no ACK */
+    {
+      Flag = 0;                    /* signal error */
+    }
+
+    n--;                           /* next run */
+  }
+
+  Value = TCNT1;                   /* get time stamp */
+  Timestamp_Stop();                /* stop time stamp */
+
+  /* convert ticks into s per transaction */
+  Value *= TIMESTAMP_PRESCALER;              /* MCU cycles */
+  Value /= MCU_CYCLES_PER_US * I2C_TEST_RUNS;
+  *Time = (uint16_t)Value;
+
+  return Flag;
+}
+
+
+
+/*
+ *  I2C bus scanner
+ *  - probes all 7 bit addresses (0x08-0x77, excluding reserved ones)
+ *  - lists responding slaves
+ *  - hardware TWI: tests bus speeds from 50 to 800kHz and displays
+ *    the fastest one with all test transactions ACKed
+ *  - displays time per test transaction (address write & stop)
+ */
+
+void I2C_Scan_Tool(void)
+{
+  uint8_t           Test;          /* key / feedback */
+  uint8_t           Address;       /* slave address */
+  uint8_t           Count;         /* number of slaves found */
+  uint16_t          Time;          /* time per transaction */
+  #ifdef I2C_HARDWARE
+  uint16_t          Rate;          /* bus speed (in kHz) */
+  uint16_t          Best_Rate;     /* fastest stable bus speed */
+  uint16_t          Best_Time;     /* time for fastest bus speed */
+  uint32_t          Value;         /* temp. value */
+  #endif
+
+  /* display tool name and start hint */
+  LCD_Clear();
+  Display_EEString(I2C_Scan_str);       /* display: I2C Scan */
+  LCD_CharPos(1, 2);                    /* move to line #2 */
+  Display_EEString(Start_str);          /* display: Start */
+
+
+  /*
+   *  processing loop
+   */
+
+  while (1)
+  {
+    /* wait for user input */
+    Test = TestKey(0, CURSOR_BLINK | CHECK_KEY_TWICE | CHECK_BAT);
+
+    if (Test == KEY_TWICE)         /* two short key presses */
+    {
+      break;                       /* end loop */
+    }
+
+    /* new scan: keep tool name */
+    LCD_Clear();
+    Display_EEString(I2C_Scan_str);     /* display: I2C Scan */
+    UI.LineMode = LINE_KEY | LINE_KEEP; /* next-line mode: wait, keep first line */
+
+    Count = 0;
+    Address = 0x08;                /* skip reserved addresses */
+
+    while (Address <= 0x77)        /* up to last regular address */
+    {
+      wdt_reset();                 /* reset watchdog */
+
+      if (I2C_Probe(Address))      /* slave responds */
+      {
+        Count++;                   /* got another one */
+        Display_NextLine();        /* move to next line */
+        Display_HexByte(Address);  /* display address */
+
+        #ifdef I2C_HARDWARE
+        /*
+         *  test bus speeds
+         *  - SCL clock = MCU clock / (16 + 2*TWBR * prescaler)
+         *  - prescaler is 1 (set by I2C_Setup())
+         */
+
+        Best_Rate = 0;
+        Best_Time = 0;
+        Rate = 50;                 /* start with 50kHz */
+
+        while (Rate <= 800)        /* up to 800kHz */
+        {
+          Value = CPU_FREQ / 1000;      /* MCU clock in kHz */
+          Value /= Rate;                /* 16 + 2*TWBR */
+
+          if ((Value > 16) && (Value <= (16 + 2 * 255)))  /* valid TWBR */
+          {
+            Value -= 16;
+            Value /= 2;
+            TWBR = (uint8_t)Value;      /* set bus speed */
+
+            if (I2C_Test(Address, &Time))    /* stable */
+            {
+              Best_Rate = Rate;         /* save speed */
+              Best_Time = Time;         /* and time */
+            }
+          }
+
+          Rate *= 2;               /* next bus speed */
+        }
+
+        I2C_Setup();               /* restore default bus speed */
+
+        /* display fastest stable bus speed and time */
+        Display_Space();
+        if (Best_Rate)             /* got one */
+        {
+          Display_Value(Best_Rate, 3, 0);    /* display bus speed */
+          Display_EEString_Space(Hertz_str); /* display: Hz */
+          Display_Value(Best_Time, -6, 's'); /* display time */
+        }
+        else                       /* no stable speed */
+        {
+          Display_Minus();         /* display: - */
+        }
+        #else
+        /* bit-bang I2C: display time for fixed bus speed */
+        Display_Space();
+        if (I2C_Test(Address, &Time))   /* stable */
+        {
+          Display_Value(Time, -6, 's');      /* display time */
+        }
+        else
+        {
+          Display_Minus();         /* display: - */
+        }
+        #endif
+      }
+
+      Address++;                   /* next address */
+    }
+
+    UI.LineMode = LINE_STD | LINE_KEEP;      /* next-line mode: keep first line */
+
+    if (Count == 0)                /* no slaves found */
+    {
+      Display_NextLine();          /* move to next line */
+      Display_Minus();             /* display: - */
+    }
+  }
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   clean-up of local constants
  * ************************************************************************ */
 
+/* local constants */
+#ifdef I2C_TWI_IRQ
+  #undef I2C_QUEUE_SIZE
+#endif
+#ifdef SW_I2C_SCAN
+  #undef I2C_TEST_RUNS
+#endif
+
 /* source management */
 #undef I2C_C
 
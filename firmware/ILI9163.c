@@ -137,6 +137,12 @@ uint16_t            Y_End;         /* end position Y (row) */
 /* text line management */
 uint16_t            LineFlags;     /* bitfield for up to 16 lines */
 
+#ifdef FONT_CACHE
+/* font cache */
+uint8_t             FontCache[FONT_CACHE_CHARS][FONT_BYTES_N];   /* glyph bitmaps */
+uint8_t             FontCacheID[FONT_CACHE_CHARS];     /* font index of glyphs */
+#endif
+
 
 
 /* ************************************************************************
@@ -272,7 +278,7 @@ void LCD_Data(uint8_t Data)
 
 void LCD_Data2(uint16_t Data)
 {
-  uint8_t           Byte;     /* data byte */
+  uint8_t           Bytes[2]; /* data bytes */
 
   /* indicate data mode */
   LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
@@ -282,11 +288,42 @@ void LCD_Data2(uint16_t Data)
     LCD_PORT &= ~(1 << LCD_CS);    /* set /CSX low */
   #endif
 
-  Byte = (uint8_t)Data;            /* save LSB */
-  Data >>= 8;                      /* get MSB */
+  Bytes[0] = (uint8_t)(Data >> 8);     /* MSB */
+  Bytes[1] = (uint8_t)Data;            /* LSB */
+  SPI_Write_Block(&Bytes[0], 2);       /* send data */
+
+  /* deselect chip, if pin available */
+  #ifdef LCD_CS
+    LCD_PORT |= (1 << LCD_CS);     /* set /CSX high */
+  #endif
+}
+
 
-  SPI_Write_Byte((uint8_t)Data);   /* write MSB of data */
-  SPI_Write_Byte(Byte);            /* write LSB of data */
+
+/*
+ *  send a 2-byte value repeatedly to the LCD
+ *  - selects chip and data mode just once for all repetitions
+ *
+ *  requires:
+ *  - Data: 2-byte value to send
+ *  - Count: number of repetitions
+ */
+
+void LCD_Data2_Run(uint16_t Data, uint16_t Count)
+{
+  uint8_t           Bytes[2]; /* data bytes */
+
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
+
+  /* select chip, if pin available */
+  #ifdef LCD_CS
+    LCD_PORT &= ~(1 << LCD_CS);    /* set /CSX low */
+  #endif
+
+  Bytes[0] = (uint8_t)(Data >> 8);     /* MSB */
+  Bytes[1] = (uint8_t)Data;            /* LSB */
+  SPI_Write_Repeat(&Bytes[0], 2, Count);    /* send data */
 
   /* deselect chip, if pin available */
   #ifdef LCD_CS
@@ -444,13 +481,8 @@ void LCD_ClearLine(uint8_t Line)
     x -= LCD_OFFSET_X;             /* additional X offset */
     #endif
 
-    while (x < LCD_PIXELS_X)       /* all columns */
-    {
-      /* send background color */
-      LCD_Data2(COLOR_BACKGROUND);
-
-      x++;                         /* next column */
-    }
+    /* send background color for all columns */
+    LCD_Data2_Run(COLOR_BACKGROUND, LCD_PIXELS_X - x);
 
     y--;                           /* next page */
   }
@@ -480,6 +512,75 @@ void LCD_Clear(void)
 
 
 
+#ifdef FONT_CACHE
+
+/*
+ *  load glyphs of digits, prefixes and units into font cache
+ *  - helper function for LCD_Init()
+ *  - glyphs are stored uncompressed
+ */
+
+void LCD_FontCache(void)
+{
+  uint8_t           *Table;        /* pointer to table */
+  uint8_t           *Cache;        /* pointer to cache */
+  uint8_t           Slot = 0;      /* cache slot */
+  uint8_t           Index;         /* font index */
+  #ifdef FONT_RLE
+  uint8_t           y;             /* bitmap y byte counter */
+  uint8_t           n;             /* byte counter */
+  #endif
+
+  while (Slot < FONT_CACHE_CHARS)
+  {
+    /* get font index number of character */
+    Index = DATA_read_byte(&FontCache_table[Slot]);    /* get character */
+    Table = (uint8_t *)&FontTable;      /* start address */
+    Table += Index;                     /* add offset for character */
+    Index = pgm_read_byte(Table);       /* get index number */
+    FontCacheID[Slot] = Index;          /* 0xff for no bitmap */
+    Cache = &FontCache[Slot][0];        /* address of cache slot */
+
+    if (Index != 0xff)                  /* character bitmap available */
+    {
+      Table = (uint8_t *)&FontData;     /* start address of font data */
+
+      #ifdef FONT_RLE
+      Table += pgm_read_word(&FontIndex[Index]);   /* address of character */
+      Bitmap_Start(Table, Cache, FONT_BYTES_X);    /* start decoder */
+      y = FONT_BYTES_Y;
+      while (y > 0)
+      {
+        Bitmap_Row(Cache, FONT_BYTES_X);      /* decode row */
+        y--;                                  /* next row */
+
+        if (y > 0)                     /* not last row */
+        {
+          /* copy row as base for next row */
+          n = 0;
+          while (n < FONT_BYTES_X)
+          {
+            Cache[FONT_BYTES_X + n] = Cache[n];
+            n++;
+          }
+        }
+
+        Cache += FONT_BYTES_X;         /* next row */
+      }
+      #else
+      Table += FONT_BYTES_N * Index;    /* address of character */
+      memcpy_P(Cache, Table, FONT_BYTES_N);     /* copy bitmap */
+      #endif
+    }
+
+    Slot++;                             /* next slot */
+  }
+}
+
+#endif
+
+
+
 /*
  *  initialize LCD
  */
@@ -550,6 +651,10 @@ void LCD_Init(void)
   UI.SymbolSize_Y = LCD_SYMBOL_CHAR_Y;  /* y size in chars */
   #endif
 
+  #ifdef FONT_CACHE
+  LCD_FontCache();                 /* load font cache */
+  #endif
+
   LineFlags = 0xffff;              /* clear all lines by default */
   LCD_Clear();                     /* clear display */
   #ifdef LCD_LATE_ON
@@ -560,6 +665,28 @@ void LCD_Init(void)
 
 
 
+/*
+ *  send a run of pixels in pen or background color
+ *  - helper function for LCD_Char() and LCD_Symbol()
+ *
+ *  requires:
+ *  - Color: pen color (RGB565)
+ *  - Level: 0 for background color, 1 for pen color
+ *  - Count: number of pixels
+ */
+
+void LCD_PixelRun(uint16_t Color, uint8_t Level, uint16_t Count)
+{
+  if (Level == 0)                  /* background */
+  {
+    Color = COLOR_BACKGROUND;      /* use background color */
+  }
+
+  LCD_Data2_Run(Color, Count);     /* send pixels */
+}
+
+
+
 /*
  *  display a single character
  *
@@ -577,6 +704,14 @@ void LCD_Char(unsigned char Char)
   uint8_t           y = 1;         /* bitmap y byte counter */
   uint8_t           Bits;          /* number of bits to be sent */
   uint8_t           n;             /* bitmap bit counter */
+  uint8_t           Level = 0;     /* pixel level of current run */
+  uint16_t          Run = 0;       /* number of pixels in current run */
+  #ifdef FONT_RLE
+  uint8_t           RowBuffer[FONT_BYTES_X];     /* decoded row */
+  #endif
+  #ifdef FONT_CACHE
+  uint8_t           Cached = 0;    /* glyph in font cache */
+  #endif
 
   /* prevent x overflow */
   if (UI.CharPos_X > LCD_CHAR_X) return;
@@ -587,10 +722,38 @@ void LCD_Char(unsigned char Char)
   Index = pgm_read_byte(Table);         /* get index number */
   if (Index == 0xff) return;            /* no character bitmap available */
 
+  #ifdef FONT_CACHE
+  /* check font cache */
+  n = 0;
+  while (n < FONT_CACHE_CHARS)
+  {
+    if (FontCacheID[n] == Index)       /* glyph cached */
+    {
+      Table = &FontCache[n][0];        /* read bitmap from RAM */
+      Cached = 1;
+      break;
+    }
+    n++;                               /* next slot */
+  }
+
+  if (Cached == 0)                     /* not cached */
+  {
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&FontData;        /* start address of font data */
+  #ifdef FONT_RLE
+  Offset = pgm_read_word(&FontIndex[Index]);  /* offset for character */
+  Table += Offset;                     /* address of character data */
+  Bitmap_Start(Table, RowBuffer, FONT_BYTES_X);     /* start decoder */
+  #else
   Offset = FONT_BYTES_N * Index;       /* offset for character */
   Table += Offset;                     /* address of character data */
+  #endif
+
+  #ifdef FONT_CACHE
+  }
+  #endif
 
   /* LCD's address window */
   LCD_CharPos(UI.CharPos_X, UI.CharPos_Y);   /* update character position */
@@ -612,6 +775,15 @@ void LCD_Char(unsigned char Char)
   /* read character bitmap and send it to display */
   while (y <= FONT_BYTES_Y)
   {
+    #ifdef FONT_RLE
+    #ifdef FONT_CACHE
+    if (Cached == 0)                    /* compressed bitmap */
+    #endif
+    {
+      Bitmap_Row(RowBuffer, FONT_BYTES_X);   /* decode next row */
+      Table = RowBuffer;                /* read row from buffer */
+    }
+    #endif
     Pixels = FONT_SIZE_X;               /* track x bits to be sent */
     x = 1;                              /* reset counter */
 
@@ -629,21 +801,28 @@ void LCD_Char(unsigned char Char)
       }
       Pixels -= Bits;              /* update counter */
 
+      #if defined (FONT_RLE)
+      Index = *Table;                   /* read byte from buffer */
+      #elif defined (FONT_CACHE)
+      if (Cached) Index = *Table;       /* read byte from cache */
+      else Index = pgm_read_byte(Table);     /* read byte */
+      #else
       Index = pgm_read_byte(Table);     /* read byte */
+      #endif
 
       /* send color for each bit */
       n = Bits;
       while (n > 0)
       {
-        if (Index & 0b00000001)         /* bit set */
+        if ((Index & 0b00000001) != Level)   /* pixel level changes */
         {
-          LCD_Data2(Offset);            /* foreground color */
-        }
-        else                            /* bit unset */
-        {
-          LCD_Data2(COLOR_BACKGROUND);  /* background color */
+          LCD_PixelRun(Offset, Level, Run);   /* send pending run */
+          Level ^= 1;                         /* toggle level */
+          Run = 0;                            /* reset counter */
         }
 
+        Run++;                                /* one more pixel */
+
         Index >>= 1;                      /* shift byte for next bit */
         n--;                              /* next bit */
       }
@@ -655,6 +834,9 @@ void LCD_Char(unsigned char Char)
     y++;                                /* next row */
   }
 
+  /* send last run of pixels */
+  LCD_PixelRun(Offset, Level, Run);
+
   UI.CharPos_X++;             /* update character position */
 }
 
@@ -710,12 +892,23 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           y = 1;         /* bitmap y counter (rows) */
   uint8_t           Bits;          /* number of bits to be sent */
   uint8_t           n;             /* bitmap bit counter */
+  uint8_t           Level = 0;     /* pixel level of current run */
+  uint16_t          Run = 0;       /* number of pixels in current run */
   uint8_t           Factor = SYMBOL_RESIZE;  /* resize factor */
+  #ifdef SYMBOLS_RLE
+  uint8_t           RowBuffer[SYMBOL_BYTES_X];   /* decoded row */
+  #endif
 
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
+  #ifdef SYMBOLS_RLE
+  Offset = pgm_read_word(&SymbolIndex[ID]);  /* offset for symbol */
+  Table += Offset;                      /* address of symbol data */
+  Bitmap_Start(Table, RowBuffer, SYMBOL_BYTES_X);   /* start decoder */
+  #else
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
   Table += Offset;                      /* address of symbol data */
+  #endif
 
   /* LCD's address window */
   LCD_CharPos(UI.CharPos_X, UI.CharPos_Y);   /* update character position */
@@ -737,6 +930,10 @@ void LCD_Symbol(uint8_t ID)
   /* read character bitmap and send it to display */
   while (y <= SYMBOL_BYTES_Y)
   {
+    #ifdef SYMBOLS_RLE
+    Bitmap_Row(RowBuffer, SYMBOL_BYTES_X);   /* decode next row */
+    Table = RowBuffer;        /* read row from buffer */
+    #endif
     Table2 = Table;           /* save current pointer */
 
     while (Factor > 0)        /* resize symbol (rows) */
@@ -760,7 +957,11 @@ void LCD_Symbol(uint8_t ID)
         }
         Pixels -= Bits;            /* update counter */
 
+        #ifdef SYMBOLS_RLE
+        Data = *Table;                  /* read byte from buffer */
+        #else
         Data = pgm_read_byte(Table);    /* read byte */
+        #endif
 
         /* send color for each bit */
         n = Bits;                       /* reset counter */
@@ -768,15 +969,15 @@ void LCD_Symbol(uint8_t ID)
 
         while (n > 0)                   /* x pixels */
         {
-          if (Data & 0b00000001)             /* bit set */
+          if ((Data & 0b00000001) != Level)   /* pixel level changes */
           {
-            LCD_Data2(Offset);               /* foreground color */
-          }
-          else                               /* bit unset */
-          {
-            LCD_Data2(COLOR_BACKGROUND);     /* background color */
+            LCD_PixelRun(Offset, Level, Run);   /* send pending run */
+            Level ^= 1;                         /* toggle level */
+            Run = 0;                            /* reset counter */
           }
 
+          Run++;                                /* one more pixel */
+
           n--;                          /* next pixel */
 
           if (n % SYMBOL_RESIZE == 0)   /* for every resize step */
@@ -800,6 +1001,9 @@ void LCD_Symbol(uint8_t ID)
     }
   }
 
+  /* send last run of pixels */
+  LCD_PixelRun(Offset, Level, Run);
+
   /* mark text lines as used */
   n = LCD_SYMBOL_CHAR_Y;           /* set line counter */
   x = UI.SymbolPos_Y;              /* start line */
@@ -828,7 +1032,6 @@ void LCD_Symbol(uint8_t ID)
 void LCD_Box(uint16_t Color)
 {
   uint16_t          x_Size;             /* x size */
-  uint16_t          x;                  /* x counter */
   uint16_t          y_Size;             /* y size/counter */
 
   LCD_AddressWindow();             /* set address window */
@@ -841,13 +1044,7 @@ void LCD_Box(uint16_t Color)
 
   while (y_Size > 0)               /* loop trough rows */
   {
-    x = x_Size;                    /* reset counter */    
-
-    while (x > 0)                  /* loop through columns */
-    {
-      LCD_Data2(Color);            /* send color code for dot */
-      x--;                         /* next one */
-    }
+    LCD_Data2_Run(Color, x_Size);  /* send color code for all dots */
 
     y_Size--;                      /* next one */
   }
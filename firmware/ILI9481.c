@@ -175,6 +175,13 @@ uint16_t            LineFlags;     /* bitfield for up to 16 lines */
 /* colors in RGB666 8-bit frame format */
 uint8_t             RGB666_FG[3];       /* foreground/pen color */
 uint8_t             RGB666_BG[3];       /* background color */
+uint16_t            RGB666_Pen;         /* RGB565 color of RGB666_FG */
+#endif
+
+#ifdef FONT_CACHE
+/* font cache */
+uint8_t             FontCache[FONT_CACHE_CHARS][FONT_BYTES_N];   /* glyph bitmaps */
+uint8_t             FontCacheID[FONT_CACHE_CHARS];     /* font index of glyphs */
 #endif
 
 
@@ -345,6 +352,37 @@ void LCD_Data2(uint16_t Data)
   #endif
 }
 
+
+
+/*
+ *  send a 3-byte value repeatedly to the LCD
+ *  - for RGB666 pixel data in 8-bit frame format
+ *  - selects chip and data mode just once for all repetitions
+ *
+ *  requires:
+ *  - Data: pointer to array of 3 bytes
+ *  - Count: number of repetitions
+ */
+
+void LCD_Data3_Run(uint8_t *Data, uint16_t Count)
+{
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
+
+  #ifdef LCD_CS
+  /* select chip */
+  LCD_PORT &= ~(1 << LCD_CS);      /* set /CSX low */
+  #endif
+
+  /* send data: 3 bytes */
+  SPI_Write_Repeat(Data, 3, Count);
+
+  #ifdef LCD_CS
+  /* deselect chip */
+  LCD_PORT |= (1 << LCD_CS);       /* set /CSX high */
+  #endif
+}
+
 #endif
 
 
@@ -550,6 +588,118 @@ void LCD_Data2(uint16_t Data)
 
 
 
+/*
+ *  send a 2-byte value repeatedly to the LCD
+ *  - selects chip and data mode just once for all repetitions
+ *
+ *  requires:
+ *  - Data: 2-byte value to send
+ *  - Count: number of repetitions
+ */
+
+void LCD_Data2_Run(uint16_t Data, uint16_t Count)
+{
+  uint8_t           Byte;     /* data byte */
+  #ifdef LCD_FAST_WRITE
+  uint8_t           WR_High;  /* port state: WRX high */
+  uint8_t           WR_Low;   /* port state: WRX low */
+  #endif
+
+  #ifdef LCD_CS
+  /* select chip */
+  LCD_PORT &= ~(1 << LCD_CS);      /* set /CSX low */
+  #endif
+
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
+
+  /* send data */
+  Byte = (uint8_t)Data;            /* save LSB */
+  Data >>= 8;                      /* get MSB */
+
+  #ifdef LCD_FAST_WRITE
+  /*
+   *  write strobe by writing the complete port with precalculated
+   *  levels (2 cycles instead of 2x read-modify-write)
+   *  - other pins of LCD_PORT keep their state during the run
+   */
+
+  WR_High = LCD_PORT | (1 << LCD_WR);   /* WRX high */
+  WR_Low = WR_High & ~(1 << LCD_WR);    /* WRX low */
+
+  /* write strobe: set WRX low and high again */
+  #define WR_STROBE()     LCD_PORT = WR_Low; LCD_PORT = WR_High
+
+  /* single pixel: MSB and LSB */
+  #define WR_PIXEL()      LCD_PORT2 = (uint8_t)Data; WR_STROBE(); \
+                          LCD_PORT2 = Byte; WR_STROBE()
+
+  if ((uint8_t)Data == Byte)       /* same MSB and LSB */
+  {
+    /* data signals stay the same, just create write strobes */
+    LCD_PORT2 = Byte;              /* DB0-7 */
+
+    while (Count >= 4)             /* 4 pixels per loop run */
+    {
+      WR_STROBE(); WR_STROBE();
+      WR_STROBE(); WR_STROBE();
+      WR_STROBE(); WR_STROBE();
+      WR_STROBE(); WR_STROBE();
+      Count -= 4;                  /* next ones */
+    }
+
+    while (Count > 0)              /* remaining pixels */
+    {
+      WR_STROBE(); WR_STROBE();
+      Count--;                     /* next one */
+    }
+  }
+  else                             /* different MSB and LSB */
+  {
+    while (Count >= 4)             /* 4 pixels per loop run */
+    {
+      WR_PIXEL();
+      WR_PIXEL();
+      WR_PIXEL();
+      WR_PIXEL();
+      Count -= 4;                  /* next ones */
+    }
+
+    while (Count > 0)              /* remaining pixels */
+    {
+      WR_PIXEL();
+      Count--;                     /* next one */
+    }
+  }
+
+  #undef WR_PIXEL
+  #undef WR_STROBE
+
+  #else
+  while (Count > 0)                /* repeat value */
+  {
+    /* MSB: set data signals and create write strobe */
+    LCD_PORT2 = (uint8_t)Data;     /* DB0-7 */
+    LCD_PORT &= ~(1 << LCD_WR);    /* set WRX low */
+    LCD_PORT |= (1 << LCD_WR);     /* set WRX high */
+
+    /* LSB: set data signals and create write strobe */
+    LCD_PORT2 = Byte;              /* DB0-7 */
+    LCD_PORT &= ~(1 << LCD_WR);    /* set WRX low */
+    LCD_PORT |= (1 << LCD_WR);     /* set WRX high */
+
+    Count--;                       /* next one */
+  }
+  #endif
+
+  #ifdef LCD_CS
+  /* deselect chip */
+  LCD_PORT |= (1 << LCD_CS);       /* set /CSX high */
+  #endif
+}
+
+
+
 #if 0
 
 /*
@@ -816,6 +966,50 @@ void LCD_Data2(uint16_t Data)
   #endif
 }
 
+
+
+/*
+ *  send a 2-byte value repeatedly to the LCD
+ *  - selects chip and data mode just once for all repetitions
+ *
+ *  requires:
+ *  - Data: 2-byte value to send
+ *  - Count: number of repetitions
+ */
+
+void LCD_Data2_Run(uint16_t Data, uint16_t Count)
+{
+  #ifdef LCD_CS
+  /* select chip */
+  LCD_PORT &= ~(1 << LCD_CS);      /* set /CSX low */
+  #endif
+
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
+
+  /* set data signals */
+  LCD_PORT2 = (uint8_t)Data;       /* set LSB (DB0-7) */
+  Data >>= 8;                      /* get MSB */
+  LCD_PORT3 = (uint8_t)Data;       /* set MSB (DB8-15) */
+
+  while (Count > 0)                /* repeat value */
+  {
+    /* create write strobe (rising edge takes data in) */
+    LCD_PORT &= ~(1 << LCD_WR);    /* set WRX low */
+                                   /* wait 15ns */
+    LCD_PORT |= (1 << LCD_WR);     /* set WRX high */
+    Count--;                       /* next one */
+  }
+
+  /* data hold time 10ns */
+  /* next write cycle after 15ns WRX being high */
+
+  #ifdef LCD_CS
+  /* deselect chip */
+  LCD_PORT |= (1 << LCD_CS);       /* set /CSX high */
+  #endif
+}
+
 #endif
 
 
@@ -911,6 +1105,25 @@ void RGB565_2_RGB666(uint16_t Color, uint8_t *RGB666)
   *RGB666 = B6;               /* blue */
 }
 
+
+
+/*
+ *  set pen color for RGB666
+ *  - converts color only when it differs from the cached one
+ *
+ *  requires:
+ *  - Color: RGB565 color value
+ */
+
+void RGB666_SetPen(uint16_t Color)
+{
+  if (Color != RGB666_Pen)         /* color changed */
+  {
+    RGB565_2_RGB666(Color, &RGB666_FG[0]);   /* convert color */
+    RGB666_Pen = Color;                      /* update cache */
+  }
+}
+
 #endif
 
 
@@ -1042,30 +1255,18 @@ void LCD_ClearLine(uint8_t Line)
 
   LCD_AddressWindow();                  /* set window */
 
-  #ifdef COLORMODE_RGB666
-  /* convert RGB565 color to RGB666 */ 
-  RGB565_2_RGB666(COLOR_BACKGROUND, &RGB666_BG[0]);
-  #endif
-
   /* clear all pixels in window */
   LCD_Cmd(CMD_MEM_WRITE);          /* start writing */
 
   while (y > 0)                    /* character height (pages) */
   {
     x = X_Start;                   /* reset start position */
-    while (x < LCD_PIXELS_X)       /* all columns */
-    {
-      /* send background color */
-      #if defined (COLORMODE_RGB565)
-      LCD_Data2(COLOR_BACKGROUND);      /* RGB565 */
-      #elif defined (COLORMODE_RGB666)
-      LCD_Data(RGB666_BG[0]);           /* R6 */
-      LCD_Data(RGB666_BG[1]);           /* G6 */
-      LCD_Data(RGB666_BG[2]);           /* B6 */
-      #endif
-
-      x++;                              /* next column */
-    }
+    /* send background color for all columns */
+    #if defined (COLORMODE_RGB565)
+    LCD_Data2_Run(COLOR_BACKGROUND, LCD_PIXELS_X - x);   /* RGB565 */
+    #elif defined (COLORMODE_RGB666)
+    LCD_Data3_Run(&RGB666_BG[0], LCD_PIXELS_X - x);      /* RGB666 */
+    #endif
 
     y--;                           /* next page */
   }
@@ -1095,6 +1296,75 @@ void LCD_Clear(void)
 
 
 
+#ifdef FONT_CACHE
+
+/*
+ *  load glyphs of digits, prefixes and units into font cache
+ *  - helper function for LCD_Init()
+ *  - glyphs are stored uncompressed
+ */
+
+void LCD_FontCache(void)
+{
+  uint8_t           *Table;        /* pointer to table */
+  uint8_t           *Cache;        /* pointer to cache */
+  uint8_t           Slot = 0;      /* cache slot */
+  uint8_t           Index;         /* font index */
+  #ifdef FONT_RLE
+  uint8_t           y;             /* bitmap y byte counter */
+  uint8_t           n;             /* byte counter */
+  #endif
+
+  while (Slot < FONT_CACHE_CHARS)
+  {
+    /* get font index number of character */
+    Index = DATA_read_byte(&FontCache_table[Slot]);    /* get character */
+    Table = (uint8_t *)&FontTable;      /* start address */
+    Table += Index;                     /* add offset for character */
+    Index = pgm_read_byte(Table);       /* get index number */
+    FontCacheID[Slot] = Index;          /* 0xff for no bitmap */
+    Cache = &FontCache[Slot][0];        /* address of cache slot */
+
+    if (Index != 0xff)                  /* character bitmap available */
+    {
+      Table = (uint8_t *)&FontData;     /* start address of font data */
+
+      #ifdef FONT_RLE
+      Table += pgm_read_word(&FontIndex[Index]);   /* address of character */
+      Bitmap_Start(Table, Cache, FONT_BYTES_X);    /* start decoder */
+      y = FONT_BYTES_Y;
+      while (y > 0)
+      {
+        Bitmap_Row(Cache, FONT_BYTES_X);      /* decode row */
+        y--;                                  /* next row */
+
+        if (y > 0)                     /* not last row */
+        {
+          /* copy row as base for next row */
+          n = 0;
+          while (n < FONT_BYTES_X)
+          {
+            Cache[FONT_BYTES_X + n] = Cache[n];
+            n++;
+          }
+        }
+
+        Cache += FONT_BYTES_X;         /* next row */
+      }
+      #else
+      Table += FONT_BYTES_N * Index;    /* address of character */
+      memcpy_P(Cache, Table, FONT_BYTES_N);     /* copy bitmap */
+      #endif
+    }
+
+    Slot++;                             /* next slot */
+  }
+}
+
+#endif
+
+
+
 /*
  *  initialize LCD
  */
@@ -1228,6 +1498,17 @@ void LCD_Init(void)
   UI.SymbolSize_Y = LCD_SYMBOL_CHAR_Y;  /* y size in chars */
   #endif
 
+  #ifdef FONT_CACHE
+  LCD_FontCache();                 /* load font cache */
+  #endif
+
+  #ifdef COLORMODE_RGB666
+  /* init RGB666 colors */
+  RGB565_2_RGB666(COLOR_BACKGROUND, &RGB666_BG[0]);  /* fixed background */
+  RGB565_2_RGB666(COLOR_PEN, &RGB666_FG[0]);         /* default pen */
+  RGB666_Pen = COLOR_PEN;
+  #endif
+
   /* init character stuff */
   LineFlags = 0xffff;              /* clear all lines by default */
   LCD_CharPos(1, 1);               /* reset character position */
@@ -1240,6 +1521,40 @@ void LCD_Init(void)
 
 
 
+/*
+ *  send a run of pixels in pen or background color
+ *  - helper function for LCD_Char() and LCD_Symbol()
+ *  - RGB666: expects pen and background color in RGB666_FG and RGB666_BG
+ *
+ *  requires:
+ *  - Color: pen color (RGB565)
+ *  - Level: 0 for background color, 1 for pen color
+ *  - Count: number of pixels
+ */
+
+void LCD_PixelRun(uint16_t Color, uint8_t Level, uint16_t Count)
+{
+  #if defined (COLORMODE_RGB565)
+  if (Level == 0)                  /* background */
+  {
+    Color = COLOR_BACKGROUND;      /* use background color */
+  }
+
+  LCD_Data2_Run(Color, Count);     /* send pixels */
+  #elif defined (COLORMODE_RGB666)
+  if (Level == 0)                  /* background */
+  {
+    LCD_Data3_Run(&RGB666_BG[0], Count);     /* send pixels */
+  }
+  else                             /* pen */
+  {
+    LCD_Data3_Run(&RGB666_FG[0], Count);     /* send pixels */
+  }
+  #endif
+}
+
+
+
 /*
  *  display a single character
  *
@@ -1257,6 +1572,14 @@ void LCD_Char(unsigned char Char)
   uint8_t           y = 1;         /* bitmap y byte counter */
   uint8_t           Bits;          /* number of bits to be sent */
   uint8_t           n;             /* bitmap bit counter */
+  uint8_t           Level = 0;     /* pixel level of current run */
+  uint16_t          Run = 0;       /* number of pixels in current run */
+  #ifdef FONT_RLE
+  uint8_t           RowBuffer[FONT_BYTES_X];     /* decoded row */
+  #endif
+  #ifdef FONT_CACHE
+  uint8_t           Cached = 0;    /* glyph in font cache */
+  #endif
 
   /* prevent x overflow */
   if (UI.CharPos_X > LCD_CHAR_X) return;
@@ -1267,10 +1590,38 @@ void LCD_Char(unsigned char Char)
   Index = pgm_read_byte(Table);         /* get index number */
   if (Index == 0xff) return;            /* no character bitmap available */
 
+  #ifdef FONT_CACHE
+  /* check font cache */
+  n = 0;
+  while (n < FONT_CACHE_CHARS)
+  {
+    if (FontCacheID[n] == Index)       /* glyph cached */
+    {
+      Table = &FontCache[n][0];        /* read bitmap from RAM */
+      Cached = 1;
+      break;
+    }
+    n++;                               /* next slot */
+  }
+
+  if (Cached == 0)                     /* not cached */
+  {
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&FontData;        /* start address of font data */
+  #ifdef FONT_RLE
+  Offset = pgm_read_word(&FontIndex[Index]);  /* offset for character */
+  Table += Offset;                     /* address of character data */
+  Bitmap_Start(Table, RowBuffer, FONT_BYTES_X);     /* start decoder */
+  #else
   Offset = FONT_BYTES_N * Index;       /* offset for character */
   Table += Offset;                     /* address of character data */
+  #endif
+
+  #ifdef FONT_CACHE
+  }
+  #endif
 
   /* LCD's address window */
   LCD_CharPos(UI.CharPos_X, UI.CharPos_Y);   /* update character position */
@@ -1288,9 +1639,8 @@ void LCD_Char(unsigned char Char)
   #endif
 
   #ifdef COLORMODE_RGB666
-  /* convert RGB565 colors to RGB666 */ 
-  RGB565_2_RGB666(COLOR_BACKGROUND, &RGB666_BG[0]);
-  RGB565_2_RGB666(Offset, &RGB666_FG[0]);
+  /* convert RGB565 pen color to RGB666 (cached) */
+  RGB666_SetPen(Offset);
   #endif
 
   LCD_Cmd(CMD_MEM_WRITE);              /* start writing */
@@ -1298,6 +1648,15 @@ void LCD_Char(unsigned char Char)
   /* read character bitmap and send it to display */
   while (y <= FONT_BYTES_Y)
   {
+    #ifdef FONT_RLE
+    #ifdef FONT_CACHE
+    if (Cached == 0)                    /* compressed bitmap */
+    #endif
+    {
+      Bitmap_Row(RowBuffer, FONT_BYTES_X);   /* decode next row */
+      Table = RowBuffer;                /* read row from buffer */
+    }
+    #endif
     Pixels = FONT_SIZE_X;               /* track x bits to be sent */
     x = 1;                              /* reset counter */
 
@@ -1315,35 +1674,28 @@ void LCD_Char(unsigned char Char)
       }
       Pixels -= Bits;              /* update counter */
 
+      #if defined (FONT_RLE)
+      Index = *Table;                   /* read byte from buffer */
+      #elif defined (FONT_CACHE)
+      if (Cached) Index = *Table;       /* read byte from cache */
+      else Index = pgm_read_byte(Table);     /* read byte */
+      #else
       Index = pgm_read_byte(Table);     /* read byte */
+      #endif
 
       /* send color for each bit */
       n = Bits;
       while (n > 0)
       {
-        if (Index & 0b00000001)         /* bit set */
+        if ((Index & 0b00000001) != Level)   /* pixel level changes */
         {
-          /* send foreground/pen color */
-          #if defined (COLORMODE_RGB565)
-          LCD_Data2(Offset);            /* RGB565 */
-          #elif defined (COLORMODE_RGB666)
-          LCD_Data(RGB666_FG[0]);       /* R6 */
-          LCD_Data(RGB666_FG[1]);       /* G6 */
-          LCD_Data(RGB666_FG[2]);       /* B6 */
-          #endif
-        }
-        else                            /* bit unset */
-        {
-          /* send background color */
-          #if defined (COLORMODE_RGB565)
-          LCD_Data2(COLOR_BACKGROUND);  /* RGB565 */
-          #elif defined (COLORMODE_RGB666)
-          LCD_Data(RGB666_BG[0]);       /* R6 */
-          LCD_Data(RGB666_BG[1]);       /* G6 */
-          LCD_Data(RGB666_BG[2]);       /* B6 */
-          #endif
+          LCD_PixelRun(Offset, Level, Run);   /* send pending run */
+          Level ^= 1;                         /* toggle level */
+          Run = 0;                            /* reset counter */
         }
 
+        Run++;                                /* one more pixel */
+
         Index >>= 1;                      /* shift byte for next bit */
         n--;                              /* next bit */
       }
@@ -1355,6 +1707,9 @@ void LCD_Char(unsigned char Char)
     y++;                                /* next row */
   }
 
+  /* send last run of pixels */
+  LCD_PixelRun(Offset, Level, Run);
+
   UI.CharPos_X++;             /* update character position */
 }
 
@@ -1410,12 +1765,23 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           y = 1;         /* bitmap y byte counter */
   uint8_t           Bits;          /* number of bits to be sent */
   uint8_t           n;             /* bitmap bit counter */
+  uint8_t           Level = 0;     /* pixel level of current run */
+  uint16_t          Run = 0;       /* number of pixels in current run */
   uint8_t           Factor = SYMBOL_RESIZE;  /* resize factor */
+  #ifdef SYMBOLS_RLE
+  uint8_t           RowBuffer[SYMBOL_BYTES_X];   /* decoded row */
+  #endif
 
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
+  #ifdef SYMBOLS_RLE
+  Offset = pgm_read_word(&SymbolIndex[ID]);  /* offset for symbol */
+  Table += Offset;                      /* address of symbol data */
+  Bitmap_Start(Table, RowBuffer, SYMBOL_BYTES_X);   /* start decoder */
+  #else
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
   Table += Offset;                      /* address of symbol data */
+  #endif
 
   /* LCD's address window */
   LCD_CharPos(UI.CharPos_X, UI.CharPos_Y);   /* update character position */
@@ -1433,9 +1799,8 @@ void LCD_Symbol(uint8_t ID)
   #endif
 
   #ifdef COLORMODE_RGB666
-  /* convert RGB565 colors to RGB666 */ 
-  RGB565_2_RGB666(COLOR_BACKGROUND, &RGB666_BG[0]);
-  RGB565_2_RGB666(Offset, &RGB666_FG[0]);
+  /* convert RGB565 pen color to RGB666 (cached) */
+  RGB666_SetPen(Offset);
   #endif
 
   LCD_Cmd(CMD_MEM_WRITE);               /* start writing */
@@ -1443,6 +1808,10 @@ void LCD_Symbol(uint8_t ID)
   /* read character bitmap and send it to display */
   while (y <= SYMBOL_BYTES_Y)
   {
+    #ifdef SYMBOLS_RLE
+    Bitmap_Row(RowBuffer, SYMBOL_BYTES_X);   /* decode next row */
+    Table = RowBuffer;        /* read row from buffer */
+    #endif
     Table2 = Table;           /* save current pointer */
 
     while (Factor > 0)        /* resize symbol */
@@ -1466,7 +1835,11 @@ void LCD_Symbol(uint8_t ID)
         }
         Pixels -= Bits;            /* update counter */
 
+        #ifdef SYMBOLS_RLE
+        Data = *Table;                  /* read byte from buffer */
+        #else
         Data = pgm_read_byte(Table);    /* read byte */
+        #endif
 
         /* send color for each bit */
         n = Bits;                       /* reset counter */
@@ -1474,29 +1847,15 @@ void LCD_Symbol(uint8_t ID)
 
         while (n > 0)                   /* x pixels */
         {
-          if (Data & 0b00000001)             /* bit set */
-          {
-            /* send foreground/pen color */
-            #if defined (COLORMODE_RGB565)
-            LCD_Data2(Offset);               /* RGB565 */
-            #elif defined (COLORMODE_RGB666)
-            LCD_Data(RGB666_FG[0]);          /* R6 */
-            LCD_Data(RGB666_FG[1]);          /* G6 */
-            LCD_Data(RGB666_FG[2]);          /* B6 */
-            #endif
-          }
-          else                               /* bit unset */
+          if ((Data & 0b00000001) != Level)   /* pixel level changes */
           {
-            /* send background color */
-            #if defined (COLORMODE_RGB565)
-            LCD_Data2(COLOR_BACKGROUND);     /* RGB565 */
-            #elif defined (COLORMODE_RGB666)
-            LCD_Data(RGB666_BG[0]);          /* R6 */
-            LCD_Data(RGB666_BG[1]);          /* G6 */
-            LCD_Data(RGB666_BG[2]);          /* B6 */
-            #endif
+            LCD_PixelRun(Offset, Level, Run);   /* send pending run */
+            Level ^= 1;                         /* toggle level */
+            Run = 0;                            /* reset counter */
           }
 
+          Run++;                                /* one more pixel */
+
           n--;                          /* next pixel */
 
           if (n % SYMBOL_RESIZE == 0)   /* for every resize step */
@@ -1520,6 +1879,9 @@ void LCD_Symbol(uint8_t ID)
     }              
   }
 
+  /* send last run of pixels */
+  LCD_PixelRun(Offset, Level, Run);
+
   /* mark text lines as used */
   n = LCD_SYMBOL_CHAR_Y;           /* set line counter */
   x = UI.SymbolPos_Y;              /* start line */
@@ -1548,7 +1910,6 @@ void LCD_Symbol(uint8_t ID)
 void LCD_Box(uint16_t Color)
 {
   uint16_t          x_Size;             /* x size */
-  uint16_t          x;                  /* x counter */
   uint16_t          y_Size;             /* y size/counter */
 
   LCD_AddressWindow();             /* set address window */
@@ -1558,29 +1919,20 @@ void LCD_Box(uint16_t Color)
   y_Size = Y_End - Y_Start + 1;
 
   #ifdef COLORMODE_RGB666
-  /* convert RGB565 color to RGB666 */ 
-  RGB565_2_RGB666(Color, &RGB666_FG[0]);
+  /* convert RGB565 color to RGB666 (cached) */
+  RGB666_SetPen(Color);
   #endif
 
   LCD_Cmd(CMD_MEM_WRITE);          /* start writing */
 
   while (y_Size > 0)               /* loop trough rows */
   {
-    x = x_Size;                    /* reset counter */    
-
-    while (x > 0)                  /* loop through columns */
-    {
-      /* send box color */
-      #if defined (COLORMODE_RGB565)
-      LCD_Data2(Color);            /* RGB565 */
-      #elif defined (COLORMODE_RGB666)
-      LCD_Data(RGB666_FG[0]);      /* R6 */
-      LCD_Data(RGB666_FG[1]);      /* G6 */
-      LCD_Data(RGB666_FG[2]);      /* B6 */
-      #endif
-
-      x--;                         /* next one */
-    }
+    /* send box color for all columns */
+    #if defined (COLORMODE_RGB565)
+    LCD_Data2_Run(Color, x_Size);             /* RGB565 */
+    #elif defined (COLORMODE_RGB666)
+    LCD_Data3_Run(&RGB666_FG[0], x_Size);     /* RGB666 */
+    #endif
 
     y_Size--;                      /* next one */
   }
@@ -59,6 +59,11 @@
  *  - max. SPI clock: 15MHz write and 6.6MHz read
  *  - ILI9486 has a PWM output (CAPC_PWM) for controlling backlight LEDs,
  *    but it's rarely used.
+ *  - multi-controller build (LCD_ILI948X)
+ *    ILI9481, ILI9486 and ILI9488 are identified by their ID registers
+ *    at LCD_Init() and differ only in the register setup, since all
+ *    use the same commands for the address window and frame memory
+ *    (8 bit parallel with RDX only)
  */
 
 
@@ -161,6 +166,16 @@
   #define COLORMODE_RGB565
 #endif
 
+/* multi-controller build: controller types */
+#ifdef LCD_ILI948X
+  #define CTRL_ILI9481        1    /* ILI9481 */
+  #define CTRL_ILI9486        2    /* ILI9486 (default) */
+  #define CTRL_ILI9488        3    /* ILI9488 */
+
+  /* ILI9481 specific command (not in ILI9486.h) */
+  #define CMD_READ_DEVICE_CODE  0b10111111     /* read device code */
+#endif
+
 
 
 /*
@@ -176,10 +191,44 @@ uint16_t            Y_End;         /* end position Y (page/row) */
 /* text line management */
 uint16_t            LineFlags;     /* bitfield for up to 16 lines */
 
+#ifdef LCD_ILI948X
+/* multi-controller build */
+uint8_t             Controller;    /* detected controller type */
+
+/* register setup: command, number of parameters, parameters ... */
+/* ILI9481 */
+const uint8_t ILI9481_Regs[] PROGMEM = {
+  0b10110011, 4, 0, 0, 0, 0,                 /* frame memory access: enforce window, RGB565 R0/B0 = 0 */
+  0b00111010, 1, 0b00000101,                 /* pixel format: 16 bits / RGB565 */
+  0b11010000, 3, 0b00000111, 0b01000010, 0b00011000,  /* power: VCI 1.00, BT 2 & VGL on, VRH 1.60 & int. ref */
+  0b11010001, 3, 0, 0b00000111, 0b00010000,  /* VCOM: from register, 0.720, AC 1.02 */
+  0b11010010, 2, 0b00000001, 0b00000010,     /* power normal mode: AP 1.00, DC 1/4 & 1/16 */
+  0b11000000, 5, 0b00010000, 0b00111011, 0, 0b00000010, 0b00010001,  /* panel: REV on, 480 lines, GND, 3 frames */
+  0                                          /* end of table */
+};
+
+/* ILI9488 */
+const uint8_t ILI9488_Regs[] PROGMEM = {
+  0b00111010, 1, 0b00000101,                 /* pixel format: 16 bits / RGB565 */
+  0b11000000, 2, 0b00010000, 0b00010000,     /* power control 1: +/-4.5625V */
+  0b11000001, 1, 0b01000100,                 /* power control 2: step-up factor */
+  0b11000101, 4, 0, 0b00100010, 0b10000000, 0,     /* VCOM: -1.46875 from register */
+  0b10110111, 1, 0b10000110,                 /* entry mode: normal display */
+  0                                          /* end of table */
+};
+#endif
+
 #ifdef COLORMODE_RGB666
 /* colors in RGB666 8-bit frame format */
 uint8_t             RGB666_FG[3];       /* foreground/pen color */
 uint8_t             RGB666_BG[3];       /* background color */
+uint16_t            RGB666_Pen;         /* RGB565 color of RGB666_FG */
+#endif
+
+#ifdef FONT_CACHE
+/* font cache */
+uint8_t             FontCache[FONT_CACHE_CHARS][FONT_BYTES_N];   /* glyph bitmaps */
+uint8_t             FontCacheID[FONT_CACHE_CHARS];     /* font index of glyphs */
 #endif
 
 
@@ -354,6 +403,37 @@ void LCD_Data2(uint16_t Data)
   #endif
 }
 
+
+
+/*
+ *  send a 3-byte value repeatedly to the display
+ *  - for RGB666 pixel data in 8-bit frame format
+ *  - selects chip and data mode just once for all repetitions
+ *
+ *  requires:
+ *  - Data: pointer to array of 3 bytes
+ *  - Count: number of repetitions
+ */
+
+void LCD_Data3_Run(uint8_t *Data, uint16_t Count)
+{
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
+
+  #ifdef LCD_CS
+  /* select chip */
+  LCD_PORT &= ~(1 << LCD_CS);      /* set /CSX low */
+  #endif
+
+  /* send data: 3 bytes */
+  SPI_Write_Repeat(Data, 3, Count);
+
+  #ifdef LCD_CS
+  /* deselect chip */
+  LCD_PORT |= (1 << LCD_CS);       /* set /CSX high */
+  #endif
+}
+
 #endif
 
 
@@ -559,6 +639,118 @@ void LCD_Data2(uint16_t Data)
 
 
 
+/*
+ *  send a 2-byte value repeatedly to the display
+ *  - selects chip and data mode just once for all repetitions
+ *
+ *  requires:
+ *  - Data: 2-byte value to send
+ *  - Count: number of repetitions
+ */
+
+void LCD_Data2_Run(uint16_t Data, uint16_t Count)
+{
+  uint8_t           Byte;     /* data byte */
+  #ifdef LCD_FAST_WRITE
+  uint8_t           WR_High;  /* port state: WRX high */
+  uint8_t           WR_Low;   /* port state: WRX low */
+  #endif
+
+  #ifdef LCD_CS
+  /* select chip */
+  LCD_PORT &= ~(1 << LCD_CS);      /* set /CSX low */
+  #endif
+
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
+
+  /* send data */
+  Byte = (uint8_t)Data;            /* save LSB */
+  Data >>= 8;                      /* get MSB */
+
+  #ifdef LCD_FAST_WRITE
+  /*
+   *  write strobe by writing the complete port with precalculated
+   *  levels (2 cycles instead of 2x read-modify-write)
+   *  - other pins of LCD_PORT keep their state during the run
+   */
+
+  WR_High = LCD_PORT | (1 << LCD_WR);   /* WRX high */
+  WR_Low = WR_High & ~(1 << LCD_WR);    /* WRX low */
+
+  /* write strobe: set WRX low and high again */
+  #define WR_STROBE()     LCD_PORT = WR_Low; LCD_PORT = WR_High
+
+  /* single pixel: MSB and LSB */
+  #define WR_PIXEL()      LCD_PORT2 = (uint8_t)Data; WR_STROBE(); \
+                          LCD_PORT2 = Byte; WR_STROBE()
+
+  if ((uint8_t)Data == Byte)       /* same MSB and LSB */
+  {
+    /* data signals stay the same, just create write strobes */
+    LCD_PORT2 = Byte;              /* DB0-7 */
+
+    while (Count >= 4)             /* 4 pixels per loop run */
+    {
+      WR_STROBE(); WR_STROBE();
+      WR_STROBE(); WR_STROBE();
+      WR_STROBE(); WR_STROBE();
+      WR_STROBE(); WR_STROBE();
+      Count -= 4;                  /* next ones */
+    }
+
+    while (Count > 0)              /* remaining pixels */
+    {
+      WR_STROBE(); WR_STROBE();
+      Count--;                     /* next one */
+    }
+  }
+  else                             /* different MSB and LSB */
+  {
+    while (Count >= 4)             /* 4 pixels per loop run */
+    {
+      WR_PIXEL();
+      WR_PIXEL();
+      WR_PIXEL();
+      WR_PIXEL();
+      Count -= 4;                  /* next ones */
+    }
+
+    while (Count > 0)              /* remaining pixels */
+    {
+      WR_PIXEL();
+      Count--;                     /* next one */
+    }
+  }
+
+  #undef WR_PIXEL
+  #undef WR_STROBE
+
+  #else
+  while (Count > 0)                /* repeat value */
+  {
+    /* MSB: set data signals and create write strobe */
+    LCD_PORT2 = (uint8_t)Data;     /* DB0-7 */
+    LCD_PORT &= ~(1 << LCD_WR);    /* set WRX low */
+    LCD_PORT |= (1 << LCD_WR);     /* set WRX high */
+
+    /* LSB: set data signals and create write strobe */
+    LCD_PORT2 = Byte;              /* DB0-7 */
+    LCD_PORT &= ~(1 << LCD_WR);    /* set WRX low */
+    LCD_PORT |= (1 << LCD_WR);     /* set WRX high */
+
+    Count--;                       /* next one */
+  }
+  #endif
+
+  #ifdef LCD_CS
+  /* deselect chip */
+  LCD_PORT |= (1 << LCD_CS);       /* set /CSX high */
+  #endif
+}
+
+
+
 #if 0
 
 /*
@@ -626,6 +818,144 @@ uint8_t LCD_ReadByte(void)
 
 
 
+#ifdef LCD_ILI948X
+
+/* ************************************************************************
+ *   controller detection for multi-controller build
+ * ************************************************************************ */
+
+
+/*
+ *  read ID from display controller
+ *  - timing is based on the slowest controller (ILI9481)
+ *  - keeps the controller selected for command and parameters
+ *
+ *  requires:
+ *  - Cmd: read command
+ *  - Skip: number of parameters to skip after the dummy read
+ *
+ *  returns:
+ *  - next two parameters (MSB first)
+ */
+
+uint16_t LCD_ReadID(uint8_t Cmd, uint8_t Skip)
+{
+  uint16_t          ID = 0;        /* return value */
+  uint8_t           n;             /* counter */
+
+  #ifdef LCD_CS
+  /* select chip */
+  LCD_PORT &= ~(1 << LCD_CS);      /* set /CSX low */
+  #endif
+
+  /* send command */
+  LCD_PORT &= ~(1 << LCD_DC);      /* set D/CX low */
+  LCD_SendByte(Cmd);               /* send command byte */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
+
+  /* set data pins to input mode before reading */
+  LCD_DDR2 = 0b00000000;           /* DB0-7 */
+
+  /* dummy read + parameters to skip + 2 ID bytes */
+  n = Skip + 3;
+  while (n > 0)
+  {
+    /* read cycle: RDX low (ILI9481: max. 340ns access time) */
+    LCD_PORT &= ~(1 << LCD_RD);    /* set RDX low */
+    wait1us();                     /* wait 1s */
+    ID <<= 8;                      /* shift previous byte */
+    ID |= LCD_PIN2;                /* read data: DB0-7 */
+    LCD_PORT |= (1 << LCD_RD);     /* set RDX high */
+    wait1us();                     /* wait for LCD to release data lines */
+
+    n--;
+  }
+
+  /* set data pins back to output mode after reading */
+  LCD_DDR2 = 0b11111111;           /* DB0-7 */
+
+  #ifdef LCD_CS
+  /* deselect chip */
+  LCD_PORT |= (1 << LCD_CS);       /* set /CSX high */
+  #endif
+
+  return ID;
+}
+
+
+
+/*
+ *  identify display controller
+ *  - ILI9486/ILI9488: ID4 is dummy, 0x00, 0x94, 0x86/0x88
+ *  - ILI9481: device code is dummy, 0x02, 0x04, 0x94, 0x81, 0xFF
+ *
+ *  returns:
+ *  - controller type (defaults to ILI9486)
+ */
+
+uint8_t LCD_Detect(void)
+{
+  uint8_t           Type = CTRL_ILI9486;     /* return value */
+  uint16_t          ID;                      /* controller ID */
+
+  ID = LCD_ReadID(CMD_READ_ID4, 1);          /* read ID4 */
+
+  if (ID == 0x9488)                          /* ILI9488 */
+  {
+    Type = CTRL_ILI9488;
+  }
+  else if (ID != 0x9486)                     /* not ILI9486 */
+  {
+    ID = LCD_ReadID(CMD_READ_DEVICE_CODE, 2);     /* read device code */
+
+    if (ID == 0x9481)                        /* ILI9481 */
+    {
+      Type = CTRL_ILI9481;
+    }
+  }
+
+  return Type;
+}
+
+
+
+/*
+ *  set registers based on table
+ *
+ *  requires:
+ *  - Table: pointer to register table in flash
+ */
+
+void LCD_RegTable(const uint8_t *Table)
+{
+  uint8_t           Cmd;           /* command */
+  uint8_t           n;             /* number of parameters */
+
+  Cmd = pgm_read_byte(Table);      /* get first command */
+
+  while (Cmd)                      /* until end of table */
+  {
+    Table++;
+    n = pgm_read_byte(Table);      /* get number of parameters */
+    Table++;
+
+    LCD_Cmd(Cmd);                  /* send command */
+
+    while (n > 0)                  /* send parameters */
+    {
+      LCD_Data(pgm_read_byte(Table));
+      Table++;
+      n--;
+    }
+
+    Cmd = pgm_read_byte(Table);    /* get next command */
+  }
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   low level functions for 16 bit parallel interface
  *   - LCD_PORT (LCD_DDR) for control signals
@@ -833,6 +1163,50 @@ void LCD_Data2(uint16_t Data)
   #endif
 }
 
+
+
+/*
+ *  send a 2-byte value repeatedly to the display
+ *  - selects chip and data mode just once for all repetitions
+ *
+ *  requires:
+ *  - Data: 2-byte value to send
+ *  - Count: number of repetitions
+ */
+
+void LCD_Data2_Run(uint16_t Data, uint16_t Count)
+{
+  #ifdef LCD_CS
+  /* select chip */
+  LCD_PORT &= ~(1 << LCD_CS);      /* set /CSX low */
+  #endif
+
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
+
+  /* set data signals */
+  LCD_PORT2 = (uint8_t)Data;       /* set LSB (DB0-7) */
+  Data >>= 8;                      /* get MSB */
+  LCD_PORT3 = (uint8_t)Data;       /* set MSB (DB8-15) */
+
+  while (Count > 0)                /* repeat value */
+  {
+    /* create write strobe (rising edge takes data in) */
+    LCD_PORT &= ~(1 << LCD_WR);    /* set WRX low */
+                                   /* wait 15ns */
+    LCD_PORT |= (1 << LCD_WR);     /* set WRX high */
+    Count--;                       /* next one */
+  }
+
+  /* data hold time 10ns */
+  /* next write cycle after 15ns WRX being high */
+
+  #ifdef LCD_CS
+  /* deselect chip */
+  LCD_PORT |= (1 << LCD_CS);       /* set /CSX high */
+  #endif
+}
+
 #endif
 
 
@@ -928,6 +1302,25 @@ void RGB565_2_RGB666(uint16_t Color, uint8_t *RGB666)
   *RGB666 = B6;               /* blue */
 }
 
+
+
+/*
+ *  set pen color for RGB666
+ *  - converts color only when it differs from the cached one
+ *
+ *  requires:
+ *  - Color: RGB565 color value
+ */
+
+void RGB666_SetPen(uint16_t Color)
+{
+  if (Color != RGB666_Pen)         /* color changed */
+  {
+    RGB565_2_RGB666(Color, &RGB666_FG[0]);   /* convert color */
+    RGB666_Pen = Color;                      /* update cache */
+  }
+}
+
 #endif
 
 
@@ -1059,30 +1452,18 @@ void LCD_ClearLine(uint8_t Line)
 
   LCD_AddressWindow();                  /* set window */
 
-  #ifdef COLORMODE_RGB666
-  /* convert RGB565 color to RGB666 */ 
-  RGB565_2_RGB666(COLOR_BACKGROUND, &RGB666_BG[0]);
-  #endif
-
   /* clear all pixels in window */
   LCD_Cmd(CMD_MEM_WRITE);          /* start writing */
 
   while (y > 0)                    /* character height (pages) */
   {
     x = X_Start;                   /* reset start position */
-    while (x < LCD_PIXELS_X)       /* all columns */
-    {
-      /* send background color */
-      #if defined (COLORMODE_RGB565)
-      LCD_Data2(COLOR_BACKGROUND);      /* RGB565 */
-      #elif defined (COLORMODE_RGB666)
-      LCD_Data(RGB666_BG[0]);           /* R6 */
-      LCD_Data(RGB666_BG[1]);           /* G6 */
-      LCD_Data(RGB666_BG[2]);           /* B6 */
-      #endif
-
-      x++;                              /* next column */
-    }
+    /* send background color for all columns */
+    #if defined (COLORMODE_RGB565)
+    LCD_Data2_Run(COLOR_BACKGROUND, LCD_PIXELS_X - x);   /* RGB565 */
+    #elif defined (COLORMODE_RGB666)
+    LCD_Data3_Run(&RGB666_BG[0], LCD_PIXELS_X - x);      /* RGB666 */
+    #endif
 
     y--;                           /* next page */
   }
@@ -1112,6 +1493,75 @@ void LCD_Clear(void)
 
 
 
+#ifdef FONT_CACHE
+
+/*
+ *  load glyphs of digits, prefixes and units into font cache
+ *  - helper function for LCD_Init()
+ *  - glyphs are stored uncompressed
+ */
+
+void LCD_FontCache(void)
+{
+  uint8_t           *Table;        /* pointer to table */
+  uint8_t           *Cache;        /* pointer to cache */
+  uint8_t           Slot = 0;      /* cache slot */
+  uint8_t           Index;         /* font index */
+  #ifdef FONT_RLE
+  uint8_t           y;             /* bitmap y byte counter */
+  uint8_t           n;             /* byte counter */
+  #endif
+
+  while (Slot < FONT_CACHE_CHARS)
+  {
+    /* get font index number of character */
+    Index = DATA_read_byte(&FontCache_table[Slot]);    /* get character */
+    Table = (uint8_t *)&FontTable;      /* start address */
+    Table += Index;                     /* add offset for character */
+    Index = pgm_read_byte(Table);       /* get index number */
+    FontCacheID[Slot] = Index;          /* 0xff for no bitmap */
+    Cache = &FontCache[Slot][0];        /* address of cache slot */
+
+    if (Index != 0xff)                  /* character bitmap available */
+    {
+      Table = (uint8_t *)&FontData;     /* start address of font data */
+
+      #ifdef FONT_RLE
+      Table += pgm_read_word(&FontIndex[Index]);   /* address of character */
+      Bitmap_Start(Table, Cache, FONT_BYTES_X);    /* start decoder */
+      y = FONT_BYTES_Y;
+      while (y > 0)
+      {
+        Bitmap_Row(Cache, FONT_BYTES_X);      /* decode row */
+        y--;                                  /* next row */
+
+        if (y > 0)                     /* not last row */
+        {
+          /* copy row as base for next row */
+          n = 0;
+          while (n < FONT_BYTES_X)
+          {
+            Cache[FONT_BYTES_X + n] = Cache[n];
+            n++;
+          }
+        }
+
+        Cache += FONT_BYTES_X;         /* next row */
+      }
+      #else
+      Table += FONT_BYTES_N * Index;    /* address of character */
+      memcpy_P(Cache, Table, FONT_BYTES_N);     /* copy bitmap */
+      #endif
+    }
+
+    Slot++;                             /* next slot */
+  }
+}
+
+#endif
+
+
+
 /*
  *  initialize LCD
  */
@@ -1142,6 +1592,22 @@ void LCD_Init(void)
    *  set registers of display controller
    */
 
+  #ifdef LCD_ILI948X
+  /* multi-controller build: identify controller */
+  Controller = LCD_Detect();
+
+  if (Controller == CTRL_ILI9481)       /* ILI9481 */
+  {
+    LCD_RegTable(ILI9481_Regs);
+  }
+  else if (Controller == CTRL_ILI9488)  /* ILI9488 */
+  {
+    LCD_RegTable(ILI9488_Regs);
+  }
+  else                                  /* ILI9486 */
+  {
+  #endif
+
   /* interface mode control */
   LCD_Cmd(CMD_IF_MODE_CTRL);
   LCD_Data(0);                          /* reset */
@@ -1206,6 +1672,10 @@ void LCD_Init(void)
     LCD_Data(GammaNeg[Bits]);           /* send value */
   }
 
+  #ifdef LCD_ILI948X
+  }
+  #endif
+
   /* memory access control */
   LCD_Cmd(CMD_MEM_CTRL);
   #ifdef LCD_BGR
@@ -1223,6 +1693,12 @@ void LCD_Init(void)
   #ifdef LCD_FLIP_Y
     Bits |= FLAG_PAGE_REV;           /* flip y */
   #endif
+  #ifdef LCD_ILI948X
+  if (Controller == CTRL_ILI9481)  /* ILI9481 */
+  {
+    Bits |= 0b00000010;            /* horizontal flip (like ILI9481 driver) */
+  }
+  #endif
   LCD_Data(Bits);                  /* send parameter bits */
 
   /* address window */
@@ -1250,6 +1726,17 @@ void LCD_Init(void)
   UI.SymbolSize_Y = LCD_SYMBOL_CHAR_Y;  /* y size in chars */
   #endif
 
+  #ifdef FONT_CACHE
+  LCD_FontCache();                 /* load font cache */
+  #endif
+
+  #ifdef COLORMODE_RGB666
+  /* init RGB666 colors */
+  RGB565_2_RGB666(COLOR_BACKGROUND, &RGB666_BG[0]);  /* fixed background */
+  RGB565_2_RGB666(COLOR_PEN, &RGB666_FG[0]);         /* default pen */
+  RGB666_Pen = COLOR_PEN;
+  #endif
+
   /* init character stuff */
   LineFlags = 0xffff;              /* clear all lines by default */
   LCD_CharPos(1, 1);               /* reset character position */
@@ -1262,6 +1749,40 @@ void LCD_Init(void)
 
 
 
+/*
+ *  send a run of pixels in pen or background color
+ *  - helper function for LCD_Char() and LCD_Symbol()
+ *  - RGB666: expects pen and background color in RGB666_FG and RGB666_BG
+ *
+ *  requires:
+ *  - Color: pen color (RGB565)
+ *  - Level: 0 for background color, 1 for pen color
+ *  - Count: number of pixels
+ */
+
+void LCD_PixelRun(uint16_t Color, uint8_t Level, uint16_t Count)
+{
+  #if defined (COLORMODE_RGB565)
+  if (Level == 0)                  /* background */
+  {
+    Color = COLOR_BACKGROUND;      /* use background color */
+  }
+
+  LCD_Data2_Run(Color, Count);     /* send pixels */
+  #elif defined (COLORMODE_RGB666)
+  if (Level == 0)                  /* background */
+  {
+    LCD_Data3_Run(&RGB666_BG[0], Count);     /* send pixels */
+  }
+  else                             /* pen */
+  {
+    LCD_Data3_Run(&RGB666_FG[0], Count);     /* send pixels */
+  }
+  #endif
+}
+
+
+
 /*
  *  display a single character
  *
@@ -1279,6 +1800,14 @@ void LCD_Char(unsigned char Char)
   uint8_t           y = 1;         /* bitmap y byte counter */
   uint8_t           Bits;          /* number of bits to be sent */
   uint8_t           n;             /* bitmap bit counter */
+  uint8_t           Level = 0;     /* pixel level of current run */
+  uint16_t          Run = 0;       /* number of pixels in current run */
+  #ifdef FONT_RLE
+  uint8_t           RowBuffer[FONT_BYTES_X];     /* decoded row */
+  #endif
+  #ifdef FONT_CACHE
+  uint8_t           Cached = 0;    /* glyph in font cache */
+  #endif
 
   /* prevent x overflow */
   if (UI.CharPos_X > LCD_CHAR_X) return;
@@ -1289,10 +1818,38 @@ void LCD_Char(unsigned char Char)
   Index = pgm_read_byte(Table);         /* get index number */
   if (Index == 0xff) return;            /* no character bitmap available */
 
+  #ifdef FONT_CACHE
+  /* check font cache */
+  n = 0;
+  while (n < FONT_CACHE_CHARS)
+  {
+    if (FontCacheID[n] == Index)       /* glyph cached */
+    {
+      Table = &FontCache[n][0];        /* read bitmap from RAM */
+      Cached = 1;
+      break;
+    }
+    n++;                               /* next slot */
+  }
+
+  if (Cached == 0)                     /* not cached */
+  {
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&FontData;        /* start address of font data */
+  #ifdef FONT_RLE
+  Offset = pgm_read_word(&FontIndex[Index]);  /* offset for character */
+  Table += Offset;                     /* address of character data */
+  Bitmap_Start(Table, RowBuffer, FONT_BYTES_X);     /* start decoder */
+  #else
   Offset = FONT_BYTES_N * Index;       /* offset for character */
   Table += Offset;                     /* address of character data */
+  #endif
+
+  #ifdef FONT_CACHE
+  }
+  #endif
 
   /* LCD's address window */
   LCD_CharPos(UI.CharPos_X, UI.CharPos_Y);   /* update character position */
@@ -1310,9 +1867,8 @@ void LCD_Char(unsigned char Char)
   #endif
 
   #ifdef COLORMODE_RGB666
-  /* convert RGB565 colors to RGB666 */ 
-  RGB565_2_RGB666(COLOR_BACKGROUND, &RGB666_BG[0]);
-  RGB565_2_RGB666(Offset, &RGB666_FG[0]);
+  /* convert RGB565 pen color to RGB666 (cached) */
+  RGB666_SetPen(Offset);
   #endif
 
   LCD_Cmd(CMD_MEM_WRITE);              /* start writing */
@@ -1320,6 +1876,15 @@ void LCD_Char(unsigned char Char)
   /* read character bitmap and send it to display */
   while (y <= FONT_BYTES_Y)
   {
+    #ifdef FONT_RLE
+    #ifdef FONT_CACHE
+    if (Cached == 0)                    /* compressed bitmap */
+    #endif
+    {
+      Bitmap_Row(RowBuffer, FONT_BYTES_X);   /* decode next row */
+      Table = RowBuffer;                /* read row from buffer */
+    }
+    #endif
     Pixels = FONT_SIZE_X;               /* track x bits to be sent */
     x = 1;                              /* reset counter */
 
@@ -1337,35 +1902,28 @@ void LCD_Char(unsigned char Char)
       }
       Pixels -= Bits;              /* update counter */
 
+      #if defined (FONT_RLE)
+      Index = *Table;                   /* read byte from buffer */
+      #elif defined (FONT_CACHE)
+      if (Cached) Index = *Table;       /* read byte from cache */
+      else Index = pgm_read_byte(Table);     /* read byte */
+      #else
       Index = pgm_read_byte(Table);     /* read byte */
+      #endif
 
       /* send color for each bit */
       n = Bits;
       while (n > 0)
       {
-        if (Index & 0b00000001)         /* bit set */
-        {
-          /* send foreground/pen color */
-          #if defined (COLORMODE_RGB565)
-          LCD_Data2(Offset);            /* RGB565 */
-          #elif defined (COLORMODE_RGB666)
-          LCD_Data(RGB666_FG[0]);       /* R6 */
-          LCD_Data(RGB666_FG[1]);       /* G6 */
-          LCD_Data(RGB666_FG[2]);       /* B6 */
-          #endif
-        }
-        else                            /* bit unset */
+        if ((Index & 0b00000001) != Level)   /* pixel level changes */
         {
-          /* send background color */
-          #if defined (COLORMODE_RGB565)
-          LCD_Data2(COLOR_BACKGROUND);  /* RGB565 */
-          #elif defined (COLORMODE_RGB666)
-          LCD_Data(RGB666_BG[0]);       /* R6 */
-          LCD_Data(RGB666_BG[1]);       /* G6 */
-          LCD_Data(RGB666_BG[2]);       /* B6 */
-          #endif
+          LCD_PixelRun(Offset, Level, Run);   /* send pending run */
+          Level ^= 1;                         /* toggle level */
+          Run = 0;                            /* reset counter */
         }
 
+        Run++;                                /* one more pixel */
+
         Index >>= 1;                      /* shift byte for next bit */
         n--;                              /* next bit */
       }
@@ -1377,6 +1935,9 @@ void LCD_Char(unsigned char Char)
     y++;                                /* next row */
   }
 
+  /* send last run of pixels */
+  LCD_PixelRun(Offset, Level, Run);
+
   UI.CharPos_X++;             /* update character position */
 }
 
@@ -1432,12 +1993,23 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           y = 1;         /* bitmap y byte counter */
   uint8_t           Bits;          /* number of bits to be sent */
   uint8_t           n;             /* bitmap bit counter */
+  uint8_t           Level = 0;     /* pixel level of current run */
+  uint16_t          Run = 0;       /* number of pixels in current run */
   uint8_t           Factor = SYMBOL_RESIZE;  /* resize factor */
+  #ifdef SYMBOLS_RLE
+  uint8_t           RowBuffer[SYMBOL_BYTES_X];   /* decoded row */
+  #endif
 
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
+  #ifdef SYMBOLS_RLE
+  Offset = pgm_read_word(&SymbolIndex[ID]);  /* offset for symbol */
+  Table += Offset;                      /* address of symbol data */
+  Bitmap_Start(Table, RowBuffer, SYMBOL_BYTES_X);   /* start decoder */
+  #else
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
   Table += Offset;                      /* address of symbol data */
+  #endif
 
   /* LCD's address window */
   LCD_CharPos(UI.CharPos_X, UI.CharPos_Y);   /* update character position */
@@ -1455,9 +2027,8 @@ void LCD_Symbol(uint8_t ID)
   #endif
 
   #ifdef COLORMODE_RGB666
-  /* convert RGB565 colors to RGB666 */ 
-  RGB565_2_RGB666(COLOR_BACKGROUND, &RGB666_BG[0]);
-  RGB565_2_RGB666(Offset, &RGB666_FG[0]);
+  /* convert RGB565 pen color to RGB666 (cached) */
+  RGB666_SetPen(Offset);
   #endif
 
   LCD_Cmd(CMD_MEM_WRITE);               /* start writing */
@@ -1465,6 +2036,10 @@ void LCD_Symbol(uint8_t ID)
   /* read character bitmap and send it to display */
   while (y <= SYMBOL_BYTES_Y)
   {
+    #ifdef SYMBOLS_RLE
+    Bitmap_Row(RowBuffer, SYMBOL_BYTES_X);   /* decode next row */
+    Table = RowBuffer;        /* read row from buffer */
+    #endif
     Table2 = Table;           /* save current pointer */
 
     while (Factor > 0)        /* resize symbol */
@@ -1488,7 +2063,11 @@ void LCD_Symbol(uint8_t ID)
         }
         Pixels -= Bits;            /* update counter */
 
+        #ifdef SYMBOLS_RLE
+        Data = *Table;                  /* read byte from buffer */
+        #else
         Data = pgm_read_byte(Table);    /* read byte */
+        #endif
 
         /* send color for each bit */
         n = Bits;                       /* reset counter */
@@ -1496,29 +2075,15 @@ void LCD_Symbol(uint8_t ID)
 
         while (n > 0)                   /* x pixels */
         {
-          if (Data & 0b00000001)             /* bit set */
-          {
-            /* send foreground/pen color */
-            #if defined (COLORMODE_RGB565)
-            LCD_Data2(Offset);               /* RGB565 */
-            #elif defined (COLORMODE_RGB666)
-            LCD_Data(RGB666_FG[0]);          /* R6 */
-            LCD_Data(RGB666_FG[1]);          /* G6 */
-            LCD_Data(RGB666_FG[2]);          /* B6 */
-            #endif
-          }
-          else                               /* bit unset */
+          if ((Data & 0b00000001) != Level)   /* pixel level changes */
           {
-            /* send background color */
-            #if defined (COLORMODE_RGB565)
-            LCD_Data2(COLOR_BACKGROUND);     /* RGB565 */
-            #elif defined (COLORMODE_RGB666)
-            LCD_Data(RGB666_BG[0]);          /* R6 */
-            LCD_Data(RGB666_BG[1]);          /* G6 */
-            LCD_Data(RGB666_BG[2]);          /* B6 */
-            #endif
+            LCD_PixelRun(Offset, Level, Run);   /* send pending run */
+            Level ^= 1;                         /* toggle level */
+            Run = 0;                            /* reset counter */
           }
 
+          Run++;                                /* one more pixel */
+
           n--;                          /* next pixel */
 
           if (n % SYMBOL_RESIZE == 0)   /* for every resize step */
@@ -1542,6 +2107,9 @@ void LCD_Symbol(uint8_t ID)
     }              
   }
 
+  /* send last run of pixels */
+  LCD_PixelRun(Offset, Level, Run);
+
   /* mark text lines as used */
   n = LCD_SYMBOL_CHAR_Y;           /* set line counter */
   x = UI.SymbolPos_Y;              /* start line */
@@ -1570,7 +2138,6 @@ void LCD_Symbol(uint8_t ID)
 void LCD_Box(uint16_t Color)
 {
   uint16_t          x_Size;             /* x size */
-  uint16_t          x;                  /* x counter */
   uint16_t          y_Size;             /* y size/counter */
 
   LCD_AddressWindow();             /* set address window */
@@ -1580,29 +2147,20 @@ void LCD_Box(uint16_t Color)
   y_Size = Y_End - Y_Start + 1;
 
   #ifdef COLORMODE_RGB666
-  /* convert RGB565 color to RGB666 */ 
-  RGB565_2_RGB666(Color, &RGB666_FG[0]);
+  /* convert RGB565 color to RGB666 (cached) */
+  RGB666_SetPen(Color);
   #endif
 
   LCD_Cmd(CMD_MEM_WRITE);          /* start writing */
 
   while (y_Size > 0)               /* loop trough rows */
   {
-    x = x_Size;                    /* reset counter */    
-
-    while (x > 0)                  /* loop through columns */
-    {
-      /* send box color */
-      #if defined (COLORMODE_RGB565)
-      LCD_Data2(Color);            /* RGB565 */
-      #elif defined (COLORMODE_RGB666)
-      LCD_Data(RGB666_FG[0]);      /* R6 */
-      LCD_Data(RGB666_FG[1]);      /* G6 */
-      LCD_Data(RGB666_FG[2]);      /* B6 */
-      #endif
-
-      x--;                         /* next one */
-    }
+    /* send box color for all columns */
+    #if defined (COLORMODE_RGB565)
+    LCD_Data2_Run(Color, x_Size);             /* RGB565 */
+    #elif defined (COLORMODE_RGB666)
+    LCD_Data3_Run(&RGB666_FG[0], x_Size);     /* RGB666 */
+    #endif
 
     y_Size--;                      /* next one */
   }
@@ -138,6 +138,11 @@
 #define LCD_CHAR_X            (LCD_PIXELS_X / FONT_SIZE_X)
 #define LCD_CHAR_Y            (LCD_PIXELS_Y / FONT_SIZE_Y)
 
+/* hardware scrolling: area of complete text lines */
+#ifdef UI_HW_SCROLL
+  #define LCD_SCROLL_AREA     (LCD_CHAR_Y * FONT_SIZE_Y)
+#endif
+
 /* component symbols */
 #ifdef SW_SYMBOLS
   /* resize symbols by a factor of 2 */
@@ -176,11 +181,21 @@ uint16_t            Y_End;         /* end position Y (page/row) */
 
 /* text line management */
 uint16_t            LineFlags;     /* bitfield for up to 16 lines */
+#ifdef UI_HW_SCROLL
+uint16_t            ScrollOffset;  /* vertical scrolling offset (rows) */
+#endif
 
 #ifdef COLORMODE_RGB666
 /* colors in RGB666 8-bit frame format */
 uint8_t             RGB666_FG[3];       /* foreground/pen color */
 uint8_t             RGB666_BG[3];       /* background color */
+uint16_t            RGB666_Pen;         /* RGB565 color of RGB666_FG */
+#endif
+
+#ifdef FONT_CACHE
+/* font cache */
+uint8_t             FontCache[FONT_CACHE_CHARS][FONT_BYTES_N];   /* glyph bitmaps */
+uint8_t             FontCacheID[FONT_CACHE_CHARS];     /* font index of glyphs */
 #endif
 
 
@@ -352,6 +367,37 @@ void LCD_Data2(uint16_t Data)
   #endif
 }
 
+
+
+/*
+ *  send a 3-byte value repeatedly to the display
+ *  - for RGB666 pixel data in 8-bit frame format
+ *  - selects chip and data mode just once for all repetitions
+ *
+ *  requires:
+ *  - Data: pointer to array of 3 bytes
+ *  - Count: number of repetitions
+ */
+
+void LCD_Data3_Run(uint8_t *Data, uint16_t Count)
+{
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
+
+  #ifdef LCD_CS
+  /* select chip */
+  LCD_PORT &= ~(1 << LCD_CS);      /* set /CSX low */
+  #endif
+
+  /* send data: 3 bytes */
+  SPI_Write_Repeat(Data, 3, Count);
+
+  #ifdef LCD_CS
+  /* deselect chip */
+  LCD_PORT |= (1 << LCD_CS);       /* set /CSX high */
+  #endif
+}
+
 #endif
 
 
@@ -557,6 +603,118 @@ void LCD_Data2(uint16_t Data)
 
 
 
+/*
+ *  send a 2-byte value repeatedly to the display
+ *  - selects chip and data mode just once for all repetitions
+ *
+ *  requires:
+ *  - Data: 2-byte value to send
+ *  - Count: number of repetitions
+ */
+
+void LCD_Data2_Run(uint16_t Data, uint16_t Count)
+{
+  uint8_t           Byte;     /* data byte */
+  #ifdef LCD_FAST_WRITE
+  uint8_t           WR_High;  /* port state: WRX high */
+  uint8_t           WR_Low;   /* port state: WRX low */
+  #endif
+
+  #ifdef LCD_CS
+  /* select chip */
+  LCD_PORT &= ~(1 << LCD_CS);      /* set /CSX low */
+  #endif
+
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
+
+  /* send data */
+  Byte = (uint8_t)Data;            /* save LSB */
+  Data >>= 8;                      /* get MSB */
+
+  #ifdef LCD_FAST_WRITE
+  /*
+   *  write strobe by writing the complete port with precalculated
+   *  levels (2 cycles instead of 2x read-modify-write)
+   *  - other pins of LCD_PORT keep their state during the run
+   */
+
+  WR_High = LCD_PORT | (1 << LCD_WR);   /* WRX high */
+  WR_Low = WR_High & ~(1 << LCD_WR);    /* WRX low */
+
+  /* write strobe: set WRX low and high again */
+  #define WR_STROBE()     LCD_PORT = WR_Low; LCD_PORT = WR_High
+
+  /* single pixel: MSB and LSB */
+  #define WR_PIXEL()      LCD_PORT2 = (uint8_t)Data; WR_STROBE(); \
+                          LCD_PORT2 = Byte; WR_STROBE()
+
+  if ((uint8_t)Data == Byte)       /* same MSB and LSB */
+  {
+    /* data signals stay the same, just create write strobes */
+    LCD_PORT2 = Byte;              /* DB0-7 */
+
+    while (Count >= 4)             /* 4 pixels per loop run */
+    {
+      WR_STROBE(); WR_STROBE();
+      WR_STROBE(); WR_STROBE();
+      WR_STROBE(); WR_STROBE();
+      WR_STROBE(); WR_STROBE();
+      Count -= 4;                  /* next ones */
+    }
+
+    while (Count > 0)              /* remaining pixels */
+    {
+      WR_STROBE(); WR_STROBE();
+      Count--;                     /* next one */
+    }
+  }
+  else                             /* different MSB and LSB */
+  {
+    while (Count >= 4)             /* 4 pixels per loop run */
+    {
+      WR_PIXEL();
+      WR_PIXEL();
+      WR_PIXEL();
+      WR_PIXEL();
+      Count -= 4;                  /* next ones */
+    }
+
+    while (Count > 0)              /* remaining pixels */
+    {
+      WR_PIXEL();
+      Count--;                     /* next one */
+    }
+  }
+
+  #undef WR_PIXEL
+  #undef WR_STROBE
+
+  #else
+  while (Count > 0)                /* repeat value */
+  {
+    /* MSB: set data signals and create write strobe */
+    LCD_PORT2 = (uint8_t)Data;     /* DB0-7 */
+    LCD_PORT &= ~(1 << LCD_WR);    /* set WRX low */
+    LCD_PORT |= (1 << LCD_WR);     /* set WRX high */
+
+    /* LSB: set data signals and create write strobe */
+    LCD_PORT2 = Byte;              /* DB0-7 */
+    LCD_PORT &= ~(1 << LCD_WR);    /* set WRX low */
+    LCD_PORT |= (1 << LCD_WR);     /* set WRX high */
+
+    Count--;                       /* next one */
+  }
+  #endif
+
+  #ifdef LCD_CS
+  /* deselect chip */
+  LCD_PORT |= (1 << LCD_CS);       /* set /CSX high */
+  #endif
+}
+
+
+
 #if 0
 
 /*
@@ -831,6 +989,50 @@ void LCD_Data2(uint16_t Data)
   #endif
 }
 
+
+
+/*
+ *  send a 2-byte value repeatedly to the display
+ *  - selects chip and data mode just once for all repetitions
+ *
+ *  requires:
+ *  - Data: 2-byte value to send
+ *  - Count: number of repetitions
+ */
+
+void LCD_Data2_Run(uint16_t Data, uint16_t Count)
+{
+  #ifdef LCD_CS
+  /* select chip */
+  LCD_PORT &= ~(1 << LCD_CS);      /* set /CSX low */
+  #endif
+
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
+
+  /* set data signals */
+  LCD_PORT2 = (uint8_t)Data;       /* set LSB (DB0-7) */
+  Data >>= 8;                      /* get MSB */
+  LCD_PORT3 = (uint8_t)Data;       /* set MSB (DB8-15) */
+
+  while (Count > 0)                /* repeat value */
+  {
+    /* create write strobe (rising edge takes data in) */
+    LCD_PORT &= ~(1 << LCD_WR);    /* set WRX low */
+                                   /* wait 15ns */
+    LCD_PORT |= (1 << LCD_WR);     /* set WRX high */
+    Count--;                       /* next one */
+  }
+
+  /* data hold time 10ns */
+  /* next write cycle after 15ns WRX being high */
+
+  #ifdef LCD_CS
+  /* deselect chip */
+  LCD_PORT |= (1 << LCD_CS);       /* set /CSX high */
+  #endif
+}
+
 #endif
 
 
@@ -926,6 +1128,25 @@ void RGB565_2_RGB666(uint16_t Color, uint8_t *RGB666)
   *RGB666 = B6;               /* blue */
 }
 
+
+
+/*
+ *  set pen color for RGB666
+ *  - converts color only when it differs from the cached one
+ *
+ *  requires:
+ *  - Color: RGB565 color value
+ */
+
+void RGB666_SetPen(uint16_t Color)
+{
+  if (Color != RGB666_Pen)         /* color changed */
+  {
+    RGB565_2_RGB666(Color, &RGB666_FG[0]);   /* convert color */
+    RGB666_Pen = Color;                      /* update cache */
+  }
+}
+
 #endif
 
 
@@ -994,6 +1215,19 @@ void LCD_CharPos(uint8_t x, uint8_t y)
   /* vertical position (page) */
   Mask = y;                   /* expand to 16 bit */
   Mask *= FONT_SIZE_Y;        /* offset for character */
+
+  #ifdef UI_HW_SCROLL
+  /* text lines within scrolling area */
+  if (y < LCD_CHAR_Y)
+  {
+    Mask += ScrollOffset;               /* add scrolling offset */
+    if (Mask >= LCD_SCROLL_AREA)        /* wrap around */
+    {
+      Mask -= LCD_SCROLL_AREA;
+    }
+  }
+  #endif
+
   Y_Start = Mask;             /* update start position */
 }
 
@@ -1057,30 +1291,18 @@ void LCD_ClearLine(uint8_t Line)
 
   LCD_AddressWindow();                  /* set window */
 
-  #ifdef COLORMODE_RGB666
-  /* convert RGB565 color to RGB666 */ 
-  RGB565_2_RGB666(COLOR_BACKGROUND, &RGB666_BG[0]);
-  #endif
-
   /* clear all pixels in window */
   LCD_Cmd(CMD_MEM_WRITE);          /* start writing */
 
   while (y > 0)                    /* character height (pages) */
   {
     x = X_Start;                   /* reset start position */
-    while (x < LCD_PIXELS_X)       /* all columns */
-    {
-      /* send background color */
-      #if defined (COLORMODE_RGB565)
-      LCD_Data2(COLOR_BACKGROUND);      /* RGB565 */
-      #elif defined (COLORMODE_RGB666)
-      LCD_Data(RGB666_BG[0]);           /* R6 */
-      LCD_Data(RGB666_BG[1]);           /* G6 */
-      LCD_Data(RGB666_BG[2]);           /* B6 */
-      #endif
-
-      x++;                              /* next column */
-    }
+    /* send background color for all columns */
+    #if defined (COLORMODE_RGB565)
+    LCD_Data2_Run(COLOR_BACKGROUND, LCD_PIXELS_X - x);   /* RGB565 */
+    #elif defined (COLORMODE_RGB666)
+    LCD_Data3_Run(&RGB666_BG[0], LCD_PIXELS_X - x);      /* RGB666 */
+    #endif
 
     y--;                           /* next page */
   }
@@ -1096,6 +1318,13 @@ void LCD_Clear(void)
 {
   uint8_t           n = 1;         /* counter */
 
+  #ifdef UI_HW_SCROLL
+  /* reset scrolling */
+  ScrollOffset = 0;
+  LCD_Cmd(CMD_VSCROLL_ADDR);
+  LCD_Data2(0);                    /* start at first row */
+  #endif
+
   /* we have to clear all dots manually :-( */
   while (n <= (LCD_CHAR_Y + 1))    /* for all text lines */
   {
@@ -1110,6 +1339,112 @@ void LCD_Clear(void)
 
 
 
+#ifdef UI_HW_SCROLL
+
+/*
+ *  scroll text lines up by one line
+ *  - uses hardware vertical scrolling
+ *  - clears last text line and moves to it
+ */
+
+void LCD_Scroll(void)
+{
+  /* update scrolling offset */
+  ScrollOffset += FONT_SIZE_Y;          /* one text line */
+  if (ScrollOffset >= LCD_SCROLL_AREA)  /* wrap around */
+  {
+    ScrollOffset = 0;
+  }
+
+  /* set start of scrolling area */
+  LCD_Cmd(CMD_VSCROLL_ADDR);
+  LCD_Data2(ScrollOffset);
+
+  /* update line flags */
+  LineFlags >>= 1;                 /* lines moved up */
+  LineFlags |= 0x8000;             /* line 16 might have got line 17 */
+  #if LCD_CHAR_Y <= 16
+  LineFlags |= (1 << (LCD_CHAR_Y - 1));   /* last line has old first line */
+  #endif
+
+  /* clear last line */
+  LCD_ClearLine(LCD_CHAR_Y);       /* also moves to last line */
+  LCD_CharPos(1, LCD_CHAR_Y);      /* move to start of last line */
+}
+
+#endif
+
+
+
+#ifdef FONT_CACHE
+
+/*
+ *  load glyphs of digits, prefixes and units into font cache
+ *  - helper function for LCD_Init()
+ *  - glyphs are stored uncompressed
+ */
+
+void LCD_FontCache(void)
+{
+  uint8_t           *Table;        /* pointer to table */
+  uint8_t           *Cache;        /* pointer to cache */
+  uint8_t           Slot = 0;      /* cache slot */
+  uint8_t           Index;         /* font index */
+  #ifdef FONT_RLE
+  uint8_t           y;             /* bitmap y byte counter */
+  uint8_t           n;             /* byte counter */
+  #endif
+
+  while (Slot < FONT_CACHE_CHARS)
+  {
+    /* get font index number of character */
+    Index = DATA_read_byte(&FontCache_table[Slot]);    /* get character */
+    Table = (uint8_t *)&FontTable;      /* start address */
+    Table += Index;                     /* add offset for character */
+    Index = pgm_read_byte(Table);       /* get index number */
+    FontCacheID[Slot] = Index;          /* 0xff for no bitmap */
+    Cache = &FontCache[Slot][0];        /* address of cache slot */
+
+    if (Index != 0xff)                  /* character bitmap available */
+    {
+      Table = (uint8_t *)&FontData;     /* start address of font data */
+
+      #ifdef FONT_RLE
+      Table += pgm_read_word(&FontIndex[Index]);   /* address of character */
+      Bitmap_Start(Table, Cache, FONT_BYTES_X);    /* start decoder */
+      y = FONT_BYTES_Y;
+      while (y > 0)
+      {
+        Bitmap_Row(Cache, FONT_BYTES_X);      /* decode row */
+        y--;                                  /* next row */
+
+        if (y > 0)                     /* not last row */
+        {
+          /* copy row as base for next row */
+          n = 0;
+          while (n < FONT_BYTES_X)
+          {
+            Cache[FONT_BYTES_X + n] = Cache[n];
+            n++;
+          }
+        }
+
+        Cache += FONT_BYTES_X;         /* next row */
+      }
+      #else
+      Table += FONT_BYTES_N * Index;    /* address of character */
+      memcpy_P(Cache, Table, FONT_BYTES_N);     /* copy bitmap */
+      #endif
+    }
+
+    Slot++;                             /* next slot */
+  }
+}
+
+#endif
+
+
+
 /*
  *  initialize LCD
  */
@@ -1201,6 +1536,15 @@ void LCD_Init(void)
   #endif
   LCD_Data(Bits);                  /* send parameter bits */
 
+  #ifdef UI_HW_SCROLL
+  /* vertical scrolling area: complete text lines */
+  LCD_Cmd(CMD_V_SCROLL_DEF);
+  LCD_Data2(0);                              /* no top fixed area */
+  LCD_Data2(LCD_SCROLL_AREA);                /* scrolling area */
+  LCD_Data2(LCD_PIXELS_Y - LCD_SCROLL_AREA); /* bottom fixed area */
+  ScrollOffset = 0;
+  #endif
+
   /* address window */
   X_Start = 0;
   X_End = LCD_PIXELS_X - 1;
@@ -1226,6 +1570,17 @@ void LCD_Init(void)
   UI.SymbolSize_Y = LCD_SYMBOL_CHAR_Y;  /* y size in chars */
   #endif
 
+  #ifdef FONT_CACHE
+  LCD_FontCache();                 /* load font cache */
+  #endif
+
+  #ifdef COLORMODE_RGB666
+  /* init RGB666 colors */
+  RGB565_2_RGB666(COLOR_BACKGROUND, &RGB666_BG[0]);  /* fixed background */
+  RGB565_2_RGB666(COLOR_PEN, &RGB666_FG[0]);         /* default pen */
+  RGB666_Pen = COLOR_PEN;
+  #endif
+
   /* init character stuff */
   LineFlags = 0xffff;              /* clear all lines by default */
   LCD_CharPos(1, 1);               /* reset character position */
@@ -1238,6 +1593,40 @@ void LCD_Init(void)
 
 
 
+/*
+ *  send a run of pixels in pen or background color
+ *  - helper function for LCD_Char() and LCD_Symbol()
+ *  - RGB666: expects pen and background color in RGB666_FG and RGB666_BG
+ *
+ *  requires:
+ *  - Color: pen color (RGB565)
+ *  - Level: 0 for background color, 1 for pen color
+ *  - Count: number of pixels
+ */
+
+void LCD_PixelRun(uint16_t Color, uint8_t Level, uint16_t Count)
+{
+  #if defined (COLORMODE_RGB565)
+  if (Level == 0)                  /* background */
+  {
+    Color = COLOR_BACKGROUND;      /* use background color */
+  }
+
+  LCD_Data2_Run(Color, Count);     /* send pixels */
+  #elif defined (COLORMODE_RGB666)
+  if (Level == 0)                  /* background */
+  {
+    LCD_Data3_Run(&RGB666_BG[0], Count);     /* send pixels */
+  }
+  else                             /* pen */
+  {
+    LCD_Data3_Run(&RGB666_FG[0], Count);     /* send pixels */
+  }
+  #endif
+}
+
+
+
 /*
  *  display a single character
  *
@@ -1255,6 +1644,14 @@ void LCD_Char(unsigned char Char)
   uint8_t           y = 1;         /* bitmap y byte counter */
   uint8_t           Bits;          /* number of bits to be sent */
   uint8_t           n;             /* bitmap bit counter */
+  uint8_t           Level = 0;     /* pixel level of current run */
+  uint16_t          Run = 0;       /* number of pixels in current run */
+  #ifdef FONT_RLE
+  uint8_t           RowBuffer[FONT_BYTES_X];     /* decoded row */
+  #endif
+  #ifdef FONT_CACHE
+  uint8_t           Cached = 0;    /* glyph in font cache */
+  #endif
 
   /* prevent x overflow */
   if (UI.CharPos_X > LCD_CHAR_X) return;
@@ -1265,10 +1662,38 @@ void LCD_Char(unsigned char Char)
   Index = pgm_read_byte(Table);         /* get index number */
   if (Index == 0xff) return;            /* no character bitmap available */
 
+  #ifdef FONT_CACHE
+  /* check font cache */
+  n = 0;
+  while (n < FONT_CACHE_CHARS)
+  {
+    if (FontCacheID[n] == Index)       /* glyph cached */
+    {
+      Table = &FontCache[n][0];        /* read bitmap from RAM */
+      Cached = 1;
+      break;
+    }
+    n++;                               /* next slot */
+  }
+
+  if (Cached == 0)                     /* not cached */
+  {
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&FontData;        /* start address of font data */
+  #ifdef FONT_RLE
+  Offset = pgm_read_word(&FontIndex[Index]);  /* offset for character */
+  Table += Offset;                     /* address of character data */
+  Bitmap_Start(Table, RowBuffer, FONT_BYTES_X);     /* start decoder */
+  #else
   Offset = FONT_BYTES_N * Index;       /* offset for character */
   Table += Offset;                     /* address of character data */
+  #endif
+
+  #ifdef FONT_CACHE
+  }
+  #endif
 
   /* LCD's address window */
   LCD_CharPos(UI.CharPos_X, UI.CharPos_Y);   /* update character position */
@@ -1286,9 +1711,8 @@ void LCD_Char(unsigned char Char)
   #endif
 
   #ifdef COLORMODE_RGB666
-  /* convert RGB565 colors to RGB666 */ 
-  RGB565_2_RGB666(COLOR_BACKGROUND, &RGB666_BG[0]);
-  RGB565_2_RGB666(Offset, &RGB666_FG[0]);
+  /* convert RGB565 pen color to RGB666 (cached) */
+  RGB666_SetPen(Offset);
   #endif
 
   LCD_Cmd(CMD_MEM_WRITE);              /* start writing */
@@ -1296,6 +1720,15 @@ void LCD_Char(unsigned char Char)
   /* read character bitmap and send it to display */
   while (y <= FONT_BYTES_Y)
   {
+    #ifdef FONT_RLE
+    #ifdef FONT_CACHE
+    if (Cached == 0)                    /* compressed bitmap */
+    #endif
+    {
+      Bitmap_Row(RowBuffer, FONT_BYTES_X);   /* decode next row */
+      Table = RowBuffer;                /* read row from buffer */
+    }
+    #endif
     Pixels = FONT_SIZE_X;               /* track x bits to be sent */
     x = 1;                              /* reset counter */
 
@@ -1313,35 +1746,28 @@ void LCD_Char(unsigned char Char)
       }
       Pixels -= Bits;              /* update counter */
 
+      #if defined (FONT_RLE)
+      Index = *Table;                   /* read byte from buffer */
+      #elif defined (FONT_CACHE)
+      if (Cached) Index = *Table;       /* read byte from cache */
+      else Index = pgm_read_byte(Table);     /* read byte */
+      #else
       Index = pgm_read_byte(Table);     /* read byte */
+      #endif
 
       /* send color for each bit */
       n = Bits;
       while (n > 0)
       {
-        if (Index & 0b00000001)         /* bit set */
-        {
-          /* send foreground/pen color */
-          #if defined (COLORMODE_RGB565)
-          LCD_Data2(Offset);            /* RGB565 */
-          #elif defined (COLORMODE_RGB666)
-          LCD_Data(RGB666_FG[0]);       /* R6 */
-          LCD_Data(RGB666_FG[1]);       /* G6 */
-          LCD_Data(RGB666_FG[2]);       /* B6 */
-          #endif
-        }
-        else                            /* bit unset */
+        if ((Index & 0b00000001) != Level)   /* pixel level changes */
         {
-          /* send background color */
-          #if defined (COLORMODE_RGB565)
-          LCD_Data2(COLOR_BACKGROUND);  /* RGB565 */
-          #elif defined (COLORMODE_RGB666)
-          LCD_Data(RGB666_BG[0]);       /* R6 */
-          LCD_Data(RGB666_BG[1]);       /* G6 */
-          LCD_Data(RGB666_BG[2]);       /* B6 */
-          #endif
+          LCD_PixelRun(Offset, Level, Run);   /* send pending run */
+          Level ^= 1;                         /* toggle level */
+          Run = 0;                            /* reset counter */
         }
 
+        Run++;                                /* one more pixel */
+
         Index >>= 1;                      /* shift byte for next bit */
         n--;                              /* next bit */
       }
@@ -1353,6 +1779,9 @@ void LCD_Char(unsigned char Char)
     y++;                                /* next row */
   }
 
+  /* send last run of pixels */
+  LCD_PixelRun(Offset, Level, Run);
+
   UI.CharPos_X++;             /* update character position */
 }
 
@@ -1408,12 +1837,23 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           y = 1;         /* bitmap y byte counter */
   uint8_t           Bits;          /* number of bits to be sent */
   uint8_t           n;             /* bitmap bit counter */
+  uint8_t           Level = 0;     /* pixel level of current run */
+  uint16_t          Run = 0;       /* number of pixels in current run */
   uint8_t           Factor = SYMBOL_RESIZE;  /* resize factor */
+  #ifdef SYMBOLS_RLE
+  uint8_t           RowBuffer[SYMBOL_BYTES_X];   /* decoded row */
+  #endif
 
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
+  #ifdef SYMBOLS_RLE
+  Offset = pgm_read_word(&SymbolIndex[ID]);  /* offset for symbol */
+  Table += Offset;                      /* address of symbol data */
+  Bitmap_Start(Table, RowBuffer, SYMBOL_BYTES_X);   /* start decoder */
+  #else
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
   Table += Offset;                      /* address of symbol data */
+  #endif
 
   /* LCD's address window */
   LCD_CharPos(UI.CharPos_X, UI.CharPos_Y);   /* update character position */
@@ -1431,9 +1871,8 @@ void LCD_Symbol(uint8_t ID)
   #endif
 
   #ifdef COLORMODE_RGB666
-  /* convert RGB565 colors to RGB666 */ 
-  RGB565_2_RGB666(COLOR_BACKGROUND, &RGB666_BG[0]);
-  RGB565_2_RGB666(Offset, &RGB666_FG[0]);
+  /* convert RGB565 pen color to RGB666 (cached) */
+  RGB666_SetPen(Offset);
   #endif
 
   LCD_Cmd(CMD_MEM_WRITE);               /* start writing */
@@ -1441,6 +1880,10 @@ void LCD_Symbol(uint8_t ID)
   /* read character bitmap and send it to display */
   while (y <= SYMBOL_BYTES_Y)
   {
+    #ifdef SYMBOLS_RLE
+    Bitmap_Row(RowBuffer, SYMBOL_BYTES_X);   /* decode next row */
+    Table = RowBuffer;        /* read row from buffer */
+    #endif
     Table2 = Table;           /* save current pointer */
 
     while (Factor > 0)        /* resize symbol */
@@ -1464,7 +1907,11 @@ void LCD_Symbol(uint8_t ID)
         }
         Pixels -= Bits;            /* update counter */
 
+        #ifdef SYMBOLS_RLE
+        Data = *Table;                  /* read byte from buffer */
+        #else
         Data = pgm_read_byte(Table);    /* read byte */
+        #endif
 
         /* send color for each bit */
         n = Bits;                       /* reset counter */
@@ -1472,29 +1919,15 @@ void LCD_Symbol(uint8_t ID)
 
         while (n > 0)                   /* x pixels */
         {
-          if (Data & 0b00000001)             /* bit set */
-          {
-            /* send foreground/pen color */
-            #if defined (COLORMODE_RGB565)
-            LCD_Data2(Offset);               /* RGB565 */
-            #elif defined (COLORMODE_RGB666)
-            LCD_Data(RGB666_FG[0]);          /* R6 */
-            LCD_Data(RGB666_FG[1]);          /* G6 */
-            LCD_Data(RGB666_FG[2]);          /* B6 */
-            #endif
-          }
-          else                               /* bit unset */
+          if ((Data & 0b00000001) != Level)   /* pixel level changes */
           {
-            /* send background color */
-            #if defined (COLORMODE_RGB565)
-            LCD_Data2(COLOR_BACKGROUND);     /* RGB565 */
-            #elif defined (COLORMODE_RGB666)
-            LCD_Data(RGB666_BG[0]);          /* R6 */
-            LCD_Data(RGB666_BG[1]);          /* G6 */
-            LCD_Data(RGB666_BG[2]);          /* B6 */
-            #endif
+            LCD_PixelRun(Offset, Level, Run);   /* send pending run */
+            Level ^= 1;                         /* toggle level */
+            Run = 0;                            /* reset counter */
           }
 
+          Run++;                                /* one more pixel */
+
           n--;                          /* next pixel */
 
           if (n % SYMBOL_RESIZE == 0)   /* for every resize step */
@@ -1518,6 +1951,9 @@ void LCD_Symbol(uint8_t ID)
     }              
   }
 
+  /* send last run of pixels */
+  LCD_PixelRun(Offset, Level, Run);
+
   /* mark text lines as used */
   n = LCD_SYMBOL_CHAR_Y;           /* set line counter */
   x = UI.SymbolPos_Y;              /* start line */
@@ -1546,7 +1982,6 @@ void LCD_Symbol(uint8_t ID)
 void LCD_Box(uint16_t Color)
 {
   uint16_t          x_Size;             /* x size */
-  uint16_t          x;                  /* x counter */
   uint16_t          y_Size;             /* y size/counter */
 
   LCD_AddressWindow();             /* set address window */
@@ -1556,29 +1991,20 @@ void LCD_Box(uint16_t Color)
   y_Size = Y_End - Y_Start + 1;
 
   #ifdef COLORMODE_RGB666
-  /* convert RGB565 color to RGB666 */ 
-  RGB565_2_RGB666(Color, &RGB666_FG[0]);
+  /* convert RGB565 color to RGB666 (cached) */
+  RGB666_SetPen(Color);
   #endif
 
   LCD_Cmd(CMD_MEM_WRITE);          /* start writing */
 
   while (y_Size > 0)               /* loop trough rows */
   {
-    x = x_Size;                    /* reset counter */    
-
-    while (x > 0)                  /* loop through columns */
-    {
-      /* send box color */
-      #if defined (COLORMODE_RGB565)
-      LCD_Data2(Color);            /* RGB565 */
-      #elif defined (COLORMODE_RGB666)
-      LCD_Data(RGB666_FG[0]);      /* R6 */
-      LCD_Data(RGB666_FG[1]);      /* G6 */
-      LCD_Data(RGB666_FG[2]);      /* B6 */
-      #endif
-
-      x--;                         /* next one */
-    }
+    /* send box color for all columns */
+    #if defined (COLORMODE_RGB565)
+    LCD_Data2_Run(Color, x_Size);             /* RGB565 */
+    #elif defined (COLORMODE_RGB666)
+    LCD_Data3_Run(&RGB666_FG[0], x_Size);     /* RGB666 */
+    #endif
 
     y_Size--;                      /* next one */
   }
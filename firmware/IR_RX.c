@@ -47,15 +47,78 @@
 #define IR_THOMAS        0b00000010     /* Thomas bit encoding */
 #define IR_PRE_PAUSE     0b00000100     /* heading pause */
 
-/* timing control flags (bitfield) */
-#define IR_STD_TOLER     0b00000000     /* use default tolerance */
-#define IR_RELAX_SHORT   0b00000001     /* relax short pulses */
-#define IR_RELAX_LONG    0b00000010     /* relax long pulses */
-
 /* signal types */
 #define IR_PAUSE         0b00000001     /* pause */
 #define IR_PULSE         0b00000010     /* pulse */
 
+#ifdef SW_IR_RX_PCINT
+
+/* edge capture states */
+#define IR_RX_IDLE                1     /* wait for packet */
+#define IR_RX_SAMPLE              2     /* capture packet */
+#define IR_RX_DONE                3     /* packet complete */
+
+/* data pin and its PCINT# */
+#ifdef SW_IR_RECEIVER
+  /* IR receiver connected to probes */
+  #define REG_IR_PIN     ADC_PIN
+  #if defined (SW_IR_RX_PINOUT_G_V_D)
+    /* pinout variant: 1 - Gnd / 2 - Vcc / 3 - Data */
+    #define BIT_IR_DATA  TP3
+  #else
+    /* pinout variants: 1 - Data / ... */
+    #define BIT_IR_DATA  TP1
+  #endif
+  #define IR_PCINT_PIN   (ADC_PCINT + BIT_IR_DATA)
+#else
+  /* fixed IR receiver */
+  #define REG_IR_PIN     IR_PIN
+  #define BIT_IR_DATA    IR_DATA
+  #define IR_PCINT_PIN   IR_PCINT
+#endif
+
+/* pin change interrupt bank */
+#define BIT_PC_PIN       (IR_PCINT_PIN % 8)  /* bit in mask register */
+
+/* PCINT0-7 */
+#if (IR_PCINT_PIN >= 0) && (IR_PCINT_PIN <= 7)
+  #define BIT_PC_IRQ     PCIE0          /* Pin Change Interrupt Enable 0 */
+  #define BIT_PC_FLAG    PCIF0          /* Pin Change Interrupt Flag 0 */
+  #define REG_PC_MASK    PCMSK0         /* Pin Change Mask Register 0 */
+  #define ISR_PINCHANGE  PCINT0_vect    /* ISR */
+#endif
+
+/* PCINT8-15 */
+#if (IR_PCINT_PIN >= 8) && (IR_PCINT_PIN <= 15)
+  #define BIT_PC_IRQ     PCIE1          /* Pin Change Interrupt Enable 1 */
+  #define BIT_PC_FLAG    PCIF1          /* Pin Change Interrupt Flag 1 */
+  #define REG_PC_MASK    PCMSK1         /* Pin Change Mask Register 1 */
+  #define ISR_PINCHANGE  PCINT1_vect    /* ISR */
+#endif
+
+/* PCINT16-23 */
+#if (IR_PCINT_PIN >= 16) && (IR_PCINT_PIN <= 23)
+  #define BIT_PC_IRQ     PCIE2          /* Pin Change Interrupt Enable 2 */
+  #define BIT_PC_FLAG    PCIF2          /* Pin Change Interrupt Flag 2 */
+  #define REG_PC_MASK    PCMSK2         /* Pin Change Mask Register 2 */
+  #define ISR_PINCHANGE  PCINT2_vect    /* ISR */
+#endif
+
+/* PCINT24-31 */
+#if (IR_PCINT_PIN >= 24) && (IR_PCINT_PIN <= 31)
+  #define BIT_PC_IRQ     PCIE3          /* Pin Change Interrupt Enable 3 */
+  #define BIT_PC_FLAG    PCIF3          /* Pin Change Interrupt Flag 3 */
+  #define REG_PC_MASK    PCMSK3         /* Pin Change Mask Register 3 */
+  #define ISR_PINCHANGE  PCINT3_vect    /* ISR */
+#endif
+
+/* bit-bang serial uses the same ISR */
+#if defined (SERIAL_BITBANG) && ((IR_PCINT_PIN / 8) == (SERIAL_PCINT / 8))
+  #error <<< IR receiver: bit-bang serial uses same PCINT bank! >>>
+#endif
+
+#endif
+
 
 /*
  *  local variables
@@ -67,6 +130,19 @@ uint8_t             IR_State = 0;            /* multi packet protocol state */
 /* multi packet data fields */
 uint8_t             IR_Data_1;               /* data field #1 */
 
+#ifdef SW_IR_LEARN
+/* learn */
+uint8_t             IR_LearnSlot = 0;        /* next slot */
+#endif
+
+#ifdef SW_IR_RX_PCINT
+/* edge capture */
+volatile uint8_t    IR_RxState = IR_RX_IDLE; /* capture state */
+volatile uint8_t    IR_RxPulses;             /* number of pauses/pulses */
+/* pause/pulse durations (in time stamp ticks), kept in scratch arena */
+#define IR_RxTicks          ((volatile uint16_t *)Scratch)
+#endif
+
 
 
 /* ************************************************************************
@@ -764,6 +840,8 @@ uint8_t GetBits(uint8_t StartBit, uint8_t Bits, uint8_t Mode)
 /*
  *  detect and decode IR protocol
  *  - uses IR_State to keep track of multi-packet protocols
+ *  - start pulse is classified via IR_StartPulse_table first,
+ *    protocol checks are run only for matching classes
  *
  *  requires:
  *  - pointer to array of pulse/pause duration data
@@ -782,6 +860,8 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
   uint8_t           Command;       /* RC command */
   uint8_t           Extras = 0;    /* RC extra stuff */
   uint8_t           Temp;          /* temporary value */
+  uint8_t           n;             /* counter */
+  uint16_t          Classes = 0;   /* start pulse classes (bitfield) */
 
   /* local constants for Flag */
   #define PROTO_UNKNOWN       0    /* unknown protocol */
@@ -806,6 +886,27 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
   Pulse++;                    /* second pulse (skip start pair) */
   PulsesLeft = Pulses - 2;    /* start pair done */
 
+  /* classify start pulse (table entries: reference, timing control, class) */
+  n = 0;
+  Temp = DATA_read_byte(&IR_StartPulse_table[0]);     /* first reference */
+  while (Temp)                /* until end of table */
+  {
+    if (PulseCheck(Time1, Temp, DATA_read_byte(&IR_StartPulse_table[n + 1])))
+    {
+      /* matching start pulse: add class */
+      Temp = DATA_read_byte(&IR_StartPulse_table[n + 2]);
+      Classes |= (1 << Temp);
+    }
+
+    n += 3;                   /* next entry */
+    Temp = DATA_read_byte(&IR_StartPulse_table[n]);   /* next reference */
+  }
+
+  if (Classes == 0)           /* unknown start pulse */
+  {
+    goto result;              /* skip protocol checks */
+  }
+
 
   /*
    *  NEC (PD6121/PD6122)
@@ -836,7 +937,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    *  - carrier 38kHz (455kHz/12), duty cycle 1/3
    */
 
-  if (PulseCheck(Time1, 179, IR_RELAX_LONG))      /* pulse 9ms */
+  if (Classes & (1 << IR_START_NEC))             /* pulse 9ms */
   {
     if (PulseCheck(Time2, 89, IR_RELAX_LONG))     /* pause 4.5ms */
     {
@@ -906,7 +1007,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    *  - code repeat delay is 60ms (start to start)
    */
 
-  if (PulseCheck(Time1, 162, IR_RELAX_LONG))      /* pulse 8ms */
+  if (Classes & (1 << IR_START_PROTON))          /* pulse 8ms */
   {
     if (PulseCheck(Time2, 80, IR_STD_TOLER))      /* pause 4ms */
     {
@@ -953,8 +1054,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    *      PDM: pulse 550s, pause 0:550s 1:1580s
    */
 
-  if ((PulseCheck(Time1, 168, IR_STD_TOLER)) ||   /* pulse 8.44ms */
-      (PulseCheck(Time1, 184, IR_RELAX_LONG)))    /* 9 - 9.5ms */
+  if (Classes & (1 << IR_START_JVC))    /* pulse 8.44ms or 9 - 9.5ms */
   {
     if (PulseCheck(Time2, 84, IR_STD_TOLER))      /* pause 4.22ms */
     {
@@ -1007,7 +1107,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    *  - repeat delay is 42.2ms (end to start)
    */
 
-  if (PulseCheck(Time1, 70, IR_STD_TOLER))        /* pulse 3.5ms */
+  if (Classes & (1 << IR_START_MATSUSHITA))      /* pulse 3.5ms */
   {
     /* Matsushita (Panasonic) */ 
     if (PulseCheck(Time2, 70, IR_STD_TOLER))      /* pause 3.5ms */
@@ -1105,7 +1205,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    */
 
   #ifdef SW_IR_RX_EXTRA
-  if (PulseCheck(Time1, 79, IR_RELAX_LONG))       /* pulse 4ms */
+  if (Classes & (1 << IR_START_RCA))             /* pulse 4ms */
   {
     if (PulseCheck(Time2, 79, IR_RELAX_LONG))     /* pause 4ms */
     {
@@ -1181,7 +1281,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    *  - carrier 31kHz, duty cycle 1/4
    */
 
-  if (PulseCheck(Time1, 11, IR_STD_TOLER))        /* pulse 512s */
+  if (Classes & (1 << IR_START_MOTOROLA))        /* pulse 512s */
   {
     if (PulseCheck(Time2, 52, IR_STD_TOLER))      /* pause 2560s */
     {
@@ -1284,7 +1384,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    */
 
   #ifdef SW_IR_RX_EXTRA
-  if (PulseCheck(Time1, 10, IR_STD_TOLER))        /* pulse 500s */
+  if (Classes & (1 << IR_START_THOMSON))         /* pulse 500s */
   {
     if ((PulseCheck(Time2, 40, IR_STD_TOLER)) ||  /* pause 2ms */
         (PulseCheck(Time2, 90, IR_STD_TOLER)))    /* pause 4.5ms */
@@ -1321,7 +1421,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    *  - repeat delay is 108ms (start to start)
    */
 
-  if (PulseCheck(Time1, 89, IR_STD_TOLER))        /* pulse 4.5ms */
+  if (Classes & (1 << IR_START_SAMSUNG))         /* pulse 4.5ms */
   {
     if (PulseCheck(Time2, 89, IR_STD_TOLER))      /* pause 4.5ms */
     {
@@ -1357,7 +1457,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    *    code delay is 45ms (start to start)
    */
 
-  if (PulseCheck(Time1, 48, IR_STD_TOLER))        /* pulse 2.4ms */
+  if (Classes & (1 << IR_START_SIRC))            /* pulse 2.4ms */
   {
     if (PulseCheck(Time2, 12, IR_STD_TOLER))      /* pause 600s */
     {
@@ -1448,7 +1548,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    */
 
   #ifdef SW_IR_RX_EXTRA
-  if (PulseCheck(Time1, 4, IR_STD_TOLER))         /* pulse 141s */
+  if (Classes & (1 << IR_START_RECS80))          /* pulse 141s */
   {
     if (PulseCheck(Time2, 149, IR_RELAX_LONG))    /* pause 7.6ms (for 1) */
     {
@@ -1517,7 +1617,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    *    - pulse 320s, pause 0=680s 1=1680s
    */
 
-  if (PulseCheck(Time1, 6, IR_STD_TOLER))    /* pulse 320s */
+  if (Classes & (1 << IR_START_SHARP))      /* pulse 320s */
   {
     /* pause 680s or 1680s */
     if ((PulseCheck(Time2, 14, IR_STD_TOLER)) ||
@@ -1584,7 +1684,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    *  - repeat delay is 114ms (start to start) or 89ms (end to start)
    */
 
-  if (PulseCheck(Time1, 17, IR_STD_TOLER))        /* pulse 889s */
+  if (Classes & (1 << IR_START_RC5))             /* pulse 889s */
   {
     if (PulseCheck(Time2, 17, IR_STD_TOLER))      /* pause 889s */
     {
@@ -1623,7 +1723,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    */
 
   #ifdef SW_IR_RX_EXTRA
-  if (PulseCheck(Time1, 22, IR_STD_TOLER))        /* pulse 1120s (for 1) */
+  if (Classes & (1 << IR_START_UPD1986C))        /* pulse 1120s (for 1) */
   {
     if (PulseCheck(Time2, 22, IR_STD_TOLER))      /* pause 1120s (for 0) */
     {
@@ -1663,7 +1763,7 @@ void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
    *  - delay between codes is 2.666ms (end to start)
    */
 
-  if (PulseCheck(Time1, 53, IR_STD_TOLER))        /* pulse 2664s */
+  if (Classes & (1 << IR_START_RC6))             /* pulse 2664s */
   {
     if (PulseCheck(Time2, 17, IR_STD_TOLER))      /* pause 888s */
     {
@@ -1773,6 +1873,110 @@ result:
 
 
 
+#ifdef SW_IR_LEARN
+
+/*
+ *  store raw pulse train in EEPROM (IR learn)
+ *  - uses next slot each time
+ *  - displays slot and number of pulses/pauses
+ *
+ *  requires:
+ *  - pointer to array of pulse/pause duration data
+ *  - number of pulses/pauses
+ */
+
+void IR_Learn_Save(uint8_t *PulseData, uint8_t Pulses)
+{
+  IR_Learn_Type     *Slot;              /* EEPROM address */
+
+  if (Pulses < 2) return;               /* no packet */
+
+  /* write durations first and number of pulses/pauses last */
+  Slot = (IR_Learn_Type *)&NV_IR_Learn[IR_LearnSlot];
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_EEPROM]++;   /* count EEPROM write */
+  #endif
+  eeprom_update_block(PulseData, &Slot->Data[0], Pulses);
+  eeprom_update_byte(&Slot->Pulses, Pulses);
+
+  /* display: Raw <slot>:<pulses> */
+  Display_NL_EEString_Space(IR_Raw_str);
+  Display_Char('0' + IR_LearnSlot);     /* slot */
+  Display_Colon();
+  Display_Value(Pulses, 0, 0);          /* pulses/pauses */
+
+  /* next slot */
+  IR_LearnSlot++;
+  if (IR_LearnSlot >= IR_LEARN_SLOTS)   /* overflow */
+  {
+    IR_LearnSlot = 0;                   /* start with first slot again */
+  }
+}
+
+#endif
+
+
+
+#ifdef SW_IR_RX_PCINT
+
+/*
+ *  ISR for pin change of IR data pin
+ *  - Timer1 (time stamp) is reset with each edge and provides
+ *    the duration of the last pause/pulse
+ *  - OCF1A signals a timeout since the last edge
+ */
+
+ISR(ISR_PINCHANGE, ISR_BLOCK)
+{
+  uint16_t          Ticks;              /* duration */
+  uint8_t           Timeout;            /* timeout flag */
+
+  /*
+   *  hints:
+   *  - the interrupt flag is cleared automatically
+   *  - all other interrupts are disabled
+   */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_PCINT]++;    /* count ISR call */
+  #endif
+
+  Ticks = TCNT1;                   /* get duration */
+  TCNT1 = 0;                       /* restart time stamp */
+  Timeout = TIFR1 & (1 << OCF1A);  /* get timeout flag */
+  TIFR1 = (1 << OCF1A);            /* clear timeout flag */
+
+  if (IR_RxState == IR_RX_IDLE)    /* wait for packet */
+  {
+    /* data logic is inverted by IR receiver */
+    if (! (REG_IR_PIN & (1 << BIT_IR_DATA)))  /* got IR signal */
+    {
+      IR_RxPulses = 0;             /* reset pulse counter */
+      IR_RxState = IR_RX_SAMPLE;   /* start capturing */
+    }
+  }
+  else if (IR_RxState == IR_RX_SAMPLE)  /* capture packet */
+  {
+    if (Timeout)                   /* timeout missed by processing loop */
+    {
+      IR_RxState = IR_RX_DONE;     /* packet complete */
+    }
+    else if (IR_RxPulses < IR_MAX_PULSES)    /* prevent buffer overflow */
+    {
+      IR_RxTicks[IR_RxPulses] = Ticks;  /* save duration */
+      IR_RxPulses++;                    /* got another one */
+    }
+    else                           /* max number of pulses exceeded */
+    {
+      IR_RxState = IR_RX_DONE;     /* packet complete */
+    }
+  }
+}
+
+#endif
+
+
+
 /*
  *  detect & decode IR remote control signals
  *  using a TSOP IR receiver module
@@ -1780,13 +1984,12 @@ result:
  *    probe #1  Gnd
  *    probe #2  Vs/+5V (limit current by Rl)
  *    probe #3  Out/Data (inverted)
+ *  - carrier measurement: alternatively a raw IR photodiode at the
+ *    frequency counter's input (detected by incoming carrier)
  */
 
 void IR_Detector(void)
 {
-  /* maximum number of pauses/pulses: 2 start + (2 * 48) data + 1 stop */
-  #define MAX_PULSES          100
-
   /* processing modes */
   #define MODE_WAIT           1         /* wait for next packet */
   #define MODE_SAMPLE         2         /* sample */
@@ -1795,13 +1998,40 @@ void IR_Detector(void)
 
   uint8_t           Run = MODE_WAIT;    /* loop control */
   uint8_t           Flag;               /* IR signal */
-  uint8_t           OldFlag = 0;        /* former IR signal */
-  uint8_t           Cycles;             /* delay loop */
   uint8_t           n;                  /* counter */
   uint8_t           Pulses = 0;         /* pulse counter */
+  #ifndef SW_IR_RX_PCINT
+  uint8_t           OldFlag = 0;        /* former IR signal */
+  uint8_t           Cycles;             /* delay loop */
   uint8_t           Period = 0;         /* pulse duration */
   uint8_t           *Pulse = NULL;      /* pointer to pulse data */
-  uint8_t           PulseData[MAX_PULSES];  /* pulse duration data */     
+    #ifdef SW_IR_RX_CARRIER
+    uint8_t         Carrier = 0;        /* raw IR signal at counter input */
+    uint8_t         Count;              /* Timer0 counter */
+    uint8_t         OldCount = 0;       /* former Timer0 counter */
+    uint8_t         Delta = 0;          /* edges in last sample period */
+    uint8_t         Burst = 0;          /* first burst state */
+    uint16_t        Edges = 0;          /* carrier edges in first burst */
+    uint16_t        Start = 0;          /* time stamp of first edges */
+    uint16_t        Last = 0;           /* time stamp of last edges */
+    uint16_t        Time;               /* time stamp */
+    uint16_t        Reads = 0;          /* samples of carrier level */
+    uint16_t        Highs = 0;          /* samples with high level */
+    uint32_t        Value;              /* temporary value */
+    #endif
+  #else
+  uint16_t          Ticks;              /* duration */
+  #endif
+  uint8_t           PulseData[IR_MAX_PULSES];  /* pulse duration data */     
+  #ifdef SW_IR_LEARN
+  uint8_t           LearnPulses = 0;    /* number of pulses of last packet */
+  uint8_t           LearnData[IR_MAX_PULSES];  /* last packet (raw) */
+  #endif
+
+  #ifdef SW_IR_RX_PCINT
+  /* buffer for edge capture */
+  if (Scratch_Acquire(SCRATCH_IR_RX) == NULL) return;
+  #endif
 
   ShortCircuit(0);                      /* make sure probes are not shorted */
 
@@ -1898,9 +2128,18 @@ void IR_Detector(void)
     IR_DDR &= ~(1 << IR_DATA);          /* clear bit for data pin */
   #endif
 
+  #ifdef SW_IR_RX_CARRIER
+  /* counter input: Timer0 counts rising edges of carrier */
+  COUNTER_DDR &= ~(1 << COUNTER_IN);    /* set to input mode */
+  TCCR0A = 0;                           /* normal mode */
+  TIMSK0 = 0;                           /* no interrupts */
+  TCNT0 = 0;                            /* reset counter */
+  TCCR0B = (1 << CS02) | (1 << CS01) | (1 << CS00);  /* clock by T0 */
+  #endif
+
   wait10ms();                           /* time to settle */
 
-  /* wait for IR receiver module or key press */
+  /* wait for IR receiver module, carrier or key press */
   n = 1;
   while (n)
   {
@@ -1925,6 +2164,10 @@ void IR_Detector(void)
     }
     else                           /* check test key */
     {
+      #ifdef SW_IR_RX_CARRIER
+      TCNT0 = 0;                        /* reset carrier counter */
+      #endif
+
       /* wait 100ms for key press */
       Flag = TestKey(100, CHECK_BAT);
       /* also delay for next loop run */
@@ -1934,6 +2177,13 @@ void IR_Detector(void)
         Run = 0;                        /* skip decoder loop */
         n = 0;                          /* end this loop */
       }
+      #ifdef SW_IR_RX_CARRIER
+      else if (TCNT0 >= 16)             /* carrier at counter input */
+      {
+        Carrier = 1;                    /* raw IR signal */
+        n = 0;                          /* end this loop */
+      }
+      #endif
     }
   }
 
@@ -1941,6 +2191,111 @@ void IR_Detector(void)
   LCD_CharPos(1, 1);               /* move to first line */
 
 
+  #ifdef SW_IR_RX_PCINT
+
+  /*
+   *  The pin change ISR logs the duration of each pulse and pause based
+   *  on Timer1's time stamp. A complete packet is converted into 50s
+   *  units for the decoder and the ISR is re-armed right away, so the
+   *  next packet is captured while the last one is decoded. A pulse/pause
+   *  exceeding 12ms triggers a timeout and won't be logged.
+   */
+
+  /* set up time stamp and pin change interrupt */
+  Timestamp_Start();                    /* start Timer1 */
+  OCR1A = TIMESTAMP_TICKS(12000);       /* timeout: 12ms */
+  IR_RxState = IR_RX_IDLE;              /* wait for packet */
+  REG_PC_MASK |= (1 << BIT_PC_PIN);     /* enable data pin */
+  PCIFR = (1 << BIT_PC_FLAG);           /* clear interrupt flag */
+  PCICR |= (1 << BIT_PC_IRQ);           /* enable pin change interrupt */
+
+  while (Run > 0)             /* processing loop */
+  {
+    if (IR_RxState == IR_RX_SAMPLE)     /* capturing packet */
+    {
+      cli();                            /* disable interrupts */
+
+      if (TIFR1 & (1 << OCF1A))         /* 12ms timeout */
+      {
+        if (REG_IR_PIN & (1 << BIT_IR_DATA))  /* pause */
+        {
+          IR_RxState = IR_RX_DONE;      /* packet complete */
+        }
+        else                            /* removed receiver module */
+        {
+          IR_RxState = IR_RX_IDLE;      /* discard packet */
+        }
+      }
+
+      sei();                            /* enable interrupts */
+    }
+
+    if (IR_RxState == IR_RX_DONE)       /* packet complete */
+    {
+      /*
+       *  convert durations into 50s units
+       *  - same as polling: units = (duration / 50s) - 1
+       *  - round to nearest unit
+       */
+
+      Pulses = IR_RxPulses;
+      n = 0;
+      while (n < Pulses)
+      {
+        Ticks = IR_RxTicks[n] + TIMESTAMP_TICKS(IR_SAMPLE_PERIOD / 2);
+        Ticks /= TIMESTAMP_TICKS(IR_SAMPLE_PERIOD);
+        if (Ticks > 0) Ticks--;         /* match polling */
+        if (Ticks > 241) Ticks = 241;   /* limit to timeout */
+        PulseData[n] = (uint8_t)Ticks;
+        #ifdef SW_IR_LEARN
+        LearnData[n] = (uint8_t)Ticks;  /* keep raw packet */
+        #endif
+        n++;
+      }
+      #ifdef SW_IR_LEARN
+      LearnPulses = Pulses;
+      #endif
+
+      IR_RxState = IR_RX_IDLE;          /* capture next packet */
+      IR_Decode(&PulseData[0], Pulses); /* try to decode */
+    }
+    else if (IR_RxState == IR_RX_IDLE)  /* waiting for packet */
+    {
+      /* check test button */
+      #ifdef SW_IR_LEARN
+      n = 0;                       /* reset counter */
+      #endif
+      while (!(BUTTON_PIN & (1 << TEST_BUTTON)))  /* key pressed */
+      {
+        MilliSleep(50);            /* take a nap */
+        Run = 0;                   /* end loop */
+        #ifdef SW_IR_LEARN
+        if (n < 255) n++;          /* count naps */
+        #endif
+      }
+      #ifdef INPUT_QUEUE
+      if (Run == 0) Key_Flush();   /* key press is processed already */
+      #endif
+
+      #ifdef SW_IR_LEARN
+      if (n >= 6)                  /* long key press (300ms) */
+      {
+        IR_Learn_Save(&LearnData[0], LearnPulses);    /* store last packet */
+        Run = MODE_WAIT;           /* keep running */
+      }
+      #endif
+    }
+
+    wdt_reset();                   /* reset watchdog */
+  }
+
+  /* clean up */
+  PCICR &= ~(1 << BIT_PC_IRQ);          /* disable pin change interrupt */
+  REG_PC_MASK &= ~(1 << BIT_PC_PIN);    /* disable data pin */
+  Timestamp_Stop();                     /* stop Timer1 */
+
+  #else
+
   /*
    *  adaptive sampling delay for 10s considering processing loop
    *  - processing loop needs about 24 MCU cycles (3s@8MHz)
@@ -1952,6 +2307,14 @@ void IR_Detector(void)
 
   Cycles = (uint8_t)(((MCU_CYCLES_PER_US * 10UL) - 24) / 4);
 
+  #ifdef SW_IR_RX_CARRIER
+  if (Carrier)                     /* raw IR signal */
+  {
+    Timestamp_Start();             /* start Timer1 */
+    OldCount = TCNT0;              /* current counter value */
+  }
+  #endif
+
 
   /*
    *  Since we deal with data pulses in the range of 0.5 up to 10ms,
@@ -1967,8 +2330,22 @@ void IR_Detector(void)
      *  - data logic is inverted by IR receiver
      *    High: no IR signal / pause
      *    Low: IR signal / pulse
+     *  - raw IR signal: carrier edges counted by Timer0 since the last
+     *    sample mean IR signal
      */
    
+    #ifdef SW_IR_RX_CARRIER
+    if (Carrier)                   /* raw IR signal at counter input */
+    {
+      Count = TCNT0;               /* get counter */
+      Delta = Count - OldCount;    /* edges since last sample */
+      OldCount = Count;            /* update counter */
+      Flag = (Delta == 0);         /* no edges: pause */
+    }
+    else                           /* IR receiver module */
+    {
+    #endif
+
     #ifdef SW_IR_RECEIVER
       /* IR receiver connected to probes */
       #if defined (SW_IR_RX_PINOUT_G_V_D)
@@ -1986,6 +2363,10 @@ void IR_Detector(void)
       Flag = IR_PIN & (1 << IR_DATA);        /* poll data pin */
     #endif
 
+    #ifdef SW_IR_RX_CARRIER
+    }
+    #endif
+
     /*
      *  control logic for sampling
      *  - wait for new packet and sample
@@ -2000,6 +2381,9 @@ void IR_Detector(void)
         Pulses = 0;                /* reset pulse counter */
         Period = 0;                /* reset duration */
         Pulse = &PulseData[0];     /* set start address */
+        #ifdef SW_IR_RX_CARRIER
+        Burst = 2;                 /* start of first burst */
+        #endif
       }
       else                    /* no IR signal */
       {
@@ -2026,7 +2410,7 @@ void IR_Detector(void)
       {
         OldFlag = Flag;       /* update flag */
 
-        if (Pulses < MAX_PULSES)   /* prevent buffer overflow */
+        if (Pulses < IR_MAX_PULSES)     /* prevent buffer overflow */
         {
           Pulses++;                /* got another one */
           *Pulse = Period;         /* save duration */
@@ -2046,7 +2430,48 @@ void IR_Detector(void)
 
     if (Run == MODE_SAMPLE)             /* sampling mode */
     {
+      #ifdef SW_IR_RX_CARRIER
+      /*
+       *  first burst of raw IR signal
+       *  - count carrier edges between the time stamps of the first and
+       *    the last sample with edges
+       *  - sample carrier level for duty cycle instead of just waiting
+       */
+
+      if (Burst && !Flag)          /* within first burst */
+      {
+        Time = TCNT1;              /* get time stamp */
+
+        if (Burst == 2)            /* start of burst */
+        {
+          Start = Time;            /* first time stamp */
+          Edges = 0;               /* reset counters */
+          Reads = 0;
+          Highs = 0;
+          Burst = 1;               /* burst runs */
+        }
+        else                       /* burst runs */
+        {
+          Edges += Delta;          /* add edges */
+        }
+
+        Last = Time;               /* last time stamp */
+
+        /* sample carrier level for 40s */
+        while ((uint16_t)(TCNT1 - Time) < TIMESTAMP_TICKS(40))
+        {
+          Reads++;                           /* another sample */
+          if (COUNTER_PIN & (1 << COUNTER_IN)) Highs++;  /* high level */
+        }
+      }
+      else                         /* normal sampling */
+      {
+        Burst = 0;                 /* end of first burst */
+        wait40us();                /* wait sampling period */
+      }
+      #else
       wait40us();             /* wait sampling period */
+      #endif
 
       /*
        *  adaptive delay for 10s considering processing loop
@@ -2063,6 +2488,38 @@ void IR_Detector(void)
     }
     else if (Run == MODE_DECODE)        /* decoding mode */
     {
+      #ifdef SW_IR_LEARN
+      /* keep raw packet, since decoder may change data */
+      LearnPulses = Pulses;
+      n = 0;
+      while (n < Pulses)
+      {
+        LearnData[n] = PulseData[n];
+        n++;
+      }
+      #endif
+
+      #ifdef SW_IR_RX_CARRIER
+      /* raw IR signal: display carrier frequency and duty cycle */
+      if (Carrier && (Last != Start) && Reads)
+      {
+        /* f = edges / time */
+        Value = Edges;
+        Value *= CPU_FREQ / TIMESTAMP_PRESCALER;  /* time stamp ticks per s */
+        Value /= (uint16_t)(Last - Start);        /* in Hz */
+        Display_NextLine();
+        Display_Value(Value, 0, 0);              /* display frequency */
+        Display_EEString_Space(Hertz_str);       /* display: Hz */
+
+        /* duty cycle of high level */
+        Value = Highs;
+        Value *= 100;
+        Value /= Reads;                          /* in % */
+        Display_Value(Value, 0, '%');            /* display duty cycle */
+      }
+      Burst = 0;                           /* reset burst state */
+      #endif
+
       IR_Decode(&PulseData[0], Pulses);    /* try to decode */
       Run = MODE_WAIT;                     /* switch back to waiting mode */
     }
@@ -2071,19 +2528,46 @@ void IR_Detector(void)
       Run = MODE_WAIT;                     /* switch back to waiting mode */
 
       /* check test button */
+      #ifdef SW_IR_LEARN
+      n = 0;                       /* reset counter */
+      #endif
       while (!(BUTTON_PIN & (1 << TEST_BUTTON)))  /* key pressed */
       {
         MilliSleep(50);            /* take a nap */
         Run = 0;                   /* end loop */
+        #ifdef SW_IR_LEARN
+        if (n < 255) n++;          /* count naps */
+        #endif
       }
+      #ifdef INPUT_QUEUE
+      if (Run == 0) Key_Flush();   /* key press is processed already */
+      #endif
+
+      #ifdef SW_IR_LEARN
+      if (n >= 6)                  /* long key press (300ms) */
+      {
+        IR_Learn_Save(&LearnData[0], LearnPulses);    /* store last packet */
+        Run = MODE_WAIT;           /* keep running */
+      }
+      #endif
     }
 
     wdt_reset();                   /* reset watchdog */
   }
 
-  /* clean up local constants */
-  #undef MAX_PULSES
+  #ifdef SW_IR_RX_CARRIER
+  /* clean up */
+  TCCR0B = 0;                      /* stop Timer0 */
+  Timestamp_Stop();                /* stop Timer1 */
+  #endif
+
+  #endif
 
+  #ifdef SW_IR_RX_PCINT
+  Scratch_Release(SCRATCH_IR_RX);       /* free buffer */
+  #endif
+
+  /* clean up local constants */
   #undef MODE_WAIT
   #undef MODE_SAMPLE
   #undef MODE_DECODE
@@ -60,6 +60,14 @@
   #define IR_PROTO_MAX           15     /* number of all protocols */  
 #endif
 
+/* learned raw packets */
+#ifdef SW_IR_LEARN
+  #define IR_RAW       (IR_PROTO_MAX + 1)    /* raw pulse train */
+  #define IR_PROTO_LAST          IR_RAW      /* last protocol ID */
+#else
+  #define IR_PROTO_LAST    IR_PROTO_MAX      /* last protocol ID */
+#endif
+
 /* code bit mode */
 #define IR_LSB                    1     /* LSB */
 #define IR_MSB                    2     /* MSB */
@@ -73,6 +81,14 @@
 #define IR_PAUSE         0b00000001     /* pause */
 #define IR_PULSE         0b00000010     /* pulse */
 
+/* burst schedule (timer driven sender) */
+#ifdef SW_IR_TX_TIMER
+  #define IR_SCHED_PULSE     0x8000     /* flag for pulse */
+  #define IR_SCHED_TICKS     0x7FFF     /* mask for timer ticks */
+  #define IR_SCHED_SPLIT     0x4000     /* ticks for splitting long entries */
+  #define IR_SCHED_MIN           32     /* min. ticks of an entry */
+#endif
+
 
 /*
  *  local variables
@@ -81,6 +97,14 @@
 /* key toggle feature */
 uint8_t             IR_Toggle = 0;           /* key toggle flag */
 
+#ifdef SW_IR_TX_TIMER
+/* burst schedule: timer ticks, MSB is pulse flag (kept in scratch arena) */
+#define IR_Schedule         ((volatile uint16_t *)Scratch)
+volatile uint8_t    IR_SchedSize = 0;        /* number of entries */
+volatile uint8_t    IR_SchedPos;             /* current entry (ISR) */
+volatile uint16_t   IR_SchedTicks;           /* remaining ticks (ISR) */
+#endif
+
 
 
 /* ************************************************************************
@@ -89,6 +113,8 @@ uint8_t             IR_Toggle = 0;           /* key toggle flag */
 
 
 
+#ifndef SW_IR_TX_TIMER
+
 /*
  *  send single pause/pulse
  *
@@ -206,6 +232,199 @@ void IR_Send_Pulse(uint8_t Type, uint16_t Time)
   }
 }
 
+#endif
+
+
+
+#ifdef SW_IR_TX_TIMER
+
+/*
+ *  send burst schedule
+ *  - Timer0 runs in normal mode and triggers OCR0B matches
+ *    in chunks of up to 255 ticks until an entry is done
+ *  - the ISR switches the carrier (Timer1) on or off for each entry
+ *  - returns when all entries are sent and resets the schedule
+ */
+
+void IR_Send_Schedule(void)
+{
+  if (IR_SchedSize == 0) return;        /* nothing to send */
+
+  /* reset ISR state */
+  IR_SchedPos = 0;                      /* first entry */
+  IR_SchedTicks = 0;                    /* load entry with first match */
+
+  #ifdef TIMER_MANAGER
+  /* wait for Timer0 (bit-bang serial RX might be sampling a char) */
+  while (! Timer_Claim(TIMER_0, TIMER_IR_TX))
+  {
+    wdt_reset();                        /* reset watchdog */
+  }
+  #endif
+
+  /*
+   *  set up Timer0
+   *  - normal mode
+   *  - fixed prescaler = 8
+   *    MCU clock [MHz]:    8    16    20
+   *    timer cycle [s]:   1    0.5   0.4
+   *  - first match after IR_SCHED_MIN ticks
+   */
+
+  TCCR0B = 0;                           /* stop timer */
+  TCNT0 = 0;                            /* reset counter to 0 */
+  OCR0B = IR_SCHED_MIN;                 /* set match value for start */
+  TCCR0A = 0;                           /* normal mode (count up) */
+  TIFR0 = (1 << OCF0B);                 /* clear Output Compare B Match flag */
+  TIMSK0 = (1 << OCIE0B);               /* enable Output Compare B Match interrupt */
+  TCCR0B = (1 << CS01);                 /* start timer by setting prescaler */
+
+  /* wait until ISR has processed all entries */
+  while (TCCR0B != 0)                   /* as long as Timer0 is running */
+  {
+    wdt_reset();                        /* reset watchdog */
+  }
+
+  #ifdef TIMER_MANAGER
+  Timer_Release(TIMER_0, TIMER_IR_TX);
+  #endif
+
+  IR_SchedSize = 0;                     /* reset schedule */
+}
+
+
+
+/*
+ *  add single pause/pulse to burst schedule
+ *  - sends the schedule when it's full
+ *
+ *  requires:
+ *  - type: IR_PAUSE or IR_PULSE
+ *  - time: duration in s
+ */
+
+void IR_Send_Pulse(uint8_t Type, uint16_t Time)
+{
+  uint32_t          Ticks;         /* timer ticks */
+  uint16_t          Entry;         /* schedule entry */
+
+  /*
+   *  convert time into Timer0 ticks (prescaler 8)
+   *  - MCU_CYCLE_TIME in 0.1ns
+   *    ticks = (time * 10000) / (MCU_CYCLE_TIME * 8)
+   */
+
+  Ticks = (uint32_t)Time * 10000;
+  Ticks /= (MCU_CYCLE_TIME * 8);
+  if (Ticks < IR_SCHED_MIN) Ticks = IR_SCHED_MIN;   /* keep ISR in time */
+
+  /* add entries (split long durations) */
+  while (Ticks > 0)
+  {
+    if (IR_SchedSize >= IR_SCHED_MAX)   /* schedule is full */
+    {
+      IR_Send_Schedule();               /* send it */
+    }
+
+    if (Ticks > IR_SCHED_TICKS)         /* too long for single entry */
+    {
+      Entry = IR_SCHED_SPLIT;           /* leaves at least the same for next */
+    }
+    else                                /* fits */
+    {
+      Entry = (uint16_t)Ticks;
+    }
+
+    Ticks -= Entry;
+
+    if (Type & IR_PULSE) Entry |= IR_SCHED_PULSE;   /* set pulse flag */
+
+    IR_Schedule[IR_SchedSize] = Entry;  /* add entry */
+    IR_SchedSize++;
+  }
+}
+
+
+
+/*
+ *  ISR for match of Timer0's OCR0B (Output Compare Register B)
+ *  - processes burst schedule
+ *  - with timer manager: called by shared ISR in pause.c
+ */
+
+#ifdef TIMER_MANAGER
+void IR_Send_Next(void)
+#else
+ISR(TIMER0_COMPB_vect, ISR_BLOCK)
+#endif
+{
+  uint16_t          Ticks;         /* remaining ticks */
+  uint8_t           n;             /* ticks for next match */
+
+  /*
+   *  hints:
+   *  - the OCF0B interrupt flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  #if defined (SW_PERF_COUNTERS) && ! defined (TIMER_MANAGER)
+  /* with timer manager counted by shared ISR */
+  PerfCount[PERF_TIMER0]++;   /* count ISR call */
+  #endif
+
+  Ticks = IR_SchedTicks;
+
+  if (Ticks == 0)             /* current entry done */
+  {
+    if (IR_SchedPos >= IR_SchedSize)    /* end of schedule */
+    {
+      /* stop Timer1 and disable output via OC1B pin */
+      TCCR1B = (1 << WGM13) | (1 << WGM12);
+      TCCR1A = (1 << WGM11) | (1 << WGM10);
+
+      /* stop Timer0 */
+      TCCR0B = 0;
+      TIMSK0 = 0;                       /* disable interrupt */
+
+      return;
+    }
+
+    Ticks = IR_Schedule[IR_SchedPos];   /* get next entry */
+    IR_SchedPos++;
+
+    if (Ticks & IR_SCHED_PULSE)         /* pulse */
+    {
+      if (! (TCCR1B & (1 << CS10)))     /* carrier is off */
+      {
+        /* enable output via OC1B pin */
+        TCCR1A = (1 << WGM11) | (1 << WGM10) | (1 << COM1B1);
+
+        /* start Timer1 for carrier frequency */
+        TCNT1 = 0;
+        TCCR1B = (1 << WGM13) | (1 << WGM12) | (1 << CS10);
+      }
+    }
+    else                                /* pause */
+    {
+      /* stop Timer1 and disable output via OC1B pin */
+      TCCR1B = (1 << WGM13) | (1 << WGM12);
+      TCCR1A = (1 << WGM11) | (1 << WGM10);
+    }
+
+    Ticks &= IR_SCHED_TICKS;            /* remove pulse flag */
+  }
+
+  /* next chunk (keep at least 128 ticks for the last one) */
+  if (Ticks > 255) n = 128;
+  else n = (uint8_t)Ticks;
+
+  IR_SchedTicks = Ticks - n;
+  OCR0B += n;                           /* relative to last match */
+}
+
+#endif
+
 
 
 /*
@@ -553,6 +772,49 @@ void PutBits(uint16_t Data, uint8_t Bits, uint8_t StartBit, uint8_t Mode)
 
 
 
+#ifdef SW_IR_LEARN
+
+/*
+ *  send learned raw pulse train (IR learn)
+ *  - durations are read from EEPROM first to keep
+ *    the timing between pulses/pauses tight
+ *
+ *  required:
+ *  - Slot: slot number (0 - IR_LEARN_SLOTS-1)
+ */
+
+void IR_Send_Raw(uint8_t Slot)
+{
+  uint8_t           Pulses;             /* number of pulses/pauses */
+  uint8_t           n = 0;              /* counter */
+  uint8_t           Type = IR_PULSE;    /* signal type */
+  uint16_t          Time;               /* duration */
+  uint8_t           Data[IR_LEARN_PULSES];   /* durations */
+
+  if (Slot >= IR_LEARN_SLOTS) return;   /* invalid slot */
+
+  /* read pulse train */
+  Pulses = eeprom_read_byte(&NV_IR_Learn[Slot].Pulses);
+  if (Pulses > IR_LEARN_PULSES) return; /* erased EEPROM */
+  eeprom_read_block(&Data[0], &NV_IR_Learn[Slot].Data[0], Pulses);
+
+  /* send pulses and pauses (starting with a pulse) */
+  while (n < Pulses)
+  {
+    /* durations are stored as (duration / time unit) - 1 */
+    Time = Data[n] + 1;
+    Time *= IR_LEARN_UNIT;              /* in s */
+    IR_Send_Pulse(Type, Time);
+
+    Type ^= IR_PULSE | IR_PAUSE;        /* toggle signal type */
+    n++;                                /* next one */
+  }
+}
+
+#endif
+
+
+
 /*
  *  send IR code
  *
@@ -1136,6 +1398,24 @@ void IR_Send_Code(uint8_t Proto, uint16_t *Data)
   #endif
 
 
+  /*
+   *  learned raw pulse train
+   *  - Data #0: slot
+   */
+
+  #ifdef SW_IR_LEARN
+  else if (Proto == IR_RAW)             /* raw pulse train */
+  {
+    IR_Send_Raw((uint8_t)*Data);        /* send pulse train of slot */
+  }
+  #endif
+
+
+  #ifdef SW_IR_TX_TIMER
+  IR_Send_Schedule();                   /* send remaining schedule */
+  #endif
+
+
   #if 0
   /* debugging */
   LCD_ClearLine(6);
@@ -1197,6 +1477,11 @@ void IR_RemoteControl(void)
   #define MODE_DUTYCYCLE          3     /* carrier duty cycle */
   #define MODE_DATA               4     /* code data */
 
+  #ifdef SW_IR_TX_TIMER
+  /* buffer for burst schedule */
+  if (Scratch_Acquire(SCRATCH_IR_TX) == NULL) return;
+  #endif
+
   ShortCircuit(0);                      /* make sure probes are not shorted */
 
   /* display info */
@@ -1412,6 +1697,20 @@ void IR_RemoteControl(void)
           DutyCycle = 3;           /* 1/3 */
           break;
         #endif
+
+        #ifdef SW_IR_LEARN
+        case IR_RAW:               /* learned raw pulse train */
+          ProtoStr = (unsigned char *)IR_Raw_str;
+          #if IR_LEARN_SLOTS > 2
+          Bits[0] = 2;             /* slot (0-3) */
+          #else
+          Bits[0] = 1;             /* slot (0-1) */
+          #endif
+          Fields = 1;              /* 1 data field */
+          Carrier = 38;            /* 38kHz (most common) */
+          DutyCycle = 3;           /* 1/3 */
+          break;
+        #endif
       }
 
       /* reset data fields */
@@ -1538,7 +1837,7 @@ void IR_RemoteControl(void)
       if (Mode == MODE_PROTO)           /* protocol mode */
       {
         Proto_ID++;                     /* next one */
-        if (Proto_ID > IR_PROTO_MAX)    /* overflow */
+        if (Proto_ID > IR_PROTO_LAST)   /* overflow */
         {
           Proto_ID = 1;                 /* reset to first one */
         }
@@ -1587,7 +1886,7 @@ void IR_RemoteControl(void)
         Proto_ID--;                     /* previous one */
         if (Proto_ID == 0)              /* underflow */
         {
-          Proto_ID = IR_PROTO_MAX;      /* reset to last one */
+          Proto_ID = IR_PROTO_LAST;     /* reset to last one */
         }
 
         Flag |= CHANGE_PROTO | DISPLAY_PROTO | DISPLAY_DATA;
@@ -1680,6 +1979,10 @@ void IR_RemoteControl(void)
   SIGNAL_DDR &= ~(1 << SIGNAL_OUT);     /* set HiZ mode */
   #endif
 
+  #ifdef SW_IR_TX_TIMER
+  Scratch_Release(SCRATCH_IR_TX);       /* free buffer */
+  #endif
+
   /* clean up local constants */
   #undef FIELDS
 
@@ -34,6 +34,7 @@
 /* operation modes */
 #define MODE_MANUAL      0    /* manual mode */
 #define MODE_AUTO        1    /* automatic mode */
+#define MODE_LOG         2    /* logging mode */
 
 
 /*
@@ -199,7 +200,6 @@ void MAX31855_DeselectChip(void)
 uint8_t MAX31855_ReadTemperature(int32_t *Value, int8_t *Scale)
 {
   uint8_t           Flag = 0;           /* return value */
-  uint8_t           n;                  /* counter */
   uint8_t           Data[4];            /* data (4 bytes) */
   int16_t           Temp;               /* temperature */
 
@@ -212,12 +212,7 @@ uint8_t MAX31855_ReadTemperature(int32_t *Value, int8_t *Scale)
   MAX31855_SelectChip();                /* select chip */
 
   /* read four bytes */ 
-  n = 0;
-  while (n < 4)           /* 4 bytes */
-  {
-    Data[n] = SPI_WriteRead_Byte(0);    /* read byte */
-    n++;                                /* next byte */
-  }
+  SPI_Read_Block(&Data[0], 4);          /* read 4 bytes */
 
   MAX31855_DeselectChip();              /* deselect chip */
 
@@ -313,13 +308,40 @@ void MAX31855_Tool(void)
         /* indicate auto mode */
         Display_Char('*');         /* display: * */
       }
-      else                         /* automatic mode */
+      #ifdef THERMOCOUPLE_LOG
+      else if (Mode == MODE_AUTO)  /* automatic mode */
+      {
+        Mode = MODE_LOG;           /* set logging mode */
+
+        /* indicate logging mode */
+        Display_EEString(Log_str); /* display: Log */
+      }
+      #endif
+      else                         /* automatic or logging mode */
       {
         Mode = MODE_MANUAL;        /* set manual mode again */
         Timeout = 0;               /* wait for user */
       }
 
       MilliSleep(500);             /* smooth UI */
+
+      #ifdef THERMOCOUPLE_LOG
+      if (Mode == MODE_LOG)        /* logging mode */
+      {
+        /* log at max. conversion rate (100ms) until key press */
+        Thermo_Log(MAX31855_ReadTemperature, 100);
+
+        /* back to manual mode */
+        Mode = MODE_MANUAL;        /* set manual mode */
+        Timeout = 0;               /* wait for user */
+        LCD_Clear();
+        #ifdef UI_COLORED_TITLES
+          Display_ColoredEEString(MAX31855_str, COLOR_TITLE);
+        #else
+          Display_EEString(MAX31855_str);
+        #endif
+      }
+      #endif
     }
     else if (Test == KEY_TWICE)    /* two short key presses */
     {
@@ -372,6 +394,7 @@ void MAX31855_Tool(void)
 /* local constants */
 #undef MODE_MANUAL
 #undef MODE_AUTO
+#undef MODE_LOG
 
 /* source management */
 #undef MAX6675_C
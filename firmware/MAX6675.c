@@ -33,6 +33,7 @@
 /* operation modes */
 #define MODE_MANUAL      0    /* manual mode */
 #define MODE_AUTO        1    /* automatic mode */
+#define MODE_LOG         2    /* logging mode */
 
 
 /*
@@ -193,6 +194,7 @@ void MAX6675_DeselectChip(void)
 uint8_t MAX6675_ReadTemperature(int32_t *Value, int8_t *Scale)
 {
   uint8_t           Flag = 0;      /* return value */
+  uint8_t           Data[2];       /* data (MSB & LSB) */
   uint8_t           HighByte;      /* MSB */
   uint8_t           LowByte;       /* LSB */
   uint16_t          Temp;          /* temperature */
@@ -205,11 +207,13 @@ uint8_t MAX6675_ReadTemperature(int32_t *Value, int8_t *Scale)
   MAX6675_SelectChip();                 /* select chip */
 
   /* read two bytes */ 
-  HighByte = SPI_WriteRead_Byte(0);     /* read MSB */
-  LowByte = SPI_WriteRead_Byte(0);      /* read LSB */
+  SPI_Read_Block(&Data[0], 2);          /* read MSB and LSB */
 
   MAX6675_DeselectChip();               /* deselect chip */
 
+  HighByte = Data[0];                   /* MSB */
+  LowByte = Data[1];                    /* LSB */
+
 
   /*
    *  process data
@@ -305,13 +309,40 @@ void MAX6675_Tool(void)
         /* indicate auto mode */
         Display_Char('*');         /* display: * */
       }
-      else                         /* automatic mode */
+      #ifdef THERMOCOUPLE_LOG
+      else if (Mode == MODE_AUTO)  /* automatic mode */
+      {
+        Mode = MODE_LOG;           /* set logging mode */
+
+        /* indicate logging mode */
+        Display_EEString(Log_str); /* display: Log */
+      }
+      #endif
+      else                         /* automatic or logging mode */
       {
         Mode = MODE_MANUAL;        /* set manual mode again */
         Timeout = 0;               /* wait for user */
       }
 
       MilliSleep(500);             /* smooth UI */
+
+      #ifdef THERMOCOUPLE_LOG
+      if (Mode == MODE_LOG)        /* logging mode */
+      {
+        /* log at max. conversion rate (250ms) until key press */
+        Thermo_Log(MAX6675_ReadTemperature, 250);
+
+        /* back to manual mode */
+        Mode = MODE_MANUAL;        /* set manual mode */
+        Timeout = 0;               /* wait for user */
+        LCD_Clear();
+        #ifdef UI_COLORED_TITLES
+          Display_ColoredEEString(MAX6675_str, COLOR_TITLE);
+        #else
+          Display_EEString(MAX6675_str);
+        #endif
+      }
+      #endif
     }
     else if (Test == KEY_TWICE)    /* two short key presses */
     {
@@ -364,6 +395,7 @@ void MAX6675_Tool(void)
 /* local constants */
 #undef MODE_MANUAL
 #undef MODE_AUTO
+#undef MODE_LOG
 
 /* source management */
 #undef MAX6675_C
@@ -40,6 +40,27 @@
 #define MODE_MANUAL      0    /* manual mode */
 #define MODE_AUTO        1    /* automatic mode */
 
+/* interrupt driven bit engine */
+#ifdef ONEWIRE_ASYNC
+  /* engine states */
+  #define OW_IDLE             0   /* idle */
+  #define OW_RESET_LOW        1   /* end of reset pulse */
+  #define OW_RESET_SAMPLE     2   /* sample presence pulse */
+  #define OW_SLOT             3   /* start of time slot */
+  #define OW_RELEASE          4   /* end of low pulse for "0" */
+  #define OW_STOP             5   /* end of transaction */
+
+  /* Timer1 ticks for time in s (prescaler 1:1) */
+  #define OW_TICKS(t)        ((uint16_t)((t) * (CPU_FREQ / 1000000)))
+#endif
+
+/* DS18B20: max. conversion time in ms (750ms for 12 bits) */
+#ifdef DS18B20_RESOLUTION
+  #define DS18B20_CONV_TIME   (750 >> (12 - DS18B20_RESOLUTION))
+#else
+  #define DS18B20_CONV_TIME   750
+#endif
+
 
 /*
  *  include header files
@@ -59,12 +80,23 @@
 /* CRC */
 uint8_t        CRC8;          /* current CRC-8 */
 
-#if defined (ONEWIRE_READ_ROM) || defined (SW_ONEWIRE_SCAN)
+#if defined (ONEWIRE_READ_ROM) || defined (SW_ONEWIRE_SCAN) || defined (DS18B20_MULTI)
 /* ROM code */
 uint8_t        ROM_Code[8];   /* ROM code */
 uint8_t        LastCon;       /* bit position of last code conflict */
 #endif
 
+#ifdef ONEWIRE_ASYNC
+/* bit engine */
+volatile uint8_t    OW_State = OW_IDLE;   /* engine state */
+volatile uint8_t    OW_Result;            /* result (presence pulse) */
+uint8_t             *OW_Data;             /* data buffer */
+uint8_t             OW_Bits;              /* remaining bits */
+uint8_t             OW_Mask;              /* bitmask for data byte */
+uint8_t             OW_Mode;              /* ONEWIRE_READ or ONEWIRE_WRITE */
+uint8_t             OW_Speed = ONEWIRE_SPEED_STD;   /* bus speed */
+#endif
+
 
 
 /* ************************************************************************
@@ -169,6 +201,8 @@ uint8_t OneWire_Probes(const unsigned char *String)
 
 
 
+#ifndef ONEWIRE_ASYNC
+
 /*
  *  reset bus and check for presence pulse from client(s)
  *
@@ -461,6 +495,456 @@ uint8_t OneWire_ReadByte(void)
   return Byte;
 }
 
+#endif
+
+
+
+#ifdef ONEWIRE_ASYNC
+
+/*
+ *  DQ line management for bit engine
+ *  - DQ is driven as open-drain output (port pin is low)
+ */
+
+#ifdef ONEWIRE_IO_PIN
+  #define OW_DQ_LOW()    ONEWIRE_DDR |= (1 << ONEWIRE_DQ)
+  #define OW_DQ_FREE()   ONEWIRE_DDR &= ~(1 << ONEWIRE_DQ)
+  #define OW_DQ_HIGH()   (ONEWIRE_PIN & (1 << ONEWIRE_DQ))
+#endif
+
+#ifdef ONEWIRE_PROBES
+  #define OW_DQ_LOW()    ADC_DDR |= (1 << TP2)
+  #define OW_DQ_FREE()   ADC_DDR &= ~(1 << TP2)
+  #define OW_DQ_HIGH()   (ADC_PIN & (1 << TP2))
+#endif
+
+
+
+/*
+ *  start Timer1 for bit engine
+ *  - CTC mode with ICR1 as top value (mode 12)
+ *  - ICF1 flag triggers interrupt when top value is reached
+ *  - prescaler 1:1
+ *
+ *  requires:
+ *  - Ticks: timer ticks until first event
+ */
+
+void OneWire_Async_Timer(uint16_t Ticks)
+{
+  TCCR1B = 0;                      /* stop timer */
+  TCCR1A = 0;                      /* no output compare pins */
+  TCNT1 = 0;                       /* reset counter */
+  ICR1 = Ticks - 1;                /* top value for first event */
+  TIFR1 = (1 << ICF1);             /* clear input capture flag */
+  TIMSK1 = (1 << ICIE1);           /* enable input capture interrupt */
+  TCCR1B = (1 << WGM13) | (1 << WGM12) | (1 << CS10);  /* start timer */
+}
+
+
+
+/*
+ *  start bus reset (asynchronous)
+ *  - see OneWire_Async_Wait() for presence pulse
+ */
+
+void OneWire_Async_Reset(void)
+{
+  uint16_t          Ticks;         /* time of reset pulse */
+
+  OW_State = OW_RESET_LOW;         /* next event: end of reset pulse */
+  OW_Result = 0;                   /* no presence pulse yet */
+
+  Ticks = OW_TICKS(500);           /* standard speed: 500s */
+  #ifdef ONEWIRE_OVERDRIVE
+  if (OW_Speed == ONEWIRE_SPEED_OD)
+  {
+    Ticks = OW_TICKS(70);          /* overdrive: 70s */
+  }
+  #endif
+
+  OW_DQ_LOW();                     /* pull down DQ */
+  OneWire_Async_Timer(Ticks);      /* start timer */
+}
+
+
+
+/*
+ *  start transfer of bits (asynchronous)
+ *  - bit order: LSB first, byte #0 first
+ *  - buffer has to be valid until transfer is done
+ *
+ *  requires:
+ *  - Data: pointer to data buffer
+ *  - Bits: number of bits (1-255)
+ *  - Mode: ONEWIRE_WRITE or ONEWIRE_READ
+ */
+
+void OneWire_Async_Transfer(uint8_t *Data, uint8_t Bits, uint8_t Mode)
+{
+  OW_Data = Data;
+  OW_Bits = Bits;
+  OW_Mask = 0b00000001;            /* start with LSB */
+  OW_Mode = Mode;
+  OW_Result = 1;                   /* no presence pulse here */
+
+  OW_State = OW_SLOT;              /* next event: start of time slot */
+  OneWire_Async_Timer(OW_TICKS(5));     /* start timer */
+}
+
+
+
+/*
+ *  check if bit engine is busy
+ *
+ *  returns:
+ *  - 0 when idle
+ *  - 1 when busy
+ */
+
+uint8_t OneWire_Async_Busy(void)
+{
+  if (OW_State == OW_IDLE) return 0;
+  return 1;
+}
+
+
+
+/*
+ *  wait until transaction of bit engine is done
+ *  - interrupts are processed meanwhile
+ *
+ *  returns:
+ *  - 0: no presence pulse from client (reset)
+ *  - 1: presence pulse from client (reset) or finished transfer
+ */
+
+uint8_t OneWire_Async_Wait(void)
+{
+  while (OW_State != OW_IDLE)      /* engine is running */
+  {
+    wdt_reset();                   /* reset watchdog */
+  }
+
+  return OW_Result;
+}
+
+
+
+/*
+ *  reset bus and check for presence pulse from client(s)
+ *  - uses bit engine
+ *
+ *  returns:
+ *  - 0: no presence pulse from client
+ *  - 1: presence pulse from client
+ */
+
+uint8_t OneWire_ResetBus(void)
+{
+  OneWire_Async_Reset();
+  return OneWire_Async_Wait();
+}
+
+
+
+/*
+ *  send bit
+ *  - uses bit engine
+ *
+ *  requires:
+ *  - Bit: 0/1
+ */
+
+void OneWire_SendBit(uint8_t Bit)
+{
+  OneWire_Async_Transfer(&Bit, 1, ONEWIRE_WRITE);
+  OneWire_Async_Wait();
+}
+
+
+
+/*
+ *  read bit
+ *  - uses bit engine
+ *
+ *  returns:
+ *  - Bit: 0/1
+ */
+
+uint8_t OneWire_ReadBit(void)
+{
+  uint8_t           Bit = 0;       /* return value */
+
+  OneWire_Async_Transfer(&Bit, 1, ONEWIRE_READ);
+  OneWire_Async_Wait();
+
+  return Bit;
+}
+
+
+
+/*
+ *  send byte
+ *  - uses bit engine
+ *  - sending bit order: LSB
+ *
+ *  requires:
+ *  - Byte: data byte
+ */
+
+void OneWire_SendByte(uint8_t Byte)
+{
+  OneWire_Async_Transfer(&Byte, 8, ONEWIRE_WRITE);
+  OneWire_Async_Wait();
+}
+
+
+
+/*
+ *  read byte
+ *  - uses bit engine
+ *  - reading bit order: LSB
+ *
+ *  returns:
+ *  - Byte: data byte
+ */
+
+uint8_t OneWire_ReadByte(void)
+{
+  uint8_t           Byte = 0;      /* return value */
+
+  OneWire_Async_Transfer(&Byte, 8, ONEWIRE_READ);
+  OneWire_Async_Wait();
+
+  return Byte;
+}
+
+
+
+#ifdef ONEWIRE_OVERDRIVE
+
+/*
+ *  set bus speed
+ *
+ *  requires:
+ *  - Speed: ONEWIRE_SPEED_STD or ONEWIRE_SPEED_OD
+ */
+
+void OneWire_SetSpeed(uint8_t Speed)
+{
+  OW_Speed = Speed;
+}
+
+
+
+/*
+ *  switch overdrive-capable clients to overdrive speed
+ *  - uses "overdrive skip ROM" to address all clients
+ *  - a reset at standard speed switches clients back
+ *
+ *  returns:
+ *  - 0: no presence pulse at overdrive speed
+ *  - 1: presence pulse at overdrive speed
+ */
+
+uint8_t OneWire_Overdrive(void)
+{
+  uint8_t           Flag;          /* return value */
+
+  OW_Speed = ONEWIRE_SPEED_STD;    /* start with standard speed */
+  Flag = OneWire_ResetBus();
+
+  if (Flag)                        /* detected client(s) */
+  {
+    OneWire_SendByte(CMD_OVERDRIVE_SKIP_ROM);
+
+    OW_Speed = ONEWIRE_SPEED_OD;   /* change speed */
+    Flag = OneWire_ResetBus();     /* check for overdrive clients */
+
+    if (Flag == 0)                 /* no overdrive client */
+    {
+      OW_Speed = ONEWIRE_SPEED_STD; /* switch back */
+    }
+  }
+
+  return Flag;
+}
+
+#endif
+
+
+
+/*
+ *  ISR for Timer1's input capture flag (top value in CTC mode)
+ *  - bit engine: processes events of reset and time slots
+ *  - timing critical parts (low pulse for "1", sampling) are done
+ *    within the ISR with interrupts disabled
+ *  - other interrupts can be processed between the events
+ *  - timing of events is based on timer matches, not on ISR latency
+ */
+
+ISR(TIMER1_CAPT_vect, ISR_BLOCK)
+{
+  uint8_t           State;         /* engine state */
+  uint8_t           Bit;           /* bit flag */
+  uint8_t           Next = 1;      /* flag for next bit */
+  uint16_t          Ticks = 0;     /* ticks until next event */
+
+  /*
+   *  hints:
+   *  - the ICF1 interrupt flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_TIMER1]++;   /* count ISR call */
+  #endif
+
+  State = OW_State;
+
+  switch (State)
+  {
+    case OW_RESET_LOW:        /* end of reset pulse */
+      OW_DQ_FREE();                     /* release DQ */
+      /* client responds after 15-60s (overdrive: 2-6s) */
+      Ticks = OW_TICKS(70);             /* read delay of 70s */
+      #ifdef ONEWIRE_OVERDRIVE
+      if (OW_Speed == ONEWIRE_SPEED_OD) Ticks = OW_TICKS(9);
+      #endif
+      State = OW_RESET_SAMPLE;
+      Next = 0;
+      break;
+
+    case OW_RESET_SAMPLE:     /* check for presence pulse */
+      if (! OW_DQ_HIGH())               /* low */
+      {
+        OW_Result = 1;                  /* signal ok */
+      }
+      /* end the time slot */
+      Ticks = OW_TICKS(430);            /* 500s - 70s */
+      #ifdef ONEWIRE_OVERDRIVE
+      if (OW_Speed == ONEWIRE_SPEED_OD) Ticks = OW_TICKS(60);
+      #endif
+      State = OW_STOP;
+      Next = 0;
+      break;
+
+    case OW_SLOT:             /* start of time slot */
+      /* a read slot starts like writing "1" */
+      Bit = 1;
+      if (OW_Mode == ONEWIRE_WRITE)
+      {
+        Bit = *OW_Data & OW_Mask;       /* get bit */
+      }
+
+      OW_DQ_LOW();                      /* pull down DQ */
+
+      #ifdef ONEWIRE_OVERDRIVE
+      if (OW_Speed == ONEWIRE_SPEED_OD)
+      {
+        /*
+         *  overdrive: time slot 6-16s, low pulse 1s ("1") or
+         *  8s ("0"), read within 2s
+         *  - complete slot within ISR
+         */
+
+        wait1us();                      /* low pulse of 1s */
+        if (Bit == 0)                   /* "0" */
+        {
+          wait5us();                    /* low pulse of 8s in total */
+          wait2us();
+        }
+        OW_DQ_FREE();                   /* release DQ */
+
+        if (OW_Mode == ONEWIRE_READ)
+        {
+          /* sample DQ */
+          if (OW_DQ_HIGH()) *OW_Data |= OW_Mask;
+          else *OW_Data &= ~OW_Mask;
+        }
+
+        Ticks = OW_TICKS(16);           /* time slot + recovery time */
+        break;
+      }
+      #endif
+
+      if (Bit)                /* "1" or read */
+      {
+        wait5us();                      /* low pulse of 5s */
+        OW_DQ_FREE();                   /* release DQ */
+
+        if (OW_Mode == ONEWIRE_READ)
+        {
+          /* data bit valid for 15s starting with low pulse */
+          wait5us();                    /* read delay of 8s */
+          wait3us();
+
+          /* sample DQ */
+          if (OW_DQ_HIGH()) *OW_Data |= OW_Mask;
+          else *OW_Data &= ~OW_Mask;
+        }
+
+        Ticks = OW_TICKS(70);           /* time slot + recovery time */
+      }
+      else                    /* "0" */
+      {
+        Ticks = OW_TICKS(60);           /* low pulse of 60s */
+        State = OW_RELEASE;
+        Next = 0;
+      }
+      break;
+
+    case OW_RELEASE:          /* end of low pulse for "0" */
+      OW_DQ_FREE();                     /* release DQ */
+      Ticks = OW_TICKS(10);             /* recovery time */
+      break;
+
+    default:                  /* end of transaction */
+      TCCR1B = 0;                       /* stop timer */
+      TIMSK1 = 0;                       /* disable interrupt */
+      OW_State = OW_IDLE;               /* signal "done" */
+      return;
+  }
+
+  /* manage bits */
+  if (Next)                   /* bit done */
+  {
+    OW_Mask <<= 1;                      /* next bit */
+    if (OW_Mask == 0)                   /* byte done */
+    {
+      OW_Mask = 0b00000001;             /* reset bitmask to LSB */
+      OW_Data++;                        /* next byte */
+    }
+
+    OW_Bits--;                          /* one bit less */
+    if (OW_Bits == 0) State = OW_STOP;  /* last bit */
+    else State = OW_SLOT;               /* next slot */
+  }
+
+  OW_State = State;
+
+  /*
+   *  set next event
+   *  - counter started with 0 at the last event
+   *  - prevent a top value already passed
+   */
+
+  if (TCNT1 + OW_TICKS(2) >= Ticks)
+  {
+    Ticks = TCNT1 + OW_TICKS(2);
+  }
+
+  ICR1 = Ticks - 1;
+}
+
+#undef OW_DQ_LOW
+#undef OW_DQ_FREE
+#undef OW_DQ_HIGH
+
+#endif
+
 
 
 /* ************************************************************************
@@ -468,7 +952,7 @@ uint8_t OneWire_ReadByte(void)
  * ************************************************************************ */
 
 
-#if 0
+#ifdef SW_DS18B20
 
 /*
  *  address client
@@ -527,6 +1011,7 @@ uint8_t OneWire_AddressClient(uint8_t *ROM_Code)
  *  - CRC = X^8 + X^5 + X^4 + 1
  *  - start value: 0x00
  *  - uses variable CRC8 to track current CRC
+ *  - table based: one lookup for each nibble instead of 8 bit shifts
  *
  *  requires:
  *  - Byte: new input byte
@@ -534,40 +1019,15 @@ uint8_t OneWire_AddressClient(uint8_t *ROM_Code)
 
 void OneWire_CRC8(uint8_t Byte)
 {
-  uint8_t           n = 0;         /* counter */
-  uint8_t           Bit;           /* LSB */ 
-
-  while (n < 8)          /* 8 bits */
-  {
-    /* XOR current LSB of input with CRC8's current X^8 */
-    Bit = CRC8 ^ Byte;        /* XOR */
-    Bit &= 0b00000001;        /* filter LSB */
-
-    /* shift CRC right */
-    CRC8 >>= 1;               /* for next bit */
-
-    if (Bit)                  /* XORed LSB is 1 */
-    {
-      /*
-       *  XOR CRC's X^5 and X^4 with 1
-       *  - XOR with 0b00011000
-       *  - since CRC is already shifted right: XOR with 0b00001100
-       *  - since we have to feed the XORed LSB back into the CRC
-       *    and the MSB is 0 after shifting: XOR with 0b10001100
-       */
-
-      CRC8 ^= 0b10001100;     /* XOR */
-    }
-    /*  when 0:
-     *  - XOR would keep the original bits
-     *  - MSB will be 0 after a right shift anyway
-     */
+  /*
+   *  Since the CRC is linear, the CRC of the combined byte (CRC XOR input)
+   *  is the XOR of the CRCs of its low and high nibble.
+   */
 
-    /* shift input right */
-    Byte >>= 1;               /* for next input bit */
+  Byte ^= CRC8;               /* XOR input with current CRC */
 
-    n++;                      /* next bit */
-  }
+  CRC8 = DATA_read_byte(&CRC8_Low_table[Byte & 0x0F]);
+  CRC8 ^= DATA_read_byte(&CRC8_High_table[Byte >> 4]);
 }
 
 
@@ -577,7 +1037,7 @@ void OneWire_CRC8(uint8_t Byte)
  * ************************************************************************ */
 
 
-#ifdef SW_ONEWIRE_SCAN
+#if defined (SW_ONEWIRE_SCAN) || defined (DS18B20_MULTI)
 
 /*
  *  search for next device (ROM code)
@@ -713,8 +1173,12 @@ uint8_t OneWire_Next_ROM_Code(void)
   return Flag;
 }
 
+#endif
+
 
 
+#ifdef SW_ONEWIRE_SCAN
+
 /*
  *  read ROM codes of connected devices
  *
@@ -954,39 +1418,81 @@ void OneWire_Read_ROM_Code(void)
 
 #ifdef SW_DS18B20
 
+#ifdef DS18B20_RESOLUTION
+
 /*
- *  DS18B20: read temperature
- *  - single client on the bus
+ *  DS18B20: set resolution
+ *  - addresses all clients on the bus at once
+ *  - writes T_H, T_L and configuration register to scratchpad
+ *    (not copied to EEPROM, T_H/T_L set to max/min to disable alarm)
  *
  *  requires:
- *  - Value: pointer to temperature in C
- *  - Scale: pointer to scale factor (*10^x)
+ *  - Bits: resolution in bits (9-12)
  *
  *  returns:
  *  - 1 on success
  *  - 0 on any problem
  */
 
-uint8_t DS18B20_ReadTemperature(int32_t *Value, int8_t *Scale)
+uint8_t DS18B20_SetResolution(uint8_t Bits)
 {
-  uint8_t           Flag = 0;           /* return value / control flag */
-  uint8_t           Run = 0;            /* loop control */
+  uint8_t           Flag;               /* return value */
+  uint8_t           Config;             /* configuration register */
+
+  /* configuration register: 0 R1 R0 1 1 1 1 1 */
+  Config = (Bits - 9) << 5;             /* R1 and R0 */
+  Config |= 0b00011111;                 /* reserved bits */
+
+  /* transaction: initialization and ROM command */
+  /* reset bus, check for presence pulse and select all clients */
+  Flag = OneWire_AddressClient(NULL);
+
+  if (Flag)                   /* detected client(s) */
+  {
+    /* transaction: function command */
+    OneWire_SendByte(CMD_DS18B20_WRITE_SCRATCHPAD);
+    OneWire_SendByte(0x7F);             /* T_H: +127C */
+    OneWire_SendByte(0x80);             /* T_L: -128C */
+    OneWire_SendByte(Config);           /* configuration register */
+  }
+
+  return Flag;
+}
+
+#endif
+
+
+
+/*
+ *  DS18B20: start conversion and wait until it's finished
+ *  - addresses all clients on the bus at once
+ *  - sets resolution first if DS18B20_RESOLUTION is enabled
+ *  - requires external power
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 on any problem
+ */
+
+uint8_t DS18B20_Convert(void)
+{
+  uint8_t           Flag = 0;           /* return value */
   uint8_t           n;                  /* counter */
-  uint8_t           ScratchPad[9];      /* scratchpad */
-  uint8_t           Sign;               /* sign flag */
-  int16_t           Temp;               /* temperature */
 
   wdt_reset();                /* reset watchdog */
 
-  /* transaction: initialization */
-  /* reset bus and check for presence pulse */
-  Flag = OneWire_ResetBus();
-
-  if (Flag)                   /* detected client */
+  #ifdef DS18B20_RESOLUTION
+  /* set resolution (also for sensors connected meanwhile) */
+  if (DS18B20_SetResolution(DS18B20_RESOLUTION) == 0)
   {
-    /* transaction: ROM command */
-    OneWire_SendByte(CMD_SKIP_ROM);     /* select all clients */
+    return Flag;              /* no client */
+  }
+  #endif
 
+  /* transaction: initialization and ROM command */
+  /* reset bus, check for presence pulse and select all clients */
+  if (OneWire_AddressClient(NULL))      /* detected client(s) */
+  {
     /* transaction: function command */
     /* start conversion */
     OneWire_SendByte(CMD_DS18B20_CONVERT_T);
@@ -1001,8 +1507,8 @@ uint8_t DS18B20_ReadTemperature(int32_t *Value, int8_t *Scale)
 
     #if 0
     /* fixed delay for conversion (required when parasitic-powered) */
-    MilliSleep(750);          /* 750ms */
-    Run = 3;                  /* three read attempts */
+    MilliSleep(DS18B20_CONV_TIME);      /* 94-750ms */
+    Flag = 1;                 /* signal "ok" */
     #endif
 
     /*
@@ -1010,20 +1516,19 @@ uint8_t DS18B20_ReadTemperature(int32_t *Value, int8_t *Scale)
      *  - requires external power
      *  - this way we don't need to know the bit depth in advance
      *    to determine the conversion time
+     *  - with multiple clients DQ stays low until the last one
+     *    has finished its conversion
      */
 
-    Flag = 0;                           /* reset flag */
-    n = 50;                             /* 750ms / 15ms = 50 */
+    n = (DS18B20_CONV_TIME / 15) + 1;   /* 750ms / 15ms = 50 */
     while (n > 0)
     {
       MilliSleep(15);                   /* wait 15ms */
 
       /* check conversion state */
-      Sign = OneWire_ReadBit();         /* single read slot */
-      if (Sign == FLAG_CONV_DONE)       /* conversion finished */
+      if (OneWire_ReadBit() == FLAG_CONV_DONE)    /* conversion finished */
       {
         Flag = 1;                       /* signal "ok" */
-        Run = 3;                        /* three read attempts */
         n = 1;                          /* end loop */
       }
 
@@ -1031,6 +1536,36 @@ uint8_t DS18B20_ReadTemperature(int32_t *Value, int8_t *Scale)
     }
   }
 
+  return Flag;
+}
+
+
+
+/*
+ *  DS18B20: get temperature of last conversion
+ *
+ *  requires:
+ *  - ROM: pointer to ROM code of client
+ *         or NULL for single client on the bus
+ *  - Value: pointer to temperature in C
+ *  - Scale: pointer to scale factor (*10^x)
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 on any problem
+ */
+
+uint8_t DS18B20_GetTemperature(uint8_t *ROM, int32_t *Value, int8_t *Scale)
+{
+  uint8_t           Flag = 0;           /* return value / control flag */
+  uint8_t           Run = 3;            /* loop control: three read attempts */
+  uint8_t           n;                  /* counter */
+  uint8_t           ScratchPad[9];      /* scratchpad */
+  uint8_t           Sign;               /* sign flag */
+  int16_t           Temp;               /* temperature */
+
+  wdt_reset();                /* reset watchdog */
+
 
   /*
    *  read scratchpad
@@ -1038,15 +1573,12 @@ uint8_t DS18B20_ReadTemperature(int32_t *Value, int8_t *Scale)
 
   while (Run)
   {
-    /* transaction: initialization */
-    /* reset bus and check for presence pulse */
-    Flag = OneWire_ResetBus();    
+    /* transaction: initialization and ROM command */
+    /* reset bus, check for presence pulse and select client */
+    Flag = OneWire_AddressClient(ROM);
 
     if (Flag)                 /* detected client */
     {
-      /* transaction: ROM command */
-      OneWire_SendByte(CMD_SKIP_ROM);        /* select all clients */
-
       /* transaction: function command */
       /* read scratchpad to get temperature */
       OneWire_SendByte(CMD_DS18B20_READ_SCRATCHPAD);
@@ -1157,6 +1689,228 @@ uint8_t DS18B20_ReadTemperature(int32_t *Value, int8_t *Scale)
 
 
 
+/*
+ *  DS18B20: read temperature
+ *  - single client on the bus
+ *
+ *  requires:
+ *  - Value: pointer to temperature in C
+ *  - Scale: pointer to scale factor (*10^x)
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 on any problem
+ */
+
+uint8_t DS18B20_ReadTemperature(int32_t *Value, int8_t *Scale)
+{
+  uint8_t           Flag;               /* return value */
+
+  Flag = DS18B20_Convert();             /* start conversion */
+
+  if (Flag)                             /* conversion finished */
+  {
+    /* get temperature */
+    Flag = DS18B20_GetTemperature(NULL, Value, Scale);
+  }
+
+  return Flag;
+}
+
+
+
+/*
+ *  DS18B20: display temperature
+ *
+ *  requires:
+ *  - Value: temperature in C
+ *  - Scale: scale factor (*10^x)
+ */
+
+void DS18B20_DisplayTemperature(int32_t Value, int8_t Scale)
+{
+  /* Scale is -1 to -4: 1-4 decimal places */
+  Scale = -Scale;
+
+  #ifdef UI_FAHRENHEIT
+  /* convert Celsius into Fahrenheit */
+  Value = Celsius2Fahrenheit(Value, Scale);
+  #endif
+
+  #ifdef UI_ROUND_DS18B20
+  /* round value and scale to 0.1 */
+  Value = RoundSignedValue(Value, Scale, 1);
+  Scale = 1;                 /* 1 decimal */
+  #endif
+
+  /* todo: add degree symbol to bitmap fonts */
+  Display_SignedFullValue(Value, Scale, '');
+
+  #ifdef UI_FAHRENHEIT
+    Display_Char('F');       /* display: F (Fahrenheit) */
+  #else
+    Display_Char('C');       /* display: C (Celsius) */
+  #endif
+}
+
+
+
+#ifdef DS18B20_MULTI
+
+/*
+ *  DS18B20: search bus for sensors
+ *  - checks CRC and family code
+ *
+ *  requires:
+ *  - ROM: pointer to array for ROM codes (8 bytes each)
+ *  - Max: max. number of sensors
+ *
+ *  returns:
+ *  - number of sensors found
+ */
+
+uint8_t DS18B20_Scan(uint8_t *ROM, uint8_t Max)
+{
+  uint8_t           Sensors = 0;        /* return value */
+  uint8_t           Flag = 1;           /* control flag */
+  uint8_t           n;                  /* counter */
+
+  /* reset search */
+  for (n = 0; n < 8; n++)     /* 8 bytes */
+  {
+    ROM_Code[n] = 0;          /* clear ROM code */
+  }
+  LastCon = 0;                /* reset bit position of last code conflict */
+
+  while ((Flag == 1) && (Sensors < Max))
+  {
+    Flag = OneWire_Next_ROM_Code();     /* get next device */
+
+    if (Flag >= 1)            /* got ROM code */
+    {
+      /* check CRC */
+      CRC8 = 0x00;            /* reset CRC to start value */
+      n = 0;
+      while (n < 7)           /* 7 data bytes */
+      {
+        OneWire_CRC8(ROM_Code[n]);      /* process byte */
+        n++;                            /* next byte */
+      }
+
+      /* valid ROM code of a DS18B20 */
+      if ((ROM_Code[7] == CRC8) && (ROM_Code[0] == FAMILY_CODE_DS18B20))
+      {
+        /* copy ROM code */
+        for (n = 0; n < 8; n++)         /* 8 bytes */
+        {
+          *ROM = ROM_Code[n];
+          ROM++;                        /* next byte */
+        }
+
+        Sensors++;                      /* got another one */
+      }
+    }
+  }
+
+  return Sensors;
+}
+
+#endif
+
+
+
+#ifdef DS18B20_ROM_CACHE
+
+/*
+ *  DS18B20: load and check ROM codes of last bus search
+ *  - checks CRC and family code of each cached ROM code
+ *  - addresses each sensor directly (MATCH ROM) and reads its scratchpad
+ *
+ *  requires:
+ *  - ROM: pointer to array for ROM codes (8 bytes each)
+ *  - Max: max. number of sensors
+ *
+ *  returns:
+ *  - number of sensors
+ *  - 0 on any mismatch (sensor missing or cache invalid)
+ */
+
+uint8_t DS18B20_LoadCache(uint8_t *ROM, uint8_t Max)
+{
+  uint8_t           Sensors;            /* return value */
+  uint8_t           n = 0;              /* counter */
+  uint8_t           i;                  /* counter */
+  uint8_t           *Code;              /* pointer to ROM code */
+  int8_t            Scale;              /* temperature scale 10^x */
+  int32_t           Value;              /* temperature value */
+
+  /* get number of sensors */
+  Sensors = eeprom_read_byte(&NV_DS18B20_Cache.Sensors);
+  if (Sensors > Max)          /* too many for display */
+  {
+    Sensors = 0;              /* search bus instead */
+  }
+
+  /* get ROM codes */
+  eeprom_read_block((void *)ROM, (const void *)&NV_DS18B20_Cache.ROM[0][0], Sensors * 8);
+
+  while (n < Sensors)         /* all sensors */
+  {
+    Code = ROM;               /* start of ROM code */
+
+    /* check CRC */
+    CRC8 = 0x00;              /* reset CRC to start value */
+    i = 0;
+    while (i < 7)             /* 7 data bytes */
+    {
+      OneWire_CRC8(*Code);    /* process byte */
+      Code++;                 /* next byte */
+      i++;                    /* next byte */
+    }
+
+    i = 0;                    /* reset flag */
+    if ((*Code == CRC8) && (*ROM == FAMILY_CODE_DS18B20))
+    {
+      /* address sensor and read scratchpad */
+      i = DS18B20_GetTemperature(ROM, &Value, &Scale);
+    }
+
+    if (i == 0)               /* sensor doesn't respond or invalid code */
+    {
+      Sensors = 0;            /* signal mismatch and end loop */
+    }
+
+    ROM += 8;                 /* next ROM code */
+    n++;                      /* next sensor */
+  }
+
+  return Sensors;
+}
+
+
+
+/*
+ *  DS18B20: save ROM codes of bus search
+ *  - EEPROM is only written when the ROM codes have changed
+ *
+ *  requires:
+ *  - ROM: pointer to array of ROM codes (8 bytes each)
+ *  - Sensors: number of sensors
+ */
+
+void DS18B20_SaveCache(uint8_t *ROM, uint8_t Sensors)
+{
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_EEPROM]++;   /* count EEPROM write */
+  #endif
+  eeprom_update_byte((uint8_t *)&NV_DS18B20_Cache.Sensors, Sensors);
+  eeprom_update_block((const void *)ROM, (void *)&NV_DS18B20_Cache.ROM[0][0], Sensors * 8);
+}
+
+#endif
+
+
+
 /*
  *  temperature sensor DS18B20
  *
@@ -1174,6 +1928,18 @@ uint8_t DS18B20_Tool(void)
   int32_t           Value;         /* temperature value */
   uint8_t           Mode = MODE_MANUAL; /* operation mode */
   uint16_t          Timeout = 0;        /* timeout for user feedback */
+  #ifdef DS18B20_MULTI
+  uint8_t           Sensors = 0;        /* number of sensors */
+  uint8_t           n;                  /* counter */
+  uint8_t           ROM[DS18B20_MULTI][8];   /* ROM codes of sensors */
+  #ifdef DS18B20_ROM_CACHE
+  uint8_t           Cache = 1;          /* try cached ROM codes */
+  #endif
+  #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+  uint8_t           i;                  /* counter */
+  uint8_t           Control;            /* output control */
+  #endif
+  #endif
 
   #ifdef ONEWIRE_IO_PIN
   Flag = 1;                   /* set default */
@@ -1193,7 +1959,7 @@ uint8_t DS18B20_Tool(void)
   LCD_ClearLine2();                     /* clear line #2 */
   Display_EEString(Start_str);          /* display: Start */
 
-  #ifdef UI_ONEWIRE
+  #if defined (UI_ONEWIRE) && ! defined (DS18B20_MULTI)
   /* display sensor symbol */
   Check.Symbol = SYMBOL_ONEWIRE;        /* set symbol ID */
   Semi.A = 1;                           /* DQ/Data: probe #2 */
@@ -1254,6 +2020,8 @@ uint8_t DS18B20_Tool(void)
     }
 
 
+    #ifndef DS18B20_MULTI
+
     /* clear text lines for new output */
     LCD_ClearLine2();                   /* clear line #2 */
     #ifdef ONEWIRE_READ_ROM
@@ -1272,40 +2040,133 @@ uint8_t DS18B20_Tool(void)
 
       if (Test)                    /* got temperature */
       {
-        /* Scale is -1 to -4: 1-4 decimal places */
-        Scale = -Scale;
-
-        #ifdef UI_FAHRENHEIT
-        /* convert Celsius into Fahrenheit */
-        Value = Celsius2Fahrenheit(Value, Scale);
-        #endif
-
-        #ifdef UI_ROUND_DS18B20
-        /* round value and scale to 0.1 */
-        Value = RoundSignedValue(Value, Scale, 1);
-        Scale = 1;                 /* 1 decimal */
-        #endif
-
-        /* todo: add degree symbol to bitmap fonts */
-        Display_SignedFullValue(Value, Scale, '');
-
-        #ifdef UI_FAHRENHEIT
-          Display_Char('F');       /* display: F (Fahrenheit) */
-        #else
-          Display_Char('C');       /* display: C (Celsius) */
-        #endif
+        DS18B20_DisplayTemperature(Value, Scale);
       }
       else                         /* some error */
       {
         Display_Minus();           /* display n/a */
       }
 
+      #ifdef SW_REMOTE_TOOLS
+      /* send record to remote host (in C) */
+      if (Tool_RecordStart())
+      {
+        if (Test) Tool_RecordField(Cmd_T_str, Value, Scale, 0);
+        Tool_RecordEnd();
+      }
+      #endif
+
       #ifdef ONEWIRE_READ_ROM
       /* read and display ROM code */
       LCD_CharPos(1, 3);           /* move to line #3 */
       OneWire_Read_ROM_Code();     /* read and display ROM code */
       #endif
     }
+
+    #endif
+
+
+    #ifdef DS18B20_MULTI
+
+    /*
+     *  read and show temperatures of all sensors
+     *  - one conversion for all sensors
+     *  - one line per sensor starting with line #2
+     */
+
+    if (Run)            /* ok to proceed */
+    {
+      if (Sensors == 0)            /* no sensors yet */
+      {
+        /* search bus (limited by number of text lines) */
+        n = UI.CharMax_Y - 1;           /* lines available */
+        if (n > DS18B20_MULTI) n = DS18B20_MULTI;
+
+        #ifdef DS18B20_ROM_CACHE
+        if (Cache)                      /* first run */
+        {
+          /* try ROM codes of last bus search */
+          Sensors = DS18B20_LoadCache(&ROM[0][0], n);
+          Cache = 0;                    /* only once */
+        }
+
+        if (Sensors == 0)               /* cache mismatch */
+        {
+          Sensors = DS18B20_Scan(&ROM[0][0], n);
+
+          if (Sensors)                  /* found sensors */
+          {
+            /* update cache */
+            DS18B20_SaveCache(&ROM[0][0], Sensors);
+          }
+        }
+        #else
+        Sensors = DS18B20_Scan(&ROM[0][0], n);
+        #endif
+      }
+
+      Test = 0;                    /* reset flag */
+      if (Sensors)                 /* got sensors */
+      {
+        /* start conversion for all sensors */
+        Test = DS18B20_Convert();
+      }
+
+      if (Test == 0)               /* no sensors or bus error */
+      {
+        LCD_ClearLine2();          /* clear line #2 */
+        Display_Minus();           /* display n/a */
+        Sensors = 0;               /* search again next time */
+      }
+
+      n = 0;
+      while (n < Sensors)          /* all sensors */
+      {
+        /* get temperature from sensor (in C) */
+        Test = DS18B20_GetTemperature(&ROM[n][0], &Value, &Scale);
+
+        LCD_ClearLine(n + 2);           /* clear line */
+        LCD_CharPos(1, n + 2);          /* move to beginning of line */
+        Display_FullValue(n + 1, 0, 0); /* display sensor number */
+        Display_Colon();                /* display: : */
+        Display_Space();
+
+        if (Test)                  /* got temperature */
+        {
+          DS18B20_DisplayTemperature(Value, Scale);
+        }
+        else                       /* some error */
+        {
+          Display_Minus();         /* display n/a */
+        }
+
+        #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+        /* send sensor, ROM code and temperature via TTL serial (CSV) */
+        Control = Cfg.OP_Control;       /* save output control */
+        Cfg.OP_Control &= ~OP_OUT_LCD;  /* disable display output */
+        Cfg.OP_Control |= OP_OUT_SER;   /* enable serial output */
+
+        Display_FullValue(n + 1, 0, 0); /* sensor number */
+        Display_Char(',');
+        for (i = 0; i < 8; i++)         /* ROM code */
+        {
+          Display_HexByte(ROM[n][i]);
+        }
+        Display_Char(',');
+        if (Test)                       /* got temperature */
+        {
+          Display_SignedFullValue(Value, -Scale, 0);   /* in C */
+        }
+        Serial_NewLine();
+
+        Cfg.OP_Control = Control;       /* restore output control */
+        #endif
+
+        n++;                       /* next sensor */
+      }
+    }
+
+    #endif
   }
 
   return Flag;
@@ -1667,6 +2528,17 @@ uint8_t DS18S20_Tool(void)
 /* local constants */
 #undef MODE_MANUAL
 #undef MODE_AUTO
+#undef DS18B20_CONV_TIME
+
+#ifdef ONEWIRE_ASYNC
+  #undef OW_IDLE
+  #undef OW_RESET_LOW
+  #undef OW_RESET_SAMPLE
+  #undef OW_SLOT
+  #undef OW_RELEASE
+  #undef OW_STOP
+  #undef OW_TICKS
+#endif
 
 /* source management */
 #undef ONEWIRE_C
@@ -81,6 +81,16 @@
 #define CMD_ALARM_SEARCH      0xEC
 
 
+/*
+ *  overdrive skip ROM
+ *  - address all clients on the bus
+ *  - overdrive-capable clients switch to overdrive speed
+ *    until the next reset at standard speed
+ */
+
+#define CMD_OVERDRIVE_SKIP_ROM     0x3C
+
+
 
 /* ************************************************************************
  *   DS18B20 function commands
@@ -412,6 +412,7 @@ void LCD_Data(uint8_t Data)
 #define CTRL_DATA        0b00000010     /* data */
 #define CTRL_SINGLE      0b00000100     /* single byte */
 #define CTRL_MULTI       0b00001000     /* multiple bytes */
+#define CTRL_MIXED       0b00010000     /* commands followed by data */
 
 
 
@@ -421,6 +422,7 @@ void LCD_Data(uint8_t Data)
 
 /* single/multi byte control */
 uint8_t             MultiByte;     /* control flag */
+                                   /* 0: single, 1: multi, 2: mixed */
 
 
 
@@ -456,6 +458,10 @@ void LCD_BusSetup(void)
  *  - set up I2C transfer
  *  - send control byte
  *  - manage single/multi byte mode
+ *  - mixed mode: commands are sent with a control byte each and
+ *    a following call with CTRL_MULTI | CTRL_DATA switches the
+ *    running transfer to data, i.e. setting the position and
+ *    sending a page of data takes a single I2C transfer
  *
  *  requires:
  *  - Mode:
@@ -463,33 +469,51 @@ void LCD_BusSetup(void)
  *    CTRL_DATA    data
  *    CTRL_SINGLE  single byte
  *    CTRL_MULTI   multiple bytes
+ *    CTRL_MIXED   mixed commands and data
  */
 
 void LCD_StartTransfer(uint8_t Mode)
 {
   uint8_t           Byte;          /* control byte */
+  uint8_t           Flag = 1;      /* control byte flag */
+
+  /* start transfer (unless mixed mode transfer is running) */
+  if (MultiByte != 2)              /* no mixed mode */
+  {
+    Flag = 0;                      /* reset flag */
+
+    if (I2C_Start(I2C_START) == I2C_OK)             /* start */
+    {
+      I2C.Byte = LCD_I2C_ADDR << 1;       /* address (7 bit & write) */
+
+      if (I2C_WriteByte(I2C_ADDRESS) == I2C_ACK)    /* address slave */
+      {
+        Flag = 1;                         /* send control byte */
+      }
+    }
+  }
 
   /* update control flag */
-  if (Mode & CTRL_MULTI)           /* multi byte mode */
+  if (Mode & CTRL_MIXED)           /* mixed mode */
+  {
+    MultiByte = 2;                 /* set flag */
+    Flag = 0;                      /* LCD_Cmd() sends control bytes */
+  }
+  else if (Mode & CTRL_MULTI)      /* multi byte mode */
   {
     MultiByte = 1;                 /* set flag */
   }
 
-  /* init control byte */
-  Byte = LCD_CONTROL_BYTE;
-  if (Mode & CTRL_SINGLE) Byte |= FLAG_CTRL_SINGLE;    /* single byte mode */
-  if (Mode & CTRL_DATA) Byte |= FLAG_CTRL_DATA;        /* data mode */
-  /* flags for multi byte mode and command mode are 0 */
-
-  if (I2C_Start(I2C_START) == I2C_OK)             /* start */
+  if (Flag)                        /* send control byte */
   {
-    I2C.Byte = LCD_I2C_ADDR << 1;       /* address (7 bit & write) */
-
-    if (I2C_WriteByte(I2C_ADDRESS) == I2C_ACK)    /* address slave */
-    {
-      I2C.Byte = Byte;                  /* copy control byte */
-      I2C_WriteByte(I2C_DATA);          /* send byte */
-    }
+    /* init control byte */
+    Byte = LCD_CONTROL_BYTE;
+    if (Mode & CTRL_SINGLE) Byte |= FLAG_CTRL_SINGLE;  /* single byte mode */
+    if (Mode & CTRL_DATA) Byte |= FLAG_CTRL_DATA;      /* data mode */
+    /* flags for multi byte mode and command mode are 0 */
+
+    I2C.Byte = Byte;               /* copy control byte */
+    I2C_WriteByte(I2C_DATA);       /* send byte */
   }
 
   /* todo: error handling? */
@@ -528,6 +552,12 @@ void LCD_Cmd(uint8_t Cmd)
     /* init transfer */
     LCD_StartTransfer(CTRL_SINGLE | CTRL_CMD);
   }
+  else if (MultiByte == 2)    /* mixed mode */
+  {
+    /* control byte for a single command */
+    I2C.Byte = LCD_CONTROL_BYTE | FLAG_CTRL_SINGLE | FLAG_CTRL_CMD;
+    I2C_WriteByte(I2C_DATA);       /* send control byte */
+  }
 
   /* send command */
   I2C.Byte = Cmd;                  /* copy command */
@@ -591,8 +621,8 @@ void LCD_DotPos(uint8_t x, uint8_t y)
   uint8_t           Temp;     /* temp. value */
 
   #ifdef LCD_I2C
-  /* init transfer */
-  LCD_StartTransfer(CTRL_MULTI | CTRL_CMD);
+  /* init transfer (unless part of a mixed mode transfer) */
+  if (MultiByte != 2) LCD_StartTransfer(CTRL_MULTI | CTRL_CMD);
   #endif
 
   /* horizontal position (column) */
@@ -608,7 +638,7 @@ void LCD_DotPos(uint8_t x, uint8_t y)
   LCD_Cmd(CMD_PAGE | y);           /* set page */
 
   #ifdef LCD_I2C
-  LCD_EndTransfer();               /* end transfer */
+  if (MultiByte != 2) LCD_EndTransfer();     /* end transfer */
   #endif
 }
 
@@ -692,10 +722,15 @@ void LCD_ClearLine(uint8_t Line)
   /* clear line */
   while (Line < MaxPage)           /* loop through pages */
   {
+    #ifdef LCD_I2C
+    /* init transfer: position and data */
+    LCD_StartTransfer(CTRL_MIXED);
+    #endif
+
     LCD_DotPos(X_Start, Line);     /* set dot position */
 
     #ifdef LCD_I2C
-    /* init transfer */
+    /* switch to data */
     LCD_StartTransfer(CTRL_MULTI | CTRL_DATA);
     #endif
 
@@ -861,10 +896,15 @@ void LCD_Char(unsigned char Char)
   /* read character bitmap and send it to display */
   while (y <= FONT_BYTES_Y)
   {
+    #ifdef LCD_I2C
+    /* init transfer: position and data */
+    LCD_StartTransfer(CTRL_MIXED);
+    #endif
+
     LCD_DotPos(X_Start, Page);          /* set start position */
 
     #ifdef LCD_I2C
-    /* init transfer */
+    /* switch to data */
     LCD_StartTransfer(CTRL_MULTI | CTRL_DATA);
     #endif
 
@@ -951,13 +991,18 @@ void LCD_Symbol(uint8_t ID)
   /* read character bitmap and send it to display */
   while (y <= SYMBOL_BYTES_Y)
   {
+    #ifdef LCD_I2C
+    /* init transfer: position and data */
+    LCD_StartTransfer(CTRL_MIXED);
+    #endif
+
     if (y > 1)                /* multi-page bitmap */
     {
       LCD_DotPos(X_Start, Page);        /* move to new page */
     }
 
     #ifdef LCD_I2C
-    /* init transfer */
+    /* switch to data */
     LCD_StartTransfer(CTRL_MULTI | CTRL_DATA);
     #endif
 
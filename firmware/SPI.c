@@ -161,6 +161,10 @@ void SPI_Write_Byte(uint8_t Byte)
 {
   uint8_t           n = 8;         /* counter */
 
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_BUS]++;      /* count byte */
+  #endif
+
   /*
    *  expected state:
    *  - SCK low
@@ -213,6 +217,67 @@ void SPI_Write_Byte(uint8_t Byte)
 
 
 
+#ifdef SPI_REPEAT
+
+/*
+ *  write a block of bytes repeatedly
+ *  - for filling areas of color displays
+ *
+ *  requires:
+ *  - Data: pointer to block of bytes
+ *  - Size: number of bytes in block
+ *  - Count: number of repetitions
+ */
+
+void SPI_Write_Repeat(uint8_t *Data, uint8_t Size, uint16_t Count)
+{
+  uint8_t           *Ptr;          /* pointer to current byte */
+  uint8_t           n;             /* byte counter */
+
+  while (Count > 0)           /* for all repetitions */
+  {
+    Ptr = Data;                    /* reset pointer */
+    n = Size;                      /* reset counter */
+
+    while (n > 0)             /* for all bytes in block */
+    {
+      SPI_Write_Byte(*Ptr);        /* write byte */
+      Ptr++;                       /* next byte */
+      n--;                         /* next one */
+    }
+
+    Count--;                       /* next repetition */
+  }
+}
+
+#endif
+
+
+
+#ifdef SPI_BLOCK
+
+/*
+ *  write a block of bytes
+ *
+ *  requires:
+ *  - Data: pointer to block of bytes
+ *  - Size: number of bytes in block
+ */
+
+void SPI_Write_Block(uint8_t *Data, uint16_t Size)
+{
+  while (Size > 0)            /* for all bytes in block */
+  {
+    SPI_Write_Byte(*Data);         /* write byte */
+    Data++;                        /* next byte */
+    Size--;                        /* next one */
+  }
+}
+
+#endif
+
+
+
 #ifdef SPI_RW
 
 /*
@@ -354,6 +419,27 @@ uint8_t SPI_WriteRead_Byte(uint8_t Byte)
   return Byte2;
 }
 
+
+
+/*
+ *  read a block of bytes
+ *  - writes dummy bytes (0)
+ *
+ *  requires:
+ *  - Data: pointer to buffer
+ *  - Size: number of bytes to read
+ */
+
+void SPI_Read_Block(uint8_t *Data, uint8_t Size)
+{
+  while (Size > 0)            /* for all bytes */
+  {
+    *Data = SPI_WriteRead_Byte(0); /* write dummy byte and read byte */
+    Data++;                        /* next byte */
+    Size--;                        /* next one */
+  }
+}
+
 #endif
 
 
@@ -465,6 +551,10 @@ void SPI_Setup(void)
 
 void SPI_Write_Byte(uint8_t Byte)
 {
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_BUS]++;      /* count byte */
+  #endif
+
   /* send byte */
   SPDR = Byte;                     /* start transmission */
   while (!(SPSR & (1 << SPIF)));   /* wait for flag */
@@ -473,6 +563,109 @@ void SPI_Write_Byte(uint8_t Byte)
 
 
 
+#ifdef SPI_REPEAT
+
+/*
+ *  write a block of bytes repeatedly
+ *  - for filling areas of color displays
+ *  - accesses SPI registers directly to keep the gap between
+ *    bytes small (the next byte is fetched and pointer and
+ *    counters are updated while the current byte is being sent)
+ *
+ *  requires:
+ *  - Data: pointer to block of bytes
+ *  - Size: number of bytes in block
+ *  - Count: number of repetitions
+ */
+
+void SPI_Write_Repeat(uint8_t *Data, uint8_t Size, uint16_t Count)
+{
+  uint8_t           *Ptr;          /* pointer to current byte */
+  uint8_t           n;             /* byte counter */
+  uint8_t           Byte;          /* next byte */
+
+  if (Size == 0) return;           /* nothing to send */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_BUS] += (uint32_t)Size * Count;   /* count bytes */
+  #endif
+
+  Ptr = Data;                      /* start of block */
+  n = Size;                        /* bytes in block */
+  Byte = *Ptr;                     /* get first byte */
+
+  while (Count > 0)           /* for all repetitions */
+  {
+    SPDR = Byte;                        /* start transmission */
+
+    /* prepare next byte while current one is being sent */
+    Ptr++;                              /* next byte */
+    n--;                                /* next one */
+    if (n == 0)                         /* end of block */
+    {
+      Ptr = Data;                       /* reset pointer */
+      n = Size;                         /* reset counter */
+      Count--;                          /* next repetition */
+    }
+    Byte = *Ptr;                        /* get next byte */
+
+    while (!(SPSR & (1 << SPIF)));      /* wait for flag */
+  }
+
+  n = SPDR;                        /* clear flag by reading data */
+}
+
+#endif
+
+
+
+#ifdef SPI_BLOCK
+
+/*
+ *  write a block of bytes
+ *  - for bulk transfers to displays
+ *  - the next byte is fetched while the current one is being sent,
+ *    so the next transmission starts right after SPIF is set
+ *
+ *  requires:
+ *  - Data: pointer to block of bytes
+ *  - Size: number of bytes in block
+ */
+
+void SPI_Write_Block(uint8_t *Data, uint16_t Size)
+{
+  uint8_t           Byte;          /* next byte */
+
+  if (Size == 0) return;           /* nothing to send */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_BUS] += Size;     /* count bytes */
+  #endif
+
+  Byte = *Data;                    /* get first byte */
+
+  while (Size > 0)            /* for all bytes in block */
+  {
+    SPDR = Byte;                        /* start transmission */
+
+    /* prepare next byte while current one is being sent */
+    Size--;                             /* one byte less */
+    if (Size > 0)                       /* more bytes to follow */
+    {
+      Data++;                           /* next byte */
+      Byte = *Data;                     /* get next byte */
+    }
+
+    while (!(SPSR & (1 << SPIF)));      /* wait for flag */
+  }
+
+  Byte = SPDR;                     /* clear flag by reading data */
+}
+
+#endif
+
+
+
 #ifdef SPI_RW
 
 /*
@@ -499,6 +692,29 @@ uint8_t SPI_WriteRead_Byte(uint8_t Byte)
   return Byte2;
 }
 
+
+
+/*
+ *  read a block of bytes
+ *  - writes dummy bytes (0)
+ *
+ *  requires:
+ *  - Data: pointer to buffer
+ *  - Size: number of bytes to read
+ */
+
+void SPI_Read_Block(uint8_t *Data, uint8_t Size)
+{
+  while (Size > 0)            /* for all bytes */
+  {
+    SPDR = 0;                           /* start transmission */
+    Size--;                             /* next one */
+    while (!(SPSR & (1 << SPIF)));      /* wait for flag */
+    *Data = SPDR;                       /* get received byte */
+    Data++;                             /* next byte */
+  }
+}
+
 #endif
 
 #endif
@@ -400,6 +400,7 @@ void LCD_Data(uint8_t Data)
 #define CTRL_DATA        0b00000010     /* data */
 #define CTRL_SINGLE      0b00000100     /* single byte */
 #define CTRL_MULTI       0b00001000     /* multiple bytes */
+#define CTRL_MIXED       0b00010000     /* commands followed by data */
 
 
 
@@ -409,6 +410,26 @@ void LCD_Data(uint8_t Data)
 
 /* single/multi byte control */
 uint8_t             MultiByte;     /* control flag */
+                                   /* 0: single, 1: multi, 2: mixed */
+
+#ifdef I2C_TWI_IRQ
+/*
+ *  double buffer for queued I2C transfers
+ *  - a transfer is collected in a buffer and queued as a single job
+ *  - the next transfer is collected in the other buffer meanwhile
+ *  - buffer size covers setting the position and a page of a character
+ *    or symbol, larger transfers are split into several jobs
+ */
+
+#define LCD_BUFFER_SIZE  40        /* bytes per buffer */
+
+uint8_t             LCD_Buffer[2][LCD_BUFFER_SIZE];   /* buffers */
+uint8_t             LCD_BufferID;       /* active buffer */
+uint8_t             LCD_BufferPos;      /* fill level of active buffer */
+uint8_t             LCD_Control;        /* control byte of transfer */
+uint8_t             LCD_Queued;         /* number of jobs queued */
+volatile uint8_t    LCD_Done;           /* number of jobs done */
+#endif
 
 
 
@@ -439,11 +460,100 @@ void LCD_BusSetup(void)
 
 
 
+#ifdef I2C_TWI_IRQ
+
+/*
+ *  callback for queued I2C job
+ *  - run in interrupt context
+ *
+ *  requires:
+ *  - Result: I2C_OK or I2C_ERROR (ignored)
+ */
+
+void LCD_JobDone(uint8_t Result)
+{
+  LCD_Done++;                 /* one more job done */
+}
+
+
+
+/*
+ *  prepare active buffer for new data
+ *  - waits until buffer isn't used by a pending job anymore
+ */
+
+void LCD_NewBuffer(void)
+{
+  /* other buffer may be pending, but not this one */
+  while ((uint8_t)(LCD_Queued - LCD_Done) > 1)
+  {
+    wdt_reset();              /* reset watchdog */
+  }
+
+  LCD_BufferPos = 0;          /* reset fill level */
+}
+
+
+
+/*
+ *  queue active buffer as I2C job and switch buffers
+ */
+
+void LCD_QueueBuffer(void)
+{
+  if (LCD_BufferPos == 0) return;       /* nothing to send */
+
+  LCD_Queued++;                         /* one more job */
+  I2C_Queue(LCD_I2C_ADDR, &LCD_Buffer[LCD_BufferID][0], LCD_BufferPos, I2C_JOB_WRITE, LCD_JobDone);
+
+  LCD_BufferID ^= 1;                    /* switch buffers */
+  LCD_BufferPos = 0;                    /* reset fill level */
+}
+
+#endif
+
+
+
+/*
+ *  send byte via I2C
+ *  - I2C_TWI_IRQ: add byte to active buffer and split transfer
+ *    when buffer is full (the display keeps its position and the
+ *    continued transfer starts with the same control byte)
+ *
+ *  requires:
+ *  - Byte: byte to send
+ */
+
+void LCD_SendByte(uint8_t Byte)
+{
+  #ifdef I2C_TWI_IRQ
+  if (LCD_BufferPos >= LCD_BUFFER_SIZE)      /* buffer full */
+  {
+    LCD_QueueBuffer();                  /* send buffer */
+    LCD_NewBuffer();                    /* continue with other buffer */
+    LCD_Buffer[LCD_BufferID][0] = LCD_Control;
+    LCD_BufferPos = 1;
+  }
+
+  LCD_Buffer[LCD_BufferID][LCD_BufferPos] = Byte;
+  LCD_BufferPos++;
+  #else
+  I2C.Byte = Byte;                 /* copy byte */
+  I2C_WriteByte(I2C_DATA);         /* send byte */
+  #endif
+}
+
+
+
 /*
  *  start sending I2C data
  *  - set up I2C transfer
  *  - send control byte
  *  - manage single/multi byte mode
+ *  - mixed mode: commands are sent with a control byte each and
+ *    a following call with CTRL_MULTI | CTRL_DATA switches the
+ *    running transfer to data, i.e. setting the position and
+ *    sending a page of data takes a single I2C transfer
  *
  *  requires:
  *  - Mode:
@@ -451,33 +561,59 @@ void LCD_BusSetup(void)
  *    CTRL_DATA    data
  *    CTRL_SINGLE  single byte
  *    CTRL_MULTI   multiple bytes
+ *    CTRL_MIXED   mixed commands and data
  */
 
 void LCD_StartTransfer(uint8_t Mode)
 {
   uint8_t           Byte;          /* control byte */
+  uint8_t           Flag = 1;      /* control byte flag */
+
+  /* start transfer (unless mixed mode transfer is running) */
+  if (MultiByte != 2)              /* no mixed mode */
+  {
+    #ifdef I2C_TWI_IRQ
+    /* new buffer (start and address are handled by job) */
+    LCD_NewBuffer();
+    #else
+    Flag = 0;                      /* reset flag */
+
+    if (I2C_Start(I2C_START) == I2C_OK)             /* start */
+    {
+      I2C.Byte = LCD_I2C_ADDR << 1;       /* address (7 bit & write) */
+
+      if (I2C_WriteByte(I2C_ADDRESS) == I2C_ACK)    /* address slave */
+      {
+        Flag = 1;                         /* send control byte */
+      }
+    }
+    #endif
+  }
 
   /* update control flag */
-  if (Mode & CTRL_MULTI)           /* multi byte mode */
+  if (Mode & CTRL_MIXED)           /* mixed mode */
+  {
+    MultiByte = 2;                 /* set flag */
+    Flag = 0;                      /* LCD_Cmd() sends control bytes */
+  }
+  else if (Mode & CTRL_MULTI)      /* multi byte mode */
   {
     MultiByte = 1;                 /* set flag */
   }
 
-  /* init control byte */
-  Byte = LCD_CONTROL_BYTE;
-  if (Mode & CTRL_SINGLE) Byte |= FLAG_CTRL_SINGLE;    /* single byte mode */
-  if (Mode & CTRL_DATA) Byte |= FLAG_CTRL_DATA;        /* data mode */
-  /* flags for multi byte mode and command mode are 0 */
-
-  if (I2C_Start(I2C_START) == I2C_OK)             /* start */
+  if (Flag)                        /* send control byte */
   {
-    I2C.Byte = LCD_I2C_ADDR << 1;       /* address (7 bit & write) */
+    /* init control byte */
+    Byte = LCD_CONTROL_BYTE;
+    if (Mode & CTRL_SINGLE) Byte |= FLAG_CTRL_SINGLE;  /* single byte mode */
+    if (Mode & CTRL_DATA) Byte |= FLAG_CTRL_DATA;      /* data mode */
+    /* flags for multi byte mode and command mode are 0 */
+
+    #ifdef I2C_TWI_IRQ
+    LCD_Control = Byte;            /* for split transfers */
+    #endif
 
-    if (I2C_WriteByte(I2C_ADDRESS) == I2C_ACK)    /* address slave */
-    {
-      I2C.Byte = Byte;                  /* copy control byte */
-      I2C_WriteByte(I2C_DATA);          /* send byte */
-    }
+    LCD_SendByte(Byte);            /* send control byte */
   }
 
   /* todo: error handling? */
@@ -497,7 +633,11 @@ void LCD_EndTransfer(void)
   MultiByte = 0;              /* single byte mode */
 
   /* end I2C transfer */
+  #ifdef I2C_TWI_IRQ
+  LCD_QueueBuffer();          /* queue job */
+  #else
   I2C_Stop();                 /* stop */
+  #endif
 }
 
 
@@ -516,10 +656,14 @@ void LCD_Cmd(uint8_t Cmd)
     /* init transfer */
     LCD_StartTransfer(CTRL_SINGLE | CTRL_CMD);
   }
+  else if (MultiByte == 2)    /* mixed mode */
+  {
+    /* control byte for a single command */
+    LCD_SendByte(LCD_CONTROL_BYTE | FLAG_CTRL_SINGLE | FLAG_CTRL_CMD);
+  }
 
   /* send command */
-  I2C.Byte = Cmd;                  /* copy command */
-  I2C_WriteByte(I2C_DATA);         /* send command */ 
+  LCD_SendByte(Cmd);               /* send command */
 
   if (MultiByte == 0)         /* single byte mode */
   {
@@ -544,9 +688,8 @@ void LCD_Data(uint8_t Data)
     LCD_StartTransfer(CTRL_SINGLE | CTRL_DATA);
   }
 
-  /* send command */
-  I2C.Byte = Data;                 /* copy data */
-  I2C_WriteByte(I2C_DATA);         /* send data */ 
+  /* send data */
+  LCD_SendByte(Data);              /* send data */
 
   if (MultiByte == 0)         /* single byte mode */
   {
@@ -579,8 +722,8 @@ void LCD_DotPos(uint8_t x, uint8_t y)
   uint8_t           Temp;     /* temp. value */
 
   #ifdef LCD_I2C
-  /* init transfer */
-  LCD_StartTransfer(CTRL_MULTI | CTRL_CMD);
+  /* init transfer (unless part of a mixed mode transfer) */
+  if (MultiByte != 2) LCD_StartTransfer(CTRL_MULTI | CTRL_CMD);
   #endif
 
   /* horizontal position (column) */
@@ -596,7 +739,7 @@ void LCD_DotPos(uint8_t x, uint8_t y)
   LCD_Cmd(CMD_START_PAGE | y);     /* set page */
 
   #ifdef LCD_I2C
-  LCD_EndTransfer();               /* end transfer */
+  if (MultiByte != 2) LCD_EndTransfer();     /* end transfer */
   #endif
 }
 
@@ -668,10 +811,15 @@ void LCD_ClearLine(uint8_t Line)
   /* clear line */
   while (Line < MaxPage)           /* loop through pages */
   {
+    #ifdef LCD_I2C
+    /* init transfer: position and data */
+    LCD_StartTransfer(CTRL_MIXED);
+    #endif
+
     LCD_DotPos(X_Start, Line);     /* set dot position */
 
     #ifdef LCD_I2C
-    /* init transfer */
+    /* switch to data */
     LCD_StartTransfer(CTRL_MULTI | CTRL_DATA);
     #endif
 
@@ -834,10 +982,15 @@ void LCD_Char(unsigned char Char)
   /* read character bitmap and send it to display */
   while (y <= FONT_BYTES_Y)
   {
+    #ifdef LCD_I2C
+    /* init transfer: position and data */
+    LCD_StartTransfer(CTRL_MIXED);
+    #endif
+
     LCD_DotPos(X_Start, Page);          /* set start position */
 
     #ifdef LCD_I2C
-    /* init transfer */
+    /* switch to data */
     LCD_StartTransfer(CTRL_MULTI | CTRL_DATA);
     #endif
 
@@ -924,13 +1077,18 @@ void LCD_Symbol(uint8_t ID)
   /* read character bitmap and send it to display */
   while (y <= SYMBOL_BYTES_Y)
   {
+    #ifdef LCD_I2C
+    /* init transfer: position and data */
+    LCD_StartTransfer(CTRL_MIXED);
+    #endif
+
     if (y > 1)                /* multi-page bitmap */
     {
       LCD_DotPos(X_Start, Page);        /* move to new page */
     }
 
     #ifdef LCD_I2C
-    /* init transfer */
+    /* switch to data */
     LCD_StartTransfer(CTRL_MULTI | CTRL_DATA);
     #endif
 
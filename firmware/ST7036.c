@@ -27,6 +27,8 @@
  *    E       LCD_EN
  *    PSB     pull-up resistor to Vcc (enable parallel mode)
  *  - max. clock for parallel interface: 2.5MHz (3.5MHz @ 5V)
+ *  - with LCD_RW and LCD_PIN the busy flag is polled instead of
+ *    waiting the worst-case processing time
  *  - pin assignment for SPI (4-wire)
  *    XRESET      Vcc or LCD_RESET (optional)
  *    CSB         Gnd or LCD_CS (optional)
@@ -192,6 +194,59 @@ void LCD_SendNibble(uint8_t Nibble)
 
 
 
+#ifdef LCD_BUSY_FLAG
+
+/*
+ *  wait until LCD isn't busy anymore
+ *  - reads busy flag (DB7) in 4 bit mode
+ *  - keeps state of RS
+ *  - timeout after about 5ms
+ */
+
+void LCD_WaitBusy(void)
+{
+  uint8_t           RS;            /* state of RS */
+  uint8_t           Busy;          /* busy flag */
+  uint16_t          Timeout = 1000;     /* timeout counter */
+
+  /* save state of RS */
+  RS = LCD_PORT & (1 << LCD_RS);
+
+  /* data lines: input mode without pull-up resistors */
+  LCD_DDR &= ~((1 << LCD_DB4) | (1 << LCD_DB5) | (1 << LCD_DB6) | (1 << LCD_DB7));
+  LCD_PORT &= ~((1 << LCD_DB4) | (1 << LCD_DB5) | (1 << LCD_DB6) | (1 << LCD_DB7) | (1 << LCD_RS));
+
+  /* read mode for busy flag and address counter: RS low, R/W high */
+  LCD_PORT |= (1 << LCD_RW);       /* set R/W high */
+
+  do
+  {
+    /* upper nibble: busy flag and bits 6-4 of address counter */
+    LCD_PORT |= (1 << LCD_EN);     /* set E high */
+    wait1us();                     /* data delay time */
+    Busy = LCD_PIN & (1 << LCD_DB7);    /* read busy flag */
+    LCD_PORT &= ~(1 << LCD_EN);    /* set E low */
+    wait1us();                     /* enable low pulse time */
+
+    /* lower nibble: bits 3-0 of address counter (ignored) */
+    LCD_PORT |= (1 << LCD_EN);     /* set E high */
+    wait1us();                     /* data delay time */
+    LCD_PORT &= ~(1 << LCD_EN);    /* set E low */
+    wait1us();                     /* enable low pulse time */
+
+    Timeout--;                     /* decrease timeout */
+  } while (Busy && Timeout);
+
+  /* back to write mode */
+  LCD_PORT &= ~(1 << LCD_RW);      /* set R/W low */
+  LCD_PORT |= RS;                  /* restore RS */
+  LCD_DDR |= (1 << LCD_DB4) | (1 << LCD_DB5) | (1 << LCD_DB6) | (1 << LCD_DB7);
+}
+
+#endif
+
+
+
 /*
  *  send a byte (data or command) to the LCD
  *  - send byte as two nibbles (MSB first, LSB last)
@@ -204,6 +259,11 @@ void LCD_Send(uint8_t Byte)
 {
   uint8_t           Nibble;
 
+  #ifdef LCD_BUSY_FLAG
+  /* wait for the LCD to finish the last command or data */
+  LCD_WaitBusy();
+  #endif
+
   #ifdef LCD_RW
   /* indicate write mode */
   LCD_PORT &= ~(1 << LCD_RW);      /* set R/W low */
@@ -217,9 +277,11 @@ void LCD_Send(uint8_t Byte)
   Nibble = Byte & 0x0F;                 /* get lower nibble */
   LCD_SendNibble(Nibble);
 
+  #ifndef LCD_BUSY_FLAG
   /* we don't read the LCD for checking the busy flag */
   /* most commands need 26.3s for processing */
   wait30us();            /* LCD needs some time for processing */
+  #endif
 
   /* clear data lines on port */  
   Nibble = ~((1 << LCD_DB4) | (1 << LCD_DB5) | (1 << LCD_DB6) | (1 << LCD_DB7));
@@ -688,7 +750,11 @@ void LCD_DisplaySetup(void)
 void LCD_Clear(void)
 {
   LCD_Cmd(CMD_CLEAR);              /* send clear command */
+  #ifdef LCD_BUSY_FLAG
+  /* next command or data will wait for the LCD (busy flag) */
+  #else
   MilliSleep(1);                   /* LCD needs some time for processing */
+  #endif
 
   /* reset character position */
   UI.CharPos_X = 1;
@@ -111,6 +111,21 @@
   #endif
 #endif
 
+#ifdef LCD_FRAMEBUFFER
+  /* framebuffer: copy of display RAM */
+  #define FB_PAGES            (LCD_DOTS_Y / 8)   /* number of pages */
+  #define FB_COLUMNS          132                /* columns of display RAM */
+  #define FB_CLEAN            0xff               /* no dirty columns */
+#endif
+
+/* drawing: framebuffer or display */
+#ifdef LCD_FRAMEBUFFER
+  #define LCD_Pos(x, y)       {FB_Column = (x); FB_Page = (y);}
+#else
+  #define LCD_Pos             LCD_DotPos
+  #define LCD_Write           LCD_Data
+#endif
+
 
 
 /*
@@ -121,6 +136,15 @@
 uint8_t             X_Start;       /* start position X (column) */
 uint8_t             Y_Start;       /* start position Y (page) */
 
+#ifdef LCD_FRAMEBUFFER
+/* framebuffer */
+uint8_t             FrameBuffer[FB_PAGES][FB_COLUMNS];  /* display RAM copy */
+uint8_t             FB_Column;     /* write position X (column) */
+uint8_t             FB_Page;       /* write position Y (page) */
+uint8_t             DirtyStart[FB_PAGES];    /* first dirty column of page */
+uint8_t             DirtyEnd[FB_PAGES];      /* last dirty column + 1 */
+#endif
+
 
 
 /* ************************************************************************
@@ -285,6 +309,99 @@ void LCD_DotPos(uint8_t x, uint8_t y)
 
 
 
+#ifdef LCD_FRAMEBUFFER
+
+/*
+ *  write byte to framebuffer
+ *  - replaces LCD_Data() for drawing
+ *  - marks changed columns as dirty
+ *  - increments write position like the display's column address
+ *
+ *  requires:
+ *  - Data: byte value to write
+ */
+
+void LCD_Write(uint8_t Data)
+{
+  uint8_t           x;             /* column */
+  uint8_t           *Buffer;       /* pointer to framebuffer */
+
+  x = FB_Column;
+
+  if ((FB_Page < FB_PAGES) && (x < FB_COLUMNS))  /* within display RAM */
+  {
+    Buffer = &FrameBuffer[FB_Page][x];
+
+    if (*Buffer != Data)           /* changed */
+    {
+      *Buffer = Data;              /* update framebuffer */
+
+      /* update dirty columns of page */
+      if (x < DirtyStart[FB_Page]) DirtyStart[FB_Page] = x;
+      x++;
+      if (x > DirtyEnd[FB_Page]) DirtyEnd[FB_Page] = x;
+    }
+  }
+
+  FB_Column++;                     /* next column */
+}
+
+
+
+/*
+ *  send dirty parts of framebuffer to display
+ *  - one bulk transfer per dirty page
+ */
+
+void LCD_Flush(void)
+{
+  uint8_t           Page = 0;      /* page */
+  uint8_t           x;             /* column */
+  uint8_t           *Buffer;       /* pointer to framebuffer */
+
+  while (Page < FB_PAGES)          /* for all pages */
+  {
+    x = DirtyStart[Page];
+
+    if (x < DirtyEnd[Page])        /* dirty columns */
+    {
+      LCD_DotPos(x, Page);         /* set start position */
+
+      /* indicate data mode */
+      LCD_PORT |= (1 << LCD_A0);   /* set A0 high */
+
+      /* select chip, if pin available */
+      #ifdef LCD_CS
+        LCD_PORT &= ~(1 << LCD_CS);     /* set /CS1 low */
+      #endif
+
+      /* send dirty columns */
+      Buffer = &FrameBuffer[Page][x];
+      while (x < DirtyEnd[Page])
+      {
+        SPI_Write_Byte(*Buffer);   /* write data byte */
+        Buffer++;                  /* next byte */
+        x++;                       /* next column */
+      }
+
+      /* deselect chip, if pin available */
+      #ifdef LCD_CS
+        LCD_PORT |= (1 << LCD_CS);      /* set /CS1 high */
+      #endif
+
+      /* page is clean now */
+      DirtyStart[Page] = FB_CLEAN;
+      DirtyEnd[Page] = 0;
+    }
+
+    Page++;                        /* next page */
+  }
+}
+
+#endif
+
+
+
 /*
  *  set LCD character position
  *  - since we can't read the LCD and don't use a RAM buffer
@@ -321,7 +438,7 @@ void LCD_CharPos(uint8_t x, uint8_t y)
   Y_Start = y;                     /* update start position */
 
   /* update display */
-  LCD_DotPos(x, y);                /* set dot position */
+  LCD_Pos(x, y);                   /* set dot position */
 }
 
 
@@ -354,13 +471,13 @@ void LCD_ClearLine(uint8_t Line)
   /* clear line */
   while (Line < MaxPage)           /* loop through pages */
   {
-    LCD_DotPos(X_Start, Line);     /* set dot position */
+    LCD_Pos(X_Start, Line);        /* set dot position */
 
     /* clear page */
     n = X_Start;              /* reset counter */
     while (n < 132)           /* up to internal RAM size */
     {
-      LCD_Data(0);            /* send empty byte */
+      LCD_Write(0);           /* send empty byte */
       n++;                    /* next byte */
     }
 
@@ -378,12 +495,24 @@ void LCD_Clear(void)
 {
   uint8_t           n = 1;         /* counter */
 
+  #ifdef LCD_FRAMEBUFFER
+  /* clear framebuffer and mark all pages as dirty */
+  memset(FrameBuffer, 0, sizeof(FrameBuffer));
+  n = 0;
+  while (n < FB_PAGES)             /* for all pages */
+  {
+    DirtyStart[n] = 0;
+    DirtyEnd[n] = FB_COLUMNS;
+    n++;                           /* next page */
+  }
+  #else
   /* we have to clear all dots manually :( */
   while (n <= LCD_CHAR_Y)          /* for all lines */
   {
     LCD_ClearLine(n);              /* clear line */
     n++;                           /* next line */
   }
+  #endif
 
   LCD_CharPos(1, 1);          /* reset character position */
 }
@@ -527,14 +656,14 @@ void LCD_Char(unsigned char Char)
   /* read character bitmap and send it to display */
   while (y <= FONT_BYTES_Y)
   {
-    LCD_DotPos(X_Start, Page);          /* set start position */
+    LCD_Pos(X_Start, Page);             /* set start position */
 
     /* read and send all column bytes for this row */
     x = 1;
     while (x <= FONT_BYTES_X)
     {
       Index = pgm_read_byte(Table);     /* read byte */
-      LCD_Data(Index);                  /* send byte */
+      LCD_Write(Index);                 /* send byte */
       Table++;                          /* address for next byte */
       x++;                              /* next byte */
     }
@@ -571,6 +700,10 @@ void LCD_Cursor(uint8_t Mode)
   {
     LCD_Char(' ');
   }
+
+  #ifdef LCD_FRAMEBUFFER
+  LCD_Flush();           /* update display */
+  #endif
 }
 
 
@@ -610,7 +743,7 @@ void LCD_Symbol(uint8_t ID)
   {
     if (y > 1)                /* multi-page bitmap */
     {
-      LCD_DotPos(X_Start, Page);        /* move to new page */
+      LCD_Pos(X_Start, Page);           /* move to new page */
     }
 
     /* read and send all column bytes for this row */
@@ -618,7 +751,7 @@ void LCD_Symbol(uint8_t ID)
     while (x <= SYMBOL_BYTES_X)
     {
       Data = pgm_read_byte(Table);      /* read byte */
-      LCD_Data(Data);                   /* send byte */
+      LCD_Write(Data);                  /* send byte */
       Table++;                          /* address for next byte */
       x++;                              /* next byte */
     }
@@ -638,6 +771,19 @@ void LCD_Symbol(uint8_t ID)
  *   clean-up of local constants
  * ************************************************************************ */
 
+/* drawing */
+#undef LCD_Pos
+#ifndef LCD_FRAMEBUFFER
+  #undef LCD_Write
+#endif
+
+/* framebuffer */
+#ifdef LCD_FRAMEBUFFER
+  #undef FB_PAGES
+  #undef FB_COLUMNS
+  #undef FB_CLEAN
+#endif
+
 /* source management */
 #undef LCD_DRIVER_C
 
@@ -152,6 +152,12 @@ uint16_t            Y_End;         /* end position Y (row) */
 /* text line management */
 uint16_t            LineFlags;     /* bitfield for up to 16 lines */
 
+#ifdef FONT_CACHE
+/* font cache */
+uint8_t             FontCache[FONT_CACHE_CHARS][FONT_BYTES_N];   /* glyph bitmaps */
+uint8_t             FontCacheID[FONT_CACHE_CHARS];     /* font index of glyphs */
+#endif
+
 
 
 /* ************************************************************************
@@ -296,7 +302,7 @@ void LCD_Data(uint8_t Data)
 
 void LCD_Data2(uint16_t Data)
 {
-  uint8_t           Byte;     /* data byte */
+  uint8_t           Bytes[2]; /* data bytes */
 
   /* indicate data mode */
   LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
@@ -306,11 +312,42 @@ void LCD_Data2(uint16_t Data)
     LCD_PORT &= ~(1 << LCD_CS);    /* set /CSX low */
   #endif
 
-  Byte = (uint8_t)Data;            /* save LSB */
-  Data >>= 8;                      /* get MSB */
+  Bytes[0] = (uint8_t)(Data >> 8);     /* MSB */
+  Bytes[1] = (uint8_t)Data;            /* LSB */
+  SPI_Write_Block(&Bytes[0], 2);       /* send data */
+
+  /* deselect chip, if pin available */
+  #ifdef LCD_CS
+    LCD_PORT |= (1 << LCD_CS);     /* set /CSX high */
+  #endif
+}
+
+
+
+/*
+ *  send a 2-byte value repeatedly to the LCD
+ *  - selects chip and data mode just once for all repetitions
+ *
+ *  requires:
+ *  - Data: 2-byte value to send
+ *  - Count: number of repetitions
+ */
+
+void LCD_Data2_Run(uint16_t Data, uint16_t Count)
+{
+  uint8_t           Bytes[2]; /* data bytes */
+
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
+
+  /* select chip, if pin available */
+  #ifdef LCD_CS
+    LCD_PORT &= ~(1 << LCD_CS);    /* set /CSX low */
+  #endif
 
-  SPI_Write_Byte((uint8_t)Data);   /* write MSB of data */
-  SPI_Write_Byte(Byte);            /* write LSB of data */
+  Bytes[0] = (uint8_t)(Data >> 8);     /* MSB */
+  Bytes[1] = (uint8_t)Data;            /* LSB */
+  SPI_Write_Repeat(&Bytes[0], 2, Count);    /* send data */
 
   /* deselect chip, if pin available */
   #ifdef LCD_CS
@@ -491,13 +528,8 @@ void LCD_ClearLine(uint8_t Line)
   while (y > 0)                    /* rows (character height) */
   {
     x = X_Start;                   /* reset start position */
-    while (x < LCD_MAX_X)          /* all columns */
-    {
-      /* send background color */
-      LCD_Data2(COLOR_BACKGROUND);
-
-      x++;                         /* next column */
-    }
+    /* send background color for all columns */
+    LCD_Data2_Run(COLOR_BACKGROUND, LCD_MAX_X - x);
 
     y--;                           /* next row */
   }
@@ -531,6 +563,75 @@ void LCD_Clear(void)
 
 
 
+#ifdef FONT_CACHE
+
+/*
+ *  load glyphs of digits, prefixes and units into font cache
+ *  - helper function for LCD_Init()
+ *  - glyphs are stored uncompressed
+ */
+
+void LCD_FontCache(void)
+{
+  uint8_t           *Table;        /* pointer to table */
+  uint8_t           *Cache;        /* pointer to cache */
+  uint8_t           Slot = 0;      /* cache slot */
+  uint8_t           Index;         /* font index */
+  #ifdef FONT_RLE
+  uint8_t           y;             /* bitmap y byte counter */
+  uint8_t           n;             /* byte counter */
+  #endif
+
+  while (Slot < FONT_CACHE_CHARS)
+  {
+    /* get font index number of character */
+    Index = DATA_read_byte(&FontCache_table[Slot]);    /* get character */
+    Table = (uint8_t *)&FontTable;      /* start address */
+    Table += Index;                     /* add offset for character */
+    Index = pgm_read_byte(Table);       /* get index number */
+    FontCacheID[Slot] = Index;          /* 0xff for no bitmap */
+    Cache = &FontCache[Slot][0];        /* address of cache slot */
+
+    if (Index != 0xff)                  /* character bitmap available */
+    {
+      Table = (uint8_t *)&FontData;     /* start address of font data */
+
+      #ifdef FONT_RLE
+      Table += pgm_read_word(&FontIndex[Index]);   /* address of character */
+      Bitmap_Start(Table, Cache, FONT_BYTES_X);    /* start decoder */
+      y = FONT_BYTES_Y;
+      while (y > 0)
+      {
+        Bitmap_Row(Cache, FONT_BYTES_X);      /* decode row */
+        y--;                                  /* next row */
+
+        if (y > 0)                     /* not last row */
+        {
+          /* copy row as base for next row */
+          n = 0;
+          while (n < FONT_BYTES_X)
+          {
+            Cache[FONT_BYTES_X + n] = Cache[n];
+            n++;
+          }
+        }
+
+        Cache += FONT_BYTES_X;         /* next row */
+      }
+      #else
+      Table += FONT_BYTES_N * Index;    /* address of character */
+      memcpy_P(Cache, Table, FONT_BYTES_N);     /* copy bitmap */
+      #endif
+    }
+
+    Slot++;                             /* next slot */
+  }
+}
+
+#endif
+
+
+
 /*
  *  initialize LCD
  */
@@ -605,6 +706,10 @@ void LCD_Init(void)
   UI.SymbolSize_Y = LCD_SYMBOL_CHAR_Y;  /* y size in chars */
   #endif
 
+  #ifdef FONT_CACHE
+  LCD_FontCache();                 /* load font cache */
+  #endif
+
   LineFlags = 0xffff;              /* clear all lines by default */
   LCD_Clear();                     /* clear display */
   #ifdef LCD_LATE_ON
@@ -615,6 +720,28 @@ void LCD_Init(void)
 
 
 
+/*
+ *  send a run of pixels in pen or background color
+ *  - helper function for LCD_Char() and LCD_Symbol()
+ *
+ *  requires:
+ *  - Color: pen color (RGB565)
+ *  - Level: 0 for background color, 1 for pen color
+ *  - Count: number of pixels
+ */
+
+void LCD_PixelRun(uint16_t Color, uint8_t Level, uint16_t Count)
+{
+  if (Level == 0)                  /* background */
+  {
+    Color = COLOR_BACKGROUND;      /* use background color */
+  }
+
+  LCD_Data2_Run(Color, Count);     /* send pixels */
+}
+
+
+
 /*
  *  display a single character
  *
@@ -632,6 +759,14 @@ void LCD_Char(unsigned char Char)
   uint8_t           y = 1;         /* bitmap y byte counter */
   uint8_t           Bits;          /* number of bits to be sent */
   uint8_t           n;             /* bitmap bit counter */
+  uint8_t           Level = 0;     /* pixel level of current run */
+  uint16_t          Run = 0;       /* number of pixels in current run */
+  #ifdef FONT_RLE
+  uint8_t           RowBuffer[FONT_BYTES_X];     /* decoded row */
+  #endif
+  #ifdef FONT_CACHE
+  uint8_t           Cached = 0;    /* glyph in font cache */
+  #endif
 
   /* prevent x overflow */
   if (UI.CharPos_X > LCD_CHAR_X) return;
@@ -647,10 +782,38 @@ void LCD_Char(unsigned char Char)
    *  manage addressing
    */
 
+  #ifdef FONT_CACHE
+  /* check font cache */
+  n = 0;
+  while (n < FONT_CACHE_CHARS)
+  {
+    if (FontCacheID[n] == Index)       /* glyph cached */
+    {
+      Table = &FontCache[n][0];        /* read bitmap from RAM */
+      Cached = 1;
+      break;
+    }
+    n++;                               /* next slot */
+  }
+
+  if (Cached == 0)                     /* not cached */
+  {
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&FontData;        /* start address of font data */
+  #ifdef FONT_RLE
+  Offset = pgm_read_word(&FontIndex[Index]);  /* offset for character */
+  Table += Offset;                     /* address of character data */
+  Bitmap_Start(Table, RowBuffer, FONT_BYTES_X);     /* start decoder */
+  #else
   Offset = FONT_BYTES_N * Index;       /* offset for character */
   Table += Offset;                     /* address of character data */
+  #endif
+
+  #ifdef FONT_CACHE
+  }
+  #endif
 
   /* LCD's address window */
   LCD_CharPos(UI.CharPos_X, UI.CharPos_Y);   /* update character position */
@@ -677,6 +840,15 @@ void LCD_Char(unsigned char Char)
   /* read character bitmap and send it to display */
   while (y <= FONT_BYTES_Y)
   {
+    #ifdef FONT_RLE
+    #ifdef FONT_CACHE
+    if (Cached == 0)                    /* compressed bitmap */
+    #endif
+    {
+      Bitmap_Row(RowBuffer, FONT_BYTES_X);   /* decode next row */
+      Table = RowBuffer;                /* read row from buffer */
+    }
+    #endif
     Pixels = FONT_SIZE_X;               /* track x bits to be sent */
     x = 1;                              /* reset counter */
 
@@ -694,21 +866,28 @@ void LCD_Char(unsigned char Char)
       }
       Pixels -= Bits;              /* update counter */
 
+      #if defined (FONT_RLE)
+      Index = *Table;                   /* read byte from buffer */
+      #elif defined (FONT_CACHE)
+      if (Cached) Index = *Table;       /* read byte from cache */
+      else Index = pgm_read_byte(Table);     /* read byte */
+      #else
       Index = pgm_read_byte(Table);     /* read byte */
+      #endif
 
       /* send color for each bit */
       n = Bits;
       while (n > 0)
       {
-        if (Index & 0b00000001)         /* bit set */
-        {
-          LCD_Data2(Offset);            /* foreground color */
-        }
-        else                            /* bit unset */
+        if ((Index & 0b00000001) != Level)   /* pixel level changes */
         {
-          LCD_Data2(COLOR_BACKGROUND);  /* background color */
+          LCD_PixelRun(Offset, Level, Run);   /* send pending run */
+          Level ^= 1;                         /* toggle level */
+          Run = 0;                            /* reset counter */
         }
 
+        Run++;                                /* one more pixel */
+
         Index >>= 1;                      /* shift byte for next bit */
         n--;                              /* next bit */
       }
@@ -720,6 +899,9 @@ void LCD_Char(unsigned char Char)
     y++;                                /* next row */
   }
 
+  /* send last run of pixels */
+  LCD_PixelRun(Offset, Level, Run);
+
   UI.CharPos_X++;             /* update character position */
 }
 
@@ -775,12 +957,23 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           y = 1;         /* bitmap y byte counter */
   uint8_t           Bits;          /* number of bits to be sent */
   uint8_t           n;             /* bitmap bit counter */
+  uint8_t           Level = 0;     /* pixel level of current run */
+  uint16_t          Run = 0;       /* number of pixels in current run */
   uint8_t           Factor = SYMBOL_RESIZE;  /* resize factor */
+  #ifdef SYMBOLS_RLE
+  uint8_t           RowBuffer[SYMBOL_BYTES_X];   /* decoded row */
+  #endif
 
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
+  #ifdef SYMBOLS_RLE
+  Offset = pgm_read_word(&SymbolIndex[ID]);  /* offset for symbol */
+  Table += Offset;                      /* address of symbol data */
+  Bitmap_Start(Table, RowBuffer, SYMBOL_BYTES_X);   /* start decoder */
+  #else
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
   Table += Offset;                      /* address of symbol data */
+  #endif
 
   /* LCD's address window */
   LCD_CharPos(UI.CharPos_X, UI.CharPos_Y);   /* update character position */
@@ -807,6 +1000,10 @@ void LCD_Symbol(uint8_t ID)
   /* read symbol bitmap and send it to display */
   while (y <= SYMBOL_BYTES_Y)
   {
+    #ifdef SYMBOLS_RLE
+    Bitmap_Row(RowBuffer, SYMBOL_BYTES_X);   /* decode next row */
+    Table = RowBuffer;        /* read row from buffer */
+    #endif
     Table2 = Table;           /* save current pointer */
 
     while (Factor > 0)        /* resize symbol */
@@ -830,7 +1027,11 @@ void LCD_Symbol(uint8_t ID)
         }
         Pixels -= Bits;            /* update counter */
 
+        #ifdef SYMBOLS_RLE
+        Data = *Table;                  /* read byte from buffer */
+        #else
         Data = pgm_read_byte(Table);    /* read byte */
+        #endif
 
         /* send color for each bit */
         n = Bits;                       /* reset counter */
@@ -838,15 +1039,15 @@ void LCD_Symbol(uint8_t ID)
 
         while (n > 0)                   /* x pixels */
         {
-          if (Data & 0b00000001)             /* bit set */
+          if ((Data & 0b00000001) != Level)   /* pixel level changes */
           {
-            LCD_Data2(Offset);               /* foreground color */
-          }
-          else                               /* bit unset */
-          {
-            LCD_Data2(COLOR_BACKGROUND);     /* background color */
+            LCD_PixelRun(Offset, Level, Run);   /* send pending run */
+            Level ^= 1;                         /* toggle level */
+            Run = 0;                            /* reset counter */
           }
 
+          Run++;                                /* one more pixel */
+
           n--;                          /* next pixel */
 
           if (n % SYMBOL_RESIZE == 0)   /* for every resize step */
@@ -870,6 +1071,9 @@ void LCD_Symbol(uint8_t ID)
     }              
   }
 
+  /* send last run of pixels */
+  LCD_PixelRun(Offset, Level, Run);
+
   /* mark text lines as used */
   n = LCD_SYMBOL_CHAR_Y;           /* set line counter */
   x = UI.SymbolPos_Y;              /* start line */
@@ -885,7 +1089,7 @@ void LCD_Symbol(uint8_t ID)
 
 
 
-#ifdef FUNC_COLORCODE
+#if defined (FUNC_COLORCODE) || defined (SW_SCOPE) || defined (SW_CURVE_TRACER) || defined (UI_MONITOR_GRAPH)
 
 /*
  *  draw filled box
@@ -898,7 +1102,6 @@ void LCD_Symbol(uint8_t ID)
 void LCD_Box(uint16_t Color)
 {
   uint16_t          x_Size;             /* x size */
-  uint16_t          x;                  /* x counter */
   uint16_t          y_Size;             /* y size/counter */
 
   LCD_AddressWindow();             /* set address window */
@@ -911,19 +1114,17 @@ void LCD_Box(uint16_t Color)
 
   while (y_Size > 0)               /* loop trough rows */
   {
-    x = x_Size;                    /* reset counter */    
-
-    while (x > 0)                  /* loop through columns */
-    {
-      LCD_Data2(Color);            /* send color code for dot */
-      x--;                         /* next one */
-    }
+    LCD_Data2_Run(Color, x_Size);  /* send color code for all dots */
 
     y_Size--;                      /* next one */
   }
 }
 
+#endif
+
+
 
+#ifdef FUNC_COLORCODE
 
 /*
  *  display color band of a component color code
@@ -992,6 +1193,348 @@ void LCD_Band(uint16_t Color, uint8_t Align)
 
 
 
+#ifdef SW_SCOPE
+
+/*
+ *  draw scope trace
+ *  - uses the text lines between line #2 and the last line
+ *  - each sample gets a vertical segment connecting it to the
+ *    previous sample
+ *  - trigger level and trigger position are marked by grid lines
+ *
+ *  requires:
+ *  - Buffer: pointer to ring buffer with SCOPE_SAMPLES 8 bit ADC values
+ *  - Start: index of oldest sample in ring buffer
+ *  - Level: trigger level (8 bit ADC value)
+ */
+
+void LCD_ScopeTrace(uint8_t *Buffer, uint8_t Start, uint8_t Level)
+{
+  uint16_t          Top;           /* top row of trace area */
+  uint16_t          Height;        /* height of trace area */
+  uint16_t          y;             /* row of current sample */
+  uint16_t          y_Old;         /* row of previous sample */
+  uint8_t           n;             /* counter */
+
+  /* dots per sample */
+  #define STEP_X    (LCD_PIXELS_X / SCOPE_SAMPLES)
+
+  /* mark text lines of trace area as used */
+  n = 3;                           /* first line */
+  while (n < LCD_CHAR_Y)           /* up to line before last one */
+  {
+    LCD_CharPos(1, n);             /* mark line */
+    n++;                           /* next line */
+  }
+
+  /* trace area */
+  Top = 2 * FONT_SIZE_Y;                /* below line #2 */
+  Height = (LCD_CHAR_Y - 3) * FONT_SIZE_Y;
+
+  /* clear trace area */
+  X_Start = 0;
+  X_End = LCD_PIXELS_X - 1;
+  Y_Start = Top;
+  Y_End = Top + Height - 1;
+  LCD_Box(COLOR_BACKGROUND);
+
+  /* trigger level: horizontal line */
+  y = Level * (Height - 1) / 255;       /* scale to trace height */
+  Y_Start = Top + Height - 1 - y;       /* rows grow downwards */
+  Y_End = Y_Start;
+  LCD_Box(COLOR_SCOPE_GRID);
+
+  /* trigger position: vertical line */
+  X_Start = SCOPE_PRE * STEP_X;
+  X_End = X_Start;
+  Y_Start = Top;
+  Y_End = Top + Height - 1;
+  LCD_Box(COLOR_SCOPE_GRID);
+
+  /* trace */
+  y_Old = 0;
+  n = 0;
+  while (n < SCOPE_SAMPLES)
+  {
+    y = Buffer[Start] * (Height - 1) / 255;  /* scale to trace height */
+    y = Top + Height - 1 - y;                /* rows grow downwards */
+    if (n == 0) y_Old = y;                   /* first sample */
+
+    /* vertical segment from previous to current sample */
+    if (y < y_Old)
+    {
+      Y_Start = y;
+      Y_End = y_Old;
+    }
+    else
+    {
+      Y_Start = y_Old;
+      Y_End = y;
+    }
+
+    X_Start = n * STEP_X;
+    X_End = X_Start + STEP_X - 1;
+    LCD_Box(COLOR_SCOPE_TRACE);
+
+    y_Old = y;                          /* save row */
+    Start++;                            /* next sample */
+    Start &= (SCOPE_SAMPLES - 1);       /* wrap around */
+    n++;
+  }
+
+  #undef STEP_X
+}
+
+#endif
+
+
+
+#ifdef SW_CURVE_TRACER
+
+/*
+ *  plot I-V points
+ *  - uses the text lines between line #2 and the last line
+ *  - X axis: voltage, linear from 0 to Vcc
+ *  - Y axis: current, logarithmic (base 2) from 1nA to 16mA
+ *  - each point is drawn as a small box, colored by curve ID
+ *
+ *  requires:
+ *  - Buffer: pointer to array of I-V points
+ *  - Points: number of I-V points
+ */
+
+void LCD_CurvePlot(IV_Type *Buffer, uint8_t Points)
+{
+  uint16_t          Top;           /* top row of plot area */
+  uint16_t          Height;        /* height of plot area */
+  uint16_t          x, y;          /* position of point */
+  uint16_t          Color;         /* color of point */
+  uint32_t          Value;         /* current */
+  uint8_t           n;             /* counter */
+
+  /* scale of Y axis: 24 binary decades with 8 steps each */
+  #define LOG_STEPS      (24 * 8)
+
+  /* mark text lines of plot area as used */
+  n = 3;                           /* first line */
+  while (n < LCD_CHAR_Y)           /* up to line before last one */
+  {
+    LCD_CharPos(1, n);             /* mark line */
+    n++;                           /* next line */
+  }
+
+  /* plot area */
+  Top = 2 * FONT_SIZE_Y;                /* below line #2 */
+  Height = (LCD_CHAR_Y - 3) * FONT_SIZE_Y;
+
+  /* clear plot area */
+  X_Start = 0;
+  X_End = LCD_PIXELS_X - 1;
+  Y_Start = Top;
+  Y_End = Top + Height - 1;
+  LCD_Box(COLOR_BACKGROUND);
+
+  /* axes */
+  X_End = 0;                            /* left border: I axis */
+  LCD_Box(COLOR_CURVE_GRID);
+  X_End = LCD_PIXELS_X - 1;             /* bottom border: U axis */
+  Y_Start = Y_End;
+  LCD_Box(COLOR_CURVE_GRID);
+
+  /* points */
+  n = 0;
+  while (n < Points)
+  {
+    /* X: U * (width - 3) / Vcc */
+    x = (uint32_t)Buffer->U * (LCD_PIXELS_X - 3) / Cfg.Vcc;
+    if (x > LCD_PIXELS_X - 3) x = LCD_PIXELS_X - 3;
+
+    /* Y: 8 * log2(I), using 3 bits below the MSB as fraction */
+    Value = Buffer->I;
+    y = 0;
+    if (Value > 0)
+    {
+      y = 3 * 8;                        /* MSB at bit #3 */
+      while (Value >= 16)               /* MSB above bit #3 */
+      {
+        Value >>= 1;
+        y += 8;                         /* next binary decade */
+      }
+      while (Value < 8)                 /* MSB below bit #3 */
+      {
+        Value <<= 1;
+        y -= 8;                         /* previous binary decade */
+      }
+      y += Value - 8;                   /* add fraction */
+    }
+    if (y > LOG_STEPS - 1) y = LOG_STEPS - 1;
+    y = y * (Height - 3) / LOG_STEPS;   /* scale to plot height */
+
+    /* color by curve */
+    if (Buffer->Curve == 0) Color = COLOR_CURVE_1;
+    else Color = COLOR_CURVE_2;
+
+    /* draw 3x3 box (rows grow downwards) */
+    X_Start = x;
+    X_End = x + 2;
+    Y_End = Top + Height - 1 - y;
+    Y_Start = Y_End - 2;
+    LCD_Box(Color);
+
+    Buffer++;                           /* next point */
+    n++;
+  }
+
+  #undef LOG_STEPS
+}
+
+#endif
+
+
+
+#ifdef UI_MONITOR_GRAPH
+
+/*
+ *  prepare graph area of monitor
+ *  - bar graph in line #4
+ *  - trend plot in the text lines between line #5 and the last line
+ */
+
+void LCD_GraphInit(void)
+{
+  uint8_t           n;             /* counter */
+
+  /* mark text lines of graph area as used */
+  n = 4;                           /* first line */
+  while (n < LCD_CHAR_Y)           /* up to line before last one */
+  {
+    LCD_CharPos(1, n);             /* mark line */
+    n++;                           /* next line */
+  }
+
+  /* clear graph area */
+  X_Start = 0;
+  X_End = LCD_PIXELS_X - 1;
+  Y_Start = 3 * FONT_SIZE_Y;            /* below line #3 */
+  Y_End = (LCD_CHAR_Y - 1) * FONT_SIZE_Y - 1;
+  LCD_Box(COLOR_BACKGROUND);
+}
+
+
+
+/*
+ *  draw bar graph of monitor
+ *  - uses line #4
+ *  - center tick marks the reference value
+ *
+ *  requires:
+ *  - Level: value (0-255)
+ */
+
+void LCD_GraphBar(uint8_t Level)
+{
+  uint16_t          x;             /* end of bar */
+
+  x = (uint32_t)Level * LCD_PIXELS_X / 256;
+
+  /* bar area: line #4 with top and bottom margin of 1/8 char height */
+  Y_Start = 3 * FONT_SIZE_Y + (FONT_SIZE_Y / 8);
+  Y_End = 4 * FONT_SIZE_Y - 1 - (FONT_SIZE_Y / 8);
+
+  /* bar */
+  X_Start = 0;
+  if (x > 0)
+  {
+    X_End = x - 1;
+    LCD_Box(COLOR_GRAPH_BAR);
+  }
+
+  /* remaining part */
+  if (x < LCD_PIXELS_X)
+  {
+    X_Start = x;
+    X_End = LCD_PIXELS_X - 1;
+    LCD_Box(COLOR_BACKGROUND);
+  }
+
+  /* reference tick */
+  X_Start = LCD_PIXELS_X / 2;
+  X_End = X_Start;
+  LCD_Box(COLOR_GRAPH_GRID);
+}
+
+
+
+/*
+ *  draw newest sample of monitor's trend plot
+ *  - uses the text lines between line #5 and the last line
+ *  - sweep mode: just the column of the newest sample is drawn
+ *    (vertical segment connecting it to the previous sample), while
+ *    the column of the oldest sample is cleared and marked by a line
+ *
+ *  requires:
+ *  - Buffer: pointer to ring buffer with GRAPH_SAMPLES values (0-255)
+ *  - Pos: index of newest sample in ring buffer
+ */
+
+void LCD_GraphTrend(uint8_t *Buffer, uint8_t Pos)
+{
+  uint16_t          Top;           /* top row of plot area */
+  uint16_t          Height;        /* height of plot area */
+  uint16_t          y;             /* row of current sample */
+  uint16_t          y_Old;         /* row of previous sample */
+
+  /* dots per sample */
+  #define STEP_X    (LCD_PIXELS_X / GRAPH_SAMPLES)
+
+  /* plot area */
+  Top = 4 * FONT_SIZE_Y;                /* below line #4 */
+  Height = (LCD_CHAR_Y - 5) * FONT_SIZE_Y;
+
+  /* rows of samples (rows grow downwards) */
+  y = Buffer[Pos] * (Height - 1) / 255;
+  y = Top + Height - 1 - y;
+  y_Old = Buffer[(Pos - 1) & (GRAPH_SAMPLES - 1)] * (Height - 1) / 255;
+  y_Old = Top + Height - 1 - y_Old;
+
+  /* clear column of newest sample */
+  X_Start = Pos * STEP_X;
+  X_End = X_Start + STEP_X - 1;
+  Y_Start = Top;
+  Y_End = Top + Height - 1;
+  LCD_Box(COLOR_BACKGROUND);
+
+  /* vertical segment from previous to current sample */
+  if (y < y_Old)
+  {
+    Y_Start = y;
+    Y_End = y_Old;
+  }
+  else
+  {
+    Y_Start = y_Old;
+    Y_End = y;
+  }
+  LCD_Box(COLOR_GRAPH_TREND);
+
+  /* clear column of oldest sample and mark it */
+  Pos++;
+  Pos &= (GRAPH_SAMPLES - 1);           /* wrap around */
+  X_Start = Pos * STEP_X;
+  X_End = X_Start + STEP_X - 1;
+  Y_Start = Top;
+  Y_End = Top + Height - 1;
+  LCD_Box(COLOR_BACKGROUND);
+  X_End = X_Start;                      /* sweep line */
+  LCD_Box(COLOR_GRAPH_GRID);
+
+  #undef STEP_X
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   clean-up of local constants
  * ************************************************************************ */
@@ -148,6 +148,12 @@ unsigned char       Matrix[LCD_CHAR_X * LCD_CHAR_Y];   /* char matrix */
 uint8_t             X_Start;       /* start position X (column in 16 bit steps) */
 uint8_t             Y_Start;       /* start position Y (row) */
 
+#ifdef LCD_BATCH_UPDATE
+/* batch update */
+uint8_t             DirtyLine = 0;      /* pending text line (0 = none) */
+uint8_t             DirtyWords = 0;     /* changed 16 bit steps (bitfield) */
+#endif
+
 
 
 /*
@@ -543,6 +549,106 @@ void LCD_DotPos(uint8_t x, uint8_t y)
 
 
 
+#ifdef LCD_BATCH_UPDATE
+
+/*
+ *  get single bitmap row of a character
+ *
+ *  requires:
+ *  - Char: character
+ *  - Row: bitmap row (0-)
+ *
+ *  returns:
+ *  - bitmap byte (0 if character isn't available)
+ */
+
+uint8_t LCD_GlyphRow(unsigned char Char, uint8_t Row)
+{
+  uint8_t           *Table;        /* pointer to table */
+  uint8_t           Index;         /* font index */
+  uint16_t          Offset;        /* address offset */
+
+  /* get font index number from lookup table */
+  Table = (uint8_t *)&FontTable;        /* start address */
+  Table += Char;                        /* add offset for character */
+  Index = pgm_read_byte(Table);         /* get index number */
+  if (Index == 0xff) return 0;          /* no character bitmap available */
+
+  /* calculate address of bitmap row */
+  Table = (uint8_t *)&FontData;         /* start address of font data */
+  Offset = FONT_BYTES_N * Index;        /* offset for character */
+  Offset += Row;                        /* offset for row */
+  Table += Offset;                      /* address of row data */
+
+  return pgm_read_byte(Table);
+}
+
+
+
+/*
+ *  send changed 16 bit steps of pending text line to display
+ *  - renders chars from char matrix
+ *  - sets GDRAM address once for contiguous steps in a row
+ */
+
+void LCD_Flush(void)
+{
+  unsigned char     *Buffer;       /* char matrix */
+  uint8_t           Row;           /* screen row */
+  uint8_t           y;             /* bitmap row */
+  uint8_t           x;             /* 16 bit step */
+  uint8_t           Run;           /* run of contiguous steps */
+  uint8_t           Mask;          /* bit mask for step */
+
+  if (DirtyWords == 0) return;     /* nothing to do */
+
+  /* start of pending line in char matrix */
+  Buffer = (unsigned char *)&Matrix;
+  Buffer += (DirtyLine - 1) * LCD_CHAR_X;
+
+  Row = (DirtyLine - 1) * FONT_SIZE_Y;  /* start row for screen */
+  y = 0;
+
+  while (y < FONT_BYTES_Y)         /* loop for rows */
+  {
+    x = 0;
+    Run = 0;
+    Mask = 1;
+
+    while (x < LCD_STEPS_X)        /* loop for 16 bit steps */
+    {
+      if (DirtyWords & Mask)       /* changed step */
+      {
+        if (Run == 0)              /* start of new run */
+        {
+          LCD_DotPos(x, Row);      /* set start position */
+          Run = 1;
+        }
+
+        /* send left and right char */
+        LCD_Data(LCD_GlyphRow(Buffer[2 * x], y));
+        LCD_Data(LCD_GlyphRow(Buffer[2 * x + 1], y));
+      }
+      else                         /* unchanged step */
+      {
+        Run = 0;                   /* end run */
+      }
+
+      Mask <<= 1;                  /* next step */
+      x++;
+    }
+
+    y++;                           /* next bitmap row */
+    Row++;                         /* next screen row */
+  }
+
+  DirtyWords = 0;                  /* line done */
+}
+
+#endif
+
+
+
 #ifndef LCD_ROT180
 
 /*
@@ -954,6 +1060,36 @@ void LCD_Char(unsigned char Char)
   Index = pgm_read_byte(Table1);        /* get index number */
   if (Index == 0xff) return;            /* no character bitmap available */
 
+  #ifdef LCD_BATCH_UPDATE
+  /*
+   *  batch update: just update char matrix and mark 16 bit step
+   */
+
+  if (UI.CharPos_Y > LCD_CHAR_Y) return;     /* prevent y overflow */
+
+  if (UI.CharPos_Y != DirtyLine)   /* moved to another line */
+  {
+    LCD_Flush();                   /* finish pending line */
+    DirtyLine = UI.CharPos_Y;      /* new pending line */
+  }
+
+  Buffer = (unsigned char *)&Matrix;         /* start of matrix */
+  Buffer += (UI.CharPos_Y - 1) * LCD_CHAR_X; /* offset for line */
+  Buffer += UI.CharPos_X - 1;                /* offset for column */
+
+  if (*Buffer != Char)             /* char changed */
+  {
+    *Buffer = Char;                /* update char matrix */
+    DirtyWords |= (1 << X_Start);  /* mark 16 bit step */
+  }
+
+  /* update character position */
+  if ((UI.CharPos_X % 2) == 0) X_Start++;    /* right half: next step */
+  UI.CharPos_X++;                  /* next character in current line */
+
+  return;
+  #endif
+
   /* calculate start address of character bitmap */
   Table1 = (uint8_t *)&FontData;        /* start address of font data */
   Offset = FONT_BYTES_N * Index;        /* offset for character */
@@ -1184,6 +1320,10 @@ void LCD_Cursor(uint8_t Mode)
   {
     LCD_Char(' ');
   }
+
+  #ifdef LCD_BATCH_UPDATE
+  LCD_Flush();           /* update display */
+  #endif
 }
 
 
@@ -1217,11 +1357,24 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           y;             /* bitmap y byte counter */
   uint8_t           Row;           /* screen row */
   uint8_t           StepFlag = 0;  /* offset control flag */
+  #ifdef SYMBOLS_RLE
+  uint8_t           RowBuffer[SYMBOL_BYTES_X];   /* decoded row */
+  #endif
 
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
+  #ifdef SYMBOLS_RLE
+  Offset = pgm_read_word(&SymbolIndex[ID]);  /* offset for symbol */
+  Table += Offset;                      /* address of symbol data */
+  Bitmap_Start(Table, RowBuffer, SYMBOL_BYTES_X);   /* start decoder */
+  #else
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
   Table += Offset;                      /* address of symbol data */
+  #endif
+
+  #ifdef LCD_BATCH_UPDATE
+  LCD_Flush();                          /* finish pending line */
+  #endif
 
   Row = Y_Start;                        /* get start row for screen */
 
@@ -1247,6 +1400,11 @@ void LCD_Symbol(uint8_t ID)
   {
     LCD_DotPos(X_Start, Row);           /* set start position */    
 
+    #ifdef SYMBOLS_RLE
+    Bitmap_Row(RowBuffer, SYMBOL_BYTES_X);   /* decode next row */
+    Table = RowBuffer;                  /* read row from buffer */
+    #endif
+
     /* offset symbol to match 16 bit addressing step */
     if (StepFlag & OFFSET_LEFT)         /* start offset */
     {
@@ -1257,7 +1415,11 @@ void LCD_Symbol(uint8_t ID)
     x = SYMBOL_BYTES_X;                 /* number of X bytes */
     while (x > 0)                       /* loop for X */
     {
+      #ifdef SYMBOLS_RLE
+      Data = *Table;                    /* read byte from buffer */
+      #else
       Data = pgm_read_byte(Table);      /* read byte */
+      #endif
       LCD_Data(Data);                   /* send byte */
 
       Table++;                          /* address for next byte */
@@ -1306,11 +1468,20 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           y;             /* bitmap y byte counter */
   uint8_t           Row;           /* screen row */
   uint8_t           StepFlag = 0;  /* offset control flag */
+  #ifdef SYMBOLS_RLE
+  uint8_t           RowBuffer[SYMBOL_BYTES_X];   /* decoded row */
+  #endif
 
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
+  #ifdef SYMBOLS_RLE
+  Offset = pgm_read_word(&SymbolIndex[ID]);  /* offset for symbol */
+  Table += Offset;                      /* address of symbol data */
+  Bitmap_Start(Table, RowBuffer, SYMBOL_BYTES_X);   /* start decoder */
+  #else
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
   Table += Offset;                      /* address of symbol data */
+  #endif
 
   Row = Y_Start;                        /* get start row for screen */
 
@@ -1343,6 +1514,11 @@ void LCD_Symbol(uint8_t ID)
   {
     LCD_DotPos(X_Start, Row);           /* set start position */    
 
+    #ifdef SYMBOLS_RLE
+    Bitmap_Row(RowBuffer, SYMBOL_BYTES_X);   /* decode next row */
+    Table = RowBuffer;                  /* read row from buffer */
+    #endif
+
     /* offset symbol to match 16 bit addressing step */
     if (StepFlag & OFFSET_LEFT)         /* start offset */
     {
@@ -1355,7 +1531,11 @@ void LCD_Symbol(uint8_t ID)
 
     while (x <= SYMBOL_BYTES_X)         /* loop for X */
     {
+      #ifdef SYMBOLS_RLE
+      Data = *Table;                    /* read byte from buffer */
+      #else
       Data = pgm_read_byte(Table);      /* read byte */
+      #endif
       LCD_Data(Data);                   /* send byte */
 
       Table--;                          /* address for next byte */
@@ -48,6 +48,10 @@
 uint8_t             Color = 0;     /* foreground color ID */
 #endif
 
+/* cursor position of terminal (0 = unknown) */
+uint8_t             Cursor_X = 0;  /* x position */
+uint8_t             Cursor_Y = 0;  /* y position */
+
 
 
 /* ************************************************************************
@@ -130,6 +134,50 @@ void LCD_SetColor(uint8_t ID)
 
 
 
+/*
+ *  move terminal's cursor to current character position
+ *  - sends escape sequence only if cursor isn't there already
+ *  - moving right within the same line uses the shorter sequence
+ */
+
+void LCD_SyncCursor(void)
+{
+  uint8_t           x;             /* x position */
+  uint8_t           y;             /* y position */
+
+  x = UI.CharPos_X;
+  y = UI.CharPos_Y;
+
+  if ((x == Cursor_X) && (y == Cursor_Y))    /* already there */
+  {
+    return;                        /* nothing to do */
+  }
+
+  Serial_Char(VT100_ESCAPE);       /* send: escape */
+  Serial_Char('[');                /* send: [ */
+
+  if ((y == Cursor_Y) && (x > Cursor_X) && (Cursor_X > 0))
+  {
+    /* move cursor forward: Esc[<n>C */
+    LCD_SendNumber(x - Cursor_X);  /* send number of columns */
+    Serial_Char('C');              /* send: C */
+  }
+  else
+  {
+    /* move cursor to screen location x,y: Esc[<y>;<x>H */
+    LCD_SendNumber(y);             /* send y pos */
+    Serial_Char(';');              /* send: ; */
+    LCD_SendNumber(x);             /* send x pos */
+    Serial_Char('H');              /* send: H */
+  }
+
+  /* update cursor position */
+  Cursor_X = x;
+  Cursor_Y = y;
+}
+
+
+
 /* ************************************************************************
  *   high level functions
  * ************************************************************************ */
@@ -138,6 +186,8 @@ void LCD_SetColor(uint8_t ID)
 /*
  *  set LCD character position
  *  - top left: 1/1
+ *  - terminal's cursor is moved when the next output happens
+ *    (see LCD_SyncCursor())
  *
  *  requires:
  *  - x:  horizontal position (1-)
@@ -149,14 +199,6 @@ void LCD_CharPos(uint8_t x, uint8_t y)
   /* update UI */
   UI.CharPos_X = x;
   UI.CharPos_Y = y;
-
-  /* move cursor to screen location x,y: Esc[<y>;<x>H */
-  Serial_Char(VT100_ESCAPE);       /* send: escape */
-  Serial_Char('[');                /* send: [ */
-  LCD_SendNumber(y);               /* send y pos */
-  Serial_Char(';');                /* send: ; */
-  LCD_SendNumber(x);               /* send x pos */
-  Serial_Char('H');                /* send: H */
 }
 
 
@@ -180,6 +222,7 @@ void LCD_ClearLine(uint8_t Line)
   }
 
   LCD_CharPos(X, Line);       /* set char position */
+  LCD_SyncCursor();           /* and move cursor there */
 
   /*
    *  clear entire line: Esc[2K
@@ -239,6 +282,7 @@ void LCD_Init(void)
   LCD_SetColor(COLOR_BACKGROUND + 10);
   #endif
 
+  Cursor_X = 0;                    /* cursor position unknown */
   LCD_Clear();                     /* clear display */
 }
 
@@ -264,10 +308,14 @@ void LCD_Char(unsigned char Char)
   }
   #endif
 
+  LCD_SyncCursor();                /* move cursor to char position */
   Serial_Char(Char);               /* send character */
 
   /* update character position */
   UI.CharPos_X++;                  /* next character in current line */
+  /* terminal's cursor moves also, but might stop at the right margin */
+  if (Cursor_X < LCD_CHAR_X) Cursor_X++;
+  else Cursor_X = 0;               /* unknown */
 }
 
 
@@ -106,6 +106,15 @@ void SetAdjustmentDefaults(void)
   NV.RefOffset = UREF_OFFSET;           /* offset of internal band-gap reference */
   NV.CompOffset = COMPARATOR_OFFSET;    /* offset of analog comparator */
   NV.Contrast = LCD_CONTRAST;           /* display contrast */
+  #ifdef RING_TESTER_AUTO
+  NV.RingMin = RING_TESTER_MIN;         /* ring tester: pass threshold */
+  #endif
+  #ifdef UI_PRESETS
+  NV.Preset = PRESET_FULL;              /* measurement preset */
+  #endif
+  #ifdef UI_ENGLISH_2ND
+  NV.Language = LANGUAGE_1ST;           /* UI language */
+  #endif
 
   #ifdef HW_TOUCH
   /* set defaults for touch screen */
@@ -119,6 +128,75 @@ void SetAdjustmentDefaults(void)
 
 
 
+#ifdef ADJUST_WEAR_LEVEL
+
+/*
+ *  get EEPROM slot of adjustment profile
+ *  - each profile has ADJUST_SLOTS slots which are written in turn
+ *  - the slot with the highest sequence number is the current one
+ *  - unwritten slots have a checksum of 0 (only first slot has defaults)
+ *  - for saving the next slot is selected and NV.Sequence is updated
+ *
+ *  requires:
+ *  - Base: pointer to first slot in EEPROM
+ *  - Mode: storage mode
+ *    STORAGE_SAVE - save
+ *    STORAGE_LOAD - load
+ *
+ *  returns:
+ *  - pointer to slot in EEPROM
+ */
+
+uint8_t *GetAdjustmentSlot(uint8_t *Base, uint8_t Mode)
+{
+  Adjust_Type       *Slot;              /* pointer to slots */
+  uint8_t           n = 0;              /* counter */
+  uint8_t           Newest = 0;         /* current slot */
+  uint8_t           Seq = 0;            /* sequence number of current slot */
+  uint8_t           Flag = 0;           /* control flag */
+  uint8_t           Test;               /* temp. value */
+
+  Slot = (Adjust_Type *)Base;
+
+  /* find newest slot (sequence number wraps around) */
+  while (n < ADJUST_SLOTS)
+  {
+    Test = eeprom_read_byte(&Slot[n].CheckSum);
+
+    if (Test != 0)                 /* slot written */
+    {
+      Test = eeprom_read_byte(&Slot[n].Sequence);
+
+      if ((Flag == 0) || ((int8_t)(Test - Seq) > 0))  /* first or newer */
+      {
+        Seq = Test;                /* save sequence number */
+        Newest = n;                /* save slot */
+        Flag = 1;                  /* got written slot */
+      }
+    }
+
+    n++;                           /* next slot */
+  }
+
+  if (Mode == STORAGE_SAVE)        /* write */
+  {
+    if (Flag)                      /* got written slot */
+    {
+      Newest++;                    /* next slot */
+      if (Newest >= ADJUST_SLOTS) Newest = 0;     /* wrap around */
+    }
+
+    Seq++;                         /* next sequence number */
+    NV.Sequence = Seq;             /* update sequence number */
+  }
+
+  return (uint8_t *)&Slot[Newest];
+}
+
+#endif
+
+
+
 #ifdef HW_TOUCH
 
   /*
@@ -191,8 +269,11 @@ uint8_t DataStorage(uint8_t *Data_RAM, uint8_t *Data_EE, uint8_t Size, uint8_t M
 
   if (Mode == STORAGE_SAVE)             /* write */
   {
-    /* write data block from RAM to EEPROM */
-    eeprom_write_block(Data_RAM, Data_EE, Size);
+    /* write data block from RAM to EEPROM (changed bytes only) */
+    #ifdef SW_PERF_COUNTERS
+    PerfCount[PERF_EEPROM]++; /* count EEPROM write */
+    #endif
+    eeprom_update_block(Data_RAM, Data_EE, Size);
   }
   else                                  /* read */
   {
@@ -274,6 +355,10 @@ void ManageAdjustmentStorage(uint8_t Mode, uint8_t ID)
     Data_EE = (uint8_t *)&NV_Adjust_1;
   }
 
+  #ifdef ADJUST_WEAR_LEVEL
+  Data_EE = GetAdjustmentSlot(Data_EE, Mode);     /* get slot */
+  #endif
+
   /* write/read EEPROM */
   n = DataStorage((uint8_t *)&NV, Data_EE, sizeof(Adjust_Type), Mode);
   if (n == 0) Flag = 0;       /* checksum error */
@@ -364,6 +449,10 @@ void ManageAdjustmentStorage(uint8_t Mode, uint8_t ID)
     Addr_EE = (uint8_t *)&NV_Adjust_1;
   }
 
+  #ifdef ADJUST_WEAR_LEVEL
+  Addr_EE = GetAdjustmentSlot(Addr_EE, Mode);     /* get slot */
+  #endif
+
   NV.CheckSum = CheckSum();        /* update checksum */
 
 
@@ -373,8 +462,11 @@ void ManageAdjustmentStorage(uint8_t Mode, uint8_t ID)
 
   if (Mode == STORAGE_SAVE)           /* write */
   {
-    /* write data block from RAM to EEPROM */
-    eeprom_write_block(Addr_RAM, Addr_EE, sizeof(Adjust_Type));
+    /* write data block from RAM to EEPROM (changed bytes only) */
+    #ifdef SW_PERF_COUNTERS
+    PerfCount[PERF_EEPROM]++; /* count EEPROM write */
+    #endif
+    eeprom_update_block(Addr_RAM, Addr_EE, sizeof(Adjust_Type));
   }
   else                                /* read */
   {
@@ -495,6 +587,50 @@ void ShowAdjustmentValues(void)
 
 
 
+#ifdef ADJUST_CONVERGE
+
+/* local constants for convergence check */
+#define ADJ_MIN_RUNS     3         /* min. number of runs per step */
+#define ADJ_TOL_R        1         /* tolerance for R_Zero (0.01 Ohms) */
+#define ADJ_TOL_U        2         /* tolerance for Ri voltages (mV) */
+#define ADJ_TOL_C        1         /* tolerance for C_Zero (pF) */
+#define ADJ_WAIT         300       /* time to show values of a run (ms) */
+
+
+/*
+ *  check if two values of consecutive runs agree
+ *
+ *  requires:
+ *  - Value1: value of current run
+ *  - Value2: value of last run
+ *  - Tolerance: max. difference
+ *
+ *  returns:
+ *  - 1 if within tolerance
+ *  - 0 if not
+ */
+
+uint8_t Compare_Adjust(uint16_t Value1, uint16_t Value2, uint8_t Tolerance)
+{
+  uint8_t           Flag = 0;           /* return value */
+  uint16_t          Diff;               /* difference */
+
+  if (Value1 > Value2) Diff = Value1 - Value2;
+  else Diff = Value2 - Value1;
+
+  if (Diff <= Tolerance) Flag = 1;      /* within tolerance */
+
+  return Flag;
+}
+
+#else
+
+#define ADJ_WAIT         1000      /* time to show values of a run (ms) */
+
+#endif
+
+
+
 /*
  *  self adjustment
  *
@@ -541,6 +677,15 @@ uint8_t SelfAdjustment(void)
   uint8_t           RefCounter = 0;     /* number of ref/offset runs */
   #endif
 
+  #ifdef ADJUST_CONVERGE
+  uint8_t           Runs[7] = {5, 5, 5, 5, 5, 5, 5};  /* runs per step */
+  uint8_t           Done;               /* convergence flag */
+  uint16_t          Old1 = 0;           /* last value #1 */
+  uint16_t          Old2 = 0;           /* last value #2 */
+  uint16_t          Old3 = 0;           /* last value #3 */
+  #endif
+  uint8_t           Counter;            /* number of runs / tolerance */
+
   #ifdef HW_ADJUST_CAP
     Step = 1;            /* start with step #1 */
   #else
@@ -599,6 +744,13 @@ uint8_t SelfAdjustment(void)
           Display_Space();
           Display_SignedValue(NV.CompOffset, -3, 'V'); /* display offset in mV */
 
+          #ifdef ADJUST_CONVERGE
+          /* offsets for convergence check */
+          Val1 = (uint16_t)NV.RefOffset;
+          Val2 = (uint16_t)NV.CompOffset;
+          Val3 = 0;
+          #endif
+
           DisplayFlag = 0;                   /* reset flag */
           break;
         #endif        
@@ -795,11 +947,39 @@ uint8_t SelfAdjustment(void)
         Display_Value(Val3, 0 , 0);     /* display value probe-3 */
       }
 
+      #ifdef ADJUST_CONVERGE
+      /*
+       *  convergence check
+       *  - values of this run agree with the ones of the last run
+       *  - at least ADJ_MIN_RUNS runs
+       */
+
+      Done = 0;                         /* reset flag */
+      if ((Flag >= ADJ_MIN_RUNS) && (Flag < 100))
+      {
+        Counter = ADJ_TOL_U;            /* default: voltage (mV) */
+        if (Step == 1) Counter = 0;     /* offsets: no change */
+        else if (Step == 2) Counter = ADJ_TOL_R;     /* R (0.01 Ohms) */
+        else if (Step == 6) Counter = ADJ_TOL_C;     /* C (pF) */
+
+        if ((Compare_Adjust(Val1, Old1, Counter)) &&
+            (Compare_Adjust(Val2, Old2, Counter)) &&
+            (Compare_Adjust(Val3, Old3, Counter)))
+        {
+          Done = 1;                     /* converged */
+        }
+      }
+
+      Old1 = Val1;                      /* save values for next run */
+      Old2 = Val2;
+      Old3 = Val3;
+      #endif
+
       /* wait and check test push button */
       if (Flag < 100)                   /* when we don't skip this test */
       {
         /* catch key press or timeout */
-        DisplayFlag = TestKey(1000, CHECK_BAT);
+        DisplayFlag = TestKey(ADJ_WAIT, CHECK_BAT);
 
         /* short press -> next test / long press -> end selftest */
         if (DisplayFlag > KEY_TIMEOUT)
@@ -807,6 +987,13 @@ uint8_t SelfAdjustment(void)
           Flag = 100;                   /* skip current test anyway */
           if (DisplayFlag == KEY_LONG) Step = 100;  /* also skip selftest */
         } 
+        #ifdef ADJUST_CONVERGE
+        else if (Done)                  /* converged */
+        {
+          Runs[Step] = Flag;            /* save number of runs */
+          Flag = 100;                   /* end current step */
+        }
+        #endif
       }
  
       Flag++;                           /* next run */
@@ -823,13 +1010,18 @@ uint8_t SelfAdjustment(void)
   Flag = 0;                   /* reset adjustment counter */
 
   /* capacitance auto-zero: calculate average value for probe pairs */
-  if (CapCounter == 15)
+  #ifdef ADJUST_CONVERGE
+  Counter = Runs[6];          /* runs of step #6 */
+  #else
+  Counter = 5;                /* fixed number of runs */
+  #endif
+  if (CapCounter == (Counter * 3))
   {
     #ifdef CAP_MULTIOFFSET
     /* separately for each probe pair (in pF) */
-    NV.CapZero[0] = CapSum1 / 5;        /* probes 1-2 */
-    NV.CapZero[1] = CapSum2 / 5;        /* probes 1-3 */
-    NV.CapZero[2] = CapSum3 / 5;        /* probes 2-3 */
+    NV.CapZero[0] = CapSum1 / Counter;  /* probes 1-2 */
+    NV.CapZero[1] = CapSum2 / Counter;  /* probes 1-3 */
+    NV.CapZero[2] = CapSum3 / Counter;  /* probes 2-3 */
     #else
     /* for all probe pairs (in pF) */
     NV.CapZero = CapSum / CapCounter;
@@ -839,13 +1031,16 @@ uint8_t SelfAdjustment(void)
   }
 
   /* resistance auto-zero: calculate average value for probe pairs */
-  if (RCounter == 15)
+  #ifdef ADJUST_CONVERGE
+  Counter = Runs[2];          /* runs of step #2 */
+  #endif
+  if (RCounter == (Counter * 3))
   { 
     #ifdef R_MULTIOFFSET
     /* separately for each probe pair (in 0.01 Ohms) */
-    NV.RZero[0] = RSum1 / 5;            /* probes 1-2 */
-    NV.RZero[1] = RSum2 / 5;            /* probes 1-3 */
-    NV.RZero[2] = RSum3 / 5;            /* probes 2-3 */
+    NV.RZero[0] = RSum1 / Counter;      /* probes 1-2 */
+    NV.RZero[1] = RSum2 / Counter;      /* probes 1-3 */
+    NV.RZero[2] = RSum3 / Counter;      /* probes 2-3 */
     #else
     /* for all probe pairs (in 0.01 Ohms) */
     NV.RZero = RSum / RCounter;
@@ -855,7 +1050,11 @@ uint8_t SelfAdjustment(void)
   }
 
   /* RiL & RiH */
+  #ifdef ADJUST_CONVERGE
+  if ((RiL_Counter == (Runs[4] * 3)) && (RiH_Counter == (Runs[5] * 3)))
+  #else
   if ((RiL_Counter == 15) && (RiH_Counter == 15))
+  #endif
   {
     /*
      *  Calculate RiL and RiH using the voltage divider equation:
@@ -864,8 +1063,13 @@ uint8_t SelfAdjustment(void)
      */
 
     /* use values multiplied by 3 to increase accuracy */    
+    #ifdef ADJUST_CONVERGE
+    U_RiL /= Runs[4];                   /* average sum of 3 U_RiL */
+    U_RiH /= Runs[5];                   /* average sum of 3 U_RiH */
+    #else
     U_RiL /= 5;                         /* average sum of 3 U_RiL */
     U_RiH /= 5;                         /* average sum of 3 U_RiH */
+    #endif
     Val1 = (Cfg.Vcc * 3) - U_RiL - U_RiH;    /* U_Rl * 3 */
 
     /* RiL */
@@ -890,7 +1094,11 @@ uint8_t SelfAdjustment(void)
   }
 
   #ifdef HW_ADJUST_CAP
+  #ifdef ADJUST_CONVERGE
+  if (RefCounter != Runs[1])  /* we expect all runs to be successful */
+  #else
   if (RefCounter != 5)        /* we expect 5 successful runs */
+  #endif
   {
     Flag = 0;                 /* signal error */
   }
@@ -913,22 +1121,260 @@ uint8_t SelfAdjustment(void)
 
 
 
+/* clean-up of local constants */
+#ifdef ADJUST_CONVERGE
+  #undef ADJ_MIN_RUNS
+  #undef ADJ_TOL_R
+  #undef ADJ_TOL_U
+  #undef ADJ_TOL_C
+#endif
+#undef ADJ_WAIT
+
+
+
+#ifdef SW_LEAD_ADJUST
+
+/* local constants */
+#define LEAD_RUNS        5         /* number of runs per step */
+#define LEAD_WAIT        200       /* time to show values of a run (ms) */
+
+
+/*
+ *  quick adjustment of lead dependent offsets
+ *  - measures resistance (probes shorted) and capacitance (probes open)
+ *    of the probe pairs, i.e. NV.RZero and NV.CapZero only
+ *  - RiL, RiH and voltage offsets are kept
+ *  - a key press aborts the adjustment
+ *
+ *  returns:
+ *  - 0 on error or abort
+ *  - 1 on success
+ */
+
+uint8_t LeadAdjustment(void)
+{
+  uint8_t           Flag;               /* return value / control flag */
+  uint8_t           Step = 1;           /* step: 1 = R, 2 = C */
+  uint8_t           Run;                /* run counter */
+  uint8_t           n;                  /* counter / probe pair */
+  uint8_t           Probe1;             /* probe #1 of pair */
+  uint8_t           Probe2;             /* probe #2 of pair */
+  uint8_t           Counter[2] = {0, 0};     /* number of valid values */
+  uint16_t          Value[3];           /* values of probe pairs */
+  uint16_t          RSum[3] = {0, 0, 0};     /* sums of R_Zero (0.01 Ohms) */
+  uint16_t          CapSum[3] = {0, 0, 0};   /* sums of C_Zero (pF) */
+
+  /* make sure all probes are shorted */
+  Flag = ShortCircuit(1);
+  if (Flag == 0) return Flag;           /* aborted */
+
+  while (Step <= 2)
+  {
+    Run = 0;
+
+    while (Run < LEAD_RUNS)
+    {
+      /* display step */
+      LCD_Clear();
+      #ifdef UI_COLORED_TITLES
+        Display_ColoredEEString_Space((Step == 1) ? ROffset_str : CapOffset_str, COLOR_TITLE);
+      #else
+        Display_EEString_Space((Step == 1) ? ROffset_str : CapOffset_str);
+      #endif
+      Display_EEString(ProbeComb_str);  /* display: 12 13 23 */
+
+      /* probe pairs 1-2, 1-3 and 2-3 */
+      n = 0;
+      while (n < 3)
+      {
+        Probe1 = PROBE_3;
+        if (n == 0) Probe1 = PROBE_2;
+        Probe2 = PROBE_1;
+        if (n == 2) Probe2 = PROBE_2;
+
+        if (Step == 1)             /* resistance (probes shorted) */
+        {
+          UpdateProbes2(Probe1, Probe2);
+          Value[n] = SmallResistor(0);       /* get R in 0.01 Ohm */
+          if (Value[n] < 150)                /* within limit (< 1.5 Ohm) */
+          {
+            RSum[n] += Value[n];
+            Counter[0]++;                    /* valid measurement */
+          }
+        }
+        else                       /* capacitance (probes open) */
+        {
+          MeasureCap(Probe1, Probe2, n);
+          Value[n] = (uint16_t)Caps[n].Raw;  /* get C (in pF) */
+          /* limit offset to 100pF */
+          if ((Caps[n].Scale == -12) && (Caps[n].Raw <= 100UL))
+          {
+            CapSum[n] += Value[n];
+            Counter[1]++;                    /* valid measurement */
+          }
+        }
+
+        n++;                       /* next pair */
+      }
+
+      /* reset ports to defaults */
+      ADC_DDR = 0;                      /* input mode */
+      ADC_PORT = 0;                     /* all pins low */
+      R_DDR = 0;                        /* input mode */
+      R_PORT = 0;                       /* all pins low */
+
+      /* display values */
+      Display_NextLine();               /* move to line #2 */
+      Display_Value(Value[0], 0 , 0);
+      Display_Space();
+      Display_Value(Value[1], 0 , 0);
+      Display_Space();
+      Display_Value(Value[2], 0 , 0);
+
+      /* any key press aborts */
+      if (TestKey(LEAD_WAIT, CHECK_BAT) > KEY_TIMEOUT)
+      {
+        return 0;                       /* abort */
+      }
+
+      Run++;                            /* next run */
+    }
+
+    if (Step == 1)                      /* after resistance */
+    {
+      ShortCircuit(0);                  /* make sure probes are not shorted */
+    }
+
+    Step++;                             /* next step */
+  }
+
+
+  /*
+   *  update offsets
+   *  - only when all runs gave valid values
+   */
+
+  Flag = 0;                             /* reset flag */
+
+  if (Counter[0] == (LEAD_RUNS * 3))    /* R_Zero */
+  {
+    #ifdef R_MULTIOFFSET
+    /* separately for each probe pair (in 0.01 Ohms) */
+    NV.RZero[0] = RSum[0] / LEAD_RUNS;       /* probes 1-2 */
+    NV.RZero[1] = RSum[1] / LEAD_RUNS;       /* probes 1-3 */
+    NV.RZero[2] = RSum[2] / LEAD_RUNS;       /* probes 2-3 */
+    #else
+    /* for all probe pairs (in 0.01 Ohms) */
+    NV.RZero = (RSum[0] + RSum[1] + RSum[2]) / (LEAD_RUNS * 3);
+    #endif
+
+    Flag++;
+  }
+
+  if (Counter[1] == (LEAD_RUNS * 3))    /* C_Zero */
+  {
+    #ifdef CAP_MULTIOFFSET
+    /* separately for each probe pair (in pF) */
+    NV.CapZero[0] = CapSum[0] / LEAD_RUNS;   /* probes 1-2 */
+    NV.CapZero[1] = CapSum[1] / LEAD_RUNS;   /* probes 1-3 */
+    NV.CapZero[2] = CapSum[2] / LEAD_RUNS;   /* probes 2-3 */
+    #else
+    /* for all probe pairs (in pF) */
+    NV.CapZero = (CapSum[0] + CapSum[1] + CapSum[2]) / (LEAD_RUNS * 3);
+    #endif
+
+    Flag++;
+  }
+
+  if (Flag == 2)                        /* both offsets updated */
+  {
+    /* show new offsets */
+    LCD_Clear();
+    Display_EEString_Space(ROffset_str);     /* display: R0 */
+    #ifdef R_MULTIOFFSET
+    Display_Value(NV.RZero[0], -2, 0);
+    Display_Space();
+    Display_Value(NV.RZero[1], -2, 0);
+    Display_Space();
+    Display_Value(NV.RZero[2], -2, 0);
+    #else
+    Display_Value(NV.RZero, -2, LCD_CHAR_OMEGA);
+    #endif
+    Display_NL_EEString_Space(CapOffset_str);     /* display: C0 */
+    #ifdef CAP_MULTIOFFSET
+    Display_Value(NV.CapZero[0], 0, 0);
+    Display_Space();
+    Display_Value(NV.CapZero[1], 0, 0);
+    Display_Space();
+    Display_Value(NV.CapZero[2], 0, 0);
+    #else
+    Display_Value(NV.CapZero, -12, 'F');
+    #endif
+
+    WaitKey();                          /* let the user read */
+
+    Flag = 1;                           /* signal success */
+  }
+  else                                  /* missing offsets */
+  {
+    Flag = 0;                           /* signal error */
+  }
+
+  return Flag;
+}
+
+/* clean-up of local constants */
+#undef LEAD_RUNS
+#undef LEAD_WAIT
+
+#endif
+
+
+
 /* ************************************************************************
  *   selftest
  * ************************************************************************ */
 
 
+#ifdef SW_SELFTEST_REPORT
+
+/* local constants: test results */
+#define ST_PASS          0         /* passed */
+#define ST_FAIL          1         /* failed */
+#define ST_SKIP          2         /* skipped */
+
+/* local constants: limits */
+#define ST_BANDGAP_MIN   1000      /* min. bandgap voltage (mV) */
+#define ST_BANDGAP_MAX   1200      /* max. bandgap voltage (mV) */
+#define ST_OFFSET_RL     20        /* max. offset of Rl divider (mV) */
+#define ST_OFFSET_RH     50        /* max. offset of Rh divider (mV) */
+#define ST_LEAKAGE       50        /* max. leakage voltage (mV) */
+
+#endif
+
+
 /*
  *  selftest
  *  - perform measurements on internal voltages and probe resistors
  *  - display results
+ *  - report mode (remote command SELFTEST):
+ *    runs all tests without waiting for the user and sends the values
+ *    of each run, the result and the duration of each test via serial
+ *    instead of displaying them
+ *    tests not matching the state of the probes (shorted or not) are
+ *    skipped
+ *
+ *  requires:
+ *  - Mode:
+ *    SELFTEST_DISPLAY  display results and wait for user
+ *    SELFTEST_REPORT   send report via serial
  *
  *  returns:
  *  - 0 on error
  *  - 1 on success
  */
 
-uint8_t SelfTest(void)
+uint8_t SelfTest(uint8_t Mode)
 {
   uint8_t           Flag = 0;           /* return value & loop counter */
   uint8_t           Test = 1;           /* test counter */
@@ -936,12 +1382,30 @@ uint8_t SelfTest(void)
   uint16_t          Val0;               /* voltage/value */
   int16_t           Val1 = 0, Val2 = 0, Val3 = 0;   /* voltages/values */
   int16_t           Temp;               /* value */
+  #ifdef SW_SELFTEST_REPORT
+  uint8_t           Shorted = 0;        /* number of shorted probe pairs */
+  uint8_t           Result;             /* result of test */
+  uint8_t           Passed = 1;         /* overall result */
+  uint8_t           Limit;              /* max. deviation */
+  uint32_t          Start;              /* start of test */
+  uint32_t          Time;               /* duration of test */
+  #endif
 
-  /* make sure all probes are shorted */
-  Flag = ShortCircuit(1);
-  if (Flag == 0)              /* aborted */
+  #ifdef SW_SELFTEST_REPORT
+  if (Mode == SELFTEST_REPORT)     /* report mode */
   {
-    Test = 10;                /* skip selftest */
+    /* no user interaction: just check the probes */
+    Shorted = ShortedProbes();     /* get shorted probes */
+  }
+  else                             /* display mode */
+  #endif
+  {
+    /* make sure all probes are shorted */
+    Flag = ShortCircuit(1);
+    if (Flag == 0)            /* aborted */
+    {
+      Test = 10;              /* skip selftest */
+    }
   }
 
   /* loop through all tests */
@@ -949,11 +1413,42 @@ uint8_t SelfTest(void)
   {
     Flag = 1;                 /* reset loop counter */
 
+    #ifdef SW_SELFTEST_REPORT
+    if (Mode == SELFTEST_REPORT)   /* report mode */
+    {
+      Result = ST_PASS;            /* pass by default */
+      Start = Profile_Tick();      /* start of test */
+
+      /* Rl and Rh tests require shorted probes, leakage tests open probes */
+      if (((Test == 2) || (Test == 3)) && (Shorted != 3))
+      {
+        Result = ST_SKIP;          /* skip test */
+        Flag = 100;
+      }
+      else if ((Test >= 5) && (Shorted != 0))
+      {
+        Result = ST_SKIP;          /* skip test */
+        Flag = 100;
+      }
+    }
+    #endif
+
     /* repeat each test 5 times */
     while (Flag <= 5)
     {
+      #ifdef SW_SELFTEST_REPORT
+      if (Mode == SELFTEST_REPORT)      /* report mode */
+      {
+        /* mute output while measuring */
+        Cfg.OP_Control &= ~(OP_OUT_LCD | OP_OUT_SER);
+      }
+      else                              /* display mode */
+      #endif
+      {
+        LCD_Clear();
+      }
+
       /* display test number */
-      LCD_Clear();
       #ifdef UI_COLORED_TITLES
       Display_UseTitleColor();          /* use title color */
       #endif
@@ -1042,7 +1537,12 @@ uint8_t SelfTest(void)
           break;
 
         case 4:     /* un-short probes */
-          ShortCircuit(0);         /* make sure probes are not shorted */
+          #ifdef SW_SELFTEST_REPORT
+          if (Mode == SELFTEST_DISPLAY)
+          #endif
+          {
+            ShortCircuit(0);       /* make sure probes are not shorted */
+          }
           Flag = 100;              /* skip test */
           DisplayFlag = 0;         /* don't display any result */
           break;
@@ -1107,6 +1607,67 @@ uint8_t SelfTest(void)
         Display_SignedValue(Val3, 0 , 0);    /* display value probe-3 */
       }
 
+      #ifdef SW_SELFTEST_REPORT
+      if (Mode == SELFTEST_REPORT)      /* report mode */
+      {
+        Cfg.OP_Control |= OP_OUT_SER;   /* enable output to serial again */
+
+        if (Flag < 100)                 /* when we don't skip this test */
+        {
+          /* check limits */
+          if (Test == 1)                /* bandgap reference */
+          {
+            if ((Val0 < ST_BANDGAP_MIN) || (Val0 > ST_BANDGAP_MAX))
+            {
+              Result = ST_FAIL;
+            }
+          }
+          else                          /* probes */
+          {
+            Temp = 0;                   /* expected value */
+
+            if (Test == 2) Limit = ST_OFFSET_RL;
+            else if (Test == 3) Limit = ST_OFFSET_RH;
+            else
+            {
+              Limit = ST_LEAKAGE;
+              if (Test == 6) Temp = Cfg.Vcc;
+            }
+
+            if ((Val1 < Temp - Limit) || (Val1 > Temp + Limit) ||
+                (Val2 < Temp - Limit) || (Val2 > Temp + Limit) ||
+                (Val3 < Temp - Limit) || (Val3 > Temp + Limit))
+            {
+              Result = ST_FAIL;
+            }
+          }
+
+          /* send: T<test>,<run>,<value(s)> */
+          Display_Char('T');
+          Display_Char('0' + Test);
+          Display_Char(',');
+          Display_Char('0' + Flag);
+          Display_Char(',');
+
+          if (Test == 1)                /* bandgap reference */
+          {
+            Display_FullValue(Val0, 0, 0);
+          }
+          else                          /* probes */
+          {
+            Display_SignedFullValue(Val1, 0, 0);
+            Display_Char(',');
+            Display_SignedFullValue(Val2, 0, 0);
+            Display_Char(',');
+            Display_SignedFullValue(Val3, 0, 0);
+          }
+
+          Serial_NewLine();
+        }
+      }
+      else                              /* display mode */
+      #endif
+
       /* wait and check test push button */
       if (Flag < 100)                   /* when we don't skip this test */
       {
@@ -1124,13 +1685,70 @@ uint8_t SelfTest(void)
       Flag++;                      /* next run */
     }
 
+    #ifdef SW_SELFTEST_REPORT
+    if ((Mode == SELFTEST_REPORT) && (Test != 4))
+    {
+      /* convert ticks into ms (1024 MCU cycles per tick) */
+      Time = (Profile_Tick() - Start) & 0x00FFFFFF;
+      Time = (Time * 1024) / MCU_CYCLES_PER_US;
+      Time /= 1000;
+
+      /* send: T<test>,<result>,<time> */
+      Display_Char('T');
+      Display_Char('0' + Test);
+      Display_Char(',');
+
+      if (Result == ST_PASS)
+      {
+        Display_EEString(Cmd_PASS_str);
+      }
+      else if (Result == ST_FAIL)
+      {
+        Display_EEString(Cmd_FAIL_str);
+        Passed = 0;                /* overall failure */
+      }
+      else
+      {
+        Display_EEString(Cmd_SKIP_str);
+      }
+
+      Display_Char(',');
+      Display_FullValue(Time, 0, 0);
+      Serial_NewLine();
+    }
+    #endif
+
     Test++;                             /* next one */
   }
 
+  #ifdef SW_SELFTEST_REPORT
+  if (Mode == SELFTEST_REPORT)     /* report mode */
+  {
+    /* send overall result (newline is added by caller) */
+    if (Passed) Display_EEString(Cmd_PASS_str);
+    else Display_EEString(Cmd_FAIL_str);
+
+    Flag = Passed;
+    return Flag;
+  }
+  #endif
+
   Flag = 1;         /* signal success */
   return Flag;
 } 
 
+/* clean-up of local constants */
+#ifdef SW_SELFTEST_REPORT
+  #undef ST_PASS
+  #undef ST_FAIL
+  #undef ST_SKIP
+  #undef ST_BANDGAP_MIN
+  #undef ST_BANDGAP_MAX
+  #undef ST_OFFSET_RL
+  #undef ST_OFFSET_RH
+  #undef ST_LEAKAGE
+#endif
+
 
 
 /* ************************************************************************
@@ -29,6 +29,332 @@
 #define FONT_BYTES_Y        16     /* 16 bytes in y direction */
 
 
+#ifdef FONT_RLE
+
+/*
+ *  compressed character bitmaps (FONT_RLE)
+ *  - same bitmaps as below, each character compressed separately
+ *  - same format as compressed symbols (see symbols_<size>_h.h)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t FontData[] PROGMEM = {
+  /* symbols and special characters */
+  0xF0,0xF0,0x20,                                                                    /* 0x00 n/a */
+  0x41,0x82,0x11,0x04,0x11,0x08,0x11,0x10,0x11,0x20,0x15,0x41,0x03,0x41,0x03,0x20,
+  0x11,0x10,0x11,0x08,0x11,0x04,0x11,0x82,0x50,                                      /* 0x01 symbol: diode A-C */
+  0x41,0x82,0x11,0x40,0x11,0x20,0x11,0x10,0x11,0x08,0x15,0x05,0x03,0x05,0x03,0x08,
+  0x11,0x10,0x11,0x20,0x11,0x40,0x11,0x82,0x50,                                      /* 0x02 symbol: diode C-A */
+  0x42,0x86,0x01,0x84,0x01,0x02,0x01,0x02,0x82,0x86,0x01,0x40,                       /* 0x03 symbol: capacitor */
+  0x21,0x78,0x11,0xFC,0x12,0x86,0x01,0x83,0x86,0x01,0xCC,0x54,0xCE,0x01,0x86,0x01,
+  0x40,                                                                              /* 0x04 omega */
+  0xA1,0x82,0xB1,0x44,0x11,0x7C,0x11,0xB8,0x50,                                      /* 0x05  (micro) */
+  0x44,0xFE,0x03,0xFC,0x03,0x61,0x01,0x11,0x01,0x74,0xFC,0x03,0xFE,0x03,0x40,        /* 0x06 symbol: resistor left side */
+  0x43,0xFF,0x01,0xFF,0x81,0x02,0x11,0x02,0x61,0xFF,0x12,0xFF,0x01,0x40,             /* 0x07 symbol: resistor right side */
+
+  0x01,0x44,0x11,0x44,0x31,0x10,0x11,0x28,0x11,0x10,0x11,0x60,0x11,0x0C,0x11,0xC0,
+  0x11,0x7A,0x12,0xFC,0x01,0x24,0x03,0x03,0x01,0x02,0x40,                            /* 0x08  */
+  0x01,0x44,0x11,0x44,0x31,0x78,0x11,0xFC,0x12,0x86,0x01,0xA3,0x86,0x01,0xFC,0x11,
+  0x78,0x50,                                                                         /* 0x09  */
+  0x01,0x44,0x11,0x44,0x31,0x82,0xF1,0xC6,0x11,0x78,0x11,0x3C,0x50,                  /* 0x0a  */
+  0x21,0x1C,0x11,0x3E,0x51,0x30,0x51,0x30,0x11,0x60,0x11,0xC0,0x31,0xF0,0x11,0x72,
+  0x50,                                                                              /* 0x0b  */
+  0x41,0x24,0x11,0x24,0x31,0x3C,0x11,0x7C,0x31,0x38,0x11,0x3C,0x11,0x06,0x11,0x20,
+  0x11,0xBE,0x11,0xDC,0x50,                                                          /* 0x0c  */
+  0x41,0x24,0x11,0x24,0x31,0x38,0x11,0x7C,0x11,0xC6,0x71,0xC6,0x11,0x7C,0x11,0x38,
+  0x50,                                                                              /* 0x0d  */
+  0x41,0x24,0x11,0x24,0x31,0x42,0xB1,0x20,0x11,0x3E,0x11,0x5C,0x50,                  /* 0x0e  */
+  0x21,0x10,0x11,0x38,0x11,0x38,0x11,0x10,0xF0,0x80,                                 /* 0x0f  (degree) */
+
+  /* standard characters */
+  0xF0,0xF0,0x20,                                                                    /* 0x10 space */
+  0x21,0x10,0xF0,0x21,0x10,0x11,0x10,0x31,0x10,0x50,                                 /* 0x11 ! */
+  0x21,0x44,0x71,0x44,0xF0,0x60,                                                     /* 0x12 " */
+  0x21,0x90,0x31,0xD8,0x35,0xB6,0x01,0xB6,0x01,0x6C,0x14,0xDB,0x01,0xDB,0x01,0x21,
+  0x36,0x31,0x12,0x50,                                                               /* 0x13 # */
+  0x01,0x20,0x11,0xD8,0x11,0xD4,0x11,0x08,0x31,0x0C,0x11,0x18,0x11,0x50,0x11,0x80,
+  0x11,0x40,0x31,0x04,0x11,0xD8,0x11,0x5C,0x11,0x20,0x30,                            /* 0x14 $ */
+  0x27,0x0E,0x02,0x1F,0x03,0x80,0x01,0xC0,0x11,0x1F,0x11,0x6E,0x11,0x30,0x15,0xD8,
+  0x01,0xE0,0x03,0x0C,0x11,0x06,0x14,0xE3,0x03,0xC1,0x01,0x40,                       /* 0x15 % */
+  0x21,0x38,0x11,0x7C,0x31,0x20,0x11,0x5C,0x11,0x34,0x13,0x1E,0x02,0x23,0x13,0x10,
+  0x03,0x60,0x16,0x83,0x01,0x3E,0x01,0xFC,0x01,0x40,                                 /* 0x16 & */
+  0x21,0x10,0x71,0x10,0xF0,0x60,                                                     /* 0x17  */
+  0x25,0x80,0x01,0xE0,0x01,0x50,0x11,0x20,0x11,0x18,0xB1,0x18,0x11,0x20,0x11,0x50,
+  0x14,0xE0,0x01,0x80,0x01,                                                          /* 0x18 ( */
+  0x21,0x06,0x11,0x1E,0x11,0x28,0x11,0x10,0x11,0x60,0xB1,0x60,0x11,0x10,0x11,0x28,
+  0x11,0x1E,0x11,0x06,0x10,                                                          /* 0x19 ) */
+  0x21,0x10,0x31,0xC6,0x11,0xBA,0x11,0x44,0x11,0x10,0x11,0x10,0x11,0x28,0xF0,        /* 0x1a * */
+  0xA1,0x10,0x74,0xEF,0x01,0xEF,0x01,0x41,0x10,0x50,                                 /* 0x1b + */
+  0xF0,0x71,0x18,0x31,0x08,0x31,0x18,0x10,                                           /* 0x1c , */
+  0xF0,0x11,0xFC,0x11,0xFC,0xD0,                                                     /* 0x1d - */
+  0xF0,0x71,0x18,0x31,0x18,0x50,                                                     /* 0x1e . */
+  0x33,0x01,0x80,0x01,0x21,0xC0,0x31,0x60,0x31,0x30,0x31,0x18,0x31,0x0C,0x31,0x06,
+  0x11,0x02,0x10,                                                                    /* 0x1f / */
+  0x21,0x38,0x11,0x7C,0x31,0xC6,0xB1,0xC6,0x31,0x7C,0x11,0x38,0x50,                  /* 0x20 0 */
+  0x21,0x10,0x11,0x0E,0x11,0x0E,0xF0,0x21,0xEE,0x11,0xFE,0x50,                       /* 0x21 1 */
+  0x21,0x3E,0x11,0x7C,0x11,0x02,0x51,0x60,0x31,0x30,0x11,0x18,0x11,0x0C,0x11,0x06,
+  0x11,0x7C,0x11,0x7E,0x50,                                                          /* 0x22 2 */
+  0x21,0x3C,0x11,0x7C,0x71,0x78,0x11,0x78,0x91,0x7C,0x11,0x3C,0x50,                  /* 0x23 3 */
+  0x21,0x20,0x11,0x10,0x11,0x18,0x31,0x0C,0x11,0x06,0x31,0x03,0x11,0xDE,0x11,0xDF,
+  0x51,0x20,0x50,                                                                    /* 0x24 4 */
+  0x21,0x7C,0x11,0x78,0x51,0x18,0x11,0x3C,0x11,0x60,0x71,0x60,0x11,0x3C,0x11,0x1C,
+  0x50,                                                                              /* 0x25 5 */
+  0x21,0x78,0x11,0x7C,0x31,0x06,0x11,0x38,0x11,0x7C,0x11,0xC4,0x71,0xC6,0x11,0x7C,
+  0x11,0x38,0x50,                                                                    /* 0x26 6 */
+  0x21,0xFE,0x11,0x7E,0x11,0xC0,0x11,0x60,0x31,0x30,0x31,0x18,0x51,0x0C,0x31,0x04,
+  0x50,                                                                              /* 0x27 7 */
+  0x21,0x7C,0x11,0xFE,0x51,0xE6,0x11,0x7C,0x11,0x7C,0x11,0x26,0x11,0xC0,0x31,0xC0,
+  0x11,0x7E,0x11,0x3C,0x50,                                                          /* 0x28 8 */
+  0x21,0x38,0x11,0x7C,0x11,0xC6,0x71,0x46,0x11,0x7C,0x11,0x38,0x11,0xC0,0x31,0x7C,
+  0x11,0x3C,0x50,                                                                    /* 0x29 9 */
+  0xA1,0x18,0x31,0x18,0x71,0x18,0x31,0x18,0x50,                                      /* 0x2a : */
+  0xA1,0x18,0x31,0x18,0x71,0x18,0x31,0x08,0x31,0x18,0x10,                            /* 0x2b ; */
+  0xB4,0x01,0xC0,0x01,0xF0,0x11,0x3C,0x31,0x3C,0x11,0xF0,0x12,0xC0,0x01,0x11,0x01,
+  0x40,                                                                              /* 0x2c < */
+  0xE4,0xFE,0x01,0xFE,0x01,0x24,0xFE,0x01,0xFE,0x01,0x80,                            /* 0x2d = */
+  0xA1,0x02,0x11,0x0E,0x11,0x3C,0x11,0xF0,0x31,0xF0,0x11,0x3C,0x11,0x0E,0x11,0x02,
+  0x50,                                                                              /* 0x2e > */
+  0x21,0x7E,0x11,0xBC,0x11,0x40,0x11,0x02,0x11,0xC0,0x11,0x60,0x11,0x30,0x11,0x18,
+  0x31,0x08,0x11,0x08,0x31,0x08,0x50,                                                /* 0x2f ? */
+  0x21,0x78,0x11,0xFC,0x11,0x66,0x11,0x71,0x11,0x1A,0x31,0x40,0x31,0x20,0x15,0x5B,
+  0x03,0xF4,0x03,0x3A,0x11,0x7C,0x50,                                                /* 0x30 @ */
+  0x61,0x10,0x11,0x28,0x11,0x10,0x11,0x60,0x11,0x0C,0x11,0xC0,0x11,0x7A,0x12,0xFC,
+  0x01,0x24,0x03,0x03,0x01,0x02,0x40,                                                /* 0x31 A */
+  0x61,0x7E,0x11,0xFC,0x31,0xC0,0x11,0x7C,0x11,0x7C,0x11,0xC0,0x51,0xFC,0x11,0x7E,
+  0x50,                                                                              /* 0x32 B */
+  0x61,0xF8,0x11,0x7E,0x11,0x84,0x11,0x03,0x71,0x03,0x11,0x04,0x11,0xFE,0x11,0xF8,
+  0x50,                                                                              /* 0x33 C */
+  0x61,0x3E,0x11,0x7C,0x11,0xC0,0xB1,0xC0,0x11,0x7C,0x11,0x3E,0x50,                  /* 0x34 D */
+  0x61,0xFE,0x11,0xFC,0x71,0x7C,0x11,0x7C,0x51,0xFC,0x11,0xFE,0x50,                  /* 0x35 E */
+  0x61,0xFE,0x11,0xFC,0x71,0x7C,0x11,0x7C,0x71,0x02,0x50,                            /* 0x36 F */
+  0x63,0xF0,0x01,0xFC,0x13,0x08,0x01,0x06,0x33,0xC0,0x01,0xC0,0x11,0x06,0x11,0x08,
+  0x11,0xFC,0x12,0xF0,0x01,0x40,                                                     /* 0x37 G */
+  0x61,0x82,0x91,0x7C,0x11,0x7C,0x71,0x82,0x50,                                      /* 0x38 H */
+  0x61,0xFE,0x11,0xEE,0xF1,0xEE,0x11,0xFE,0x50,                                      /* 0x39 I */
+  0x61,0x78,0x11,0x38,0xF1,0x7C,0x11,0x3C,0x50,                                      /* 0x3a J */
+  0x61,0x82,0x11,0xC0,0x11,0x60,0x11,0x30,0x11,0x1C,0x11,0x04,0x11,0x18,0x11,0x70,
+  0x11,0xE0,0x14,0x80,0x01,0x02,0x01,0x40,                                           /* 0x3b K */
+  0x61,0x02,0xF0,0x21,0xFC,0x11,0xFE,0x50,                                           /* 0x3c L */
+  0x61,0xC3,0x31,0x04,0x11,0x62,0x31,0x08,0x11,0x34,0x31,0x18,0x31,0x81,0x50,        /* 0x3d M */
+  0x61,0x82,0x11,0x04,0x11,0x0C,0x31,0x18,0x31,0x30,0x31,0x60,0x11,0x40,0x11,0x82,
+  0x50,                                                                              /* 0x3e N */
+  0x61,0x78,0x11,0xFC,0x12,0x86,0x01,0xA3,0x86,0x01,0xFC,0x11,0x78,0x50,             /* 0x3f O */
+  0x61,0x7E,0x11,0xFC,0x51,0xC0,0x11,0x7C,0x11,0x3C,0x71,0x02,0x50,                  /* 0x40 P */
+  0x61,0x78,0x11,0xFC,0x12,0x86,0x01,0xA3,0x86,0x01,0xFC,0x11,0x38,0x14,0xC0,0x01,
+  0x80,0x01,                                                                         /* 0x41 Q */
+  0x61,0x3E,0x11,0x7C,0x51,0x60,0x11,0x3C,0x11,0x0C,0x11,0x30,0x11,0x60,0x11,0xC0,
+  0x11,0x82,0x50,                                                                    /* 0x42 R */
+  0x61,0xFC,0x11,0x7E,0x11,0x80,0x11,0x04,0x11,0x1E,0x11,0x78,0x11,0xE0,0x31,0x42,
+  0x11,0xFC,0x11,0x3E,0x50,                                                          /* 0x43 S */
+  0x64,0xFF,0x01,0xEF,0x01,0xF0,0x11,0x10,0x50,                                      /* 0x44 T */
+  0x61,0x82,0xF1,0xC6,0x11,0x78,0x11,0x3C,0x50,                                      /* 0x45 U */
+  0x64,0x01,0x02,0x03,0x03,0x22,0x86,0x01,0x21,0xC0,0x11,0x0C,0x31,0x78,0x31,0x30,
+  0x50,                                                                              /* 0x46 V */
+  0x62,0x01,0x02,0x23,0x13,0x03,0x20,0x31,0x18,0x11,0x60,0x12,0x86,0x01,0x21,0x48,
+  0x11,0x84,0x50,                                                                    /* 0x47 W */
+  0x67,0x01,0x02,0x03,0x03,0x86,0x01,0xCC,0x11,0x78,0x31,0x78,0x11,0xCC,0x16,0x86,
+  0x01,0x03,0x03,0x01,0x02,0x40,                                                     /* 0x48 X */
+  0x67,0x01,0x02,0x03,0x03,0x86,0x01,0xC0,0x11,0x6C,0x11,0x38,0x91,0x10,0x50,        /* 0x49 Y */
+  0x63,0xFE,0x01,0xFE,0x13,0x80,0x01,0xC0,0x11,0x60,0x11,0x30,0x11,0x18,0x11,0x0C,
+  0x11,0x06,0x14,0xFC,0x01,0xFE,0x01,0x40,                                           /* 0x4a Z */
+  0x21,0xF8,0x11,0xF0,0xF0,0x81,0xF0,0x11,0xF8,0x10,                                 /* 0x4b [ */
+  0x21,0x02,0x11,0x06,0x31,0x0C,0x31,0x18,0x31,0x30,0x31,0x60,0x31,0xC0,0x32,0x80,
+  0x01,0x11,0x01,                                                                    /* 0x4c \ */
+  0x21,0x3E,0x11,0x1E,0xF0,0x81,0x1E,0x11,0x3E,0x10,                                 /* 0x4d ] */
+  0x21,0x20,0x31,0x10,0x11,0x60,0x11,0x08,0x11,0x10,0x11,0xC0,0x11,0x0C,0x34,0x86,
+  0x01,0x02,0x01,0x80,                                                               /* 0x4e ^ */
+  0xF0,0xB4,0xFF,0x03,0xFF,0x03,0x20,                                                /* 0x4f _ */
+  0x01,0x10,0x11,0x30,0x11,0x20,0xF0,0xC0,                                           /* 0x50 ` */
+  0xA1,0x3C,0x11,0x7C,0x31,0x38,0x11,0x3C,0x11,0x06,0x11,0x20,0x11,0xBE,0x11,0xDC,
+  0x50,                                                                              /* 0x51 a */
+  0x21,0x02,0x71,0x78,0x11,0x3C,0x11,0xC4,0x71,0xC4,0x11,0x7C,0x11,0x3A,0x50,        /* 0x52 b */
+  0xA1,0xF8,0x11,0xFC,0x11,0x06,0x71,0x06,0x11,0xFC,0x11,0xF8,0x50,                  /* 0x53 c */
+  0x21,0x80,0x71,0x38,0x11,0x7C,0x11,0x46,0x71,0x46,0x11,0x78,0x11,0xBC,0x50,        /* 0x54 d */
+  0xA1,0x78,0x11,0xFC,0x11,0x06,0x11,0x7C,0x11,0xFC,0x31,0x06,0x11,0xFC,0x11,0xF8,
+  0x50,                                                                              /* 0x55 e */
+  0x25,0xE0,0x01,0xF8,0x01,0x10,0x34,0xF6,0x01,0xF6,0x01,0xC1,0x08,0x50,             /* 0x56 f */
+  0xA1,0xB8,0x11,0x7C,0x11,0x46,0x71,0x46,0x11,0x78,0x11,0x3C,0x11,0xC0,0x11,0x7C,
+  0x10,                                                                              /* 0x57 g */
+  0x21,0x02,0x71,0x70,0x11,0xF8,0x11,0x0C,0x11,0x04,0x91,0x82,0x50,                  /* 0x58 h */
+  0x21,0x18,0x31,0x18,0x31,0x1E,0x11,0x0E,0xD1,0x10,0x50,                            /* 0x59 i */
+  0x21,0x30,0x31,0x30,0x31,0x3C,0x11,0x1C,0xF0,0x21,0x3E,0x10,                       /* 0x5a j */
+  0x21,0x02,0x71,0x80,0x11,0xE0,0x11,0x70,0x11,0x1C,0x11,0x04,0x11,0x38,0x11,0x70,
+  0x11,0xC0,0x11,0x82,0x50,                                                          /* 0x5b k */
+  0x21,0x3C,0x11,0x1C,0xF0,0x61,0x20,0x50,                                           /* 0x5c l */
+  0xA1,0xCD,0x13,0xFE,0x01,0x22,0xB2,0x11,0x01,0x40,                                 /* 0x5d m */
+  0xA1,0x72,0x11,0xFC,0x11,0x08,0x11,0x04,0x91,0x82,0x50,                            /* 0x5e n */
+  0xA1,0x38,0x11,0x7C,0x11,0xC6,0x71,0xC6,0x11,0x7C,0x11,0x38,0x50,                  /* 0x5f o */
+  0xA1,0x7A,0x11,0x3C,0x11,0xC4,0x71,0xC4,0x11,0x7C,0x11,0x38,0x50,                  /* 0x60 p */
+  0xA1,0xB8,0x11,0x7C,0x11,0x46,0x71,0x46,0x11,0x78,0x11,0x3C,0x50,                  /* 0x61 q */
+  0xA1,0xE4,0x11,0x70,0x11,0x18,0x11,0x88,0x91,0x04,0x50,                            /* 0x62 r */
+  0xA1,0x7C,0x11,0x7E,0x31,0x0E,0x11,0x3C,0x11,0x70,0x11,0x02,0x11,0x7C,0x11,0x3E,
+  0x50,                                                                              /* 0x63 s */
+  0x61,0x08,0x31,0xF6,0x11,0xF6,0xB1,0xF8,0x11,0xF0,0x50,                            /* 0x64 t */
+  0xA1,0x42,0xB1,0x20,0x11,0x3E,0x11,0x5C,0x50,                                      /* 0x65 u */
+  0xA4,0x01,0x01,0x83,0x01,0x21,0xC0,0x11,0x06,0x11,0x60,0x11,0x0C,0x11,0x30,0x11,
+  0x18,0x50,                                                                         /* 0x66 v */
+  0xA3,0x01,0x02,0x10,0x12,0x23,0x03,0x21,0x78,0x33,0x86,0x01,0x48,0x11,0x84,0x50,   /* 0x67 w */
+  0xA5,0x02,0x01,0x86,0x01,0xCC,0x11,0x78,0x31,0x78,0x11,0xCC,0x14,0x86,0x01,0x02,
+  0x01,0x40,                                                                         /* 0x68 x */
+  0xA4,0x01,0x02,0x03,0x03,0x23,0x86,0x01,0xC8,0x11,0x04,0x11,0x78,0x31,0x20,0x11,
+  0x18,0x11,0x0F,0x10,                                                               /* 0x69 y */
+  0xA5,0xFE,0x01,0x7E,0x01,0xC0,0x11,0x60,0x11,0x30,0x11,0x18,0x11,0x0C,0x14,0xFA,
+  0x01,0xFE,0x01,0x40,                                                               /* 0x6a z */
+  0x21,0xE0,0x11,0xF0,0xB1,0x1C,0x11,0x1C,0x91,0xF0,0x11,0xE0,0x10,                  /* 0x6b { */
+  0x21,0x10,0xF0,0xC1,0x10,0x10,                                                     /* 0x6c | */
+  0x21,0x1C,0x11,0x3C,0xB1,0xE0,0x11,0xE0,0x91,0x3C,0x11,0x1C,0x10,                  /* 0x6d } */
+  0xE3,0x0E,0x02,0x3F,0x14,0xF0,0x03,0xC1,0x01,0xA0                                  /* 0x6e ~ */
+  #ifdef FONT_EXTRA
+  ,
+
+  /* extra characters */
+  0x03,0xFF,0x03,0x10,0x11,0x0E,0x11,0x0E,0xF0,0x21,0xEE,0x11,0xFE,0x50,             /* 0x6f 1 (reversed color) */
+  0x03,0xFF,0x03,0x3E,0x11,0x7C,0x11,0x02,0x51,0x60,0x31,0x30,0x11,0x18,0x11,0x0C,
+  0x11,0x06,0x11,0x7C,0x11,0x7E,0x50,                                                /* 0x70 2 (reversed color) */
+  0x03,0xFF,0x03,0x3C,0x11,0x7C,0x71,0x78,0x11,0x78,0x91,0x7C,0x11,0x3C,0x50,        /* 0x71 3 (reversed color) */
+  0x02,0xFF,0x03,0x81,0x84,0x11,0x48,0x11,0xB4,0x11,0x48,0x11,0x48,0x11,0xB4,0x11,
+  0x48,0x11,0x84,0x70,                                                               /* 0x72 x (reversed color) */
+  0x62,0xFF,0x03,0x22,0xFC,0x03,0xA2,0xFC,0x03,0x22,0xFF,0x03,0x40,                  /* 0x73 symbol: battery left side, low */
+  0x62,0xFF,0x03,0x24,0xFC,0x03,0xF8,0x01,0x64,0xF8,0x01,0xFC,0x03,0x22,0xFF,0x03,
+  0x40,                                                                              /* 0x74 symbol: battery left side, high */
+  0x61,0xFF,0x31,0x7F,0x22,0x03,0x80,0x31,0x80,0x22,0x03,0x7F,0x31,0xFF,0x50,        /* 0x75 symbol: battery right side, low */
+  0x61,0xFF,0x31,0x7F,0x13,0x3F,0x03,0x80,0x31,0x80,0x13,0x3F,0x03,0x7F,0x31,0xFF,
+  0x50                                                                               /* 0x76 symbol: battery right side, high */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed characters in FontData[]
+ */
+
+const uint16_t FontIndex[] PROGMEM = {
+  0,        /* 0x00 n/a */
+  3,        /* 0x01 symbol: diode A-C */
+  28,       /* 0x02 symbol: diode C-A */
+  53,       /* 0x03 symbol: capacitor */
+  65,       /* 0x04 omega */
+  82,       /* 0x05  (micro) */
+  91,       /* 0x06 symbol: resistor left side */
+  106,      /* 0x07 symbol: resistor right side */
+  120,      /* 0x08  */
+  147,      /* 0x09  */
+  165,      /* 0x0a  */
+  178,      /* 0x0b  */
+  195,      /* 0x0c  */
+  216,      /* 0x0d  */
+  233,      /* 0x0e  */
+  246,      /* 0x0f  (degree) */
+  256,      /* 0x10 space */
+  259,      /* 0x11 ! */
+  269,      /* 0x12 " */
+  275,      /* 0x13 # */
+  295,      /* 0x14 $ */
+  322,      /* 0x15 % */
+  350,      /* 0x16 & */
+  376,      /* 0x17  */
+  382,      /* 0x18 ( */
+  403,      /* 0x19 ) */
+  424,      /* 0x1a * */
+  439,      /* 0x1b + */
+  449,      /* 0x1c , */
+  457,      /* 0x1d - */
+  463,      /* 0x1e . */
+  469,      /* 0x1f / */
+  488,      /* 0x20 0 */
+  501,      /* 0x21 1 */
+  513,      /* 0x22 2 */
+  534,      /* 0x23 3 */
+  547,      /* 0x24 4 */
+  566,      /* 0x25 5 */
+  583,      /* 0x26 6 */
+  602,      /* 0x27 7 */
+  619,      /* 0x28 8 */
+  640,      /* 0x29 9 */
+  659,      /* 0x2a : */
+  668,      /* 0x2b ; */
+  679,      /* 0x2c < */
+  696,      /* 0x2d = */
+  707,      /* 0x2e > */
+  724,      /* 0x2f ? */
+  747,      /* 0x30 @ */
+  770,      /* 0x31 A */
+  793,      /* 0x32 B */
+  810,      /* 0x33 C */
+  827,      /* 0x34 D */
+  840,      /* 0x35 E */
+  853,      /* 0x36 F */
+  864,      /* 0x37 G */
+  886,      /* 0x38 H */
+  895,      /* 0x39 I */
+  904,      /* 0x3a J */
+  913,      /* 0x3b K */
+  937,      /* 0x3c L */
+  945,      /* 0x3d M */
+  960,      /* 0x3e N */
+  977,      /* 0x3f O */
+  991,      /* 0x40 P */
+  1004,     /* 0x41 Q */
+  1022,     /* 0x42 R */
+  1041,     /* 0x43 S */
+  1062,     /* 0x44 T */
+  1071,     /* 0x45 U */
+  1080,     /* 0x46 V */
+  1097,     /* 0x47 W */
+  1116,     /* 0x48 X */
+  1138,     /* 0x49 Y */
+  1153,     /* 0x4a Z */
+  1177,     /* 0x4b [ */
+  1187,     /* 0x4c \ */
+  1206,     /* 0x4d ] */
+  1216,     /* 0x4e ^ */
+  1236,     /* 0x4f _ */
+  1243,     /* 0x50 ` */
+  1251,     /* 0x51 a */
+  1268,     /* 0x52 b */
+  1283,     /* 0x53 c */
+  1296,     /* 0x54 d */
+  1311,     /* 0x55 e */
+  1328,     /* 0x56 f */
+  1342,     /* 0x57 g */
+  1359,     /* 0x58 h */
+  1372,     /* 0x59 i */
+  1383,     /* 0x5a j */
+  1395,     /* 0x5b k */
+  1416,     /* 0x5c l */
+  1424,     /* 0x5d m */
+  1434,     /* 0x5e n */
+  1445,     /* 0x5f o */
+  1458,     /* 0x60 p */
+  1471,     /* 0x61 q */
+  1484,     /* 0x62 r */
+  1495,     /* 0x63 s */
+  1512,     /* 0x64 t */
+  1523,     /* 0x65 u */
+  1532,     /* 0x66 v */
+  1550,     /* 0x67 w */
+  1566,     /* 0x68 x */
+  1584,     /* 0x69 y */
+  1604,     /* 0x6a z */
+  1624,     /* 0x6b { */
+  1637,     /* 0x6c | */
+  1643,     /* 0x6d } */
+  1656      /* 0x6e ~ */
+  #ifdef FONT_EXTRA
+  ,
+  1666,     /* 0x6f 1 (reversed color) */
+  1680,     /* 0x70 2 (reversed color) */
+  1703,     /* 0x71 3 (reversed color) */
+  1718,     /* 0x72 x (reversed color) */
+  1738,     /* 0x73 symbol: battery left side, low */
+  1751,     /* 0x74 symbol: battery left side, high */
+  1768,     /* 0x75 symbol: battery right side, low */
+  1783      /* 0x76 symbol: battery right side, high */
+  #endif
+};
+
+#else
+
 /*
  *  character bitmaps
  *  - to reduce size we place some symbols and special characters at
@@ -291,6 +617,8 @@ const uint8_t FontData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 /*
  *  font lookup table for ISO 8859-1
@@ -30,6 +30,517 @@
 #define FONT_BYTES_Y        16     /* 16 bytes in y direction */
 
 
+#ifdef FONT_RLE
+
+/*
+ *  compressed character bitmaps (FONT_RLE)
+ *  - same bitmaps as below, each character compressed separately
+ *  - same format as compressed symbols (see symbols_<size>_h.h)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t FontData[] PROGMEM = {
+  /* symbols and special characters */
+  0xF0,0xF0,0x20,                                                                    /* 0x00 n/a */
+  0x41,0x82,0x11,0x04,0x11,0x08,0x11,0x10,0x11,0x20,0x15,0x41,0x03,0x41,0x03,0x20,
+  0x11,0x10,0x11,0x08,0x11,0x04,0x11,0x82,0x50,                                      /* 0x01 symbol: diode A-C */
+  0x41,0x82,0x11,0x40,0x11,0x20,0x11,0x10,0x11,0x08,0x15,0x05,0x03,0x05,0x03,0x08,
+  0x11,0x10,0x11,0x20,0x11,0x40,0x11,0x82,0x50,                                      /* 0x02 symbol: diode C-A */
+  0x42,0x86,0x01,0x84,0x01,0x02,0x01,0x02,0x82,0x86,0x01,0x40,                       /* 0x03 symbol: capacitor */
+  0x21,0x78,0x11,0xFC,0x12,0x86,0x01,0x83,0x86,0x01,0xCC,0x54,0xCE,0x01,0x86,0x01,
+  0x40,                                                                              /* 0x04 omega */
+  0xA1,0x82,0xB1,0x44,0x11,0x7C,0x11,0xB8,0x50,                                      /* 0x05 µ (micro) */
+  0x44,0xFE,0x03,0xFC,0x03,0x61,0x01,0x11,0x01,0x74,0xFC,0x03,0xFE,0x03,0x40,        /* 0x06 symbol: resistor left side */
+  0x43,0xFF,0x01,0xFF,0x81,0x02,0x11,0x02,0x61,0xFF,0x12,0xFF,0x01,0x40,             /* 0x07 symbol: resistor right side */
+
+  0x01,0x44,0x11,0x44,0x31,0x10,0x11,0x28,0x11,0x10,0x11,0x60,0x11,0x0C,0x11,0xC0,
+  0x11,0x7A,0x12,0xFC,0x01,0x24,0x03,0x03,0x01,0x02,0x40,                            /* 0x08 Ä (A umlaut) */
+  0x01,0x44,0x11,0x44,0x31,0x78,0x11,0xFC,0x12,0x86,0x01,0xA3,0x86,0x01,0xFC,0x11,
+  0x78,0x50,                                                                         /* 0x09 Ö (O umlaut) */
+  0x01,0x44,0x11,0x44,0x31,0x82,0xF1,0xC6,0x11,0x78,0x11,0x3C,0x50,                  /* 0x0a Ü (U umlaut) */
+  0x21,0x1C,0x11,0x3E,0x51,0x30,0x51,0x30,0x11,0x60,0x11,0xC0,0x31,0xF0,0x11,0x72,
+  0x50,                                                                              /* 0x0b ß (sharp s) */
+  0x41,0x24,0x11,0x24,0x31,0x3C,0x11,0x7C,0x31,0x38,0x11,0x3C,0x11,0x06,0x11,0x20,
+  0x11,0xBE,0x11,0xDC,0x50,                                                          /* 0x0c ä (a umlaut) */
+  0x41,0x24,0x11,0x24,0x31,0x38,0x11,0x7C,0x11,0xC6,0x71,0xC6,0x11,0x7C,0x11,0x38,
+  0x50,                                                                              /* 0x0d ö (o umlaut) */
+  0x41,0x24,0x11,0x24,0x31,0x42,0xB1,0x20,0x11,0x3E,0x11,0x5C,0x50,                  /* 0x0e ü (u umlaut) */
+  0x21,0x10,0x11,0x38,0x11,0x38,0x11,0x10,0xF0,0x80,                                 /* 0x0f ° (degree) */
+
+  /* standard characters */
+  0xF0,0xF0,0x20,                                                                    /* 0x10 space */
+  0x21,0x10,0xF0,0x21,0x10,0x11,0x10,0x31,0x10,0x50,                                 /* 0x11 ! */
+  0x21,0x44,0x71,0x44,0xF0,0x60,                                                     /* 0x12 " */
+  0x21,0x90,0x31,0xD8,0x35,0xB6,0x01,0xB6,0x01,0x6C,0x14,0xDB,0x01,0xDB,0x01,0x21,
+  0x36,0x31,0x12,0x50,                                                               /* 0x13 # */
+  0x01,0x20,0x11,0xD8,0x11,0xD4,0x11,0x08,0x31,0x0C,0x11,0x18,0x11,0x50,0x11,0x80,
+  0x11,0x40,0x31,0x04,0x11,0xD8,0x11,0x5C,0x11,0x20,0x30,                            /* 0x14 $ */
+  0x27,0x0E,0x02,0x1F,0x03,0x80,0x01,0xC0,0x11,0x1F,0x11,0x6E,0x11,0x30,0x15,0xD8,
+  0x01,0xE0,0x03,0x0C,0x11,0x06,0x14,0xE3,0x03,0xC1,0x01,0x40,                       /* 0x15 % */
+  0x21,0x38,0x11,0x7C,0x31,0x20,0x11,0x5C,0x11,0x34,0x13,0x1E,0x02,0x23,0x13,0x10,
+  0x03,0x60,0x16,0x83,0x01,0x3E,0x01,0xFC,0x01,0x40,                                 /* 0x16 & */
+  0x21,0x10,0x71,0x10,0xF0,0x60,                                                     /* 0x17 ´ */
+  0x25,0x80,0x01,0xE0,0x01,0x50,0x11,0x20,0x11,0x18,0xB1,0x18,0x11,0x20,0x11,0x50,
+  0x14,0xE0,0x01,0x80,0x01,                                                          /* 0x18 ( */
+  0x21,0x06,0x11,0x1E,0x11,0x28,0x11,0x10,0x11,0x60,0xB1,0x60,0x11,0x10,0x11,0x28,
+  0x11,0x1E,0x11,0x06,0x10,                                                          /* 0x19 ) */
+  0x21,0x10,0x31,0xC6,0x11,0xBA,0x11,0x44,0x11,0x10,0x11,0x10,0x11,0x28,0xF0,        /* 0x1a * */
+  0xA1,0x10,0x74,0xEF,0x01,0xEF,0x01,0x41,0x10,0x50,                                 /* 0x1b + */
+  0xF0,0x71,0x18,0x31,0x08,0x31,0x18,0x10,                                           /* 0x1c , */
+  0xF0,0x11,0xFC,0x11,0xFC,0xD0,                                                     /* 0x1d - */
+  0xF0,0x71,0x18,0x31,0x18,0x50,                                                     /* 0x1e . */
+  0x33,0x01,0x80,0x01,0x21,0xC0,0x31,0x60,0x31,0x30,0x31,0x18,0x31,0x0C,0x31,0x06,
+  0x11,0x02,0x10,                                                                    /* 0x1f / */
+  0x21,0x38,0x11,0x7C,0x31,0xC6,0xB1,0xC6,0x31,0x7C,0x11,0x38,0x50,                  /* 0x20 0 */
+  0x21,0x10,0x11,0x0E,0x11,0x0E,0xF0,0x21,0xEE,0x11,0xFE,0x50,                       /* 0x21 1 */
+  0x21,0x3E,0x11,0x7C,0x11,0x02,0x51,0x60,0x31,0x30,0x11,0x18,0x11,0x0C,0x11,0x06,
+  0x11,0x7C,0x11,0x7E,0x50,                                                          /* 0x22 2 */
+  0x21,0x3C,0x11,0x7C,0x71,0x78,0x11,0x78,0x91,0x7C,0x11,0x3C,0x50,                  /* 0x23 3 */
+  0x21,0x20,0x11,0x10,0x11,0x18,0x31,0x0C,0x11,0x06,0x31,0x03,0x11,0xDE,0x11,0xDF,
+  0x51,0x20,0x50,                                                                    /* 0x24 4 */
+  0x21,0x7C,0x11,0x78,0x51,0x18,0x11,0x3C,0x11,0x60,0x71,0x60,0x11,0x3C,0x11,0x1C,
+  0x50,                                                                              /* 0x25 5 */
+  0x21,0x78,0x11,0x7C,0x31,0x06,0x11,0x38,0x11,0x7C,0x11,0xC4,0x71,0xC6,0x11,0x7C,
+  0x11,0x38,0x50,                                                                    /* 0x26 6 */
+  0x21,0xFE,0x11,0x7E,0x11,0xC0,0x11,0x60,0x31,0x30,0x31,0x18,0x51,0x0C,0x31,0x04,
+  0x50,                                                                              /* 0x27 7 */
+  0x21,0x7C,0x11,0xFE,0x51,0xE6,0x11,0x7C,0x11,0x7C,0x11,0x26,0x11,0xC0,0x31,0xC0,
+  0x11,0x7E,0x11,0x3C,0x50,                                                          /* 0x28 8 */
+  0x21,0x38,0x11,0x7C,0x11,0xC6,0x71,0x46,0x11,0x7C,0x11,0x38,0x11,0xC0,0x31,0x7C,
+  0x11,0x3C,0x50,                                                                    /* 0x29 9 */
+  0xA1,0x18,0x31,0x18,0x71,0x18,0x31,0x18,0x50,                                      /* 0x2a : */
+  0xA1,0x18,0x31,0x18,0x71,0x18,0x31,0x08,0x31,0x18,0x10,                            /* 0x2b ; */
+  0xB4,0x01,0xC0,0x01,0xF0,0x11,0x3C,0x31,0x3C,0x11,0xF0,0x12,0xC0,0x01,0x11,0x01,
+  0x40,                                                                              /* 0x2c < */
+  0xE4,0xFE,0x01,0xFE,0x01,0x24,0xFE,0x01,0xFE,0x01,0x80,                            /* 0x2d = */
+  0xA1,0x02,0x11,0x0E,0x11,0x3C,0x11,0xF0,0x31,0xF0,0x11,0x3C,0x11,0x0E,0x11,0x02,
+  0x50,                                                                              /* 0x2e > */
+  0x21,0x7E,0x11,0xBC,0x11,0x40,0x11,0x02,0x11,0xC0,0x11,0x60,0x11,0x30,0x11,0x18,
+  0x31,0x08,0x11,0x08,0x31,0x08,0x50,                                                /* 0x2f ? */
+  0x21,0x78,0x11,0xFC,0x11,0x66,0x11,0x71,0x11,0x1A,0x31,0x40,0x31,0x20,0x15,0x5B,
+  0x03,0xF4,0x03,0x3A,0x11,0x7C,0x50,                                                /* 0x30 @ */
+  0x61,0x10,0x11,0x38,0x31,0x6C,0x31,0x38,0x11,0x38,0x11,0xC6,0x51,0x82,0x50,        /* 0x31 A */
+  0x61,0x7E,0x11,0xFC,0x31,0xC0,0x11,0x7C,0x11,0x7C,0x11,0xC0,0x51,0xFC,0x11,0x7E,
+  0x50,                                                                              /* 0x32 B */
+  0x61,0xF0,0x11,0x7C,0x11,0x88,0x11,0x06,0x71,0x06,0x11,0x08,0x11,0xFC,0x11,0xF0,
+  0x50,                                                                              /* 0x33 C */
+  0x61,0x3E,0x11,0x7C,0x11,0xC0,0xB1,0xC0,0x11,0x7C,0x11,0x3E,0x50,                  /* 0x34 D */
+  0x61,0xFE,0x11,0xFC,0x71,0x7C,0x11,0x7C,0x51,0xFC,0x11,0xFE,0x50,                  /* 0x35 E */
+  0x61,0xFE,0x11,0xFC,0x71,0x7C,0x11,0x7C,0x71,0x02,0x50,                            /* 0x36 F */
+  0x63,0xF0,0x01,0xFC,0x13,0x08,0x01,0x06,0x33,0xC0,0x01,0xC0,0x11,0x06,0x11,0x08,
+  0x11,0xFC,0x12,0xF0,0x01,0x40,                                                     /* 0x37 G */
+  0x61,0x82,0x91,0x7C,0x11,0x7C,0x71,0x82,0x50,                                      /* 0x38 H */
+  0x61,0x7C,0x11,0x6C,0xF1,0x6C,0x11,0x7C,0x50,                                      /* 0x39 I */
+  0x61,0x78,0x11,0x38,0xF1,0x7C,0x11,0x3C,0x50,                                      /* 0x3a J */
+  0x61,0x82,0x11,0xC0,0x11,0x60,0x11,0x30,0x11,0x1C,0x11,0x04,0x11,0x18,0x11,0x70,
+  0x11,0xE0,0x14,0x80,0x01,0x02,0x01,0x40,                                           /* 0x3b K */
+  0x61,0x02,0xF0,0x21,0xFC,0x11,0xFE,0x50,                                           /* 0x3c L */
+  0x61,0xC3,0x31,0x04,0x11,0x62,0x31,0x08,0x11,0x34,0x31,0x18,0x31,0x81,0x50,        /* 0x3d M */
+  0x61,0x82,0x11,0x04,0x11,0x0C,0x31,0x18,0x31,0x30,0x31,0x60,0x11,0x40,0x11,0x82,
+  0x50,                                                                              /* 0x3e N */
+  0x61,0x38,0x11,0x7C,0x11,0xC6,0xB1,0xC6,0x11,0x7C,0x11,0x38,0x50,                  /* 0x3f O */
+  0x61,0x7E,0x11,0xFC,0x51,0xC0,0x11,0x7C,0x11,0x3C,0x71,0x02,0x50,                  /* 0x40 P */
+  0x61,0x78,0x11,0xFC,0x12,0x86,0x01,0xA3,0x86,0x01,0xFC,0x11,0x38,0x14,0xC0,0x01,
+  0x80,0x01,                                                                         /* 0x41 Q */
+  0x61,0x3E,0x11,0x7C,0x51,0x60,0x11,0x3C,0x11,0x0C,0x11,0x30,0x11,0x60,0x11,0xC0,
+  0x11,0x82,0x50,                                                                    /* 0x42 R */
+  0x61,0xFC,0x11,0x7E,0x11,0x80,0x11,0x04,0x11,0x1E,0x11,0x78,0x11,0xE0,0x31,0x42,
+  0x11,0xFC,0x11,0x3E,0x50,                                                          /* 0x43 S */
+  0x64,0xFE,0x01,0xEE,0x01,0xF0,0x11,0x10,0x50,                                      /* 0x44 T */
+  0x61,0x82,0xF1,0xC6,0x11,0x78,0x11,0x3C,0x50,                                      /* 0x45 U */
+  0x64,0x01,0x02,0x03,0x03,0x22,0x86,0x01,0x21,0xC0,0x11,0x0C,0x31,0x78,0x31,0x30,
+  0x50,                                                                              /* 0x46 V */
+  0x62,0x01,0x02,0x23,0x13,0x03,0x20,0x31,0x18,0x11,0x60,0x12,0x86,0x01,0x21,0x48,
+  0x11,0x84,0x50,                                                                    /* 0x47 W */
+  0x67,0x01,0x02,0x03,0x03,0x86,0x01,0xCC,0x11,0x78,0x31,0x78,0x11,0xCC,0x16,0x86,
+  0x01,0x03,0x03,0x01,0x02,0x40,                                                     /* 0x48 X */
+  0x61,0x82,0x31,0xC6,0x31,0x6C,0x11,0x38,0x91,0x10,0x50,                            /* 0x49 Y */
+  0x61,0xFE,0x11,0x7E,0x31,0xC0,0x11,0x60,0x11,0x30,0x11,0x18,0x11,0x0C,0x11,0x06,
+  0x11,0xFC,0x11,0xFE,0x50,                                                          /* 0x4a Z */
+  0x21,0xF8,0x11,0xF0,0xF0,0x81,0xF0,0x11,0xF8,0x10,                                 /* 0x4b [ */
+  0x21,0x02,0x11,0x06,0x31,0x0C,0x31,0x18,0x31,0x30,0x31,0x60,0x31,0xC0,0x31,0x80,
+  0x30,                                                                              /* 0x4c \ */
+  0x21,0x3E,0x11,0x1E,0xF0,0x81,0x20,0x30,                                           /* 0x4d ] */
+  0x21,0x20,0x31,0x10,0x11,0x60,0x11,0x08,0x11,0x10,0x11,0xC0,0x11,0x0C,0x34,0x86,
+  0x01,0x02,0x01,0x80,                                                               /* 0x4e ^ */
+  0xF0,0xB4,0xFF,0x03,0xFF,0x03,0x20,                                                /* 0x4f _ */
+  0x01,0x10,0x11,0x30,0x11,0x20,0xF0,0xC0,                                           /* 0x50 ` */
+  0xA1,0x3C,0x11,0x7E,0x11,0x02,0x11,0x38,0x11,0x3C,0x11,0x06,0x11,0x20,0x11,0xBE,
+  0x11,0xDC,0x50,                                                                    /* 0x51 a */
+  0x21,0x02,0x71,0x78,0x11,0x3C,0x11,0xC4,0x71,0xC4,0x11,0x7C,0x11,0x3A,0x50,        /* 0x52 b */
+  0xA1,0xF8,0x11,0xFC,0x11,0x06,0x71,0x06,0x11,0xFC,0x11,0xF8,0x50,                  /* 0x53 c */
+  0x21,0x80,0x71,0x38,0x11,0x7C,0x11,0x46,0x71,0x46,0x11,0x78,0x11,0xBC,0x50,        /* 0x54 d */
+  0xA1,0x38,0x11,0x7C,0x11,0xC6,0x11,0xFC,0x11,0x7C,0x11,0x80,0x11,0xC6,0x11,0x7C,
+  0x11,0x38,0x50,                                                                    /* 0x55 e */
+  0x25,0xE0,0x01,0xF8,0x01,0x10,0x34,0xF6,0x01,0xF6,0x01,0xC1,0x08,0x50,             /* 0x56 f */
+  0xA1,0xB8,0x11,0x7C,0x11,0x46,0x71,0x46,0x11,0x78,0x11,0x3C,0x11,0xC0,0x11,0x7C,
+  0x10,                                                                              /* 0x57 g */
+  0x21,0x02,0x71,0x70,0x11,0xF8,0x11,0x0C,0x11,0x04,0x91,0x82,0x50,                  /* 0x58 h */
+  0x21,0x18,0x31,0x18,0x31,0x1C,0x11,0x0C,0xB1,0x28,0x11,0x38,0x50,                  /* 0x59 i */
+  0x21,0x30,0x31,0x30,0x31,0x3C,0x11,0x1C,0xF0,0x21,0x3E,0x10,                       /* 0x5a j */
+  0x21,0x02,0x71,0x80,0x11,0xE0,0x11,0x70,0x11,0x1C,0x11,0x04,0x11,0x38,0x11,0x70,
+  0x11,0xC0,0x11,0x82,0x50,                                                          /* 0x5b k */
+  0x21,0x3C,0x11,0x1C,0xF0,0x61,0x20,0x50,                                           /* 0x5c l */
+  0xA1,0xCD,0x13,0xFE,0x01,0x22,0xB2,0x11,0x01,0x40,                                 /* 0x5d m */
+  0xA1,0x72,0x11,0xF8,0x11,0x0C,0x11,0x04,0x91,0x82,0x50,                            /* 0x5e n */
+  0xA1,0x38,0x11,0x7C,0x11,0xC6,0x71,0xC6,0x11,0x7C,0x11,0x38,0x50,                  /* 0x5f o */
+  0xA1,0x7A,0x11,0x3C,0x11,0xC4,0x71,0xC4,0x11,0x7C,0x11,0x38,0x50,                  /* 0x60 p */
+  0xA1,0xB8,0x11,0x7C,0x11,0x46,0x71,0x46,0x11,0x78,0x11,0x3C,0x50,                  /* 0x61 q */
+  0xA1,0xE4,0x11,0x70,0x11,0x18,0x11,0x88,0x91,0x04,0x50,                            /* 0x62 r */
+  0xA1,0x7C,0x11,0x7E,0x31,0x0E,0x11,0x3C,0x11,0x70,0x11,0x02,0x11,0x7C,0x11,0x3E,
+  0x50,                                                                              /* 0x63 s */
+  0x61,0x08,0x31,0xF6,0x11,0xF6,0xB1,0xF8,0x11,0xF0,0x50,                            /* 0x64 t */
+  0xA1,0x82,0xB1,0x46,0x11,0x7C,0x11,0xB8,0x50,                                      /* 0x65 u */
+  0xA4,0x01,0x01,0x83,0x01,0x21,0xC0,0x11,0x06,0x11,0x60,0x11,0x0C,0x11,0x30,0x11,
+  0x18,0x50,                                                                         /* 0x66 v */
+  0xA3,0x01,0x02,0x10,0x12,0x23,0x03,0x21,0x78,0x33,0x86,0x01,0x48,0x11,0x84,0x50,   /* 0x67 w */
+  0xA5,0x02,0x01,0x86,0x01,0xCC,0x11,0x78,0x31,0x78,0x11,0xCC,0x14,0x86,0x01,0x02,
+  0x01,0x40,                                                                         /* 0x68 x */
+  0xA1,0x82,0x51,0xC6,0x31,0x6C,0x11,0x38,0x51,0x18,0x11,0x0E,0x10,                  /* 0x69 y */
+  0xA1,0xFE,0x11,0x7E,0x11,0xC0,0x11,0x60,0x11,0x30,0x11,0x18,0x11,0x0C,0x11,0xFA,
+  0x11,0xFE,0x50,                                                                    /* 0x6a z */
+  0x21,0xE0,0x11,0xF0,0xB1,0x1C,0x11,0x1C,0x91,0xF0,0x11,0xE0,0x10,                  /* 0x6b { */
+  0x21,0x10,0xF0,0xC1,0x10,0x10,                                                     /* 0x6c | */
+  0x21,0x1C,0x11,0x3C,0xB1,0xE0,0x11,0xE0,0x91,0x3C,0x11,0x1C,0x10,                  /* 0x6d } */
+  0xE3,0x0E,0x02,0x3F,0x14,0xF0,0x03,0xC1,0x01,0xA0,                                 /* 0x6e ~ */
+
+  /* Czech characters */
+  0x01,0x20,0x11,0x30,0x11,0x10,0x11,0x10,0x11,0x38,0x31,0x6C,0x31,0x38,0x11,0x38,
+  0x11,0xC6,0x51,0x82,0x50,                                                          /* 0x6f Á (A with acute) */
+  0x41,0x20,0x11,0x30,0x11,0x10,0x11,0x3C,0x11,0x7E,0x11,0x02,0x11,0x38,0x11,0x3C,
+  0x11,0x06,0x11,0x20,0x11,0xBE,0x11,0xDC,0x50,                                      /* 0x70 á (a with acute) */
+  0x01,0x20,0x11,0x30,0x11,0x10,0x11,0xFE,0x11,0xFC,0x71,0x7C,0x11,0x7C,0x51,0xFC,
+  0x11,0xFE,0x50,                                                                    /* 0x71 É (E with acute) */
+  0x41,0x20,0x11,0x30,0x11,0x10,0x11,0x38,0x11,0x7C,0x11,0xC6,0x11,0xFC,0x11,0x7C,
+  0x11,0x80,0x11,0xC6,0x11,0x7C,0x11,0x38,0x50,                                      /* 0x72 é (e with acute) */
+  0x01,0x20,0x11,0x30,0x11,0x10,0x11,0x7C,0x11,0x6C,0xF1,0x6C,0x11,0x7C,0x50,        /* 0x73 Í (I with acute) */
+  0x41,0x20,0x11,0x30,0x11,0x10,0x11,0x1C,0x11,0x0C,0xB1,0x28,0x11,0x38,0x50,        /* 0x74 í (i with acute) */
+  0x01,0x20,0x11,0x30,0x11,0x10,0x11,0x38,0x11,0x7C,0x11,0xC6,0xB1,0xC6,0x11,0x7C,
+  0x11,0x38,0x50,                                                                    /* 0x75 Ó (O with acute) */
+  0x41,0x20,0x11,0x30,0x11,0x10,0x11,0x38,0x11,0x7C,0x11,0xC6,0x71,0xC6,0x11,0x7C,
+  0x11,0x38,0x50,                                                                    /* 0x76 ó (o with acute) */
+  0x01,0x20,0x11,0x30,0x11,0x10,0x11,0x82,0xF1,0xC6,0x11,0x78,0x11,0x3C,0x50,        /* 0x77 Ú (U with acute) */
+  0x41,0x20,0x11,0x30,0x11,0x10,0x11,0x82,0xB1,0x46,0x11,0x7C,0x11,0xB8,0x50,        /* 0x78 ú (u with acute) */
+  0x01,0x20,0x11,0x30,0x11,0x10,0x11,0x82,0x31,0xC6,0x31,0x6C,0x11,0x38,0x91,0x10,
+  0x50,                                                                              /* 0x79 Ý (Y with acute) */
+  0x41,0x20,0x11,0x30,0x11,0x10,0x11,0x82,0x51,0xC6,0x31,0x6C,0x11,0x38,0x51,0x18,
+  0x11,0x0E,0x10,                                                                    /* 0x7a ý (y with acute) */
+  0x01,0x28,0x11,0x38,0x11,0x10,0x11,0xF0,0x11,0x7C,0x11,0x88,0x11,0x06,0x71,0x06,
+  0x11,0x08,0x11,0xFC,0x11,0xF0,0x50,                                                /* 0x7b Č (C with caron) */
+  0x41,0x28,0x11,0x38,0x11,0x10,0x11,0xF8,0x11,0xFC,0x11,0x06,0x71,0x06,0x11,0xFC,
+  0x11,0xF8,0x50,                                                                    /* 0x7c č (c with caron) */
+  0x01,0x28,0x11,0x38,0x11,0x10,0x11,0x3E,0x11,0x7C,0x11,0xC0,0xB1,0xC0,0x11,0x7C,
+  0x11,0x3E,0x50,                                                                    /* 0x7d Ď (D with caron) */
+  0x21,0x80,0x11,0x28,0x11,0x38,0x11,0x10,0x11,0x38,0x11,0x7C,0x11,0x46,0x71,0x46,
+  0x11,0x78,0x11,0xBC,0x50,                                                          /* 0x7e d´ (d with caron) */
+  0x01,0x28,0x11,0x38,0x11,0x10,0x11,0xFE,0x11,0xFC,0x71,0x7C,0x11,0x7C,0x51,0xFC,
+  0x11,0xFE,0x50,                                                                    /* 0x7f Ě (E with caron) */
+  0x41,0x28,0x11,0x38,0x11,0x10,0x11,0x38,0x11,0x7C,0x11,0xC6,0x11,0xFC,0x11,0x7C,
+  0x11,0x80,0x11,0xC6,0x11,0x7C,0x11,0x38,0x50,                                      /* 0x80 ě (e with caron) */
+  0x01,0x28,0x11,0x38,0x11,0x10,0x11,0x82,0x11,0x04,0x11,0x0C,0x31,0x18,0x31,0x30,
+  0x31,0x60,0x11,0x40,0x11,0x82,0x50,                                                /* 0x81 Ň (N with caron) */
+  0x41,0x28,0x11,0x38,0x11,0x10,0x11,0x72,0x11,0xF8,0x11,0x0C,0x11,0x04,0x91,0x82,
+  0x50,                                                                              /* 0x82 ň (n with caron) */
+  0x01,0x28,0x11,0x38,0x11,0x10,0x11,0x3E,0x11,0x7C,0x51,0x60,0x11,0x3C,0x11,0x0C,
+  0x11,0x30,0x11,0x60,0x11,0xC0,0x11,0x82,0x50,                                      /* 0x83 Ř (R with caron) */
+  0x41,0x28,0x11,0x38,0x11,0x10,0x11,0xE4,0x11,0x70,0x11,0x18,0x11,0x88,0x91,0x04,
+  0x50,                                                                              /* 0x84 ř (r with caron) */
+  0x01,0x28,0x11,0x38,0x11,0x10,0x11,0xFC,0x11,0x7E,0x11,0x80,0x11,0x04,0x11,0x1E,
+  0x11,0x78,0x11,0xE0,0x31,0x42,0x11,0xFC,0x11,0x3E,0x50,                            /* 0x85 Š (S with caron) */
+  0x41,0x28,0x11,0x38,0x11,0x10,0x11,0x7C,0x11,0x7E,0x31,0x0E,0x11,0x3C,0x11,0x70,
+  0x11,0x02,0x11,0x7C,0x11,0x3E,0x50,                                                /* 0x86 š (s with caron) */
+  0x01,0x28,0x11,0x38,0x11,0x10,0x14,0xFE,0x01,0xEE,0x01,0xF0,0x11,0x10,0x50,        /* 0x87 Ť (T with caron) */
+  0x41,0x40,0x11,0x68,0x11,0x20,0x11,0xF6,0x11,0xF6,0xB1,0xF8,0x11,0xF0,0x50,        /* 0x88 t' (t with caron) */
+  0x21,0x10,0x11,0x38,0x11,0x38,0x11,0x10,0x11,0x82,0xB1,0x46,0x11,0x7C,0x11,0xB8,
+  0x50,                                                                              /* 0x89 ů (u with ring above) */
+  0x01,0x28,0x11,0x38,0x11,0x10,0x14,0xFE,0x01,0x7E,0x01,0x21,0xC0,0x11,0x60,0x11,
+  0x30,0x11,0x18,0x11,0x0C,0x11,0x06,0x11,0xFC,0x11,0xFE,0x50,                       /* 0x8a Ž (Z with caron) */
+  0x41,0x28,0x11,0x38,0x11,0x10,0x11,0xFE,0x11,0x7E,0x11,0xC0,0x11,0x60,0x11,0x30,
+  0x11,0x18,0x11,0x0C,0x11,0xFA,0x11,0xFE,0x50,                                      /* 0x8b ž (z with caron) */
+
+  /* additional Polish characters */
+  0x61,0x10,0x11,0x38,0x31,0x6C,0x31,0x38,0x11,0x38,0x11,0xC6,0x51,0xC2,0x11,0xC0,
+  0x11,0x80,0x10,                                                                    /* 0x8c Ą (A with ogonek) */
+  0xA1,0x3C,0x11,0x7E,0x11,0x02,0x11,0x38,0x11,0x3C,0x11,0x06,0x11,0x20,0x11,0xBE,
+  0x11,0x9C,0x11,0xC0,0x11,0x80,0x10,                                                /* 0x8d ą (a with ogonek) */
+  0x01,0x20,0x11,0x30,0x11,0x10,0x11,0xF0,0x11,0x7C,0x11,0x88,0x11,0x06,0x71,0x06,
+  0x11,0x08,0x11,0xFC,0x11,0xF0,0x50,                                                /* 0x8e Ć (C with caron) */
+  0x41,0x20,0x11,0x30,0x11,0x10,0x11,0xF8,0x11,0xFC,0x11,0x06,0x71,0x06,0x11,0xFC,
+  0x11,0xF8,0x50,                                                                    /* 0x8f ć (c with caron) */
+  0x61,0xFE,0x11,0xFC,0x71,0x7C,0x11,0x7C,0x51,0xFC,0x11,0xBE,0x11,0xC0,0x11,0x80,
+  0x10,                                                                              /* 0x90 Ę (E with ogonek) */
+  0xA1,0x38,0x11,0x7C,0x11,0xC6,0x11,0xFC,0x11,0x7C,0x11,0x80,0x11,0xC6,0x11,0x7C,
+  0x11,0x38,0x50,                                                                    /* 0x91 ę (e with ogonek) */
+  0x61,0x02,0x71,0x04,0x11,0x05,0x11,0x01,0x51,0xFC,0x11,0xFE,0x50,                  /* 0x92 Ł (L with stroke) */
+  0x41,0x3C,0x11,0x1C,0x71,0x40,0x11,0x50,0x11,0x10,0x71,0x20,0x50,                  /* 0x93 ł (l with stroke) */
+  0x01,0x20,0x11,0x30,0x11,0x10,0x11,0x82,0x11,0x04,0x11,0x0C,0x31,0x18,0x31,0x30,
+  0x31,0x60,0x11,0x40,0x11,0x82,0x50,                                                /* 0x94 Ń (N with acute) */
+  0x41,0x20,0x11,0x30,0x11,0x10,0x11,0x72,0x11,0xF8,0x11,0x0C,0x11,0x04,0x91,0x82,
+  0x50,                                                                              /* 0x95 ń (n with acute) */
+  0x01,0x20,0x11,0x30,0x11,0x10,0x11,0xFC,0x11,0x7E,0x11,0x80,0x11,0x04,0x11,0x1E,
+  0x11,0x78,0x11,0xE0,0x31,0x42,0x11,0xFC,0x11,0x3E,0x50,                            /* 0x96 Ś (S with acute) */
+  0x41,0x20,0x11,0x30,0x11,0x10,0x11,0x7C,0x11,0x7E,0x31,0x0E,0x11,0x3C,0x11,0x70,
+  0x11,0x02,0x11,0x7C,0x11,0x3E,0x50,                                                /* 0x97 ś (s with acute) */
+  0x01,0x20,0x11,0x30,0x11,0x10,0x14,0xFE,0x01,0x7E,0x01,0x21,0xC0,0x11,0x60,0x11,
+  0x30,0x11,0x18,0x11,0x0C,0x11,0x06,0x11,0xFC,0x11,0xFE,0x50,                       /* 0x98 Ź (Z with acute) */
+  0x41,0x20,0x11,0x30,0x11,0x10,0x11,0xFE,0x11,0x7E,0x11,0xC0,0x11,0x60,0x11,0x30,
+  0x11,0x18,0x11,0x0C,0x11,0xFA,0x11,0xFE,0x50,                                      /* 0x99 ź (z with acute) */
+  0x21,0x10,0x11,0x10,0x14,0xFE,0x01,0x7E,0x01,0x21,0xC0,0x11,0x60,0x11,0x30,0x11,
+  0x18,0x11,0x0C,0x11,0x06,0x11,0xFC,0x11,0xFE,0x50,                                 /* 0x9a Ż (Z with dot above) */
+  0x61,0x10,0x11,0x10,0x11,0xFE,0x11,0x7E,0x11,0xC0,0x11,0x60,0x11,0x30,0x11,0x18,
+  0x11,0x0C,0x11,0xFA,0x11,0xFE,0x50,                                                /* 0x9b ż (z with dot above) */
+
+  /* additional Romanian characters */
+  0x01,0x10,0x11,0x38,0x11,0x28,0x11,0x10,0x11,0x38,0x31,0x6C,0x31,0x38,0x11,0x38,
+  0x11,0xC6,0x51,0x82,0x50,                                                          /* 0x9c Â (A with circumflex) */
+  0x21,0x08,0x11,0x1C,0x11,0x14,0x31,0x3C,0x11,0x7E,0x11,0x02,0x11,0x38,0x11,0x3C,
+  0x11,0x06,0x11,0x20,0x11,0xBE,0x11,0xDC,0x50,                                      /* 0x9d â (a with circumflex) */
+  0x01,0x28,0x11,0x38,0x11,0x10,0x11,0x10,0x11,0x38,0x31,0x6C,0x31,0x38,0x11,0x38,
+  0x11,0xC6,0x51,0x82,0x50,                                                          /* 0x9e Ă (A with breve) */
+  0x21,0x14,0x11,0x1C,0x11,0x08,0x31,0x3C,0x11,0x7E,0x11,0x02,0x11,0x38,0x11,0x3C,
+  0x11,0x06,0x11,0x20,0x11,0xBE,0x11,0xDC,0x50,                                      /* 0x9f ă (a with breve) */
+  0x01,0x10,0x11,0x38,0x11,0x28,0x11,0x7C,0x11,0x6C,0xF1,0x6C,0x11,0x7C,0x50,        /* 0xa0 Î (I with circumflex) */
+  0x21,0x08,0x11,0x1C,0x11,0x14,0x31,0x1C,0x11,0x0C,0xB1,0x6C,0x11,0x7C,0x50,        /* 0xa1 î (i with circumflex) */
+  0x61,0xFC,0x11,0x7E,0x11,0x80,0x11,0x04,0x11,0x1E,0x11,0x78,0x11,0xE0,0x31,0x42,
+  0x11,0xFC,0x11,0x7E,0x11,0x60,0x11,0x20,0x10,                                      /* 0xa2 Ş (S with cedilla) */
+  0xA1,0x7C,0x11,0x7E,0x31,0x0E,0x11,0x3C,0x11,0x70,0x11,0x02,0x11,0x7C,0x11,0x7E,
+  0x11,0x60,0x11,0x20,0x10,                                                          /* 0xa3 ş (s with cedilla) */
+  0x64,0xFE,0x01,0xEE,0x01,0xF0,0x11,0x30,0x11,0x30,0x11,0x10,0x10,                  /* 0xa4 Ţ (T with cedilla) */
+  0x61,0x08,0x31,0xF6,0x11,0xF6,0xB1,0xF8,0x11,0xD0,0x11,0x30,0x11,0x10,0x10,        /* 0xa5 ţ (t with cedilla) */
+
+  /* additional Hungarian characters */
+  0x01,0x28,0x31,0x28,0x11,0x38,0x11,0x7C,0x11,0xC6,0xB1,0xC6,0x11,0x7C,0x11,0x38,
+  0x50,                                                                              /* 0xa6 Ő (O with double acute) */
+  0x41,0x28,0x31,0x28,0x11,0x38,0x11,0x7C,0x11,0xC6,0x71,0xC6,0x11,0x7C,0x11,0x38,
+  0x50,                                                                              /* 0xa7 ő (o with double acute) */
+  0x01,0x28,0x31,0x28,0x11,0x82,0xF1,0xC6,0x11,0x78,0x11,0x3C,0x50,                  /* 0xa8 Ű (U with double acute) */
+  0x41,0x28,0x31,0x28,0x11,0x82,0xB1,0x46,0x11,0x7C,0x11,0xB8,0x50,                  /* 0xa9 ű (u with double acute) */
+
+  /* additional Serbo-Croatian characters */
+  0x61,0x3E,0x11,0x7C,0x11,0xC0,0x31,0x05,0x11,0x05,0x51,0xC0,0x11,0x7C,0x11,0x3E,
+  0x50,                                                                              /* 0xaa Đ (D with stroke) */
+  0x21,0x80,0x11,0x40,0x11,0x40,0x31,0x38,0x11,0x7C,0x11,0x46,0x71,0x46,0x11,0x78,
+  0x11,0xBC,0x50,                                                                    /* 0xab đ (d with stroke) */
+
+  /* additional Albanian characters */
+  0x61,0xF0,0x11,0x7C,0x11,0x88,0x11,0x06,0x71,0x06,0x11,0x08,0x11,0xFC,0x11,0xD0,
+  0x11,0x30,0x11,0x10,0x10,                                                          /* 0xac Ç (C with cedilla) */
+  0xA1,0xF8,0x11,0xFC,0x11,0x06,0x71,0x06,0x11,0xFC,0x11,0xE8,0x11,0x18,0x11,0x08,
+  0x10                                                                               /* 0xad ç (c with cedilla) */
+  #ifdef FONT_EXTRA
+  ,
+
+  /* extra characters */
+  0x03,0xFF,0x03,0x10,0x11,0x0E,0x11,0x0E,0xF0,0x21,0xEE,0x11,0xFE,0x50,             /* 0xae 1 (reversed color) */
+  0x03,0xFF,0x03,0x3E,0x11,0x7C,0x11,0x02,0x51,0x60,0x31,0x30,0x11,0x18,0x11,0x0C,
+  0x11,0x06,0x11,0x7C,0x11,0x7E,0x50,                                                /* 0xaf 2 (reversed color) */
+  0x03,0xFF,0x03,0x3C,0x11,0x7C,0x71,0x78,0x11,0x78,0x91,0x7C,0x11,0x3C,0x50,        /* 0xb0 3 (reversed color) */
+  0x02,0xFF,0x03,0x81,0x84,0x11,0x48,0x11,0xB4,0x11,0x48,0x11,0x48,0x11,0xB4,0x11,
+  0x48,0x11,0x84,0x70,                                                               /* 0xb1 x (reversed color) */
+  0x62,0xFF,0x03,0x22,0xFC,0x03,0xA2,0xFC,0x03,0x22,0xFF,0x03,0x40,                  /* 0xb2 symbol: battery left side, low */
+  0x62,0xFF,0x03,0x24,0xFC,0x03,0xF8,0x01,0x64,0xF8,0x01,0xFC,0x03,0x22,0xFF,0x03,
+  0x40,                                                                              /* 0xb3 symbol: battery left side, high */
+  0x61,0xFF,0x31,0x7F,0x22,0x03,0x80,0x31,0x80,0x22,0x03,0x7F,0x31,0xFF,0x50,        /* 0xb4 symbol: battery right side, low */
+  0x61,0xFF,0x31,0x7F,0x13,0x3F,0x03,0x80,0x31,0x80,0x13,0x3F,0x03,0x7F,0x31,0xFF,
+  0x50                                                                               /* 0xb5 symbol: battery right side, high */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed characters in FontData[]
+ */
+
+const uint16_t FontIndex[] PROGMEM = {
+  0,        /* 0x00 n/a */
+  3,        /* 0x01 symbol: diode A-C */
+  28,       /* 0x02 symbol: diode C-A */
+  53,       /* 0x03 symbol: capacitor */
+  65,       /* 0x04 omega */
+  82,       /* 0x05 µ (micro) */
+  91,       /* 0x06 symbol: resistor left side */
+  106,      /* 0x07 symbol: resistor right side */
+  120,      /* 0x08 Ä (A umlaut) */
+  147,      /* 0x09 Ö (O umlaut) */
+  165,      /* 0x0a Ü (U umlaut) */
+  178,      /* 0x0b ß (sharp s) */
+  195,      /* 0x0c ä (a umlaut) */
+  216,      /* 0x0d ö (o umlaut) */
+  233,      /* 0x0e ü (u umlaut) */
+  246,      /* 0x0f ° (degree) */
+  256,      /* 0x10 space */
+  259,      /* 0x11 ! */
+  269,      /* 0x12 " */
+  275,      /* 0x13 # */
+  295,      /* 0x14 $ */
+  322,      /* 0x15 % */
+  350,      /* 0x16 & */
+  376,      /* 0x17 ´ */
+  382,      /* 0x18 ( */
+  403,      /* 0x19 ) */
+  424,      /* 0x1a * */
+  439,      /* 0x1b + */
+  449,      /* 0x1c , */
+  457,      /* 0x1d - */
+  463,      /* 0x1e . */
+  469,      /* 0x1f / */
+  488,      /* 0x20 0 */
+  501,      /* 0x21 1 */
+  513,      /* 0x22 2 */
+  534,      /* 0x23 3 */
+  547,      /* 0x24 4 */
+  566,      /* 0x25 5 */
+  583,      /* 0x26 6 */
+  602,      /* 0x27 7 */
+  619,      /* 0x28 8 */
+  640,      /* 0x29 9 */
+  659,      /* 0x2a : */
+  668,      /* 0x2b ; */
+  679,      /* 0x2c < */
+  696,      /* 0x2d = */
+  707,      /* 0x2e > */
+  724,      /* 0x2f ? */
+  747,      /* 0x30 @ */
+  770,      /* 0x31 A */
+  785,      /* 0x32 B */
+  802,      /* 0x33 C */
+  819,      /* 0x34 D */
+  832,      /* 0x35 E */
+  845,      /* 0x36 F */
+  856,      /* 0x37 G */
+  878,      /* 0x38 H */
+  887,      /* 0x39 I */
+  896,      /* 0x3a J */
+  905,      /* 0x3b K */
+  929,      /* 0x3c L */
+  937,      /* 0x3d M */
+  952,      /* 0x3e N */
+  969,      /* 0x3f O */
+  982,      /* 0x40 P */
+  995,      /* 0x41 Q */
+  1013,     /* 0x42 R */
+  1032,     /* 0x43 S */
+  1053,     /* 0x44 T */
+  1062,     /* 0x45 U */
+  1071,     /* 0x46 V */
+  1088,     /* 0x47 W */
+  1107,     /* 0x48 X */
+  1129,     /* 0x49 Y */
+  1140,     /* 0x4a Z */
+  1161,     /* 0x4b [ */
+  1171,     /* 0x4c \ */
+  1188,     /* 0x4d ] */
+  1196,     /* 0x4e ^ */
+  1216,     /* 0x4f _ */
+  1223,     /* 0x50 ` */
+  1231,     /* 0x51 a */
+  1250,     /* 0x52 b */
+  1265,     /* 0x53 c */
+  1278,     /* 0x54 d */
+  1293,     /* 0x55 e */
+  1312,     /* 0x56 f */
+  1326,     /* 0x57 g */
+  1343,     /* 0x58 h */
+  1356,     /* 0x59 i */
+  1369,     /* 0x5a j */
+  1381,     /* 0x5b k */
+  1402,     /* 0x5c l */
+  1410,     /* 0x5d m */
+  1420,     /* 0x5e n */
+  1431,     /* 0x5f o */
+  1444,     /* 0x60 p */
+  1457,     /* 0x61 q */
+  1470,     /* 0x62 r */
+  1481,     /* 0x63 s */
+  1498,     /* 0x64 t */
+  1509,     /* 0x65 u */
+  1518,     /* 0x66 v */
+  1536,     /* 0x67 w */
+  1552,     /* 0x68 x */
+  1570,     /* 0x69 y */
+  1583,     /* 0x6a z */
+  1602,     /* 0x6b { */
+  1615,     /* 0x6c | */
+  1621,     /* 0x6d } */
+  1634,     /* 0x6e ~ */
+  1644,     /* 0x6f Á (A with acute) */
+  1665,     /* 0x70 á (a with acute) */
+  1690,     /* 0x71 É (E with acute) */
+  1709,     /* 0x72 é (e with acute) */
+  1734,     /* 0x73 Í (I with acute) */
+  1749,     /* 0x74 í (i with acute) */
+  1764,     /* 0x75 Ó (O with acute) */
+  1783,     /* 0x76 ó (o with acute) */
+  1802,     /* 0x77 Ú (U with acute) */
+  1817,     /* 0x78 ú (u with acute) */
+  1832,     /* 0x79 Ý (Y with acute) */
+  1849,     /* 0x7a ý (y with acute) */
+  1868,     /* 0x7b Č (C with caron) */
+  1891,     /* 0x7c č (c with caron) */
+  1910,     /* 0x7d Ď (D with caron) */
+  1929,     /* 0x7e d´ (d with caron) */
+  1950,     /* 0x7f Ě (E with caron) */
+  1969,     /* 0x80 ě (e with caron) */
+  1994,     /* 0x81 Ň (N with caron) */
+  2017,     /* 0x82 ň (n with caron) */
+  2034,     /* 0x83 Ř (R with caron) */
+  2059,     /* 0x84 ř (r with caron) */
+  2076,     /* 0x85 Š (S with caron) */
+  2103,     /* 0x86 š (s with caron) */
+  2126,     /* 0x87 Ť (T with caron) */
+  2141,     /* 0x88 t' (t with caron) */
+  2156,     /* 0x89 ů (u with ring above) */
+  2173,     /* 0x8a Ž (Z with caron) */
+  2201,     /* 0x8b ž (z with caron) */
+  2226,     /* 0x8c Ą (A with ogonek) */
+  2245,     /* 0x8d ą (a with ogonek) */
+  2268,     /* 0x8e Ć (C with caron) */
+  2291,     /* 0x8f ć (c with caron) */
+  2310,     /* 0x90 Ę (E with ogonek) */
+  2327,     /* 0x91 ę (e with ogonek) */
+  2346,     /* 0x92 Ł (L with stroke) */
+  2359,     /* 0x93 ł (l with stroke) */
+  2372,     /* 0x94 Ń (N with acute) */
+  2395,     /* 0x95 ń (n with acute) */
+  2412,     /* 0x96 Ś (S with acute) */
+  2439,     /* 0x97 ś (s with acute) */
+  2462,     /* 0x98 Ź (Z with acute) */
+  2490,     /* 0x99 ź (z with acute) */
+  2515,     /* 0x9a Ż (Z with dot above) */
+  2541,     /* 0x9b ż (z with dot above) */
+  2564,     /* 0x9c Â (A with circumflex) */
+  2585,     /* 0x9d â (a with circumflex) */
+  2610,     /* 0x9e Ă (A with breve) */
+  2631,     /* 0x9f ă (a with breve) */
+  2656,     /* 0xa0 Î (I with circumflex) */
+  2671,     /* 0xa1 î (i with circumflex) */
+  2686,     /* 0xa2 Ş (S with cedilla) */
+  2711,     /* 0xa3 ş (s with cedilla) */
+  2732,     /* 0xa4 Ţ (T with cedilla) */
+  2745,     /* 0xa5 ţ (t with cedilla) */
+  2760,     /* 0xa6 Ő (O with double acute) */
+  2777,     /* 0xa7 ő (o with double acute) */
+  2794,     /* 0xa8 Ű (U with double acute) */
+  2807,     /* 0xa9 ű (u with double acute) */
+  2820,     /* 0xaa Đ (D with stroke) */
+  2837,     /* 0xab đ (d with stroke) */
+  2856,     /* 0xac Ç (C with cedilla) */
+  2877      /* 0xad ç (c with cedilla) */
+  #ifdef FONT_EXTRA
+  ,
+  2894,     /* 0xae 1 (reversed color) */
+  2908,     /* 0xaf 2 (reversed color) */
+  2931,     /* 0xb0 3 (reversed color) */
+  2946,     /* 0xb1 x (reversed color) */
+  2966,     /* 0xb2 symbol: battery left side, low */
+  2979,     /* 0xb3 symbol: battery left side, high */
+  2996,     /* 0xb4 symbol: battery right side, low */
+  3011      /* 0xb5 symbol: battery right side, high */
+  #endif
+};
+
+#else
+
 /*
  *  character bitmaps
  *  - to reduce size we place some symbols and special characters at
@@ -430,6 +941,8 @@ const uint8_t FontData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 /*
  *  font lookup table for ISO 8859-2
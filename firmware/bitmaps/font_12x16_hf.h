@@ -29,6 +29,355 @@
 #define FONT_BYTES_Y        16     /* 16 bytes in y direction */
 
 
+#ifdef FONT_RLE
+
+/*
+ *  compressed character bitmaps (FONT_RLE)
+ *  - same bitmaps as below, each character compressed separately
+ *  - same format as compressed symbols (see symbols_<size>_h.h)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t FontData[] PROGMEM = {
+  /* symbols and special characters */
+  0xF0,0xF0,0x20,                                                                    /* 0x00 n/a */
+  0x23,0x02,0x07,0x04,0x11,0x08,0x11,0x10,0x11,0x20,0x11,0x40,0x12,0x81,0x08,0x23,
+  0x81,0x08,0x40,0x11,0x20,0x11,0x10,0x11,0x08,0x11,0x04,0x12,0x02,0x07,             /* 0x01 symbol: diode A-C */
+  0x22,0x0E,0x04,0x11,0x02,0x12,0x01,0x80,0x11,0x40,0x11,0x20,0x12,0x11,0x08,0x23,
+  0x11,0x08,0x20,0x11,0x40,0x11,0x80,0x21,0x01,0x13,0x02,0x0E,0x04,                  /* 0x02 symbol: diode C-A */
+  0x22,0x0E,0x07,0xA2,0x01,0x08,0x22,0x01,0x08,0xA2,0x0E,0x07,                       /* 0x03 symbol: capacitor */
+  0x0A,0xF0,0x01,0x08,0x02,0xE4,0x04,0x10,0x01,0x0A,0x0A,0x84,0x0A,0x0A,0x14,0x05,
+  0x22,0x06,0x0C,0x22,0x1E,0x0F,0x20,                                                /* 0x04 omega */
+  0x82,0x06,0x03,0x81,0x88,0x11,0x70,0x11,0x80,0x12,0x78,0x03,0x60,                  /* 0x05  (micro) */
+  0x42,0xFE,0x0F,0x22,0xF8,0x0F,0x41,0x01,0x31,0x01,0x52,0xF8,0x0F,0x22,0xFE,0x0F,
+  0x20,                                                                              /* 0x06 symbol: resistor left side */
+  0x42,0xFF,0x07,0x22,0xFF,0x01,0x51,0x08,0x31,0x08,0x42,0xFF,0x01,0x22,0xFF,0x07,
+  0x20,                                                                              /* 0x07 symbol: resistor right side */
+
+  0x02,0x98,0x01,0x23,0x98,0x01,0x60,0x11,0x90,0x11,0x60,0x12,0x08,0x01,0x23,0x94,
+  0x02,0xF0,0x32,0xFA,0x05,0x42,0x06,0x06,0x20,                                      /* 0x08  */
+  0x02,0x98,0x01,0x2A,0x98,0x01,0xF8,0x01,0x04,0x02,0xF2,0x04,0x08,0x01,0x88,0x08,
+  0x01,0xF2,0x04,0x04,0x02,0xF8,0x01,0x20,                                           /* 0x09  */
+  0x02,0x98,0x01,0x24,0x98,0x01,0x06,0x06,0xE8,0x08,0x01,0xF2,0x04,0x04,0x02,0xF8,
+  0x01,0x20,                                                                         /* 0x0a  */
+  0x81,0xF0,0x14,0x68,0x01,0x94,0x02,0x25,0xF0,0x02,0x70,0x02,0x80,0x31,0x80,0x14,
+  0x70,0x02,0xF0,0x01,0x20,                                                          /* 0x0b  */
+  0x42,0x98,0x01,0x2B,0x98,0x01,0xF8,0x03,0x04,0x04,0xFC,0x01,0xF8,0x01,0x04,0x12,
+  0xFA,0x01,0x23,0xF8,0x01,0x02,0x12,0xFC,0x07,0x20,                                 /* 0x0c  */
+  0x42,0x98,0x01,0x2A,0x98,0x01,0xF8,0x01,0x04,0x02,0xF2,0x04,0x08,0x01,0x48,0x08,
+  0x01,0xF2,0x04,0x04,0x02,0xF8,0x01,0x20,                                           /* 0x0d  */
+  0x42,0x98,0x01,0x24,0x98,0x01,0x06,0x06,0xA3,0x08,0x01,0xF2,0x14,0x04,0x01,0xF8,
+  0x06,0x20,                                                                         /* 0x0e  */
+  0x01,0x20,0x11,0x50,0x11,0xA8,0x11,0xA8,0x11,0x50,0x11,0x20,0xF0,0x60,             /* 0x0f  (degree) */
+
+  /* standard characters */
+  0xF0,0xF0,0x20,                                                                    /* 0x10 space */
+  0x01,0x60,0x31,0x90,0x91,0x90,0x51,0x60,0x31,0x60,0x31,0x60,0x30,                  /* 0x11 ! */
+  0x42,0x98,0x01,0x62,0x98,0x01,0xF0,0x30,                                           /* 0x12 " */
+  0x22,0x60,0x06,0x44,0x9C,0x09,0xCC,0x0C,0x22,0xA8,0x02,0x24,0x66,0x02,0x32,0x03,
+  0x41,0xCC,0x50,                                                                    /* 0x13 # */
+  0x01,0x60,0x36,0x98,0x01,0x04,0x02,0x90,0x03,0x25,0x90,0x01,0x04,0x02,0x98,0x31,
+  0x9C,0x14,0x04,0x02,0x98,0x01,0x21,0x60,0x30,                                      /* 0x14 $ */
+  0x53,0x08,0x1C,0x04,0x11,0x02,0x18,0x09,0x9C,0x04,0x40,0x02,0x20,0x01,0x90,0x11,
+  0x48,0x13,0x24,0x07,0x12,0x11,0x08,0x12,0x06,0x07,0x20,                            /* 0x15 % */
+  0x21,0xE0,0x13,0x50,0x01,0x28,0x33,0x40,0x01,0xA8,0x11,0x08,0x11,0x04,0x12,0xB0,
+  0x06,0x19,0x05,0x40,0x02,0x50,0x02,0xA4,0x05,0x78,0x06,0x20,                       /* 0x16 & */
+  0x01,0x70,0x51,0x10,0x31,0x50,0x11,0x30,0xF0,0x40,                                 /* 0x17  */
+  0x05,0xC0,0x01,0xA0,0x01,0x10,0x11,0x40,0x11,0x08,0xB1,0x08,0x11,0x40,0x11,0x10,
+  0x14,0xA0,0x01,0xC0,0x01,0x20,                                                     /* 0x18 ( */
+  0x01,0x38,0x11,0x58,0x11,0x80,0x11,0x20,0x21,0x01,0xB2,0x01,0x20,0x11,0x80,0x11,
+  0x58,0x11,0x38,0x30,                                                               /* 0x19 ) */
+  0x62,0x6C,0x03,0x2C,0x94,0x02,0x08,0x01,0x0C,0x03,0x0C,0x03,0x08,0x01,0x94,0x02,
+  0x22,0x6C,0x03,0x60,                                                               /* 0x1a * */
+  0x81,0x60,0x52,0x9C,0x03,0x22,0x9C,0x03,0x41,0x60,0x70,                            /* 0x1b + */
+  0xF0,0x71,0x70,0x51,0x10,0x11,0x50,0x10,                                           /* 0x1c , */
+  0xE2,0xFC,0x03,0x22,0xFC,0x03,0xC0,                                                /* 0x1d - */
+  0xF0,0x71,0x70,0x51,0x70,0x30,                                                     /* 0x1e . */
+  0x31,0x08,0x11,0x04,0x11,0x02,0x18,0x09,0x80,0x04,0x40,0x02,0x20,0x01,0x90,0x11,
+  0x48,0x11,0x24,0x11,0x12,0x11,0x08,0x11,0x06,0x50,                                 /* 0x1f / */
+  0x08,0xF0,0x01,0x0C,0x06,0xF0,0x01,0x0A,0x08,0x16,0x01,0x80,0x02,0x40,0x01,0xA0,
+  0x11,0x50,0x11,0x28,0x11,0x10,0x18,0x02,0x0A,0xF0,0x01,0x0C,0x06,0xF0,0x01,0x20,   /* 0x20 0 */
+  0x01,0xC0,0x11,0x20,0x11,0x18,0x31,0x38,0xF2,0x38,0x07,0x22,0xF8,0x07,0x20,        /* 0x21 1 */
+  0x08,0xF8,0x03,0x04,0x04,0xF2,0x09,0x08,0x02,0x1A,0x02,0x06,0x09,0x80,0x04,0x40,
+  0x02,0x20,0x01,0x90,0x11,0x48,0x11,0x24,0x12,0xE2,0x0F,0x22,0xFE,0x0F,0x20,        /* 0x22 2 */
+  0x09,0xF8,0x03,0x04,0x04,0xF2,0x09,0x08,0x02,0x06,0x23,0x02,0xF0,0x09,0x13,0x04,
+  0xF0,0x05,0x12,0x0A,0x06,0x18,0x08,0x02,0xF2,0x09,0x04,0x04,0xF8,0x03,0x20,        /* 0x23 3 */
+  0x03,0x80,0x03,0x40,0x11,0x20,0x11,0x90,0x11,0x48,0x11,0x24,0x11,0x12,0x11,0x08,
+  0x12,0xF8,0x0C,0x22,0xFE,0x0C,0x71,0x03,0x20,                                      /* 0x24 4 */
+  0x02,0xFE,0x0F,0x22,0xF8,0x0F,0x46,0xF8,0x03,0x02,0x04,0xFC,0x09,0x11,0x02,0x21,
+  0x06,0x18,0x08,0x02,0xF2,0x09,0x04,0x04,0xF8,0x03,0x20,                            /* 0x25 5 */
+  0x03,0xC0,0x03,0x20,0x13,0x90,0x03,0x48,0x11,0x24,0x11,0x10,0x12,0xF2,0x03,0x15,
+  0x04,0xF0,0x09,0x08,0x02,0x28,0x08,0x02,0xF2,0x09,0x04,0x04,0xF8,0x03,0x20,        /* 0x26 6 */
+  0x02,0xFE,0x0F,0x22,0xFE,0x09,0x31,0x05,0x22,0x80,0x02,0x22,0x40,0x01,0x21,0xA0,
+  0x31,0x50,0x31,0x30,0x30,                                                          /* 0x27 7 */
+  0x08,0xF0,0x01,0x08,0x02,0xE4,0x04,0x10,0x01,0x2A,0x10,0x01,0xE4,0x04,0x04,0x04,
+  0xF2,0x09,0x08,0x02,0x28,0x08,0x02,0xF2,0x09,0x04,0x04,0xF8,0x03,0x20,             /* 0x28 8 */
+  0x08,0xF8,0x03,0x04,0x04,0xF2,0x09,0x08,0x02,0x25,0x08,0x02,0xF2,0x01,0x04,0x12,
+  0xF8,0x09,0x18,0x01,0x80,0x04,0x40,0x02,0x38,0x01,0x80,0x11,0x78,0x30,             /* 0x29 9 */
+  0x81,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x50,                                      /* 0x2a : */
+  0x81,0x70,0x51,0x70,0x51,0x70,0x51,0x10,0x31,0x50,0x10,                            /* 0x2b ; */
+  0x12,0x03,0x80,0x15,0x40,0x02,0x20,0x01,0x90,0x11,0x48,0x11,0x24,0x31,0x24,0x11,
+  0x48,0x11,0x90,0x15,0x20,0x01,0x40,0x02,0x80,0x21,0x03,0x20,                       /* 0x2c < */
+  0xA2,0xFC,0x07,0x22,0xFC,0x07,0x22,0xFC,0x07,0x22,0xFC,0x07,0x80,                  /* 0x2d = */
+  0x01,0x0C,0x11,0x10,0x11,0x24,0x11,0x48,0x11,0x90,0x14,0x20,0x01,0x40,0x02,0x25,
+  0x40,0x02,0x20,0x01,0x90,0x11,0x48,0x11,0x24,0x11,0x10,0x11,0x0C,0x30,             /* 0x2e > */
+  0x08,0xF8,0x01,0x04,0x02,0xF2,0x04,0x08,0x01,0x18,0x01,0x86,0x04,0x40,0x02,0x20,
+  0x01,0x80,0x51,0x60,0x11,0x60,0x31,0x60,0x30,                                      /* 0x2f ? */
+  0x09,0xF8,0x03,0x04,0x04,0xF0,0x01,0xEA,0x0B,0x10,0x11,0x40,0x79,0x40,0x0A,0x10,
+  0x04,0xE8,0x03,0xF2,0x03,0x0C,0x12,0xF0,0x03,0x20,                                 /* 0x30 @ */
+  0x01,0x60,0x31,0x90,0x52,0x68,0x01,0x43,0x94,0x02,0xF0,0x32,0xFA,0x05,0x42,0x06,
+  0x06,0x20,                                                                         /* 0x31 A */
+  0x01,0xFE,0x24,0x01,0x78,0x02,0x80,0x31,0x80,0x12,0x78,0x02,0x13,0x02,0xF8,0x04,
+  0x11,0x01,0x33,0x01,0xF8,0x04,0x13,0x02,0xFE,0x01,0x20,                            /* 0x32 B */
+  0x0A,0xF0,0x01,0x08,0x02,0xE4,0x04,0x10,0x01,0x0A,0x06,0xAA,0x0A,0x06,0x10,0x01,
+  0xE4,0x04,0x08,0x02,0xF0,0x01,0x20,                                                /* 0x33 C */
+  0x01,0xFE,0x24,0x01,0x78,0x02,0x80,0x21,0x05,0xB2,0x05,0x80,0x12,0x78,0x02,0x12,
+  0x01,0xFE,0x30,                                                                    /* 0x34 D */
+  0x02,0xFE,0x07,0x22,0xF8,0x07,0x62,0xF8,0x01,0x22,0xF8,0x01,0x62,0xF8,0x07,0x22,
+  0xFE,0x07,0x20,                                                                    /* 0x35 E */
+  0x02,0xFE,0x07,0x22,0xF8,0x07,0x62,0xF8,0x01,0x22,0xF8,0x01,0xA1,0x06,0x30,        /* 0x36 F */
+  0x09,0xF0,0x03,0x08,0x04,0xE4,0x01,0x10,0x06,0x0A,0x32,0xC0,0x07,0x22,0xC0,0x01,
+  0x21,0x0A,0x11,0x10,0x13,0xE4,0x01,0x08,0x12,0xF0,0x07,0x20,                       /* 0x37 G */
+  0x02,0x06,0x06,0xA2,0xF8,0x01,0x22,0xF8,0x01,0xA2,0x06,0x06,0x20,                  /* 0x38 H */
+  0x02,0xF8,0x01,0x22,0x98,0x01,0xF0,0x32,0x98,0x01,0x22,0xF8,0x01,0x20,             /* 0x39 I */
+  0x11,0x06,0xF0,0x11,0x06,0x33,0x08,0x05,0xF2,0x14,0x04,0x02,0xF8,0x01,0x20,        /* 0x3a J */
+  0x02,0x06,0x06,0x18,0x01,0x80,0x04,0x40,0x02,0x20,0x01,0x90,0x11,0x48,0x31,0x48,
+  0x11,0x90,0x16,0x20,0x01,0x40,0x02,0x80,0x04,0x13,0x01,0x06,0x06,0x20,             /* 0x3b K */
+  0x01,0x06,0xF0,0x82,0xF8,0x07,0x22,0xFE,0x07,0x20,                                 /* 0x3c L */
+  0x04,0x06,0x06,0x08,0x01,0x21,0x90,0x32,0x68,0x01,0x21,0x90,0x31,0x60,0x92,0x06,
+  0x06,0x20,                                                                         /* 0x3d M */
+  0x03,0x06,0x06,0x08,0x31,0x10,0x11,0x28,0x31,0x50,0x31,0xA0,0x33,0x40,0x01,0x80,
+  0x43,0x01,0x06,0x06,0x20,                                                          /* 0x3e N */
+  0x01,0xF0,0x15,0x08,0x01,0x64,0x02,0x90,0x12,0x0A,0x05,0xA3,0x0A,0x05,0x90,0x15,
+  0x64,0x02,0x08,0x01,0xF0,0x30,                                                     /* 0x3f O */
+  0x02,0xFE,0x01,0x13,0x02,0xF8,0x04,0x11,0x01,0x53,0x01,0xF8,0x04,0x13,0x02,0xF8,
+  0x01,0x81,0x06,0x30,                                                               /* 0x40 P */
+  0x01,0xF0,0x15,0x08,0x01,0x64,0x02,0x90,0x12,0x0A,0x05,0x81,0xC0,0x13,0x0A,0x05,
+  0x50,0x16,0x64,0x04,0x08,0x01,0xF0,0x06,0x20,                                      /* 0x41 Q */
+  0x02,0xFE,0x01,0x13,0x02,0xF8,0x04,0x11,0x01,0x53,0x01,0xF8,0x04,0x19,0x02,0x18,
+  0x01,0x20,0x01,0x40,0x02,0x80,0x04,0x13,0x01,0x06,0x06,0x20,                       /* 0x42 R */
+  0x08,0xF8,0x01,0x04,0x02,0xF2,0x04,0x08,0x01,0x12,0x06,0x08,0x16,0xF2,0x01,0x04,
+  0x02,0xF8,0x04,0x12,0x01,0x06,0x18,0x08,0x01,0xF2,0x04,0x04,0x02,0xF8,0x01,0x20,   /* 0x43 S */
+  0x02,0xFC,0x03,0x22,0x9C,0x03,0xF0,0x71,0x60,0x30,                                 /* 0x44 T */
+  0x02,0x06,0x06,0xF0,0x53,0x0A,0x05,0xF0,0x14,0x04,0x02,0xF8,0x01,0x20,             /* 0x45 U */
+  0x02,0x06,0x06,0x42,0x0A,0x05,0x42,0x94,0x02,0x42,0x68,0x01,0x41,0x90,0x31,0x60,
+  0x30,                                                                              /* 0x46 V */
+  0x02,0x06,0x06,0xC1,0x60,0x31,0x90,0x13,0x68,0x01,0x90,0x34,0x08,0x01,0x06,0x06,
+  0x20,                                                                              /* 0x47 W */
+  0x02,0x06,0x06,0x22,0x0A,0x05,0x25,0x94,0x02,0x68,0x01,0x90,0x31,0x90,0x14,0x68,
+  0x01,0x94,0x02,0x22,0x0A,0x05,0x22,0x06,0x06,0x20,                                 /* 0x48 X */
+  0x02,0x06,0x06,0x22,0x0A,0x05,0x22,0x94,0x02,0x22,0x68,0x01,0x21,0x90,0xB1,0x60,
+  0x30,                                                                              /* 0x49 Y */
+  0x02,0xFE,0x07,0x22,0xFE,0x04,0x25,0x80,0x02,0x40,0x01,0xA0,0x31,0x50,0x11,0x28,
+  0x11,0x14,0x32,0xF2,0x07,0x22,0xFE,0x07,0x20,                                      /* 0x4a Z */
+  0x02,0xF8,0x01,0x22,0xE0,0x01,0xF0,0x32,0xE0,0x01,0x22,0xF8,0x01,0x20,             /* 0x4b [ */
+  0x21,0x02,0x11,0x04,0x11,0x08,0x11,0x12,0x11,0x24,0x11,0x48,0x11,0x90,0x16,0x20,
+  0x01,0x40,0x02,0x80,0x04,0x11,0x09,0x11,0x02,0x11,0x0C,0x40,                       /* 0x4c \ */
+  0x02,0xF8,0x01,0x21,0x78,0xF0,0x41,0x78,0x32,0xF8,0x01,0x20,                       /* 0x4d ] */
+  0x01,0x40,0x11,0xA0,0x1C,0x10,0x01,0x48,0x02,0xA4,0x04,0x12,0x09,0x08,0x02,0x06,
+  0x0C,0xF0,0x10,                                                                    /* 0x4e ^ */
+  0xF0,0xD2,0xFE,0x0F,0x20,                                                          /* 0x4f _ */
+  0x21,0xE0,0x51,0x80,0x31,0xA0,0x11,0xC0,0xF0,0x20,                                 /* 0x50 ` */
+  0xA9,0xF8,0x03,0x04,0x04,0xFC,0x01,0xF8,0x01,0x04,0x12,0xFA,0x01,0x23,0xF8,0x01,
+  0x02,0x12,0xFC,0x07,0x20,                                                          /* 0x51 a */
+  0x01,0x06,0x98,0xF0,0x01,0x08,0x02,0xF0,0x04,0x08,0x01,0x53,0x01,0xF8,0x04,0x13,
+  0x02,0xFE,0x01,0x20,                                                               /* 0x52 b */
+  0xA8,0xF8,0x01,0x04,0x02,0xF2,0x05,0x08,0x06,0x48,0x08,0x06,0xF2,0x05,0x04,0x02,
+  0xF8,0x01,0x20,                                                                    /* 0x53 c */
+  0x11,0x06,0x81,0xF8,0x13,0x04,0x01,0x72,0x12,0x88,0x01,0x41,0x08,0x13,0xF2,0x01,
+  0x04,0x12,0xF8,0x07,0x20,                                                          /* 0x54 d */
+  0xA8,0xF8,0x01,0x04,0x02,0xF2,0x05,0xF0,0x01,0x14,0x04,0xF8,0x03,0x08,0x16,0xF2,
+  0x03,0x04,0x02,0xF8,0x01,0x20,                                                     /* 0x55 e */
+  0x03,0xE0,0x01,0x10,0x13,0xC8,0x01,0x20,0x51,0xE6,0x31,0xE6,0xB1,0x18,0x30,        /* 0x56 f */
+  0xA3,0xF8,0x07,0x04,0x13,0xF2,0x01,0x08,0x13,0x08,0x01,0xF2,0x13,0x04,0x01,0xF8,
+  0x23,0x01,0xFC,0x04,0x11,0x02,                                                     /* 0x57 g */
+  0x01,0x06,0x91,0xF0,0x15,0x08,0x01,0x70,0x02,0x88,0xB2,0x06,0x03,0x20,             /* 0x58 h */
+  0x41,0x60,0x31,0x60,0x11,0x70,0x31,0x10,0x92,0x98,0x01,0x22,0xF8,0x01,0x20,        /* 0x59 i */
+  0x42,0x80,0x01,0x24,0x80,0x01,0xC0,0x01,0x21,0x40,0xB1,0x18,0x11,0x60,0x12,0x08,
+  0x01,                                                                              /* 0x5a j */
+  0x01,0x0C,0x93,0x80,0x01,0x40,0x13,0x20,0x01,0x90,0x31,0x90,0x15,0x20,0x01,0x40,
+  0x02,0x80,0x12,0x0C,0x03,0x20,                                                     /* 0x5b k */
+  0x01,0x70,0x31,0x10,0xF0,0x42,0x98,0x01,0x22,0xF8,0x01,0x20,                       /* 0x5c l */
+  0xA4,0x9A,0x01,0x64,0x02,0x13,0x04,0x98,0x01,0xA2,0x66,0x06,0x20,                  /* 0x5d m */
+  0xA2,0xFC,0x01,0x13,0x02,0xF0,0x04,0x11,0x01,0xA2,0x0C,0x06,0x20,                  /* 0x5e n */
+  0xA8,0xF8,0x01,0x04,0x02,0xF2,0x04,0x08,0x01,0x48,0x08,0x01,0xF2,0x04,0x04,0x02,
+  0xF8,0x01,0x20,                                                                    /* 0x5f o */
+  0xA2,0xFE,0x01,0x13,0x02,0xF8,0x04,0x11,0x01,0x28,0x08,0x01,0xF0,0x04,0x08,0x02,
+  0xF0,0x01,0x40,                                                                    /* 0x60 p */
+  0xA3,0xF8,0x07,0x04,0x13,0xF2,0x01,0x08,0x33,0x08,0x01,0xF2,0x13,0x04,0x01,0xF8,
+  0x50,                                                                              /* 0x61 q */
+  0xA8,0xEC,0x03,0x10,0x04,0xE0,0x01,0x10,0x06,0xA1,0x0C,0x30,                       /* 0x62 r */
+  0xA1,0xFC,0x15,0x02,0x01,0xF8,0x01,0xF8,0x13,0x02,0x01,0x7C,0x31,0x7E,0x13,0x02,
+  0x01,0xFC,0x30,                                                                    /* 0x63 s */
+  0x21,0x18,0x71,0xE6,0x31,0xE6,0x93,0xE0,0x01,0x08,0x12,0xF0,0x01,0x20,             /* 0x64 t */
+  0xA2,0x06,0x06,0xA3,0x08,0x01,0xF2,0x14,0x04,0x01,0xF8,0x06,0x20,                  /* 0x65 u */
+  0xA2,0x06,0x06,0x22,0x0A,0x05,0x22,0x94,0x02,0x22,0x68,0x01,0x21,0x90,0x11,0x60,
+  0x30,                                                                              /* 0x66 v */
+  0xA2,0x66,0x06,0x81,0x90,0x13,0x0A,0x05,0x60,0x14,0x94,0x02,0x08,0x01,0x20,        /* 0x67 w */
+  0xA3,0x06,0x03,0x88,0x15,0x52,0x02,0x24,0x01,0x88,0x11,0x88,0x15,0x24,0x01,0x52,
+  0x02,0x88,0x12,0x06,0x03,0x20,                                                     /* 0x68 x */
+  0xA2,0x0C,0x03,0x22,0x94,0x02,0x22,0x68,0x01,0x21,0x90,0x31,0x50,0x31,0x28,0x10,   /* 0x69 y */
+  0xA2,0xFE,0x03,0x14,0x02,0x3E,0x01,0xA0,0x11,0x50,0x11,0x28,0x11,0x14,0x12,0xF2,
+  0x03,0x22,0xFE,0x03,0x20,                                                          /* 0x6a z */
+  0x03,0xC0,0x03,0x20,0x13,0x90,0x03,0x40,0x51,0x08,0x11,0x24,0x11,0x24,0x11,0x08,
+  0x51,0x40,0x13,0x90,0x03,0x20,0x12,0xC0,0x03,                                      /* 0x6b { */
+  0x01,0x60,0xB1,0x60,0x11,0x60,0xD1,0x60,0x30,                                      /* 0x6c | */
+  0x01,0x3C,0x11,0x40,0x11,0x9C,0x11,0x20,0x65,0x01,0x40,0x02,0x40,0x02,0x11,0x01,
+  0x41,0x20,0x11,0x9C,0x11,0x40,0x11,0x3C,0x10,                                      /* 0x6d } */
+  0x48,0x38,0x06,0x54,0x05,0xAA,0x02,0xC6,0x01,0xF0,0x50                             /* 0x6e ~ */
+  #ifdef FONT_EXTRA
+  ,
+
+  /* extra characters */
+  0x03,0x3F,0x0F,0x20,0x11,0x18,0x31,0x38,0xF2,0x38,0x07,0x22,0xF8,0x07,0x20,        /* 0x6f 1 (reversed color) */
+  0x08,0x07,0x0C,0x04,0x04,0xF2,0x09,0x08,0x02,0x1A,0x02,0x06,0x09,0x80,0x04,0x40,
+  0x02,0x20,0x01,0x90,0x11,0x48,0x11,0x24,0x12,0xE2,0x0F,0x22,0xFE,0x0F,0x20,        /* 0x70 2 (reversed color) */
+  0x09,0x07,0x0C,0x04,0x04,0xF2,0x09,0x08,0x02,0x06,0x23,0x02,0xF0,0x09,0x13,0x04,
+  0xF0,0x05,0x12,0x0A,0x06,0x18,0x08,0x02,0xF2,0x09,0x04,0x04,0xF8,0x03,0x20,        /* 0x71 3 (reversed color) */
+  0x02,0xFF,0x0F,0x69,0x04,0x02,0x08,0x01,0x94,0x02,0x68,0x01,0x90,0x11,0x90,0x18,
+  0x68,0x01,0x94,0x02,0x08,0x01,0x04,0x02,0x40,                                      /* 0x72 x (reversed color) */
+  0x42,0xFF,0x0F,0x22,0xFC,0x0F,0xE2,0xFC,0x0F,0x22,0xFF,0x0F,0x20,                  /* 0x73 symbol: battery left side, low */
+  0x42,0xFF,0x0F,0x24,0xFC,0x0F,0xF8,0x07,0xA4,0xF8,0x07,0xFC,0x0F,0x22,0xFF,0x0F,
+  0x20,                                                                              /* 0x74 symbol: battery left side, high */
+  0x42,0xFF,0x03,0x22,0xFF,0x01,0x11,0x0C,0x11,0x02,0x71,0x02,0x13,0x0C,0xFF,0x01,
+  0x22,0xFF,0x03,0x20,                                                               /* 0x75 symbol: battery right side, low */
+  0x42,0xFF,0x03,0x24,0xFF,0x01,0xFF,0x0C,0x11,0x02,0x75,0x02,0xFF,0x0C,0xFF,0x01,
+  0x22,0xFF,0x03,0x20                                                                /* 0x76 symbol: battery right side, high */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed characters in FontData[]
+ */
+
+const uint16_t FontIndex[] PROGMEM = {
+  0,        /* 0x00 n/a */
+  3,        /* 0x01 symbol: diode A-C */
+  33,       /* 0x02 symbol: diode C-A */
+  62,       /* 0x03 symbol: capacitor */
+  74,       /* 0x04 omega */
+  97,       /* 0x05  (micro) */
+  110,      /* 0x06 symbol: resistor left side */
+  127,      /* 0x07 symbol: resistor right side */
+  144,      /* 0x08  */
+  169,      /* 0x09  */
+  193,      /* 0x0a  */
+  211,      /* 0x0b  */
+  232,      /* 0x0c  */
+  258,      /* 0x0d  */
+  282,      /* 0x0e  */
+  300,      /* 0x0f  (degree) */
+  314,      /* 0x10 space */
+  317,      /* 0x11 ! */
+  330,      /* 0x12 " */
+  338,      /* 0x13 # */
+  357,      /* 0x14 $ */
+  382,      /* 0x15 % */
+  409,      /* 0x16 & */
+  437,      /* 0x17  */
+  447,      /* 0x18 ( */
+  469,      /* 0x19 ) */
+  489,      /* 0x1a * */
+  509,      /* 0x1b + */
+  520,      /* 0x1c , */
+  528,      /* 0x1d - */
+  535,      /* 0x1e . */
+  541,      /* 0x1f / */
+  567,      /* 0x20 0 */
+  599,      /* 0x21 1 */
+  614,      /* 0x22 2 */
+  645,      /* 0x23 3 */
+  676,      /* 0x24 4 */
+  701,      /* 0x25 5 */
+  728,      /* 0x26 6 */
+  759,      /* 0x27 7 */
+  780,      /* 0x28 8 */
+  810,      /* 0x29 9 */
+  840,      /* 0x2a : */
+  849,      /* 0x2b ; */
+  860,      /* 0x2c < */
+  888,      /* 0x2d = */
+  901,      /* 0x2e > */
+  931,      /* 0x2f ? */
+  956,      /* 0x30 @ */
+  982,      /* 0x31 A */
+  1000,     /* 0x32 B */
+  1027,     /* 0x33 C */
+  1050,     /* 0x34 D */
+  1069,     /* 0x35 E */
+  1088,     /* 0x36 F */
+  1103,     /* 0x37 G */
+  1131,     /* 0x38 H */
+  1144,     /* 0x39 I */
+  1158,     /* 0x3a J */
+  1173,     /* 0x3b K */
+  1203,     /* 0x3c L */
+  1213,     /* 0x3d M */
+  1231,     /* 0x3e N */
+  1252,     /* 0x3f O */
+  1274,     /* 0x40 P */
+  1294,     /* 0x41 Q */
+  1319,     /* 0x42 R */
+  1347,     /* 0x43 S */
+  1379,     /* 0x44 T */
+  1389,     /* 0x45 U */
+  1403,     /* 0x46 V */
+  1420,     /* 0x47 W */
+  1437,     /* 0x48 X */
+  1463,     /* 0x49 Y */
+  1480,     /* 0x4a Z */
+  1505,     /* 0x4b [ */
+  1519,     /* 0x4c \ */
+  1547,     /* 0x4d ] */
+  1559,     /* 0x4e ^ */
+  1578,     /* 0x4f _ */
+  1583,     /* 0x50 ` */
+  1593,     /* 0x51 a */
+  1614,     /* 0x52 b */
+  1634,     /* 0x53 c */
+  1653,     /* 0x54 d */
+  1674,     /* 0x55 e */
+  1696,     /* 0x56 f */
+  1711,     /* 0x57 g */
+  1733,     /* 0x58 h */
+  1747,     /* 0x59 i */
+  1762,     /* 0x5a j */
+  1779,     /* 0x5b k */
+  1801,     /* 0x5c l */
+  1813,     /* 0x5d m */
+  1826,     /* 0x5e n */
+  1839,     /* 0x5f o */
+  1858,     /* 0x60 p */
+  1877,     /* 0x61 q */
+  1894,     /* 0x62 r */
+  1906,     /* 0x63 s */
+  1925,     /* 0x64 t */
+  1939,     /* 0x65 u */
+  1952,     /* 0x66 v */
+  1969,     /* 0x67 w */
+  1984,     /* 0x68 x */
+  2006,     /* 0x69 y */
+  2022,     /* 0x6a z */
+  2043,     /* 0x6b { */
+  2068,     /* 0x6c | */
+  2077,     /* 0x6d } */
+  2102      /* 0x6e ~ */
+  #ifdef FONT_EXTRA
+  ,
+  2113,     /* 0x6f 1 (reversed color) */
+  2128,     /* 0x70 2 (reversed color) */
+  2159,     /* 0x71 3 (reversed color) */
+  2190,     /* 0x72 x (reversed color) */
+  2215,     /* 0x73 symbol: battery left side, low */
+  2228,     /* 0x74 symbol: battery left side, high */
+  2245,     /* 0x75 symbol: battery right side, low */
+  2265      /* 0x76 symbol: battery right side, high */
+  #endif
+};
+
+#else
+
 /*
  *  character bitmaps
  *  - to reduce size we place some symbols and special characters at
@@ -292,6 +641,8 @@ const uint8_t FontData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 /*
  *  font lookup table for ISO 8859-1
@@ -29,6 +29,386 @@
 #define FONT_BYTES_Y        26     /* 26 bytes in y direction */
 
 
+#ifdef FONT_RLE
+
+/*
+ *  compressed character bitmaps (FONT_RLE)
+ *  - same bitmaps as below, each character compressed separately
+ *  - same format as compressed symbols (see symbols_<size>_h.h)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t FontData[] PROGMEM = {
+  /* symbols and special characters */
+  0xF0,0xF0,0xF0,0x70,                                                               /* 0x00 n/a */
+  0x63,0x04,0x70,0x08,0x11,0x10,0x11,0x20,0x11,0x40,0x11,0x80,0x21,0x01,0x11,0x02,
+  0x13,0x04,0x03,0x88,0x22,0x03,0x88,0x11,0x04,0x11,0x02,0x12,0x01,0x80,0x11,0x40,
+  0x11,0x20,0x11,0x10,0x11,0x08,0x12,0x04,0x70,0x40,                                 /* 0x01 symbol: diode A-C */
+  0x62,0x0E,0x20,0x11,0x10,0x11,0x08,0x11,0x04,0x11,0x02,0x12,0x01,0x80,0x11,0x40,
+  0x11,0x20,0x12,0x11,0xC0,0x23,0x11,0xC0,0x20,0x11,0x40,0x11,0x80,0x21,0x01,0x11,
+  0x02,0x11,0x04,0x11,0x08,0x13,0x10,0x0E,0x20,0x40,                                 /* 0x02 symbol: diode C-A */
+  0x62,0x3C,0x3C,0xF0,0x12,0x03,0xC0,0x22,0x03,0xC0,0xF0,0x12,0x3C,0x3C,0x40,        /* 0x03 symbol: capacitor */
+  0x6A,0xC0,0x07,0x20,0x08,0xD0,0x17,0x28,0x28,0x14,0x50,0x22,0x0A,0xA0,0x62,0x0A,
+  0xA0,0x2A,0x14,0x50,0x28,0x28,0x50,0x14,0x02,0x80,0x1C,0x70,0x22,0x7E,0xFC,0x80,   /* 0x04 omega */
+  0xE2,0x1C,0x38,0xF0,0x3A,0x20,0x04,0x40,0x02,0x80,0x05,0x20,0x40,0xC0,0x7B,0x80,   /* 0x05  (micro) */
+  0xA2,0xFE,0xFF,0x22,0xF8,0xFF,0x81,0x01,0x31,0x01,0x92,0xF8,0xFF,0x22,0xFE,0xFF,
+  0x80,                                                                              /* 0x06 symbol: resistor left side */
+  0xA2,0xFF,0x7F,0x22,0xFF,0x1F,0x91,0x80,0x31,0x80,0x82,0xFF,0x1F,0x22,0xFF,0x7F,
+  0x80,                                                                              /* 0x07 symbol: resistor right side */
+
+  0x02,0x30,0x0C,0x22,0x30,0x0C,0x42,0xC0,0x01,0x12,0x02,0x20,0x12,0x80,0x04,0x25,
+  0x10,0x01,0x40,0x08,0x08,0x22,0x12,0x20,0x12,0xE4,0x23,0x22,0xF2,0x07,0x11,0x48,
+  0x24,0x09,0x90,0x07,0xE0,0x80,                                                     /* 0x08  */
+  0x02,0x30,0x0C,0x22,0x30,0x0C,0x48,0xE0,0x07,0x10,0x08,0xC8,0x13,0x24,0x24,0x22,
+  0x12,0x48,0xA2,0x12,0x48,0x28,0x24,0x24,0xC8,0x13,0x10,0x08,0xE0,0x07,0x80,        /* 0x09  */
+  0x02,0x60,0x18,0x22,0x60,0x18,0x42,0x1C,0x70,0xF0,0x7A,0x20,0x08,0x04,0x40,0xC8,
+  0x27,0x10,0x10,0xE0,0x0F,0x80,                                                     /* 0x0a  */
+  0x27,0xF0,0x03,0x08,0x04,0xC4,0x09,0x20,0x41,0x08,0x13,0x01,0x80,0x04,0x53,0x04,
+  0x80,0x08,0x11,0x11,0x11,0x22,0x11,0x44,0x11,0x08,0x21,0x80,0x25,0x4F,0x80,0x20,
+  0x1C,0x1F,0x80,                                                                    /* 0x0b  */
+  0x62,0x60,0x0C,0x22,0x60,0x0C,0x28,0xE0,0x07,0x18,0x08,0xE0,0x11,0x18,0x02,0x23,
+  0xE0,0x03,0x10,0x13,0xC8,0x03,0x24,0x58,0x20,0x02,0xC4,0x65,0x08,0x03,0xF0,0x78,
+  0x80,                                                                              /* 0x0c  */
+  0x62,0x30,0x06,0x22,0x30,0x06,0x2A,0xE0,0x03,0x18,0x0C,0xC4,0x11,0x20,0x02,0x12,
+  0x24,0xAA,0x12,0x24,0x20,0x02,0xC4,0x11,0x18,0x0C,0xE0,0x03,0x80,                  /* 0x0d  */
+  0x62,0x30,0x06,0x22,0x30,0x06,0x22,0x1C,0x38,0xF0,0x49,0x04,0x20,0x02,0xC4,0x05,
+  0x08,0x03,0xF0,0x38,0x80,                                                          /* 0x0e  */
+  0x46,0x80,0x03,0x40,0x04,0xA0,0x0B,0x46,0xA0,0x0B,0x40,0x04,0x80,0x03,0xF0,0xF0,
+  0x20,                                                                              /* 0x0f  (degree) */
+
+  /* standard characters */
+  0xF0,0xF0,0xF0,0x70,                                                               /* 0x10 space */
+  0x42,0x80,0x03,0xF0,0xB2,0x80,0x03,0x22,0x80,0x03,0x42,0x80,0x03,0x80,             /* 0x11 ! */
+  0x22,0x38,0x0E,0x82,0x28,0x0A,0x22,0x10,0x04,0xF0,0xF0,0x40,                       /* 0x12 " */
+  0x42,0x80,0x31,0x22,0x40,0x29,0x62,0x3C,0x67,0x22,0x9C,0x73,0x12,0x0A,0x50,0x12,
+  0xCE,0x39,0x22,0xE6,0x3C,0x62,0x94,0x02,0x22,0x8C,0x01,0x80,                       /* 0x13 # */
+  0x11,0x03,0x28,0xC0,0x1C,0x30,0x20,0x80,0x1C,0x48,0x20,0x41,0x40,0x11,0x88,0x11,
+  0x10,0x14,0x60,0x04,0x80,0x18,0x31,0x24,0x68,0x18,0x20,0xE0,0x04,0x18,0x10,0xE0,
+  0x0C,0x31,0x03,0x40,                                                               /* 0x14 $ */
+  0x46,0x3C,0xC0,0x5A,0xA0,0xA5,0x50,0x11,0x28,0x31,0x14,0x14,0x0A,0xA5,0x05,0x5A,
+  0x14,0xBC,0x02,0x40,0x3D,0x14,0x5A,0xA0,0xA5,0x50,0x11,0x28,0x31,0x14,0x16,0x0A,
+  0xA5,0x05,0x5A,0x03,0x3C,0x80,                                                     /* 0x15 % */
+  0x46,0xE0,0x03,0x10,0x04,0xC8,0x09,0x5F,0x08,0x48,0x01,0x80,0x06,0x08,0x01,0x04,
+  0xE0,0x32,0x01,0x09,0x02,0x40,0x80,0x02,0x80,0x04,0x1B,0x19,0x08,0x40,0x11,0x02,
+  0xE2,0x43,0x0C,0x8C,0xF0,0xF3,0x80,                                                /* 0x16 & */
+  0x22,0xC0,0x01,0x82,0x40,0x01,0x21,0x80,0xF0,0xF0,0x50,                            /* 0x17  */
+  0x31,0x18,0x11,0x06,0x17,0x11,0x80,0x0C,0x40,0x02,0x20,0x01,0x41,0x90,0xF1,0x90,
+  0x56,0x20,0x01,0x40,0x02,0x80,0x0C,0x11,0x11,0x11,0x06,0x11,0x18,                  /* 0x18 ( */
+  0x21,0x0C,0x11,0x30,0x11,0x44,0x11,0x98,0x14,0x20,0x01,0x40,0x02,0x42,0x80,0x04,
+  0xE2,0x80,0x04,0x45,0x40,0x02,0x20,0x01,0x98,0x11,0x44,0x11,0x30,0x11,0x0C,0x10,   /* 0x19 ) */
+  0x42,0x80,0x03,0x4F,0x18,0x18,0xE4,0x25,0x4C,0x32,0x70,0x0E,0xA0,0x05,0x90,0x09,
+  0x48,0x12,0x18,0x03,0x18,0x20,0x04,0xF0,0x90,                                      /* 0x1a * */
+  0xE2,0x80,0x01,0xA2,0x7E,0x7E,0x22,0x7E,0x7E,0xA2,0x80,0x01,0x80,                  /* 0x1b + */
+  0xF0,0xF0,0x42,0xC0,0x03,0x61,0xC0,0x11,0x80,0x24,0x02,0x40,0x01,0xC0,0x10,        /* 0x1c , */
+  0xF0,0x92,0xF8,0x1F,0x22,0xF8,0x1F,0xF0,0x70,                                      /* 0x1d - */
+  0xF0,0xF0,0x42,0xC0,0x03,0x62,0xC0,0x03,0x80,                                      /* 0x1e . */
+  0x31,0x60,0x11,0x50,0x31,0x28,0x31,0x14,0x31,0x0A,0x31,0x05,0x22,0x80,0x02,0x22,
+  0x40,0x01,0x21,0xA0,0x31,0x50,0x31,0x28,0x31,0x14,0x31,0x0A,0x11,0x06,0x10,        /* 0x1f / */
+  0x48,0xE0,0x03,0x10,0x04,0xC8,0x09,0x24,0x12,0x22,0x12,0x24,0xF0,0x12,0x12,0x24,
+  0x28,0x24,0x12,0xC8,0x09,0x10,0x04,0xE0,0x03,0x80,                                 /* 0x20 0 */
+  0x52,0x03,0xE0,0x11,0x1C,0x11,0x70,0x11,0x0C,0xF0,0xA2,0x7C,0x7C,0x22,0xFC,0x7F,
+  0x80,                                                                              /* 0x21 1 */
+  0x48,0xF0,0x03,0x0C,0x04,0xF0,0x09,0x0C,0x12,0x71,0x12,0x38,0x09,0x80,0x04,0x40,
+  0x02,0x20,0x01,0x90,0x11,0x40,0x11,0x08,0x11,0x24,0x12,0xE0,0x1F,0x22,0xFC,0x1F,
+  0x80,                                                                              /* 0x22 2 */
+  0x48,0xF0,0x03,0x08,0x0C,0xF0,0x11,0x08,0x02,0x51,0x10,0x13,0x0A,0xE0,0x05,0x13,
+  0x04,0xE0,0x08,0x11,0x11,0x11,0x02,0x55,0x02,0x08,0x11,0xF0,0x08,0x13,0x04,0xF8,
+  0x03,0x80,                                                                         /* 0x23 3 */
+  0x51,0x0E,0x12,0x01,0x80,0x33,0x40,0x01,0x20,0x11,0x80,0x11,0x50,0x11,0x28,0x31,
+  0x14,0x11,0x0A,0x12,0xF8,0x71,0x22,0xFE,0x71,0x91,0x0E,0x80,                       /* 0x24 4 */
+  0x42,0xF0,0x3F,0x42,0xC0,0x3F,0x82,0xC0,0x03,0x13,0x0C,0xF0,0x11,0x11,0x22,0x11,
+  0x04,0x55,0x04,0x10,0x22,0xE0,0x11,0x13,0x0C,0xF0,0x03,0x80,                       /* 0x25 5 */
+  0x49,0x80,0x1F,0x60,0x20,0x10,0x1F,0x80,0x20,0x48,0x31,0x24,0x1A,0x80,0x0F,0x40,
+  0x10,0xA0,0x23,0x40,0x44,0x20,0x08,0x41,0x24,0x22,0x48,0x48,0x16,0x80,0x27,0x30,
+  0x18,0xC0,0x07,0x80,                                                               /* 0x26 6 */
+  0x42,0xF8,0x3F,0x42,0xF8,0x27,0x31,0x14,0x31,0x0A,0x11,0x04,0x13,0x01,0x80,0x02,
+  0x22,0x40,0x01,0x21,0xA0,0x31,0x10,0x11,0x40,0x31,0x30,0x90,                       /* 0x27 7 */
+  0x48,0xC0,0x07,0x30,0x08,0x88,0x11,0x40,0x02,0x4E,0x40,0x10,0x88,0x03,0x10,0x0C,
+  0x10,0x0C,0xC8,0x10,0x20,0x01,0x04,0x22,0x11,0x04,0x48,0x24,0x24,0xC8,0x13,0x10,
+  0x08,0xE0,0x07,0x80,                                                               /* 0x28 8 */
+  0x46,0xC0,0x07,0x30,0x18,0xC8,0x03,0x12,0x24,0x24,0x21,0x48,0x4A,0x20,0x08,0x44,
+  0x04,0x88,0x0B,0x10,0x04,0xE0,0x03,0x11,0x48,0x39,0x24,0x08,0x02,0xF0,0x11,0x08,
+  0x0C,0xF0,0x03,0x80,                                                               /* 0x29 9 */
+  0xE2,0xC0,0x03,0x62,0xC0,0x03,0xA2,0xC0,0x03,0x62,0xC0,0x03,0x80,                  /* 0x2a : */
+  0xE2,0xC0,0x03,0x62,0xC0,0x03,0xA2,0xC0,0x03,0x61,0xC0,0x11,0x80,0x24,0x02,0x40,
+  0x01,0xC0,0x10,                                                                    /* 0x2b ; */
+  0xF1,0x40,0x11,0x30,0x11,0x4C,0x16,0x33,0xC0,0x0C,0x30,0x03,0xCC,0x31,0xCC,0x14,
+  0x30,0x03,0xC0,0x0C,0x11,0x33,0x11,0x4C,0x11,0x30,0x11,0x40,0x80,                  /* 0x2c < */
+  0xF0,0x52,0xFE,0x7F,0x22,0xFE,0x7F,0x42,0xFE,0x7F,0x22,0xFE,0x7F,0xF0,0x10,        /* 0x2d = */
+  0xE1,0x02,0x11,0x0C,0x11,0x32,0x11,0xCC,0x14,0x30,0x03,0xC0,0x0C,0x11,0x33,0x36,
+  0x33,0xC0,0x0C,0x30,0x03,0xCC,0x11,0x32,0x11,0x0C,0x11,0x02,0x90,                  /* 0x2e > */
+  0x46,0xF8,0x07,0x04,0x18,0xF0,0x23,0x12,0x04,0x0C,0x41,0x24,0x11,0x02,0x13,0x11,
+  0x80,0x08,0x13,0x04,0x40,0x02,0x42,0xC0,0x01,0x22,0xC0,0x01,0x42,0xC0,0x01,0x80,   /* 0x2f ? */
+  0x4D,0xC0,0x0F,0x20,0x10,0x90,0x27,0x68,0x08,0x04,0x0E,0x10,0x0F,0x82,0x12,0x48,
+  0x01,0x31,0x08,0x31,0x04,0x1F,0x08,0x48,0xC3,0x02,0x04,0x90,0xF3,0x24,0x08,0xC8,
+  0x07,0x30,0x08,0xC0,0x07,0x80,                                                     /* 0x30 @ */
+  0xA2,0xC0,0x01,0x12,0x02,0x20,0x12,0x80,0x04,0x25,0x10,0x01,0x40,0x08,0x08,0x22,
+  0x12,0x20,0x12,0xE4,0x23,0x22,0xF2,0x07,0x11,0x48,0x24,0x09,0x90,0x07,0xE0,0x80,   /* 0x31 A */
+  0xA2,0xFC,0x07,0x13,0x08,0xE0,0x11,0x11,0x02,0x33,0x12,0xE0,0x09,0x22,0xE0,0x19,
+  0x11,0x22,0x11,0x04,0x53,0x04,0xE0,0x23,0x13,0x18,0xFC,0x07,0x80,                  /* 0x32 B */
+  0xA9,0xC0,0x1F,0x30,0x20,0x88,0x0F,0x44,0x30,0x20,0x11,0x12,0xB1,0x12,0x11,0x20,
+  0x18,0x44,0x20,0x88,0x1F,0x30,0x20,0xC0,0x1F,0x80,                                 /* 0x33 C */
+  0xA2,0xFC,0x07,0x13,0x08,0xE0,0x33,0x11,0x04,0x11,0x40,0x11,0x08,0xB1,0x48,0x33,
+  0x26,0xE0,0x11,0x13,0x0C,0xFC,0x03,0x80,                                           /* 0x34 D */
+  0xA2,0xF8,0x3F,0x22,0xC0,0x3F,0x82,0xC0,0x1F,0x22,0xC0,0x1F,0x82,0xC0,0x7F,0x22,
+  0xF8,0x7F,0x80,                                                                    /* 0x35 E */
+  0xA2,0xF8,0x7F,0x22,0xC0,0x7F,0x82,0xC0,0x3F,0x22,0xC0,0x3F,0xC1,0x38,0x90,        /* 0x36 F */
+  0xA9,0xC0,0x1F,0x30,0x20,0x88,0x0F,0x44,0x30,0x20,0x11,0x12,0x61,0x3F,0x32,0x07,
+  0x12,0x11,0x20,0x11,0x44,0x16,0x88,0x07,0x30,0x20,0xC0,0x1F,0x80,                  /* 0x37 G */
+  0xA2,0x1C,0x38,0xC2,0xE0,0x07,0x22,0xE0,0x07,0xC2,0x1C,0x38,0x80,                  /* 0x38 H */
+  0xA2,0xFC,0x1F,0x22,0x3C,0x1E,0xF0,0x72,0x3C,0x1E,0x22,0xFC,0x1F,0x80,             /* 0x39 I */
+  0xA2,0xF8,0x0F,0x22,0xF8,0x01,0xF0,0x54,0x04,0x09,0xF8,0x04,0x13,0x02,0xFC,0x01,
+  0x80,                                                                              /* 0x3a J */
+  0xA2,0x1C,0x78,0x11,0x44,0x11,0x22,0x11,0x11,0x19,0x08,0x80,0x04,0x40,0x02,0x20,
+  0x01,0x20,0x01,0x15,0x02,0x40,0x04,0x80,0x08,0x11,0x11,0x11,0x22,0x11,0x44,0x13,
+  0x80,0x1C,0xF8,0x80,                                                               /* 0x3b K */
+  0xA1,0x38,0xF0,0xC2,0xC0,0x3F,0x22,0xF8,0x3F,0x80,                                 /* 0x3c L */
+  0xA4,0x0E,0x38,0x10,0x04,0x42,0x28,0x0A,0x42,0x50,0x04,0x11,0x01,0x22,0xA0,0x02,
+  0x42,0xC0,0x01,0x42,0x06,0x30,0x80,                                                /* 0x3d M */
+  0xA2,0x1C,0x30,0x21,0x20,0x11,0x40,0x31,0x80,0x13,0x10,0x01,0x20,0x25,0x02,0x40,
+  0x04,0x80,0x08,0x11,0x01,0x31,0x02,0x11,0x04,0x22,0x0C,0x38,0x80,                  /* 0x3e N */
+  0xA8,0xE0,0x07,0x10,0x08,0xC8,0x13,0x24,0x24,0x22,0x12,0x48,0xA2,0x12,0x48,0x28,
+  0x24,0x24,0xC8,0x13,0x10,0x08,0xE0,0x07,0x80,                                      /* 0x3f O */
+  0xA2,0xF8,0x1F,0x13,0x20,0xC0,0x47,0x11,0x08,0x51,0x08,0x13,0x44,0xC0,0x23,0x13,
+  0x18,0xC0,0x07,0xA1,0x38,0x90,                                                     /* 0x40 P */
+  0xA8,0xE0,0x07,0x10,0x08,0xC8,0x13,0x24,0x24,0x22,0x12,0x48,0xA2,0x12,0x48,0x28,
+  0x24,0x24,0xC8,0x13,0x10,0x08,0xE0,0x19,0x11,0x66,0x11,0x88,0x11,0xB0,0x11,0x40,   /* 0x41 Q */
+  0xA2,0xFC,0x07,0x13,0x08,0xE0,0x11,0x11,0x02,0x53,0x12,0xE0,0x09,0x14,0x04,0x60,
+  0x04,0x80,0x21,0x08,0x11,0x11,0x11,0x22,0x11,0x04,0x13,0x40,0x1C,0x78,0x80,        /* 0x42 R */
+  0xA8,0xE0,0x0F,0x18,0x10,0xC4,0x07,0x20,0x18,0x21,0x20,0x11,0xC4,0x16,0x08,0x07,
+  0x30,0x18,0xC0,0x21,0x11,0x06,0x48,0x0C,0x24,0xF0,0x03,0x0C,0x18,0xF0,0x07,0x80,   /* 0x43 S */
+  0xA2,0xFF,0x7F,0x22,0x3F,0x7E,0xF0,0xB2,0xC0,0x01,0x80,                            /* 0x44 T */
+  0xA2,0x1C,0x70,0xF0,0x7A,0x20,0x08,0x04,0x40,0xC8,0x27,0x10,0x10,0xE0,0x0F,0x80,   /* 0x45 U */
+  0xA4,0x07,0xE0,0x09,0x90,0x21,0x12,0x22,0x48,0x20,0x11,0x04,0x22,0x24,0x48,0x23,
+  0x10,0x90,0x02,0x32,0x09,0x20,0x34,0x40,0x04,0x80,0x03,0x80,                       /* 0x46 V */
+  0xA2,0x03,0xC0,0x21,0x04,0x14,0x81,0xA1,0x40,0x02,0x64,0x88,0x15,0x22,0x40,0x44,
+  0x40,0x08,0x10,0x02,0x11,0x20,0x22,0x3C,0x1C,0x80,                                 /* 0x47 W */
+  0xA6,0x1E,0xE0,0x22,0x90,0x44,0x48,0x17,0x24,0x88,0x12,0x10,0x09,0x20,0x04,0x32,
+  0x04,0x20,0x1E,0x80,0x08,0x50,0x11,0x28,0x22,0x04,0x04,0x12,0x40,0x09,0x88,0x07,
+  0xF0,0x80,                                                                         /* 0x48 X */
+  0xA6,0x07,0xE0,0x09,0x90,0x12,0x40,0x19,0x28,0x24,0x04,0x40,0x12,0x08,0x09,0x90,
+  0x04,0x22,0x20,0x02,0xC2,0xC0,0x01,0x80,                                           /* 0x49 Y */
+  0xA2,0xFC,0x3F,0x22,0xFC,0x07,0x11,0x24,0x11,0x12,0x13,0x09,0x80,0x04,0x14,0x02,
+  0x40,0x01,0x20,0x11,0x90,0x11,0x48,0x11,0x24,0x11,0x12,0x12,0xF0,0x3F,0x22,0xFE,
+  0x3F,0x80,                                                                         /* 0x4a Z */
+  0x22,0xC0,0x3F,0x31,0x3E,0xF0,0xF0,0x91,0x3E,0x22,0xC0,0x3F,                       /* 0x4b [ */
+  0x21,0x06,0x11,0x0A,0x31,0x14,0x31,0x28,0x31,0x50,0x31,0xA0,0x32,0x40,0x01,0x22,
+  0x80,0x02,0x31,0x05,0x31,0x0A,0x31,0x14,0x31,0x28,0x31,0x50,0x11,0x60,             /* 0x4c \ */
+  0x22,0xFC,0x03,0x21,0x7C,0xF0,0xF0,0x91,0x7C,0x32,0xFC,0x03,                       /* 0x4d ] */
+  0x51,0x01,0x22,0x80,0x02,0x21,0x40,0x22,0x05,0x20,0x13,0x80,0x0A,0x50,0x22,0x14,
+  0x28,0x32,0x14,0x28,0x24,0x0A,0x50,0x06,0x60,0xF0,0x10,                            /* 0x4e ^ */
+  0xF0,0xF0,0xC2,0xFF,0xFF,0x22,0xFF,0xFF,0x40,                                      /* 0x4f _ */
+  0x06,0xC0,0x01,0x40,0x02,0x80,0x04,0x11,0x07,0xF0,0xF0,0xE0,                       /* 0x50 ` */
+  0xE8,0xE0,0x07,0x18,0x08,0xE0,0x11,0x18,0x02,0x23,0xE0,0x03,0x10,0x13,0xC8,0x03,
+  0x24,0x58,0x20,0x02,0xC4,0x65,0x08,0x03,0xF0,0x78,0x80,                            /* 0x51 a */
+  0x21,0x1C,0xB9,0x80,0x07,0x40,0x18,0xA0,0x03,0x40,0x24,0x20,0xC9,0x24,0x20,0x02,
+  0xC0,0x11,0x30,0x08,0xCC,0x07,0x80,                                                /* 0x52 b */
+  0xE9,0xC0,0x1F,0x30,0x20,0x88,0x1F,0x40,0x20,0x24,0x91,0x20,0x11,0x04,0x18,0xC0,
+  0x20,0x08,0x1F,0x30,0x20,0xC0,0x1F,0x80,                                           /* 0x53 c */
+  0x31,0x70,0xA9,0xC0,0x03,0x30,0x0C,0x88,0x03,0x40,0x0C,0x24,0xBA,0x20,0x08,0x04,
+  0x04,0xC8,0x0B,0x10,0x04,0xE0,0x73,0x80,                                           /* 0x54 d */
+  0xE9,0xC0,0x07,0x30,0x08,0x88,0x13,0x40,0x24,0x24,0x32,0xE0,0x07,0x22,0xE0,0x3F,
+  0x21,0x24,0x18,0x40,0x20,0x88,0x1F,0x30,0x20,0xC0,0x1F,0x80,                       /* 0x55 e */
+  0x32,0xFF,0x80,0x12,0x40,0xFC,0x11,0x02,0x42,0x3C,0x7E,0x22,0x3C,0x7E,0xF0,0x72,
+  0xC0,0x01,0x80,                                                                    /* 0x56 f */
+  0xE9,0xC0,0x73,0x30,0x0C,0x88,0x03,0x40,0x0C,0x24,0xBA,0x20,0x08,0x04,0x04,0xC8,
+  0x0B,0x10,0x04,0xE0,0x03,0x17,0x48,0x18,0x04,0xE0,0x23,0xF8,0x18,                  /* 0x57 g */
+  0x21,0x1C,0xC8,0x0F,0xC0,0x10,0xA0,0x23,0x40,0x04,0x20,0xF0,0x42,0x1C,0x38,0x80,   /* 0x58 h */
+  0x22,0x80,0x03,0x42,0x80,0x03,0x42,0xFC,0x03,0x21,0x7C,0xF0,0x82,0x80,0x03,0x80,   /* 0x59 i */
+  0x31,0x0E,0x51,0x0E,0x42,0xF8,0x0F,0x22,0xF8,0x01,0xF0,0xB3,0x04,0x09,0xF8,0x12,
+  0x04,0x06,                                                                         /* 0x5a j */
+  0x21,0x38,0xC1,0x3C,0x11,0x22,0x11,0x10,0x13,0x01,0x80,0x08,0x12,0x04,0x40,0x11,
+  0x40,0x23,0x04,0x80,0x08,0x11,0x01,0x11,0x10,0x11,0x22,0x13,0x44,0x38,0x78,0x80,   /* 0x5b k */
+  0x22,0xF8,0x07,0x21,0xF8,0xF0,0xF0,0x61,0x07,0x80,                                 /* 0x5c l */
+  0xE8,0xCE,0x31,0x20,0x48,0x10,0x06,0x60,0x08,0x12,0x04,0x10,0xF0,0x22,0x8E,0x73,
+  0x80,                                                                              /* 0x5d m */
+  0xE9,0x1C,0x0F,0xC0,0x10,0xA0,0x23,0x40,0x04,0x20,0xF0,0x42,0x1C,0x38,0x80,        /* 0x5e n */
+  0xEA,0xE0,0x03,0x18,0x0C,0xC4,0x11,0x20,0x02,0x12,0x24,0xAA,0x12,0x24,0x20,0x02,
+  0xC4,0x11,0x18,0x0C,0xE0,0x03,0x80,                                                /* 0x5f o */
+  0xE9,0x9C,0x07,0x40,0x18,0xA0,0x03,0x40,0x24,0x20,0xC9,0x24,0x20,0x02,0xC0,0x11,
+  0x60,0x08,0x80,0x07,0x80,                                                          /* 0x60 p */
+  0xE9,0xE0,0x39,0x18,0x06,0xC4,0x01,0x20,0x06,0x12,0xB9,0x10,0x04,0x02,0x02,0xE4,
+  0x05,0x08,0x03,0xF0,0x90,                                                          /* 0x61 q */
+  0xE2,0x70,0x3E,0x13,0x01,0x80,0x0E,0x13,0x01,0x80,0x30,0xF0,0x31,0x70,0x90,        /* 0x62 r */
+  0xE8,0xE0,0x0F,0x10,0x10,0x88,0x0F,0x40,0x10,0x28,0xC0,0x01,0x08,0x06,0x70,0x18,
+  0x80,0x23,0x11,0x04,0x28,0x18,0x04,0xE0,0x23,0x08,0x18,0xF0,0x07,0x80,             /* 0x63 s */
+  0xA1,0xE0,0x32,0x1C,0x3F,0x22,0x1C,0x3F,0xF0,0x24,0x01,0x20,0x3E,0x40,0x12,0x80,
+  0x3F,0x80,                                                                         /* 0x64 t */
+  0xE2,0x1C,0x38,0xF0,0x49,0x04,0x20,0x02,0xC4,0x05,0x08,0x03,0xF0,0x38,0x80,        /* 0x65 u */
+  0xE4,0x1E,0x70,0x02,0x48,0x21,0x20,0x12,0x04,0x20,0x12,0x04,0x48,0x23,0x10,0x90,
+  0x02,0x33,0x08,0x20,0x01,0x24,0x40,0x04,0x80,0x03,0x80,                            /* 0x66 v */
+  0xE4,0x03,0xC0,0x84,0x03,0x13,0x80,0x41,0x20,0x24,0x80,0x01,0x28,0x04,0x14,0x40,
+  0x02,0x10,0x40,0x12,0x10,0x0A,0x32,0x20,0x24,0x12,0x18,0x1C,0x80,                  /* 0x67 w */
+  0xED,0x1E,0x30,0x22,0x28,0x44,0x14,0x08,0x02,0x80,0x08,0x10,0x05,0x20,0x3E,0x20,
+  0x04,0x90,0x08,0x40,0x01,0x08,0x10,0x24,0x22,0x12,0x44,0x0E,0x78,0x80,             /* 0x68 x */
+  0xE4,0x1E,0x70,0x02,0x40,0x13,0x08,0x24,0x20,0x12,0x04,0x40,0x13,0x08,0x12,0x80,
+  0x12,0x10,0x09,0x22,0x20,0x04,0x32,0x02,0x40,0x11,0x40,0x22,0x01,0x20,0x11,0x9C,
+  0x11,0x40,0x10,                                                                    /* 0x69 y */
+  0xE2,0xFC,0x3F,0x22,0xFC,0x07,0x11,0x24,0x11,0x12,0x18,0x09,0x80,0x04,0x40,0x02,
+  0x20,0x01,0x90,0x11,0x48,0x11,0x24,0x12,0xE0,0x3F,0x22,0xFC,0x3F,0x80,             /* 0x6a z */
+  0x32,0x1F,0x80,0x12,0x40,0x1C,0x11,0x02,0x42,0x40,0x02,0x64,0x40,0x02,0x38,0x01,
+  0x24,0x38,0x01,0x40,0x02,0x62,0x40,0x02,0x54,0x02,0x40,0x1C,0x80,0x21,0x1F,        /* 0x6b { */
+  0x22,0x80,0x01,0xF0,0xF0,0xF0,0x12,0x80,0x01,                                      /* 0x6c | */
+  0x21,0x7C,0x11,0x80,0x13,0x1C,0x01,0x20,0x52,0x20,0x01,0x64,0x20,0x01,0x40,0x0E,
+  0x24,0x40,0x0E,0x20,0x01,0x62,0x20,0x01,0x41,0x20,0x13,0x1C,0x01,0x80,0x11,0x7C,
+  0x10,                                                                              /* 0x6d } */
+  0xF0,0x9A,0x78,0x60,0x84,0x03,0x3A,0x5C,0xC0,0x21,0x06,0x1E,0xF0,0x30              /* 0x6e ~ */
+
+  #ifdef FONT_EXTRA
+  ,
+  /* extra characters */
+  0x22,0xFE,0x7F,0x23,0x80,0x03,0x40,0x11,0x20,0x11,0x10,0x11,0x70,0xF0,0x62,0x70,
+  0x1C,0x22,0xF0,0x1F,0x22,0xFE,0x7F,0x60,                                           /* 0x6f 1 (reversed color) */
+  0x22,0xFE,0x7F,0x28,0xE0,0x03,0x10,0x04,0xC8,0x09,0x20,0x12,0x21,0x18,0x41,0x12,
+  0x18,0x09,0x80,0x04,0x40,0x02,0x20,0x01,0x90,0x11,0x48,0x32,0xC0,0x1F,0x22,0xF8,
+  0x1F,0x22,0xFE,0x7F,0x60,                                                          /* 0x70 2 (reversed color) */
+  0x22,0xFE,0x7F,0x28,0xE0,0x07,0x10,0x08,0xC8,0x11,0x20,0x02,0x21,0x18,0x23,0x12,
+  0xC0,0x09,0x22,0xC0,0x09,0x11,0x12,0x21,0x18,0x38,0x20,0x02,0xC8,0x11,0x10,0x08,
+  0xE0,0x07,0x22,0xFE,0x7F,0x60,                                                     /* 0x71 3 (reversed color) */
+  0xA6,0xFF,0x7F,0x1E,0x3C,0x02,0x20,0x64,0x24,0x12,0xC8,0x09,0x24,0xC8,0x09,0x24,
+  0x12,0x66,0x02,0x20,0x1E,0x3C,0xFF,0x7F,0x80,                                      /* 0x72 x (reversed color) */
+  0xA2,0xFF,0xFF,0x22,0xFC,0xFF,0xF0,0x72,0xFC,0xFF,0x22,0xFF,0xFF,0x80,             /* 0x73 symbol: battery left side, low */
+  0xA2,0xFF,0xFF,0x22,0xFC,0xFF,0x22,0xF0,0x3F,0xE2,0xF0,0x3F,0x22,0xFC,0xFF,0x22,
+  0xFF,0xFF,0x80,                                                                    /* 0x74 symbol: battery left side, high */
+  0xA2,0xFF,0x3F,0x22,0xFF,0x0F,0x31,0xC0,0x31,0x30,0x71,0x30,0x31,0xC0,0x22,0xFF,
+  0x0F,0x22,0xFF,0x3F,0x80,                                                          /* 0x75 symbol: battery right side, low */
+  0xA2,0xFF,0x3F,0x22,0xFF,0x0F,0x22,0xFF,0xC3,0x31,0x30,0x71,0x30,0x22,0xFF,0xC3,
+  0x22,0xFF,0x0F,0x22,0xFF,0x3F,0x80                                                 /* 0x76 symbol: battery right side, high */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed characters in FontData[]
+ */
+
+const uint16_t FontIndex[] PROGMEM = {
+  0,        /* 0x00 n/a */
+  4,        /* 0x01 symbol: diode A-C */
+  46,       /* 0x02 symbol: diode C-A */
+  88,       /* 0x03 symbol: capacitor */
+  103,      /* 0x04 omega */
+  135,      /* 0x05  (micro) */
+  151,      /* 0x06 symbol: resistor left side */
+  168,      /* 0x07 symbol: resistor right side */
+  185,      /* 0x08  */
+  223,      /* 0x09  */
+  254,      /* 0x0a  */
+  276,      /* 0x0b  */
+  311,      /* 0x0c  */
+  344,      /* 0x0d  */
+  373,      /* 0x0e  */
+  394,      /* 0x0f  (degree) */
+  411,      /* 0x10 space */
+  415,      /* 0x11 ! */
+  429,      /* 0x12 " */
+  441,      /* 0x13 # */
+  469,      /* 0x14 $ */
+  505,      /* 0x15 % */
+  543,      /* 0x16 & */
+  582,      /* 0x17  */
+  593,      /* 0x18 ( */
+  622,      /* 0x19 ) */
+  654,      /* 0x1a * */
+  679,      /* 0x1b + */
+  692,      /* 0x1c , */
+  707,      /* 0x1d - */
+  716,      /* 0x1e . */
+  725,      /* 0x1f / */
+  756,      /* 0x20 0 */
+  782,      /* 0x21 1 */
+  799,      /* 0x22 2 */
+  832,      /* 0x23 3 */
+  866,      /* 0x24 4 */
+  894,      /* 0x25 5 */
+  922,      /* 0x26 6 */
+  958,      /* 0x27 7 */
+  986,      /* 0x28 8 */
+  1022,     /* 0x29 9 */
+  1058,     /* 0x2a : */
+  1071,     /* 0x2b ; */
+  1090,     /* 0x2c < */
+  1119,     /* 0x2d = */
+  1134,     /* 0x2e > */
+  1163,     /* 0x2f ? */
+  1195,     /* 0x30 @ */
+  1233,     /* 0x31 A */
+  1265,     /* 0x32 B */
+  1294,     /* 0x33 C */
+  1320,     /* 0x34 D */
+  1344,     /* 0x35 E */
+  1363,     /* 0x36 F */
+  1378,     /* 0x37 G */
+  1407,     /* 0x38 H */
+  1420,     /* 0x39 I */
+  1434,     /* 0x3a J */
+  1451,     /* 0x3b K */
+  1487,     /* 0x3c L */
+  1497,     /* 0x3d M */
+  1520,     /* 0x3e N */
+  1549,     /* 0x3f O */
+  1574,     /* 0x40 P */
+  1596,     /* 0x41 Q */
+  1628,     /* 0x42 R */
+  1659,     /* 0x43 S */
+  1691,     /* 0x44 T */
+  1702,     /* 0x45 U */
+  1718,     /* 0x46 V */
+  1746,     /* 0x47 W */
+  1772,     /* 0x48 X */
+  1806,     /* 0x49 Y */
+  1830,     /* 0x4a Z */
+  1864,     /* 0x4b [ */
+  1876,     /* 0x4c \ */
+  1906,     /* 0x4d ] */
+  1918,     /* 0x4e ^ */
+  1945,     /* 0x4f _ */
+  1954,     /* 0x50 ` */
+  1966,     /* 0x51 a */
+  1993,     /* 0x52 b */
+  2016,     /* 0x53 c */
+  2040,     /* 0x54 d */
+  2064,     /* 0x55 e */
+  2092,     /* 0x56 f */
+  2111,     /* 0x57 g */
+  2140,     /* 0x58 h */
+  2156,     /* 0x59 i */
+  2172,     /* 0x5a j */
+  2190,     /* 0x5b k */
+  2222,     /* 0x5c l */
+  2232,     /* 0x5d m */
+  2249,     /* 0x5e n */
+  2264,     /* 0x5f o */
+  2287,     /* 0x60 p */
+  2308,     /* 0x61 q */
+  2329,     /* 0x62 r */
+  2344,     /* 0x63 s */
+  2374,     /* 0x64 t */
+  2392,     /* 0x65 u */
+  2407,     /* 0x66 v */
+  2434,     /* 0x67 w */
+  2463,     /* 0x68 x */
+  2493,     /* 0x69 y */
+  2528,     /* 0x6a z */
+  2558,     /* 0x6b { */
+  2589,     /* 0x6c | */
+  2598,     /* 0x6d } */
+  2631      /* 0x6e ~ */
+  #ifdef FONT_EXTRA
+  ,
+  2645,     /* 0x6f 1 (reversed color) */
+  2669,     /* 0x70 2 (reversed color) */
+  2706,     /* 0x71 3 (reversed color) */
+  2744,     /* 0x72 x (reversed color) */
+  2769,     /* 0x73 symbol: battery left side, low */
+  2783,     /* 0x74 symbol: battery left side, high */
+  2802,     /* 0x75 symbol: battery right side, low */
+  2823      /* 0x76 symbol: battery right side, high */
+  #endif
+};
+
+#else
+
 /*
  *  character bitmaps
  *  - to reduce size we place some symbols and special characters at
@@ -172,6 +552,8 @@ const uint8_t FontData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 /*
  *  font lookup table for ISO 8859-1
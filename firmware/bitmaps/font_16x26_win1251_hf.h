@@ -29,6 +29,529 @@
 #define FONT_BYTES_Y        26     /* 26 bytes in y direction */
 
 
+#ifdef FONT_RLE
+
+/*
+ *  compressed character bitmaps (FONT_RLE)
+ *  - same bitmaps as below, each character compressed separately
+ *  - same format as compressed symbols (see symbols_<size>_h.h)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t FontData[] PROGMEM = {
+  /* symbols and special characters */
+  0xF0,0xF0,0xF0,0x70,                                                               /* 0x00 n/a */
+  0x63,0x04,0x70,0x08,0x11,0x10,0x11,0x20,0x11,0x40,0x11,0x80,0x21,0x01,0x11,0x02,
+  0x13,0x04,0x03,0x88,0x22,0x03,0x88,0x11,0x04,0x11,0x02,0x12,0x01,0x80,0x11,0x40,
+  0x11,0x20,0x11,0x10,0x11,0x08,0x12,0x04,0x70,0x40,                                 /* 0x01 symbol: diode A-C */
+  0x62,0x0E,0x20,0x11,0x10,0x11,0x08,0x11,0x04,0x11,0x02,0x12,0x01,0x80,0x11,0x40,
+  0x11,0x20,0x12,0x11,0xC0,0x23,0x11,0xC0,0x20,0x11,0x40,0x11,0x80,0x21,0x01,0x11,
+  0x02,0x11,0x04,0x11,0x08,0x13,0x10,0x0E,0x20,0x40,                                 /* 0x02 symbol: diode C-A */
+  0x62,0x3C,0x3C,0xF0,0x12,0x03,0xC0,0x22,0x03,0xC0,0xF0,0x12,0x3C,0x3C,0x40,        /* 0x03 symbol: capacitor */
+  0x8C,0xE0,0x03,0x18,0x0C,0x04,0x10,0xF2,0x27,0x08,0x08,0x01,0x40,0x6E,0x01,0x40,
+  0x08,0x08,0x12,0x24,0x24,0x12,0x08,0x08,0x03,0x40,0x0C,0x38,0x22,0x3F,0x7E,0x80,   /* 0x04 omega */
+  0xA1,0x38,0x41,0x1E,0x11,0x10,0xF0,0x38,0x40,0x01,0xA0,0x02,0x40,0x15,0x94,0x18,
+  0x21,0x0A,0x11,0x04,0x11,0x02,0x10,                                                /* 0x05  (micro) */
+  0xA2,0xFE,0xFF,0x22,0xF8,0xFF,0x81,0x01,0x31,0x01,0x92,0xF8,0xFF,0x22,0xFE,0xFF,
+  0x80,                                                                              /* 0x06 symbol: resistor left side */
+  0xA2,0xFF,0x7F,0x22,0xFF,0x1F,0x91,0x80,0x31,0x80,0x82,0xFF,0x1F,0x22,0xFF,0x7F,
+  0x80,                                                                              /* 0x07 symbol: resistor right side */
+
+  0x47,0xC0,0x7F,0x20,0x40,0x90,0x07,0x48,0x11,0x24,0xF0,0xAC,0xE0,0x07,0x02,0x40,
+  0xF0,0x0F,0x08,0x10,0x04,0x20,0x02,0x40,0x20,                                      /* 0x08  */
+  0x44,0x3E,0x7C,0x22,0x44,0xF0,0xF2,0xE0,0x07,0x13,0x40,0xFC,0x0F,0x11,0x10,0x11,
+  0x20,0x11,0x40,0x20,                                                               /* 0x09  */
+  0x41,0x3E,0x11,0x22,0xB2,0xE0,0x07,0x13,0x08,0xE0,0x13,0x11,0x24,0xB7,0x24,0xE0,
+  0x13,0x02,0x08,0xFE,0x07,0x80,                                                     /* 0x0a  */
+  0x47,0xE0,0x7F,0x10,0x40,0xC8,0x07,0x24,0x91,0x24,0x13,0xC8,0x07,0x10,0x15,0x20,
+  0x06,0x20,0x01,0x90,0x11,0x48,0x11,0x20,0x11,0x04,0x34,0x12,0x44,0x0E,0x7C,0x80,   /* 0x0b  */
+  0xE3,0xC0,0x3F,0x20,0x13,0x90,0x07,0x48,0x11,0x24,0xFC,0xE0,0x07,0x02,0x40,0xF0,
+  0x0F,0x08,0x10,0x04,0x20,0x02,0x40,0x20,                                           /* 0x0c  */
+  0xE4,0x3E,0x7C,0x22,0x44,0xF0,0x52,0xE0,0x07,0x13,0x40,0xFC,0x0F,0x11,0x10,0x11,
+  0x20,0x11,0x40,0x20,                                                               /* 0x0d  */
+  0xE1,0x3E,0x11,0x22,0x52,0xE0,0x07,0x13,0x08,0xE0,0x13,0x11,0x24,0x77,0x24,0xE0,
+  0x13,0x02,0x08,0xFE,0x07,0x80,                                                     /* 0x0e  */
+  0xE6,0xF0,0x7F,0x08,0x40,0xE4,0x07,0x63,0xE4,0x07,0x08,0x15,0x30,0x06,0x20,0x01,
+  0x90,0x11,0x48,0x11,0x24,0x14,0x12,0x44,0x0E,0x7C,0x80,                            /* 0x0f  */
+
+  /* standard characters */
+  0xF0,0xF0,0xF0,0x70,                                                               /* 0x10 space */
+  0x42,0x80,0x03,0xF0,0xB2,0x80,0x03,0x22,0x80,0x03,0x42,0x80,0x03,0x80,             /* 0x11 ! */
+  0x42,0x38,0x0E,0x42,0x28,0x0A,0x22,0x10,0x04,0xF0,0xF0,0x60,                       /* 0x12 " */
+  0x42,0x80,0x31,0x22,0x40,0x29,0x62,0x38,0x67,0x22,0x98,0x73,0x24,0x50,0x0A,0xCE,
+  0x39,0x22,0xE6,0x3C,0x62,0x94,0x02,0x22,0x8C,0x01,0x80,                            /* 0x13 # */
+  0x31,0x03,0x28,0xC0,0x0C,0x20,0x10,0x90,0x27,0x48,0x08,0x11,0x30,0x21,0x48,0x16,
+  0x90,0x01,0x60,0x06,0x80,0x19,0x11,0x22,0x11,0x04,0x21,0x1C,0x11,0x04,0x18,0x20,
+  0x24,0xC8,0x13,0x10,0x08,0x60,0x06,0x22,0x80,0x01,0x40,                            /* 0x14 $ */
+  0x61,0x78,0x11,0xB4,0x12,0x4A,0xC1,0x11,0xA0,0x17,0x50,0x4A,0x29,0xB4,0x14,0x78,
+  0x0A,0x1C,0x05,0x80,0x02,0x40,0x01,0xA0,0x3C,0x50,0x5A,0x28,0xA5,0x14,0x11,0x0A,
+  0x12,0x06,0xA5,0x11,0x5A,0x11,0x3C,0x80,                                           /* 0x15 % */
+  0x46,0xE0,0x03,0x10,0x04,0xC8,0x09,0x4C,0xC8,0x09,0x10,0x04,0x10,0x03,0x08,0x01,
+  0x64,0x42,0x92,0x24,0x11,0x09,0x11,0x52,0x11,0x04,0x2A,0x12,0x44,0x24,0x12,0xC8,
+  0x09,0x10,0x24,0xE0,0x43,0x80,                                                     /* 0x16 & */
+  0x42,0xC0,0x01,0x63,0x40,0x01,0xC0,0x11,0x40,0xF0,0xF0,0x50,                       /* 0x17 ' */
+  0x51,0x18,0x11,0x06,0x17,0x11,0x80,0x0C,0x40,0x02,0x20,0x01,0x41,0x90,0xD1,0x90,
+  0x56,0x20,0x01,0x40,0x02,0x80,0x0C,0x11,0x11,0x11,0x06,0x11,0x18,                  /* 0x18 ( */
+  0x41,0x30,0x11,0xC0,0x16,0x10,0x01,0x60,0x02,0x80,0x04,0x11,0x09,0x51,0x12,0xD1,
+  0x12,0x58,0x09,0x80,0x04,0x60,0x02,0x10,0x01,0xC0,0x11,0x30,0x10,                  /* 0x19 ) */
+  0x6F,0x80,0x01,0x08,0x10,0x10,0x08,0x28,0x14,0x50,0x0A,0x20,0x04,0x3C,0x3C,0x3C,
+  0x0D,0x3C,0x20,0x04,0x50,0x0A,0x28,0x14,0x10,0x08,0x08,0x10,0x80,0x01,0xF0,0x30,   /* 0x1a * */
+  0xC2,0x80,0x01,0xA2,0x7E,0x7E,0x22,0x7E,0x7E,0xA2,0x80,0x01,0xA0,                  /* 0x1b + */
+  0xF0,0xF0,0x42,0xC0,0x03,0x61,0xC0,0x15,0x80,0x02,0x40,0x01,0xC0,0x30,             /* 0x1c , */
+  0xF0,0x92,0xFE,0x7F,0x22,0xFE,0x7F,0xF0,0x70,                                      /* 0x1d - */
+  0xF0,0xF0,0x42,0xC0,0x03,0x62,0xC0,0x03,0x80,                                      /* 0x1e . */
+  0x51,0x60,0x11,0x50,0x31,0x28,0x31,0x14,0x31,0x0A,0x31,0x05,0x22,0x80,0x02,0x22,
+  0x40,0x01,0x21,0xA0,0x31,0x50,0x31,0x28,0x31,0x14,0x11,0x0C,0x30,                  /* 0x1f / */
+  0x48,0xE0,0x07,0x10,0x08,0xC8,0x13,0x24,0x24,0xF0,0x98,0x24,0x24,0xC8,0x13,0x10,
+  0x08,0xE0,0x07,0x80,                                                               /* 0x20 0 */
+  0x52,0x03,0x80,0x11,0x40,0x11,0x20,0x11,0x10,0x11,0x70,0xF0,0x82,0x70,0x1C,0x22,
+  0xF0,0x1F,0x80,                                                                    /* 0x21 1 */
+  0x48,0xF0,0x07,0x08,0x08,0xE4,0x13,0x10,0x24,0x21,0x0C,0x41,0x24,0x11,0x12,0x18,
+  0x09,0x80,0x04,0x40,0x02,0x20,0x01,0x90,0x11,0x48,0x11,0x24,0x32,0xE0,0x3F,0x22,
+  0xFC,0x3F,0x80,                                                                    /* 0x22 2 */
+  0x48,0xF0,0x07,0x08,0x08,0xE4,0x13,0x10,0x24,0x21,0x0C,0x43,0x24,0xC0,0x13,0x22,
+  0xC0,0x13,0x11,0x24,0x41,0x0C,0x38,0x10,0x24,0xE4,0x13,0x08,0x08,0xF0,0x07,0x80,   /* 0x23 3 */
+  0x51,0x3C,0x11,0x02,0x11,0x01,0x15,0x04,0x80,0x02,0x40,0x01,0x21,0xA0,0x11,0x50,
+  0x31,0x28,0x11,0x14,0x12,0xF0,0x07,0x22,0xFC,0x07,0x91,0x38,0x80,                  /* 0x24 4 */
+  0x42,0xFC,0x1F,0x22,0xE0,0x1F,0x82,0xE0,0x07,0x13,0x08,0xFC,0x13,0x11,0x24,0x81,
+  0x0C,0x18,0x10,0x24,0xE4,0x13,0x08,0x08,0xF0,0x07,0x80,                            /* 0x25 5 */
+  0x48,0xE0,0x0F,0x10,0x10,0xC8,0x07,0x24,0x18,0x68,0xC0,0x07,0x20,0x08,0xC0,0x13,
+  0x20,0x24,0xA8,0x24,0x24,0xC8,0x13,0x10,0x08,0xE0,0x07,0x80,                       /* 0x26 6 */
+  0x42,0xFC,0x3F,0x23,0xF0,0x07,0x0C,0x41,0x24,0x11,0x12,0x15,0x09,0x80,0x04,0x40,
+  0x02,0xF0,0x32,0xC0,0x01,0x80,                                                     /* 0x27 7 */
+  0x48,0xE0,0x07,0x10,0x08,0xC8,0x13,0x24,0x24,0x64,0x24,0x24,0xC8,0x13,0x24,0xC8,
+  0x13,0x24,0x24,0x88,0x24,0x24,0xC8,0x13,0x10,0x08,0xE0,0x07,0x80,                  /* 0x28 8 */
+  0x48,0xE0,0x07,0x10,0x08,0xC8,0x13,0x24,0x24,0xA8,0x24,0x04,0xC8,0x03,0x10,0x04,
+  0xE0,0x03,0x68,0x18,0x24,0xE0,0x13,0x08,0x08,0xF0,0x07,0x80,                       /* 0x29 9 */
+  0xE2,0xC0,0x03,0x62,0xC0,0x03,0xA2,0xC0,0x03,0x62,0xC0,0x03,0x80,                  /* 0x2a : */
+  0xE2,0xC0,0x03,0x62,0xC0,0x03,0xA2,0xC0,0x03,0x61,0x40,0x24,0x02,0x40,0x01,0xC0,
+  0x30,                                                                              /* 0x2b ; */
+  0xD1,0x40,0x11,0x30,0x11,0x4C,0x16,0x33,0xC0,0x0C,0x30,0x03,0xCC,0x31,0xCC,0x14,
+  0x30,0x03,0xC0,0x0C,0x11,0x33,0x11,0x4C,0x11,0x30,0x11,0x40,0xA0,                  /* 0x2c < */
+  0xF0,0x52,0xFE,0x7F,0x22,0xFE,0x7F,0x22,0xFE,0x7F,0x22,0xFE,0x7F,0xF0,0x30,        /* 0x2d = */
+  0xC1,0x02,0x11,0x0C,0x11,0x32,0x11,0xCC,0x14,0x30,0x03,0xC0,0x0C,0x11,0x33,0x36,
+  0x33,0xC0,0x0C,0x30,0x03,0xCC,0x11,0x32,0x11,0x0C,0x11,0x02,0xB0,                  /* 0x2e > */
+  0x48,0xE0,0x07,0x10,0x08,0xC8,0x13,0x24,0x24,0x21,0x1C,0x41,0x24,0x11,0x12,0x15,
+  0x09,0x80,0x04,0x40,0x02,0x42,0xC0,0x01,0x22,0xC0,0x01,0x42,0xC0,0x01,0x80,        /* 0x2f ? */
+  0x48,0xC0,0x03,0x20,0x04,0xD0,0x0B,0x28,0x14,0x24,0x80,0x03,0xC0,0x01,0x84,0xC0,
+  0x05,0x80,0x1F,0x41,0x20,0x18,0x48,0x0C,0x90,0x0B,0x20,0x04,0xC0,0x03,0x80,        /* 0x30 @ */
+  0x47,0xC0,0x7F,0x20,0x40,0x90,0x07,0x48,0x11,0x24,0xB2,0xE0,0x07,0x22,0xE0,0x07,
+  0xA4,0x22,0x44,0x3E,0x7C,0x80,                                                     /* 0x31 A */
+  0x46,0xFE,0x03,0x02,0x04,0xE0,0x09,0x11,0x12,0x73,0x12,0xE0,0x09,0x13,0x08,0xE0,
+  0x13,0x11,0x24,0x97,0x24,0xE0,0x13,0x02,0x08,0xFE,0x07,0x80,                       /* 0x32 B */
+  0x4A,0xE0,0x07,0x10,0x28,0xC8,0x17,0x24,0x08,0x12,0x30,0xF0,0x42,0x30,0x12,0x18,
+  0x24,0x28,0xC8,0x17,0x10,0x08,0xE0,0x07,0x80,                                      /* 0x33 C */
+  0x46,0xFE,0x03,0x02,0x04,0xE0,0x08,0x11,0x11,0x11,0x22,0x11,0x04,0xF0,0x21,0x24,
+  0x11,0x02,0x17,0x11,0xE0,0x08,0x02,0x04,0xFE,0x03,0x80,                            /* 0x34 D */
+  0x43,0xFE,0x3F,0x02,0x12,0xE0,0x0F,0x11,0x10,0x11,0x20,0x53,0x04,0xE0,0x03,0x22,
+  0xE0,0x03,0x11,0x04,0x71,0x20,0x14,0x10,0xE0,0x0F,0x02,0x12,0xFE,0x3F,0x80,        /* 0x35 E */
+  0x43,0xFE,0x3F,0x02,0x12,0xE0,0x0F,0x11,0x10,0x11,0x20,0x53,0x04,0xE0,0x03,0x22,
+  0xE0,0x03,0x11,0x04,0xC1,0x22,0x11,0x3E,0x90,                                      /* 0x36 F */
+  0x47,0xE0,0x2F,0x10,0x10,0xC8,0x0F,0x24,0x12,0x12,0x30,0xB1,0x3E,0x31,0x06,0x11,
+  0x08,0x21,0x12,0x18,0x24,0x08,0xC8,0x07,0x10,0x20,0xE0,0x1F,0x80,                  /* 0x37 G */
+  0x44,0x3E,0x7C,0x22,0x44,0xC2,0xE0,0x07,0x22,0xE0,0x07,0xE4,0x22,0x44,0x3E,0x7C,
+  0x80,                                                                              /* 0x38 H */
+  0x46,0xF8,0x0F,0x08,0x08,0x30,0x06,0xF0,0xD6,0x30,0x06,0x08,0x08,0xF8,0x0F,0x80,   /* 0x39 I */
+  0x44,0x80,0x3F,0x80,0x31,0xF0,0x91,0x0C,0x38,0x10,0x09,0xE4,0x04,0x08,0x02,0xF0,
+  0x01,0x80,                                                                         /* 0x3a J */
+  0x44,0x1E,0x78,0x02,0x40,0x31,0x20,0x11,0x04,0x11,0x12,0x17,0x09,0x80,0x04,0x40,
+  0x02,0x20,0x01,0x15,0x01,0x40,0x02,0xA0,0x04,0x11,0x09,0x11,0x12,0x11,0x04,0x11,
+  0x20,0x24,0x02,0x40,0x1E,0x78,0x80,                                                /* 0x3b K */
+  0x41,0x3E,0x11,0x22,0xF0,0xD1,0x20,0x14,0x10,0xE0,0x0F,0x02,0x12,0xFE,0x3F,0x80,   /* 0x3c L */
+  0x44,0x1E,0x78,0x02,0x40,0x22,0x20,0x04,0x22,0x40,0x02,0x22,0xA0,0x05,0x22,0x40,
+  0x02,0x42,0x80,0x01,0xA4,0x22,0x44,0x3E,0x7C,0x80,                                 /* 0x3d M */
+  0x44,0x1E,0x78,0x02,0x40,0x21,0x20,0x31,0x40,0x31,0xA0,0x32,0x40,0x01,0x22,0x80,
+  0x02,0x31,0x05,0x31,0x02,0x35,0x04,0x02,0x40,0x1E,0x78,0x80,                       /* 0x3e N */
+  0x4A,0xE0,0x07,0x10,0x08,0xC8,0x13,0x20,0x04,0x04,0x20,0xF0,0x5A,0x04,0x20,0x20,
+  0x04,0xC8,0x13,0x10,0x08,0xE0,0x07,0x80,                                           /* 0x3f O */
+  0x46,0xFE,0x07,0x02,0x08,0xE0,0x13,0x11,0x24,0x93,0x24,0xE0,0x13,0x13,0x08,0xE0,
+  0x07,0xC1,0x22,0x11,0x3E,0x90,                                                     /* 0x40 P */
+  0x4A,0xE0,0x07,0x10,0x08,0xC8,0x13,0x20,0x04,0x04,0x20,0xF0,0x4B,0x02,0x04,0x24,
+  0x20,0x02,0xC8,0x03,0x10,0x28,0xE0,0x07,0x11,0x30,0x60,                            /* 0x41 Q */
+  0x46,0xFE,0x07,0x02,0x08,0xE0,0x13,0x11,0x24,0x93,0x24,0xE0,0x13,0x15,0x08,0x60,
+  0x04,0x80,0x04,0x11,0x09,0x11,0x12,0x11,0x04,0x11,0x20,0x24,0x22,0x48,0x3E,0x70,
+  0x80,                                                                              /* 0x42 R */
+  0x47,0xE0,0x07,0x10,0x08,0xC8,0x17,0x24,0x21,0x18,0x41,0x24,0x16,0xC8,0x07,0x10,
+  0x08,0xE0,0x13,0x11,0x24,0x61,0x0C,0x27,0x24,0xF4,0x13,0x08,0x08,0xF0,0x07,0x80,   /* 0x43 S */
+  0x42,0xFE,0x3F,0x26,0x38,0x0E,0x04,0x10,0x02,0x20,0xF0,0xB4,0x20,0x02,0xE0,0x03,
+  0x80,                                                                              /* 0x44 T */
+  0x44,0x3E,0x7C,0x22,0x44,0xF0,0xBA,0x04,0x20,0x20,0x04,0xC8,0x13,0x10,0x08,0xE0,
+  0x07,0x80,                                                                         /* 0x45 U */
+  0x44,0x3E,0x7C,0x22,0x44,0xF0,0x9C,0x24,0x24,0x48,0x12,0x90,0x09,0x20,0x04,0x40,
+  0x02,0x80,0x01,0x80,                                                               /* 0x46 V */
+  0x44,0x3E,0x7C,0x22,0x44,0x22,0x80,0x01,0xF0,0x7A,0x40,0x02,0x24,0x24,0x80,0x01,
+  0x48,0x12,0x30,0x0C,0x80,                                                          /* 0x47 W */
+  0x44,0x1E,0x3C,0x02,0x20,0xA4,0x24,0x12,0xC8,0x09,0x24,0xC8,0x09,0x24,0x12,0xC4,
+  0x02,0x20,0x1E,0x3C,0x80,                                                          /* 0x48 X */
+  0x44,0x3E,0x3E,0x22,0x22,0xE8,0x24,0x12,0xC8,0x09,0x10,0x04,0x20,0x02,0xA4,0x20,
+  0x02,0xE0,0x03,0x80,                                                               /* 0x49 Y */
+  0x42,0xFC,0x3F,0x23,0xF8,0x07,0x04,0x61,0x24,0x11,0x12,0x18,0x09,0x80,0x04,0x40,
+  0x02,0x20,0x01,0x90,0x11,0x48,0x11,0x24,0x43,0x20,0xE0,0x1F,0x22,0xFC,0x3F,0x80,   /* 0x4a Z */
+  0x42,0xC0,0x0F,0x31,0x0E,0xF0,0xF0,0x51,0x0E,0x22,0xC0,0x0F,0x20,                  /* 0x4b [ */
+  0x41,0x04,0x11,0x08,0x31,0x14,0x31,0x28,0x31,0x50,0x31,0xA0,0x32,0x40,0x01,0x22,
+  0x80,0x02,0x31,0x05,0x31,0x0A,0x31,0x14,0x31,0x08,0x11,0x10,0x20,                  /* 0x4c \ */
+  0x42,0xF8,0x01,0x21,0x38,0xF0,0xF0,0x51,0x38,0x32,0xF8,0x01,0x20,                  /* 0x4d ] */
+  0x8F,0x80,0x01,0x40,0x02,0x20,0x04,0x90,0x09,0x48,0x12,0x24,0x24,0x10,0x08,0x0C,
+  0x01,0x30,0xF0,0xD0,                                                               /* 0x4e ^ */
+  0xF0,0xF0,0xC2,0xFF,0xFF,0x22,0xFF,0xFF,0x40,                                      /* 0x4f _ */
+  0x46,0xC0,0x01,0x40,0x02,0x80,0x04,0x11,0x07,0xF0,0xF0,0xA0,                       /* 0x50 ` */
+  0xE8,0xE0,0x07,0x18,0x18,0xE0,0x03,0x18,0x24,0x26,0xF0,0x03,0x08,0x04,0xE4,0x03,
+  0x11,0x04,0x57,0x04,0xE4,0x4B,0x08,0x04,0xF0,0x73,0x80,                            /* 0x51 a */
+  0x41,0x3E,0x11,0x22,0x79,0x80,0x07,0x40,0x18,0xA0,0x03,0x40,0x24,0x20,0xD8,0x20,
+  0x24,0xC0,0x03,0x22,0x18,0xDE,0x07,0x80,                                           /* 0x52 b */
+  0xEA,0xC0,0x07,0x30,0x18,0x88,0x23,0x40,0x0C,0x24,0x30,0xAA,0x24,0x30,0x40,0x0C,
+  0x88,0x23,0x30,0x18,0xC0,0x07,0x80,                                                /* 0x53 c */
+  0x51,0x7C,0x11,0x44,0x68,0xE0,0x01,0x18,0x02,0xC0,0x05,0x24,0x02,0x11,0x04,0xC8,
+  0x24,0x04,0xC0,0x03,0x18,0x44,0xE0,0x7B,0x80,                                      /* 0x54 d */
+  0xEA,0xC0,0x07,0x30,0x08,0xC8,0x13,0x20,0x04,0x04,0x20,0x22,0xE0,0x07,0x22,0xE0,
+  0x3F,0x2A,0x24,0x30,0x40,0x08,0x88,0x27,0x30,0x18,0xC0,0x07,0x80,                  /* 0x55 e */
+  0x55,0x0F,0x80,0x10,0x40,0x24,0x11,0x0A,0x11,0x30,0x42,0x30,0x06,0x22,0x30,0x06,
+  0xE6,0x20,0x02,0x10,0x04,0xF0,0x07,0x80,                                           /* 0x56 f */
+  0xE9,0xC0,0x7B,0x30,0x44,0x88,0x03,0x40,0x04,0x24,0xB8,0x24,0x04,0xC0,0x03,0x18,
+  0x04,0xE0,0x03,0x28,0x18,0x24,0xE0,0x13,0x08,0x08,0xF0,0x07,                       /* 0x57 g */
+  0x41,0x3E,0x11,0x22,0x79,0x80,0x07,0x40,0x18,0xA0,0x03,0x40,0x24,0x20,0xF0,0x24,
+  0x22,0x44,0x3E,0x7C,0x80,                                                          /* 0x58 h */
+  0x42,0xC0,0x01,0x42,0xC0,0x01,0x23,0xE0,0x01,0x10,0x11,0x30,0xF0,0x64,0x20,0x02,
+  0xE0,0x03,0x80,                                                                    /* 0x59 i */
+  0x51,0x0E,0x51,0x0E,0x32,0x0F,0x80,0x12,0x80,0x01,0xF0,0x51,0x0C,0x47,0x09,0xF4,
+  0x04,0x08,0x02,0xF0,0x01,                                                          /* 0x5a j */
+  0x41,0x3E,0x11,0x22,0x81,0x38,0x11,0x24,0x11,0x12,0x17,0x09,0x80,0x04,0x40,0x02,
+  0x20,0x01,0x15,0x01,0x60,0x02,0x80,0x04,0x11,0x09,0x11,0x12,0x15,0x24,0x22,0x48,
+  0x3E,0x70,0x80,                                                                    /* 0x5b k */
+  0x43,0xC0,0x03,0x20,0x11,0x60,0xF0,0xF0,0x14,0x40,0x04,0xC0,0x07,0x80,             /* 0x5c l */
+  0xE8,0xDE,0x0D,0x22,0x12,0x40,0x24,0x20,0x02,0xF0,0x34,0x02,0x40,0x9E,0x79,0x80,   /* 0x5d m */
+  0xE7,0x9E,0x0F,0x42,0x10,0xA0,0x27,0x40,0x11,0x20,0xF0,0x24,0x22,0x44,0x3E,0x7C,
+  0x80,                                                                              /* 0x5e n */
+  0xEA,0xE0,0x07,0x10,0x08,0xC8,0x13,0x20,0x04,0x04,0x20,0xAA,0x04,0x20,0x20,0x04,
+  0xC8,0x13,0x10,0x08,0xE0,0x07,0x80,                                                /* 0x5f o */
+  0xE8,0xDE,0x07,0x22,0x08,0x80,0x13,0x60,0x04,0x11,0x20,0xB9,0x20,0x60,0x04,0x80,
+  0x13,0x20,0x08,0xC0,0x07,0x41,0x22,0x11,0x3E,0x10,                                 /* 0x60 p */
+  0xE9,0xE0,0x7B,0x10,0x44,0xC8,0x01,0x20,0x06,0x04,0xB1,0x04,0x18,0x20,0x06,0xC8,
+  0x01,0x10,0x04,0xE0,0x03,0x51,0x44,0x11,0x7C,                                      /* 0x61 q */
+  0xEA,0x3C,0x1F,0x84,0x20,0x40,0x07,0x80,0x08,0x40,0x30,0xF0,0x11,0x44,0x11,0x7C,
+  0x90,                                                                              /* 0x62 r */
+  0xE8,0xE0,0x0F,0x10,0x10,0x88,0x0F,0x40,0x10,0x28,0xC8,0x01,0x10,0x06,0x60,0x18,
+  0x80,0x23,0x11,0x04,0x28,0x18,0x24,0xE0,0x13,0x08,0x08,0xF0,0x07,0x80,             /* 0x63 s */
+  0x41,0xE0,0x92,0x1C,0x0F,0x22,0x1C,0x0F,0xF0,0x27,0x18,0x20,0x07,0x40,0x10,0x80,
+  0x0F,0x80,                                                                         /* 0x64 t */
+  0xE4,0x3E,0x7C,0x22,0x44,0xF1,0x04,0x19,0x02,0x24,0x01,0xC8,0x04,0x10,0x42,0xE0,
+  0x79,0x80,                                                                         /* 0x65 u */
+  0xE4,0x1E,0x78,0x02,0x40,0xEC,0x24,0x24,0x48,0x12,0x90,0x09,0x20,0x04,0x40,0x02,
+  0x80,0x01,0x80,                                                                    /* 0x66 v */
+  0xE4,0x1E,0x78,0x02,0x40,0x22,0x80,0x01,0xCA,0x40,0x02,0x24,0x24,0x80,0x01,0x48,
+  0x12,0x30,0x0C,0x80,                                                               /* 0x67 w */
+  0xE4,0x1E,0x3C,0x02,0x20,0x64,0x24,0x12,0xC8,0x09,0x24,0xC8,0x09,0x24,0x12,0x64,
+  0x02,0x20,0x1E,0x3C,0x80,                                                          /* 0x68 x */
+  0xE4,0x3E,0x7C,0x22,0x44,0xF0,0x19,0x24,0x04,0xC8,0x03,0x10,0x04,0xE0,0x03,0x0C,
+  0x36,0xF4,0x27,0x08,0x10,0xF0,0x0F,                                                /* 0x69 y */
+  0xE2,0xFC,0x3F,0x24,0xF8,0x07,0x04,0x24,0x11,0x12,0x18,0x09,0x80,0x04,0x40,0x02,
+  0x20,0x01,0x90,0x11,0x48,0x14,0x24,0x20,0xE0,0x1F,0x22,0xFC,0x3F,0x80,             /* 0x6a z */
+  0x75,0x0F,0x80,0x08,0x40,0x06,0xA3,0x20,0x01,0x90,0x11,0x48,0x11,0x48,0x11,0x90,
+  0x12,0x20,0x01,0xA4,0x40,0x06,0x80,0x08,0x11,0x0F,0x20,                            /* 0x6b { */
+  0x42,0x80,0x01,0xF0,0xF0,0xC2,0x80,0x01,0x20,                                      /* 0x6c | */
+  0x61,0xF0,0x14,0x10,0x01,0x60,0x02,0xA2,0x80,0x04,0x11,0x09,0x11,0x12,0x11,0x12,
+  0x13,0x09,0x80,0x04,0xA5,0x60,0x02,0x10,0x01,0xF0,0x30,                            /* 0x6d } */
+  0xF0,0x92,0xFF,0xFF,0x22,0xFF,0xFF,0xF0,0x70,                                      /* 0x6e ~ */
+  0x46,0xC0,0x03,0xA0,0x05,0x50,0x0A,0x46,0x50,0x0A,0xA0,0x05,0xC0,0x03,0xF0,0xF0,
+  0x20,                                                                              /* 0x6f o   */
+
+  /* cyrillic characters */
+  0x43,0xFE,0x3F,0x02,0x12,0xE0,0x0F,0x11,0x10,0x11,0x20,0x62,0xE0,0x07,0x13,0x08,
+  0xE0,0x13,0x11,0x24,0x97,0x24,0xE0,0x13,0x02,0x08,0xFE,0x07,0x80,                  /* 0x70 '' Cyr_B */
+  0x43,0xFE,0x3F,0x02,0x12,0xE0,0x0F,0x11,0x10,0x11,0x20,0xF0,0xB1,0x22,0x11,0x3E,
+  0x90,                                                                              /* 0x71 '' Cyr_G */
+  0x42,0x30,0x06,0x25,0x30,0x06,0xFE,0x3F,0x02,0x12,0xE0,0x0F,0x11,0x10,0x11,0x20,
+  0x13,0x02,0xE0,0x01,0x22,0xE0,0x01,0x11,0x02,0x51,0x20,0x14,0x10,0xE0,0x0F,0x02,
+  0x12,0xFE,0x3F,0x80,                                                               /* 0x72 '' Cyr_Jo */
+  0x44,0x9E,0x79,0x02,0x40,0xA4,0x04,0x20,0x68,0x16,0x24,0x68,0x16,0x04,0x20,0xC4,
+  0x02,0x40,0x9E,0x79,0x80,                                                          /* 0x73 '' Cyr_Zsch */
+  0x49,0xF4,0x07,0x08,0x08,0xF0,0x13,0x08,0x24,0x04,0x63,0x24,0xE0,0x13,0x22,0xE0,
+  0x13,0x11,0x24,0x61,0x0C,0x27,0x24,0xF4,0x13,0x08,0x08,0xF0,0x07,0x80,             /* 0x74 '' Cyr_Z */
+  0x44,0x1E,0x78,0x02,0x40,0x31,0x04,0x31,0x02,0x31,0x05,0x22,0x80,0x02,0x23,0x40,
+  0x01,0x20,0x11,0x80,0x31,0x40,0x11,0x20,0x34,0x02,0x40,0x1E,0x78,0x80,             /* 0x75 '' Cyr_I */
+  0x46,0xDE,0x7B,0x42,0x42,0x80,0x01,0x11,0x04,0x31,0x02,0x31,0x05,0x22,0x80,0x02,
+  0x22,0x40,0x01,0x21,0xA0,0x31,0x40,0x31,0x20,0x14,0x02,0x40,0x1E,0x78,0x80,        /* 0x76 '' Cyr_J */
+  0x43,0xC0,0x3F,0x20,0x13,0x90,0x07,0x48,0xF0,0xC1,0x24,0x14,0x12,0x44,0x0E,0x7C,
+  0x80,                                                                              /* 0x77 '' Cyr_L */
+  0x46,0xFE,0x7F,0x02,0x40,0xE0,0x07,0xF0,0xF4,0x22,0x44,0x3E,0x7C,0x80,             /* 0x78 '' Cyr_P */
+  0x44,0x3E,0x7C,0x22,0x44,0xC8,0x20,0x04,0xC4,0x03,0x08,0x04,0xF0,0x03,0x61,0x04,
+  0x18,0x08,0x24,0xF4,0x13,0x08,0x08,0xF0,0x07,0x80,                                 /* 0x79 '' Cyr_U */
+  0x44,0xC0,0x03,0x40,0x02,0x26,0x70,0x0E,0x08,0x10,0x64,0x26,0xF0,0x16,0x64,0x26,
+  0x08,0x10,0x70,0x0E,0x24,0x40,0x02,0xC0,0x03,0x80,                                 /* 0x7a '' Cyr_F */
+  0x44,0x1E,0x78,0x02,0x40,0xE1,0x24,0x13,0xC0,0x07,0x08,0x12,0xF0,0x07,0xB1,0x44,
+  0x11,0x7C,0x80,                                                                    /* 0x7b '' Cyr_Tsch */
+  0x44,0x3E,0x7C,0x22,0x44,0x22,0x80,0x01,0xF0,0xB6,0x60,0x06,0x02,0x40,0xFE,0x7F,
+  0x80,                                                                              /* 0x7c '' Cyr_Sch */
+  0x41,0x7E,0x31,0x08,0x11,0x04,0x11,0x02,0x52,0x80,0x07,0x13,0x08,0x80,0x13,0x11,
+  0x24,0xB7,0x24,0x80,0x13,0x08,0x08,0xF8,0x07,0x80,                                 /* 0x7d '' Cyr_HH */
+  0x44,0x3E,0x7C,0x22,0x44,0xC2,0xE0,0x01,0x13,0x0A,0xE0,0x04,0x11,0x01,0x97,0x01,
+  0xE0,0x04,0x02,0x4A,0xFE,0x79,0x80,                                                /* 0x7e '' Cyr_Y */
+  0x48,0xF0,0x07,0x08,0x08,0xE4,0x13,0x10,0x24,0x21,0x0C,0x31,0x40,0x12,0x80,0x07,
+  0x23,0x80,0x07,0x40,0x71,0x0C,0x18,0x10,0x24,0xE4,0x13,0x08,0x08,0xF0,0x07,0x80,   /* 0x7f '' Cyr_E */
+  0x44,0x1E,0x0F,0x82,0x10,0x11,0x26,0xA1,0x60,0x31,0x60,0xD6,0x80,0x26,0x22,0x11,
+  0x3E,0x0E,0x80,                                                                    /* 0x80 '' Cyr_Ju */
+  0x47,0xE0,0x7F,0x10,0x40,0xC8,0x07,0x24,0x91,0x24,0x13,0xC8,0x07,0x10,0x15,0x20,
+  0x06,0x20,0x01,0x90,0x11,0x48,0x11,0x20,0x11,0x04,0x34,0x12,0x44,0x0E,0x7C,0x80,   /* 0x81 '' Cyr_Ja */
+  0x57,0x1C,0xF0,0x13,0x08,0x08,0xE4,0x07,0x48,0xC0,0x07,0x20,0x08,0xC0,0x13,0x20,
+  0x24,0xA1,0x04,0x18,0x20,0x24,0xC8,0x13,0x10,0x08,0xE0,0x07,0x80,                  /* 0x82 '' Cyr_b */
+  0xEC,0xDE,0x07,0x22,0x08,0xC0,0x13,0x20,0x04,0x20,0x04,0xC0,0x13,0x24,0xC0,0x13,
+  0x20,0x24,0x48,0x20,0x04,0xC0,0x23,0x22,0x18,0xDE,0x07,0x80,                       /* 0x83 '' Cyr_v */
+  0xE3,0xFE,0x3F,0x02,0x12,0xE0,0x0F,0x11,0x10,0x11,0x20,0xF0,0x11,0x22,0x11,0x3E,
+  0x90,                                                                              /* 0x84 '' Cyr_g */
+  0x62,0x60,0x06,0x22,0x60,0x06,0x2A,0xC0,0x07,0x30,0x08,0xC8,0x13,0x20,0x04,0x04,
+  0x20,0x22,0xE0,0x07,0x22,0xE0,0x3F,0x2A,0x04,0x30,0x20,0x08,0xC8,0x27,0x30,0x18,
+  0xC0,0x07,0x80,                                                                    /* 0x85 '' Cyr_jo */
+  0xE4,0x9E,0x79,0x02,0x40,0x64,0x04,0x20,0x68,0x16,0x24,0x68,0x16,0x04,0x20,0x64,
+  0x02,0x40,0x9E,0x79,0x80,                                                          /* 0x86 '' Cyr_zsch */
+  0xE8,0xF8,0x07,0x04,0x18,0xF0,0x23,0x0C,0x04,0x33,0x24,0xC0,0x13,0x22,0xC0,0x13,
+  0x11,0x24,0x28,0x0C,0x04,0xF0,0x23,0x04,0x10,0xF8,0x0F,0x80,                       /* 0x87 '' Cyr_z */
+  0xE4,0x1E,0x78,0x02,0x44,0x31,0x02,0x11,0x04,0x11,0x01,0x12,0x02,0x80,0x22,0x01,
+  0x40,0x11,0x80,0x11,0x20,0x11,0x40,0x14,0x02,0x40,0x3E,0x78,0x80,                  /* 0x88 '' Cyr_i */
+  0x8A,0xC0,0x03,0x40,0x02,0x80,0x01,0x1E,0x78,0x02,0x44,0x31,0x02,0x11,0x04,0x11,
+  0x01,0x12,0x02,0x80,0x22,0x01,0x40,0x11,0x80,0x11,0x20,0x11,0x40,0x14,0x02,0x40,
+  0x3E,0x78,0x80,                                                                    /* 0x89 '' Cyr_j */
+  0xE4,0x3E,0x38,0x22,0x24,0x11,0x12,0x17,0x09,0x80,0x04,0x40,0x02,0x20,0x01,0x15,
+  0x01,0x60,0x02,0x80,0x04,0x11,0x09,0x11,0x12,0x12,0x24,0x22,0x12,0x3E,0x38,0x80,   /* 0x8a '' Cyr_k */
+  0xE6,0xF8,0x7F,0x08,0x40,0x80,0x07,0xF0,0x31,0x4C,0x14,0x22,0x44,0x1E,0x7C,0x80,   /* 0x8b '' Cyr_l */
+  0xE4,0x1E,0x78,0x22,0x44,0x22,0x40,0x02,0x22,0xA0,0x05,0x22,0x40,0x02,0x22,0x80,
+  0x01,0x64,0x22,0x44,0x3E,0x7C,0x80,                                                /* 0x8c '' Cyr_m */
+  0xE4,0x3E,0x7C,0x22,0x44,0x82,0xE0,0x07,0x22,0xE0,0x07,0x84,0x22,0x44,0x3E,0x7C,
+  0x80,                                                                              /* 0x8d '' Cyr_n */
+  0xE6,0xFE,0x7F,0x02,0x40,0xE0,0x07,0xF0,0x54,0x22,0x44,0x3E,0x7C,0x80,             /* 0x8e '' Cyr_p */
+  0xE2,0xFE,0x3F,0x24,0x3C,0x1E,0x02,0x20,0xF0,0x34,0x20,0x02,0xE0,0x03,0x80,        /* 0x8f '' Cyr_t */
+  0xE4,0x1E,0x78,0x02,0x40,0xA3,0xE4,0x07,0x08,0x12,0xF0,0x07,0x71,0x44,0x11,0x7C,
+  0x80,                                                                              /* 0x90 '' Cyr_tsch */
+  0xE6,0x1E,0x78,0x02,0x40,0x80,0x01,0xF0,0x36,0x60,0x06,0x02,0x40,0xFE,0x7F,0x80,   /* 0x91 '' Cyr_sch */
+  0xE1,0x7E,0x31,0x08,0x11,0x04,0x12,0x82,0x0F,0x13,0x10,0x80,0x23,0x11,0x04,0x77,
+  0x04,0x80,0x23,0x08,0x18,0xF8,0x07,0x80,                                           /* 0x92 '' Cyr_hh */
+  0xE4,0x3E,0x78,0x22,0x40,0x42,0xE0,0x01,0x13,0x0A,0xE0,0x04,0x11,0x01,0x77,0x01,
+  0xE0,0x04,0x02,0x4A,0xFE,0x79,0x80,                                                /* 0x93 '' Cyr_y */
+  0xE1,0x3E,0x11,0x22,0x52,0xE0,0x07,0x13,0x08,0xE0,0x13,0x11,0x24,0x77,0x24,0xE0,
+  0x13,0x02,0x08,0xFE,0x07,0x80,                                                     /* 0x94 '' Cyr_ww */
+  0xEA,0xE0,0x03,0x18,0x0C,0xE4,0x13,0x10,0x04,0x0C,0x20,0x22,0xC0,0x07,0x22,0xC0,
+  0x07,0x2A,0x0C,0x20,0x10,0x04,0xE4,0x13,0x18,0x0C,0xE0,0x03,0x80,                  /* 0x95 '' Cyr_e */
+  0xE6,0x1E,0x0E,0x02,0x11,0x80,0x26,0x61,0x60,0x31,0x60,0x76,0x80,0x26,0x02,0x11,
+  0x1E,0x0E,0x80,                                                                    /* 0x96 '' Cyr_ju */
+  0xE6,0xF0,0x7F,0x08,0x40,0xE4,0x07,0x63,0xE4,0x07,0x08,0x17,0x70,0x04,0x40,0x02,
+  0x20,0x01,0x90,0x11,0x48,0x14,0x24,0x44,0x1C,0x7C,0x80,                            /* 0x97 '' Cyr_ja */
+  0x47,0xC0,0x7F,0x20,0x40,0x90,0x07,0x48,0x11,0x24,0xF0,0xAC,0xE0,0x07,0x02,0x40,
+  0xF0,0x0F,0x08,0x10,0x04,0x20,0x02,0x40,0x20,                                      /* 0x98 '' Cyr_D */
+  0x44,0x3E,0x7C,0x22,0x44,0xF0,0xF2,0xE0,0x07,0x13,0x40,0xFC,0x0F,0x11,0x10,0x11,
+  0x20,0x11,0x40,0x20,                                                               /* 0x99 '' Cyr_C */
+  0x44,0x3E,0x7C,0x22,0x44,0x22,0x80,0x01,0xF0,0xB2,0x60,0x06,0x13,0x40,0xFC,0x0F,
+  0x11,0x10,0x11,0x20,0x11,0x40,0x20,                                                /* 0x9a '' Cyr_Schtsch */
+  0xE7,0xC0,0x7F,0x20,0x40,0x90,0x07,0x48,0x11,0x24,0xFC,0xE0,0x07,0x02,0x40,0xF0,
+  0x0F,0x08,0x10,0x04,0x20,0x02,0x40,0x20,                                           /* 0x9b '' Cyr_d */
+  0xE4,0xC0,0x03,0x40,0x02,0x26,0x70,0x0E,0x08,0x10,0x64,0x26,0xC6,0x64,0x26,0x08,
+  0x10,0x70,0x0E,0x24,0x40,0x02,0xC0,0x03,0x20,                                      /* 0x9c '' Cyr_f */
+  0xE4,0x1E,0x78,0x02,0x40,0xF0,0x52,0xE0,0x07,0x13,0x40,0xFC,0x0F,0x11,0x10,0x11,
+  0x20,0x11,0x40,0x20,                                                               /* 0x9d '' Cyr_c */
+  0xE6,0x1E,0x78,0x02,0x40,0x80,0x01,0xF0,0x32,0x60,0x06,0x13,0x40,0xFC,0x0F,0x11,
+  0x10,0x11,0x20,0x11,0x40,0x20                                                      /* 0x9e '' Cyr_schtsch */
+
+  #ifdef FONT_EXTRA
+  ,
+  /* extra characters */
+  0x22,0xFE,0x7F,0x23,0x80,0x03,0x40,0x11,0x20,0x11,0x10,0x11,0x70,0xF0,0x62,0x70,
+  0x1C,0x22,0xF0,0x1F,0x22,0xFE,0x7F,0x60,                                           /* 0x9f 1 (reversed color) */
+  0x22,0xFE,0x7F,0x28,0xE0,0x03,0x10,0x04,0xC8,0x09,0x20,0x12,0x21,0x18,0x41,0x12,
+  0x18,0x09,0x80,0x04,0x40,0x02,0x20,0x01,0x90,0x11,0x48,0x32,0xC0,0x1F,0x22,0xF8,
+  0x1F,0x22,0xFE,0x7F,0x60,                                                          /* 0xa0 2 (reversed color) */
+  0x22,0xFE,0x7F,0x28,0xE0,0x07,0x10,0x08,0xC8,0x11,0x20,0x02,0x21,0x18,0x23,0x12,
+  0xC0,0x09,0x22,0xC0,0x09,0x11,0x12,0x21,0x18,0x38,0x20,0x02,0xC8,0x11,0x10,0x08,
+  0xE0,0x07,0x22,0xFE,0x7F,0x60,                                                     /* 0xa1 3 (reversed color) */
+  0xA6,0xFF,0x7F,0x1E,0x3C,0x02,0x20,0x64,0x24,0x12,0xC8,0x09,0x24,0xC8,0x09,0x24,
+  0x12,0x66,0x02,0x20,0x1E,0x3C,0xFF,0x7F,0x80,                                      /* 0xa2 x (reversed color) */
+  0xA2,0xFF,0xFF,0x22,0xFC,0xFF,0xF0,0x72,0xFC,0xFF,0x22,0xFF,0xFF,0x80,             /* 0xa3 symbol: battery left side, low */
+  0xA2,0xFF,0xFF,0x22,0xFC,0xFF,0x22,0xF0,0x3F,0xE2,0xF0,0x3F,0x22,0xFC,0xFF,0x22,
+  0xFF,0xFF,0x80,                                                                    /* 0xa4 symbol: battery left side, high */
+  0xA2,0xFF,0x3F,0x22,0xFF,0x0F,0x31,0xC0,0x31,0x30,0x71,0x30,0x31,0xC0,0x22,0xFF,
+  0x0F,0x22,0xFF,0x3F,0x80,                                                          /* 0xa5 symbol: battery right side, low */
+  0xA2,0xFF,0x3F,0x22,0xFF,0x0F,0x22,0xFF,0xC3,0x31,0x30,0x71,0x30,0x22,0xFF,0xC3,
+  0x22,0xFF,0x0F,0x22,0xFF,0x3F,0x80                                                 /* 0xa6 symbol: battery right side, high */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed characters in FontData[]
+ */
+
+const uint16_t FontIndex[] PROGMEM = {
+  0,        /* 0x00 n/a */
+  4,        /* 0x01 symbol: diode A-C */
+  46,       /* 0x02 symbol: diode C-A */
+  88,       /* 0x03 symbol: capacitor */
+  103,      /* 0x04 omega */
+  135,      /* 0x05  (micro) */
+  158,      /* 0x06 symbol: resistor left side */
+  175,      /* 0x07 symbol: resistor right side */
+  192,      /* 0x08  */
+  217,      /* 0x09  */
+  237,      /* 0x0a  */
+  259,      /* 0x0b  */
+  291,      /* 0x0c  */
+  315,      /* 0x0d  */
+  335,      /* 0x0e  */
+  357,      /* 0x0f  */
+  384,      /* 0x10 space */
+  388,      /* 0x11 ! */
+  402,      /* 0x12 " */
+  414,      /* 0x13 # */
+  441,      /* 0x14 $ */
+  484,      /* 0x15 % */
+  524,      /* 0x16 & */
+  562,      /* 0x17 ' */
+  574,      /* 0x18 ( */
+  603,      /* 0x19 ) */
+  632,      /* 0x1a * */
+  664,      /* 0x1b + */
+  677,      /* 0x1c , */
+  691,      /* 0x1d - */
+  700,      /* 0x1e . */
+  709,      /* 0x1f / */
+  738,      /* 0x20 0 */
+  758,      /* 0x21 1 */
+  777,      /* 0x22 2 */
+  812,      /* 0x23 3 */
+  844,      /* 0x24 4 */
+  873,      /* 0x25 5 */
+  900,      /* 0x26 6 */
+  928,      /* 0x27 7 */
+  950,      /* 0x28 8 */
+  979,      /* 0x29 9 */
+  1007,     /* 0x2a : */
+  1020,     /* 0x2b ; */
+  1037,     /* 0x2c < */
+  1066,     /* 0x2d = */
+  1081,     /* 0x2e > */
+  1110,     /* 0x2f ? */
+  1141,     /* 0x30 @ */
+  1172,     /* 0x31 A */
+  1194,     /* 0x32 B */
+  1222,     /* 0x33 C */
+  1247,     /* 0x34 D */
+  1274,     /* 0x35 E */
+  1305,     /* 0x36 F */
+  1330,     /* 0x37 G */
+  1359,     /* 0x38 H */
+  1376,     /* 0x39 I */
+  1392,     /* 0x3a J */
+  1410,     /* 0x3b K */
+  1449,     /* 0x3c L */
+  1465,     /* 0x3d M */
+  1491,     /* 0x3e N */
+  1519,     /* 0x3f O */
+  1543,     /* 0x40 P */
+  1565,     /* 0x41 Q */
+  1592,     /* 0x42 R */
+  1625,     /* 0x43 S */
+  1657,     /* 0x44 T */
+  1674,     /* 0x45 U */
+  1692,     /* 0x46 V */
+  1712,     /* 0x47 W */
+  1733,     /* 0x48 X */
+  1754,     /* 0x49 Y */
+  1774,     /* 0x4a Z */
+  1806,     /* 0x4b [ */
+  1819,     /* 0x4c \ */
+  1848,     /* 0x4d ] */
+  1861,     /* 0x4e ^ */
+  1881,     /* 0x4f _ */
+  1890,     /* 0x50 ` */
+  1902,     /* 0x51 a */
+  1929,     /* 0x52 b */
+  1953,     /* 0x53 c */
+  1976,     /* 0x54 d */
+  2001,     /* 0x55 e */
+  2030,     /* 0x56 f */
+  2054,     /* 0x57 g */
+  2082,     /* 0x58 h */
+  2103,     /* 0x59 i */
+  2122,     /* 0x5a j */
+  2143,     /* 0x5b k */
+  2178,     /* 0x5c l */
+  2192,     /* 0x5d m */
+  2208,     /* 0x5e n */
+  2225,     /* 0x5f o */
+  2248,     /* 0x60 p */
+  2274,     /* 0x61 q */
+  2299,     /* 0x62 r */
+  2316,     /* 0x63 s */
+  2346,     /* 0x64 t */
+  2364,     /* 0x65 u */
+  2382,     /* 0x66 v */
+  2401,     /* 0x67 w */
+  2421,     /* 0x68 x */
+  2442,     /* 0x69 y */
+  2465,     /* 0x6a z */
+  2495,     /* 0x6b { */
+  2522,     /* 0x6c | */
+  2531,     /* 0x6d } */
+  2558,     /* 0x6e ~ */
+  2567,     /* 0x6f o   */
+  2584,     /* 0x70 '' Cyr_B */
+  2613,     /* 0x71 '' Cyr_G */
+  2630,     /* 0x72 '' Cyr_Jo */
+  2666,     /* 0x73 '' Cyr_Zsch */
+  2687,     /* 0x74 '' Cyr_Z */
+  2717,     /* 0x75 '' Cyr_I */
+  2747,     /* 0x76 '' Cyr_J */
+  2778,     /* 0x77 '' Cyr_L */
+  2795,     /* 0x78 '' Cyr_P */
+  2809,     /* 0x79 '' Cyr_U */
+  2835,     /* 0x7a '' Cyr_F */
+  2861,     /* 0x7b '' Cyr_Tsch */
+  2880,     /* 0x7c '' Cyr_Sch */
+  2897,     /* 0x7d '' Cyr_HH */
+  2923,     /* 0x7e '' Cyr_Y */
+  2946,     /* 0x7f '' Cyr_E */
+  2978,     /* 0x80 '' Cyr_Ju */
+  2997,     /* 0x81 '' Cyr_Ja */
+  3029,     /* 0x82 '' Cyr_b */
+  3058,     /* 0x83 '' Cyr_v */
+  3086,     /* 0x84 '' Cyr_g */
+  3103,     /* 0x85 '' Cyr_jo */
+  3138,     /* 0x86 '' Cyr_zsch */
+  3159,     /* 0x87 '' Cyr_z */
+  3187,     /* 0x88 '' Cyr_i */
+  3216,     /* 0x89 '' Cyr_j */
+  3251,     /* 0x8a '' Cyr_k */
+  3283,     /* 0x8b '' Cyr_l */
+  3299,     /* 0x8c '' Cyr_m */
+  3322,     /* 0x8d '' Cyr_n */
+  3339,     /* 0x8e '' Cyr_p */
+  3353,     /* 0x8f '' Cyr_t */
+  3368,     /* 0x90 '' Cyr_tsch */
+  3385,     /* 0x91 '' Cyr_sch */
+  3401,     /* 0x92 '' Cyr_hh */
+  3425,     /* 0x93 '' Cyr_y */
+  3448,     /* 0x94 '' Cyr_ww */
+  3470,     /* 0x95 '' Cyr_e */
+  3499,     /* 0x96 '' Cyr_ju */
+  3518,     /* 0x97 '' Cyr_ja */
+  3545,     /* 0x98 '' Cyr_D */
+  3570,     /* 0x99 '' Cyr_C */
+  3590,     /* 0x9a '' Cyr_Schtsch */
+  3613,     /* 0x9b '' Cyr_d */
+  3637,     /* 0x9c '' Cyr_f */
+  3662,     /* 0x9d '' Cyr_c */
+  3682      /* 0x9e '' Cyr_schtsch */
+  #ifdef FONT_EXTRA
+  ,
+  3704,     /* 0x9f 1 (reversed color) */
+  3728,     /* 0xa0 2 (reversed color) */
+  3765,     /* 0xa1 3 (reversed color) */
+  3803,     /* 0xa2 x (reversed color) */
+  3828,     /* 0xa3 symbol: battery left side, low */
+  3842,     /* 0xa4 symbol: battery left side, high */
+  3861,     /* 0xa5 symbol: battery right side, low */
+  3882      /* 0xa6 symbol: battery right side, high */
+  #endif
+};
+
+#else
+
 /*
  *  character bitmaps
  *  - to reduce size we place some symbols and special characters at
@@ -389,6 +912,8 @@ const uint8_t FontData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 /*
  *  font lookup table for Windows-1251 (CP1251)
@@ -29,6 +29,139 @@
 #define SYMBOL_BYTES_Y      24     /* 24 bytes in y direction */
 
 
+#ifdef SYMBOLS_RLE
+
+/*
+ *  compressed symbol bitmaps (SYMBOLS_RLE)
+ *  - same bitmaps as below, each symbol compressed separately
+ *  - each row is XORed with the previous row (first row with zeros),
+ *    i.e. unchanged bytes become zero
+ *  - followed by run-length encoding of the zero bytes
+ *    - control byte: bits #7-4: number of zero bytes (0-15)
+ *                    bits #3-0: number of data bytes following (0-15)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0x51,0xC8,0x12,0x01,0xE0,0x21,0x20,0x28,0x20,0x38,0x01,0xE0,0x1C,0x02,0xD8,0x1C,
+  0x12,0x30,0x1C,0x12,0x60,0x1C,0x16,0xC0,0x38,0x01,0x80,0x7F,0xFD,0x12,0x7F,0xFD,
+  0x22,0x01,0x90,0x21,0xC0,0x21,0x60,0x21,0xC0,0x12,0x02,0xF8,0x21,0xE0,0x21,0x60,
+  0x21,0x60,0x21,0x60,0x21,0x60,0x21,0xE8,                                           /* BJT npn */
+
+  0x51,0xE8,0x21,0x60,0x21,0x60,0x21,0x60,0x22,0x60,0x38,0x15,0xE0,0x1C,0x02,0x98,
+  0x1C,0x12,0x30,0x1C,0x12,0x60,0x1C,0x16,0x30,0x38,0x01,0xF0,0x7F,0xFD,0x12,0x7F,
+  0xFD,0x22,0x01,0x80,0x21,0xC0,0x21,0x60,0x21,0x30,0x12,0x02,0xD8,0x12,0x01,0xE0,
+  0x21,0x20,0x21,0x20,0x12,0x01,0xE0,0x21,0xC8,                                      /* BJT pnp */
+
+  0x42,0x01,0xC8,0x21,0xE0,0x84,0xE0,0x01,0x41,0xC0,0x12,0x3F,0xF0,0x12,0x3F,0xE8,
+  0x11,0x44,0x2F,0x4C,0x6C,0x30,0x37,0x6C,0x70,0x36,0x38,0x18,0x4C,0x54,0x10,0x04,
+  0x6C,0x78,0x01,0x40,0x19,0x30,0x3E,0xE8,0x7E,0x3F,0xF0,0x7F,0x40,0xE0,0x12,0x01,
+  0xE0,0x12,0x01,0xC0,0x21,0xE0,0x12,0x01,0xE0,0x12,0x01,0xC8,                       /* MOSFET enh n-ch */
+
+  0x51,0xE8,0x12,0x01,0xE0,0x12,0x01,0xC0,0x21,0xE0,0x1D,0x01,0xE0,0x7F,0x41,0xC0,
+  0x7E,0x3F,0xF0,0x30,0x3E,0xE8,0x70,0x40,0x1C,0x18,0x08,0x6C,0x10,0x4C,0x6C,0x78,
+  0x3A,0x38,0x30,0x3B,0x54,0x12,0x4C,0x6C,0x11,0x48,0x22,0x3F,0xE8,0x15,0x3F,0xF0,
+  0x01,0x41,0xC0,0x21,0xE0,0x81,0xE0,0x12,0x01,0xC8,                                 /* MOSFET enh p-ch */
+
+  0x42,0x01,0xC8,0x21,0xE0,0x84,0xE0,0x01,0x41,0xC0,0x12,0x3F,0xF0,0x12,0x3F,0xE8,
+  0x11,0x04,0x2F,0x0C,0x6C,0x30,0x37,0x6C,0x70,0x36,0x38,0x18,0x0C,0x54,0x10,0x04,
+  0x6C,0x78,0x29,0x30,0x3E,0xE8,0x7E,0x3F,0xF0,0x7F,0x40,0xE0,0x12,0x01,0xE0,0x12,
+  0x01,0xC0,0x21,0xE0,0x12,0x01,0xE0,0x12,0x01,0xC8,                                 /* MOSFET dep n-ch */
+
+  0x51,0xE8,0x12,0x01,0xE0,0x12,0x01,0xC0,0x21,0xE0,0x1C,0x01,0xE0,0x7F,0x41,0xC0,
+  0x7E,0x3F,0xF0,0x30,0x3E,0xE8,0x70,0x2C,0x18,0x08,0x6C,0x10,0x0C,0x6C,0x78,0x3A,
+  0x38,0x30,0x3B,0x54,0x12,0x0C,0x6C,0x11,0x08,0x22,0x3F,0xE8,0x15,0x3F,0xF0,0x01,
+  0x41,0xC0,0x21,0xE0,0x81,0xE0,0x12,0x01,0xC8,                                      /* MOSFET dep p-ch */
+
+  0x31,0x18,0x18,0xE8,0x38,0x01,0xE0,0x0C,0x01,0xC0,0x08,0x1D,0xE0,0x3C,0x81,0xE0,
+  0x18,0xC9,0xC0,0x7F,0xB7,0xF0,0x7F,0xB7,0xF8,0x11,0xC0,0x21,0x80,0xF0,0x22,0x07,
+  0xF8,0x12,0x07,0xF0,0x12,0x09,0xC0,0x21,0xE0,0x81,0xE0,0x12,0x01,0xC8,             /* JFET n-ch */
+
+  0x42,0x01,0xC8,0x21,0xE0,0x81,0xE0,0x12,0x09,0xC0,0x12,0x07,0xF0,0x12,0x07,0xF8,
+  0x31,0x18,0x21,0x38,0x21,0x0C,0x21,0x08,0x22,0x3C,0x40,0x12,0x18,0xC0,0x16,0x7F,
+  0x77,0xF8,0x7F,0x77,0xF0,0x12,0xC8,0xE0,0x12,0x41,0xE0,0x12,0x01,0xC0,0x21,0xE0,
+  0x12,0x01,0xE0,0x12,0x01,0xC8,                                                     /* JFET p-ch */
+
+  0x42,0x01,0x88,0x12,0x03,0xC0,0x21,0x40,0x28,0x40,0x18,0x03,0xD8,0x38,0x05,0xB0,
+  0x0C,0x19,0x60,0x08,0x10,0xC0,0x3C,0x01,0x80,0x18,0x03,0x12,0x7F,0xE2,0x12,0x7F,
+  0xE2,0x22,0x03,0x20,0x12,0x01,0x80,0x12,0x10,0xC0,0x12,0x01,0x80,0x12,0x05,0xF0,
+  0x12,0x01,0xD8,0x21,0xC0,0x21,0xC0,0x21,0xC0,0x21,0xC0,0x12,0x01,0xC8,             /* IGBT enh n-ch */
+
+  0x42,0x01,0xC8,0x21,0xC0,0x21,0xC0,0x21,0xC0,0x28,0xC0,0x18,0x01,0xD8,0x38,0x05,
+  0x30,0x0C,0x15,0x60,0x08,0x10,0xC0,0x3C,0x16,0x60,0x18,0x03,0xE0,0x7F,0xE2,0x12,
+  0x7F,0xE2,0x21,0x03,0x22,0x01,0x80,0x12,0x10,0xC0,0x21,0x60,0x12,0x05,0xB0,0x12,
+  0x03,0xD8,0x21,0x40,0x21,0x40,0x12,0x03,0xC0,0x12,0x01,0x88,                       /* IGBT enh p-ch */
+
+  0x42,0x09,0x80,0x12,0x03,0xC0,0x12,0x01,0x80,0x12,0x01,0x80,0x42,0x02,0x40,0x34,
+  0x03,0xF7,0xE0,0x02,0x12,0x20,0x01,0x11,0x40,0x12,0x80,0x80,0x11,0x41,0x12,0x30,
+  0x22,0x12,0x70,0x14,0x18,0x1B,0xF7,0xE0,0x13,0xE7,0xE0,0x78,0x30,0x19,0x30,0x61,
+  0x80,0x7F,0xC3,0xC0,0x7F,0x80,0x40,0x21,0x40,0x12,0x03,0xC0,0x12,0x09,0x80,        /* SCR */
+
+  0x32,0x18,0xC8,0x12,0x3D,0xE0,0x12,0x19,0x60,0x12,0x18,0xC0,0x12,0x01,0x60,0x12,
+  0x25,0xE0,0x19,0x1F,0xF7,0xF8,0x10,0x07,0x78,0x08,0x09,0x40,0x33,0x04,0x12,0x20,
+  0x34,0x32,0x24,0x10,0x70,0x2F,0x19,0x48,0x08,0x13,0x70,0x04,0x7B,0x77,0xFC,0x31,
+  0x81,0x88,0x7F,0x03,0xD0,0x03,0x7E,0x01,0x90,0x12,0x01,0x80,0x21,0x14,0x12,0x0A,
+  0x5C,                                                                              /* Triac */
+
+  0x42,0x09,0x80,0x12,0x03,0xC0,0x17,0x01,0x80,0x7F,0x81,0x80,0x7F,0xC0,0x15,0x30,
+  0x62,0x40,0x70,0x30,0x14,0x1B,0xE7,0xE0,0x12,0x12,0x20,0x79,0x14,0x40,0x30,0x80,
+  0x80,0x11,0x41,0x21,0x22,0x21,0x14,0x16,0x03,0xF7,0xE0,0x03,0xF7,0xE0,0x42,0x01,
+  0x80,0x12,0x03,0xC0,0x21,0x40,0x21,0x40,0x12,0x03,0xC0,0x12,0x09,0x80,             /* PUT */
+
+  0x42,0x38,0xC8,0x12,0x1D,0xE0,0x1D,0x1D,0x60,0x78,0x1C,0xC0,0x7C,0x1D,0x60,0x06,
+  0x39,0xE0,0x3B,0x28,0x18,0x19,0x87,0xF0,0x18,0xC7,0xF8,0x19,0x80,0x12,0x19,0xF0,
+  0x12,0x38,0x10,0x82,0x07,0xF8,0x12,0x07,0xF0,0x11,0x08,0x22,0x1C,0x40,0x12,0x0E,
+  0x80,0x12,0x0E,0x80,0x11,0x0E,0x22,0x0E,0xA0,0x12,0x1C,0xE8                        /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  0xF0,0x11,0x3C,0x21,0xC3,0x21,0x3C,0x13,0x01,0x42,0x80,0x63,0x01,0x82,0x80,0x11,
+  0x04,0x21,0x09,0x21,0x12,0x21,0x24,0x81,0x38,0x51,0x38,0x81,0x38,0x10,             /* question mark */
+
+  0x42,0x0A,0x40,0x21,0xC0,0x12,0x01,0x80,0x12,0x01,0x80,0x24,0xC0,0x02,0x02,0x40,
+  0x36,0x01,0xF7,0xE0,0x03,0xF7,0xC0,0x11,0x14,0x22,0x22,0x20,0x11,0x41,0x23,0x80,
+  0x80,0x01,0x12,0x40,0x02,0x14,0x20,0x03,0xF7,0xE0,0x42,0x01,0x80,0x12,0x03,0xC0,
+  0x12,0x01,0x80,0x12,0x01,0x80,0x42,0x0A,0x40,                                      /* Zener diode */
+
+  0x41,0x08,0xF0,0x49,0x01,0xF7,0xC0,0x01,0xFF,0xC0,0x07,0xFF,0xF0,0x99,0x07,0xFF,
+  0xF0,0x01,0xFF,0xC0,0x01,0xF7,0xC0,0xF0,0x41,0x08,0x10,                            /* quartz crystal */
+
+  0x51,0x48,0x21,0xA0,0x21,0xA0,0x1A,0x7E,0x40,0x03,0xBD,0xF0,0x01,0xBD,0xF0,0x70,
+  0x7E,0x12,0x38,0xFE,0x21,0x7C,0x26,0x01,0xF0,0x38,0x01,0xF8,0x70,0x21,0x7D,0x21,
+  0x7F,0x62,0x01,0xF8,0x12,0x01,0xF0,0x11,0x7C,0x21,0xFE,0x91,0xE0,0x21,0xE8         /* OneWire device */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed symbols in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  56,       /* BJT pnp */
+  113,      /* MOSFET enh n-ch */
+  173,      /* MOSFET enh p-ch */
+  231,      /* MOSFET dep n-ch */
+  289,      /* MOSFET dep p-ch */
+  346,      /* JFET n-ch */
+  392,      /* JFET p-ch */
+  446,      /* IGBT enh n-ch */
+  508,      /* IGBT enh p-ch */
+  568,      /* SCR */
+  631,      /* Triac */
+  696,      /* PUT */
+  758       /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  818,      /* question mark */
+  848,      /* Zener diode */
+  905,      /* quartz crystal */
+  932       /* OneWire device */
+  #endif
+};
+
+#else
+
 /*
  *  symbol bitmaps
  *  - format:
@@ -151,6 +284,8 @@ const uint8_t SymbolData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 
 /*
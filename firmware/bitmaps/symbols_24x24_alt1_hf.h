@@ -29,6 +29,139 @@
 #define SYMBOL_BYTES_Y      24     /* 24 bytes in y direction */
 
 
+#ifdef SYMBOLS_RLE
+
+/*
+ *  compressed symbol bitmaps (SYMBOLS_RLE)
+ *  - same bitmaps as below, each symbol compressed separately
+ *  - each row is XORed with the previous row (first row with zeros),
+ *    i.e. unchanged bytes become zero
+ *  - followed by run-length encoding of the zero bytes
+ *    - control byte: bits #7-4: number of zero bytes (0-15)
+ *                    bits #3-0: number of data bytes following (0-15)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0x51,0x13,0x12,0x80,0x07,0x21,0x04,0x28,0x04,0x1C,0x80,0x07,0x38,0x40,0x1B,0x38,
+  0x12,0x0C,0x38,0x12,0x06,0x38,0x16,0x03,0x1C,0x80,0x01,0xFE,0xBF,0x12,0xFE,0xBF,
+  0x22,0x80,0x09,0x21,0x03,0x21,0x06,0x21,0x03,0x12,0x40,0x1F,0x21,0x07,0x21,0x06,
+  0x21,0x06,0x21,0x06,0x21,0x06,0x21,0x17,                                           /* BJT npn */
+
+  0x51,0x17,0x21,0x06,0x21,0x06,0x21,0x06,0x22,0x06,0x1C,0x15,0x07,0x38,0x40,0x19,
+  0x38,0x12,0x0C,0x38,0x12,0x06,0x38,0x16,0x0C,0x1C,0x80,0x0F,0xFE,0xBF,0x12,0xFE,
+  0xBF,0x22,0x80,0x01,0x21,0x03,0x21,0x06,0x21,0x0C,0x12,0x40,0x1B,0x12,0x80,0x07,
+  0x21,0x04,0x21,0x04,0x12,0x80,0x07,0x21,0x13,                                      /* BJT pnp */
+
+  0x42,0x80,0x13,0x21,0x07,0x84,0x07,0x80,0x82,0x03,0x12,0xFC,0x0F,0x12,0xFC,0x17,
+  0x11,0x22,0x2F,0x32,0x36,0x0C,0xEC,0x36,0x0E,0x6C,0x1C,0x18,0x32,0x2A,0x08,0x20,
+  0x36,0x1E,0x01,0x02,0x19,0x0C,0x7C,0x17,0x7E,0xFC,0x0F,0xFE,0x02,0x07,0x12,0x80,
+  0x07,0x12,0x80,0x03,0x21,0x07,0x12,0x80,0x07,0x12,0x80,0x13,                       /* MOSFET enh n-ch */
+
+  0x51,0x17,0x12,0x80,0x07,0x12,0x80,0x03,0x21,0x07,0x1D,0x80,0x07,0xFE,0x82,0x03,
+  0x7E,0xFC,0x0F,0x0C,0x7C,0x17,0x0E,0x02,0x1C,0x18,0x10,0x36,0x08,0x32,0x36,0x1E,
+  0x5C,0x1C,0x0C,0xDC,0x2A,0x12,0x32,0x36,0x11,0x12,0x22,0xFC,0x17,0x15,0xFC,0x0F,
+  0x80,0x82,0x03,0x21,0x07,0x81,0x07,0x12,0x80,0x13,                                 /* MOSFET enh p-ch */
+
+  0x42,0x80,0x13,0x21,0x07,0x84,0x07,0x80,0x82,0x03,0x12,0xFC,0x0F,0x12,0xFC,0x17,
+  0x11,0x20,0x2F,0x30,0x36,0x0C,0xEC,0x36,0x0E,0x6C,0x1C,0x18,0x30,0x2A,0x08,0x20,
+  0x36,0x1E,0x29,0x0C,0x7C,0x17,0x7E,0xFC,0x0F,0xFE,0x02,0x07,0x12,0x80,0x07,0x12,
+  0x80,0x03,0x21,0x07,0x12,0x80,0x07,0x12,0x80,0x13,                                 /* MOSFET dep n-ch */
+
+  0x51,0x17,0x12,0x80,0x07,0x12,0x80,0x03,0x21,0x07,0x1C,0x80,0x07,0xFE,0x82,0x03,
+  0x7E,0xFC,0x0F,0x0C,0x7C,0x17,0x0E,0x2C,0x18,0x10,0x36,0x08,0x30,0x36,0x1E,0x5C,
+  0x1C,0x0C,0xDC,0x2A,0x12,0x30,0x36,0x11,0x10,0x22,0xFC,0x17,0x15,0xFC,0x0F,0x80,
+  0x82,0x03,0x21,0x07,0x81,0x07,0x12,0x80,0x13,                                      /* MOSFET dep p-ch */
+
+  0x31,0x18,0x18,0x17,0x1C,0x80,0x07,0x30,0x80,0x03,0x10,0x1D,0x07,0x3C,0x81,0x07,
+  0x18,0x93,0x03,0xFE,0xED,0x0F,0xFE,0xED,0x1F,0x11,0x03,0x21,0x01,0xF0,0x22,0xE0,
+  0x1F,0x12,0xE0,0x0F,0x12,0x90,0x03,0x21,0x07,0x81,0x07,0x12,0x80,0x13,             /* JFET n-ch */
+
+  0x42,0x80,0x13,0x21,0x07,0x81,0x07,0x12,0x90,0x03,0x12,0xE0,0x0F,0x12,0xE0,0x1F,
+  0x31,0x18,0x21,0x1C,0x21,0x30,0x21,0x10,0x22,0x3C,0x02,0x12,0x18,0x03,0x16,0xFE,
+  0xEE,0x1F,0xFE,0xEE,0x0F,0x12,0x13,0x07,0x12,0x82,0x07,0x12,0x80,0x03,0x21,0x07,
+  0x12,0x80,0x07,0x12,0x80,0x13,                                                     /* JFET p-ch */
+
+  0x42,0x80,0x11,0x12,0xC0,0x03,0x21,0x02,0x28,0x02,0x18,0xC0,0x1B,0x1C,0xA0,0x0D,
+  0x30,0x19,0x06,0x10,0x08,0x03,0x3C,0x80,0x01,0x18,0xC0,0x12,0xFE,0x47,0x12,0xFE,
+  0x47,0x22,0xC0,0x04,0x12,0x80,0x01,0x12,0x08,0x03,0x12,0x80,0x01,0x12,0xA0,0x0F,
+  0x12,0x80,0x1B,0x21,0x03,0x21,0x03,0x21,0x03,0x21,0x03,0x12,0x80,0x13,             /* IGBT enh n-ch */
+
+  0x42,0x80,0x13,0x21,0x03,0x21,0x03,0x21,0x03,0x28,0x03,0x18,0x80,0x1B,0x1C,0xA0,
+  0x0C,0x30,0x15,0x06,0x10,0x08,0x03,0x3C,0x16,0x06,0x18,0xC0,0x07,0xFE,0x47,0x12,
+  0xFE,0x47,0x21,0xC0,0x22,0x80,0x01,0x12,0x08,0x03,0x21,0x06,0x12,0xA0,0x0D,0x12,
+  0xC0,0x1B,0x21,0x02,0x21,0x02,0x12,0xC0,0x03,0x12,0x80,0x11,                       /* IGBT enh p-ch */
+
+  0x42,0x90,0x01,0x12,0xC0,0x03,0x12,0x80,0x01,0x12,0x80,0x01,0x42,0x40,0x02,0x34,
+  0xC0,0xEF,0x07,0x40,0x12,0x04,0x80,0x11,0x02,0x12,0x01,0x01,0x11,0x82,0x12,0x0C,
+  0x44,0x12,0x0E,0x28,0x18,0xD8,0xEF,0x07,0xC8,0xE7,0x07,0x1E,0x0C,0x19,0x0C,0x86,
+  0x01,0xFE,0xC3,0x03,0xFE,0x01,0x02,0x21,0x02,0x12,0xC0,0x03,0x12,0x90,0x01,        /* SCR */
+
+  0x32,0x18,0x13,0x12,0xBC,0x07,0x12,0x98,0x06,0x12,0x18,0x03,0x12,0x80,0x06,0x12,
+  0xA4,0x07,0x19,0xF8,0xEF,0x1F,0x08,0xE0,0x1E,0x10,0x90,0x02,0x33,0x20,0x48,0x04,
+  0x34,0x4C,0x24,0x08,0x0E,0x2F,0x98,0x12,0x10,0xC8,0x0E,0x20,0xDE,0xEE,0x3F,0x8C,
+  0x81,0x11,0xFE,0xC0,0x0B,0x03,0x7E,0x80,0x09,0x12,0x80,0x01,0x21,0x28,0x12,0x50,
+  0x3A,                                                                              /* Triac */
+
+  0x42,0x90,0x01,0x12,0xC0,0x03,0x17,0x80,0x01,0xFE,0x81,0x01,0xFE,0x03,0x15,0x0C,
+  0x46,0x02,0x0E,0x0C,0x14,0xD8,0xE7,0x07,0x48,0x12,0x04,0x9E,0x14,0x02,0x0C,0x01,
+  0x01,0x11,0x82,0x21,0x44,0x21,0x28,0x16,0xC0,0xEF,0x07,0xC0,0xEF,0x07,0x42,0x80,
+  0x01,0x12,0xC0,0x03,0x21,0x02,0x21,0x02,0x12,0xC0,0x03,0x12,0x90,0x01,             /* PUT */
+
+  0x42,0x1C,0x13,0x12,0xB8,0x07,0x1D,0xB8,0x06,0x1E,0x38,0x03,0x3E,0xB8,0x06,0x60,
+  0x9C,0x07,0xDC,0x14,0x18,0x98,0xE1,0x0F,0x18,0xE3,0x1F,0x98,0x01,0x12,0x98,0x0F,
+  0x12,0x1C,0x08,0x82,0xE0,0x1F,0x12,0xE0,0x0F,0x11,0x10,0x22,0x38,0x02,0x12,0x70,
+  0x01,0x12,0x70,0x01,0x11,0x70,0x22,0x70,0x05,0x12,0x38,0x17                        /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  0xF0,0x11,0x3C,0x21,0xC3,0x21,0x3C,0x13,0x80,0x42,0x01,0x63,0x80,0x41,0x01,0x11,
+  0x20,0x21,0x90,0x21,0x48,0x21,0x24,0x81,0x1C,0x51,0x1C,0x81,0x1C,0x10,             /* question mark */
+
+  0x42,0x50,0x02,0x21,0x03,0x12,0x80,0x01,0x12,0x80,0x01,0x24,0x03,0x40,0x40,0x02,
+  0x36,0x80,0xEF,0x07,0xC0,0xEF,0x03,0x11,0x28,0x22,0x44,0x04,0x11,0x82,0x23,0x01,
+  0x01,0x80,0x12,0x02,0x40,0x14,0x04,0xC0,0xEF,0x07,0x42,0x80,0x01,0x12,0xC0,0x03,
+  0x12,0x80,0x01,0x12,0x80,0x01,0x42,0x50,0x02,                                      /* Zener diode */
+
+  0x41,0x10,0xF0,0x49,0x80,0xEF,0x03,0x80,0xFF,0x03,0xE0,0xFF,0x0F,0x99,0xE0,0xFF,
+  0x0F,0x80,0xFF,0x03,0x80,0xEF,0x03,0xF0,0x41,0x10,0x10,                            /* quartz crystal */
+
+  0x51,0x12,0x21,0x05,0x21,0x05,0x1A,0x7E,0x02,0xC0,0xBD,0x0F,0x80,0xBD,0x0F,0x0E,
+  0x7E,0x12,0x1C,0x7F,0x21,0x3E,0x26,0x80,0x0F,0x1C,0x80,0x1F,0x0E,0x21,0xBE,0x21,
+  0xFE,0x62,0x80,0x1F,0x12,0x80,0x0F,0x11,0x3E,0x21,0x7F,0x91,0x07,0x21,0x17         /* OneWire device */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed symbols in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  56,       /* BJT pnp */
+  113,      /* MOSFET enh n-ch */
+  173,      /* MOSFET enh p-ch */
+  231,      /* MOSFET dep n-ch */
+  289,      /* MOSFET dep p-ch */
+  346,      /* JFET n-ch */
+  392,      /* JFET p-ch */
+  446,      /* IGBT enh n-ch */
+  508,      /* IGBT enh p-ch */
+  568,      /* SCR */
+  631,      /* Triac */
+  696,      /* PUT */
+  758       /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  818,      /* question mark */
+  848,      /* Zener diode */
+  905,      /* quartz crystal */
+  932       /* OneWire device */
+  #endif
+};
+
+#else
+
 /*
  *  symbol bitmaps
  *  - format:
@@ -151,6 +284,8 @@ const uint8_t SymbolData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 
 /*
@@ -29,6 +29,139 @@
 #define SYMBOL_BYTES_Y      24     /* 24 bytes in y direction */
 
 
+#ifdef SYMBOLS_RLE
+
+/*
+ *  compressed symbol bitmaps (SYMBOLS_RLE)
+ *  - same bitmaps as below, each symbol compressed separately
+ *  - each row is XORed with the previous row (first row with zeros),
+ *    i.e. unchanged bytes become zero
+ *  - followed by run-length encoding of the zero bytes
+ *    - control byte: bits #7-4: number of zero bytes (0-15)
+ *                    bits #3-0: number of data bytes following (0-15)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0x51,0x13,0x12,0x80,0x07,0x21,0x04,0x28,0x04,0x1C,0x80,0x07,0x38,0x60,0x1B,0x38,
+  0x12,0x0C,0x38,0x12,0x06,0x38,0x16,0x03,0x1C,0x80,0x01,0xFE,0x9F,0x12,0xFE,0x9F,
+  0x22,0x80,0x09,0x21,0x03,0x21,0x06,0x21,0x03,0x12,0x60,0x1F,0x21,0x07,0x21,0x06,
+  0x21,0x06,0x21,0x06,0x21,0x06,0x21,0x17,                                           /* BJT npn */
+
+  0x42,0x80,0x13,0x21,0x03,0x21,0x03,0x21,0x03,0x28,0x03,0x1C,0x80,0x03,0x38,0x60,
+  0x19,0x38,0x12,0x0C,0x38,0x12,0x06,0x38,0x16,0x0C,0x1C,0x80,0x0F,0xFE,0x9F,0x12,
+  0xFE,0x9F,0x22,0x80,0x01,0x21,0x03,0x21,0x06,0x21,0x0C,0x12,0x60,0x1B,0x12,0x80,
+  0x07,0x21,0x04,0x21,0x04,0x12,0x80,0x07,0x21,0x13,                                 /* BJT pnp */
+
+  0x42,0x80,0x13,0x21,0x07,0x84,0x07,0xC0,0x82,0x03,0x12,0xFC,0x0F,0x12,0xFC,0x17,
+  0x11,0x12,0x2F,0x0A,0x36,0x0C,0x64,0x36,0x0E,0x24,0x14,0x18,0x0A,0x22,0x08,0x10,
+  0x36,0x1E,0x01,0x02,0x19,0x0C,0xBC,0x17,0x3E,0xFC,0x0F,0xFE,0x02,0x07,0x12,0x80,
+  0x07,0x12,0x80,0x03,0x21,0x07,0x12,0x80,0x07,0x12,0x80,0x13,                       /* MOSFET enh n-ch */
+
+  0x51,0x17,0x12,0x80,0x07,0x12,0x80,0x03,0x21,0x07,0x1D,0x80,0x07,0xFE,0x82,0x03,
+  0x3E,0xFC,0x0F,0x0C,0xBC,0x17,0x0E,0x02,0x1C,0x18,0x08,0x36,0x08,0x12,0x36,0x1E,
+  0x24,0x14,0x0C,0x64,0x22,0x12,0x12,0x36,0x11,0x0A,0x22,0xFC,0x17,0x15,0xFC,0x0F,
+  0xC0,0x82,0x03,0x21,0x07,0x81,0x07,0x12,0x80,0x13,                                 /* MOSFET enh p-ch */
+
+  0x42,0x80,0x13,0x21,0x07,0x84,0x07,0xC0,0x82,0x03,0x12,0xFC,0x0F,0x12,0xFC,0x17,
+  0x11,0x10,0x2F,0x08,0x36,0x0C,0x64,0x36,0x0E,0x24,0x14,0x18,0x08,0x22,0x08,0x10,
+  0x36,0x1E,0x29,0x0C,0xBC,0x17,0x3E,0xFC,0x0F,0xFE,0x02,0x07,0x12,0x80,0x07,0x12,
+  0x80,0x03,0x21,0x07,0x12,0x80,0x07,0x12,0x80,0x13,                                 /* MOSFET dep n-ch */
+
+  0x51,0x17,0x12,0x80,0x07,0x12,0x80,0x03,0x21,0x07,0x1C,0x80,0x07,0xFE,0x82,0x03,
+  0x3E,0xFC,0x0F,0x0C,0xBC,0x17,0x0E,0x2C,0x18,0x08,0x36,0x08,0x10,0x36,0x1E,0x24,
+  0x14,0x0C,0x64,0x22,0x12,0x10,0x36,0x11,0x08,0x22,0xFC,0x17,0x15,0xFC,0x0F,0xC0,
+  0x82,0x03,0x21,0x07,0x81,0x07,0x12,0x80,0x13,                                      /* MOSFET dep p-ch */
+
+  0x31,0x18,0x18,0x17,0x1C,0x80,0x07,0x30,0x80,0x03,0x10,0x1D,0x07,0xBC,0x80,0x07,
+  0x18,0x99,0x03,0x7E,0xE6,0x0F,0x7E,0xE6,0x1F,0x11,0x01,0x11,0x80,0xF0,0x32,0xE0,
+  0x1F,0x12,0xE0,0x0F,0x12,0x98,0x03,0x21,0x07,0x81,0x07,0x12,0x80,0x13,             /* JFET n-ch */
+
+  0x31,0x18,0x18,0x17,0x1C,0x80,0x07,0x30,0x80,0x03,0x10,0x1D,0x07,0xBC,0x80,0x07,
+  0x18,0x99,0x03,0x7E,0xE6,0x0F,0x7E,0xE6,0x1F,0x11,0x01,0x11,0x80,0xF0,0x32,0xE0,
+  0x1F,0x12,0xE0,0x0F,0x12,0x98,0x03,0x21,0x07,0x81,0x07,0x12,0x80,0x13,             /* JFET p-ch */
+
+  0x42,0x80,0x11,0x12,0xC0,0x03,0x21,0x02,0x28,0x02,0x18,0xC0,0x1B,0x1C,0xB0,0x0D,
+  0x30,0x19,0x06,0x10,0x06,0x03,0x3C,0x80,0x01,0x18,0xC0,0x12,0xFE,0x41,0x12,0xFE,
+  0x41,0x22,0xC0,0x04,0x12,0x80,0x03,0x11,0x06,0x21,0x80,0x22,0xB0,0x0F,0x12,0x80,
+  0x1B,0x21,0x03,0x21,0x03,0x21,0x03,0x21,0x03,0x12,0x80,0x13,                       /* IGBT enh n-ch */
+
+  0x42,0x80,0x13,0x21,0x03,0x21,0x03,0x21,0x03,0x28,0x03,0x18,0x80,0x1B,0x1C,0xB0,
+  0x0C,0x30,0x15,0x06,0x10,0x06,0x03,0x3C,0x16,0x06,0x18,0xC0,0x07,0xFE,0x41,0x12,
+  0xFE,0x41,0x21,0xC0,0x22,0x80,0x01,0x12,0x06,0x03,0x21,0x06,0x12,0xB0,0x0D,0x12,
+  0xC0,0x1B,0x21,0x02,0x21,0x02,0x12,0xC0,0x03,0x12,0x80,0x11,                       /* IGBT enh p-ch */
+
+  0x42,0x90,0x01,0x12,0xC0,0x03,0x12,0x80,0x01,0x12,0x80,0x01,0x42,0x40,0x02,0x34,
+  0xC0,0xEF,0x07,0x40,0x12,0x04,0x80,0x11,0x02,0x12,0x01,0x01,0x11,0x82,0x21,0x44,
+  0x12,0x0C,0x28,0x14,0xCE,0xEF,0x07,0x18,0x2F,0xC8,0xE7,0x07,0x1E,0x8C,0x01,0x0C,
+  0xC6,0x03,0xFE,0x03,0x02,0xFE,0x01,0x02,0x12,0xC0,0x03,0x12,0x90,0x01,             /* SCR */
+
+  0x32,0x18,0x13,0x12,0xBC,0x07,0x12,0x98,0x06,0x12,0x18,0x03,0x12,0x80,0x06,0x12,
+  0xA4,0x07,0x19,0xF8,0xEF,0x1F,0x08,0xE0,0x1E,0x10,0x90,0x02,0x33,0x20,0x48,0x04,
+  0x34,0x4C,0x24,0x08,0x0E,0x2F,0x98,0x12,0x10,0xC8,0x0E,0x20,0xDE,0xEE,0x3F,0x8C,
+  0x81,0x11,0xFE,0xC0,0x0B,0x03,0x7E,0x80,0x09,0x12,0x80,0x01,0x21,0x28,0x12,0x50,
+  0x3A,                                                                              /* Triac */
+
+  0x42,0x90,0x01,0x12,0xC0,0x03,0x17,0x80,0x01,0xFE,0x81,0x01,0xFE,0x03,0x15,0x0C,
+  0x46,0x02,0x0E,0x0C,0x14,0xD8,0xE7,0x07,0x48,0x12,0x04,0x9E,0x14,0x02,0x0C,0x01,
+  0x01,0x11,0x82,0x21,0x44,0x21,0x28,0x13,0xC0,0xEF,0x07,0x33,0xC0,0xEF,0x07,0x12,
+  0x80,0x01,0x12,0xC0,0x03,0x21,0x02,0x21,0x02,0x12,0xC0,0x03,0x12,0x90,0x01,        /* PUT */
+
+  0x42,0x1C,0x13,0x12,0xB8,0x07,0x12,0xB8,0x06,0x1A,0x38,0x03,0x3E,0xB8,0x06,0x7E,
+  0x9C,0x07,0xCE,0x34,0x17,0x8C,0xC3,0x0F,0x0C,0xC0,0x1F,0x8C,0x22,0x8C,0x0F,0x12,
+  0x0E,0x08,0x82,0xC0,0x1F,0x12,0xC0,0x0F,0x11,0x30,0x22,0x38,0x02,0x12,0x70,0x01,
+  0x12,0x70,0x01,0x11,0x70,0x22,0x70,0x05,0x12,0x38,0x17                             /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  0x71,0x1E,0x12,0x80,0x61,0x21,0x1E,0x12,0x40,0xAD,0x22,0x0E,0x02,0x32,0xC0,0xA2,
+  0x22,0x10,0x03,0x11,0x48,0x22,0xA4,0x01,0x11,0xD2,0x21,0x60,0x51,0x0E,0x21,0x1C,
+  0x21,0x3C,0x21,0x0E,0x21,0x20,0x51,0x0E,0x21,0x1C,0x21,0x3C,0x10,                  /* question mark */
+
+  0x42,0x50,0x02,0x21,0x03,0x12,0x80,0x01,0x13,0x80,0x01,0x40,0x11,0x03,0x15,0x40,
+  0x02,0x80,0xEF,0x07,0x33,0xC0,0xEF,0x03,0x11,0x28,0x22,0x44,0x04,0x11,0x82,0x23,
+  0x01,0x01,0x80,0x12,0x02,0x40,0x14,0x04,0xC0,0xEF,0x07,0x42,0x80,0x01,0x12,0xC0,
+  0x03,0x12,0x80,0x01,0x12,0x80,0x01,0x42,0x50,0x02,                                 /* Zener diode */
+
+  0x41,0x10,0xF0,0x13,0x80,0xEF,0x03,0x36,0x80,0xFF,0x03,0xE0,0xFF,0x0F,0x96,0xE0,
+  0xFF,0x0F,0x80,0xFF,0x03,0x33,0x80,0xEF,0x03,0xF0,0x11,0x10,0x10,                  /* quartz crystal */
+
+  0x51,0x12,0x21,0x05,0x21,0x05,0x1A,0x7E,0x02,0xC0,0xBD,0x0F,0x80,0xBD,0x0F,0x0E,
+  0x7E,0x12,0x1C,0x7F,0x56,0x80,0x0F,0x1C,0x80,0x1F,0x0E,0x21,0xBE,0x21,0xFE,0x62,
+  0x80,0x1F,0x12,0x80,0x0F,0x41,0x7F,0x91,0x07,0x21,0x17                             /* OneWire device */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed symbols in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  56,       /* BJT pnp */
+  114,      /* MOSFET enh n-ch */
+  174,      /* MOSFET enh p-ch */
+  232,      /* MOSFET dep n-ch */
+  290,      /* MOSFET dep p-ch */
+  347,      /* JFET n-ch */
+  393,      /* JFET p-ch */
+  439,      /* IGBT enh n-ch */
+  499,      /* IGBT enh p-ch */
+  559,      /* SCR */
+  621,      /* Triac */
+  686,      /* PUT */
+  749       /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  808,      /* question mark */
+  853,      /* Zener diode */
+  911,      /* quartz crystal */
+  940       /* OneWire device */
+  #endif
+};
+
+#else
+
 /*
  *  symbol bitmaps
  *  - format:
@@ -151,6 +284,8 @@ const uint8_t SymbolData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 
 /*
@@ -30,6 +30,137 @@
 #define SYMBOL_BYTES_Y      24     /* 24 bytes in y direction */
 
 
+#ifdef SYMBOLS_RLE
+
+/*
+ *  compressed symbol bitmaps (SYMBOLS_RLE)
+ *  - same bitmaps as below, each symbol compressed separately
+ *  - each row is XORed with the previous row (first row with zeros),
+ *    i.e. unchanged bytes become zero
+ *  - followed by run-length encoding of the zero bytes
+ *    - control byte: bits #7-4: number of zero bytes (0-15)
+ *                    bits #3-0: number of data bytes following (0-15)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0x21,0x40,0x21,0x0E,0x21,0x1E,0x72,0x60,0xC0,0x12,0x01,0x80,0x12,0x03,0x1E,0x12,
+  0x06,0x0E,0x11,0x0C,0x21,0x18,0x12,0x7F,0x90,0x12,0x7F,0x90,0x21,0x18,0x12,0x70,
+  0x0D,0x12,0x38,0x06,0x28,0x04,0x1E,0x38,0x07,0x8E,0x38,0x60,0xC0,0x22,0x0C,0x38,
+  0x12,0x0C,0x70,0x41,0x0E,0x21,0x5E,                                                /* BJT npn */
+
+  0x21,0x40,0x21,0x1E,0x21,0x0E,0x51,0x0C,0x12,0x62,0xCC,0x12,0x01,0x80,0x21,0x8E,
+  0x12,0x07,0x9E,0x11,0x0C,0x21,0x18,0x12,0x7F,0x90,0x12,0x7F,0x90,0x21,0x18,0x12,
+  0x70,0x0C,0x12,0x38,0x06,0x28,0x03,0x0E,0x38,0x01,0x9E,0x38,0x60,0xC0,0x31,0x38,
+  0x21,0x70,0x41,0x1E,0x21,0x4E,                                                     /* BJT pnp */
+
+  0x21,0x40,0x21,0x1C,0x21,0x0E,0x71,0x30,0x1B,0x01,0x8F,0x80,0x30,0x0F,0xCE,0x78,
+  0x30,0x1C,0x08,0x01,0x21,0x32,0x18,0x18,0x0C,0xC0,0x10,0x0C,0x80,0x78,0x32,0x12,
+  0x30,0x01,0x21,0x30,0x16,0x7E,0x0F,0x8C,0x7F,0x8F,0x9E,0x12,0x30,0x02,0x21,0x1C,
+  0x21,0x0E,0x21,0x10,0x21,0x1E,0x21,0x4C,                                           /* MOSFET enh n-ch */
+
+  0x21,0x40,0x21,0x0C,0x21,0x1E,0x21,0x02,0x21,0x1C,0x18,0x30,0x0E,0x7F,0x8F,0x90,
+  0x7E,0x0F,0x9E,0x14,0x30,0x0C,0x30,0x02,0x12,0x78,0x31,0x13,0x08,0x0C,0x80,0x14,
+  0x0C,0xC0,0x18,0x31,0x12,0x10,0x02,0x12,0x78,0x30,0x16,0x30,0x0F,0xDC,0x01,0x8F,
+  0x8E,0x11,0x30,0xC1,0x0E,0x21,0x5C,                                                /* MOSFET enh p-ch */
+
+  0x21,0x40,0x21,0x1C,0x21,0x0E,0x71,0x30,0x17,0x01,0x8F,0x80,0x30,0x0F,0xCE,0x78,
+  0x13,0x1C,0x08,0x01,0x21,0x02,0x18,0x18,0x0C,0xC0,0x10,0x0C,0x80,0x78,0x02,0x12,
+  0x30,0x01,0x46,0x7E,0x0F,0x8C,0x7F,0x8F,0x9E,0x12,0x30,0x02,0x21,0x1C,0x21,0x0E,
+  0x21,0x10,0x21,0x1E,0x21,0x4C,                                                     /* MOSFET dep n-ch */
+
+  0x21,0x40,0x21,0x0C,0x21,0x1E,0x21,0x02,0x21,0x1C,0x18,0x30,0x0E,0x7F,0x8F,0x90,
+  0x7E,0x0F,0x9E,0x23,0x0C,0x30,0x02,0x12,0x78,0x01,0x13,0x08,0x0C,0x80,0x14,0x0C,
+  0xC0,0x18,0x01,0x12,0x10,0x02,0x11,0x78,0x26,0x30,0x0F,0xDC,0x01,0x8F,0x8E,0x11,
+  0x30,0xC1,0x0E,0x21,0x5C,                                                          /* MOSFET dep p-ch */
+
+  0x21,0x40,0x21,0x1C,0x21,0x0E,0x71,0x30,0x11,0x30,0x26,0x78,0x0F,0x8E,0x08,0x0F,
+  0xDC,0x31,0x18,0x21,0x10,0x21,0x78,0x21,0x32,0x21,0x01,0x27,0x7C,0xCF,0xC0,0x7C,
+  0xCF,0x8C,0x01,0x14,0x1E,0x02,0x30,0x02,0x21,0x1C,0x21,0x0E,0x21,0x10,0x21,0x1E,
+  0x21,0x4C,                                                                         /* JFET n-ch */
+
+  0x21,0x40,0x21,0x0C,0x21,0x1E,0x21,0x02,0x25,0x1C,0x01,0x30,0x0E,0x02,0x18,0x10,
+  0x7C,0xCF,0x9E,0x7C,0xCF,0xCC,0x02,0x21,0x31,0x21,0x78,0x21,0x08,0x51,0x18,0x27,
+  0x10,0x0F,0xC0,0x78,0x0F,0x9C,0x30,0x11,0x0E,0x11,0x30,0xC1,0x0E,0x21,0x5C,        /* JFET p-ch */
+
+  0x21,0x40,0x21,0x0E,0x21,0x1E,0x71,0x30,0x34,0xC0,0x01,0x81,0x9E,0x12,0x03,0x0E,
+  0x11,0x06,0x21,0x0C,0x12,0x7E,0x08,0x12,0x7E,0x08,0x21,0x0D,0x12,0x30,0x06,0x12,
+  0x78,0x04,0x13,0x09,0x87,0x9E,0x23,0xCE,0x18,0x30,0x11,0x10,0x12,0x0C,0x78,0x12,
+  0x0C,0x30,0x41,0x0E,0x21,0x5E,                                                     /* IGBT enh n-ch */
+
+  0x21,0x40,0x21,0x1E,0x21,0x0E,0x51,0x0C,0x12,0x30,0x0C,0x15,0x02,0xC0,0x01,0x81,
+  0x8E,0x21,0x9E,0x12,0x07,0x80,0x11,0x0C,0x12,0x7E,0x08,0x12,0x7E,0x08,0x21,0x0C,
+  0x12,0x30,0x06,0x12,0x78,0x03,0x13,0x09,0x81,0x8E,0x23,0xDE,0x18,0x30,0x11,0x10,
+  0x21,0x78,0x21,0x30,0x41,0x1E,0x21,0x4E,                                           /* IGBT enh p-ch */
+
+  0x11,0x08,0x31,0xC0,0x12,0x01,0xE0,0x51,0xC0,0x21,0xC0,0x46,0x01,0x20,0x01,0xF7,
+  0xC0,0x01,0x11,0x40,0x14,0x80,0x80,0x30,0x41,0x12,0x78,0x22,0x12,0x08,0x14,0x14,
+  0x19,0xF7,0xC0,0x10,0x26,0x79,0xE7,0xC0,0x30,0x30,0xE0,0x14,0x61,0xE0,0x7F,0xC0,
+  0x12,0x7F,0x80,0x52,0x01,0xE0,0x12,0x08,0xE0,                                      /* SCR */
+
+  0x12,0x04,0xA0,0xB1,0xA0,0x33,0x07,0xFB,0xFC,0x33,0x07,0xBC,0x04,0x11,0xA0,0x24,
+  0x02,0x08,0x01,0x10,0x15,0x60,0x01,0x10,0xF2,0x08,0x11,0x10,0x15,0xA0,0x34,0x07,
+  0xBC,0x20,0x25,0xF7,0xBB,0xFC,0x60,0xC0,0x14,0x01,0x80,0x40,0xFF,0x21,0xFE,0x62,
+  0x04,0x40,                                                                         /* Triac */
+
+  0x11,0x08,0x31,0xC0,0x12,0x01,0xE0,0x36,0x7F,0x80,0xC0,0x7F,0xC0,0xC0,0x11,0x60,
+  0x17,0x30,0x31,0x20,0x79,0xE7,0xC0,0x09,0x16,0x40,0x18,0x80,0x80,0x10,0x41,0x12,
+  0x78,0x22,0x12,0x30,0x14,0x13,0x01,0xF7,0xC0,0x33,0x01,0xF7,0xC0,0x21,0xE0,0x12,
+  0x01,0xE0,0xA2,0x01,0xE0,0x12,0x08,0xE0,                                           /* PUT */
+
+  0x21,0x40,0x21,0x14,0xA1,0x30,0x11,0x78,0x18,0x14,0x7C,0x0F,0x80,0x06,0x8F,0xC0,
+  0x7B,0x21,0x3A,0x22,0x03,0xC0,0x12,0x30,0x40,0x11,0x30,0x56,0x38,0x0F,0xC0,0x78,
+  0x0F,0x80,0x21,0x08,0x11,0x30,0xC1,0x08,0x21,0x40                                  /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  0xF0,0x11,0x3C,0x21,0xC3,0x21,0x3C,0x13,0x01,0x42,0x80,0x63,0x01,0x82,0x80,0x11,
+  0x04,0x21,0x09,0x21,0x12,0x21,0x24,0x81,0x38,0x51,0x38,0x81,0x38,0x10,             /* question mark */
+
+  0x42,0x0A,0x40,0x21,0xC0,0x12,0x01,0x80,0x12,0x01,0x80,0x24,0xC0,0x02,0x02,0x40,
+  0x36,0x01,0xF7,0xE0,0x03,0xF7,0xC0,0x11,0x14,0x22,0x22,0x20,0x11,0x41,0x23,0x80,
+  0x80,0x01,0x12,0x40,0x02,0x14,0x20,0x03,0xF7,0xE0,0x42,0x01,0x80,0x12,0x03,0xC0,
+  0x12,0x01,0x80,0x12,0x01,0x80,0x42,0x0A,0x40,                                      /* Zener diode */
+
+  0x41,0x08,0xF0,0x49,0x01,0xF7,0xC0,0x01,0xFF,0xC0,0x07,0xFF,0xF0,0x99,0x07,0xFF,
+  0xF0,0x01,0xFF,0xC0,0x01,0xF7,0xC0,0xF0,0x41,0x08,0x10,                            /* quartz crystal */
+
+  0x51,0x48,0x21,0xA0,0x21,0xA0,0x1A,0x7E,0x40,0x03,0xBD,0xF0,0x01,0xBD,0xF0,0x70,
+  0x7E,0x12,0x38,0xFE,0x21,0x7C,0x26,0x01,0xF0,0x38,0x01,0xF8,0x70,0x21,0x7D,0x21,
+  0x7F,0x62,0x01,0xF8,0x12,0x01,0xF0,0x11,0x7C,0x21,0xFE,0x91,0xE0,0x21,0xE8         /* OneWire device */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed symbols in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  55,       /* BJT pnp */
+  109,      /* MOSFET enh n-ch */
+  165,      /* MOSFET enh p-ch */
+  220,      /* MOSFET dep n-ch */
+  274,      /* MOSFET dep p-ch */
+  327,      /* JFET n-ch */
+  377,      /* JFET p-ch */
+  424,      /* IGBT enh n-ch */
+  478,      /* IGBT enh p-ch */
+  534,      /* SCR */
+  591,      /* Triac */
+  641,      /* PUT */
+  697       /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  739,      /* question mark */
+  769,      /* Zener diode */
+  826,      /* quartz crystal */
+  853       /* OneWire device */
+  #endif
+};
+
+#else
+
 /*
  *  symbol bitmaps
  *  - format:
@@ -152,6 +283,8 @@ const uint8_t SymbolData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 
 /*
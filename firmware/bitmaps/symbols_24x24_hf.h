@@ -30,6 +30,137 @@
 #define SYMBOL_BYTES_Y      24     /* 24 bytes in y direction */
 
 
+#ifdef SYMBOLS_RLE
+
+/*
+ *  compressed symbol bitmaps (SYMBOLS_RLE)
+ *  - same bitmaps as below, each symbol compressed separately
+ *  - each row is XORed with the previous row (first row with zeros),
+ *    i.e. unchanged bytes become zero
+ *  - followed by run-length encoding of the zero bytes
+ *    - control byte: bits #7-4: number of zero bytes (0-15)
+ *                    bits #3-0: number of data bytes following (0-15)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0x21,0x02,0x21,0x70,0x21,0x78,0x72,0x06,0x03,0x12,0x80,0x01,0x12,0xC0,0x78,0x12,
+  0x60,0x70,0x11,0x30,0x21,0x18,0x12,0xFE,0x09,0x12,0xFE,0x09,0x21,0x18,0x12,0x0E,
+  0xB0,0x12,0x1C,0x60,0x28,0x20,0x78,0x1C,0xE0,0x71,0x1C,0x06,0x03,0x22,0x30,0x1C,
+  0x12,0x30,0x0E,0x41,0x70,0x21,0x7A,                                                /* BJT npn */
+
+  0x21,0x02,0x21,0x78,0x21,0x70,0x51,0x30,0x12,0x46,0x33,0x12,0x80,0x01,0x21,0x71,
+  0x12,0xE0,0x79,0x11,0x30,0x21,0x18,0x12,0xFE,0x09,0x12,0xFE,0x09,0x21,0x18,0x12,
+  0x0E,0x30,0x12,0x1C,0x60,0x28,0xC0,0x70,0x1C,0x80,0x79,0x1C,0x06,0x03,0x31,0x1C,
+  0x21,0x0E,0x41,0x78,0x21,0x72,                                                     /* BJT pnp */
+
+  0x21,0x02,0x21,0x38,0x21,0x70,0x71,0x0C,0x1B,0x80,0xF1,0x01,0x0C,0xF0,0x73,0x1E,
+  0x0C,0x38,0x10,0x80,0x21,0x4C,0x18,0x18,0x30,0x03,0x08,0x30,0x01,0x1E,0x4C,0x12,
+  0x0C,0x80,0x21,0x0C,0x16,0x7E,0xF0,0x31,0xFE,0xF1,0x79,0x12,0x0C,0x40,0x21,0x38,
+  0x21,0x70,0x21,0x08,0x21,0x78,0x21,0x32,                                           /* MOSFET enh n-ch */
+
+  0x21,0x02,0x21,0x30,0x21,0x78,0x21,0x40,0x21,0x38,0x18,0x0C,0x70,0xFE,0xF1,0x09,
+  0x7E,0xF0,0x79,0x14,0x0C,0x30,0x0C,0x40,0x12,0x1E,0x8C,0x13,0x10,0x30,0x01,0x14,
+  0x30,0x03,0x18,0x8C,0x12,0x08,0x40,0x12,0x1E,0x0C,0x16,0x0C,0xF0,0x3B,0x80,0xF1,
+  0x71,0x11,0x0C,0xC1,0x70,0x21,0x3A,                                                /* MOSFET enh p-ch */
+
+  0x21,0x02,0x21,0x38,0x21,0x70,0x71,0x0C,0x17,0x80,0xF1,0x01,0x0C,0xF0,0x73,0x1E,
+  0x13,0x38,0x10,0x80,0x21,0x40,0x18,0x18,0x30,0x03,0x08,0x30,0x01,0x1E,0x40,0x12,
+  0x0C,0x80,0x46,0x7E,0xF0,0x31,0xFE,0xF1,0x79,0x12,0x0C,0x40,0x21,0x38,0x21,0x70,
+  0x21,0x08,0x21,0x78,0x21,0x32,                                                     /* MOSFET dep n-ch */
+
+  0x21,0x02,0x21,0x30,0x21,0x78,0x21,0x40,0x21,0x38,0x18,0x0C,0x70,0xFE,0xF1,0x09,
+  0x7E,0xF0,0x79,0x23,0x30,0x0C,0x40,0x12,0x1E,0x80,0x13,0x10,0x30,0x01,0x14,0x30,
+  0x03,0x18,0x80,0x12,0x08,0x40,0x11,0x1E,0x26,0x0C,0xF0,0x3B,0x80,0xF1,0x71,0x11,
+  0x0C,0xC1,0x70,0x21,0x3A,                                                          /* MOSFET dep p-ch */
+
+  0x21,0x02,0x21,0x38,0x21,0x70,0x71,0x0C,0x11,0x0C,0x26,0x1E,0xF0,0x71,0x10,0xF0,
+  0x3B,0x31,0x18,0x21,0x08,0x21,0x1E,0x21,0x4C,0x21,0x80,0x27,0x3E,0xF3,0x03,0x3E,
+  0xF3,0x31,0x80,0x14,0x78,0x40,0x0C,0x40,0x21,0x38,0x21,0x70,0x21,0x08,0x21,0x78,
+  0x21,0x32,                                                                         /* JFET n-ch */
+
+  0x21,0x02,0x21,0x30,0x21,0x78,0x21,0x40,0x25,0x38,0x80,0x0C,0x70,0x40,0x18,0x08,
+  0x3E,0xF3,0x79,0x3E,0xF3,0x33,0x40,0x21,0x8C,0x21,0x1E,0x21,0x10,0x51,0x18,0x27,
+  0x08,0xF0,0x03,0x1E,0xF0,0x39,0x0C,0x11,0x70,0x11,0x0C,0xC1,0x70,0x21,0x3A,        /* JFET p-ch */
+
+  0x21,0x02,0x21,0x70,0x21,0x78,0x71,0x0C,0x34,0x03,0x80,0x81,0x79,0x12,0xC0,0x70,
+  0x11,0x60,0x21,0x30,0x12,0x7E,0x10,0x12,0x7E,0x10,0x21,0xB0,0x12,0x0C,0x60,0x12,
+  0x1E,0x20,0x13,0x90,0xE1,0x79,0x23,0x73,0x18,0x0C,0x11,0x08,0x12,0x30,0x1E,0x12,
+  0x30,0x0C,0x41,0x70,0x21,0x7A,                                                     /* IGBT enh n-ch */
+
+  0x21,0x02,0x21,0x78,0x21,0x70,0x51,0x30,0x12,0x0C,0x30,0x15,0x40,0x03,0x80,0x81,
+  0x71,0x21,0x79,0x12,0xE0,0x01,0x11,0x30,0x12,0x7E,0x10,0x12,0x7E,0x10,0x21,0x30,
+  0x12,0x0C,0x60,0x12,0x1E,0xC0,0x13,0x90,0x81,0x71,0x23,0x7B,0x18,0x0C,0x11,0x08,
+  0x21,0x1E,0x21,0x0C,0x41,0x78,0x21,0x72,                                           /* IGBT enh p-ch */
+
+  0x11,0x10,0x31,0x03,0x12,0x80,0x07,0x51,0x03,0x21,0x03,0x46,0x80,0x04,0x80,0xEF,
+  0x03,0x80,0x11,0x02,0x14,0x01,0x01,0x0C,0x82,0x12,0x1E,0x44,0x12,0x10,0x28,0x14,
+  0x98,0xEF,0x03,0x08,0x26,0x9E,0xE7,0x03,0x0C,0x0C,0x07,0x14,0x86,0x07,0xFE,0x03,
+  0x12,0xFE,0x01,0x52,0x80,0x07,0x12,0x10,0x07,                                      /* SCR */
+
+  0x12,0x20,0x05,0xB1,0x05,0x33,0xE0,0xDF,0x3F,0x33,0xE0,0x3D,0x20,0x11,0x05,0x24,
+  0x40,0x10,0x80,0x08,0x15,0x06,0x80,0x08,0x4F,0x10,0x11,0x08,0x15,0x05,0x2C,0xE0,
+  0x3D,0x04,0x25,0xEF,0xDD,0x3F,0x06,0x03,0x14,0x80,0x01,0x02,0xFF,0x21,0x7F,0x62,
+  0x20,0x02,                                                                         /* Triac */
+
+  0x11,0x10,0x31,0x03,0x12,0x80,0x07,0x36,0xFE,0x01,0x03,0xFE,0x03,0x03,0x11,0x06,
+  0x17,0x0C,0x8C,0x04,0x9E,0xE7,0x03,0x90,0x16,0x02,0x18,0x01,0x01,0x08,0x82,0x12,
+  0x1E,0x44,0x12,0x0C,0x28,0x13,0x80,0xEF,0x03,0x33,0x80,0xEF,0x03,0x21,0x07,0x12,
+  0x80,0x07,0xA2,0x80,0x07,0x12,0x10,0x07,                                           /* PUT */
+
+  0x21,0x02,0x21,0x28,0xA1,0x0C,0x11,0x1E,0x18,0x28,0x3E,0xF0,0x01,0x60,0xF1,0x03,
+  0xDE,0x21,0x5C,0x22,0xC0,0x03,0x12,0x0C,0x02,0x11,0x0C,0x56,0x1C,0xF0,0x03,0x1E,
+  0xF0,0x01,0x21,0x10,0x11,0x0C,0xC1,0x10,0x21,0x02                                  /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  0xF0,0x11,0x3C,0x21,0xC3,0x21,0x3C,0x13,0x80,0x42,0x01,0x63,0x80,0x41,0x01,0x11,
+  0x20,0x21,0x90,0x21,0x48,0x21,0x24,0x81,0x1C,0x51,0x1C,0x81,0x1C,0x10,             /* question mark */
+
+  0x42,0x50,0x02,0x21,0x03,0x12,0x80,0x01,0x12,0x80,0x01,0x24,0x03,0x40,0x40,0x02,
+  0x36,0x80,0xEF,0x07,0xC0,0xEF,0x03,0x11,0x28,0x22,0x44,0x04,0x11,0x82,0x23,0x01,
+  0x01,0x80,0x12,0x02,0x40,0x14,0x04,0xC0,0xEF,0x07,0x42,0x80,0x01,0x12,0xC0,0x03,
+  0x12,0x80,0x01,0x12,0x80,0x01,0x42,0x50,0x02,                                      /* Zener diode */
+
+  0x41,0x10,0xF0,0x49,0x80,0xEF,0x03,0x80,0xFF,0x03,0xE0,0xFF,0x0F,0x99,0xE0,0xFF,
+  0x0F,0x80,0xFF,0x03,0x80,0xEF,0x03,0xF0,0x41,0x10,0x10,                            /* quartz crystal */
+
+  0x51,0x12,0x21,0x05,0x21,0x05,0x1A,0x7E,0x02,0xC0,0xBD,0x0F,0x80,0xBD,0x0F,0x0E,
+  0x7E,0x12,0x1C,0x7F,0x21,0x3E,0x26,0x80,0x0F,0x1C,0x80,0x1F,0x0E,0x21,0xBE,0x21,
+  0xFE,0x62,0x80,0x1F,0x12,0x80,0x0F,0x11,0x3E,0x21,0x7F,0x91,0x07,0x21,0x17         /* OneWire device */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed symbols in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  55,       /* BJT pnp */
+  109,      /* MOSFET enh n-ch */
+  165,      /* MOSFET enh p-ch */
+  220,      /* MOSFET dep n-ch */
+  274,      /* MOSFET dep p-ch */
+  327,      /* JFET n-ch */
+  377,      /* JFET p-ch */
+  424,      /* IGBT enh n-ch */
+  478,      /* IGBT enh p-ch */
+  534,      /* SCR */
+  591,      /* Triac */
+  641,      /* PUT */
+  697       /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  739,      /* question mark */
+  769,      /* Zener diode */
+  826,      /* quartz crystal */
+  853       /* OneWire device */
+  #endif
+};
+
+#else
+
 /*
  *  symbol bitmaps
  *  - format:
@@ -152,6 +283,8 @@ const uint8_t SymbolData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 
 /*
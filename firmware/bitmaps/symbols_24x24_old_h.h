@@ -30,6 +30,136 @@
 #define SYMBOL_BYTES_Y      24     /* 24 bytes in y direction */
 
 
+#ifdef SYMBOLS_RLE
+
+/*
+ *  compressed symbol bitmaps (SYMBOLS_RLE)
+ *  - same bitmaps as below, each symbol compressed separately
+ *  - each row is XORed with the previous row (first row with zeros),
+ *    i.e. unchanged bytes become zero
+ *  - followed by run-length encoding of the zero bytes
+ *    - control byte: bits #7-4: number of zero bytes (0-15)
+ *                    bits #3-0: number of data bytes following (0-15)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0x21,0x40,0x41,0x3E,0x26,0xFF,0x80,0x03,0xC1,0xA0,0x07,0x11,0xF0,0x15,0x61,0x80,
+  0x0C,0x03,0x18,0x11,0x06,0x13,0x18,0x0C,0x0C,0x11,0x18,0x12,0xEF,0x90,0x12,0xEF,
+  0x90,0x21,0x18,0x13,0x18,0x0D,0x0C,0x11,0x06,0x13,0x0C,0x04,0x18,0x13,0x67,0x80,
+  0x07,0x14,0xF0,0x03,0xC1,0xA0,0x12,0xFF,0x80,0x11,0x3E,0x61,0x40,                  /* BJT npn */
+
+  0x21,0x40,0x41,0x3E,0x26,0xFF,0x80,0x03,0xC1,0xA0,0x07,0x11,0xF0,0x15,0x65,0x80,
+  0x0C,0x03,0x18,0x11,0x01,0x13,0x18,0x0F,0x0C,0x11,0x18,0x12,0xEF,0x90,0x12,0xEF,
+  0x90,0x21,0x18,0x13,0x18,0x0C,0x0C,0x11,0x06,0x13,0x0C,0x03,0x18,0x13,0x61,0x80,
+  0x07,0x14,0xF0,0x03,0xC1,0xA0,0x12,0xFF,0x80,0x11,0x3E,0x61,0x40,                  /* BJT pnp */
+
+  0x21,0x40,0x41,0x3E,0x28,0xFF,0x80,0x03,0xC1,0xA0,0x07,0x20,0x30,0x15,0x9F,0x80,
+  0x0C,0x1F,0xD8,0x11,0x20,0x13,0x18,0x02,0x0C,0x11,0x24,0x22,0x19,0xC0,0x12,0x19,
+  0x80,0x11,0x24,0x13,0x18,0x02,0x0C,0x11,0x20,0x1C,0xF7,0x1F,0x98,0xFB,0x9F,0x80,
+  0x07,0x20,0x30,0x03,0xC1,0xA0,0x12,0xFF,0x80,0x11,0x3E,0x61,0x40,                  /* MOSFET enh n-ch */
+
+  0x21,0x40,0x41,0x3E,0x2E,0xFF,0x80,0x03,0xC1,0xA0,0x07,0x20,0x30,0xFB,0x9F,0x80,
+  0xF7,0x1F,0x98,0x11,0x20,0x13,0x18,0x04,0x0C,0x11,0x22,0x22,0x19,0x80,0x12,0x19,
+  0xC0,0x11,0x22,0x13,0x18,0x04,0x0C,0x11,0x20,0x13,0x0C,0x1F,0xD8,0x18,0x9F,0x80,
+  0x07,0x20,0x30,0x03,0xC1,0xA0,0x12,0xFF,0x80,0x11,0x3E,0x61,0x40,                  /* MOSFET enh p-ch */
+
+  0x21,0x40,0x41,0x3E,0x28,0xFF,0x80,0x03,0xC1,0xA0,0x07,0x20,0x30,0x15,0x9F,0x80,
+  0x0C,0x1F,0xD8,0x33,0x18,0x02,0x0C,0x11,0x04,0x22,0x19,0xC0,0x12,0x19,0x80,0x11,
+  0x04,0x13,0x18,0x02,0x0C,0x3C,0xF7,0x1F,0x98,0xFB,0x9F,0x80,0x07,0x20,0x30,0x03,
+  0xC1,0xA0,0x12,0xFF,0x80,0x11,0x3E,0x61,0x40,                                      /* MOSFET dep n-ch */
+
+  0x21,0x40,0x41,0x3E,0x2E,0xFF,0x80,0x03,0xC1,0xA0,0x07,0x20,0x30,0xFB,0x9F,0x80,
+  0xF7,0x1F,0x98,0x33,0x18,0x04,0x0C,0x11,0x02,0x22,0x19,0x80,0x12,0x19,0xC0,0x11,
+  0x02,0x13,0x18,0x04,0x0C,0x33,0x0C,0x1F,0xD8,0x18,0x9F,0x80,0x07,0x20,0x30,0x03,
+  0xC1,0xA0,0x12,0xFF,0x80,0x11,0x3E,0x61,0x40,                                      /* MOSFET dep p-ch */
+
+  0x21,0x40,0x41,0x3E,0x28,0xFF,0x80,0x03,0xC1,0xA0,0x07,0x10,0x30,0x33,0x0C,0x0F,
+  0x98,0x13,0x0F,0xC0,0x18,0x11,0x0C,0xA1,0x80,0x19,0x18,0x40,0x0C,0xF7,0x2F,0xC0,
+  0xFB,0x2F,0x98,0x11,0x40,0x16,0x07,0x90,0x30,0x03,0xC1,0xA0,0x12,0xFF,0x80,0x11,
+  0x3E,0x61,0x40,                                                                    /* JFET n-ch */
+
+  0x21,0x40,0x41,0x3E,0x28,0xFF,0x80,0x03,0xC1,0xA0,0x07,0x50,0x30,0x11,0x80,0x19,
+  0xFB,0x2F,0x98,0xF7,0x2F,0xC0,0x18,0x80,0x0C,0x11,0x40,0xA1,0x18,0x11,0x0C,0x15,
+  0x0F,0xC0,0x0C,0x0F,0x98,0x36,0x07,0x10,0x30,0x03,0xC1,0xA0,0x12,0xFF,0x80,0x11,
+  0x3E,0x61,0x40,                                                                    /* JFET p-ch */
+
+  0x21,0x40,0x41,0x3E,0x26,0xFF,0x80,0x03,0xC1,0xA0,0x07,0x11,0xF0,0x15,0x21,0x80,
+  0x0C,0x83,0x18,0x11,0x06,0x13,0x18,0x0C,0x0C,0x11,0x18,0x12,0xEF,0x10,0x12,0xEF,
+  0x10,0x21,0x18,0x13,0x18,0x0D,0x0C,0x11,0x06,0x13,0x0C,0x84,0x18,0x13,0x27,0x80,
+  0x07,0x14,0xF0,0x03,0xC1,0xA0,0x12,0xFF,0x80,0x11,0x3E,0x61,0x40,                  /* IGBT enh n-ch */
+
+  0x21,0x40,0x41,0x3E,0x26,0xFF,0x80,0x03,0xC1,0xA0,0x07,0x11,0xF0,0x15,0x25,0x80,
+  0x0C,0x83,0x18,0x11,0x01,0x13,0x18,0x0F,0x0C,0x11,0x18,0x12,0xEF,0x10,0x12,0xEF,
+  0x10,0x21,0x18,0x13,0x18,0x0C,0x0C,0x11,0x06,0x13,0x0C,0x83,0x18,0x13,0x21,0x80,
+  0x07,0x14,0xF0,0x03,0xC1,0xA0,0x12,0xFF,0x80,0x11,0x3E,0x61,0x40,                  /* IGBT enh p-ch */
+
+  0x41,0x08,0xA4,0x01,0xF7,0xC0,0x01,0x11,0x40,0x42,0x80,0x80,0x41,0x41,0x51,0x22,
+  0x51,0x14,0x16,0x01,0xF7,0xC0,0x01,0xE7,0xC0,0x11,0x30,0x21,0x60,0x12,0x7F,0xC0,
+  0x12,0x7F,0x80,0x81,0x08,0x10,                                                     /* SCR */
+
+  0x41,0x08,0xF0,0x15,0x1F,0xF7,0xFC,0x1E,0xF8,0x13,0x02,0x84,0x04,0x33,0x04,0x42,
+  0x08,0x33,0x08,0x21,0x10,0x33,0x10,0x10,0xA0,0x16,0x0F,0xBC,0x1E,0xF7,0xFC,0x03,
+  0x21,0x06,0x21,0xFC,0x21,0xF8,0x80,                                                /* Triac */
+
+  0x41,0x08,0x72,0x7F,0x80,0x12,0x7F,0xC0,0x21,0x60,0x21,0x30,0x14,0x01,0xE7,0xC0,
+  0x01,0x11,0x40,0x42,0x80,0x80,0x41,0x41,0x51,0x22,0x51,0x14,0x16,0x01,0xF7,0xC0,
+  0x01,0xF7,0xC0,0xA1,0x08,0x10,                                                     /* PUT */
+
+  0x21,0x40,0x41,0x3E,0x29,0xFF,0x80,0x03,0xC1,0xA0,0x07,0x10,0x30,0xF8,0x2A,0xF6,
+  0x0F,0x98,0x03,0x4F,0xC0,0x19,0x80,0x0C,0x01,0x22,0x01,0xE0,0x21,0x20,0x41,0x18,
+  0x11,0x0C,0x15,0x0F,0xC0,0x0C,0x0F,0x98,0x36,0x07,0x10,0x30,0x03,0xC1,0xA0,0x12,
+  0xFF,0x80,0x11,0x3E,0x61,0x40                                                      /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  0xF0,0x11,0x3C,0x21,0xC3,0x21,0x3C,0x13,0x01,0x42,0x80,0x63,0x01,0x82,0x80,0x11,
+  0x04,0x21,0x09,0x21,0x12,0x21,0x24,0x81,0x38,0x51,0x38,0x81,0x38,0x10,             /* question mark */
+
+  0x42,0x0A,0x40,0x21,0xC0,0x12,0x01,0x80,0x12,0x01,0x80,0x24,0xC0,0x02,0x02,0x40,
+  0x36,0x01,0xF7,0xE0,0x03,0xF7,0xC0,0x11,0x14,0x22,0x22,0x20,0x11,0x41,0x23,0x80,
+  0x80,0x01,0x12,0x40,0x02,0x14,0x20,0x03,0xF7,0xE0,0x42,0x01,0x80,0x12,0x03,0xC0,
+  0x12,0x01,0x80,0x12,0x01,0x80,0x42,0x0A,0x40,                                      /* Zener diode */
+
+  0x41,0x08,0xF0,0x49,0x01,0xF7,0xC0,0x01,0xFF,0xC0,0x07,0xFF,0xF0,0x99,0x07,0xFF,
+  0xF0,0x01,0xFF,0xC0,0x01,0xF7,0xC0,0xF0,0x41,0x08,0x10,                            /* quartz crystal */
+
+  0x51,0x48,0x21,0xA0,0x21,0xA0,0x1A,0x7E,0x40,0x03,0xBD,0xF0,0x01,0xBD,0xF0,0x70,
+  0x7E,0x12,0x38,0xFE,0x21,0x7C,0x26,0x01,0xF0,0x38,0x01,0xF8,0x70,0x21,0x7D,0x21,
+  0x7F,0x62,0x01,0xF8,0x12,0x01,0xF0,0x11,0x7C,0x21,0xFE,0x91,0xE0,0x21,0xE8         /* OneWire device */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed symbols in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  61,       /* BJT pnp */
+  122,      /* MOSFET enh n-ch */
+  183,      /* MOSFET enh p-ch */
+  244,      /* MOSFET dep n-ch */
+  301,      /* MOSFET dep p-ch */
+  358,      /* JFET n-ch */
+  409,      /* JFET p-ch */
+  460,      /* IGBT enh n-ch */
+  521,      /* IGBT enh p-ch */
+  582,      /* SCR */
+  620,      /* Triac */
+  659,      /* PUT */
+  697       /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  751,      /* question mark */
+  781,      /* Zener diode */
+  838,      /* quartz crystal */
+  865       /* OneWire device */
+  #endif
+};
+
+#else
+
 /*
  *  symbol bitmaps
  *  - format:
@@ -152,6 +282,8 @@ const uint8_t SymbolData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 
 /*
@@ -30,6 +30,136 @@
 #define SYMBOL_BYTES_Y      24     /* 24 bytes in y direction */
 
 
+#ifdef SYMBOLS_RLE
+
+/*
+ *  compressed symbol bitmaps (SYMBOLS_RLE)
+ *  - same bitmaps as below, each symbol compressed separately
+ *  - each row is XORed with the previous row (first row with zeros),
+ *    i.e. unchanged bytes become zero
+ *  - followed by run-length encoding of the zero bytes
+ *    - control byte: bits #7-4: number of zero bytes (0-15)
+ *                    bits #3-0: number of data bytes following (0-15)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0x21,0x02,0x41,0x7C,0x26,0xFF,0x01,0xC0,0x83,0x05,0xE0,0x11,0x0F,0x15,0x86,0x01,
+  0x30,0xC0,0x18,0x11,0x60,0x13,0x18,0x30,0x30,0x11,0x18,0x12,0xF7,0x09,0x12,0xF7,
+  0x09,0x21,0x18,0x13,0x18,0xB0,0x30,0x11,0x60,0x13,0x30,0x20,0x18,0x13,0xE6,0x01,
+  0xE0,0x14,0x0F,0xC0,0x83,0x05,0x12,0xFF,0x01,0x11,0x7C,0x61,0x02,                  /* BJT npn */
+
+  0x21,0x02,0x41,0x7C,0x26,0xFF,0x01,0xC0,0x83,0x05,0xE0,0x11,0x0F,0x15,0xA6,0x01,
+  0x30,0xC0,0x18,0x11,0x80,0x13,0x18,0xF0,0x30,0x11,0x18,0x12,0xF7,0x09,0x12,0xF7,
+  0x09,0x21,0x18,0x13,0x18,0x30,0x30,0x11,0x60,0x13,0x30,0xC0,0x18,0x13,0x86,0x01,
+  0xE0,0x14,0x0F,0xC0,0x83,0x05,0x12,0xFF,0x01,0x11,0x7C,0x61,0x02,                  /* BJT pnp */
+
+  0x21,0x02,0x41,0x7C,0x28,0xFF,0x01,0xC0,0x83,0x05,0xE0,0x04,0x0C,0x15,0xF9,0x01,
+  0x30,0xF8,0x1B,0x11,0x04,0x13,0x18,0x40,0x30,0x11,0x24,0x22,0x98,0x03,0x12,0x98,
+  0x01,0x11,0x24,0x13,0x18,0x40,0x30,0x11,0x04,0x1C,0xEF,0xF8,0x19,0xDF,0xF9,0x01,
+  0xE0,0x04,0x0C,0xC0,0x83,0x05,0x12,0xFF,0x01,0x11,0x7C,0x61,0x02,                  /* MOSFET enh n-ch */
+
+  0x21,0x02,0x41,0x7C,0x2E,0xFF,0x01,0xC0,0x83,0x05,0xE0,0x04,0x0C,0xDF,0xF9,0x01,
+  0xEF,0xF8,0x19,0x11,0x04,0x13,0x18,0x20,0x30,0x11,0x44,0x22,0x98,0x01,0x12,0x98,
+  0x03,0x11,0x44,0x13,0x18,0x20,0x30,0x11,0x04,0x13,0x30,0xF8,0x1B,0x18,0xF9,0x01,
+  0xE0,0x04,0x0C,0xC0,0x83,0x05,0x12,0xFF,0x01,0x11,0x7C,0x61,0x02,                  /* MOSFET enh p-ch */
+
+  0x21,0x02,0x41,0x7C,0x28,0xFF,0x01,0xC0,0x83,0x05,0xE0,0x04,0x0C,0x15,0xF9,0x01,
+  0x30,0xF8,0x1B,0x33,0x18,0x40,0x30,0x11,0x20,0x22,0x98,0x03,0x12,0x98,0x01,0x11,
+  0x20,0x13,0x18,0x40,0x30,0x3C,0xEF,0xF8,0x19,0xDF,0xF9,0x01,0xE0,0x04,0x0C,0xC0,
+  0x83,0x05,0x12,0xFF,0x01,0x11,0x7C,0x61,0x02,                                      /* MOSFET dep n-ch */
+
+  0x21,0x02,0x41,0x7C,0x2E,0xFF,0x01,0xC0,0x83,0x05,0xE0,0x04,0x0C,0xDF,0xF9,0x01,
+  0xEF,0xF8,0x19,0x33,0x18,0x20,0x30,0x11,0x40,0x22,0x98,0x01,0x12,0x98,0x03,0x11,
+  0x40,0x13,0x18,0x20,0x30,0x33,0x30,0xF8,0x1B,0x18,0xF9,0x01,0xE0,0x04,0x0C,0xC0,
+  0x83,0x05,0x12,0xFF,0x01,0x11,0x7C,0x61,0x02,                                      /* MOSFET dep p-ch */
+
+  0x21,0x02,0x41,0x7C,0x28,0xFF,0x01,0xC0,0x83,0x05,0xE0,0x08,0x0C,0x33,0x30,0xF0,
+  0x19,0x13,0xF0,0x03,0x18,0x11,0x30,0xA1,0x01,0x19,0x18,0x02,0x30,0xEF,0xF4,0x03,
+  0xDF,0xF4,0x19,0x11,0x02,0x16,0xE0,0x09,0x0C,0xC0,0x83,0x05,0x12,0xFF,0x01,0x11,
+  0x7C,0x61,0x02,                                                                    /* JFET n-ch */
+
+  0x21,0x02,0x41,0x7C,0x28,0xFF,0x01,0xC0,0x83,0x05,0xE0,0x0A,0x0C,0x11,0x01,0x19,
+  0xDF,0xF4,0x19,0xEF,0xF4,0x03,0x18,0x01,0x30,0x11,0x02,0xA1,0x18,0x11,0x30,0x15,
+  0xF0,0x03,0x30,0xF0,0x19,0x36,0xE0,0x08,0x0C,0xC0,0x83,0x05,0x12,0xFF,0x01,0x11,
+  0x7C,0x61,0x02,                                                                    /* JFET p-ch */
+
+  0x21,0x02,0x41,0x7C,0x26,0xFF,0x01,0xC0,0x83,0x05,0xE0,0x11,0x0F,0x15,0x84,0x01,
+  0x30,0xC1,0x18,0x11,0x60,0x13,0x18,0x30,0x30,0x11,0x18,0x12,0xF7,0x08,0x12,0xF7,
+  0x08,0x21,0x18,0x13,0x18,0xB0,0x30,0x11,0x60,0x13,0x30,0x21,0x18,0x13,0xE4,0x01,
+  0xE0,0x14,0x0F,0xC0,0x83,0x05,0x12,0xFF,0x01,0x11,0x7C,0x61,0x02,                  /* IGBT enh n-ch */
+
+  0x21,0x02,0x41,0x7C,0x26,0xFF,0x01,0xC0,0x83,0x05,0xE0,0x11,0x0F,0x15,0xA4,0x01,
+  0x30,0xC1,0x18,0x11,0x80,0x13,0x18,0xF0,0x30,0x11,0x18,0x12,0xF7,0x08,0x12,0xF7,
+  0x08,0x21,0x18,0x13,0x18,0x30,0x30,0x11,0x60,0x13,0x30,0xC1,0x18,0x13,0x84,0x01,
+  0xE0,0x14,0x0F,0xC0,0x83,0x05,0x12,0xFF,0x01,0x11,0x7C,0x61,0x02,                  /* IGBT enh p-ch */
+
+  0x41,0x10,0xA4,0x80,0xEF,0x03,0x80,0x11,0x02,0x42,0x01,0x01,0x41,0x82,0x51,0x44,
+  0x51,0x28,0x16,0x80,0xEF,0x03,0x80,0xE7,0x03,0x11,0x0C,0x21,0x06,0x12,0xFE,0x03,
+  0x12,0xFE,0x01,0x81,0x10,0x10,                                                     /* SCR */
+
+  0x41,0x10,0xF0,0x15,0xF8,0xEF,0x3F,0x78,0x1F,0x13,0x40,0x21,0x20,0x33,0x20,0x42,
+  0x10,0x33,0x10,0x84,0x08,0x33,0x08,0x08,0x05,0x16,0xF0,0x3D,0x78,0xEF,0x3F,0xC0,
+  0x21,0x60,0x21,0x3F,0x21,0x1F,0x80,                                                /* Triac */
+
+  0x41,0x10,0x72,0xFE,0x01,0x12,0xFE,0x03,0x21,0x06,0x21,0x0C,0x14,0x80,0xE7,0x03,
+  0x80,0x11,0x02,0x42,0x01,0x01,0x41,0x82,0x51,0x44,0x51,0x28,0x16,0x80,0xEF,0x03,
+  0x80,0xEF,0x03,0xA1,0x10,0x10,                                                     /* PUT */
+
+  0x21,0x02,0x41,0x7C,0x29,0xFF,0x01,0xC0,0x83,0x05,0xE0,0x08,0x0C,0x1F,0x2A,0x6F,
+  0xF0,0x19,0xC0,0xF2,0x03,0x98,0x01,0x30,0x80,0x22,0x80,0x07,0x21,0x04,0x41,0x18,
+  0x11,0x30,0x15,0xF0,0x03,0x30,0xF0,0x19,0x36,0xE0,0x08,0x0C,0xC0,0x83,0x05,0x12,
+  0xFF,0x01,0x11,0x7C,0x61,0x02                                                      /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  0xF0,0x11,0x3C,0x21,0xC3,0x21,0x3C,0x13,0x80,0x42,0x01,0x63,0x80,0x41,0x01,0x11,
+  0x20,0x21,0x90,0x21,0x48,0x21,0x24,0x81,0x1C,0x51,0x1C,0x81,0x1C,0x10,             /* question mark */
+
+  0x42,0x50,0x02,0x21,0x03,0x12,0x80,0x01,0x12,0x80,0x01,0x24,0x03,0x40,0x40,0x02,
+  0x36,0x80,0xEF,0x07,0xC0,0xEF,0x03,0x11,0x28,0x22,0x44,0x04,0x11,0x82,0x23,0x01,
+  0x01,0x80,0x12,0x02,0x40,0x14,0x04,0xC0,0xEF,0x07,0x42,0x80,0x01,0x12,0xC0,0x03,
+  0x12,0x80,0x01,0x12,0x80,0x01,0x42,0x50,0x02,                                      /* Zener diode */
+
+  0x41,0x10,0xF0,0x49,0x80,0xEF,0x03,0x80,0xFF,0x03,0xE0,0xFF,0x0F,0x99,0xE0,0xFF,
+  0x0F,0x80,0xFF,0x03,0x80,0xEF,0x03,0xF0,0x41,0x10,0x10,                            /* quartz crystal */
+
+  0x51,0x12,0x21,0x05,0x21,0x05,0x1A,0x7E,0x02,0xC0,0xBD,0x0F,0x80,0xBD,0x0F,0x0E,
+  0x7E,0x12,0x1C,0x7F,0x21,0x3E,0x26,0x80,0x0F,0x1C,0x80,0x1F,0x0E,0x21,0xBE,0x21,
+  0xFE,0x62,0x80,0x1F,0x12,0x80,0x0F,0x11,0x3E,0x21,0x7F,0x91,0x07,0x21,0x17         /* OneWire device */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed symbols in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  61,       /* BJT pnp */
+  122,      /* MOSFET enh n-ch */
+  183,      /* MOSFET enh p-ch */
+  244,      /* MOSFET dep n-ch */
+  301,      /* MOSFET dep p-ch */
+  358,      /* JFET n-ch */
+  409,      /* JFET p-ch */
+  460,      /* IGBT enh n-ch */
+  521,      /* IGBT enh p-ch */
+  582,      /* SCR */
+  620,      /* Triac */
+  659,      /* PUT */
+  697       /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  751,      /* question mark */
+  781,      /* Zener diode */
+  838,      /* quartz crystal */
+  865       /* OneWire device */
+  #endif
+};
+
+#else
+
 /*
  *  symbol bitmaps
  *  - format:
@@ -152,6 +282,8 @@ const uint8_t SymbolData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 
 /*
@@ -29,6 +29,169 @@
 #define SYMBOL_BYTES_Y      32     /* 32 bytes in y direction */
 
 
+#ifdef SYMBOLS_RLE
+
+/*
+ *  compressed symbol bitmaps (SYMBOLS_RLE)
+ *  - same bitmaps as below, each symbol compressed separately
+ *  - each row is XORed with the previous row (first row with zeros),
+ *    i.e. unchanged bytes become zero
+ *  - followed by run-length encoding of the zero bytes
+ *    - control byte: bits #7-4: number of zero bytes (0-15)
+ *                    bits #3-0: number of data bytes following (0-15)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0x22,0xE0,0x10,0x22,0xF0,0x01,0x31,0x01,0xB1,0x01,0x23,0xF0,0x19,0x78,0x13,0xE0,
+  0x0C,0xF0,0x12,0x06,0x06,0x32,0x03,0xF0,0x13,0x80,0x01,0xF0,0x11,0xC0,0x31,0x60,
+  0x11,0xF0,0x11,0x30,0x11,0x78,0x11,0x18,0x13,0xFC,0xFF,0x09,0x13,0xFC,0xFF,0x09,
+  0x31,0x18,0x32,0x30,0x02,0x22,0x60,0x01,0x21,0xC0,0x31,0x40,0x31,0x20,0x32,0xE6,
+  0x07,0x22,0xF0,0x0D,0x22,0xE0,0x19,0x61,0xE0,0x31,0xE0,0x72,0xE0,0x01,0x22,0xF0,
+  0x11,                                                                              /* BJT npn */
+
+  0x22,0xF0,0x11,0x22,0xE0,0x01,0x61,0xE0,0x31,0xE0,0x73,0xE0,0x19,0x78,0x13,0xF0,
+  0x0D,0xF0,0x12,0x26,0x06,0x23,0x40,0x03,0xF0,0x13,0x80,0x01,0xF0,0x21,0x01,0x32,
+  0x02,0xF0,0x13,0xF0,0x03,0x78,0x11,0x18,0x13,0xFC,0xFF,0x09,0x13,0xFC,0xFF,0x09,
+  0x31,0x18,0x31,0x30,0x31,0x60,0x31,0xC0,0x32,0x80,0x01,0x31,0x03,0x22,0x06,0x06,
+  0x22,0xE0,0x0C,0x22,0xF0,0x19,0x31,0x01,0xB1,0x01,0x22,0xF0,0x01,0x22,0xE0,0x10,   /* BJT pnp */
+
+  0x22,0xE0,0x10,0x22,0xC0,0x01,0x31,0x03,0xB1,0x03,0x13,0x36,0xC0,0x01,0x21,0xE0,
+  0x23,0xC0,0xFF,0x0F,0x13,0xC0,0xFF,0x1D,0x51,0x30,0x41,0x04,0x22,0x30,0x02,0x32,
+  0xC1,0x1D,0x18,0xC0,0xD8,0x1D,0x38,0xC0,0x08,0x05,0x7C,0x17,0x81,0x08,0x40,0x30,
+  0x42,0x10,0x60,0x14,0xC4,0x1D,0x20,0x30,0x6F,0x7C,0xC0,0xEF,0x1D,0x38,0xC0,0xFF,
+  0x0F,0xFE,0x01,0xC0,0x01,0xFE,0x37,0xE0,0x01,0x03,0x31,0x02,0x22,0xE0,0x01,0x22,
+  0xC0,0x03,0x21,0x20,0x32,0xE0,0x03,0x22,0xC0,0x11,                                 /* MOSFET enh n-ch */
+
+  0x22,0xC0,0x11,0x22,0xE0,0x03,0x31,0x02,0x22,0xE0,0x01,0x22,0xC0,0x03,0x21,0x20,
+  0x1F,0xFE,0x37,0xE0,0x03,0xFE,0x01,0xC0,0x01,0x38,0xC0,0xFF,0x0F,0x7C,0xC0,0xEF,
+  0x02,0x1D,0x40,0x32,0x60,0x30,0x21,0x20,0x11,0x01,0x22,0x30,0x02,0x11,0x7C,0x16,
+  0xC4,0x1D,0x38,0xC0,0xC8,0x1D,0x13,0xC0,0x18,0x05,0x22,0x84,0x08,0x13,0x30,0x42,
+  0x10,0x22,0xC1,0x1D,0x11,0x30,0x73,0xC0,0xFF,0x1D,0x13,0xC0,0xFF,0x0F,0x21,0xE0,
+  0x23,0x36,0xC0,0x01,0x31,0x03,0xB1,0x03,0x22,0xC0,0x01,0x22,0xE0,0x10,             /* MOSFET enh p-ch */
+
+  0x22,0xE0,0x10,0x22,0xC0,0x01,0x31,0x03,0xB1,0x03,0x13,0x36,0xC0,0x01,0x21,0xE0,
+  0x23,0xC0,0xFF,0x0F,0x13,0xC0,0xFF,0x1D,0xA1,0x04,0x31,0x02,0x32,0xC1,0x1D,0x18,
+  0xC0,0xD8,0x1D,0x38,0xC0,0x08,0x05,0x7C,0x13,0x81,0x08,0x40,0x13,0x42,0x10,0x60,
+  0x13,0xC4,0x1D,0x20,0x7F,0x7C,0xC0,0xEF,0x1D,0x38,0xC0,0xFF,0x0F,0xFE,0x01,0xC0,
+  0x01,0xFE,0x37,0xE0,0x01,0x03,0x31,0x02,0x22,0xE0,0x01,0x22,0xC0,0x03,0x21,0x20,
+  0x32,0xE0,0x03,0x22,0xC0,0x11,                                                     /* MOSFET dep n-ch */
+
+  0x22,0xC0,0x11,0x22,0xE0,0x03,0x31,0x02,0x22,0xE0,0x01,0x22,0xC0,0x03,0x21,0x20,
+  0x1F,0xFE,0x37,0xE0,0x03,0xFE,0x01,0xC0,0x01,0x38,0xC0,0xFF,0x0F,0x7C,0xC0,0xEF,
+  0x02,0x1D,0x40,0x31,0x60,0x31,0x20,0x11,0x01,0x31,0x02,0x11,0x7C,0x16,0xC4,0x1D,
+  0x38,0xC0,0xC8,0x1D,0x13,0xC0,0x18,0x05,0x22,0x84,0x08,0x22,0x42,0x10,0x22,0xC1,
+  0x1D,0x93,0xC0,0xFF,0x1D,0x13,0xC0,0xFF,0x0F,0x21,0xE0,0x23,0x36,0xC0,0x01,0x31,
+  0x03,0xB1,0x03,0x22,0xC0,0x01,0x22,0xE0,0x10,                                      /* MOSFET dep p-ch */
+
+  0x01,0x38,0x13,0xC0,0x11,0x7C,0x13,0xE0,0x03,0x40,0x22,0x02,0x60,0x13,0xE0,0x01,
+  0x20,0x12,0xC0,0x03,0x12,0x02,0x20,0x1F,0x7C,0x84,0xE1,0x03,0x38,0x08,0xC0,0x01,
+  0xFE,0x71,0xFE,0x0F,0xFE,0x71,0xFE,0x01,0x1F,0x11,0x08,0x31,0x04,0x31,0x02,0xF0,
+  0xF0,0xA2,0xFE,0x1F,0x22,0xFE,0x0F,0x21,0xE0,0x23,0x80,0xC1,0x01,0x31,0x03,0xB1,
+  0x03,0x22,0xC0,0x01,0x22,0xE0,0x10,                                                /* JFET n-ch */
+
+  0x22,0xE0,0x10,0x22,0xC0,0x01,0x31,0x03,0xB1,0x03,0x13,0x80,0xC1,0x01,0x21,0xE0,
+  0x32,0xFE,0x0F,0x22,0xFE,0x1F,0xF0,0x11,0x38,0x31,0x7C,0x31,0x40,0x31,0x60,0x31,
+  0x20,0x41,0x10,0x22,0x7C,0x08,0x22,0x38,0x04,0x28,0xFE,0x63,0xFE,0x1F,0xFE,0x63,
+  0xFE,0x0F,0x13,0x04,0xC0,0x01,0x13,0x88,0xE1,0x03,0x11,0x10,0x11,0x02,0x22,0xE0,
+  0x01,0x22,0xC0,0x03,0x21,0x20,0x32,0xE0,0x03,0x22,0xC0,0x11,                       /* JFET p-ch */
+
+  0x22,0x0E,0x10,0x21,0x1F,0x31,0x10,0x81,0x01,0x22,0x10,0x1A,0x22,0x1F,0x0C,0x22,
+  0x0E,0x08,0x13,0x80,0x01,0x10,0x22,0x8C,0x1F,0x21,0xF0,0x31,0x70,0x31,0x0C,0x51,
+  0x38,0x11,0x0C,0x11,0x7C,0x11,0x30,0x11,0x40,0x11,0x70,0x11,0x60,0x11,0xCC,0x11,
+  0x20,0x11,0x80,0x31,0x0C,0x11,0x7C,0x13,0x70,0x04,0x38,0x19,0xF0,0x02,0xFE,0x7F,
+  0x8C,0x01,0xFE,0xFF,0x81,0x31,0x5F,0x32,0xDE,0x0F,0x31,0x18,0x21,0x0E,0x31,0x0E,
+  0x71,0x1E,0x32,0x1F,0x10,                                                          /* IGBT enh n-ch */
+
+  0x01,0x38,0x13,0x1F,0x10,0x7C,0x11,0x1E,0x11,0x40,0x31,0x60,0x11,0x0E,0x11,0x20,
+  0x12,0x0E,0x01,0x32,0x1A,0x7C,0x13,0x1E,0x0C,0x38,0x1A,0x1F,0x08,0xFE,0xFF,0x01,
+  0x10,0xFE,0x7F,0x8C,0x1F,0x21,0xF0,0x31,0x70,0x31,0x0C,0x71,0x0C,0x31,0x30,0x31,
+  0x70,0x31,0xCC,0x31,0x80,0x31,0x0C,0x32,0x70,0x04,0x22,0xF0,0x02,0x22,0x8C,0x01,
+  0x12,0x80,0x81,0x31,0x4E,0x32,0xDF,0x0F,0x22,0x10,0x18,0xA1,0x10,0x31,0x1F,0x32,
+  0x0E,0x10,                                                                         /* IGBT enh p-ch */
+
+  0x22,0x88,0x03,0x22,0xC0,0x07,0x62,0x80,0x03,0x22,0x80,0x03,0xA2,0x40,0x04,0x53,
+  0xFC,0xF7,0x1F,0x11,0x04,0x11,0x10,0x11,0x08,0x11,0x08,0x11,0x10,0x11,0x04,0x11,
+  0x20,0x11,0x02,0x11,0x40,0x11,0x01,0x12,0x80,0x80,0x11,0x38,0x11,0x41,0x11,0x7C,
+  0x11,0x22,0x11,0x40,0x11,0x14,0x15,0x60,0xFC,0xF7,0x1F,0x20,0x44,0xFC,0xF3,0x1F,
+  0x7C,0x11,0x06,0x11,0x38,0x11,0x03,0x18,0xFE,0xFF,0x81,0x03,0xFE,0xFF,0xC0,0x07,
+  0x31,0x04,0xB1,0x04,0x22,0xC0,0x07,0x22,0x88,0x03,                                 /* SCR */
+
+  0x12,0x8E,0x09,0x22,0xDF,0x03,0x21,0x40,0x32,0x0E,0x03,0x22,0x8E,0x01,0x21,0xC0,
+  0x32,0x80,0x03,0x22,0xD1,0x03,0x63,0xFF,0xF7,0x1F,0x13,0x01,0x70,0x1F,0x22,0x40,
+  0x01,0x12,0x02,0x08,0x32,0x20,0x02,0x12,0x04,0x04,0x35,0x10,0x04,0x38,0x08,0x02,
+  0x11,0x7C,0x15,0x08,0x08,0x40,0x10,0x01,0x11,0x60,0x14,0x04,0x10,0x20,0xA0,0x39,
+  0xBE,0x03,0x20,0x7C,0xDE,0xF7,0x3F,0x38,0x30,0x28,0xFE,0x1F,0xC0,0x11,0xFE,0x0F,
+  0xE0,0x0B,0x31,0x08,0x22,0xC0,0x01,0x22,0xC0,0x01,0x71,0x28,0x22,0x28,0x3A,        /* Triac */
+
+  0x22,0x88,0x03,0x22,0xC0,0x07,0x62,0x80,0x03,0x22,0x80,0x03,0x42,0xFE,0xFF,0x25,
+  0xFE,0xFF,0x41,0x04,0x38,0x11,0x03,0x11,0x7C,0x11,0x06,0x16,0x40,0xFC,0xF3,0x1F,
+  0x60,0x04,0x13,0x10,0x20,0x08,0x11,0x08,0x11,0x10,0x13,0x04,0x7C,0x20,0x13,0x02,
+  0x38,0x40,0x11,0x01,0x12,0x80,0x80,0x31,0x41,0x31,0x22,0x31,0x14,0x23,0xFC,0xF7,
+  0x1F,0x53,0xFC,0xF7,0x1F,0x62,0x80,0x03,0x22,0xC0,0x07,0x31,0x04,0xB1,0x04,0x22,
+  0xC0,0x07,0x22,0x88,0x03,                                                          /* PUT */
+
+  0x22,0x1E,0x13,0x22,0xBC,0x07,0x21,0x80,0x32,0x3C,0x06,0x22,0x3C,0x03,0x27,0x80,
+  0x01,0x1E,0xC0,0x3C,0x07,0x3E,0x13,0x9E,0x07,0x60,0x18,0xFF,0x0F,0xC0,0x08,0xFF,
+  0x1F,0xBE,0x05,0x22,0x3C,0x03,0x31,0x01,0x21,0x9C,0x32,0x9C,0x1F,0x31,0x30,0x22,
+  0x3C,0x20,0x21,0x3E,0xF0,0x62,0xFF,0x1F,0x22,0xFF,0x0F,0x22,0x1E,0x01,0x12,0xC0,
+  0xBC,0x31,0x80,0x31,0x3C,0x31,0x3C,0x72,0xBC,0x02,0x22,0x9E,0x13                   /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  0x51,0xF8,0x32,0x06,0x03,0x22,0x01,0x04,0x13,0x80,0xF8,0x08,0x22,0x74,0x01,0x13,
+  0x40,0x7A,0x12,0x22,0x0C,0x40,0x52,0xC0,0x05,0x41,0x12,0x31,0x61,0x22,0x80,0x08,
+  0x22,0x40,0x34,0x22,0x20,0x1A,0x22,0x10,0x0D,0x22,0x88,0x06,0x31,0x03,0xA1,0x78,
+  0x31,0xF0,0x32,0xF0,0x01,0x61,0x30,0x31,0x48,0x41,0x01,0x21,0x48,0x32,0xB0,0x01,
+  0x21,0xE0,0x31,0x60,0x60,                                                          /* question mark */
+
+  0x22,0x48,0x04,0x31,0x06,0x31,0x03,0x22,0x80,0x01,0x22,0x80,0x01,0x31,0x03,0x11,
+  0x04,0x11,0x06,0x22,0x40,0x04,0x53,0xF8,0xF7,0x1F,0x53,0xFC,0xF7,0x0F,0x21,0x14,
+  0x31,0x22,0x32,0x41,0x10,0x12,0x80,0x80,0x21,0x40,0x11,0x01,0x11,0x20,0x11,0x02,
+  0x11,0x10,0x11,0x04,0x11,0x08,0x11,0x08,0x11,0x04,0x11,0x10,0x13,0xFC,0xF7,0x1F,
+  0xA2,0x80,0x03,0x22,0xC0,0x07,0x62,0x80,0x03,0x22,0x80,0x03,0xA2,0x48,0x04,        /* Zener diode */
+
+  0x51,0x80,0xF0,0xF0,0x52,0x7F,0x7F,0x62,0xFF,0x7F,0x14,0xC0,0xFF,0xFF,0x01,0xF0,
+  0x14,0xC0,0xFF,0xFF,0x01,0x12,0xFF,0x7F,0x62,0x7F,0x7F,0xF0,0xF0,0x41,0x80,0x60,   /* quartz crystal */
+
+  0x31,0x11,0x62,0xC0,0x06,0x22,0xC0,0x06,0x12,0xE0,0x3F,0x23,0xC0,0x1F,0x01,0x13,
+  0x1F,0xC0,0x0F,0x13,0x1E,0xC0,0x0F,0x12,0xC0,0x1F,0x13,0x1C,0xE0,0x3F,0x11,0x38,
+  0x33,0x60,0xF0,0x3F,0x73,0xC0,0x0F,0x60,0x13,0xC0,0x1F,0x38,0x31,0x1C,0x32,0xFE,
+  0x0E,0x22,0xFE,0x0F,0xC2,0xC0,0x1F,0x22,0xC0,0x0F,0x52,0xF0,0x3F,0xF0,0x42,0xC0,
+  0x07,0x22,0xC0,0x07,0x31,0x10                                                      /* OneWire device */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed symbols in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  81,       /* BJT pnp */
+  161,      /* MOSFET enh n-ch */
+  251,      /* MOSFET enh p-ch */
+  345,      /* MOSFET dep n-ch */
+  431,      /* MOSFET dep p-ch */
+  520,      /* JFET n-ch */
+  591,      /* JFET p-ch */
+  667,      /* IGBT enh n-ch */
+  752,      /* IGBT enh p-ch */
+  834,      /* SCR */
+  924,      /* Triac */
+  1019,     /* PUT */
+  1104      /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  1181,     /* question mark */
+  1250,     /* Zener diode */
+  1329,     /* quartz crystal */
+  1361      /* OneWire device */
+  #endif
+};
+
+#else
+
 /*
  *  symbol bitmaps
  *  - format:
@@ -205,6 +368,8 @@ const uint8_t SymbolData[] PROGMEM = {
   #endif
 };  
 
+#endif
+
 
 
 /*
@@ -30,6 +30,157 @@
 #define SYMBOL_BYTES_Y      32     /* 32 bytes in y direction */
 
 
+#ifdef SYMBOLS_RLE
+
+/*
+ *  compressed symbol bitmaps (SYMBOLS_RLE)
+ *  - same bitmaps as below, each symbol compressed separately
+ *  - each row is XORed with the previous row (first row with zeros),
+ *    i.e. unchanged bytes become zero
+ *  - followed by run-length encoding of the zero bytes
+ *    - control byte: bits #7-4: number of zero bytes (0-15)
+ *                    bits #3-0: number of data bytes following (0-15)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0x21,0x10,0x41,0x0E,0x31,0x0F,0x22,0x80,0x01,0x91,0x18,0x82,0x98,0x01,0x22,0x0C,
+  0x0F,0x22,0x06,0x0E,0x21,0x03,0x22,0x80,0x01,0x21,0xC0,0x31,0x60,0x22,0xFE,0x27,
+  0x22,0xFE,0x27,0x31,0x60,0x23,0x1E,0xC0,0x04,0x13,0x3C,0x80,0x03,0x61,0x80,0x25,
+  0x3C,0x80,0x8F,0x0F,0x3C,0x12,0x18,0x0F,0x51,0x18,0x21,0x3C,0x22,0x07,0x1E,0x21,
+  0x07,0xB1,0x0F,0x22,0x90,0x0F,                                                     /* BJT npn */
+
+  0x21,0x10,0x32,0x80,0x0F,0x31,0x0F,0xB1,0x07,0x11,0x18,0x11,0x07,0x61,0x19,0x32,
+  0x0E,0x0F,0x22,0x80,0x0F,0x21,0x08,0x22,0x80,0x0F,0x21,0xC0,0x31,0x60,0x22,0xFE,
+  0x27,0x22,0xFE,0x27,0x31,0x60,0x22,0x1E,0xC0,0x23,0x3C,0x80,0x01,0x31,0x03,0x31,
+  0x06,0x11,0x3C,0x13,0x0C,0x0E,0x3C,0x12,0x18,0x0F,0x22,0x80,0x01,0x11,0x18,0x21,
+  0x3C,0x31,0x1E,0x92,0x80,0x01,0x31,0x0F,0x22,0x10,0x0E,                            /* BJT pnp */
+
+  0x21,0x10,0x32,0x80,0x03,0x31,0x07,0x31,0x0C,0x91,0x30,0x73,0xC6,0x0F,0x0C,0x13,
+  0xC0,0x1F,0x07,0x24,0x80,0x03,0x1C,0x30,0x21,0x3E,0x33,0x20,0x30,0x02,0x31,0x01,
+  0x22,0xC0,0x1C,0x13,0x38,0xC0,0x0C,0x11,0x18,0x11,0x01,0x22,0x30,0x02,0x11,0x3E,
+  0x32,0x1C,0x30,0x68,0xFE,0xC1,0x0F,0x07,0xFE,0xC7,0x8F,0x0F,0x31,0x08,0x11,0x30,
+  0x42,0x80,0x07,0x31,0x0F,0x61,0x80,0x32,0x80,0x0F,0x22,0x10,0x07,                  /* MOSFET enh n-ch */
+
+  0x21,0x10,0x41,0x07,0x22,0x80,0x0F,0x31,0x08,0x62,0x80,0x07,0x11,0x30,0x11,0x0F,
+  0x43,0xFE,0xC7,0x8F,0x14,0xFE,0xC1,0x8F,0x0F,0x33,0x07,0x1C,0x30,0x21,0x3E,0x33,
+  0x20,0x30,0x01,0x31,0x02,0x22,0xC0,0x0C,0x13,0x38,0xC0,0x1C,0x11,0x18,0x11,0x02,
+  0x22,0x30,0x01,0x11,0x3E,0x32,0x1C,0x30,0x73,0xC0,0x9F,0x03,0x13,0xC6,0x0F,0x07,
+  0x31,0x0C,0x11,0x30,0xF0,0x21,0x0C,0x31,0x07,0x22,0x90,0x03,                       /* MOSFET enh p-ch */
+
+  0x21,0x10,0x32,0x80,0x03,0x31,0x07,0x31,0x0C,0x91,0x30,0x73,0xC6,0x0F,0x0C,0x13,
+  0xC0,0x1F,0x07,0x23,0x80,0x03,0x1C,0x31,0x3E,0x31,0x20,0x11,0x02,0x31,0x01,0x22,
+  0xC0,0x1C,0x13,0x38,0xC0,0x0C,0x11,0x18,0x11,0x01,0x31,0x02,0x11,0x3E,0x31,0x1C,
+  0x78,0xFE,0xC1,0x0F,0x07,0xFE,0xC7,0x8F,0x0F,0x31,0x08,0x11,0x30,0x42,0x80,0x07,
+  0x31,0x0F,0x61,0x80,0x32,0x80,0x0F,0x22,0x10,0x07,                                 /* MOSFET dep n-ch */
+
+  0x21,0x10,0x41,0x07,0x22,0x80,0x0F,0x31,0x08,0x62,0x80,0x07,0x11,0x30,0x11,0x0F,
+  0x43,0xFE,0xC7,0x8F,0x14,0xFE,0xC1,0x8F,0x0F,0x32,0x07,0x1C,0x31,0x3E,0x31,0x20,
+  0x11,0x01,0x31,0x02,0x22,0xC0,0x0C,0x13,0x38,0xC0,0x1C,0x11,0x18,0x11,0x02,0x31,
+  0x01,0x11,0x3E,0x31,0x1C,0x83,0xC0,0x9F,0x03,0x13,0xC6,0x0F,0x07,0x31,0x0C,0x11,
+  0x30,0xF0,0x21,0x0C,0x31,0x07,0x22,0x90,0x03,                                      /* MOSFET dep p-ch */
+
+  0x21,0x10,0x32,0x80,0x03,0x31,0x07,0x31,0x0C,0x91,0x30,0x91,0x0C,0x18,0xC0,0x0F,
+  0x07,0x1C,0xC0,0x9F,0x03,0x3E,0x31,0x20,0xB1,0x38,0x31,0x18,0x71,0x3E,0x32,0x1C,
+  0x01,0x31,0x02,0x23,0xFE,0xCC,0x1F,0x14,0xFE,0xCC,0x0F,0x07,0x13,0x02,0x80,0x0F,
+  0x11,0x01,0x11,0x08,0x11,0x30,0x42,0x80,0x07,0x31,0x0F,0x61,0x80,0x32,0x80,0x0F,
+  0x22,0x10,0x07,                                                                    /* JFET n-ch */
+
+  0x21,0x10,0x41,0x07,0x22,0x80,0x0F,0x31,0x08,0x62,0x80,0x07,0x11,0x30,0x11,0x0F,
+  0x11,0x02,0x32,0x01,0x80,0x18,0xFE,0xCC,0x8F,0x0F,0xFE,0xCC,0x1F,0x07,0x11,0x01,
+  0x22,0x1C,0x02,0x21,0x3E,0x31,0x20,0xB1,0x38,0x31,0x18,0x71,0x3E,0x33,0x1C,0xC0,
+  0x1F,0x23,0xC0,0x8F,0x03,0x31,0x07,0x31,0x0C,0x11,0x30,0xF0,0x21,0x0C,0x31,0x07,
+  0x22,0x90,0x03,                                                                    /* JFET p-ch */
+
+  0x21,0x10,0x41,0x0E,0x31,0x0F,0x22,0x80,0x01,0x91,0x30,0x73,0x06,0x80,0x01,0x22,
+  0x18,0x0F,0x22,0x0C,0x0E,0x21,0x06,0x31,0x03,0x22,0x80,0x01,0x21,0xC0,0x22,0xFE,
+  0x41,0x22,0xFE,0x41,0x31,0xC0,0x23,0x1C,0x80,0x09,0x11,0x3E,0x11,0x07,0x11,0x20,
+  0x51,0x01,0x34,0x9F,0x0F,0x38,0x06,0x12,0x0F,0x18,0x41,0x30,0x21,0x3E,0x22,0x07,
+  0x1C,0x21,0x07,0xB1,0x0F,0x22,0x90,0x0F,                                           /* IGBT enh n-ch */
+
+  0x21,0x10,0x32,0x80,0x0F,0x31,0x0F,0xB1,0x07,0x11,0x30,0x11,0x07,0x52,0x06,0x02,
+  0x32,0x1C,0x0F,0x22,0x80,0x0F,0x21,0x10,0x31,0x1F,0x22,0x80,0x01,0x21,0xC0,0x22,
+  0xFE,0x41,0x22,0xFE,0x41,0x31,0xC0,0x23,0x1C,0x80,0x01,0x11,0x3E,0x11,0x03,0x11,
+  0x20,0x11,0x06,0x31,0x0C,0x34,0x18,0x0E,0x38,0x06,0x12,0x0F,0x18,0x12,0x80,0x01,
+  0x11,0x30,0x21,0x3E,0x31,0x1C,0x92,0x80,0x01,0x31,0x0F,0x22,0x10,0x0E,             /* IGBT enh p-ch */
+
+  0x21,0x71,0x31,0xF8,0xB1,0x70,0x31,0x70,0xB1,0x88,0x63,0xFF,0xFE,0x01,0x11,0x01,
+  0x11,0x01,0x12,0x02,0x80,0x22,0x04,0x40,0x22,0x08,0x20,0x22,0x10,0x10,0x13,0x1C,
+  0x20,0x08,0x13,0x3E,0x40,0x04,0x13,0x20,0x80,0x02,0x24,0xFF,0xFE,0x01,0x38,0x34,
+  0x18,0x7F,0xFE,0x01,0x11,0xC0,0x23,0x3E,0x60,0xE0,0x13,0x1C,0x30,0xF0,0x22,0x18,
+  0x18,0x12,0xFE,0x0F,0x22,0xFE,0x07,0x81,0x18,0x31,0xF0,0x31,0xE1,0x10,             /* SCR */
+
+  0x21,0x01,0x31,0x48,0xF0,0x81,0x48,0x54,0xC0,0xFF,0xFE,0x07,0x44,0xC0,0xF7,0x01,
+  0x04,0x11,0x14,0x42,0x02,0x02,0x11,0x22,0x42,0x04,0x01,0x11,0x41,0x41,0x88,0x12,
+  0x8C,0x80,0x21,0x1E,0x11,0x50,0x11,0x50,0x13,0xDF,0x07,0x18,0x36,0xC8,0xF7,0xFE,
+  0x07,0x1E,0x0C,0x23,0x0C,0x06,0x10,0x21,0x03,0x22,0xFE,0x01,0x21,0xFE,0xD1,0x10,
+  0x31,0x01,0x10,                                                                    /* Triac */
+
+  0x21,0x71,0x31,0xF8,0x93,0xFE,0x07,0x70,0x13,0xFE,0x0F,0x70,0x21,0x18,0x22,0x1C,
+  0x30,0x23,0x3E,0x60,0x88,0x12,0x20,0xC0,0x35,0x7F,0xFE,0x01,0x38,0x01,0x14,0x01,
+  0x18,0x02,0x80,0x22,0x04,0x40,0x13,0x3E,0x08,0x20,0x13,0x1C,0x10,0x10,0x22,0x20,
+  0x08,0x22,0x40,0x04,0x22,0x80,0x02,0x23,0xFF,0xFE,0x01,0x53,0xFF,0xFE,0x01,0x61,
+  0xE0,0x31,0xF0,0x31,0x18,0xF1,0x18,0x31,0xF0,0x31,0xE1,0x10,                       /* PUT */
+
+  0x21,0x10,0x32,0x80,0x04,0xF0,0x21,0x30,0x61,0x3E,0x15,0x80,0x04,0x7E,0xC2,0x0F,
+  0x13,0xC0,0xC1,0x1F,0x51,0x40,0x32,0xC0,0x07,0x22,0x3E,0x0C,0x22,0x3C,0x08,0xA1,
+  0x1C,0x31,0x1C,0x82,0xC0,0x1F,0x13,0x3C,0xC0,0x0F,0x11,0x3E,0x21,0x01,0x51,0x30,
+  0xF0,0x61,0x01,0x21,0x10,0x10                                                      /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  0xD2,0xF0,0x01,0x22,0x0C,0x06,0x22,0x02,0x08,0x22,0xF1,0x11,0x22,0x08,0x02,0x13,
+  0x80,0x04,0x24,0x92,0x80,0x03,0x41,0x24,0x31,0x02,0x31,0x11,0x22,0x80,0x08,0x22,
+  0x40,0x04,0x22,0x20,0x02,0x22,0x10,0x01,0xE1,0xF0,0x71,0x60,0x31,0x90,0x71,0x90,
+  0x31,0x60,0xE0,                                                                    /* question mark */
+
+  0x22,0x48,0x04,0x31,0x06,0x31,0x03,0x22,0x80,0x01,0x22,0x80,0x01,0x31,0x03,0x31,
+  0x06,0x13,0x04,0x40,0x04,0x93,0xF8,0xF7,0x1F,0x13,0xFC,0xF7,0x0F,0x21,0x14,0x31,
+  0x22,0x32,0x41,0x10,0x12,0x80,0x80,0x21,0x40,0x11,0x01,0x11,0x20,0x11,0x02,0x11,
+  0x10,0x11,0x04,0x11,0x08,0x11,0x08,0x11,0x04,0x11,0x10,0x13,0xFC,0xF7,0x1F,0xA2,
+  0x80,0x03,0x22,0xC0,0x07,0x62,0x80,0x03,0x22,0x80,0x03,0xA2,0x48,0x04,             /* Zener diode */
+
+  0x51,0x80,0xF0,0xF0,0x92,0x7F,0x7F,0x22,0xFF,0x7F,0x14,0xC0,0xFF,0xFF,0x01,0xF0,
+  0x14,0xC0,0xFF,0xFF,0x01,0x12,0xFF,0x7F,0x22,0x7F,0x7F,0xF0,0xF0,0x81,0x80,0x60,   /* quartz crystal */
+
+  0x31,0x11,0x62,0xC0,0x06,0x22,0xC0,0x06,0x12,0xE0,0x3F,0x23,0xC0,0x1F,0x01,0x13,
+  0x1F,0xC0,0x0F,0x13,0x1E,0xC0,0x0F,0x12,0xC0,0x1F,0x13,0x1C,0xE0,0x3F,0x11,0x38,
+  0x33,0x60,0xF0,0x3F,0x22,0xE0,0x1F,0x33,0xC0,0x0F,0x60,0x13,0xC0,0x1F,0x38,0x31,
+  0x1C,0x32,0xFE,0x0E,0x22,0xFE,0x0F,0xC2,0xC0,0x1F,0x22,0xC0,0x0F,0x12,0xE0,0x1F,
+  0x22,0xF0,0x3F,0xF0,0x42,0xC0,0x07,0x22,0xC0,0x07,0x31,0x10                        /* OneWire device */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed symbols in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  70,       /* BJT pnp */
+  145,      /* MOSFET enh n-ch */
+  222,      /* MOSFET enh p-ch */
+  298,      /* MOSFET dep n-ch */
+  372,      /* MOSFET dep p-ch */
+  445,      /* JFET n-ch */
+  512,      /* JFET p-ch */
+  579,      /* IGBT enh n-ch */
+  651,      /* IGBT enh p-ch */
+  729,      /* SCR */
+  807,      /* Triac */
+  874,      /* PUT */
+  950       /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  1004,     /* question mark */
+  1055,     /* Zener diode */
+  1133,     /* quartz crystal */
+  1165      /* OneWire device */
+  #endif
+};
+
+#else
+
 /*
  *  symbol bitmaps
  *  - format:
@@ -206,6 +357,8 @@ const uint8_t SymbolData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 
 /*
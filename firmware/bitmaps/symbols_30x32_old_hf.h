@@ -30,6 +30,170 @@
 #define SYMBOL_BYTES_Y      32     /* 32 bytes in y direction */
 
 
+#ifdef SYMBOLS_RLE
+
+/*
+ *  compressed symbol bitmaps (SYMBOLS_RLE)
+ *  - same bitmaps as below, each symbol compressed separately
+ *  - each row is XORed with the previous row (first row with zeros),
+ *    i.e. unchanged bytes become zero
+ *  - followed by run-length encoding of the zero bytes
+ *    - control byte: bits #7-4: number of zero bytes (0-15)
+ *                    bits #3-0: number of data bytes following (0-15)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0x21,0x10,0x62,0xE0,0x03,0x22,0xFC,0x0F,0x22,0x1F,0x6C,0x13,0x80,0x03,0xE0,0x11,
+  0xC0,0x17,0x80,0x01,0x60,0x0C,0x18,0x03,0x30,0x12,0x0C,0x06,0x21,0x06,0x11,0x18,
+  0x12,0x03,0x0C,0x12,0x80,0x01,0x21,0xC0,0x22,0x0C,0x60,0x11,0x18,0x11,0x30,0x22,
+  0xFB,0x13,0x22,0xFB,0x13,0x31,0x30,0x22,0x0C,0x60,0x11,0x18,0x12,0xC0,0x04,0x22,
+  0x80,0x03,0x11,0x18,0x21,0x0C,0x11,0x80,0x29,0x30,0x80,0x0F,0x06,0x60,0x0C,0x18,
+  0x03,0xC0,0x15,0x80,0x01,0x80,0x03,0xE0,0x22,0x1F,0x6C,0x22,0xFC,0x0F,0x22,0xE0,
+  0x03,0x71,0x10,0x10,                                                               /* BJT npn */
+
+  0x21,0x10,0x62,0xE0,0x03,0x22,0xFC,0x0F,0x22,0x1F,0x6C,0x13,0x80,0x03,0xE0,0x11,
+  0xC0,0x13,0x80,0x01,0x60,0x16,0x18,0x03,0x30,0x8C,0x0C,0x06,0x21,0x07,0x11,0x18,
+  0x21,0x0C,0x21,0x04,0x22,0xC0,0x07,0x12,0x0C,0x60,0x11,0x18,0x11,0x30,0x22,0xFB,
+  0x13,0x22,0xFB,0x13,0x31,0x30,0x22,0x0C,0x60,0x11,0x18,0x11,0xC0,0x32,0x80,0x01,
+  0x11,0x18,0x12,0x03,0x0C,0x21,0x06,0x15,0x30,0x0C,0x0C,0x06,0x60,0x13,0x18,0x03,
+  0xC0,0x15,0x80,0x01,0x80,0x03,0xE0,0x22,0x1F,0x6C,0x22,0xFC,0x0F,0x22,0xE0,0x03,
+  0x71,0x10,0x10,                                                                    /* BJT pnp */
+
+  0x21,0x10,0x62,0xE0,0x03,0x22,0xFC,0x0F,0x22,0x1F,0x6C,0x13,0x80,0x03,0xE0,0x15,
+  0xC0,0x10,0x80,0x01,0x60,0x25,0x03,0x30,0xE4,0x0F,0x06,0x12,0xE0,0x1F,0x11,0x18,
+  0x21,0x0C,0x11,0x10,0x64,0x0C,0x10,0x02,0x18,0x21,0x01,0x22,0xE0,0x1C,0x22,0xE0,
+  0x0C,0x31,0x01,0x14,0x0C,0x10,0x02,0x18,0x51,0x10,0x21,0x18,0x24,0x0C,0xEF,0xE3,
+  0x0F,0x15,0xDF,0xE7,0x0F,0x06,0x60,0x28,0x03,0xC0,0x10,0x80,0x01,0x80,0x03,0xE0,
+  0x22,0x1F,0x6C,0x22,0xFC,0x0F,0x22,0xE0,0x03,0x71,0x10,0x10,                       /* MOSFET enh n-ch */
+
+  0x21,0x10,0x62,0xE0,0x03,0x22,0xFC,0x0F,0x22,0x1F,0x6C,0x13,0x80,0x03,0xE0,0x15,
+  0xC0,0x10,0x80,0x01,0x60,0x28,0x03,0xDF,0xE7,0x0F,0x06,0xEF,0xE3,0x0F,0x11,0x18,
+  0x21,0x0C,0x11,0x10,0x64,0x0C,0x10,0x01,0x18,0x21,0x02,0x22,0xE0,0x0C,0x22,0xE0,
+  0x1C,0x31,0x02,0x14,0x0C,0x10,0x01,0x18,0x51,0x10,0x21,0x18,0x21,0x0C,0x12,0xE0,
+  0x1F,0x15,0x30,0xE4,0x0F,0x06,0x60,0x28,0x03,0xC0,0x10,0x80,0x01,0x80,0x03,0xE0,
+  0x22,0x1F,0x6C,0x22,0xFC,0x0F,0x22,0xE0,0x03,0x71,0x10,0x10,                       /* MOSFET enh p-ch */
+
+  0x21,0x10,0x62,0xE0,0x03,0x22,0xFC,0x0F,0x22,0x1F,0x6C,0x13,0x80,0x03,0xE0,0x15,
+  0xC0,0x10,0x80,0x01,0x60,0x25,0x03,0x30,0xE4,0x0F,0x06,0x12,0xE0,0x1F,0x11,0x18,
+  0x21,0x0C,0x81,0x0C,0x12,0x02,0x18,0x21,0x01,0x22,0xE0,0x1C,0x22,0xE0,0x0C,0x31,
+  0x01,0x11,0x0C,0x12,0x02,0x18,0x81,0x18,0x24,0x0C,0xEF,0xE3,0x0F,0x15,0xDF,0xE7,
+  0x0F,0x06,0x60,0x28,0x03,0xC0,0x10,0x80,0x01,0x80,0x03,0xE0,0x22,0x1F,0x6C,0x22,
+  0xFC,0x0F,0x22,0xE0,0x03,0x71,0x10,0x10,                                           /* MOSFET dep n-ch */
+
+  0x21,0x10,0x62,0xE0,0x03,0x22,0xFC,0x0F,0x22,0x1F,0x6C,0x13,0x80,0x03,0xE0,0x15,
+  0xC0,0x10,0x80,0x01,0x60,0x28,0x03,0xDF,0xE7,0x0F,0x06,0xEF,0xE3,0x0F,0x11,0x18,
+  0x21,0x0C,0x81,0x0C,0x12,0x01,0x18,0x21,0x02,0x22,0xE0,0x0C,0x22,0xE0,0x1C,0x31,
+  0x02,0x11,0x0C,0x12,0x01,0x18,0x81,0x18,0x21,0x0C,0x12,0xE0,0x1F,0x15,0x30,0xE4,
+  0x0F,0x06,0x60,0x28,0x03,0xC0,0x10,0x80,0x01,0x80,0x03,0xE0,0x22,0x1F,0x6C,0x22,
+  0xFC,0x0F,0x22,0xE0,0x03,0x71,0x10,0x10,                                           /* MOSFET dep p-ch */
+
+  0x21,0x10,0x62,0xE0,0x03,0x22,0xFC,0x0F,0x22,0x1F,0x6C,0x13,0x80,0x03,0xE0,0x11,
+  0xC0,0x14,0x80,0x01,0x60,0x10,0x12,0x03,0x30,0x21,0x06,0x12,0xE0,0x0F,0x14,0x18,
+  0xE0,0x1F,0x0C,0x81,0x0C,0x21,0x18,0xF0,0x11,0x0C,0x21,0x18,0x11,0x02,0x31,0x04,
+  0x27,0xF7,0xE9,0x1F,0x0C,0xEF,0xE9,0x0F,0x12,0x30,0x04,0x13,0x06,0x60,0x12,0x12,
+  0x03,0xC0,0x15,0x80,0x01,0x80,0x03,0xE0,0x22,0x1F,0x6C,0x22,0xFC,0x0F,0x22,0xE0,
+  0x03,0x71,0x10,0x10,                                                               /* JFET n-ch */
+
+  0x21,0x10,0x62,0xE0,0x03,0x22,0xFC,0x0F,0x22,0x1F,0x6C,0x13,0x80,0x03,0xE0,0x11,
+  0xC0,0x14,0x80,0x01,0x60,0x12,0x13,0x03,0x30,0x01,0x14,0x06,0xEF,0xEC,0x0F,0x14,
+  0xF7,0xEC,0x1F,0x0C,0x11,0x01,0x31,0x02,0x21,0x0C,0x21,0x18,0xF0,0x11,0x0C,0x21,
+  0x18,0x84,0x18,0xE0,0x1F,0x0C,0x12,0xE0,0x0F,0x11,0x30,0x23,0x06,0x60,0x10,0x12,
+  0x03,0xC0,0x15,0x80,0x01,0x80,0x03,0xE0,0x22,0x1F,0x6C,0x22,0xFC,0x0F,0x22,0xE0,
+  0x03,0x71,0x10,0x10,                                                               /* JFET p-ch */
+
+  0x21,0x10,0x62,0xE0,0x03,0x22,0xFC,0x0F,0x22,0x1F,0x6C,0x13,0x80,0x03,0xE0,0x11,
+  0xC0,0x1A,0x80,0x01,0x60,0x08,0x18,0x03,0x30,0x02,0x0C,0x06,0x21,0x06,0x11,0x18,
+  0x12,0x03,0x0C,0x12,0x80,0x01,0x21,0xC0,0x22,0x0C,0x60,0x11,0x18,0x11,0x30,0x22,
+  0xFB,0x11,0x22,0xFB,0x11,0x31,0x30,0x22,0x0C,0x60,0x11,0x18,0x12,0xC0,0x04,0x22,
+  0x80,0x03,0x11,0x18,0x21,0x0C,0x11,0x80,0x29,0x30,0x82,0x0F,0x06,0x60,0x08,0x18,
+  0x03,0xC0,0x15,0x80,0x01,0x80,0x03,0xE0,0x22,0x1F,0x6C,0x22,0xFC,0x0F,0x22,0xE0,
+  0x03,0x71,0x10,0x10,                                                               /* IGBT enh n-ch */
+
+  0x21,0x10,0x62,0xE0,0x03,0x22,0xFC,0x0F,0x22,0x1F,0x6C,0x13,0x80,0x03,0xE0,0x11,
+  0xC0,0x13,0x80,0x01,0x60,0x16,0x18,0x03,0x30,0x88,0x0C,0x06,0x12,0x02,0x07,0x11,
+  0x18,0x21,0x0C,0x21,0x04,0x22,0xC0,0x07,0x12,0x0C,0x60,0x11,0x18,0x11,0x30,0x22,
+  0xFB,0x11,0x22,0xFB,0x11,0x31,0x30,0x22,0x0C,0x60,0x11,0x18,0x11,0xC0,0x32,0x80,
+  0x01,0x11,0x18,0x12,0x03,0x0C,0x12,0x02,0x06,0x15,0x30,0x08,0x0C,0x06,0x60,0x13,
+  0x18,0x03,0xC0,0x15,0x80,0x01,0x80,0x03,0xE0,0x22,0x1F,0x6C,0x22,0xFC,0x0F,0x22,
+  0xE0,0x03,0x71,0x10,0x10,                                                          /* IGBT enh p-ch */
+
+  0x51,0x80,0xF0,0xF5,0xC0,0x7F,0xFF,0x01,0x40,0x22,0x01,0x80,0x11,0x80,0x22,0x01,
+  0x40,0x22,0x02,0x20,0x22,0x04,0x10,0x22,0x08,0x08,0x22,0x10,0x04,0x22,0x20,0x02,
+  0x22,0x40,0x01,0x18,0xC0,0x7F,0xFF,0x01,0xC0,0x3F,0xFF,0x01,0x11,0x60,0x31,0x30,
+  0x31,0x18,0x31,0x0C,0x31,0x06,0x22,0xFF,0x03,0x22,0xFF,0x01,0xF1,0x80,0x20,        /* SCR */
+
+  0x51,0x80,0xF0,0xF0,0x46,0xE0,0x7F,0xFF,0x03,0xE0,0xFB,0x11,0x02,0x11,0x0A,0x42,
+  0x01,0x01,0x11,0x11,0x41,0x82,0x12,0x80,0x20,0x41,0x44,0x12,0x40,0x40,0x41,0x28,
+  0x18,0x20,0x80,0xEF,0x03,0xE0,0x7B,0xFF,0x03,0x11,0x06,0x31,0x03,0x22,0x80,0x01,
+  0x21,0xFF,0x31,0x7F,0xF0,0x51,0x80,0x20,                                           /* Triac */
+
+  0x51,0x80,0xE2,0xFF,0x01,0x22,0xFF,0x03,0x31,0x06,0x31,0x0C,0x31,0x18,0x31,0x30,
+  0x31,0x60,0x25,0xC0,0x3F,0xFF,0x01,0x40,0x22,0x01,0x80,0x11,0x80,0x22,0x01,0x40,
+  0x22,0x02,0x20,0x22,0x04,0x10,0x22,0x08,0x08,0x22,0x10,0x04,0x22,0x20,0x02,0x22,
+  0x40,0x01,0x18,0xC0,0x7F,0xFF,0x01,0xC0,0x7F,0xFF,0x01,0xF0,0xE1,0x80,0x20,        /* PUT */
+
+  0x21,0x10,0x62,0xE0,0x03,0x22,0xFC,0x0F,0x22,0x1F,0x6C,0x13,0x80,0x03,0xE0,0x11,
+  0xC0,0x14,0x80,0x01,0x60,0x10,0x12,0x03,0x1F,0x24,0x06,0x6F,0xE0,0x0F,0x16,0xD8,
+  0xE2,0x1F,0x0C,0x80,0x01,0x21,0x80,0x32,0x8C,0x07,0x11,0x18,0x11,0x0C,0x31,0x08,
+  0xA1,0x0C,0x21,0x18,0x84,0x18,0xE0,0x1F,0x0C,0x12,0xE0,0x0F,0x11,0x30,0x23,0x06,
+  0x60,0x10,0x12,0x03,0xC0,0x15,0x80,0x01,0x80,0x03,0xE0,0x22,0x1F,0x6C,0x22,0xFC,
+  0x0F,0x22,0xE0,0x03,0x71,0x10,0x10                                                 /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  0xD2,0xF0,0x01,0x22,0x0C,0x06,0x22,0x02,0x08,0x22,0xF1,0x11,0x22,0x08,0x02,0x13,
+  0x80,0x04,0x24,0x92,0x80,0x03,0x41,0x24,0x31,0x02,0x31,0x11,0x22,0x80,0x08,0x22,
+  0x40,0x04,0x22,0x20,0x02,0x22,0x10,0x01,0xE1,0xF0,0x71,0x60,0x31,0x90,0x71,0x90,
+  0x31,0x60,0xE0,                                                                    /* question mark */
+
+  0x22,0x48,0x04,0x31,0x06,0x31,0x03,0x22,0x80,0x01,0x22,0x80,0x01,0x31,0x03,0x31,
+  0x06,0x13,0x04,0x40,0x04,0x93,0xF8,0xF7,0x1F,0x13,0xFC,0xF7,0x0F,0x21,0x14,0x31,
+  0x22,0x32,0x41,0x10,0x12,0x80,0x80,0x21,0x40,0x11,0x01,0x11,0x20,0x11,0x02,0x11,
+  0x10,0x11,0x04,0x11,0x08,0x11,0x08,0x11,0x04,0x11,0x10,0x13,0xFC,0xF7,0x1F,0xA2,
+  0x80,0x03,0x22,0xC0,0x07,0x62,0x80,0x03,0x22,0x80,0x03,0xA2,0x48,0x04,             /* Zener diode */
+
+  0x51,0x80,0xF0,0xF0,0x92,0x7F,0x7F,0x22,0xFF,0x7F,0x14,0xC0,0xFF,0xFF,0x01,0xF0,
+  0x14,0xC0,0xFF,0xFF,0x01,0x12,0xFF,0x7F,0x22,0x7F,0x7F,0xF0,0xF0,0x81,0x80,0x60,   /* quartz crystal */
+
+  0x31,0x11,0x62,0xC0,0x06,0x22,0xC0,0x06,0x12,0xE0,0x3F,0x23,0xC0,0x1F,0x01,0x13,
+  0x1F,0xC0,0x0F,0x13,0x1E,0xC0,0x0F,0x12,0xC0,0x1F,0x13,0x1C,0xE0,0x3F,0x11,0x38,
+  0x33,0x60,0xF0,0x3F,0x22,0xE0,0x1F,0x33,0xC0,0x0F,0x60,0x13,0xC0,0x1F,0x38,0x31,
+  0x1C,0x32,0xFE,0x0E,0x22,0xFE,0x0F,0xC2,0xC0,0x1F,0x22,0xC0,0x0F,0x12,0xE0,0x1F,
+  0x22,0xF0,0x3F,0xF0,0x42,0xC0,0x07,0x22,0xC0,0x07,0x31,0x10                        /* OneWire device */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed symbols in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  100,      /* BJT pnp */
+  199,      /* MOSFET enh n-ch */
+  291,      /* MOSFET enh p-ch */
+  383,      /* MOSFET dep n-ch */
+  471,      /* MOSFET dep p-ch */
+  559,      /* JFET n-ch */
+  643,      /* JFET p-ch */
+  727,      /* IGBT enh n-ch */
+  827,      /* IGBT enh p-ch */
+  928,      /* SCR */
+  991,      /* Triac */
+  1047,     /* PUT */
+  1110      /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  1197,     /* question mark */
+  1248,     /* Zener diode */
+  1326,     /* quartz crystal */
+  1358      /* OneWire device */
+  #endif
+};
+
+#else
+
 /*
  *  symbol bitmaps
  *  - format:
@@ -206,6 +370,8 @@ const uint8_t SymbolData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 
 /*
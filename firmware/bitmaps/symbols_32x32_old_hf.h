@@ -30,6 +30,171 @@
 #define SYMBOL_BYTES_Y      32     /* 32 bytes in y direction */
 
 
+#ifdef SYMBOLS_RLE
+
+/*
+ *  compressed symbol bitmaps (SYMBOLS_RLE)
+ *  - same bitmaps as below, each symbol compressed separately
+ *  - each row is XORed with the previous row (first row with zeros),
+ *    i.e. unchanged bytes become zero
+ *  - followed by run-length encoding of the zero bytes
+ *    - control byte: bits #7-4: number of zero bytes (0-15)
+ *                    bits #3-0: number of data bytes following (0-15)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0x21,0x20,0x62,0xC0,0x07,0x22,0xF8,0x1F,0x22,0x3E,0xD8,0x25,0x07,0xC0,0x01,0x80,
+  0x01,0x16,0x03,0xC0,0x18,0x30,0x06,0x60,0x12,0x18,0x0C,0x21,0x0C,0x11,0x30,0x12,
+  0x06,0x18,0x21,0x03,0x22,0x80,0x01,0x12,0x18,0xC0,0x11,0x30,0x11,0x60,0x22,0xF7,
+  0x27,0x22,0xF7,0x27,0x31,0x60,0x22,0x18,0xC0,0x11,0x30,0x12,0x80,0x09,0x31,0x07,
+  0x11,0x30,0x21,0x18,0x21,0x01,0x11,0x60,0x18,0x1F,0x0C,0xC0,0x18,0x30,0x06,0x80,
+  0x01,0x11,0x03,0x13,0x07,0xC0,0x01,0x12,0x3E,0xD8,0x22,0xF8,0x1F,0x22,0xC0,0x07,
+  0x71,0x20,0x10,                                                                    /* BJT npn */
+
+  0x21,0x20,0x62,0xC0,0x07,0x22,0xF8,0x1F,0x22,0x3E,0xD8,0x25,0x07,0xC0,0x01,0x80,
+  0x01,0x12,0x03,0xC0,0x16,0x30,0x06,0x60,0x18,0x19,0x0C,0x21,0x0E,0x11,0x30,0x21,
+  0x18,0x21,0x08,0x22,0x80,0x0F,0x12,0x18,0xC0,0x11,0x30,0x11,0x60,0x22,0xF7,0x27,
+  0x22,0xF7,0x27,0x31,0x60,0x22,0x18,0xC0,0x11,0x30,0x12,0x80,0x01,0x31,0x03,0x11,
+  0x30,0x12,0x06,0x18,0x21,0x0C,0x15,0x60,0x18,0x18,0x0C,0xC0,0x14,0x30,0x06,0x80,
+  0x01,0x11,0x03,0x13,0x07,0xC0,0x01,0x12,0x3E,0xD8,0x22,0xF8,0x1F,0x22,0xC0,0x07,
+  0x71,0x20,0x10,                                                                    /* BJT pnp */
+
+  0x21,0x20,0x62,0xC0,0x07,0x22,0xF8,0x1F,0x22,0x3E,0xD8,0x25,0x07,0xC0,0x01,0x80,
+  0x21,0x12,0x03,0xC0,0x25,0x06,0x60,0xC8,0x1F,0x0C,0x12,0xC0,0x3F,0x11,0x30,0x21,
+  0x18,0x11,0x20,0x64,0x18,0x20,0x04,0x30,0x21,0x02,0x22,0xC0,0x39,0x22,0xC0,0x19,
+  0x31,0x02,0x14,0x18,0x20,0x04,0x30,0x51,0x20,0x21,0x30,0x24,0x18,0xDF,0xC7,0x1F,
+  0x15,0xBF,0xCF,0x1F,0x0C,0xC0,0x23,0x06,0x80,0x21,0x11,0x03,0x13,0x07,0xC0,0x01,
+  0x12,0x3E,0xD8,0x22,0xF8,0x1F,0x22,0xC0,0x07,0x71,0x20,0x10,                       /* MOSFET enh n-ch */
+
+  0x21,0x20,0x62,0xC0,0x07,0x22,0xF8,0x1F,0x22,0x3E,0xD8,0x25,0x07,0xC0,0x01,0x80,
+  0x21,0x12,0x03,0xC0,0x28,0x06,0xBF,0xCF,0x1F,0x0C,0xDF,0xC7,0x1F,0x11,0x30,0x21,
+  0x18,0x11,0x20,0x64,0x18,0x20,0x02,0x30,0x21,0x04,0x22,0xC0,0x19,0x22,0xC0,0x39,
+  0x31,0x04,0x14,0x18,0x20,0x02,0x30,0x51,0x20,0x21,0x30,0x21,0x18,0x12,0xC0,0x3F,
+  0x15,0x60,0xC8,0x1F,0x0C,0xC0,0x23,0x06,0x80,0x21,0x11,0x03,0x13,0x07,0xC0,0x01,
+  0x12,0x3E,0xD8,0x22,0xF8,0x1F,0x22,0xC0,0x07,0x71,0x20,0x10,                       /* MOSFET enh p-ch */
+
+  0x21,0x20,0x62,0xC0,0x07,0x22,0xF8,0x1F,0x22,0x3E,0xD8,0x25,0x07,0xC0,0x01,0x80,
+  0x21,0x12,0x03,0xC0,0x25,0x06,0x60,0xC8,0x1F,0x0C,0x12,0xC0,0x3F,0x11,0x30,0x21,
+  0x18,0x81,0x18,0x12,0x04,0x30,0x21,0x02,0x22,0xC0,0x39,0x22,0xC0,0x19,0x31,0x02,
+  0x11,0x18,0x12,0x04,0x30,0x81,0x30,0x24,0x18,0xDF,0xC7,0x1F,0x15,0xBF,0xCF,0x1F,
+  0x0C,0xC0,0x23,0x06,0x80,0x21,0x11,0x03,0x13,0x07,0xC0,0x01,0x12,0x3E,0xD8,0x22,
+  0xF8,0x1F,0x22,0xC0,0x07,0x71,0x20,0x10,                                           /* MOSFET dep n-ch */
+
+  0x21,0x20,0x62,0xC0,0x07,0x22,0xF8,0x1F,0x22,0x3E,0xD8,0x25,0x07,0xC0,0x01,0x80,
+  0x21,0x12,0x03,0xC0,0x28,0x06,0xBF,0xCF,0x1F,0x0C,0xDF,0xC7,0x1F,0x11,0x30,0x21,
+  0x18,0x81,0x18,0x12,0x02,0x30,0x21,0x04,0x22,0xC0,0x19,0x22,0xC0,0x39,0x31,0x04,
+  0x11,0x18,0x12,0x02,0x30,0x81,0x30,0x21,0x18,0x12,0xC0,0x3F,0x15,0x60,0xC8,0x1F,
+  0x0C,0xC0,0x23,0x06,0x80,0x21,0x11,0x03,0x13,0x07,0xC0,0x01,0x12,0x3E,0xD8,0x22,
+  0xF8,0x1F,0x22,0xC0,0x07,0x71,0x20,0x10,                                           /* MOSFET dep p-ch */
+
+  0x21,0x20,0x62,0xC0,0x07,0x22,0xF8,0x1F,0x22,0x3E,0xD8,0x25,0x07,0xC0,0x01,0x80,
+  0x01,0x13,0x03,0xC0,0x20,0x12,0x06,0x60,0x21,0x0C,0x12,0xC0,0x1F,0x14,0x30,0xC0,
+  0x3F,0x18,0x81,0x18,0x21,0x30,0xF0,0x11,0x18,0x21,0x30,0x11,0x04,0x31,0x08,0x27,
+  0xEF,0xD3,0x3F,0x18,0xDF,0xD3,0x1F,0x12,0x60,0x08,0x13,0x0C,0xC0,0x24,0x13,0x06,
+  0x80,0x01,0x11,0x03,0x13,0x07,0xC0,0x01,0x12,0x3E,0xD8,0x22,0xF8,0x1F,0x22,0xC0,
+  0x07,0x71,0x20,0x10,                                                               /* JFET n-ch */
+
+  0x21,0x20,0x62,0xC0,0x07,0x22,0xF8,0x1F,0x22,0x3E,0xD8,0x25,0x07,0xC0,0x01,0x80,
+  0x01,0x13,0x03,0xC0,0x24,0x13,0x06,0x60,0x02,0x14,0x0C,0xDF,0xD9,0x1F,0x14,0xEF,
+  0xD9,0x3F,0x18,0x11,0x02,0x31,0x04,0x21,0x18,0x21,0x30,0xF0,0x11,0x18,0x21,0x30,
+  0x84,0x30,0xC0,0x3F,0x18,0x12,0xC0,0x1F,0x11,0x60,0x23,0x0C,0xC0,0x20,0x13,0x06,
+  0x80,0x01,0x11,0x03,0x13,0x07,0xC0,0x01,0x12,0x3E,0xD8,0x22,0xF8,0x1F,0x22,0xC0,
+  0x07,0x71,0x20,0x10,                                                               /* JFET p-ch */
+
+  0x21,0x20,0x62,0xC0,0x07,0x22,0xF8,0x1F,0x22,0x3E,0xD8,0x25,0x07,0xC0,0x01,0x80,
+  0x01,0x19,0x03,0xC0,0x10,0x30,0x06,0x60,0x04,0x18,0x0C,0x21,0x0C,0x11,0x30,0x12,
+  0x06,0x18,0x21,0x03,0x22,0x80,0x01,0x12,0x18,0xC0,0x11,0x30,0x11,0x60,0x22,0xF7,
+  0x23,0x22,0xF7,0x23,0x31,0x60,0x22,0x18,0xC0,0x11,0x30,0x12,0x80,0x09,0x31,0x07,
+  0x11,0x30,0x21,0x18,0x21,0x01,0x1A,0x60,0x04,0x1F,0x0C,0xC0,0x10,0x30,0x06,0x80,
+  0x01,0x11,0x03,0x13,0x07,0xC0,0x01,0x12,0x3E,0xD8,0x22,0xF8,0x1F,0x22,0xC0,0x07,
+  0x71,0x20,0x10,                                                                    /* IGBT enh n-ch */
+
+  0x21,0x20,0x62,0xC0,0x07,0x22,0xF8,0x1F,0x22,0x3E,0xD8,0x25,0x07,0xC0,0x01,0x80,
+  0x01,0x12,0x03,0xC0,0x16,0x30,0x06,0x60,0x10,0x19,0x0C,0x12,0x04,0x0E,0x11,0x30,
+  0x21,0x18,0x21,0x08,0x22,0x80,0x0F,0x12,0x18,0xC0,0x11,0x30,0x11,0x60,0x22,0xF7,
+  0x23,0x22,0xF7,0x23,0x31,0x60,0x22,0x18,0xC0,0x11,0x30,0x12,0x80,0x01,0x31,0x03,
+  0x11,0x30,0x12,0x06,0x18,0x12,0x04,0x0C,0x15,0x60,0x10,0x18,0x0C,0xC0,0x14,0x30,
+  0x06,0x80,0x01,0x11,0x03,0x13,0x07,0xC0,0x01,0x12,0x3E,0xD8,0x22,0xF8,0x1F,0x22,
+  0xC0,0x07,0x71,0x20,0x10,                                                          /* IGBT enh p-ch */
+
+  0x61,0x01,0xF0,0xE5,0x80,0xFF,0xFE,0x03,0x80,0x21,0x02,0x11,0x01,0x11,0x01,0x12,
+  0x02,0x80,0x22,0x04,0x40,0x22,0x08,0x20,0x22,0x10,0x10,0x22,0x20,0x08,0x22,0x40,
+  0x04,0x22,0x80,0x02,0x18,0x80,0xFF,0xFE,0x03,0x80,0x7F,0xFE,0x03,0x11,0xC0,0x31,
+  0x60,0x31,0x30,0x31,0x18,0x31,0x0C,0x22,0xFE,0x07,0x22,0xFE,0x03,0xF0,0x11,0x01,
+  0x10,                                                                              /* SCR */
+
+  0x61,0x01,0xF0,0xF0,0x38,0xC0,0xFF,0xFE,0x07,0xC0,0xF7,0x01,0x04,0x11,0x14,0x42,
+  0x02,0x02,0x11,0x22,0x42,0x04,0x01,0x11,0x41,0x41,0x88,0x12,0x80,0x80,0x41,0x50,
+  0x11,0x40,0x16,0xDF,0x07,0xC0,0xF7,0xFE,0x07,0x11,0x0C,0x31,0x06,0x31,0x03,0x22,
+  0xFE,0x01,0x21,0xFE,0xF0,0x61,0x01,0x10,                                           /* Triac */
+
+  0x61,0x01,0xD2,0xFE,0x03,0x22,0xFE,0x07,0x31,0x0C,0x31,0x18,0x31,0x30,0x31,0x60,
+  0x31,0xC0,0x25,0x80,0x7F,0xFE,0x03,0x80,0x21,0x02,0x11,0x01,0x11,0x01,0x12,0x02,
+  0x80,0x22,0x04,0x40,0x22,0x08,0x20,0x22,0x10,0x10,0x22,0x20,0x08,0x22,0x40,0x04,
+  0x22,0x80,0x02,0x18,0x80,0xFF,0xFE,0x03,0x80,0xFF,0xFE,0x03,0xF0,0xF1,0x01,0x10,   /* PUT */
+
+  0x21,0x20,0x62,0xC0,0x07,0x22,0xF8,0x1F,0x22,0x3E,0xD8,0x25,0x07,0xC0,0x01,0x80,
+  0x01,0x13,0x03,0xC0,0x20,0x12,0x06,0x3F,0x24,0x0C,0xDF,0xC0,0x1F,0x14,0xB0,0xC5,
+  0x3F,0x18,0x11,0x03,0x31,0x01,0x22,0x18,0x0F,0x11,0x30,0x11,0x18,0x31,0x10,0xA1,
+  0x18,0x21,0x30,0x84,0x30,0xC0,0x3F,0x18,0x12,0xC0,0x1F,0x11,0x60,0x23,0x0C,0xC0,
+  0x20,0x13,0x06,0x80,0x01,0x11,0x03,0x13,0x07,0xC0,0x01,0x12,0x3E,0xD8,0x22,0xF8,
+  0x1F,0x22,0xC0,0x07,0x71,0x20,0x10                                                 /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  0xD2,0xF0,0x01,0x22,0x0C,0x06,0x22,0x02,0x08,0x22,0xF1,0x11,0x22,0x08,0x02,0x13,
+  0x80,0x04,0x24,0x92,0x80,0x03,0x41,0x24,0x31,0x02,0x31,0x11,0x22,0x80,0x08,0x22,
+  0x40,0x04,0x22,0x20,0x02,0x22,0x10,0x01,0xE1,0xF0,0x71,0x60,0x31,0x90,0x71,0x90,
+  0x31,0x60,0xE0,                                                                    /* question mark */
+
+  0x22,0x48,0x04,0x31,0x06,0x31,0x03,0x22,0x80,0x01,0x22,0x80,0x01,0x31,0x03,0x31,
+  0x06,0x13,0x04,0x40,0x04,0x93,0xF8,0xF7,0x1F,0x13,0xFC,0xF7,0x0F,0x21,0x14,0x31,
+  0x22,0x32,0x41,0x10,0x12,0x80,0x80,0x21,0x40,0x11,0x01,0x11,0x20,0x11,0x02,0x11,
+  0x10,0x11,0x04,0x11,0x08,0x11,0x08,0x11,0x04,0x11,0x10,0x13,0xFC,0xF7,0x1F,0xA2,
+  0x80,0x03,0x22,0xC0,0x07,0x62,0x80,0x03,0x22,0x80,0x03,0xA2,0x48,0x04,             /* Zener diode */
+
+  0x51,0x80,0xF0,0xF0,0x92,0x7F,0x7F,0x22,0xFF,0x7F,0x14,0xC0,0xFF,0xFF,0x01,0xF0,
+  0x14,0xC0,0xFF,0xFF,0x01,0x12,0xFF,0x7F,0x22,0x7F,0x7F,0xF0,0xF0,0x81,0x80,0x60,   /* quartz crystal */
+
+  0x31,0x11,0x62,0xC0,0x06,0x22,0xC0,0x06,0x12,0xE0,0x3F,0x23,0xC0,0x1F,0x01,0x13,
+  0x1F,0xC0,0x0F,0x13,0x1E,0xC0,0x0F,0x12,0xC0,0x1F,0x13,0x1C,0xE0,0x3F,0x11,0x38,
+  0x33,0x60,0xF0,0x3F,0x22,0xE0,0x1F,0x33,0xC0,0x0F,0x60,0x13,0xC0,0x1F,0x38,0x31,
+  0x1C,0x32,0xFE,0x0E,0x22,0xFE,0x0F,0xC2,0xC0,0x1F,0x22,0xC0,0x0F,0x12,0xE0,0x1F,
+  0x22,0xF0,0x3F,0xF0,0x42,0xC0,0x07,0x22,0xC0,0x07,0x31,0x10                        /* OneWire device */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed symbols in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  99,       /* BJT pnp */
+  198,      /* MOSFET enh n-ch */
+  290,      /* MOSFET enh p-ch */
+  382,      /* MOSFET dep n-ch */
+  470,      /* MOSFET dep p-ch */
+  558,      /* JFET n-ch */
+  642,      /* JFET p-ch */
+  726,      /* IGBT enh n-ch */
+  825,      /* IGBT enh p-ch */
+  926,      /* SCR */
+  991,      /* Triac */
+  1047,     /* PUT */
+  1111      /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  1198,     /* question mark */
+  1249,     /* Zener diode */
+  1327,     /* quartz crystal */
+  1359      /* OneWire device */
+  #endif
+};
+
+#else
+
 /*
  *  symbol bitmaps
  *  - format:
@@ -206,6 +371,8 @@ const uint8_t SymbolData[] PROGMEM = {
   #endif
 };
 
+#endif
+
 
 
 /*
@@ -29,6 +29,179 @@
 #define SYMBOL_BYTES_Y      39     /* 39 bytes in y direction */
 
 
+#ifdef SYMBOLS_RLE
+
+/*
+ *  compressed symbol bitmaps (SYMBOLS_RLE)
+ *  - same bitmaps as below, each symbol compressed separately
+ *  - each row is XORed with the previous row (first row with zeros),
+ *    i.e. unchanged bytes become zero
+ *  - followed by run-length encoding of the zero bytes
+ *    - control byte: bits #7-4: number of zero bytes (0-15)
+ *                    bits #3-0: number of data bytes following (0-15)
+ *  - decoded by Bitmap_Start() and Bitmap_Row() (display.c)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0x31,0x10,0x22,0xC0,0x01,0x22,0xE0,0x03,0x31,0x02,0xB1,0x02,0x22,0xE0,0x03,0x22,
+  0xC0,0x01,0x32,0x18,0x78,0x22,0x0C,0xF0,0x12,0x06,0x06,0x32,0x03,0xF0,0x13,0x80,
+  0x01,0xF0,0x11,0xC0,0x31,0x60,0x11,0xF0,0x11,0x30,0x11,0x78,0x11,0x18,0x31,0x08,
+  0x13,0xFC,0xFF,0x01,0x13,0xFC,0xFF,0x01,0x31,0x08,0x31,0x18,0x32,0x30,0x02,0x22,
+  0x60,0x01,0x21,0xC0,0x31,0x40,0x31,0x20,0x32,0xE6,0x07,0x31,0x0C,0x22,0xE0,0x1B,
+  0x22,0xC0,0x03,0x62,0xC0,0x01,0x22,0xC0,0x01,0x62,0xC0,0x03,0x22,0xE0,0x03,0x31,
+  0x10,                                                                              /* BJT npn */
+
+  0x31,0x10,0x22,0xE0,0x03,0x22,0xC0,0x03,0x62,0xC0,0x01,0x22,0xC0,0x01,0x62,0xC0,
+  0x03,0x22,0xE0,0x03,0x32,0x18,0x78,0x13,0x40,0x0C,0xF0,0x12,0x86,0x06,0x32,0x03,
+  0xF0,0x22,0x02,0xF0,0x21,0x04,0x23,0xE0,0x07,0xF0,0x11,0x30,0x11,0x78,0x11,0x18,
+  0x31,0x08,0x13,0xFC,0xFF,0x01,0x13,0xFC,0xFF,0x01,0x31,0x08,0x31,0x18,0x31,0x30,
+  0x31,0x60,0x31,0xC0,0x32,0x80,0x01,0x31,0x03,0x22,0x06,0x06,0x31,0x0C,0x22,0xC0,
+  0x19,0x22,0xE0,0x03,0x31,0x02,0xB1,0x02,0x22,0xE0,0x03,0x22,0xC0,0x01,0x31,0x10,   /* BJT pnp */
+
+  0x31,0x10,0x21,0xE0,0x32,0xC0,0x01,0x31,0x03,0xB1,0x03,0x13,0x36,0xC0,0x01,0x21,
+  0xE0,0x63,0xC0,0xFF,0x0F,0x13,0xC0,0xFF,0x1B,0x91,0x30,0x72,0x30,0x04,0x32,0x82,
+  0x3B,0x22,0x81,0x3B,0x13,0xC0,0x38,0x0A,0x13,0xC0,0x18,0x11,0x23,0x81,0x20,0x38,
+  0x15,0x82,0x3B,0x7C,0x30,0x04,0x11,0x40,0x32,0x60,0x30,0x21,0x20,0x78,0x7C,0xC0,
+  0xDF,0x1B,0x38,0xC0,0xFF,0x0F,0x48,0xFE,0x01,0xC0,0x01,0xFE,0x37,0xE0,0x03,0x31,
+  0x02,0x22,0xE0,0x01,0x22,0xC0,0x03,0x21,0x20,0x32,0xE0,0x03,0x22,0xC0,0x11,        /* MOSFET enh n-ch */
+
+  0x31,0x10,0x22,0xC0,0x01,0x22,0xE0,0x03,0x31,0x02,0x22,0xE0,0x01,0x22,0xC0,0x03,
+  0x21,0x20,0x18,0xFE,0x37,0xE0,0x03,0xFE,0x01,0xC0,0x01,0x49,0x38,0xC0,0xFF,0x0F,
+  0x7C,0xC0,0xDF,0x1B,0x40,0x31,0x60,0x32,0x20,0x30,0x63,0x7C,0x30,0x01,0x11,0x38,
+  0x12,0x82,0x3B,0x22,0x84,0x3B,0x13,0xC0,0x18,0x0A,0x13,0xC0,0x38,0x11,0x22,0x84,
+  0x20,0x22,0x82,0x3B,0x12,0x30,0x01,0x61,0x30,0xB3,0xC0,0xFF,0x1B,0x13,0xC0,0xFF,
+  0x0F,0x61,0xE0,0x23,0x36,0xC0,0x01,0x31,0x03,0xB1,0x03,0x22,0xC0,0x01,0x22,0xE0,
+  0x10,                                                                              /* MOSFET enh p-ch */
+
+  0x31,0x10,0x21,0xE0,0x32,0xC0,0x01,0x31,0x03,0xB1,0x03,0x13,0x36,0xC0,0x01,0x21,
+  0xE0,0x63,0xC0,0xFF,0x0F,0x13,0xC0,0xFF,0x1B,0xF0,0x31,0x04,0x32,0x82,0x3B,0x22,
+  0x81,0x3B,0x13,0xC0,0x38,0x0A,0x13,0xC0,0x18,0x11,0x23,0x81,0x20,0x38,0x13,0x82,
+  0x3B,0x7C,0x11,0x04,0x11,0x40,0x31,0x60,0x31,0x20,0x78,0x7C,0xC0,0xDF,0x1B,0x38,
+  0xC0,0xFF,0x0F,0x48,0xFE,0x01,0xC0,0x01,0xFE,0x37,0xE0,0x03,0x31,0x02,0x22,0xE0,
+  0x01,0x22,0xC0,0x03,0x21,0x20,0x32,0xE0,0x03,0x22,0xC0,0x11,                       /* MOSFET dep n-ch */
+
+  0x31,0x10,0x22,0xC0,0x01,0x22,0xE0,0x03,0x31,0x02,0x22,0xE0,0x01,0x22,0xC0,0x03,
+  0x21,0x20,0x18,0xFE,0x37,0xE0,0x03,0xFE,0x01,0xC0,0x01,0x49,0x38,0xC0,0xFF,0x0F,
+  0x7C,0xC0,0xDF,0x1B,0x40,0x31,0x60,0x31,0x20,0x71,0x7C,0x11,0x01,0x11,0x38,0x12,
+  0x82,0x3B,0x22,0x84,0x3B,0x13,0xC0,0x18,0x0A,0x13,0xC0,0x38,0x11,0x22,0x84,0x20,
+  0x22,0x82,0x3B,0x21,0x01,0xF0,0x33,0xC0,0xFF,0x1B,0x13,0xC0,0xFF,0x0F,0x61,0xE0,
+  0x23,0x36,0xC0,0x01,0x31,0x03,0xB1,0x03,0x22,0xC0,0x01,0x22,0xE0,0x10,             /* MOSFET dep p-ch */
+
+  0x32,0x10,0x38,0x13,0xC0,0x01,0x7C,0x13,0xE0,0x03,0x40,0x22,0x02,0x60,0x13,0xE0,
+  0x01,0x20,0x12,0xC0,0x03,0x21,0x20,0x18,0x7C,0xC2,0xE0,0x03,0x38,0x04,0xC0,0x01,
+  0x11,0x08,0x28,0xFE,0x31,0xFF,0x0F,0xFE,0x31,0xFF,0x1F,0x11,0x08,0x31,0x04,0x31,
+  0x02,0xF0,0xF0,0xF0,0x72,0xFF,0x1F,0x22,0xFF,0x0F,0x61,0xE0,0x23,0xC0,0xC0,0x01,
+  0x31,0x03,0xB1,0x03,0x22,0xC0,0x01,0x21,0xE0,0x41,0x10,                            /* JFET n-ch */
+
+  0x31,0x10,0x21,0xE0,0x32,0xC0,0x01,0x31,0x03,0xB1,0x03,0x13,0xC0,0xC0,0x01,0x21,
+  0xE0,0x72,0xFF,0x0F,0x22,0xFF,0x1F,0xF0,0x91,0x38,0x31,0x7C,0x31,0x40,0x31,0x60,
+  0x31,0x20,0x72,0x7C,0x08,0x22,0x38,0x04,0x31,0x02,0x28,0xFE,0x31,0xFF,0x1F,0xFE,
+  0x31,0xFF,0x0F,0x11,0x02,0x33,0x04,0xC0,0x01,0x13,0xC8,0xE0,0x03,0x31,0x02,0x22,
+  0xE0,0x01,0x22,0xC0,0x03,0x21,0x20,0x32,0xE0,0x03,0x22,0xC0,0x01,0x31,0x10,        /* JFET p-ch */
+
+  0x22,0x0E,0x10,0x21,0x1F,0x31,0x10,0xB2,0x10,0x01,0x22,0x1F,0x1A,0x22,0x0E,0x0C,
+  0x31,0x08,0x13,0x80,0x0D,0x10,0x22,0x80,0x1F,0x21,0xF0,0x31,0x70,0x71,0x0C,0x71,
+  0x0C,0x51,0x38,0x11,0x30,0x11,0x7C,0x11,0x70,0x11,0x40,0x11,0xC0,0x11,0x60,0x11,
+  0x8C,0x11,0x20,0x51,0x0C,0x11,0x7C,0x31,0x38,0x12,0x70,0x04,0x29,0xF0,0x02,0xFE,
+  0x7F,0x80,0x01,0xFE,0xFF,0x8D,0x31,0x40,0x32,0xDF,0x0F,0x22,0x1E,0x18,0x61,0x0E,
+  0x31,0x0E,0x71,0x1E,0x31,0x1F,0x41,0x10,                                           /* IGBT enh n-ch */
+
+  0x01,0x38,0x13,0x1F,0x10,0x7C,0x11,0x1E,0x11,0x40,0x31,0x60,0x11,0x0E,0x11,0x20,
+  0x11,0x0E,0x42,0x01,0x7C,0x13,0x1E,0x1A,0x38,0x12,0x1F,0x0C,0x39,0x08,0xFE,0xFF,
+  0x0D,0x10,0xFE,0x7F,0x80,0x1F,0x21,0xF0,0x31,0x70,0x71,0x0C,0x71,0x0C,0x71,0x30,
+  0x31,0x70,0x31,0xC0,0x31,0x8C,0x71,0x0C,0x72,0x70,0x04,0x22,0xF0,0x02,0x22,0x80,
+  0x01,0x12,0x80,0x8D,0x31,0x40,0x32,0xCE,0x0F,0x22,0x1F,0x18,0x21,0x10,0xB1,0x10,
+  0x31,0x1F,0x31,0x0E,0x41,0x10,                                                     /* IGBT enh p-ch */
+
+  0x21,0x10,0x41,0x07,0x22,0x80,0x0F,0x71,0x07,0x31,0x07,0xA2,0x80,0x08,0xF0,0x23,
+  0xFC,0xEF,0x7F,0x11,0x04,0x11,0x40,0x11,0x08,0x11,0x20,0x11,0x10,0x11,0x10,0x11,
+  0x20,0x11,0x08,0x11,0x40,0x11,0x04,0x11,0x80,0x11,0x02,0x22,0x01,0x01,0x21,0x82,
+  0x11,0x38,0x11,0x44,0x11,0x7C,0x11,0x28,0x15,0x40,0xFC,0xEF,0x7F,0x60,0x34,0x20,
+  0xFC,0xE7,0x7F,0x21,0x0C,0x11,0x7C,0x11,0x06,0x11,0x38,0x11,0x03,0x29,0x80,0x01,
+  0x07,0xFE,0xFF,0x80,0x0F,0xFE,0x7F,0x11,0x08,0xB1,0x08,0x22,0x80,0x0F,0x31,0x07,
+  0x21,0x10,0x10,                                                                    /* SCR */
+
+  0x21,0x10,0x22,0x8E,0x01,0x22,0xDF,0x03,0x21,0x40,0x32,0x0E,0x03,0x22,0x8E,0x01,
+  0x21,0xC0,0x32,0x80,0x03,0x22,0xD1,0x03,0xE3,0xFF,0xEF,0x3F,0x13,0x03,0xE0,0x3D,
+  0x31,0x05,0x12,0x04,0x10,0x32,0x80,0x08,0x12,0x08,0x08,0x32,0x40,0x10,0x12,0x10,
+  0x04,0x32,0x20,0x20,0x12,0x20,0x02,0x11,0x38,0x15,0x10,0x40,0x7C,0x40,0x01,0x1A,
+  0x40,0x7C,0x0F,0x80,0x60,0x7C,0xEF,0xFF,0x20,0xC0,0x31,0x60,0x22,0x7C,0x30,0x22,
+  0x38,0x18,0x31,0x0C,0x17,0x47,0xFE,0x07,0x80,0x2F,0xFE,0x03,0x11,0x20,0x31,0x07,
+  0x31,0x07,0x71,0xA0,0x22,0x80,0xE8,0x21,0x10,0x10,                                 /* Triac */
+
+  0x21,0x10,0x41,0x07,0x22,0x80,0x0F,0x73,0x07,0xFE,0x1F,0x13,0x07,0xFE,0x3F,0x31,
+  0x60,0x27,0x38,0xC0,0x80,0x08,0x7C,0x80,0x01,0x11,0x40,0x11,0x03,0x11,0x60,0x11,
+  0x06,0x11,0x20,0x11,0x0C,0x25,0xFC,0xE7,0x7F,0x7C,0x04,0x13,0x40,0x38,0x08,0x11,
+  0x20,0x11,0x10,0x11,0x10,0x11,0x20,0x11,0x08,0x11,0x40,0x11,0x04,0x11,0x80,0x11,
+  0x02,0x22,0x01,0x01,0x21,0x82,0x31,0x44,0x31,0x28,0x23,0xFC,0xEF,0x7F,0x53,0xFC,
+  0xEF,0x7F,0xF1,0x07,0x22,0x80,0x0F,0x31,0x08,0xB1,0x08,0x22,0x80,0x0F,0x31,0x07,
+  0x21,0x10,0x10,                                                                    /* PUT */
+
+  0x31,0x10,0x22,0x8F,0x01,0x22,0xDE,0x03,0x21,0x40,0x32,0x1E,0x03,0x23,0x9E,0x01,
+  0x1E,0x11,0xC0,0x11,0x3E,0x13,0x9E,0x03,0x60,0x14,0xCF,0x03,0xC0,0xC8,0x22,0x80,
+  0x05,0x29,0x3E,0x03,0xFF,0x0F,0x3C,0x01,0xFF,0x1F,0x80,0x32,0x9C,0x1F,0x22,0x1C,
+  0x30,0x31,0x20,0x21,0x3C,0x31,0x3E,0xF0,0xF0,0x32,0xFF,0x1F,0x22,0xFF,0x0F,0x51,
+  0xC0,0x42,0x1E,0x01,0x21,0xBC,0x31,0x80,0x31,0x3C,0x31,0x3C,0x72,0xBC,0x02,0x22,
+  0x9E,0x03,0x31,0x10                                                                /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  0xD2,0xFE,0x01,0x13,0x80,0x01,0x06,0x11,0x40,0x11,0x08,0x11,0x20,0x11,0x10,0x13,
+  0x10,0xFE,0x21,0x22,0xFD,0x02,0x13,0x88,0xFE,0x44,0x21,0x03,0x11,0x01,0x82,0x78,
+  0x01,0x41,0x44,0x32,0x82,0x01,0x21,0x21,0x22,0x80,0xD0,0x22,0x40,0x68,0x22,0x20,
+  0x34,0x22,0x10,0x1A,0x22,0x08,0x0D,0x22,0x84,0x06,0x31,0x03,0xA1,0x7C,0x31,0xF8,
+  0x32,0xF8,0x01,0x61,0x38,0x31,0x44,0x41,0x01,0x61,0x44,0x32,0xB8,0x01,0x21,0xF8,
+  0x31,0x78,0x60,                                                                    /* question mark */
+
+  0x21,0x10,0x32,0x80,0x08,0x31,0x0C,0x31,0x06,0x31,0x03,0x31,0x03,0x31,0x06,0x31,
+  0x0C,0x22,0x80,0x08,0x11,0x04,0xB3,0xF8,0xEF,0x7F,0x53,0xFC,0xEF,0x3F,0x21,0x28,
+  0x31,0x44,0x32,0x82,0x40,0x22,0x01,0x01,0x11,0x80,0x11,0x02,0x11,0x40,0x11,0x04,
+  0x11,0x20,0x11,0x08,0x11,0x10,0x11,0x10,0x11,0x08,0x11,0x20,0x11,0x04,0x11,0x40,
+  0x13,0xFC,0xEF,0x7F,0xF1,0x07,0x22,0x80,0x0F,0x71,0x07,0x31,0x07,0xA2,0x80,0x08,
+  0x21,0x10,0x50,                                                                    /* Zener diode */
+
+  0xA1,0x01,0xF0,0xF0,0x74,0x80,0xFF,0xFE,0x01,0x44,0x80,0xFF,0xFF,0x01,0x44,0xF0,
+  0xFF,0xFF,0x0F,0xF0,0x94,0xF0,0xFF,0xFF,0x0F,0x44,0x80,0xFF,0xFF,0x01,0x44,0x80,
+  0xFF,0xFE,0x01,0xF0,0xF0,0x81,0x01,0x50,                                           /* quartz crystal */
+
+  0x22,0x80,0x10,0x62,0x60,0x03,0x22,0x60,0x03,0x61,0x80,0x22,0xC0,0x7F,0x22,0x80,
+  0x3F,0x23,0x3C,0x80,0x0F,0x16,0x38,0x80,0x0F,0x38,0x80,0x3F,0x13,0x70,0xC0,0x7F,
+  0x11,0xC0,0x42,0xE0,0x7F,0x51,0xC0,0x13,0x80,0x0F,0x70,0x13,0x80,0x1F,0x38,0x72,
+  0xFC,0x1B,0x22,0xFC,0x1F,0xC2,0x80,0x1F,0x22,0x80,0x0F,0x52,0xE0,0x7F,0xF0,0xF0,
+  0x92,0xE0,0x03,0x22,0xE0,0x03,0x31,0x10                                            /* OneWire device */
+  #endif
+};
+
+
+/*
+ *  offsets of compressed symbols in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  97,       /* BJT pnp */
+  193,      /* MOSFET enh n-ch */
+  288,      /* MOSFET enh p-ch */
+  385,      /* MOSFET dep n-ch */
+  477,      /* MOSFET dep p-ch */
+  571,      /* JFET n-ch */
+  646,      /* JFET p-ch */
+  725,      /* IGBT enh n-ch */
+  813,      /* IGBT enh p-ch */
+  899,      /* SCR */
+  998,      /* Triac */
+  1104,     /* PUT */
+  1203      /* UJT n-type */
+  #ifdef SYMBOLS_EXTRA
+  ,
+  1287,     /* question mark */
+  1370,     /* Zener diode */
+  1453,     /* quartz crystal */
+  1493      /* OneWire device */
+  #endif
+};
+
+#else
+
 /*
  *  symbol bitmaps
  *  - format:
@@ -241,6 +414,8 @@ const uint8_t SymbolData[] PROGMEM = {
   #endif  
 };
 
+#endif
+
 
 
 /*
@@ -106,6 +106,8 @@ void DelayTimer(void)
 /*
  *  measure ESR
  *  - tolerates charge up to about 130mV
+ *  - pipelined mode: spread of reading is stored in ESR_Spread
+ *  - fast mode of ESR tool: number of pulse pairs is taken from ESR_Pulses
  *
  *  requires:
  *  - pointer to cap data structure
@@ -129,6 +131,15 @@ uint16_t MeasureESR(Capacitor_Type *Cap)
   uint32_t          Sum_1;         /* sum #1 */
   uint32_t          Sum_2;         /* sum #2 */
   uint32_t          Value;
+  #ifdef ESR_PIPELINED
+  uint8_t           Count = 0;     /* pulse pairs in block */
+  uint16_t          Block_1 = 0;   /* block sum #1 */
+  uint16_t          Block_2 = 0;   /* block sum #2 */
+  uint16_t          Min = UINT16_MAX;   /* min. raw ESR of blocks */
+  uint16_t          Max = 0;       /* max. raw ESR of blocks */
+
+  ESR_Spread = 0;                  /* reset spread */
+  #endif
 
   /* check for a capacitor >= 10nF */
   if ((Cap == NULL) ||
@@ -220,11 +231,18 @@ uint16_t MeasureESR(Capacitor_Type *Cap)
 
   ADC_PORT = 0;          /* set ADC port to low */
   ADMUX = Probe1;        /* set input channel to probe-1 & set bandgap ref */
-  wait10ms();            /* time for voltage stabilization */
+  settle10ms();          /* time for voltage stabilization */
 
   U_2 = 50;              /* don't start with positive half-pulse */
   U_4 = 0;               /* start with a negative half-pulse */
+  #ifdef ESR_PIPELINED
+  n = ESR_PULSES;        /* set loop counter */
+  #else
   n = 255;               /* set loop counter */
+  #endif
+  #ifdef ESR_TOOL_FAST
+  if (ESR_Pulses) n = ESR_Pulses;       /* fast mode */
+  #endif
 
   while (n > 0)
   {
@@ -261,6 +279,109 @@ uint16_t MeasureESR(Capacitor_Type *Cap)
     }
 
 
+    #ifdef ESR_PIPELINED
+
+    /*
+     *  pipelined sequence:
+     *  - both samples of a probe are taken on the same ADC channel,
+     *    loaded sample first (synchronized by dummy conversion) and
+     *    unloaded sample directly after it
+     *  - the completed loaded conversion serves as dummy conversion
+     *    for the unloaded one, so each pulse pair needs just two dummy
+     *    conversions instead of four
+     *  - probe settings before each pulse are the same as in the
+     *    standard sequence
+     */
+
+
+    /*
+     *  reverse mode, negative charging pulse
+     *  set probes: GND -- probe-2 / probe-1 -- Rl -- Vcc
+     *  get voltage at probe-1 (voltage at DUT, i.e. RiL + ESR)
+     */
+
+    ADC_DDR = Probes.Pin_2;        /* pull down probe-2 directly */
+    R_PORT = Probes.Rl_2;          /* pull up probe-2 via Rl */
+    R_DDR = Probes.Rl_2;           /* enable resistor */
+    ADMUX = Probe1;                /* set input channel to probe-1 & set bandgap ref */
+    /* run dummy conversion for ADMUX change */
+    ADCSRA = Bits;                 /* start conversion */
+    while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+
+    /* read ADC in the mid of a negatve charging pulse */
+    ADCSRA = Bits;                 /* start conversion with next ADC clock cycle */
+    wait10us();                    /* fixed pre-delay */
+    DelayTimer();                  /* delay for pulse */
+    R_PORT = Probes.Rl_1;          /* pull up probe-1 via Rl */
+    R_DDR = Probes.Rl_1;           /* enable resistor */
+    wait2us();                     /* first half-pulse */
+                                   /* S/H happens here */
+    #if CPU_FREQ < 8000000
+    wait2us();                     /* second half-pulse */
+    #endif
+    R_DDR = 0;                     /* set resistor port to HiZ */
+    while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+    U_4 = ADCW;                    /* save ADC value */
+
+
+    /*
+     *  forward mode, probe-1 only (probe-2 in HiZ mode)
+     *  set probes: GND -- probe-1 -- Rl -- Vcc / probe-2 -- HiZ
+     *  get voltage at probe-1 (voltage at RiL)
+     */
+
+    ADC_DDR = Probes.Pin_1;        /* pull down probe-1 directly to GND */
+    R_PORT = Probes.Rl_1;          /* pull up probe-1 via Rl */
+    R_DDR = Probes.Rl_1;           /* enable resistor */
+    /* real conversion (same channel) */
+    ADCSRA = Bits;                 /* start conversion */
+    while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+    U_1 = ADCW;                    /* save ADC value */
+
+
+    /*
+     *  forward mode, positive charging pulse
+     *  set probes: GND -- probe-1 / probe-2 -- Rl -- Vcc
+     *  get voltage at probe-2 (voltage at DUT, i.e. RiL + ESR)
+     */
+
+    ADMUX = Probe2;                /* set input channel to probe-2 & set bandgap ref */
+    /* run dummy conversion for ADMUX change */
+    ADCSRA = Bits;                 /* start conversion */
+    while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+
+    /* read ADC in the mid of a positive charging pulse */
+    ADCSRA = Bits;                 /* start conversion with next ADC clock cycle */
+    wait10us();                    /* fixed pre-delay */
+    DelayTimer();                  /* delay for pulse */
+    R_PORT = Probes.Rl_2;          /* pull up probe-2 via Rl */
+    R_DDR = Probes.Rl_2;           /* enable resistor */
+    wait2us();                     /* first half-pulse */
+                                   /* S/H happens here */
+    #if CPU_FREQ < 8000000
+    wait2us();                     /* second half-pulse */
+    #endif
+    R_DDR = 0;                     /* set resistor port to HiZ */
+    while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+    U_2 = ADCW;                    /* save ADC value */
+
+
+    /*
+     *  reverse mode, probe-2 only (probe-1 in HiZ mode)
+     *  set probes: GND -- probe-2 -- Rl -- Vcc / probe-1 -- HiZ
+     *  get voltage at probe-2 (voltage at RiL)
+     */
+
+    ADC_DDR = Probes.Pin_2;        /* pull down probe-2 directly */
+    R_PORT = Probes.Rl_2;          /* pull up probe-2 via Rl */
+    R_DDR = Probes.Rl_2;           /* enable resistor */
+    /* real conversion (same channel) */
+    ADCSRA = Bits;                 /* start conversion */
+    while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
+    U_3 = ADCW;                    /* save ADC value */
+
+    #else
+
     /*
      *  forward mode, probe-1 only (probe-2 in HiZ mode)
      *  set probes: GND -- probe-1 -- Rl -- Vcc / probe-2 -- HiZ
@@ -354,6 +475,8 @@ uint16_t MeasureESR(Capacitor_Type *Cap)
     while (ADCSRA & (1 << ADSC));  /* wait until conversion is done */
     U_4 = ADCW;                    /* save ADC value */
 
+    #endif
+
 
     /*
      *  manage measured values
@@ -363,6 +486,36 @@ uint16_t MeasureESR(Capacitor_Type *Cap)
     Sum_1 += U_3;        /* negative pulse without DUT */
     Sum_2 += U_2;        /* positive pulse with DUT */
     Sum_2 += U_4;        /* negative pulse with DUT */
+
+    #ifdef ESR_PIPELINED
+    /* block of pulse pairs for spread */
+    Block_1 += U_1 + U_3;          /* without DUT */
+    Block_2 += U_2 + U_4;          /* with DUT */
+    Count++;                       /* one more pulse pair */
+
+    if (Count == 16)               /* block complete */
+    {
+      /* raw ESR of block (0.01 Ohms) */
+      Value = 0;
+      if ((Block_2 > Block_1) && (Block_1 > 0))
+      {
+        Value = (uint32_t)(NV.RiL * 10);
+        Value *= Block_2 - Block_1;
+        Value /= Block_1;
+      }
+      if (Value > UINT16_MAX) Value = UINT16_MAX;
+
+      /* update min/max */
+      if (Value < Min) Min = (uint16_t)Value;
+      if (Value > Max) Max = (uint16_t)Value;
+
+      /* next block */
+      Count = 0;
+      Block_1 = 0;
+      Block_2 = 0;
+    }
+    #endif
+
     n--;                 /* next loop run */
   }
 
@@ -410,6 +563,11 @@ uint16_t MeasureESR(Capacitor_Type *Cap)
     {
       U_1 -= U_2;             /* subtract offset */
       ESR = U_1;              /* got result */
+
+      #ifdef ESR_PIPELINED
+      /* spread: half range of block results */
+      if (Max > Min) ESR_Spread = (Max - Min) / 2;
+      #endif
     }
     else                      /* offset problem or zero */
     {
@@ -596,7 +754,7 @@ uint16_t MeasureESR(Capacitor_Type *Cap)
 
   ADC_PORT = 0;               /* set ADC port to low */
   ADMUX = Probe1;             /* set input channel to probe-1 & set bandgap ref */
-  wait10ms();                 /* time for voltage stabilization */
+  settle10ms();               /* time for voltage stabilization */
   ADC_DDR = Probes.Pin_2;     /* pull down probe-2 directly */
   R_PORT = Probes.Rl_1;       /* pull up probe-1 via Rl */
   R_DDR = Probes.Rl_1;        /* enable resistor */
@@ -886,6 +1044,8 @@ uint8_t LargeCap(Capacitor_Type *Cap)
   int8_t            Scale;         /* capacitance scale */
   uint16_t          TempInt;       /* temp. value */
   uint16_t          Pulses;        /* number of charging pulses */
+  uint16_t          Bulk;          /* number of pulses for bulk charging */
+  uint16_t          Skipped;       /* number of pulses without ADC reading */
   int16_t           U_Zero;        /* voltage before charging (zero offset) */
   uint16_t          U_Cap;         /* voltage of DUT */
   uint16_t          U_Drop = 0;    /* voltage drop (self-discharge) */
@@ -896,6 +1056,14 @@ uint8_t LargeCap(Capacitor_Type *Cap)
   /* set up mode */
   Mode = PULL_10MS | PULL_UP;      /* start with large cap (>47uF) */
 
+  #ifdef FUNC_CAP_RANGE
+  /* range memory: mid-sized cap last time */
+  if (Check.CapRange == (CAP_RANGE_MEMORY | CAP_RANGE_MID))
+  {
+    Mode = PULL_1MS | PULL_UP;     /* start with 1ms charging pulses */
+  }
+  #endif
+
 
   /*
    *  We charge the DUT with up to 500 pulses each 10ms long until the
@@ -913,6 +1081,16 @@ uint8_t LargeCap(Capacitor_Type *Cap)
    *
    *  Remark:
    *  The Analog Input Resistance of the ADC is 100MOhm typically.
+   *
+   *  Speed up:
+   *  At low voltages the charge rises about linearly. So after the DUT
+   *  reached 25mV we extrapolate the number of pulses required for 270mV
+   *  (90% of the target) and charge the DUT with them in one go, i.e.
+   *  without the ADC conversions in between. The remaining pulses are
+   *  done one by one as before. The total pulse time is the same, so the
+   *  capacitance calculation isn't affected. Only the ADC conversions
+   *  between the pulses are skipped, and the self-discharge check below
+   *  runs the same number of conversions as the charge loop did.
    */
 
 large_cap:
@@ -945,9 +1123,25 @@ large_cap:
   /* charge DUT with up to 500 pulses until it reaches 300mV */
   /* pulse: probe-1 -- Rl -- Vcc */
   Pulses = 0;                      /* reset number of pulses */
+  Bulk = 1;                        /* bulk charging not done yet */
+  Skipped = 0;                     /* reset number of pulses w/o reading */
   TempByte = 1;                    /* set loop control */
   while (TempByte)                 /* charge loop */
   {
+    /* bulk charging */
+    if (Bulk > 1)                       /* got extrapolated pulses */
+    {
+      Skipped = Bulk;                   /* pulses without ADC reading */
+
+      while (Bulk > 0)
+      {
+        Pulses++;
+        PullProbe(Probes.Rl_1, Mode);   /* charging pulse */
+        Bulk--;
+        wdt_reset();                    /* reset watchdog */
+      }
+    }
+
     Pulses++;
     PullProbe(Probes.Rl_1, Mode);       /* charging pulse */
     U_Cap = ReadU(Probes.Ch_1);         /* get voltage */
@@ -959,13 +1153,54 @@ large_cap:
       U_Cap = 0;                        /* assume 0V */
 
     /* end loop if charging is too slow */
-    if ((Pulses == 126) && (U_Cap < 75)) TempByte = 0;
+    if ((Pulses >= 126) && (U_Cap < 75)) TempByte = 0;
+
+    /*
+     *  end loop early if DUT doesn't charge at all (low resistance)
+     *  - the charge rises linearly at that low voltage, so any cap
+     *    passing the 126 pulses check above got > 9mV by now
+     */
+    if ((Pulses >= 16) && (U_Cap < 5)) TempByte = 0;
     
     /* end loop if 300mV are reached */
     if (U_Cap >= 300) TempByte = 0;
 
     /* end loop if maximum number of pulses is reached (timeout) */
-    if (Pulses == 500) TempByte = 0;
+    if (Pulses >= 500) TempByte = 0;
+
+    #ifdef FUNC_CAP_RANGE
+    /*
+     *  range memory: a cap up to 47F reaches 300mV within three 1ms
+     *  pulses, so the DUT has left the mid range
+     */
+    if ((Pulses == 4) && TempByte && (Mode & PULL_1MS) &&
+        (Check.CapRange == (CAP_RANGE_MEMORY | CAP_RANGE_MID)))
+    {
+      Check.CapRange = CAP_RANGE_MEMORY;     /* clear range */
+      Mode = PULL_10MS | PULL_UP;            /* back to 10ms charging pulses */
+      goto large_cap;                        /* and re-run */
+    }
+    #endif
+
+    /* extrapolate pulses for bulk charging (just once) */
+    if (TempByte && (Bulk == 1) && (U_Cap >= 25))
+    {
+      Bulk = 0;                         /* default: no bulk charging */
+
+      if (U_Cap < 270)                  /* below 90% of target */
+      {
+        /* pulses for 270mV: Pulses * 270mV / U_Cap */
+        Value = (uint32_t)Pulses * 270;
+        Value /= U_Cap;
+        Value -= Pulses;                /* additional pulses */
+
+        /* limit to timeout (minus the pulse after bulk charging) */
+        if (Value > (499 - Pulses)) Value = 499 - Pulses;
+
+        /* bulk charging makes sense only for several pulses */
+        if (Value > 1) Bulk = (uint16_t)Value;
+      }
+    }
 
     wdt_reset();                        /* reset watchdog */
   }
@@ -995,7 +1230,8 @@ large_cap:
 
   /*
    *  Check if DUT sustains the charge and get the voltage drop.
-   *  - Run for about the same time as before (minus the 1 or 10ms charging time).
+   *  - Run for about the same time as before (minus the 1 or 10ms charging time
+   *    and the pulses of the bulk charging without ADC conversion).
    *  - Ignore the MCU cycles for the conditions in the charge loop (about 20)
    *    as they are just a few in comparison to the ADC conversion.
    *  - Also run ADC conversions to include charge losses by ADC.
@@ -1006,7 +1242,8 @@ large_cap:
   {
     /* check self-discharging for measuring period */
     U_Drop = ReadU(Probes.Ch_1);        /* get start voltage */
-    TempInt = Pulses;                   /* same number of loop runs (pulses) */
+    /* same number of loop runs (pulses with ADC conversion) */
+    TempInt = Pulses - Skipped;
     while (TempInt > 0)                 /* delay loop */
     {
       TempInt--;                        /* decrease timeout */
@@ -1125,6 +1362,17 @@ large_cap:
     Cap->Value = Value;       /* compensated value */
                               /* max. 4.3*10^6nF or 100*10^3F */
 
+    #ifdef FUNC_CAP_RANGE
+    /* range memory: save range */
+    if (Check.CapRange & CAP_RANGE_MEMORY)
+    {
+      if (Mode & PULL_1MS)         /* cap 4.7-47F */
+        Check.CapRange = CAP_RANGE_MEMORY | CAP_RANGE_MID;
+      else                         /* cap >47F */
+        Check.CapRange = CAP_RANGE_MEMORY | CAP_RANGE_LARGE;
+    }
+    #endif
+
 
     /*
      *  Calculate the self-discharge leakage current
@@ -1180,8 +1428,10 @@ uint8_t SmallCap(Capacitor_Type *Cap)
   uint8_t           Flag = 3;      /* return value */
   uint8_t           TempByte;      /* temp. value */
   int8_t            Scale;         /* capacitance scale */
-  uint16_t          Ticks;         /* timer counter */
-  uint16_t          Ticks2;        /* timer overflow counter */
+  #if ! defined (HW_ADJUST_CAP) || defined (SW_C_VLOSS)
+  uint16_t          Ticks;         /* temp. value */
+  uint16_t          Ticks2;        /* temp. value */
+  #endif
   #ifndef HW_ADJUST_CAP
   uint16_t          U_c;           /* voltage of capacitor */
   #endif
@@ -1202,8 +1452,6 @@ uint8_t SmallCap(Capacitor_Type *Cap)
    *  at Vcc/2. The Input Offset is <10mV at Vcc/2.
    */
 
-  Ticks2 = 0;                           /* reset timer overflow counter */
-
   /*
    *  init hardware
    */
@@ -1253,47 +1501,18 @@ uint8_t SmallCap(Capacitor_Type *Cap)
 
 
   /*
-   *  timer loop
-   *  - run until voltage is reached
-   *  - detect timer overflow
+   *  wait until voltage is reached
+   *  - timeout: 13.1s
    */
 
-   while (1)
-   {
-     TempByte = TIFR1;                  /* get Timer1 flags */
-
-     /* end loop if input capture flag is set (= same voltage) */
-     if (TempByte & (1 << ICF1)) break;
-
-     /* detect timer overflow by checking the overflow flag */
-     if (TempByte & (1 << TOV1))
-     {
-       /* happens at 65.536ms for 1MHz or 8.192ms for 8MHz */
-       TIFR1 = (1 << TOV1);             /* reset flag */
-       wdt_reset();                     /* reset watchdog */
-       Ticks2++;                        /* increase overflow counter */
-
-       /* end loop if charging takes too long (13.1s) */
-       if (Ticks2 == (CPU_FREQ / 5000)) break;
-     }
-   }
-
-  /* stop counter */
-  TCCR1B = 0;                           /* stop timer */
-  TIFR1 = (1 << ICF1);                  /* reset Input Capture flag */
-
-  Ticks = ICR1;                         /* get counter value */
+  if (! Capture_Wait(&Raw, CPU_FREQ / 5000))
+  {
+    Flag = 1;                 /* charging took too long */
+  }
 
   /* disable charging */
   R_DDR = 0;                  /* set resistor port to HiZ mode */
 
-  /* catch missed timer overflow */
-  if ((TCNT1 > Ticks) && (TempByte & (1 << TOV1)))
-  {
-    TIFR1 = (1 << TOV1);                /* reset overflow flag */
-    Ticks2++;                           /* increase overflow counter */
-  }
-
   /* enable ADC again */
   ADCSRA = (1 << ADEN) | (1 << ADIF) | ADC_CLOCK_DIV;
   ADCSRB &= ~(1 << ACME);     /* disable ADC multiplexer as negative input */
@@ -1305,11 +1524,12 @@ uint8_t SmallCap(Capacitor_Type *Cap)
 
   /* start discharging DUT */
   R_PORT = 0;                      /* pull down probe-1 via Rh */
+  #ifdef C_VLOSS_FUSED
+  /* on success keep charge for V_loss (discharged later) */
+  if (Flag != 3)
+  #endif
   R_DDR = Probes.Rh_1;             /* enable Rh for probe-1 again */
 
-  /* skip measurement if charging took too long */
-  if (Ticks2 >= (CPU_FREQ / 5000)) Flag = 1;
-
 
   /*
    *  calculate capacitance
@@ -1318,9 +1538,6 @@ uint8_t SmallCap(Capacitor_Type *Cap)
 
   if (Flag == 3)              /* measurement successful */
   {
-    /*  combine both counter values */
-    Raw = (uint32_t)Ticks;                /* set lower 16 bits */
-    Raw |= (uint32_t)Ticks2 << 16;        /* set upper 16 bits */
     if (Raw > 2) Raw -= 2;                /* subtract processing time overhead */
 
     Scale = -12;                          /* default factor is for pF scale */
@@ -1381,6 +1598,56 @@ uint8_t SmallCap(Capacitor_Type *Cap)
     Cap->Value = Value;       /* max. 5.1*10^6pF or 125*10^3nF */
 
 
+    #ifdef C_VLOSS_FUSED
+    /*
+     *  get V_loss (in 0.1%) from the charge of the measurement
+     *  - DUT is still charged to about U_bandgap and in HiZ mode
+     *  - measure start voltage, wait for a specific time and measure
+     *    end voltage
+     *  - saves the extra discharge and charge cycle of the standard method
+     *  - zero offset is ignored since the DUT was discharged before
+     */
+
+    #ifdef UI_PRESETS
+    /* > 50nF, not for fast preset */
+    if ((NV.Preset == PRESET_FULL) && (CmpValue(Value, Scale, 50, -9) == 1))
+    #else
+    if (CmpValue(Value, Scale, 50, -9) == 1)      /* > 50nF */
+    #endif
+    {
+      /* use value in 10nF for timing */
+      Ticks = RescaleValue(Value, Scale, -8);     /* rescale to 10nF */
+
+      /* get start voltage */
+      wdt_reset();                      /* reset watchdog */
+      /* just 5 samples to reduce loss of charge */
+      Ticks2 = ReadU_Desc(Probes.Ch_1, SAMPLE_FAST);   /* voltage at probe #1 */
+
+      /* wait for a specific time (full time) */
+      while (Ticks)                     /* delay loop */
+      {
+        wait5us();                      /* wait 5s */
+        Ticks--;                        /* next time unit */
+      }
+
+      /* get end voltage */
+      Ticks = ReadU_Desc(Probes.Ch_1, SAMPLE_FAST);    /* voltage at probe #1 */
+      wdt_reset();                      /* reset watchdog */
+
+      /* calculate V_loss */
+      if (Ticks2 > Ticks)               /* sanity check */
+      {
+        Ticks = Ticks2 - Ticks;         /* voltage drop */
+        /* voltage loss in 0.1% */
+        Cap->U_loss = (uint16_t)((unsigned long)(Ticks * 500UL) / Ticks2);
+      }
+    }
+
+    /* start discharging DUT */
+    R_DDR = Probes.Rh_1;             /* enable Rh for probe-1 again */
+    #endif
+
+
     #ifndef HW_ADJUST_CAP
     /*
      *  Self-adjust the voltage offset of the analog comparator and internal
@@ -1394,6 +1661,7 @@ uint8_t SmallCap(Capacitor_Type *Cap)
     {
       int16_t         Offset;
       int32_t         TempLong;
+      uint32_t        Limit;
 
       /*
        *  We can self-adjust the offset of the internal bandgap reference
@@ -1402,7 +1670,8 @@ uint8_t SmallCap(Capacitor_Type *Cap)
        *  reference. The common voltage source is the cap we just measured.
        */
 
-       while (ReadU(Probes.Ch_1) > 980)      /* discharge below bandgap ref */ 
+       Limit = ADC_Counts(980);         /* raw threshold for 980mV */
+       while (ReadU_Raw(Probes.Ch_1) > Limit)     /* discharge below bandgap ref */ 
        {
          /* keep discharging */
        }
@@ -1460,7 +1729,7 @@ uint8_t SmallCap(Capacitor_Type *Cap)
     }
     #endif
 
-    #ifdef SW_C_VLOSS
+    #if defined (SW_C_VLOSS) && ! defined (C_VLOSS_FUSED)
     uint16_t             U_Zero;        /* zero offset */
 
     /*
@@ -1472,7 +1741,12 @@ uint8_t SmallCap(Capacitor_Type *Cap)
      *  - based on Karl-Heinz' GetVloss()
      */
 
+    #ifdef UI_PRESETS
+    /* > 50nF, not for fast preset */
+    if ((NV.Preset == PRESET_FULL) && (CmpValue(Value, Scale, 50, -9) == 1))
+    #else
     if (CmpValue(Value, Scale, 50, -9) == 1)      /* > 50nF */
+    #endif
     {
       /* use value in 10nF for timing */
       Ticks = RescaleValue(Value, Scale, -8);     /* rescale to 10nF */
@@ -1504,8 +1778,8 @@ uint8_t SmallCap(Capacitor_Type *Cap)
       R_DDR = 0;                        /* set R port to HiZ mode */
       R_PORT = 0;                       /* set R port to low */
       wdt_reset();                      /* reset watchdog */
-      Cfg.Samples = 5;                  /* just 5 samples to reduce loss of charge */
-      Ticks2 = ReadU(Probes.Ch_1);      /* voltage at probe #1 */
+      /* just 5 samples to reduce loss of charge */
+      Ticks2 = ReadU_Desc(Probes.Ch_1, SAMPLE_FAST);   /* voltage at probe #1 */
       if (Ticks2 > U_Zero)              /* sanity check */
       {
         Ticks2 -= U_Zero;               /* consider zero offset */
@@ -1523,8 +1797,7 @@ uint8_t SmallCap(Capacitor_Type *Cap)
       }
 
       /* get end voltage */
-      Ticks = ReadU(Probes.Ch_1);       /* voltage at probe #1 */
-      Cfg.Samples = ADC_SAMPLES;        /* set ADC samples back to default */
+      Ticks = ReadU_Desc(Probes.Ch_1, SAMPLE_FAST);    /* voltage at probe #1 */
       wdt_reset();                      /* reset watchdog */
       if (Ticks > U_Zero)               /* sanity check */
       {
@@ -1552,41 +1825,24 @@ uint8_t SmallCap(Capacitor_Type *Cap)
 
 
 /*
- *  measure capacitance between two probe pins
+ *  check if a probe pair might be a capacitor
+ *  - based on the resistors and diodes found so far
  *
  *  requires:
  *  - Probe1: ID of probe to be pulled up [0-2]
  *  - Probe2: ID of probe to be pulled down [0-2]
- *  - ID: capacitor ID [0-2]
+ *
+ *  returns:
+ *  - 1 if capacitor is possible
+ *  - 0 if not
  */
 
-void MeasureCap(uint8_t Probe1, uint8_t Probe2, uint8_t ID)
+uint8_t CapPossible(uint8_t Probe1, uint8_t Probe2)
 {
   uint8_t           TempByte;           /* temp. value */
-  Capacitor_Type    *Cap;               /* pointer to cap data structure */
   Diode_Type        *Diode;             /* pointer to diode data structure */
   Resistor_Type     *Resistor;          /* pointer to resistor data structure */
 
-
-  /*
-   *  init
-   */
-
-  /* reset cap data */
-  Cap = &Caps[ID];            /* get pointer */
-  Cap->A = 0;
-  Cap->B = 0;
-  Cap->Scale = -12;           /* pF by default */
-  Cap->Raw = 0;
-  Cap->Value = 0;
-  Cap->I_leak_Value = 0;
-  #ifdef SW_C_VLOSS
-  Cap->U_loss = 0;
-  #endif
-
-  if (Check.Found == COMP_ERROR) return;    /* skip check on any error */
-
-
   /*
    *  Normaly we would skip resistors, but a resistor < 10 Ohms could be
    *  also a large cap.
@@ -1613,7 +1869,7 @@ void MeasureCap(uint8_t Probe1, uint8_t Probe2, uint8_t ID)
     }
 
     /* we got a valid resistor */ 
-    if (TempByte != 100) return;        /* skip this one */
+    if (TempByte != 100) return 0;      /* skip this one */
   }
 
 
@@ -1627,10 +1883,54 @@ void MeasureCap(uint8_t Probe1, uint8_t Probe2, uint8_t ID)
   {
     if (Diode->V_f < 1500)              /* Vf too low */
     {
-      return;                           /* skip this one */
+      return 0;                         /* skip this one */
     }
   }
 
+  return 1;
+}
+
+
+
+/*
+ *  measure capacitance between two probe pins
+ *
+ *  requires:
+ *  - Probe1: ID of probe to be pulled up [0-2]
+ *  - Probe2: ID of probe to be pulled down [0-2]
+ *  - ID: capacitor ID [0-2]
+ */
+
+void MeasureCap(uint8_t Probe1, uint8_t Probe2, uint8_t ID)
+{
+  uint8_t           TempByte;           /* temp. value */
+  Capacitor_Type    *Cap;               /* pointer to cap data structure */
+  #ifdef SW_PROFILER
+  uint32_t          Start;              /* profiler: start of stage */
+  #endif
+
+
+  /*
+   *  init
+   */
+
+  /* reset cap data */
+  Cap = &Caps[ID];            /* get pointer */
+  Cap->A = 0;
+  Cap->B = 0;
+  Cap->Scale = -12;           /* pF by default */
+  Cap->Raw = 0;
+  Cap->Value = 0;
+  Cap->I_leak_Value = 0;
+  #ifdef SW_C_VLOSS
+  Cap->U_loss = 0;
+  #endif
+
+  if (Check.Found == COMP_ERROR) return;    /* skip check on any error */
+
+  /* skip pairs which can't be a cap (resistor or diode) */
+  if (CapPossible(Probe1, Probe2) == 0) return;
+
 
   /*
    *  run measurements
@@ -1638,13 +1938,54 @@ void MeasureCap(uint8_t Probe1, uint8_t Probe2, uint8_t ID)
 
   UpdateProbes2(Probe1, Probe2);        /* update register bits and probes */
 
-  /* first run measurement for large caps */ 
-  TempByte = LargeCap(Cap);
+  #ifdef FUNC_CAP_RANGE
+cap_search:
+
+  /* range memory: small cap last time, so skip LargeCap() */
+  if (Check.CapRange == (CAP_RANGE_MEMORY | CAP_RANGE_SMALL))
+  {
+    TempByte = 2;                       /* run SmallCap() only */
+  }
+  else
+  #endif
+  {
+    /* first run measurement for large caps */ 
+    #ifdef SW_PROFILER
+    Start = Profile_Tick();             /* start of stage */
+    #endif
+    TempByte = LargeCap(Cap);
+    #ifdef SW_PROFILER
+    Profile_Add(PROF_LARGECAP, Start);  /* end of stage */
+    #endif
+  }
 
   /* if cap is too small run measurement for small caps */
   if (TempByte == 2)
   {
+    #ifdef SW_PROFILER
+    Start = Profile_Tick();             /* start of stage */
+    #endif
     TempByte = SmallCap(Cap);
+    #ifdef SW_PROFILER
+    Profile_Add(PROF_SMALLCAP, Start);  /* end of stage */
+    #endif
+
+    #ifdef FUNC_CAP_RANGE
+    if (Check.CapRange & CAP_RANGE_MEMORY)   /* range memory enabled */
+    {
+      if (TempByte == 3)                /* success */
+      {
+        /* save range */
+        Check.CapRange = CAP_RANGE_MEMORY | CAP_RANGE_SMALL;
+      }
+      else if (Check.CapRange == (CAP_RANGE_MEMORY | CAP_RANGE_SMALL))
+      {
+        /* DUT has left the small range */
+        Check.CapRange = CAP_RANGE_MEMORY;   /* clear range */
+        goto cap_search;                     /* full search */
+      }
+    }
+    #endif
   }
 
 
@@ -1670,6 +2011,14 @@ void MeasureCap(uint8_t Probe1, uint8_t Probe2, uint8_t ID)
     }
   }
 
+  #ifdef FUNC_CAP_RANGE
+  /* range memory: no cap, so do a full search next time */
+  if ((Check.CapRange & CAP_RANGE_MEMORY) && (Check.Found != COMP_CAPACITOR))
+  {
+    Check.CapRange = CAP_RANGE_MEMORY;  /* clear range */
+  }
+  #endif
+
 
   /*
    *  clean up
@@ -1707,6 +2056,7 @@ uint8_t RefCap(void)
   uint16_t          U_c;           /* voltage of capacitor */
   int16_t           Offset;        /* voltage offset */
   int32_t           Value;         /* temp. value */
+  uint32_t          Limit;         /* raw threshold */
 
 
   /*
@@ -1740,8 +2090,6 @@ uint8_t RefCap(void)
    *  setup hardware for measurement
    */
 
-  Ticks2 = 0;                           /* reset timer overflow counter */
-
   /* set up analog comparator */
   ADCSRB = (1 << ACME);                 /* use ADC multiplexer as negative input */
   ACSR =  (1 << ACBG) | (1 << ACIC);    /* use bandgap as positive input, trigger Timer1 */
@@ -1764,44 +2112,16 @@ uint8_t RefCap(void)
 
 
   /*
-   *  timer loop
-   *  - run until voltage is reached
-   *  - detect timer overflow
+   *  wait until voltage is reached
+   *  - timeout: 13.1s
+   *  - charging time isn't needed
    */
 
-   while (1)
-   {
-     TempByte = TIFR1;                  /* get Timer1 flags */
-
-     /* end loop if input capture flag is set (= same voltage) */
-     if (TempByte & (1 << ICF1)) break;
-
-     /* detect timer overflow by checking the overflow flag */
-     if (TempByte & (1 << TOV1))
-     {
-       /* happens at 65.536ms for 1MHz or 8.192ms for 8MHz */
-       TIFR1 = (1 << TOV1);             /* reset flag */
-       wdt_reset();                     /* reset watchdog */
-       Ticks2++;                        /* increase overflow counter */
-
-       /* end loop if charging takes too long (13.1s) */
-       if (Ticks2 == (CPU_FREQ / 5000)) break;
-     }
-   }
-
-  /* stop counter */
-  TCCR1B = 0;                           /* stop timer */
-  TIFR1 = (1 << ICF1);                  /* reset Input Capture flag */
+  Flag = Capture_Wait(&Limit, CPU_FREQ / 5000);
 
   /* disable charging */
   ADJUST_DDR &= ~(1 << ADJUST_RH);      /* set Rh pin to HiZ mode */
 
-  /* catch missed timer overflow */
-  if (TIFR1 & (1 << TOV1))
-  {
-    TIFR1 = (1 << TOV1);                /* reset overflow flag */
-  }
-
   /* enable ADC again */
   ADCSRA = (1 << ADEN) | (1 << ADIF) | ADC_CLOCK_DIV;
   ADCSRB &= ~(1 << ACME);     /* disable ADC multiplexer as negative input */
@@ -1813,9 +2133,6 @@ uint8_t RefCap(void)
   ADJUST_PORT &= ~(1 << ADJUST_RH);     /* pull down via Rh */
   ADJUST_DDR |= (1 << ADJUST_RH);       /* output mode */
 
-  /* check for charging timeout */
-  if (Ticks2 < (CPU_FREQ / 5000)) Flag = 1;   /* ok to proceed */
-
 
   /*
    *  get offsets
@@ -1830,7 +2147,8 @@ uint8_t RefCap(void)
      *  reference. The common voltage source is the cap we just measured.
      */
 
-    while (ReadU(TP_CAP) > 980)         /* discharge below bandgap ref */
+    Limit = ADC_Counts(980);            /* raw threshold for 980mV */
+    while (ReadU_Raw(TP_CAP) > Limit)   /* discharge below bandgap ref */
     {
       /* keep discharging */
     }
@@ -1895,6 +2213,63 @@ uint8_t RefCap(void)
 
 
 
+#ifdef ADJUST_CAP_DRIFT
+
+/*
+ *  background drift check using the fixed cap
+ *  - runs RefCap() and limits the change of the voltage offsets to 1mV
+ *    per run to filter out noise
+ *  - offsets are changed in RAM only
+ */
+
+void RefCap_Drift(void)
+{
+  int8_t            RefOffset;     /* old offset of bandgap reference */
+  int8_t            CompOffset;    /* old offset of analog comparator */
+  uint16_t          U_Bandgap;     /* old U_bandgap */
+
+  /* save current values */
+  RefOffset = NV.RefOffset;
+  CompOffset = NV.CompOffset;
+  U_Bandgap = Cfg.Bandgap;
+
+  if (RefCap())                    /* measurement successful */
+  {
+    /* limit change of bandgap offset */
+    if (NV.RefOffset > RefOffset)
+    {
+      NV.RefOffset = RefOffset + 1;
+    }
+    else if (NV.RefOffset < RefOffset)
+    {
+      NV.RefOffset = RefOffset - 1;
+    }
+
+    /* limit change of comparator offset */
+    if (NV.CompOffset > CompOffset)
+    {
+      NV.CompOffset = CompOffset + 1;
+    }
+    else if (NV.CompOffset < CompOffset)
+    {
+      NV.CompOffset = CompOffset - 1;
+    }
+  }
+  else                             /* some problem */
+  {
+    /* restore offsets */
+    NV.RefOffset = RefOffset;
+    NV.CompOffset = CompOffset;
+  }
+
+  /* update U_bandgap for changed offset */
+  Cfg.Bandgap = U_Bandgap + (NV.RefOffset - RefOffset);
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   clean-up of local constants
  * ************************************************************************ */
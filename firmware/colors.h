@@ -429,6 +429,24 @@
 #define COLOR_BAT_WEAK        COLOR_YELLOW
 #define COLOR_BAT_LOW         COLOR_RED
 
+/* scope */
+#define COLOR_SCOPE_TRACE     COLOR_YELLOW
+#define COLOR_SCOPE_GRID      COLOR_GREY
+
+/* curve tracer */
+#define COLOR_CURVE_1         COLOR_YELLOW
+#define COLOR_CURVE_2         COLOR_CYAN
+#define COLOR_CURVE_GRID      COLOR_GREY
+
+/* graph of monitors */
+#define COLOR_GRAPH_BAR       COLOR_GREEN
+#define COLOR_GRAPH_TREND     COLOR_YELLOW
+#define COLOR_GRAPH_GRID      COLOR_GREY
+
+/* sorting bins */
+#define COLOR_BIN_PASS        COLOR_GREEN
+#define COLOR_BIN_FAIL        COLOR_RED
+
 
 
 /* ************************************************************************
@@ -52,6 +52,16 @@
 /* control logic */
 uint8_t             FirstFlag;     /* multiple strings in a line */
 
+#ifdef FUNC_CMD_ARGS
+/* arguments */
+uint8_t             CmdArgs;       /* position of arguments in RX buffer */
+#endif
+
+#ifdef SW_BIN_FRAMES
+/* binary frames */
+uint8_t             FrameCRC;      /* CRC-8 of current frame */
+#endif
+
 
 
 /* ************************************************************************
@@ -373,6 +383,140 @@ uint8_t Cmd_TYPE(void)
 
 
 
+#ifdef SW_PROFILER
+
+/*
+ *  command: PROF
+ *  - return time spent in each stage of last probing cycle
+ *  - format: <stage>:<time> separated by spaces
+ *  - time is the sum of all runs of a stage, a run count > 1 is
+ *    appended by '/'
+ *
+ *  returns:
+ *  - SIGNAL_NA on n/a
+ *  - SIGNAL_OK on success
+ */
+
+uint8_t Cmd_PROF(void)
+{
+  uint8_t           Flag = SIGNAL_NA;   /* return value */
+  uint8_t           n = 0;              /* counter */
+  uint8_t           *Addr;              /* address of table entry */
+  unsigned char     *String;            /* address of stage name */
+  uint32_t          Value;              /* time */
+
+  if (Profile.Runs[PROF_CYCLE] == 0)    /* no probing yet */
+  {
+    return Flag;
+  }
+
+  FirstFlag = 1;              /* reset multi string logic */
+
+  while (n < NUM_PROF_STAGES)      /* loop through stages */
+  {
+    /* read address of stage name from reference table */
+    Addr = (uint8_t *)&Prof_Table[n];
+    Addr++;                        /* skip ID */
+    String = (unsigned char *)DATA_read_word((uint16_t *)Addr);
+
+    SpaceLogic();                  /* space logic */
+    Display_EEString(String);      /* send: stage name */
+    Display_Colon();
+
+    /* convert ticks into s (1024 MCU cycles per tick) */
+    Value = Profile.Ticks[n] * 1024;
+    Value /= MCU_CYCLES_PER_US;
+    Display_Value(Value, -6, 's');      /* send: time */
+
+    if (Profile.Runs[n] > 1)       /* several runs */
+    {
+      Display_Char('/');
+      Display_Value(Profile.Runs[n], 0, 0);    /* send: runs */
+    }
+
+    n++;                           /* next stage */
+  }
+
+  Flag = SIGNAL_OK;                /* signal success */
+
+  return Flag;
+}
+
+#endif
+
+
+
+#ifdef SW_POWER_STATS
+
+/*
+ *  command: PWR
+ *  - return time since power-on and time spent in each power state
+ *  - format: UP:<time> IDLE:<time> SAVE:<time> RUN:<time>
+ *  - IDLE and SAVE are the sleep modes used by MilliSleep(), RUN is the
+ *    remaining active time (measurements, display output, busy waits)
+ *  - with BAT_BACKGROUND: additional BAT:<time> (remaining battery runtime,
+ *    "-" if unknown yet)
+ *
+ *  returns:
+ *  - SIGNAL_OK
+ */
+
+uint8_t Cmd_PWR(void)
+{
+  uint32_t          Up;                 /* time since power-on */
+  uint32_t          Idle;               /* time in idle mode */
+  uint32_t          Save;               /* time in power save mode */
+  uint32_t          Run = 0;            /* active time */
+
+  /* get times in s */
+  Up = SysTick_Get() / 1000;                 /* ms -> s */
+  /* 1024 MCU cycles per tick */
+  Idle = SleepStats.Idle / (CPU_FREQ / 1024);
+  Save = SleepStats.PwrSave / (CPU_FREQ / 1024);
+
+  if (Up > (Idle + Save))          /* sanity check */
+  {
+    Run = Up - Idle - Save;
+  }
+
+  Display_EEString(Pwr_UP_str);              /* send: UP */
+  Display_Colon();
+  Display_Value(Up, 0, 's');                 /* send: time */
+  Display_Space();
+  Display_EEString(Pwr_IDLE_str);            /* send: IDLE */
+  Display_Colon();
+  Display_Value(Idle, 0, 's');               /* send: time */
+  Display_Space();
+  Display_EEString(Pwr_SAVE_str);            /* send: SAVE */
+  Display_Colon();
+  Display_Value(Save, 0, 's');               /* send: time */
+  Display_Space();
+  Display_EEString(Pwr_RUN_str);             /* send: RUN */
+  Display_Colon();
+  Display_Value(Run, 0, 's');                /* send: time */
+
+  #ifdef BAT_BACKGROUND
+  Display_Space();
+  Display_EEString(Pwr_BAT_str);             /* send: BAT */
+  Display_Colon();
+  Up = BatteryRuntime();                     /* get runtime (in minutes) */
+  if (Up == UINT16_MAX)                      /* unknown */
+  {
+    Display_Minus();                         /* send: - */
+  }
+  else                                       /* got estimate */
+  {
+    Display_Value(Up * 60, 0, 's');          /* send: time */
+  }
+  #endif
+
+  return SIGNAL_OK;
+}
+
+#endif
+
+
+
 /*
  *  command: HINT
  *  - return hints about special features
@@ -551,18 +695,6 @@ uint8_t Cmd_PIN(void)
       }
       break;
 
-    case COMP_BJT:            /* BJT */
-    case COMP_FET:            /* FET (JFET/MOSFET) */
-    case COMP_IGBT:           /* IGBT */
-    case COMP_THYRISTOR:      /* SCR */
-    case COMP_TRIAC:          /* TRIAC */
-    case COMP_PUT:            /* PUT */
-    #ifdef SW_UJT
-    case COMP_UJT:            /* UJT */
-    #endif
-      SemiPinout();                          /* send pinout */
-      break;
-
     case COMP_RESISTOR:       /* resistor(s) */
       R = (Resistor_Type *)SelectedComp();   /* get pointer */
       if (R)                                 /* valid pointer */
@@ -579,8 +711,16 @@ uint8_t Cmd_PIN(void)
       }
       break;
 
-    default:                  /* unsupported */
-      Flag = SIGNAL_ERR;      /* signal error */
+    default:                  /* semiconductor or unsupported */
+      /* semiconductors got pin designators (see SemiPin_table) */
+      if (Semi.DesA)          /* semiconductor */
+      {
+        SemiPinout();                        /* send pinout */
+      }
+      else                    /* unsupported */
+      {
+        Flag = SIGNAL_ERR;    /* signal error */
+      }
       break;
   }
 
@@ -1602,6 +1742,109 @@ uint8_t Cmd_V_F_clamp(void)
 
 
 
+#ifdef SW_HFE_SWEEP
+
+/*
+ *  command: h_FE_sweep
+ *  - return hFE for all drive configurations, sorted by current
+ *    <circuit>:<hFE>/<I_C or I_E> (c: common collector, e: common emitter)
+ *
+ *  returns:
+ *  - SIGNAL_ERR on error
+ *  - SIGNAL_NA on n/a
+ *  - SIGNAL_OK on success
+ */
+
+uint8_t Cmd_h_FE_sweep(void)
+{
+  uint8_t           Flag = SIGNAL_NA;   /* return value */
+  uint8_t           n = 0;              /* counter */
+
+  if (Check.Found != COMP_BJT)          /* other component */
+  {
+    return SIGNAL_ERR;                  /* signal error */
+  }
+
+  FirstFlag = 1;              /* reset multi string logic */
+
+  while (n < HFE_SWEEP_POINTS)     /* loop through table */
+  {
+    if (hFE_Sweep[n].Flags)        /* valid entry */
+    {
+      SpaceLogic();                /* space logic */
+      if (hFE_Sweep[n].Flags & HFE_COMMON_EMITTER) Display_Char('e');
+      else Display_Char('c');
+      Display_Colon();
+      Display_Value(hFE_Sweep[n].hFE, 0, 0);     /* send: hFE */
+      Display_Char('/');
+      Display_Value(hFE_Sweep[n].I, -9, 'A');    /* send: current */
+
+      Flag = SIGNAL_OK;            /* signal success */
+    }
+
+    n++;                           /* next entry */
+  }
+
+  return Flag;
+}
+
+#endif
+
+
+
+#ifdef SERIAL_MULTIDROP
+
+/*
+ *  command: ADDR [<address>]
+ *  - returns address for multi-drop mode
+ *  - or sets new address (1-254), stored in EEPROM
+ *
+ *  returns:
+ *  - SIGNAL_ERR on error
+ *  - SIGNAL_OK on success
+ */
+
+uint8_t Cmd_ADDR(void)
+{
+  uint8_t           Pos;                /* position in RX buffer */
+  uint16_t          Addr = 0;           /* new address */
+  unsigned char     Char;               /* argument char */
+
+  Pos = CmdArgs;
+  if (Pos == 0)                    /* no argument */
+  {
+    /* send current address */
+    Display_FullValue(Serial_Address(0), 0, 0);
+  }
+  else                             /* new address */
+  {
+    Char = RX_Buffer[Pos];
+    if (Char == 0) return SIGNAL_ERR;   /* missing value */
+
+    while (Char != 0)
+    {
+      if ((Char < '0') || (Char > '9')) return SIGNAL_ERR;
+      Addr *= 10;
+      Addr += Char - '0';
+      if (Addr > 254) return SIGNAL_ERR;     /* max. 254 */
+      Pos++;
+      Char = RX_Buffer[Pos];
+    }
+
+    if (Addr == 0) return SIGNAL_ERR;   /* min. 1 */
+
+    /* response is sent before switching to new address */
+    Display_EEString(Cmd_OK_str);       /* send: OK */
+    Serial_Address((uint8_t)Addr);      /* set new address */
+  }
+
+  return SIGNAL_OK;
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   command parsing and processing
  * ************************************************************************ */
@@ -1609,6 +1852,7 @@ uint8_t Cmd_V_F_clamp(void)
 
 /*
  *  check RX buffer for known command
+ *  - compares only commands with the same string length
  *
  *  returns:
  *  - command ID
@@ -1619,15 +1863,31 @@ uint8_t FindCommand(void)
   uint8_t           ID = CMD_NONE;      /* command ID */
   uint8_t           Flag = 1;           /* loop control flag */
   uint8_t           n;                  /* counter */
+  uint8_t           Len = 0;            /* length of received command */
   uint8_t           CmdID;              /* command ID */
   char              CmdChar;            /* single character */
   unsigned char     *CmdAddr;           /* address of command string */
   Cmd_Type          *Data;              /* address of table entry */
   uint8_t           *Addr;              /* address pointer */
 
+  /* get length of received command */
+  #ifdef FUNC_CMD_ARGS
+  /* command might be followed by arguments, separated by a space */
+  while ((RX_Buffer[Len] != 0) && (RX_Buffer[Len] != ' ')) Len++;
+  CmdArgs = 0;                          /* no arguments */
+  if (RX_Buffer[Len] == ' ')            /* got arguments */
+  {
+    RX_Buffer[Len] = 0;                 /* terminate command */
+    CmdArgs = Len + 1;                  /* start of arguments */
+  }
+  #else
+  while (RX_Buffer[Len] != 0) Len++;
+  #endif
+
   /*
    *  Compare command in RX buffer with command strings referenced by
-   *  a stored table.
+   *  a stored table. The string length stored in the table allows to
+   *  skip non-matching commands without reading their strings.
    */
 
   Data = (Cmd_Type *)&Cmd_Table;   /* start address of table */
@@ -1637,12 +1897,17 @@ uint8_t FindCommand(void)
     /* read entry from reference table */
     Addr = (uint8_t *)Data;             /* start of current entry */
     CmdID = DATA_read_byte(Addr);       /* read command ID */
-    Addr++;                             /* for next data field */
-    /* read string address */
-    CmdAddr = (unsigned char *)DATA_read_word((uint16_t *)Addr);
 
-    if (CmdID)                /* valid command ID */
+    if (CmdID == 0)           /* reached end of table */
+    {
+      Flag = 0;                         /* end table loop */
+    }
+    else if (DATA_read_byte(&Data->Len) == Len)    /* same length */
     {
+      /* read string address */
+      Addr++;                           /* for next data field */
+      CmdAddr = (unsigned char *)DATA_read_word((uint16_t *)Addr);
+
       /* read and compare characterwise */
       n = 0;
       while (n < RX_BUFFER_SIZE)        /* loop through string */
@@ -1667,14 +1932,28 @@ uint8_t FindCommand(void)
         }
       }
     }
-    else                      /* reached end of table */
-    {
-      Flag = 0;                         /* end table loop */
-    }
 
     Data++;                             /* next entry */
   }
 
+  #ifdef FUNC_CMD_ARGS
+  /* only RAW, ADDR, TOOL and KEY take arguments */
+  if (CmdArgs > 0)            /* got arguments */
+  {
+    Flag = 0;                 /* default: no arguments allowed */
+    #ifdef SW_RAW_STREAM
+    if (ID == CMD_RAW) Flag = 1;
+    #endif
+    #ifdef SERIAL_MULTIDROP
+    if (ID == CMD_ADDR) Flag = 1;
+    #endif
+    #ifdef SW_REMOTE_TOOLS
+    if ((ID == CMD_TOOL) || (ID == CMD_KEY)) Flag = 1;
+    #endif
+    if (Flag == 0) ID = CMD_NONE;
+  }
+  #endif
+
   return ID;
 }
 
@@ -1687,6 +1966,53 @@ uint8_t FindCommand(void)
  *  - command ID
  */
 
+#ifdef SERIAL_RX_QUEUE
+
+uint8_t GetCommand(void)
+{
+  uint8_t           ID = CMD_NONE;      /* command ID */
+  uint8_t           n;                  /* counter */
+  uint8_t           Old_SREG;           /* status register */
+
+  /* check for pending command */
+  if (Cfg.OP_Control & OP_RX_LOCKED)    /* command queued */
+  {
+    /* copy oldest command from queue to RX buffer */
+    for (n = 0; n < RX_BUFFER_SIZE; n++)
+    {
+      RX_Buffer[n] = RX_Queue[RX_Out][n];
+    }
+
+    RX_Out++;                           /* next line */
+    if (RX_Out == SERIAL_RX_QUEUE) RX_Out = 0;     /* overflow: roll over */
+
+    /* free queue slot (shared with RX ISR) */
+    Old_SREG = SREG;                    /* save status register */
+    cli();                              /* disable interrupts */
+    RX_Count--;                         /* one command less */
+    if (RX_Count == 0)                  /* queue empty */
+    {
+      Cfg.OP_Control &= ~OP_RX_LOCKED;  /* no pending command */
+    }
+    SREG = Old_SREG;                    /* restore status register */
+
+    /* check for command (invalid line is empty) */
+    #ifdef SERIAL_MULTIDROP
+    if (Serial_CheckAddress())          /* command for this tester */
+    #endif
+    ID = FindCommand();                 /* get command */
+
+    if (ID == CMD_NONE)                 /* no command found */
+    {
+      Display_EEString_NL(Cmd_ERR_str);      /* send: ERR & newline */
+    }
+  }
+
+  return ID;
+}
+
+#else
+
 uint8_t GetCommand(void)
 {
   uint8_t           ID = CMD_NONE;      /* command ID */
@@ -1698,6 +2024,9 @@ uint8_t GetCommand(void)
     if (! (Cfg.OP_Control & OP_RX_OVERFLOW))   /* no buffer overflow */
     {
       /* check for command */
+      #ifdef SERIAL_MULTIDROP
+      if (Serial_CheckAddress())        /* command for this tester */
+      #endif
       ID = FindCommand();               /* get command */
     }
     /* else: overflow triggers output of error */
@@ -1715,44 +2044,28 @@ uint8_t GetCommand(void)
   return ID;
 }
 
+#endif
+
 
 
 /*
- *  run command received via serial interface
+ *  run command returning a value of the probed component
  *
  *  requires:
  *  - ID: command ID
  *
  *  returns:
- *  - virtual key
+ *  - SIGNAL_ERR on error
+ *  - SIGNAL_NA on n/a
+ *  - SIGNAL_OK on success
  */
 
-uint8_t RunCommand(uint8_t ID)
+uint8_t Cmd_Value(uint8_t ID)
 {
-  uint8_t           Key = KEY_NONE;     /* virtual key */
-  uint8_t           Flag = SIGNAL_OK;   /* result of command function */
-
-  /*
-   *  run command
-   */
+  uint8_t           Flag = SIGNAL_OK;   /* return value */
 
   switch (ID)
   {
-    case CMD_VER:             /* return firmware version */
-      Display_EEString(Version_str);         /* send firmware version */
-      break;
-
-    case CMD_OFF:             /* power off */
-      Key = KEY_POWER_OFF;                   /* set virtual key */
-      Display_EEString(Cmd_OK_str);          /* send: OK */
-      break;
-
-    case CMD_PROBE:           /* probe component */
-      Key = KEY_PROBE;                       /* set virtual key */
-      /* OK is returned after probing by main() */
-      Flag = SIGNAL_NONE;                    /* no newline */ 
-      break;
-
     case CMD_COMP:            /* return component type ID */
       Display_Value(Check.Found, 0, 0);      /* send component type ID */
       break;
@@ -1765,19 +2078,6 @@ uint8_t RunCommand(uint8_t ID)
       Display_Value(Info.Quantity, 0, 0);    /* send quantity */
       break;
 
-    case CMD_NEXT:            /* select next component */
-      /* allow only 2nd component */
-      if ((Info.Selected == 1) && (Info.Quantity == 2))
-      {
-        Info.Selected = 2;                   /* 2nd one */
-        Display_EEString(Cmd_OK_str);        /* send: OK */
-      }
-      else
-      {
-        Flag = SIGNAL_NA;                    /* signal n/a */
-      }
-      break;
-
     case CMD_TYPE:            /* return more specific type */
       Flag = Cmd_TYPE();                     /* run command */
       break;
@@ -1794,6 +2094,12 @@ uint8_t RunCommand(uint8_t ID)
       Flag = Cmd_PIN();                      /* run command */
       break;
 
+    #ifdef SW_PROFILER
+    case CMD_PROF:            /* return profiler data */
+      Flag = Cmd_PROF();                     /* run command */
+      break;
+    #endif
+
     case CMD_R:               /* return resistance */
       Flag = Cmd_R();                        /* run command */
       break;
@@ -1907,11 +2213,1552 @@ uint8_t RunCommand(uint8_t ID)
       break;
     #endif    
 
+    #ifdef SW_HFE_SWEEP
+    case CMD_H_FE_SWEEP:      /* return hFE sweep */
+      Flag = Cmd_h_FE_sweep();               /* run command */
+      break;
+    #endif
+
     default:                  /* unknown/unsupported */
       Flag = SIGNAL_ERR;                     /* signal error */
       break;
   }
 
+  return Flag;
+}
+
+
+
+#ifdef SW_BIN_FRAMES
+
+/* ************************************************************************
+ *   binary frames
+ * ************************************************************************ */
+
+
+/*
+ *  send byte of binary frame and update CRC-8
+ *  - CRC = X^8 + X^5 + X^4 + 1 (same as 1-Wire)
+ *
+ *  requires:
+ *  - Byte: data byte
+ */
+
+void Frame_Byte(uint8_t Byte)
+{
+  uint8_t           n = 8;              /* bit counter */
+  uint8_t           Bit;                /* LSB */
+
+  Serial_WriteByte(Byte);               /* send byte */
+
+  /* update CRC, LSB first */
+  while (n > 0)
+  {
+    Bit = FrameCRC ^ Byte;              /* XOR LSBs */
+    FrameCRC >>= 1;                     /* shift CRC */
+    if (Bit & 0b00000001)               /* feedback */
+    {
+      FrameCRC ^= 0b10001100;           /* XOR taps */
+    }
+    Byte >>= 1;                         /* next bit */
+    n--;
+  }
+}
+
+
+
+/*
+ *  send 32 bit value, little endian
+ *
+ *  requires:
+ *  - Value: unsigned value
+ */
+
+void Frame_Long(uint32_t Value)
+{
+  uint8_t           n = 4;              /* byte counter */
+
+  while (n > 0)
+  {
+    Frame_Byte((uint8_t)Value);         /* send LSB */
+    Value >>= 8;                        /* next byte */
+    n--;
+  }
+}
+
+
+
+/*
+ *  start binary frame
+ *
+ *  requires:
+ *  - Type: frame type
+ *  - Length: size of payload (in bytes)
+ */
+
+void Frame_Start(uint8_t Type, uint8_t Length)
+{
+  Serial_WriteByte(FRAME_SYNC);         /* send sync byte */
+  FrameCRC = 0;                         /* reset CRC */
+  Frame_Byte(Length + 1);               /* send length (incl. type) */
+  Frame_Byte(Type);                     /* send type */
+}
+
+
+
+/*
+ *  send value record of binary frame
+ *
+ *  requires:
+ *  - ID: command ID (FRAME_NEG added for negative value)
+ *  - Value: unsigned value
+ *  - Scale: exponent (value * 10^Scale)
+ */
+
+void Frame_Record(uint8_t ID, uint32_t Value, int8_t Scale)
+{
+  Frame_Byte(ID);                       /* send command ID */
+  Frame_Byte((uint8_t)Scale);           /* send scale */
+  Frame_Long(Value);                    /* send value */
+}
+
+
+
+/*
+ *  end binary frame by sending CRC
+ */
+
+void Frame_End(void)
+{
+  Serial_WriteByte(FrameCRC);           /* send CRC */
+}
+
+
+
+/*
+ *  capture value of a component value command
+ *  - runs command without output and catches the first value
+ *    passed to Display_Value()
+ *
+ *  requires:
+ *  - ID: command ID
+ *
+ *  returns:
+ *  - 1 if a value got captured
+ *  - 0 if not
+ */
+
+uint8_t Frame_Capture(uint8_t ID)
+{
+  uint8_t           Flag;               /* return value */
+
+  Frame.Count = 0;                      /* reset counter */
+  Frame.Sign = 0;                       /* reset sign */
+  Frame.Mode |= FRAME_CAPTURE;          /* enable capture */
+  Cfg.OP_Control &= ~OP_OUT_SER;        /* disable output to serial */
+
+  Flag = Cmd_Value(ID);                 /* run command */
+
+  Cfg.OP_Control |= OP_OUT_SER;         /* enable output to serial */
+  Frame.Mode &= ~FRAME_CAPTURE;         /* disable capture */
+
+  if ((Flag == SIGNAL_OK) && (Frame.Count > 0))   /* got value */
+  {
+    Flag = 1;
+  }
+  else                                  /* no value */
+  {
+    Flag = 0;
+  }
+
+  return Flag;
+}
+
+
+
+/*
+ *  send all values of the probed component as binary frame
+ *  - binary counterpart of command ALL
+ *  - value commands without numeric value (e.g. TYPE or PIN) are skipped
+ *  - burst frames start with the record number
+ *
+ *  requires:
+ *  - Type: frame type (FRAME_ALL or FRAME_BURST)
+ */
+
+void Frame_ALL(uint8_t Type)
+{
+  uint8_t           Run;                /* pass counter */
+  uint8_t           Records = 0;        /* number of records */
+  uint8_t           Max;                /* max. number of records */
+  uint8_t           n;                  /* record counter */
+  uint8_t           Length;             /* payload size */
+  uint8_t           ID;                 /* command ID */
+  Cmd_Type          *Data;              /* address of table entry */
+
+  /*
+   *  first pass: count records
+   *  second pass: send records
+   */
+
+  Run = 2;
+  while (Run > 0)
+  {
+    if (Run == 1)                       /* second pass */
+    {
+      Length = Records * FRAME_RECORD;  /* size of records */
+      #ifdef SW_BURST
+      if (Type == FRAME_BURST) Length++;     /* record number */
+      #endif
+
+      Frame_Start(Type, Length);        /* send header */
+
+      #ifdef SW_BURST
+      if (Type == FRAME_BURST) Frame_Byte(BurstCount);   /* send number */
+      #endif
+    }
+
+    if (Run == 2) Max = FRAME_MAX_RECORDS;   /* first pass */
+    else Max = Records;                      /* second pass */
+
+    Data = (Cmd_Type *)&Cmd_Table;      /* start address of table */
+    n = 0;                              /* reset record counter */
+
+    while (n < Max)
+    {
+      ID = DATA_read_byte((uint8_t *)Data);  /* read command ID */
+      if (ID == CMD_NONE) break;        /* end of table */
+
+      /* skip commands not returning a component value */
+      if ((ID >= CMD_COMP) && (ID != CMD_NEXT) && (ID != CMD_PROF))
+      {
+        if (Frame_Capture(ID))          /* got value */
+        {
+          n++;                          /* one record more */
+
+          if (Run == 1)                 /* second pass */
+          {
+            if (Frame.Sign) ID |= FRAME_NEG;     /* negative value */
+            Frame_Record(ID, Frame.Value, Frame.Scale);  /* send record */
+          }
+        }
+      }
+
+      Data++;                           /* next entry */
+    }
+
+    Records = n;                        /* number of records */
+    Run--;                              /* next pass */
+  }
+
+  Frame_End();                          /* send CRC */
+}
+
+#endif
+
+
+
+/*
+ *  command: ALL
+ *  - return all available values of the probed component
+ *  - format: <command>=<value>;<command>=<value>;...
+ *  - runs each value command silently first to skip n/a values
+ *  - sends a binary frame instead when binary frames are enabled
+ *
+ *  returns:
+ *  - SIGNAL_OK
+ *  - SIGNAL_NONE for binary frame
+ */
+
+uint8_t Cmd_ALL(void)
+{
+  uint8_t           First = 1;          /* first record field */
+  uint8_t           ID;                 /* command ID */
+  uint8_t           Flag;               /* result of command function */
+  unsigned char     *CmdAddr;           /* address of command string */
+  Cmd_Type          *Data;              /* address of table entry */
+  uint8_t           *Addr;              /* address pointer */
+
+  #ifdef SW_BIN_FRAMES
+  if (Frame.Mode & FRAME_ON)       /* binary frames */
+  {
+    Frame_ALL(FRAME_ALL);               /* send frame */
+    return SIGNAL_NONE;                 /* no newline */
+  }
+  #endif
+
+  Data = (Cmd_Type *)&Cmd_Table;   /* start address of table */
+
+  while (1)                   /* loop through table entries */
+  {
+    /* read entry from reference table */
+    Addr = (uint8_t *)Data;             /* start of current entry */
+    ID = DATA_read_byte(Addr);          /* read command ID */
+    Addr++;                             /* for next data field */
+    /* read string address */
+    CmdAddr = (unsigned char *)DATA_read_word((uint16_t *)Addr);
+
+    if (ID == CMD_NONE) break;          /* end of table */
+
+    /* skip commands not returning a component value */
+    if ((ID >= CMD_COMP) && (ID != CMD_NEXT) && (ID != CMD_PROF))
+    {
+      /* dry run without output */
+      Cfg.OP_Control &= ~OP_OUT_SER;    /* disable output to serial */
+      Flag = Cmd_Value(ID);             /* run command */
+      Cfg.OP_Control |= OP_OUT_SER;     /* enable output to serial */
+
+      if (Flag == SIGNAL_OK)            /* value available */
+      {
+        if (First)                      /* first field */
+        {
+          First = 0;                    /* reset flag */
+        }
+        else                            /* another field */
+        {
+          Display_Char(';');            /* send field separator */
+        }
+
+        Display_EEString(CmdAddr);      /* send command name */
+        Display_Char('=');
+        Cmd_Value(ID);                  /* send value */
+      }
+    }
+
+    Data++;                             /* next entry */
+  }
+
+  return SIGNAL_OK;
+}
+
+
+
+#ifdef SW_STREAM
+
+/*
+ *  command: MON_R, MON_C, MON_L
+ *  - stream values measured on probes #1 and #3 until STOP is received
+ *  - line format: <time in ms> <value>
+ *  - C is followed by ESR if available
+ *  - sends binary frames instead when binary frames are enabled
+ *  - overwrites result of last probing
+ *
+ *  requires:
+ *  - Cmd: command ID
+ *
+ *  returns:
+ *  - SIGNAL_OK
+ */
+
+uint8_t Cmd_MON(uint8_t Cmd)
+{
+  uint8_t           Run = 1;            /* loop control flag */
+  uint8_t           Flag;               /* value available */
+  uint8_t           ID;                 /* command ID */
+  uint32_t          Tick;               /* current tick */
+  uint32_t          Last;               /* tick of last sample */
+  uint32_t          Time = 0;           /* time stamp (in ms) */
+  uint32_t          Rest = 0;           /* remainder of time (in s) */
+  Resistor_Type     *R1;                /* pointer to resistor #1 */
+  Capacitor_Type    *Cap;               /* pointer to cap */
+  #if defined (SW_ESR) || defined (SW_OLD_ESR)
+  uint16_t          ESR = UINT16_MAX;   /* ESR (in 0.01 Ohms) */
+  #endif
+  #ifdef SW_BIN_FRAMES
+  uint8_t           Records;            /* number of value records */
+  #endif
+
+  /* init */
+  R1 = &Resistors[0];                   /* pointer to first resistor */
+  Cap = &Caps[0];                       /* pointer to first cap */
+  Check.Diodes = 0;                     /* reset diode counter */
+  Check.CapRange = CAP_RANGE_MEMORY;    /* enable range memory */
+  if (Cmd == CMD_MON_R)                 /* R */
+  {
+    /* increase number of samples to lower spread of measurement values */
+    Cfg.Samples = 100;                  /* perform 100 ADC samples */
+    #ifdef ADC_CLOCK_PROFILES
+    ADC_Profile(ADC_FAST);              /* fast ADC clock */
+    #endif
+  }
+
+  Display_EEString_NL(Cmd_OK_str);      /* send: OK & newline */
+  Last = Profile_Tick();                /* start time */
+
+
+  /*
+   *  processing loop
+   */
+
+  while (Run)
+  {
+    wdt_reset();                        /* reset watchdog */
+
+    /* check for command */
+    if (Cfg.OP_Control & OP_RX_LOCKED)  /* command received */
+    {
+      ID = GetCommand();                /* get command (sends ERR if unknown) */
+
+      if (ID == CMD_STOP)               /* stop */
+      {
+        Run = 0;                        /* end loop */
+      }
+      else if (ID != CMD_NONE)          /* other command */
+      {
+        Display_EEString_NL(Cmd_ERR_str);    /* send: ERR & newline */
+      }
+    }
+
+    if (Run)                            /* measure and send value */
+    {
+      Flag = 0;                         /* reset flag */
+
+      if (Cmd == CMD_MON_C)             /* C */
+      {
+        Check.Found = COMP_NONE;              /* no component */
+        /* keep probe order of normal probing cycle */
+        MeasureCap(PROBE_3, PROBE_1, 0);      /* measure capacitance */
+
+        if (Check.Found == COMP_CAPACITOR)    /* found cap */
+        {
+          Flag = 1;                           /* got value */
+          #if defined (SW_ESR) || defined (SW_OLD_ESR)
+          ESR = MeasureESR(Cap);              /* measure ESR */
+          #endif
+        }
+      }
+      else                              /* R or L */
+      {
+        UpdateProbes2(PROBE_1, PROBE_3);      /* set probes */
+        Check.Resistors = 0;                  /* reset resistor counter */
+        CheckResistor();                      /* check for resistor */
+
+        if (Check.Resistors == 1)             /* found resistor */
+        {
+          Flag = 1;                           /* got value */
+
+          #ifdef SW_INDUCTOR
+          if (Cmd == CMD_MON_L)               /* L */
+          {
+            /* get inductance */
+            if (MeasureInductor(R1) != 1) Flag = 0;    /* no inductor */
+          }
+          #endif
+        }
+      }
+
+      /* update time stamp (24 bit tick counter, 1024 MCU cycles per tick) */
+      Tick = Profile_Tick();
+      Rest += (((Tick - Last) & 0x00FFFFFF) * 1024) / MCU_CYCLES_PER_US;
+      Last = Tick;
+      Time += Rest / 1000;              /* add full ms */
+      Rest %= 1000;                     /* keep remainder */
+
+      #ifdef SW_BIN_FRAMES
+      if (Frame.Mode & FRAME_ON)        /* binary frame */
+      {
+        /* payload: time stamp and 0-2 value records */
+        Records = 0;                    /* number of records */
+        if (Flag)                       /* valid value */
+        {
+          Records++;                    /* one record */
+          #if defined (SW_ESR) || defined (SW_OLD_ESR)
+          if ((Cmd == CMD_MON_C) && (ESR < UINT16_MAX)) Records++;   /* two */
+          #endif
+        }
+
+        Frame_Start(FRAME_MON, 4 + Records * FRAME_RECORD);
+        Frame_Long(Time);               /* send: time */
+
+        if (Flag)                       /* valid value */
+        {
+          if (Cmd == CMD_MON_C)         /* C */
+          {
+            Frame_Record(CMD_C, Cap->Value, Cap->Scale);
+
+            #if defined (SW_ESR) || defined (SW_OLD_ESR)
+            if (ESR < UINT16_MAX)       /* valid ESR */
+            {
+              Frame_Record(CMD_ESR, ESR, -2);
+            }
+            #endif
+          }
+          #ifdef SW_INDUCTOR
+          else if (Cmd == CMD_MON_L)    /* L */
+          {
+            Frame_Record(CMD_L, Inductor.Value, Inductor.Scale);
+          }
+          #endif
+          else                          /* R */
+          {
+            Frame_Record(CMD_R, R1->Value, R1->Scale);
+          }
+        }
+
+        Frame_End();                    /* send CRC */
+        continue;                       /* next sample */
+      }
+      #endif
+
+      /* send time stamp and value */
+      Display_FullValue(Time, 0, 0);    /* send: time */
+      Display_Space();
+
+      if (Flag)                         /* valid value */
+      {
+        if (Cmd == CMD_MON_C)           /* C */
+        {
+          Display_Value(Cap->Value, Cap->Scale, 'F');   /* send: C */
+
+          #if defined (SW_ESR) || defined (SW_OLD_ESR)
+          if (ESR < UINT16_MAX)         /* valid ESR */
+          {
+            Display_Space();
+            Display_Value(ESR, -2, LCD_CHAR_OMEGA);     /* send: ESR */
+          }
+          #endif
+        }
+        #ifdef SW_INDUCTOR
+        else if (Cmd == CMD_MON_L)      /* L */
+        {
+          Display_Value(Inductor.Value, Inductor.Scale, 'H');   /* send: L */
+        }
+        #endif
+        else                            /* R */
+        {
+          Display_Value(R1->Value, R1->Scale, LCD_CHAR_OMEGA);  /* send: R */
+        }
+      }
+      else                              /* no value */
+      {
+        Display_EEString(Cmd_NA_str);   /* send: N/A */
+      }
+
+      Serial_NewLine();                 /* send newline */
+    }
+  }
+
+  /* clean up */
+  Check.Found = COMP_NONE;              /* last probing result is lost */
+  Check.CapRange = CAP_RANGE_NONE;      /* disable range memory */
+  Cfg.Samples = ADC_SAMPLES;            /* set ADC samples back to default */
+  #ifdef ADC_CLOCK_PROFILES
+  ADC_Profile(ADC_PRECISE);             /* standard ADC clock */
+  #endif
+
+  Display_EEString(Cmd_OK_str);         /* send: OK */
+
+  return SIGNAL_OK;
+}
+
+#endif
+
+
+
+#ifdef SW_RAW_STREAM
+
+/*
+ *  local constants for raw ADC streaming
+ */
+
+#define RAW_LINE         16        /* samples per line */
+
+
+
+/*
+ *  command: RAW <setup> <channel> [<interval>]
+ *  - sets up the probes and streams raw ADC readings of a probe until
+ *    STOP is received
+ *  - setup: one char for each of probes #1-#3
+ *    z: HiZ, +: Vcc, -: Gnd, u/d: pull-up/down via Rl, U/D: via Rh
+ *  - channel: probe to read (1-3)
+ *  - interval: additional delay between samples in ms (default 0)
+ *  - readings: 3 hex digits each (10 bit ADC value, Vcc as reference),
+ *    RAW_LINE readings per line
+ *  - overwrites result of last probing
+ *
+ *  returns:
+ *  - SIGNAL_OK on success
+ *  - SIGNAL_ERR on any invalid argument
+ */
+
+uint8_t Cmd_RAW(void)
+{
+  uint8_t           Run = 1;            /* loop control flag */
+  uint8_t           ID;                 /* command ID */
+  uint8_t           n;                  /* counter */
+  unsigned char     Char;               /* argument char */
+  uint8_t           Pos;                /* position in RX buffer */
+  uint8_t           Pin[3];             /* pin bits of probes */
+  uint8_t           Rl[3];              /* Rl bits of probes */
+  uint8_t           Rh[3];              /* Rh bits of probes */
+  uint8_t           Ch[3];              /* ADC channels of probes */
+  uint8_t           ADC_Dir = 0;        /* ADC_DDR */
+  uint8_t           ADC_Out = 0;        /* ADC_PORT */
+  uint8_t           R_Dir = 0;          /* R_DDR */
+  uint8_t           R_Out = 0;          /* R_PORT */
+  uint8_t           Channel;            /* ADC channel */
+  uint16_t          Interval = 0;       /* delay between samples */
+
+  /* get bits of probes */
+  UpdateProbes(PROBE_1, PROBE_2, PROBE_3);
+  Pin[0] = Probes.Pin_1;
+  Pin[1] = Probes.Pin_2;
+  Pin[2] = Probes.Pin_3;
+  Rl[0] = Probes.Rl_1;
+  Rl[1] = Probes.Rl_2;
+  Rl[2] = Probes.Rl_3;
+  Rh[0] = Probes.Rh_1;
+  Rh[1] = Probes.Rh_2;
+  Rh[2] = Probes.Rh_3;
+  Ch[0] = Probes.Ch_1;
+  Ch[1] = Probes.Ch_2;
+  Ch[2] = Probes.Ch_3;
+
+
+  /*
+   *  parse arguments (buffer is terminated by 0)
+   */
+
+  Pos = CmdArgs;
+  if (Pos == 0) return SIGNAL_ERR;      /* no arguments */
+
+  /* setup of probes #1-#3 */
+  for (n = 0; n <= 2; n++)
+  {
+    Char = RX_Buffer[Pos];
+    Pos++;
+
+    switch (Char)
+    {
+      case 'z':                    /* HiZ */
+        break;
+
+      case '+':                    /* Vcc */
+        ADC_Out |= Pin[n];
+        /* fall through */
+      case '-':                    /* Gnd */
+        ADC_Dir |= Pin[n];
+        break;
+
+      case 'u':                    /* pull-up via Rl */
+        R_Out |= Rl[n];
+        /* fall through */
+      case 'd':                    /* pull-down via Rl */
+        R_Dir |= Rl[n];
+        break;
+
+      case 'U':                    /* pull-up via Rh */
+        R_Out |= Rh[n];
+        /* fall through */
+      case 'D':                    /* pull-down via Rh */
+        R_Dir |= Rh[n];
+        break;
+
+      default:                     /* invalid */
+        return SIGNAL_ERR;
+    }
+  }
+
+  /* channel */
+  if (RX_Buffer[Pos] != ' ') return SIGNAL_ERR;
+  Pos++;
+  Char = RX_Buffer[Pos];
+  if ((Char < '1') || (Char > '3')) return SIGNAL_ERR;
+  Channel = Ch[Char - '1'];
+  Pos++;
+
+  /* optional interval */
+  if (RX_Buffer[Pos] == ' ')
+  {
+    Pos++;
+    Char = RX_Buffer[Pos];
+    if (Char == 0) return SIGNAL_ERR;   /* missing value */
+
+    while (Char != 0)
+    {
+      if ((Char < '0') || (Char > '9')) return SIGNAL_ERR;
+      if (Interval >= 6000) return SIGNAL_ERR;     /* max. 59999ms */
+      Interval *= 10;
+      Interval += Char - '0';
+      Pos++;
+      Char = RX_Buffer[Pos];
+    }
+  }
+  else if (RX_Buffer[Pos] != 0) return SIGNAL_ERR;
+
+
+  /*
+   *  set up probes and ADC
+   */
+
+  ADC_PORT = ADC_Out;
+  ADC_DDR = ADC_Dir;
+  R_DDR = R_Dir;
+  R_PORT = R_Out;
+
+  #ifdef ADC_INTERRUPT
+  ADCSRA &= ~(1 << ADIE);               /* polled conversions */
+  #endif
+
+  /* Vcc as reference, like ReadU() */
+  Channel &= ADC_CHAN_MASK;
+  Channel |= ADC_REF_VCC;
+  ADC_SetReference(Channel);
+
+  ADCSRA |= (1 << ADSC);                /* dummy conversion */
+  while (ADCSRA & (1 << ADSC));         /* wait until conversion is done */
+
+  Display_EEString_NL(Cmd_OK_str);      /* send: OK & newline */
+
+
+  /*
+   *  processing loop
+   */
+
+  n = 0;                                /* readings in line */
+
+  while (Run)
+  {
+    wdt_reset();                        /* reset watchdog */
+
+    /* check for command */
+    if (Cfg.OP_Control & OP_RX_LOCKED)  /* command received */
+    {
+      ID = GetCommand();                /* get command (sends ERR if unknown) */
+
+      if (ID == CMD_STOP)               /* stop */
+      {
+        Run = 0;                        /* end loop */
+      }
+      else if (ID != CMD_NONE)          /* other command */
+      {
+        if (n > 0)                      /* line not finished */
+        {
+          Serial_NewLine();             /* send newline */
+          n = 0;
+        }
+        Display_EEString_NL(Cmd_ERR_str);    /* send: ERR & newline */
+      }
+    }
+
+    if (Run)                            /* sample and send reading */
+    {
+      ADCSRA |= (1 << ADSC);            /* start conversion */
+      while (ADCSRA & (1 << ADSC));     /* wait until conversion is done */
+      Display_HexValue(ADCW, 10);       /* send: reading */
+
+      n++;                              /* one more in line */
+      if (n == RAW_LINE)                /* line full */
+      {
+        Serial_NewLine();               /* send newline */
+        n = 0;
+      }
+
+      if (Interval) MilliSleep(Interval);    /* wait */
+    }
+  }
+
+  if (n > 0) Serial_NewLine();          /* finish line */
+
+  /* clean up */
+  ADC_DDR = 0;                          /* set probes to HiZ */
+  ADC_PORT = 0;
+  R_DDR = 0;
+  R_PORT = 0;
+  Check.Found = COMP_NONE;              /* last probing result is lost */
+
+  Display_EEString(Cmd_OK_str);         /* send: OK */
+
+  return SIGNAL_OK;
+}
+
+/* clean-up of local constants */
+#undef RAW_LINE
+
+#endif
+
+
+
+#ifdef SW_CYCLE_BENCH
+
+/*
+ *  local constants for benchmark
+ */
+
+#define BENCH_CALLS      32        /* calls per routine */
+
+
+
+/*
+ *  send result of benchmark for a routine
+ *  - converts time base ticks into MCU cycles per call
+ *  - format: <routine>:<cycles>
+ *
+ *  requires:
+ *  - String: name of routine
+ *  - Start: time base tick at start
+ *  - Calls: number of calls
+ */
+
+void Bench_Send(const unsigned char *String, uint32_t Start, uint8_t Calls)
+{
+  uint32_t          Cycles;             /* MCU cycles */
+
+  /* 1024 MCU cycles per tick */
+  Cycles = (Profile_Tick() - Start) & 0x00FFFFFF;
+  Cycles *= 1024;
+  Cycles /= Calls;                      /* per call */
+
+  SpaceLogic();                         /* space logic */
+  Display_EEString(String);             /* send: routine */
+  Display_Colon();
+  Display_FullValue(Cycles, 0, 0);      /* send: cycles */
+}
+
+
+
+/*
+ *  command: BENCH
+ *  - run hot routines with fixed inputs and return MCU cycles per call
+ *  - format: <routine>:<cycles> separated by spaces
+ *  - cycles include loop overhead and interrupts, resolution is
+ *    1024 cycles divided by the number of calls
+ *  - LCD_Char() uses the actual display
+ *
+ *  returns:
+ *  - SIGNAL_OK
+ */
+
+uint8_t Cmd_BENCH(void)
+{
+  uint8_t           n;                  /* counter */
+  uint8_t           Calls;              /* number of calls */
+  uint8_t           Control;            /* output control */
+  uint32_t          Start;              /* start tick */
+
+  FirstFlag = 1;              /* reset multi string logic */
+
+  /* ReadU(): probe #1 */
+  Start = Profile_Tick();
+  n = BENCH_CALLS;
+  while (n > 0)
+  {
+    ReadU(TP1);
+    n--;
+  }
+  Bench_Send(Bench_ReadU_str, Start, BENCH_CALLS);
+
+  /* LCD_Char(): one line of chars */
+  Calls = UI.CharMax_X;
+  LCD_CharPos(1, 1);
+  Start = Profile_Tick();
+  n = Calls;
+  while (n > 0)
+  {
+    LCD_Char('0' + (n & 0x07));
+    n--;
+  }
+  Bench_Send(Bench_LCD_Char_str, Start, Calls);
+
+  /* Display_Value(): 123.456nF, no output */
+  Control = Cfg.OP_Control;             /* save output control */
+  Cfg.OP_Control &= ~(OP_OUT_LCD | OP_OUT_SER);  /* mute output */
+  Start = Profile_Tick();
+  n = BENCH_CALLS;
+  while (n > 0)
+  {
+    Display_Value(123456, -12, 'F');
+    n--;
+  }
+  Cfg.OP_Control = Control;             /* restore output control */
+  Bench_Send(Bench_Value_str, Start, BENCH_CALLS);
+
+  /* FindCommand(): this command */
+  #ifndef SERIAL_RX_QUEUE
+  Cfg.OP_Control |= OP_RX_LOCKED;       /* keep RX ISR off the buffer */
+  #endif
+  n = 0;
+  while (n < 5)                         /* copy "BENCH" */
+  {
+    RX_Buffer[n] = DATA_read_byte(&Cmd_BENCH_str[n]);
+    n++;
+  }
+  RX_Buffer[n] = 0;                     /* terminate string */
+  Start = Profile_Tick();
+  n = BENCH_CALLS;
+  while (n > 0)
+  {
+    FindCommand();
+    n--;
+  }
+  Bench_Send(Bench_FindCommand_str, Start, BENCH_CALLS);
+  RX_Buffer[0] = 0;                     /* clear buffer */
+  #ifndef SERIAL_RX_QUEUE
+  Cfg.OP_Control &= ~OP_RX_LOCKED;      /* unlock buffer */
+  #endif
+
+  #if defined (FUNC_EVALUE) || defined (FUNC_COLORCODE) || defined (FUNC_EIA96)
+  /* GetENormValue(): 4.7k in E24 with 5% */
+  Start = Profile_Tick();
+  n = BENCH_CALLS;
+  while (n > 0)
+  {
+    GetENormValue(4700, 0, E24, 50);
+    n--;
+  }
+  Bench_Send(Bench_ENorm_str, Start, BENCH_CALLS);
+  #endif
+
+  return SIGNAL_OK;
+}
+
+/* clean-up of local constants */
+#undef BENCH_CALLS
+
+#endif
+
+
+
+/*
+ *  check for cancellation of asynchronous probing
+ *  - processes a command received while probing by APROBE
+ *  - CANCEL is acknowledged with OK, any other command with ERR
+ *  - RX is kept running only with hardware USART, so cancellation isn't
+ *    supported for the bit-bang serial interface
+ *
+ *  returns:
+ *  - 0 to continue probing
+ *  - 1 if probing got canceled
+ */
+
+uint8_t ProbeCanceled(void)
+{
+  uint8_t           Flag = 0;           /* return value */
+  uint8_t           ID;                 /* command ID */
+
+  /* asynchronous probing and command received */
+  if ((Cfg.OP_Control & (OP_PROBE_ASYNC | OP_RX_LOCKED)) ==
+      (OP_PROBE_ASYNC | OP_RX_LOCKED))
+  {
+    Display_Serial_Only();              /* switch output to serial */
+
+    ID = GetCommand();                  /* get command (sends ERR if unknown) */
+
+    if (ID == CMD_CANCEL)               /* cancel */
+    {
+      Display_EEString_NL(Cmd_OK_str);  /* send: OK & newline */
+      Flag = 1;                         /* signal cancellation */
+      #ifdef SW_BURST
+      BurstRuns = 0;                    /* end burst probing */
+      #endif
+    }
+    else if (ID != CMD_NONE)            /* other command */
+    {
+      Display_EEString_NL(Cmd_ERR_str); /* send: ERR & newline */
+    }
+
+    Display_LCD_Only();                 /* switch output back to display */
+  }
+
+  return Flag;
+}
+
+
+
+#ifdef SW_BURST
+
+/*
+ *  local constants for burst probing
+ */
+
+#define BURST_POLL       20        /* time between part checks (in ms) */
+#define BURST_STABLE     3         /* checks with same result in a row */
+
+
+
+/*
+ *  send result record of burst probing
+ *  - format: <number>,<type ID>,<values like ALL>
+ *  - or binary frame when binary frames are enabled
+ */
+
+void Burst_Record(void)
+{
+  BurstCount++;                         /* one record more */
+
+  #ifdef SW_BIN_FRAMES
+  if (Frame.Mode & FRAME_ON)       /* binary frames */
+  {
+    Frame_ALL(FRAME_BURST);             /* send frame */
+    return;
+  }
+  #endif
+
+  Display_Value(BurstCount, 0, 0);      /* send record number */
+  Display_Char(',');
+  Display_Value(Check.Found, 0, 0);     /* send component type ID */
+  Display_Char(',');
+  Cmd_ALL();                            /* send values */
+  Serial_NewLine();                     /* send newline */
+}
+
+
+
+/*
+ *  end burst probing
+ *  - sends completion message "DONE <number of records>"
+ */
+
+void Burst_Done(void)
+{
+  Cfg.OP_Control &= ~OP_PROBE_ASYNC;    /* reset flag */
+  BurstRuns = 0;                        /* no more runs */
+
+  Display_EEString_Space(Cmd_DONE_str); /* send: DONE & space */
+  Display_Value(BurstCount, 0, 0);      /* send number of records */
+  Serial_NewLine();                     /* send newline */
+
+  BurstCount = 0;                       /* reset counter */
+}
+
+
+
+/*
+ *  wait for part change while burst probing
+ *  - probes have to be open first and then a new part has to be
+ *    connected, each for BURST_STABLE checks in a row
+ *  - CANCEL or any key press ends burst probing
+ *
+ *  returns:
+ *  - KEY_PROBE for new part
+ *  - KEY_NONE if burst probing got canceled
+ */
+
+uint8_t Burst_WaitPart(void)
+{
+  uint8_t           Key = KEY_NONE;     /* return value */
+  uint8_t           Run = 1;            /* loop control */
+  uint8_t           Open = 0;           /* probes were open */
+  uint8_t           Count = 0;          /* checks in a row */
+  uint8_t           Test;               /* user feedback / command ID */
+
+  while (Run)
+  {
+    Test = TestKey(BURST_POLL, CHECK_BAT);
+
+    if (Test == KEY_TIMEOUT)            /* no user feedback */
+    {
+      Test = PartPresent();             /* check probes */
+
+      if (Test == Open)                 /* change we're waiting for */
+      {
+        Count++;                        /* one more in a row */
+
+        if (Count >= BURST_STABLE)      /* stable state */
+        {
+          Count = 0;                    /* reset counter */
+
+          if (Open)                     /* new part */
+          {
+            Key = KEY_PROBE;            /* probe part */
+            Run = 0;                    /* end loop */
+          }
+          else                          /* probes open */
+          {
+            Open = 1;                   /* now wait for new part */
+          }
+        }
+      }
+      else                              /* no or undecided change */
+      {
+        Count = 0;                      /* reset counter */
+      }
+    }
+    #ifdef SERIAL_RW
+    else if (Test == KEY_COMMAND)       /* remote command */
+    {
+      Display_Serial_Only();            /* switch output to serial */
+      Test = GetCommand();              /* get command (sends ERR if unknown) */
+
+      if (Test == CMD_CANCEL)           /* cancel */
+      {
+        Display_EEString_NL(Cmd_OK_str);     /* send: OK & newline */
+        Run = 0;                        /* end loop */
+      }
+      else if (Test != CMD_NONE)        /* other command */
+      {
+        Display_EEString_NL(Cmd_ERR_str);    /* send: ERR & newline */
+      }
+
+      Display_LCD_Only();               /* switch output back to display */
+    }
+    #endif
+    else                                /* key press */
+    {
+      Run = 0;                          /* end loop */
+    }
+  }
+
+  if (Key == KEY_NONE)                  /* canceled */
+  {
+    Display_Serial_Only();              /* switch output to serial */
+    Burst_Done();                       /* send completion message */
+    Display_LCD_Only();                 /* switch output back to display */
+  }
+
+  return Key;
+}
+
+/* clean-up of local constants */
+#undef BURST_POLL
+#undef BURST_STABLE
+
+#endif
+
+
+
+#ifdef SW_REMOTE_TOOLS
+
+/*
+ *  command: TOOL <item ID>
+ *  - runs a tool of the main menu via main()
+ *  - item ID: see MENUITEM_* in user.c (1-255)
+ *  - an invalid or unsupported ID is signaled by MainMenu()
+ *
+ *  returns:
+ *  - SIGNAL_ERR on error
+ *  - SIGNAL_OK on success
+ */
+
+uint8_t Cmd_TOOL(void)
+{
+  uint8_t           Pos;                /* position in RX buffer */
+  uint16_t          ID = 0;             /* item ID */
+  unsigned char     Char;               /* argument char */
+
+  Pos = CmdArgs;
+  if (Pos == 0) return SIGNAL_ERR;      /* no argument */
+
+  Char = RX_Buffer[Pos];
+  if (Char == 0) return SIGNAL_ERR;     /* missing value */
+
+  while (Char != 0)
+  {
+    if ((Char < '0') || (Char > '9')) return SIGNAL_ERR;
+    ID *= 10;
+    ID += Char - '0';
+    if (ID > 255) return SIGNAL_ERR;    /* max. 255 */
+    Pos++;
+    Char = RX_Buffer[Pos];
+  }
+
+  if (ID == 0) return SIGNAL_ERR;       /* "exit" isn't a tool */
+
+  UI.RemoteTool = (uint8_t)ID;          /* tool for MainMenu() */
+  Display_EEString(Cmd_OK_str);         /* send: OK */
+
+  return SIGNAL_OK;
+}
+
+
+
+/*
+ *  process command received while a remote tool is running
+ *  - called by TestKey()
+ *  - KEY <key> simulates user feedback
+ *    s: short key press, l: long key press, t: two short key presses,
+ *    +: right turn/increase, -: left turn/decrease
+ *  - STOP ends the tool (two short key presses)
+ *  - any other command is answered by ERR
+ *
+ *  returns:
+ *  - virtual key
+ */
+
+uint8_t Tool_Command(void)
+{
+  uint8_t           Key = KEY_NONE;     /* virtual key */
+  uint8_t           ID;                 /* command ID */
+
+  Display_Serial_Only();                /* switch output to serial */
+
+  ID = GetCommand();                    /* get command (sends ERR if unknown) */
+
+  if (ID == CMD_STOP)                   /* stop */
+  {
+    Key = KEY_TWICE;                    /* most tools exit on that */
+  }
+  else if ((ID == CMD_KEY) && (CmdArgs > 0))     /* key with argument */
+  {
+    if (RX_Buffer[CmdArgs + 1] == 0)    /* single char */
+    {
+      switch (RX_Buffer[CmdArgs])
+      {
+        case 's':                  /* short key press */
+          Key = KEY_SHORT;
+          break;
+
+        case 'l':                  /* long key press */
+          Key = KEY_LONG;
+          break;
+
+        case 't':                  /* two short key presses */
+          Key = KEY_TWICE;
+          break;
+
+        case '+':                  /* right turn */
+          Key = KEY_RIGHT;
+          break;
+
+        case '-':                  /* left turn */
+          Key = KEY_LEFT;
+          break;
+      }
+    }
+  }
+
+  if (Key != KEY_NONE)                  /* valid key */
+  {
+    Display_EEString_NL(Cmd_OK_str);    /* send: OK & newline */
+  }
+  else if (ID != CMD_NONE)              /* other command or bad key */
+  {
+    Display_EEString_NL(Cmd_ERR_str);   /* send: ERR & newline */
+  }
+
+  Display_LCD_Only();                   /* switch output back to display */
+
+  return Key;
+}
+
+
+
+/*
+ *  end remote tool
+ *  - called by MainMenu()
+ *  - sends completion message DONE, or ERR on error
+ *
+ *  requires:
+ *  - Flag: result of tool (0 on error)
+ */
+
+void Tool_Done(uint8_t Flag)
+{
+  UI.RemoteTool = 0;                    /* no tool anymore */
+
+  Display_Serial_Only();                /* switch output to serial */
+
+  if (Flag == 0)                        /* error */
+  {
+    Display_EEString_NL(Cmd_ERR_str);   /* send: ERR & newline */
+  }
+  else                                  /* success */
+  {
+    Display_EEString_NL(Cmd_DONE_str);  /* send: DONE & newline */
+  }
+
+  Display_LCD_Only();                   /* switch output back to display */
+}
+
+
+
+/*
+ *  start record with readings of a remote tool
+ *  - switches output to serial
+ *  - format: <name>=<value>;<name>=<value>;... (like ALL)
+ *
+ *  returns:
+ *  - 1 if record is started
+ *  - 0 if tool wasn't run by remote command (no record)
+ */
+
+uint8_t Tool_RecordStart(void)
+{
+  if (UI.RemoteTool == 0) return 0;     /* run via menu */
+
+  Display_Serial_Only();                /* switch output to serial */
+  FirstFlag = 1;                        /* first field */
+
+  return 1;
+}
+
+
+
+/*
+ *  add field to record of remote tool
+ *
+ *  requires:
+ *  - Name: field name (command name)
+ *  - Value: signed value
+ *  - Scale: exponent of factor related to base unit (value * 10^x)
+ *  - Unit: unit character (0 = none)
+ */
+
+void Tool_RecordField(const unsigned char *Name, int32_t Value, int8_t Scale, unsigned char Unit)
+{
+  if (FirstFlag)                        /* first field */
+  {
+    FirstFlag = 0;                      /* reset flag */
+  }
+  else                                  /* another field */
+  {
+    Display_Char(';');                  /* send field separator */
+  }
+
+  Display_EEString(Name);               /* send field name */
+  Display_Char('=');
+  Display_SignedValue(Value, Scale, Unit);   /* send value */
+}
+
+
+
+/*
+ *  end record of remote tool
+ *  - sends N/A for an empty record
+ *  - switches output back to display
+ */
+
+void Tool_RecordEnd(void)
+{
+  if (FirstFlag)                        /* no fields */
+  {
+    Display_EEString(Cmd_NA_str);       /* send: N/A */
+  }
+
+  Serial_NewLine();                     /* send newline */
+  Display_LCD_Only();                   /* switch output back to display */
+}
+
+
+
+/*
+ *  send record with C and ESR of a remote tool
+ *
+ *  requires:
+ *  - Cap: pointer to cap (NULL for none)
+ *  - ESR: ESR in 0.01 Ohms (UINT16_MAX for none)
+ */
+
+void Tool_CapRecord(Capacitor_Type *Cap, uint16_t ESR)
+{
+  if (Tool_RecordStart())               /* run by remote command */
+  {
+    if (Cap)                            /* got cap */
+    {
+      Tool_RecordField(Cmd_C_str, Cap->Value, Cap->Scale, 'F');
+    }
+
+    #if defined (SW_ESR) || defined (SW_OLD_ESR)
+    if (ESR < UINT16_MAX)               /* valid ESR */
+    {
+      Tool_RecordField(Cmd_ESR_str, ESR, -2, LCD_CHAR_OMEGA);
+    }
+    #endif
+
+    Tool_RecordEnd();                   /* finish record */
+  }
+}
+
+#endif
+
+
+
+/*
+ *  run command received via serial interface
+ *
+ *  requires:
+ *  - ID: command ID
+ *
+ *  returns:
+ *  - virtual key
+ */
+
+uint8_t RunCommand(uint8_t ID)
+{
+  uint8_t           Key = KEY_NONE;     /* virtual key */
+  uint8_t           Flag = SIGNAL_OK;   /* result of command function */
+
+  /*
+   *  run command
+   */
+
+  switch (ID)
+  {
+    case CMD_VER:             /* return firmware version */
+      Display_EEString(Version_str);         /* send firmware version */
+      break;
+
+    case CMD_OFF:             /* power off */
+      Key = KEY_POWER_OFF;                   /* set virtual key */
+      Display_EEString(Cmd_OK_str);          /* send: OK */
+      break;
+
+    case CMD_PROBE:           /* probe component */
+      Key = KEY_PROBE;                       /* set virtual key */
+      Cfg.OP_Control &= ~OP_PROBE_ASYNC;     /* synchronous probing */
+      /* OK is returned after probing by main() */
+      Flag = SIGNAL_NONE;                    /* no newline */ 
+      break;
+
+    case CMD_APROBE:          /* probe component asynchronously */
+      Key = KEY_PROBE;                       /* set virtual key */
+      Cfg.OP_Control |= OP_PROBE_ASYNC;      /* asynchronous probing */
+      /* DONE is sent after probing by main() */
+      Display_EEString(Cmd_OK_str);          /* send: OK */
+      break;
+
+    #ifdef SW_BURST
+    case CMD_BURST:           /* probe series of parts */
+      Key = KEY_PROBE;                       /* set virtual key */
+      Cfg.OP_Control |= OP_PROBE_ASYNC;      /* asynchronous probing */
+      BurstRuns = BURST_RUNS;                /* number of parts */
+      BurstCount = 0;                        /* no records yet */
+      /* records and DONE are sent after probing by main() */
+      Display_EEString(Cmd_OK_str);          /* send: OK */
+      break;
+    #endif
+
+    case CMD_CANCEL:          /* cancel asynchronous probing */
+      /* only valid while probing asynchronously */
+      Flag = SIGNAL_NA;                      /* signal n/a */
+      break;
+
+    #ifdef SW_POWER_STATS
+    case CMD_PWR:             /* return power-state statistics */
+      Flag = Cmd_PWR();                      /* run command */
+      break;
+    #endif
+
+    #ifdef EVENT_COUNTER_LOG
+    case CMD_EVLOG:           /* return event log */
+      if (EventLog_Send() == 0)              /* log empty */
+      {
+        Flag = SIGNAL_NA;                    /* signal n/a */
+      }
+      break;
+    #endif
+
+    #ifdef SW_HISTORY
+    case CMD_HIST:            /* return measurement history */
+      if (History_Send() == 0)               /* history empty */
+      {
+        Flag = SIGNAL_NA;                    /* signal n/a */
+      }
+      break;
+    #endif
+
+    #ifdef SW_REPEAT_STATS
+    case CMD_REPEAT:          /* return statistics of repeat measurement */
+      if (Repeat_Send() == 0)                /* unsupported component */
+      {
+        Flag = SIGNAL_NA;                    /* signal n/a */
+      }
+      break;
+    #endif
+
+    #ifdef SW_CYCLE_BENCH
+    case CMD_BENCH:           /* return cycles of hot routines */
+      Flag = Cmd_BENCH();                    /* run command */
+      break;
+    #endif
+
+    #ifdef SW_STACK_CHECK
+    case CMD_MEM:             /* return SRAM usage */
+      Memory_Show(0);                        /* send values */
+      break;
+    #endif
+
+    #ifdef SW_PERF_COUNTERS
+    case CMD_PERF:            /* return performance counters */
+      Perf_Show(0);                          /* send and reset values */
+      break;
+    #endif
+
+    #ifdef SW_SELFTEST_REPORT
+    case CMD_SELFTEST:        /* run selftest and return report */
+      SelfTest(SELFTEST_REPORT);             /* run selftest */
+      break;
+    #endif
+
+    case CMD_NEXT:            /* select next component */
+      /* allow only 2nd component */
+      if ((Info.Selected == 1) && (Info.Quantity == 2))
+      {
+        Info.Selected = 2;                   /* 2nd one */
+        Display_EEString(Cmd_OK_str);        /* send: OK */
+      }
+      else
+      {
+        Flag = SIGNAL_NA;                    /* signal n/a */
+      }
+      break;
+
+    case CMD_ALL:             /* return all values */
+      Flag = Cmd_ALL();                      /* run command */
+      break;
+
+    #ifdef SW_STREAM
+    case CMD_MON_R:           /* stream R */
+    case CMD_MON_C:           /* stream C */
+    #ifdef SW_INDUCTOR
+    case CMD_MON_L:           /* stream L */
+    #endif
+      Flag = Cmd_MON(ID);                    /* run command */
+      break;
+    #endif
+
+    #ifdef SW_RAW_STREAM
+    case CMD_RAW:             /* stream raw ADC readings */
+      Flag = Cmd_RAW();                      /* run command */
+      break;
+    #endif
+
+    #ifdef SW_BIN_FRAMES
+    case CMD_BIN:             /* switch to binary frames */
+      Frame.Mode = FRAME_ON;                 /* enable frames */
+      Display_EEString(Cmd_OK_str);          /* send: OK */
+      break;
+
+    case CMD_TXT:             /* switch back to text */
+      Frame.Mode = 0;                        /* disable frames */
+      Display_EEString(Cmd_OK_str);          /* send: OK */
+      break;
+    #endif
+
+    #ifdef SERIAL_MULTIDROP
+    case CMD_ADDR:            /* return/set address for multi-drop */
+      Flag = Cmd_ADDR();                     /* run command */
+      break;
+    #endif
+
+    #ifdef SW_REMOTE_TOOLS
+    case CMD_TOOL:            /* run tool of main menu */
+      Flag = Cmd_TOOL();                     /* run command */
+      if (Flag == SIGNAL_OK)                 /* valid tool ID */
+      {
+        Key = KEY_MAINMENU;                  /* set virtual key */
+      }
+      break;
+
+    case CMD_KEY:             /* simulate user feedback */
+      /* only valid while a remote tool is running */
+      Flag = SIGNAL_NA;                      /* signal n/a */
+      break;
+    #endif
+
+    #if defined (SW_STREAM) || defined (SW_RAW_STREAM) || defined (SW_REMOTE_TOOLS)
+    case CMD_STOP:            /* stop streaming or remote tool */
+      /* only valid while streaming or running a remote tool */
+      Flag = SIGNAL_NA;                      /* signal n/a */
+      break;
+    #endif
+
+    default:                  /* component value */
+      Flag = Cmd_Value(ID);                  /* run command */
+      break;
+  }
+
 
   /*
    *  error handling
@@ -48,6 +48,8 @@
 #define CHECK_KEY_TWICE       0b00001000     /* check for two short presses of the test key */
 #define CHECK_BAT             0b00010000     /* check battery */
 #define CURSOR_TEXT           0b00100000     /* show hint instead of cursor */
+#define CHECK_PART            0b01000000     /* check for a newly connected part */
+#define CHECK_REFCAP          0b10000000     /* drift check of fixed cap */
 
 
 /* keys (test push button etc.) */
@@ -74,6 +76,7 @@
 /* operation mode/state flags (bitfield) */
 #define OP_NONE               0b00000000     /* no flags */
 #define OP_AUTOHOLD           0b00000001     /* auto-hold mode (instead of continuous) */
+#define OP_TWEEZERS           0b00000010     /* two-terminal mode (probes #1 and #2) */
 #define OP_EXT_REF            0b00000100     /* external voltage reference used */
 #define OP_SPI                0b00001000     /* SPI is set up */
 #define OP_I2C                0b00010000     /* I2C is set up */
@@ -86,6 +89,8 @@
 #define OP_RX_LOCKED          0b00001000     /* RX buffer locked */
 #define OP_RX_OVERFLOW        0b00010000     /* RX buffer overflow */
 #define OP_PWR_TIMEOUT        0b00100000     /* auto-power-off for auto-hold mode */
+#define OP_DISCHARGE_INFO     0b01000000     /* display remaining discharge time */
+#define OP_PROBE_ASYNC        0b10000000     /* asynchronous probing by command */
 
 
 /* UI line modes (bitfield) */
@@ -100,6 +105,94 @@
 #define STORAGE_SHORT         0b00000100     /* short menu (flag) */ 
 
 
+/* measurement presets (ID) */
+#define PRESET_FULL           0              /* full characterization */
+#define PRESET_FAST           1              /* fast sorting */
+
+
+/* languages (ID) */
+#define LANGUAGE_1ST          0              /* language selected by UI_* */
+#define LANGUAGE_2ND          1              /* second language: English */
+
+
+/* selftest modes */
+#define SELFTEST_DISPLAY      0              /* display results */
+#define SELFTEST_REPORT       1              /* send report via serial */
+
+
+/* ADC */
+/* channel selection for ReadU_Multi() (bitfield) */
+#define READ_CH_1             0b00000001     /* Probes.Ch_1 */
+#define READ_CH_2             0b00000010     /* Probes.Ch_2 */
+#define READ_CH_3             0b00000100     /* Probes.Ch_3 */
+
+/* sampling descriptor for ReadU_Desc() (bitfield) */
+/* number of samples (0: Cfg.Samples) */
+#define SAMPLE_COUNT_MASK     0x00FF    /* bits for number of samples */
+/* reference policy */
+#define SAMPLE_REF_AUTO       0x0000    /* auto-scaling (if enabled by Cfg.AutoScale) */
+#define SAMPLE_REF_VCC        0x0100    /* Vcc reference only */
+/* settle mode */
+#define SAMPLE_SETTLE_5MS     0x0200    /* settle 5ms before sampling */
+#define SAMPLE_SETTLE_20MS    0x0400    /* settle 20ms before sampling */
+/* precision class */
+#define SAMPLE_FULL           0x0800    /* take all samples (no ADC_ADAPTIVE) */
+
+/* sampling descriptor presets */
+#define SAMPLE_STD            0         /* default: Cfg.Samples */
+#define SAMPLE_QUICK          4         /* quick reading (about 0.5ms) */
+#define SAMPLE_FAST           5         /* fast reading (e.g. low loss of charge) */
+#define SAMPLE_SHORT          10        /* short reading (about 1ms) */
+#define SAMPLE_PRECISE        100       /* low spread (e.g. monitors) */
+#define SAMPLE_REF            (200 | SAMPLE_FULL)     /* voltage references */
+
+/* ADC clock profiles */
+#define ADC_PRECISE           0         /* standard ADC clock */
+#define ADC_FAST              1         /* high ADC clock */
+
+/* ADC backends */
+#define ADC_INT               0         /* internal ADC */
+#define ADC_EXT               1         /* external ADC (ADS1115) */
+#define ADC_EXT_ERROR         UINT32_MAX     /* no reading of external ADC */
+
+/* ADC prescaler bits */
+#define ADC_CLOCK_MASK        ((1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0))
+
+/* interrupt driven ADC sampling */
+/* sampling states */
+#define SAMPLING_IDLE         0         /* no sampling */
+#define SAMPLING_DUMMY        1         /* dummy conversion */
+#define SAMPLING_RUN          2         /* taking samples */
+#define SAMPLING_SWITCH       3         /* change of voltage reference requested */
+#define SAMPLING_DONE         4         /* all samples taken */
+
+/* control flags (bitfield) */
+#define SAMPLING_INT          0b00000001     /* interrupts were enabled */
+#define SAMPLING_SLEEP        0b00000010     /* conversions started by sleep mode */
+#define SAMPLING_VCC          0b00000100     /* Vcc reference only */
+#define SAMPLING_FULL         0b00001000     /* take all samples */
+
+
+/* scope trigger modes */
+#define SCOPE_RISING          1         /* rising edge */
+#define SCOPE_FALLING         2         /* falling edge */
+#define SCOPE_STEP_RL         3         /* step response via Rl */
+#define SCOPE_STEP_RH         4         /* step response via Rh */
+
+
+/* curve tracer: probe setup for IV_Measure() (bitfield) */
+#define IV_HIGH_DIRECT        0b00000000     /* high side: Vcc directly */
+#define IV_HIGH_RL            0b00000001     /* high side: Vcc via Rl */
+#define IV_HIGH_RH            0b00000010     /* high side: Vcc via Rh */
+#define IV_LOW_DIRECT         0b00000000     /* low side: Gnd directly */
+#define IV_LOW_RL             0b00000100     /* low side: Gnd via Rl */
+#define IV_LOW_RH             0b00001000     /* low side: Gnd via Rh */
+#define IV_BASE_RL            0b00010000     /* base: drive via Rl */
+#define IV_BASE_RH            0b00100000     /* base: drive via Rh */
+#define IV_BASE_DOWN          0b01000000     /* base: pull down (PNP) */
+#define IV_I_LOW              0b10000000     /* get current at low side */
+
+
 /* SPI */
 /* clock rate flags (bitfield) */
 #define SPI_CLOCK_R0          0b00000001     /* divider bit 0 (SPR0) */
@@ -116,6 +209,9 @@
 #define I2C_ADDRESS           2         /* address byte */
 #define I2C_ACK               1         /* acknowledge */
 #define I2C_NACK              2         /* not-acknowledge */
+#define I2C_JOB_WRITE         0b00000000     /* write job */
+#define I2C_JOB_READ          0b00000001     /* read job */
+#define I2C_JOB_NOSTOP        0b00000010     /* repeated start for next job */
 
 
 /* TTL serial */
@@ -123,6 +219,15 @@
 #define SER_RX_PAUSE          1         /* pause RX */
 #define SER_RX_RESUME         2         /* resume RX */
 
+
+/* OneWire bit engine: transfer mode */
+#define ONEWIRE_WRITE         1         /* send bits */
+#define ONEWIRE_READ          2         /* read bits */
+
+/* OneWire bit engine: bus speed */
+#define ONEWIRE_SPEED_STD     0         /* standard speed */
+#define ONEWIRE_SPEED_OD      1         /* overdrive speed */
+
 /* special characters */
 #define CHAR_XON              17        /* software flow control: XON */
 #define CHAR_XOFF             19        /* software flow control: XOFF */
@@ -158,20 +263,44 @@
 
 /* string buffer sizes */
 #define OUT_BUFFER_SIZE       12        /* 11 chars + terminating 0 */
-#define RX_BUFFER_SIZE        11        /* 10 chars + terminating 0 */
+#ifdef SERIAL_MULTIDROP
+  /* address prefix, e.g. "254:" */
+  #define RX_PREFIX_SIZE      4         /* 4 chars */
+#else
+  #define RX_PREFIX_SIZE      0         /* no prefix */
+#endif
+#ifdef SW_RAW_STREAM
+  /* command with arguments, e.g. "RAW uzD 1 1000" */
+  #define RX_BUFFER_SIZE      (17 + RX_PREFIX_SIZE)  /* 16 chars + terminating 0 */
+#else
+  #define RX_BUFFER_SIZE      (11 + RX_PREFIX_SIZE)  /* 10 chars + terminating 0 */
+#endif
+#define TX_BUFFER_SIZE        32        /* serial TX ring buffer (2^n) */
 
 /* number of entries in data tables */
 #define NUM_PREFIXES          8         /* unit prefixes */
+#define NUM_POWER10           9         /* powers of ten (10^9 - 10^1) */
 #define NUM_LARGE_CAP         46        /* large cap factors */
 #define NUM_SMALL_CAP         9         /* small cap factors */
 #define NUM_PWM_FREQ          8         /* PWM frequencies */
+#define NUM_SORT_TOL          5         /* sorting tolerances */
+#define NUM_LED_STEPS         4         /* LED binning: bin widths */
+#define NUM_LOG_INTERVALS     9         /* logger intervals */
+#define NUM_LOG_COUNTS        9         /* logger sample counts */
 #define NUM_INDUCTOR          32        /* inductance factors */
+#ifdef SW_INDUCTOR
+  #define NUM_FACTOR_TABLES   3         /* tables for GetFactor() */
+#else
+  #define NUM_FACTOR_TABLES   2         /* tables for GetFactor() */
+#endif
 #define NUM_TIMER1            5         /* Timer1 prescalers and bits */
+#define NUM_CRC8_NIBBLE       16        /* OneWire: CRC-8 per nibble */
 #define NUM_PROBE_COLORS      3         /* probe colors */
 #define NUM_E6                6         /* E6 norm values */
 #define NUM_E12              12         /* E12 norm values */
 #define NUM_E24              24         /* E24 norm values */
-#define NUM_E96              96         /* E24 norm values */
+#define NUM_E96              96         /* E96 norm values */
+#define NUM_E192            192         /* E192 norm values */
 #define NUM_COLOR_CODES      10         /* color codes */
 #define NUM_EIA96_MULT        9         /* EIA-96 multiplier codes */
 #define NUM_LOGIC_TYPES       6         /* logic families and voltages */
@@ -179,6 +308,174 @@
 /* IR code buffer size */
 #define IR_CODE_BYTES         6         /* 6 bytes = 48 bit */
 
+/* IR learn: raw pulse train */
+#define IR_LEARN_PULSES     100         /* max. number of pulses/pauses */
+#define IR_LEARN_UNIT        50         /* time unit of durations (in s) */
+
+/* IR decoder: timing control flags (bitfield) */
+#define IR_STD_TOLER          0b00000000     /* use default tolerance */
+#define IR_RELAX_SHORT        0b00000001     /* relax short pulses */
+#define IR_RELAX_LONG         0b00000010     /* relax long pulses */
+
+/* IR decoder: start pulse classes (bit numbers) */
+#define IR_START_NEC          0         /* NEC, Sanyo */
+#define IR_START_PROTON       1         /* Proton */
+#define IR_START_JVC          2         /* JVC */
+#define IR_START_MATSUSHITA   3         /* Matsushita, Kaseikyo */
+#define IR_START_RCA          4         /* RCA */
+#define IR_START_MOTOROLA     5         /* Motorola, IR60 */
+#define IR_START_THOMSON      6         /* Thomson */
+#define IR_START_SAMSUNG      7         /* Samsung */
+#define IR_START_SIRC         8         /* Sony SIRC */
+#define IR_START_RECS80       9         /* RECS80 */
+#define IR_START_SHARP        10        /* Sharp */
+#define IR_START_RC5          11        /* RC-5 */
+#define IR_START_UPD1986C     12        /* NEC PD1986C */
+#define IR_START_RC6          13        /* RC-6 */
+
+/* scope sample buffer */
+#define SCOPE_SAMPLES         128       /* samples (power of 2) */
+#define SCOPE_PRE             32        /* pre-trigger samples */
+
+/* curve tracer buffer */
+#define IV_POINTS             12        /* max. number of I-V points */
+
+/* DDS signal generator */
+#define DDS_TABLE_SIZE        64        /* quarter sine wave */
+#define DDS_SINE              1         /* waveform: sine */
+#define DDS_TRIANGLE          2         /* waveform: triangle */
+
+/* IR detector: max. number of pauses/pulses (2 start + 2 * 48 data + 1 stop) */
+#define IR_MAX_PULSES         100
+
+/* IR sender: max. number of entries of burst schedule */
+#define IR_SCHED_MAX          100
+
+/* DHTxx: max. number of edges (3 response + 80 data + 1 end) */
+#define DHT_MAX_EDGES         84
+
+/* rotary encoder: max. number of edges for timing statistics */
+#define ENC_MAX_EDGES         100
+
+/* stack high-water mark */
+#define STACK_CANARY          0xC5      /* pattern for unused SRAM */
+
+/* scratch arena: users (tools never running at the same time) */
+#define SCRATCH_FREE          0         /* not in use */
+#define SCRATCH_IR_RX         1         /* IR detector: pulse durations */
+#define SCRATCH_IR_TX         2         /* IR sender: burst schedule */
+#define SCRATCH_DHTXX         3         /* DHTxx: edge time stamps */
+#define SCRATCH_DDS           4         /* DDS: sine table */
+#define SCRATCH_ENCODER       5         /* encoder: edge intervals & states */
+
+/* scratch arena: size is largest buffer of all enabled users (bytes) */
+#define SCRATCH_SIZE          1
+#if defined (SW_IR_RX_PCINT) && ((IR_MAX_PULSES * 2) > SCRATCH_SIZE)
+  #undef SCRATCH_SIZE
+  #define SCRATCH_SIZE        (IR_MAX_PULSES * 2)
+#endif
+#if defined (SW_IR_TX_TIMER) && ((IR_SCHED_MAX * 2) > SCRATCH_SIZE)
+  #undef SCRATCH_SIZE
+  #define SCRATCH_SIZE        (IR_SCHED_MAX * 2)
+#endif
+#if defined (SW_DHTXX_PCINT) && ((DHT_MAX_EDGES * 2) > SCRATCH_SIZE)
+  #undef SCRATCH_SIZE
+  #define SCRATCH_SIZE        (DHT_MAX_EDGES * 2)
+#endif
+#if defined (SW_DDS) && (DDS_TABLE_SIZE > SCRATCH_SIZE)
+  #undef SCRATCH_SIZE
+  #define SCRATCH_SIZE        DDS_TABLE_SIZE
+#endif
+#if defined (ENCODER_STATS) && ((ENC_MAX_EDGES * 3) > SCRATCH_SIZE)
+  #undef SCRATCH_SIZE
+  #define SCRATCH_SIZE        (ENC_MAX_EDGES * 3)
+#endif
+
+/* leakage current */
+#define LEAK_NO_HINT          0xFFFF    /* no range hint */
+
+/* hFE sweep */
+#define HFE_SWEEP_POINTS      4         /* number of drive configurations */
+
+/* sorting bins */
+#define BIN_NONE              0         /* no bin */
+#define BIN_LOW               1         /* below tolerance */
+#define BIN_PASS              2         /* within tolerance */
+#define BIN_HIGH              3         /* above tolerance */
+
+/* profiler stages */
+#define PROF_DISCHARGE        0         /* DischargeProbes() */
+#define PROF_CHECKPROBES      1         /* CheckProbes() */
+#define PROF_MEASURECAP       2         /* MeasureCap() */
+#define PROF_SHOW             3         /* Show_*() */
+#define PROF_ESR              4         /* MeasureESR() */
+#define PROF_LARGECAP         5         /* LargeCap() */
+#define PROF_SMALLCAP         6         /* SmallCap() */
+#define PROF_INDUCTOR         7         /* MeasureInductor() */
+#define PROF_CYCLE            8         /* complete probing cycle */
+#define NUM_PROF_STAGES       9         /* number of stages */
+
+/* performance counters */
+#define PERF_ADC              0         /* ADC conversions */
+#define PERF_BUS              1         /* bytes sent via SPI/I2C */
+#define PERF_EEPROM           2         /* EEPROM writes */
+#define PERF_RX               3         /* ISR: serial RX */
+#define PERF_TIMER0           4         /* ISRs: Timer0 */
+#define PERF_TIMER1           5         /* ISRs: Timer1 */
+#define PERF_TIMER2           6         /* ISRs: Timer2 */
+#define PERF_PCINT            7         /* ISRs: pin change */
+#define NUM_PERF_COUNTERS     8         /* number of counters */
+
+/* software timers of system tick */
+#define SYS_TIMER_KEY         0         /* TestKey(): feedback timeout */
+#define SYS_TIMER_BAT         1         /* TestKey(): battery monitoring */
+#if defined (ADJUST_CAP_DRIFT)
+  #define SYS_TIMER_CURSOR    2         /* RunTasks(): blinking cursor */
+  #define SYS_TIMER_PWR       3         /* RunTasks(): auto-power-off */
+  #define SYS_TIMER_REFCAP    4         /* RunTasks(): drift check of fixed cap */
+  #define NUM_SYS_TIMERS      5         /* number of timers */
+#elif defined (SYSTEM_TASKS)
+  #define SYS_TIMER_CURSOR    2         /* RunTasks(): blinking cursor */
+  #define SYS_TIMER_PWR       3         /* RunTasks(): auto-power-off */
+  #define NUM_SYS_TIMERS      4         /* number of timers */
+#else
+  #define NUM_SYS_TIMERS      2         /* number of timers */
+#endif
+
+/* software timer states */
+#define TIMER_STOPPED         0         /* not running */
+#define TIMER_RUNNING         1         /* running */
+
+/* s time stamp (Timer1): prescaler for resolution of 1s or better */
+#if CPU_FREQ <= 4000000
+  #define TIMESTAMP_PRESCALER 1         /* prescaler 1:1 */
+  #define TIMESTAMP_CLOCK     (1 << CS10)
+#else
+  #define TIMESTAMP_PRESCALER 8         /* prescaler 1:8 */
+  #define TIMESTAMP_CLOCK     (1 << CS11)
+#endif
+
+/* hardware timers (timer manager) */
+#define TIMER_0               0         /* Timer0 */
+#define TIMER_1               1         /* Timer1 */
+#define TIMER_2               2         /* Timer2 */
+#define NUM_TIMERS            3         /* number of timers */
+
+/* owners of hardware timers (timer manager) */
+#define TIMER_FREE            0         /* not used */
+#define TIMER_SERIAL          1         /* bit-bang serial RX */
+#define TIMER_IR_TX           2         /* timer driven IR sender */
+
+/* convert time (in s) into time stamp ticks (constant time only) */
+#define TIMESTAMP_TICKS(t)    ((uint16_t)(((uint32_t)(t) * (CPU_FREQ / 1000)) / (TIMESTAMP_PRESCALER * 1000UL)))
+
+/* delay for any MCU clock (in s, constant time only) */
+#define DELAY_US(t)           __builtin_avr_delay_cycles(((uint32_t)(t) * (CPU_FREQ / 1000)) / 1000)
+
+/* events of background tasks (bitfield) */
+#define TASK_NONE             0b00000000     /* no event */
+#define TASK_POWER_OFF        0b00000001     /* auto-power-off timeout */
+
 
 
 /* ************************************************************************
@@ -205,6 +502,7 @@
 #define CMD_HINT              16   /* return hints on special features */
 #define CMD_MHINT             17   /* return hints on measurements */
 #define CMD_PIN               18   /* return pinout */
+#define CMD_PROF              19   /* return profiler data */
 #define CMD_R                 20   /* return resistance */
 #define CMD_C                 21   /* return capacitance */
 #define CMD_L                 22   /* return inductance */
@@ -233,6 +531,54 @@
 #define CMD_V_Z               45   /* return V_Z */
 #define CMD_V_L               46   /* return V_loss */
 #define CMD_V_F_CLAMP         47   /* return V_f of clamping diode */
+#define CMD_H_FE_SWEEP        48   /* return hFE sweep */
+#define CMD_ALL               49   /* return all values */
+#define CMD_MON_R             50   /* stream R */
+#define CMD_MON_C             51   /* stream C (and ESR) */
+#define CMD_MON_L             52   /* stream L */
+#define CMD_STOP              53   /* stop streaming */
+#define CMD_APROBE            54   /* probe component asynchronously */
+#define CMD_CANCEL            55   /* cancel asynchronous probing */
+#define CMD_PWR               56   /* return power-state statistics */
+#define CMD_EVLOG             57   /* return event log */
+#define CMD_HIST              58   /* return measurement history */
+#define CMD_SELFTEST          59   /* run selftest and return report */
+#define CMD_MEM               60   /* return SRAM usage */
+#define CMD_BENCH             61   /* return cycles of hot routines */
+#define CMD_REPEAT            62   /* return statistics of repeat measurement */
+#define CMD_BURST             63   /* probe series of parts */
+#define CMD_RAW               64   /* stream raw ADC readings */
+#define CMD_BIN               65   /* switch to binary frames */
+#define CMD_TXT               66   /* switch back to text */
+#define CMD_ADDR              67   /* return/set address for multi-drop */
+#define CMD_TOOL              68   /* run tool of main menu */
+#define CMD_KEY               69   /* simulate user feedback for tool */
+#define CMD_PERF              70   /* return performance counters */
+
+
+
+/*
+ *  binary frames
+ *  - frame: <sync> <length> <type> <payload> <CRC>
+ *  - length: number of bytes of type and payload
+ *  - CRC: CRC-8 (X^8 + X^5 + X^4 + 1) of length, type and payload
+ *  - value record: <command ID> <scale> <value (4 bytes, little endian)>
+ */
+
+/* framing */
+#define FRAME_SYNC            0xA5 /* start of frame */
+#define FRAME_RECORD          6    /* bytes per value record */
+#define FRAME_MAX_RECORDS     40   /* max. value records per frame */
+#define FRAME_NEG             0x80 /* command ID flag: negative value */
+
+/* frame types */
+#define FRAME_ALL             1    /* all values of component */
+#define FRAME_MON             2    /* streamed value (time stamp & records) */
+#define FRAME_BURST           3    /* burst record (number & records) */
+
+/* mode flags */
+#define FRAME_ON              0b00000001     /* binary frames enabled */
+#define FRAME_CAPTURE         0b00000010     /* capture value output */
 
 
 
@@ -277,6 +623,10 @@
 #define PROBE_2               1    /* probe #2 */
 #define PROBE_3               2    /* probe #3 */
 
+/* probe permutation table */
+#define NUM_PROBE_PERMS       6    /* number of permutations */
+#define PROBE_PERM_SIZE       15   /* bytes per entry (IDs and masks) */
+
 
 /* component IDs */
 /* non-components */
@@ -349,6 +699,15 @@
 #define PULL_10MS             0b00010000     /* pull for 10ms */
 
 
+/* range memory for MeasureCap() (Check.CapRange) */
+#define CAP_RANGE_NONE        0b00000000     /* no range, full search */
+#define CAP_RANGE_SMALL       0b00000001     /* SmallCap(): < 4.7F */
+#define CAP_RANGE_MID         0b00000010     /* LargeCap(), 1ms pulses: 4.7-47F */
+#define CAP_RANGE_LARGE       0b00000011     /* LargeCap(), 10ms pulses: > 47F */
+#define CAP_RANGE_MASK        0b00000011     /* mask for range */
+#define CAP_RANGE_MEMORY      0b10000000     /* range memory enabled */
+
+
 
 /* ************************************************************************
  *   constants for display output
@@ -375,6 +734,9 @@
 #define LCD_CHAR_BAT_RL      14    /* battery icon right part: low */
 #define LCD_CHAR_BAT_RH      15    /* battery icon right part: high */
 
+/* font cache: digits, dot, minus, prefixes and units */
+#define FONT_CACHE_CHARS     24    /* number of cached glyphs */
+
 
 /* basic component symbols */
 #define SYMBOL_BJT_NPN        0    /* BJT npn */
@@ -406,6 +768,12 @@
 #endif
 
 
+/* flags for comparator edge detection (bitfield) */
+#define COMP_EDGE_BUZZER      0b00000001     /* switch active buzzer */
+#define COMP_EDGE_LOW         0b00000010     /* input dropped below bandgap */
+#define COMP_EDGE_HIGH        0b00000100     /* input rose above bandgap */
+
+
 /* pinout positions (bitfield) */
 #define PIN_NONE              0b00000000     /* no output */
 #define PIN_LEFT              0b00000001     /* left */
@@ -477,6 +845,12 @@ typedef struct
   uint8_t           Samples;       /* number of ADC samples */
   uint8_t           AutoScale;     /* flag to disable/enable ADC auto scaling */
   uint8_t           Ref;           /* track reference source used lastly */
+  #ifdef ADC_CLOCK_PROFILES
+  uint8_t           ADC_Clock;     /* ADC prescaler bits of clock profile */
+  #endif
+  #ifdef HW_ADS1115
+  uint8_t           ADC_Backend;   /* ADC backend used by ReadU() */
+  #endif
   uint16_t          Bandgap;       /* voltage of internal bandgap reference (mV) */
   uint16_t          Vcc;           /* voltage of Vcc (mV) */
   #ifndef BAT_NONE
@@ -489,6 +863,23 @@ typedef struct
 } Config_Type;
 
 
+/* interrupt driven ADC sampling */
+typedef struct
+{
+  volatile uint8_t  State;         /* sampling state */
+  volatile uint8_t  Counter;       /* number of samples taken */
+  volatile uint32_t Sum;           /* sum of ADC readings */
+  uint8_t           Samples;       /* number of samples to take */
+  uint8_t           Channel;       /* ADMUX bits (channel and reference) */
+  uint8_t           Flags;         /* control flags */
+  #ifdef ADC_ADAPTIVE
+  uint16_t          First;         /* first ADC reading */
+  int32_t           DiffSum;       /* sum of deviations from first reading */
+  uint32_t          DiffSum2;      /* sum of squared deviations */
+  #endif
+} Sampling_Type;
+
+
 /* basic adjustment offsets and values (stored in EEPROM) */
 typedef struct
 {
@@ -510,6 +901,18 @@ typedef struct
   int8_t            RefOffset;     /* voltage offset of bandgap reference (mV) */
   int8_t            CompOffset;    /* voltage offset of analog comparator (mV) */
   uint8_t           Contrast;      /* contrast value of display */
+  #ifdef RING_TESTER_AUTO
+  uint8_t           RingMin;       /* ring tester: min. number of rings for pass */
+  #endif
+  #ifdef UI_PRESETS
+  uint8_t           Preset;        /* measurement preset */
+  #endif
+  #ifdef UI_ENGLISH_2ND
+  uint8_t           Language;      /* UI language */
+  #endif
+  #ifdef ADJUST_WEAR_LEVEL
+  uint8_t           Sequence;      /* sequence number of slot */
+  #endif
   uint8_t           CheckSum;      /* checksum for stored values */
 } Adjust_Type;
 
@@ -525,6 +928,32 @@ typedef struct
 } Touch_Type;
 
 
+/* IR learn: raw pulse train (stored in EEPROM) */
+typedef struct
+{
+  uint8_t           Pulses;                   /* number of pulses/pauses */
+  uint8_t           Data[IR_LEARN_PULSES];    /* durations (in time units - 1) */
+} IR_Learn_Type;
+
+
+/* LED binning: bins (stored in EEPROM) */
+typedef struct
+{
+  uint16_t          Center;        /* V_f of reference LED (mV) */
+  uint8_t           Step;          /* bin width (mV) */
+} LED_Bins_Type;
+
+
+#ifdef DS18B20_ROM_CACHE
+/* DS18B20: ROM codes of last bus search (stored in EEPROM) */
+typedef struct
+{
+  uint8_t           Sensors;                 /* number of sensors */
+  uint8_t           ROM[DS18B20_MULTI][8];   /* ROM codes */
+} DS18B20_Cache_Type;
+#endif
+
+
 /* user interface */
 typedef struct
 {
@@ -587,6 +1016,11 @@ typedef struct
   unsigned char     *KeyHint;      /* string pointer (EEPROM) */
   #endif
 
+  /* remote tools */
+  #ifdef SW_REMOTE_TOOLS
+  uint8_t           RemoteTool;    /* item ID of tool run by remote command */
+  #endif
+
 } UI_Type;
 
 
@@ -598,12 +1032,8 @@ typedef struct
   uint8_t           ID_2;          /* probe-2 */
   uint8_t           ID_3;          /* probe-3 */
 
-  /* backup probe IDs */
-  uint8_t           ID2_1;         /* probe-1 */
-  uint8_t           ID2_2;         /* probe-2 */
-  uint8_t           ID2_3;         /* probe-3 */
-
   /* register bits for switching probes and test resistors */
+  /* keep order of IDs and masks in sync with Probe_table[] */
   uint8_t           Rl_1;          /* Rl mask for probe-1 */
   uint8_t           Rl_2;          /* Rl mask for probe-2 */
   uint8_t           Rl_3;          /* Rl mask for probe-3 */
@@ -616,6 +1046,11 @@ typedef struct
   uint8_t           Ch_1;          /* ADC MUX input channel for probe-1 */
   uint8_t           Ch_2;          /* ADC MUX input channel for probe-2 */
   uint8_t           Ch_3;          /* ADC MUX input channel for probe-3 */
+
+  /* backup probe IDs */
+  uint8_t           ID2_1;         /* probe-1 */
+  uint8_t           ID2_2;         /* probe-2 */
+  uint8_t           ID2_3;         /* probe-3 */
 } Probe_Type;
 
 
@@ -630,6 +1065,9 @@ typedef struct
   uint8_t           Diodes;        /* number of diodes found */
   uint8_t           Probe;         /* error: probe pin */ 
   uint16_t          U;             /* error: voltage in mV */
+  #ifdef FUNC_CAP_RANGE
+  uint8_t           CapRange;      /* range memory for MeasureCap() */
+  #endif
   #ifdef SW_SYMBOLS
   uint8_t           Symbol;        /* symbol ID */
   uint8_t           AltSymbol;     /* symbol ID for alternative component */
@@ -637,6 +1075,21 @@ typedef struct
 } Check_Type;
 
 
+/* measurements of current probe combination (CheckProbes) */
+typedef struct
+{
+  uint16_t          U_Rl;          /* voltage across Rl (load) */
+  uint16_t          U_G_Low;       /* U_Rl with probe-3 pulled down */
+  uint16_t          U_G_High;      /* U_Rl with probe-3 pulled up (0 = n/a) */
+} Perm_Type;
+
+/*
+  Probe setup for U_G_Low and U_G_High:
+  Gnd -- Rl -- probe-2 / probe-1 -- Vcc / probe-3 pulled via Rl for 10ms
+  and HiZ while reading
+*/
+
+
 /* resistor */
 typedef struct
 {
@@ -663,6 +1116,132 @@ typedef struct
 } Capacitor_Type;
 
 
+/* fingerprint of last component (quick re-probing) */
+typedef struct
+{
+  uint8_t           Found;         /* component type */
+  uint8_t           A;             /* probe pin #1 */
+  uint8_t           B;             /* probe pin #2 */
+  int8_t            Scale;         /* exponent of factor (value * 10^x) */
+  uint32_t          Value;         /* resistance/capacitance */
+} Fingerprint_Type;
+
+
+/* reference snapshot of golden part (compare tool) */
+typedef struct
+{
+  uint8_t           Found;         /* component type */
+  uint8_t           Type;          /* NPN/PNP or n/p-channel */
+  uint8_t           A;             /* probe pin #1 */
+  uint8_t           B;             /* probe pin #2 */
+  uint8_t           C;             /* probe pin #3 */
+  int8_t            Scale;         /* exponent of factor (value * 10^x) */
+  uint32_t          Value;         /* R, C, hFE or R_DS_on */
+  int16_t           U;             /* V_f, V_BE or V_th (in mV) */
+} Golden_Type;
+
+
+/* record of measurement history */
+typedef struct
+{
+  uint8_t           Found;         /* component type */
+  uint8_t           Type;          /* component specific type/quantity */
+  uint8_t           A;             /* probe pin #1 (2-pin component) */
+  uint8_t           B;             /* probe pin #2 (2-pin component) */
+  unsigned char     Des[3];        /* pin designators of probes #1-#3 */
+  int8_t            Scale;         /* exponent of factor (value * 10^x) */
+  uint32_t          Value;         /* R, C or hFE */
+  int16_t           U;             /* V_f, V_Z, V_th, V_GT or V_T (in mV) */
+} History_Type;
+
+
+/* running statistics of repeat measurement */
+typedef struct
+{
+  uint8_t           Quantity;      /* quantity ID */
+  uint8_t           N;             /* number of samples */
+  int8_t            Scale;         /* exponent of factor (value * 10^x) */
+  uint32_t          First;         /* first sample (reference) */
+  uint32_t          Min;           /* minimum */
+  uint32_t          Max;           /* maximum */
+  int32_t           Mean;          /* mean deviation (in 1/4 units) */
+  uint32_t          M2;            /* sum of squared deviations from mean */
+} Repeat_Type;
+
+
+/* graph of monitors */
+#ifdef UI_MONITOR_GRAPH
+typedef struct
+{
+  uint8_t           Buffer[GRAPH_SAMPLES];   /* ring buffer of levels (0-255) */
+  uint8_t           Pos;           /* index of newest sample */
+  uint8_t           Count;         /* 0 for no samples yet */
+  int8_t            Scale;         /* exponent of reference (value * 10^x) */
+  uint32_t          Ref;           /* reference value (half scale) */
+} Graph_Type;
+#endif
+
+
+/* I-V point (curve tracer) */
+typedef struct
+{
+  uint8_t           Curve;         /* curve ID (base drive level) */
+  uint16_t          U;             /* voltage across DUT (in mV) */
+  uint32_t          I;             /* current (in nA) */
+} IV_Type;
+
+
+/* hFE sweep */
+typedef struct
+{
+  uint8_t           Flags;         /* test circuit (0 = invalid) */
+  uint32_t          hFE;           /* hFE */
+  uint32_t          I;             /* I_C/I_E (in nA) */
+} hFE_Type;
+
+
+/* matching tool: part data */
+typedef struct
+{
+  uint32_t          Value;         /* hFE or I_DSS (in A) */
+  uint32_t          I;             /* I_CEO (in nA) */
+  int16_t           U;             /* V_BE or |V_GS(off)| (in mV) */
+} Match_Type;
+
+
+/* probing profiler */
+typedef struct
+{
+  uint32_t          Ticks[NUM_PROF_STAGES];  /* time spent (in ticks) */
+  uint8_t           Runs[NUM_PROF_STAGES];   /* number of runs */
+} Profile_Type;
+
+
+/* software timer (system tick) */
+typedef struct
+{
+  uint32_t          Deadline;      /* expiry time (in ms) */
+  uint16_t          Period;        /* reload period (in ms, 0 for one-shot) */
+  uint8_t           State;         /* timer state */
+} SysTimer_Type;
+
+
+/* input event (INPUT_QUEUE) */
+typedef struct
+{
+  uint8_t           Key;           /* key code */
+  uint16_t          Time;          /* time of event (in ms) */
+} Key_Event_Type;
+
+
+/* power-state statistics */
+typedef struct
+{
+  uint32_t          Idle;          /* time in idle mode (in ticks) */
+  uint32_t          PwrSave;       /* time in power save mode (in ticks) */
+} SleepStats_Type;
+
+
 /* inductor */
 typedef struct
 {
@@ -774,6 +1353,17 @@ typedef struct
 */
 
 
+/* captured value for binary frames */
+typedef struct
+{
+  uint8_t           Mode;          /* mode flags */
+  uint8_t           Count;         /* number of captured values */
+  uint8_t           Sign;          /* sign of captured value (1 = negative) */
+  int8_t            Scale;         /* exponent of captured value */
+  uint32_t          Value;         /* captured value (unsigned) */
+} Frame_Type;
+
+
 /* SPI */
 typedef struct
 {
@@ -789,13 +1379,43 @@ typedef struct
 } I2C_Type;
 
 
+/* I2C job (I2C_TWI_IRQ) */
+typedef struct
+{
+  uint8_t           Address;       /* 7 bit slave address */
+  uint8_t           *Data;         /* pointer to data buffer */
+  uint8_t           Size;          /* number of bytes */
+  uint8_t           Mode;          /* job mode */
+  void              (*Callback)(uint8_t Result);  /* job done */
+} I2C_Job_Type;
+
+
 /* remote command */
 typedef struct
 {
   uint8_t                ID;       /* command ID */
   const unsigned char    *Cmd;     /* storage address of command string */
+  uint8_t                Len;      /* length of command string */
 } Cmd_Type;
 
+/* table entry for Cmd_Type (string has to be defined in same file) */
+#define CMD_ENTRY(ID, Str)    {ID, Str, sizeof(Str) - 1}
+
+
+/* factor table for GetFactor() */
+typedef struct
+{
+  uint16_t               Start;    /* voltage/ratio of first entry */
+  uint8_t                Step;     /* voltage/ratio step between entries */
+  uint8_t                Index;    /* number of entries - 2 */
+  uint16_t               Recip;    /* 2^16 / Step (rounded up) */
+  const uint16_t         *Table;   /* storage address of factors */
+  #ifdef FACTOR_SLOPES
+  const uint16_t         *Slope;   /* storage address of segment slopes */
+  uint8_t                Shift;    /* scaling of slopes (2^n) */
+  #endif
+} Factor_Type;
+
 
 
 /* ************************************************************************
@@ -155,6 +155,20 @@
 #define ZENER_BOOST_LOW                 /* low active */
 
 
+/*
+ *  Zener check, switched mode: auto hold
+ *  - boost converter runs only until the reading has settled and
+ *    the settled V_Z is held, along with min/max of all key presses
+ *  - boost converter is turned off after ZENER_BOOST_TIMEOUT (in ms,
+ *    max. 7000) when the reading doesn't settle
+ *  - requires switched mode (ZENER_SWITCHED)
+ *  - uncomment to enable
+ */
+
+//#define ZENER_AUTO_HOLD
+#define ZENER_BOOST_TIMEOUT   3000      /* timeout in ms */
+
+
 /*
  *  Zener check during normal probing
  *  - requires boost converter running all the time (ZENER_UNSWITCHED)
@@ -169,6 +183,20 @@
 #define ZENER_VOLTAGE_MAX     30000     /* max. voltage in mV */
 
 
+/*
+ *  Zener check during normal probing: quick check
+ *  - instead of a fixed delay of 300ms for the boost converter the
+ *    voltage is read every 30ms
+ *  - ends as soon as the voltage exceeds ZENER_VOLTAGE_MAX (open probes,
+ *    nothing connected) or has settled (Zener diode)
+ *  - shorter probing cycles with open probes
+ *  - requires switched mode (ZENER_SWITCHED) and HW_PROBE_ZENER
+ *  - uncomment to enable
+ */
+
+//#define ZENER_QUICK_CHECK
+
+
 /*
  *  fixed signal output
  *  - in case the MCU's OC1B pin is wired as dedicated signal output
@@ -208,6 +236,48 @@
 //#define FREQ_COUNTER_PRESCALER     32   /* 32:1 */
 
 
+/*
+ *  frequency counter (basic and extended): reciprocal counting
+ *  - measures the period for frequencies below 10kHz instead of
+ *    counting pulses for a long gate time
+ *  - high resolution (mHz) within about 100ms
+ *  - edges on T0 are timestamped with Timer1 (T0 isn't connected to ICP1)
+ *  - min. frequency about 1Hz
+ *  - uncomment to enable
+ */
+
+//#define FREQ_COUNTER_RECIPROCAL
+
+
+/*
+ *  basic frequency counter: continuous gating
+ *  - the next gate period starts right when the previous one ends,
+ *    processing and display run during the next gate period
+ *  - no dead time between gate periods and faster updates
+ *  - T0 must not be shared with the display
+ *  - uncomment to enable
+ */
+
+//#define FREQ_COUNTER_CONTINUOUS
+
+
+/*
+ *  frequency counter (basic and extended): statistics
+ *  - min, max, mean and standard deviation (jitter) of the frequency
+ *    over a window of FREQ_STATS_WINDOW measurements
+ *  - shown below the frequency (as many lines as the display provides)
+ *  - a new window starts when the window is full, the signal is lost or
+ *    the frequency changes by more than about 4k (Hz or mHz)
+ *  - sends "n,min,max,mean,sd" via TTL serial for each complete window
+ *    if UI_SERIAL_COPY or UI_SERIAL_COMMANDS is enabled
+ *  - uncomment to enable
+ *  - window size: 2 - 255 measurements
+ */
+
+//#define FREQ_COUNTER_STATS
+#define FREQ_STATS_WINDOW     16        /* 16 measurements */
+
+
 /*
  *  ring tester (LOPT/FBT tester)
  *  - uses T0 directly as counter input
@@ -221,6 +291,42 @@
 //#define RING_TESTER_PROBES              /* probes */
 
 
+/*
+ *  ring tester: averaging and pass/fail check
+ *  - averages the rings of several shots (RING_TESTER_SHOTS)
+ *  - RING_TESTER_RATE: interval between shots in ms (50 - 5000)
+ *  - pass threshold is stored in the adjustment profile
+ *    (default: RING_TESTER_MIN, teach by long key press)
+ *  - requires display with more than 2 text lines
+ *  - uncomment to enable
+ */
+
+//#define RING_TESTER_AUTO
+#define RING_TESTER_SHOTS     4         /* 4 shots */
+#define RING_TESTER_RATE      400       /* 400ms */
+#define RING_TESTER_MIN       10        /* 10 rings */
+
+
+/*
+ *  crystal ringdown test (basic and extended frequency counter)
+ *  - excites a quartz crystal via probe #1 with a short pulse burst and
+ *    counts the rings of the decaying oscillation via the counter input
+ *  - connect the crystal between probe #1 and the counter input
+ *  - frequency is derived from the rings and the ringdown time,
+ *    Q is estimated from the number of rings
+ *  - CRYSTAL_RING_LN: ln(start amplitude / input threshold) * 100,
+ *    depends on the input stage (calibrate with a crystal of known Q)
+ *  - basic counter: max. frequency is about 1/4 of MCU clock
+ *  - extended counter: uses frequency prescaler
+ *  - requires display with more than 2 text lines
+ *  - uncomment to enable
+ *  - ln factor: 10 - 1000
+ */
+
+//#define CRYSTAL_RINGDOWN
+#define CRYSTAL_RING_LN       100       /* ln(A0/Vth) = 1.00 */
+
+
 /*
  *  event counter
  *  - default pin: T0 (PD4 ATmega 328)
@@ -245,6 +351,24 @@
 //#define EVENT_COUNTER_TRIGGER_OUT
 
 
+/*
+ *  log mode for event counter
+ *  - logs the time between events (resolution 64 MCU cycles, max. about
+ *    0.5s at 8MHz) into a ring buffer with EVENT_LOG_SIZE entries
+ *  - each event triggers an interrupt, max. event rate is about 1/100 of
+ *    the MCU clock
+ *  - shows a histogram of events over time after counting is stopped
+ *  - log is sent via TTL serial after counting is stopped (UI_SERIAL_COPY)
+ *    or can be read later by the remote command EVLOG (UI_SERIAL_COMMANDS)
+ *  - requires event counter (HW_EVENT_COUNTER)
+ *  - uncomment to enable
+ *  - log size: 2 - 255 entries, 2 bytes RAM per entry
+ */
+
+//#define EVENT_COUNTER_LOG
+#define EVENT_LOG_SIZE        128       /* 128 entries */
+
+
 /*
  *  IR remote control detection/decoder (via dedicated MCU pin)
  *  - requires IR receiver module, e.g. TSOP series
@@ -267,6 +391,20 @@
 //#define HW_ADJUST_CAP
 
 
+/*
+ *  background drift check using the fixed cap for self-adjustment
+ *  - measures the fixed cap every 60s while the tester waits for the
+ *    next probing cycle and updates the voltage offsets in RAM
+ *  - each run changes the offsets by 1mV at most to filter out noise
+ *  - offsets are stored in the EEPROM only when saving the adjustment
+ *    values
+ *  - requires HW_ADJUST_CAP and background tasks (SYSTEM_TASKS)
+ *  - uncomment to enable
+ */
+
+//#define ADJUST_CAP_DRIFT
+
+
 /*
  *  L/C meter hardware option
  *  - uses T0 directly as frequency input
@@ -295,6 +433,28 @@
 //#define LC_METER_SHOW_FREQ
 
 
+/*
+ *  L/C meter: fast update mode
+ *  - fixed gate time of 200ms and moving window over the last five gate
+ *    periods (resolution of 1s gate time, but updated every 200ms)
+ *  - window restarts when the frequency changes by more than 0.4%
+ *  - uncomment to enable
+ */
+
+//#define LC_METER_FAST
+
+
+/*
+ *  L/C meter: track drift of base frequency
+ *  - takes the frequency as new base frequency f_i after ten consecutive
+ *    near-zero readings (within about 0.5pF) in C mode
+ *  - also nulls a tiny cap (< 0.5pF) connected that long
+ *  - uncomment to enable
+ */
+
+//#define LC_METER_TRACK
+
+
 /*
  *  relay for parallel cap (sampling ADC)
  *  - uncomment to enable (not implemented yet)
@@ -319,6 +479,21 @@
 #define LOGIC_PROBE_R2        3300
 
 
+/*
+ *  Logic Probe: pulse catcher
+ *  - the analog comparator watches TP_LOGIC between the readings,
+ *    latches single pulses and estimates the frequency of pulse trains
+ *  - threshold is the bandgap reference (about 1.1V) scaled by the
+ *    voltage divider (standard: about 4.4V)
+ *  - Timer2 runs free with a 1024 prescaler as time base
+ *  - requires logic probe (HW_LOGIC_PROBE) and a display with more than
+ *    5 lines
+ *  - uncomment to enable
+ */
+
+//#define LOGIC_PROBE_PULSE
+
+
 /*
  *  Buzzer
  *  - see BUZZER_CTRL in config_<MCU>.h for port pin
@@ -353,6 +528,39 @@
 //#define HW_MAX31855
 
 
+/*
+ *  external ADC: ADS1115 (16 bit, I2C)
+ *  - AIN0-AIN2 connected to probe-1 to probe-3, AIN3 unused
+ *    (take care of input protection, max. input voltage is Vdd + 0.3V)
+ *  - continuous conversion mode at 860 SPS, PGA auto-scaling
+ *  - ADS1115_I2C_ADDR: I2C address (0x48-0x4b, set by ADDR pin)
+ *  - ADS1115_SAMPLES: number of samples per reading (1-16)
+ *  - measurements using the external ADC:
+ *    ADS1115_R_SMALL: resistors < 10 Ohms (SmallResistor())
+ *    ADS1115_LEAKAGE: cap leakage tool (SW_CAP_LEAKAGE)
+ *  - requires I2C bus and I2C read support
+ *  - uncomment to enable
+ */
+
+//#define HW_ADS1115
+#define ADS1115_I2C_ADDR      0x48
+#define ADS1115_SAMPLES       4
+#define ADS1115_R_SMALL
+#define ADS1115_LEAKAGE
+
+
+/*
+ *  logging mode for MAX6675/MAX31855
+ *  - samples at max. conversion rate and displays min/max/mean and
+ *    rate of change
+ *  - sends time stamp and temperature via TTL serial (when available)
+ *  - requires display with at least 4 text lines (5 for mean)
+ *  - uncomment to enable
+ */
+
+//#define THERMOCOUPLE_LOG
+
+
 /*
  *  flashlight / general purpose switched output
  *  - see FLASHLIGHT_CTRL config_<MCU>.h for port pin
@@ -396,6 +604,24 @@
 //#define PWM_SHOW_DURATION
 
 
+/*
+ *  PWM generator: frequency sweep
+ *  - sweeps linearly from a start to a stop frequency in PWM_SWEEP_STEPS
+ *    steps with a dwell time of PWM_SWEEP_DWELL per step
+ *  - timer settings for all steps are precomputed
+ *  - sends "step,frequency" via TTL serial for each step
+ *    if UI_SERIAL_COPY or UI_SERIAL_COMMANDS is enabled
+ *  - requires SW_PWM_PLUS and display with at least 4 text lines
+ *  - uncomment to enable
+ *  - steps: 2 - 32
+ *  - dwell time: in ms
+ */
+
+//#define PWM_SWEEP
+#define PWM_SWEEP_STEPS       10        /* 10 steps */
+#define PWM_SWEEP_DWELL       1000      /* 1000ms */
+
+
 /*
  *  Inductance measurement
  *  - uncomment to enable
@@ -404,6 +630,35 @@
 #define SW_INDUCTOR
 
 
+/*
+ *  Inductance measurement: median of several timings
+ *  - repeats the timing in the mode found and takes the median to reject
+ *    outliers
+ *  - stops early when all timings agree within about 3%
+ *  - L_SAMPLES: max. number of timings (3-9)
+ *  - requires SW_INDUCTOR
+ *  - uncomment to enable
+ */
+
+//#define SW_L_MEDIAN
+#define L_SAMPLES             5
+
+
+/*
+ *  Inductance measurement: noise canceler for input capture
+ *  - the rise time is latched by Timer1's input capture, triggered by the
+ *    analog comparator; the noise canceler makes the capture ignore
+ *    comparator glitches shorter than 4 MCU cycles (e.g. caused by
+ *    ringing when switching on the test current)
+ *  - fewer distorted timings, i.e. fewer repeated runs for SW_L_MEDIAN
+ *  - delay of 4 MCU cycles is compensated
+ *  - requires SW_INDUCTOR
+ *  - uncomment to enable
+ */
+
+//#define L_NOISE_CANCEL
+
+
 /*
  *  ESR measurement
  *  - requires MCU clock >= 8 MHz
@@ -415,6 +670,21 @@
 //#define SW_OLD_ESR
 
 
+/*
+ *  pipelined ESR measurement (SW_ESR only)
+ *  - the unloaded sample is taken directly after the loaded one on the
+ *    same ADC channel, which saves two of eight ADC conversions per
+ *    pulse pair
+ *  - ESR_PULSES: number of pulse pairs per reading (16-255)
+ *  - provides the spread of the reading (half range of blocks of 16
+ *    pulse pairs) for the ESR tool
+ *  - uncomment to enable
+ */
+
+//#define ESR_PIPELINED
+#define ESR_PULSES            128
+
+
 /*
  *  ESR Tool (in-circuit ESR measurement)
  *  - requires SW_ESR or SW_OLD_ESR to be enabled
@@ -424,6 +694,24 @@
 //#define SW_ESR_TOOL
 
 
+/*
+ *  ESR tool: fast mode for in-circuit sweeps
+ *  - toggled by a long key press in the ESR tool (indicated by '*')
+ *  - measures continuously with ESR_FAST_PULSES pulse pairs (16-255)
+ *    instead of 255 (or ESR_PULSES)
+ *  - display is updated only when the reading changes
+ *  - beeps when the ESR is ESR_BAD (in 0.01 Ohms) or higher, requires
+ *    buzzer (HW_BUZZER)
+ *  - requires SW_ESR_TOOL and SW_ESR
+ *  - not supported by discharge relay (HW_DISCHARGE_RELAY)
+ *  - uncomment to enable
+ */
+
+//#define ESR_TOOL_FAST
+#define ESR_FAST_PULSES       32        /* 32 pulse pairs */
+#define ESR_BAD               100       /* 1.00 Ohms */
+
+
 /*
  *  check for rotary encoders
  *  - uncomment to enable
@@ -432,6 +720,20 @@
 //#define SW_ENCODER
 
 
+/*
+ *  rotary encoder check: timing statistics
+ *  - captures the edges via pin change interrupt after the encoder is
+ *    detected and shows Gray code steps per detent, longest bounce and
+ *    max. reliable speed (detents per second)
+ *  - requires SW_ENCODER and PCINT for probes (ADC_PCINT, see
+ *    config_<MCU>.h)
+ *  - uses 300 bytes of additional RAM
+ *  - uncomment to enable
+ */
+
+//#define ENCODER_STATS
+
+
 /*
  *  squarewave signal generator
  *  - signal output via OC1B
@@ -442,6 +744,30 @@
 #define SW_SQUAREWAVE
 
 
+/*
+ *  squarewave signal generator: fractional period
+ *  - alternates between two top values (dithering) to get an average
+ *    frequency with a resolution of 1/256 of the timer's step
+ *  - fine steps via rotary encoder for high frequencies
+ *  - uses Timer1's overflow interrupt, so not with FREQ_COUNTER_RECIPROCAL
+ *  - uncomment to enable
+ */
+
+//#define SQUAREWAVE_FRACTIONAL
+
+
+/*
+ *  DDS signal generator (sine/triangle)
+ *  - signal output via OC1B (8 bit PWM at f_MCU/256)
+ *  - sample rate f_MCU/512 (8MHz: 15.6kHz), up to f_sample/8
+ *  - requires an external RC low pass filter
+ *  - requires additional keys
+ *  - uncomment to enable
+ */
+
+//#define SW_DDS
+
+
 /*
  *  IR remote control detection/decoder (via probes)
  *  - requires IR receiver module, e.g. TSOP series
@@ -492,6 +818,36 @@
 //#define SW_IR_RX_EXTRA
 
 
+/*
+ *  IR remote control detection/decoder: edge capture
+ *  - captures the IR data pin's edges via pin change interrupt
+ *    with a resolution of 1s (Timer1 time stamp) instead of polling
+ *    every 50s
+ *  - next packet is captured while the last one is decoded
+ *  - requires PCINT for data pin (see ADC_PCINT and IR_PCINT in
+ *    config_<MCU>.h)
+ *  - uses 200 bytes of additional RAM
+ *  - uncomment to enable
+ */
+
+//#define SW_IR_RX_PCINT
+
+
+/*
+ *  IR remote control detection/decoder: carrier measurement
+ *  - supports a raw IR photodiode/phototransistor at the frequency
+ *    counter's input (T0) as alternative to an IR receiver module
+ *  - Timer0 counts the carrier's edges, i.e. the polling loop gets the
+ *    signal's envelope for free
+ *  - measures carrier frequency and duty cycle during the first burst
+ *    of each packet (Timer1 time stamp)
+ *  - requires HW_FREQ_COUNTER_BASIC and polling (not SW_IR_RX_PCINT)
+ *  - uncomment to enable
+ */
+
+//#define SW_IR_RX_CARRIER
+
+
 /*
  *  IR remote control sender
  *  - signal output via OC1B
@@ -513,6 +869,20 @@
 //#define SW_IR_TX_ALTDELAY
 
 
+/*
+ *  Timer driven IR remote control sender
+ *  - precomputes pulses/pauses as burst schedule which is processed
+ *    by Timer0's OCR0B match interrupt (independent of C compiler)
+ *  - replaces the delay loops (SW_IR_TX_ALTDELAY isn't needed)
+ *  - shares Timer0 with bit-bang serial RX (SERIAL_BITBANG & SERIAL_RW)
+ *    via the timer manager
+ *  - needs 200 bytes of RAM for the schedule
+ *  - uncomment to enable
+ */
+
+//#define SW_IR_TX_TIMER
+
+
 /*
  *  additional protocols for IR remote control sender
  *  - uncommon protocols which will increase flash memory usage ;)
@@ -522,6 +892,22 @@
 //#define SW_IR_TX_EXTRA
 
 
+/*
+ *  IR remote control: learn & replay raw packets
+ *  - IR detector stores the last packet as raw pulse train in EEPROM
+ *    with a long key press (next slot each time)
+ *  - IR sender replays stored packets via the pseudo protocol "Raw"
+ *  - requires IR detector (SW_IR_RECEIVER or HW_IR_RECEIVER) and
+ *    IR sender (SW_IR_TRANSMITTER)
+ *  - costs 101 bytes of EEPROM per slot
+ *  - uncomment to enable
+ *  - slots: 1 - 4
+ */
+
+//#define SW_IR_LEARN
+#define IR_LEARN_SLOTS        2         /* 2 slots */
+
+
 /*
  *  check for opto couplers
  *  - uncomment to enable
@@ -530,6 +916,17 @@
 #define SW_OPTO_COUPLER
 
 
+/*
+ *  opto couplers: CTR sweep
+ *  - measures the CTR of BJT types also at lower LED currents (about
+ *    2.7mA and 8A, with LED's cathode pulled down via Rl)
+ *  - requires check for opto couplers (SW_OPTO_COUPLER)
+ *  - uncomment to enable
+ */
+
+//#define OPTO_CTR_SWEEP
+
+
 /*
  *  check for Unijunction Transistor
  *  - uncomment to enable
@@ -556,14 +953,41 @@
 //#define SW_SERVO
 
 
+/*
+ *  Servo Check: auto test with current measurement
+ *  - moves servo to both endpoints and center, and displays peak and
+ *    idle current for each position
+ *  - current via external shunt between probe #1 (servo's Gnd) and
+ *    probe #3 (Gnd)
+ *  - SERVO_SHUNT: shunt resistor in mOhms
+ *  - requires display with at least 4 text lines
+ *  - uncomment to enable
+ */
+
+//#define SERVO_AUTO_TEST
+#define SERVO_SHUNT           1000
+
+
 /*
  *  DS18B20 - OneWire temperature sensor
+ *  - DS18B20_MULTI: support multiple sensors on the bus (max. number)
+ *    one conversion for all sensors and one line per sensor
+ *    requires display with more than 2 text lines
+ *  - DS18B20_RESOLUTION: set resolution in bits (9-12)
+ *    lower resolution means faster conversion (9 bits: 94ms, 12 bits: 750ms)
+ *    comment out to keep the sensor's setting
+ *  - DS18B20_ROM_CACHE: keep ROM codes of last bus search in EEPROM
+ *    and check them by addressing each sensor directly instead of
+ *    searching the bus again (requires DS18B20_MULTI)
  *  - uncomment to enable
  *  - also enable ONEWIRE_PROBES or ONEWIRE_IO_PIN (see section 'Busses')
  *  - please see UI_ROUND_DS18B20
  */
 
 //#define SW_DS18B20
+//#define DS18B20_MULTI         8     /* multiple sensors (max. 8) */
+//#define DS18B20_RESOLUTION    12    /* resolution (9-12 bits) */
+//#define DS18B20_ROM_CACHE           /* cache ROM codes in EEPROM */
 
 
 /*
@@ -598,6 +1022,17 @@
 //#define SW_ONEWIRE_SCAN
 
 
+/*
+ *  scan I2C bus for devices and list their addresses
+ *  - hardware I2C: also tests bus speeds and shows the fastest stable one
+ *  - requires display with more than 2 text lines
+ *  - uncomment to enable
+ *  - also enable I2C (see section 'Busses')
+ */
+
+//#define SW_I2C_SCAN
+
+
 /*
  *  capacitor leakage check
  *  - requires display with more than two lines
@@ -607,6 +1042,17 @@
 //#define SW_CAP_LEAKAGE
 
 
+/*
+ *  capacitor leakage check: log decay curve and predict settled current
+ *  - samples the current every 10s and extrapolates the exponential decay
+ *  - shows prediction in line #4 ("~" converging, "=" converged)
+ *  - requires display with at least 4 lines
+ *  - uncomment to enable
+ */
+
+//#define CAP_LEAK_PREDICT
+
+
 /*
  *  display reverse hFE for BJTs
  *  - hFE for collector and emitter reversed
@@ -626,6 +1072,18 @@
 //#define SW_HFE_CURRENT
 
 
+/*
+ *  hFE sweep for BJTs
+ *  - measures hFE for all usable drive configurations in one pass
+ *    (common collector and common emitter circuits via Rl/Rh)
+ *  - displays hFE and I_C/I_E for each configuration, sorted by current
+ *  - adds remote command "h_FE_sweep" when UI_SERIAL_COMMANDS is enabled
+ *  - uncomment to enable
+ */
+
+//#define SW_HFE_SWEEP
+
+
 /*
  *  R/C/L monitors
  *  - monitor passive components connected to probes #1 and #3
@@ -641,6 +1099,23 @@
 //#define SW_MONITOR_RL         /* R plus L */
 
 
+/*
+ *  graph for R and C monitors, ESR tool and Zener tool
+ *  - bar graph (line #4) and trend plot (line #5 up to the line before
+ *    the last one) of the last GRAPH_SAMPLES readings
+ *  - the first reading sets the reference (half scale), a short key
+ *    press in the R and C monitors takes the next reading as new reference
+ *  - requires color graphics display (ILI9341 or ST7735) with at
+ *    least 8 text lines
+ *  - Zener tool: not with UI_ZENER_DIODE
+ *  - uncomment to enable
+ *  - number of samples: 16, 32, 64 or 128 (1 byte RAM each)
+ */
+
+//#define UI_MONITOR_GRAPH
+#define GRAPH_SAMPLES         64
+
+
 /*
  *  C/L monitors: auto hold
  *  - requires display with more than two text lines
@@ -651,12 +1126,133 @@
 //#define SW_MONITOR_HOLD_L     /* auto-hold L (L monitor) */
 
 
+/*
+ *  Sorting/binning tool for batches of R, C or L
+ *  - uses probes #1 and #3
+ *  - nominal value is taken from a reference part, tolerance is
+ *    selectable (1, 2, 5, 10 or 20%)
+ *  - each inserted part is measured without full identification and
+ *    sorted into bins (low, pass, high) with running counts
+ *  - indicates result by color (color display) and buzzer
+ *    (BUZZER_ACTIVE or BUZZER_PASSIVE)
+ *  - L requires SW_INDUCTOR
+ *  - requires display with more than three text lines
+ *  - uncomment to enable
+ */
+
+//#define SW_SORTING
+
+
+/*
+ *  LED binning tool for batches of LEDs
+ *  - uses probes #1 and #3 (either orientation)
+ *  - V_f at high (Rl) and low (Rh) current
+ *  - sorts by V_f at high current into 4 bins of selectable width
+ *    (10, 20, 50 or 100mV) around the V_f of a reference LED, plus
+ *    bins for below and above, with running counts
+ *  - bins are stored in EEPROM
+ *  - indicates result by buzzer (BUZZER_ACTIVE or BUZZER_PASSIVE)
+ *  - requires display with more than three text lines
+ *  - uncomment to enable
+ */
+
+//#define SW_LED_BINNING
+
+
+/*
+ *  Compare tool for checking a part against a known-good one (golden part)
+ *  - takes component type and pinout of the last probing result as
+ *    reference, so probe the known-good part first
+ *  - re-measures just the parameters of the reference part with the same
+ *    pinout instead of running a full probing cycle
+ *  - shows only parameters deviating more than the limits below
+ *  - supports resistor, capacitor, diode, BJT, enhancement mode MOSFET
+ *    and IGBT
+ *  - COMPARE_TOL: tolerance for values (R, C, hFE, R_DS_on) in %
+ *  - COMPARE_TOL_U: tolerance for voltages (V_f, V_BE, V_th) in mV
+ *  - requires display with more than two text lines
+ *  - uncomment to enable
+ */
+
+//#define SW_COMPARE
+#define COMPARE_TOL           5
+#define COMPARE_TOL_U         30
+
+
+/*
+ *  Matching tool for BJTs and JFETs
+ *  - takes component type and pinout of the last probing result,
+ *    so probe the first part of the batch before
+ *  - each inserted part is measured by the targeted measurement of the
+ *    compare tool and recorded
+ *    BJT: hFE, V_BE and I_CEO / JFET: I_DSS and V_GS(off)
+ *  - shows running statistics and reports the closest-matching pairs
+ *    or quads on the display and via TTL serial
+ *  - MATCH_PARTS: max. number of parts (4-16)
+ *  - requires display with more than three text lines
+ *  - uncomment to enable
+ */
+
+//#define SW_MATCHING
+#define MATCH_PARTS           16
+
+
+/*
+ *  history of probing results
+ *  - keeps a compact record (type, pinout and key value) of the last
+ *    HISTORY_SIZE components found in a ring buffer in RAM
+ *  - menu tool for browsing the records
+ *  - records can be read by the remote command HIST (UI_SERIAL_COMMANDS)
+ *  - requires a display with more than 2 text lines
+ *  - uncomment to enable
+ *  - history size: 2 - 255 records, 14 bytes RAM per record
+ *    ATmega 328: keep it small (about 10), ATmega 644/1280: 50 or more
+ */
+
+//#define SW_HISTORY
+#define HISTORY_SIZE          10        /* 10 records */
+
+
+/*
+ *  repeat measurement with statistics
+ *  - re-runs the value measurements of the last probing result
+ *    REPEAT_RUNS times (no identification) and reports mean, standard
+ *    deviation, min and max
+ *  - R and L (single resistor), C and ESR, V_f (with Rl) and hFE
+ *    (common collector circuit)
+ *  - menu tool and remote command REPEAT (UI_SERIAL_COMMANDS)
+ *  - running statistics (Welford), no samples stored
+ *  - uncomment to enable
+ *  - runs: 2 - 100
+ */
+
+//#define SW_REPEAT_STATS
+#define REPEAT_RUNS           10        /* 10 runs */
+
+
+/*
+ *  data logger
+ *  - samples R, C, L, ESR or voltage at probes #1 and #3, or the
+ *    temperature of an enabled DS18B20, MAX31855 or MAX6675, at a fixed
+ *    interval (0.1 - 60s) and sends CSV lines via TTL serial
+ *  - requires system tick (SYSTEM_TICK) and TTL serial output
+ *    (UI_SERIAL_COPY or UI_SERIAL_COMMANDS)
+ *  - uncomment to enable
+ */
+
+//#define SW_LOGGER
+
+
 /*
  *  DHT11, DHT22 and compatible humidity & temperature sensors
+ *  - SW_DHTXX_PCINT: capture edges via pin change interrupt and decode
+ *    the frame afterwards (tolerates interrupt jitter, e.g. serial)
+ *    requires PCINT for probes (ADC_PCINT, see config_<MCU>.h)
  *  - uncomment to enable
  */
 
 //#define SW_DHTXX
+//#define SW_DHTXX_PCINT
 
 
 /*
@@ -673,6 +1269,8 @@
 //#define SW_R_E96_T            /* E96 1% tolerance, text */
 //#define SW_R_E96_CC           /* E96 1% tolerance, color-code */
 //#define SW_R_E96_EIA96        /* E96 1% tolerance, EIA-96 code */
+//#define SW_R_E192_T           /* E192 0.1% tolerance, text */
+//#define SW_R_E192_CC          /* E192 0.1% tolerance, color-code */
 
 
 /*
@@ -704,6 +1302,20 @@
 //#define SW_CONTINUITY_CHECK
 
 
+/*
+ *  continuity check: instant beep via analog comparator
+ *  - compares probe #1 with the bandgap reference (about 1.1V) while
+ *    waiting for the next reading and switches an active buzzer at once
+ *  - catches also short intermittent contacts
+ *  - ADC readings are still used for the displayed voltage and the
+ *    thresholds
+ *  - requires continuity check (SW_CONTINUITY_CHECK)
+ *  - uncomment to enable
+ */
+
+//#define CONTINUITY_COMPARATOR
+
+
 /*
  *  show additional info for a possible potentiometer/trimpot
  *  - shows sum of both resistors and ratios in %
@@ -722,17 +1334,71 @@
 
 
 /*
- *  photodiode check
+ *  V_loss of small caps (< 4.7F): use the charge of the capacitance
+ *  measurement instead of an extra discharge and charge cycle
+ *  - faster, but based on a lower start voltage (about U_bandgap)
+ *  - requires SW_C_VLOSS
  *  - uncomment to enable
  */
 
-//#define SW_PHOTODIODE
+//#define C_VLOSS_FUSED
 
 
+/*
+ *  photodiode check
+ *  - uncomment to enable
+ */
 
-/* ************************************************************************
- *   workarounds for some testers
- * ************************************************************************ */
+//#define SW_PHOTODIODE
+
+
+/*
+ *  photodiode check: response time
+ *  - long key press toggles pulse mode
+ *  - pulses a LED between probe #2 (anode) and probe #1 via Rl and
+ *    measures the 10-90% rise and fall times of the photodiode in
+ *    reverse-bias mode with Rh as load
+ *  - free-running ADC with 8 bit resolution at the fast ADC clock
+ *    (see ADC_FREQ_FAST), lowers sampling rate for slow responses
+ *  - requires SW_PHOTODIODE
+ *  - uncomment to enable
+ */
+
+//#define PHOTODIODE_TIMING
+
+
+/*
+ *  scope (single-shot capture of probe #1)
+ *  - free-running ADC with 8 bit resolution at the fast ADC clock
+ *    (see ADC_FREQ_FAST)
+ *  - trigger on rising or falling edge, or step response via Rl/Rh
+ *  - requires color graphics display (ILI9341 or ST7735)
+ *  - sends samples also via TTL serial if UI_SERIAL_COPY or
+ *    UI_SERIAL_COMMANDS is enabled
+ *  - uncomment to enable
+ */
+
+//#define SW_SCOPE
+
+
+/*
+ *  I-V curve tracer for diodes and BJTs
+ *  - uses the component found by the last probing cycle
+ *  - operating points via Rl/Rh, two base drive levels for BJTs
+ *  - plots points on color graphics displays (ILI9341 or ST7735),
+ *    otherwise lists them
+ *  - sends points also as CSV via TTL serial if UI_SERIAL_COPY or
+ *    UI_SERIAL_COMMANDS is enabled
+ *  - uncomment to enable
+ */
+
+//#define SW_CURVE_TRACER
+
+
+
+/* ************************************************************************
+ *   workarounds for some testers
+ * ************************************************************************ */
 
 
 /*
@@ -819,6 +1485,20 @@
 //#define UI_SPANISH
 
 
+/*
+ *  Add English as second language selectable at runtime.
+ *  - for a non-English language selected above
+ *  - language is selected via main menu and stored with the adjustment
+ *    profile (save profile to keep language)
+ *  - all fonts support English, so there's no font issue
+ *  - increases flash usage by about 4-5 kB (strings and selection)
+ *  - not supported by ATmega 328 because of its small flash/EEPROM
+ *  - uncomment to enable
+ */
+
+//#define UI_ENGLISH_2ND
+
+
 /*
  *  Use comma instead of dot to indicate a decimal fraction.
  *  - uncomment to enable
@@ -880,6 +1560,18 @@
 //#define UI_CHOOSE_PROFILE
 
 
+/*
+ *  Fast boot: start probing right away when the test button was pressed
+ *  while powering on.
+ *  - skips the delay of the welcome screen and the profile menu
+ *    (UI_CHOOSE_PROFILE), profile #1 is loaded
+ *  - not for a very long key press (reset to defaults)
+ *  - uncomment to enable
+ */
+
+//#define UI_FAST_BOOT
+
+
 /*
  *  Add a third profile for adjustment values.
  *  - uncomment to enable
@@ -888,6 +1580,36 @@
 //#define UI_THREE_PROFILES
 
 
+/*
+ *  Measurement preset stored with each adjustment profile
+ *  - "full" runs all checks enabled by the settings in this file,
+ *    "fast" is meant for quick sorting of parts
+ *  - fast preset: PRESET_FAST_SAMPLES ADC samples instead of ADC_SAMPLES,
+ *    PRESET_FAST_DELAY (in ms) instead of CYCLE_DELAY, and skips ESR,
+ *    extra V_loss measurement of small caps, inductance of resistors and
+ *    Zener check (HW_PROBE_ZENER)
+ *  - selected via main menu, save profile to keep preset
+ *  - uncomment to enable
+ */
+
+//#define UI_PRESETS
+#define PRESET_FAST_SAMPLES   10
+#define PRESET_FAST_DELAY     1000
+
+
+/*
+ *  Wear leveling for adjustment profiles
+ *  - each profile is stored in ADJUST_SLOTS EEPROM slots which are
+ *    written in turn, the slot with the highest sequence number is the
+ *    current one
+ *  - requires ADJUST_SLOTS times the EEPROM space of a profile
+ *  - uncomment to enable
+ */
+
+//#define ADJUST_WEAR_LEVEL
+#define ADJUST_SLOTS     4         /* slots per profile */
+
+
 /*
  *  Output components found also via TTL serial interface.
  *  - uncomment to enable
@@ -907,6 +1629,20 @@
 //#define UI_SERIAL_COMMANDS
 
 
+/*
+ *  Mirror text output on a VT100 terminal connected to the TTL serial
+ *  interface while the display is used as well (same content and
+ *  layout on both).
+ *  - cursor is moved only when needed, graphics and colors aren't mirrored
+ *  - disables UI_SERIAL_COPY and UI_SERIAL_COMMANDS
+ *  - SERIAL_TX_BUFFER is recommended for sending in the background
+ *  - uncomment to enable
+ *  - also enable SERIAL_BITBANG or SERIAL_HARDWARE (see section 'Busses')
+ */
+
+//#define UI_SERIAL_MIRROR
+
+
 /*
  *  Maximum time to wait after probing (in ms).
  *  - applies to continuous mode only
@@ -916,6 +1652,20 @@
 #define CYCLE_DELAY      3000
 
 
+/*
+ *  Two-terminal mode ("tweezers") for probes #1 and #2
+ *  - selected via main menu (toggles mode)
+ *  - checks only probe pair #1/#2 for resistor (plus inductance),
+ *    diode and capacitor, and skips the 3-pin identification
+ *  - runs continuously, also in auto-hold mode
+ *  - TWEEZERS_DELAY: time between probing runs (in ms)
+ *  - uncomment to enable
+ */
+
+//#define UI_TWEEZERS
+#define TWEEZERS_DELAY   500
+
+
 /*
  *  Maximum number of probing runs without any component found in a row.
  *  - applies to continuous mode only
@@ -929,6 +1679,26 @@
 #define CYCLE_MAX        5
 
 
+/*
+ *  Part detection ("arm" mode): start probing as soon as a part is
+ *  connected
+ *  - checks the probes every PART_POLL ms with a quick measurement via
+ *    Rh while waiting for user feedback (idle between checks)
+ *  - auto-hold mode: a new part is probed automatically after the former
+ *    one has been removed, no key press required
+ *  - continuous mode: pauses while the probes are open instead of
+ *    re-probing every CYCLE_DELAY, each pause counts as a missed part
+ *    for CYCLE_MAX
+ *  - not for two-terminal mode (UI_TWEEZERS)
+ *  - not supported by discharge relay (HW_DISCHARGE_RELAY)
+ *  - PART_POLL: time between checks (in ms, 10 - 500)
+ *  - uncomment to enable
+ */
+
+//#define UI_PART_DETECT
+#define PART_POLL        250
+
+
 /*
  *  Automatic power-off when no button is pressed for a while (in s).
  *  - applies to auto-hold mode only
@@ -948,6 +1718,87 @@
 #define SW_SYMBOLS
 
 
+/*
+ *  compressed component symbols
+ *  - bitmaps are stored run-length encoded and decoded while displayed
+ *  - saves about 30-45% of flash for the symbol bitmaps
+ *  - only for horizontally aligned symbol sets (SYMBOLS_*_H and SYMBOLS_*_HF)
+ *  - requires component symbols (SW_SYMBOLS) to be enabled
+ *  - uncomment to enable
+ */
+
+//#define SYMBOLS_RLE
+
+
+/*
+ *  compressed fonts
+ *  - bitmaps are stored run-length encoded and decoded while displayed
+ *  - saves about 35-50% of flash for the font bitmaps
+ *  - only for the large fonts of color displays (FONT_10X16_*HF,
+ *    FONT_12X16_*HF and FONT_16X26_*HF)
+ *  - uncomment to enable
+ */
+
+//#define FONT_RLE
+
+
+/*
+ *  Cache glyphs of digits, dot, minus, prefixes and units in RAM to speed
+ *  up the refresh of live values (e.g. frequency counter or monitors).
+ *  - for color displays with large fonts (ILI9163, ILI9341, ILI9481,
+ *    ILI9486, ILI9488 and ST7735)
+ *  - requires 24 times the bitmap size of a font character of RAM, e.g.
+ *    12x16: 792 bytes, 16x26: 1272 bytes
+ *  - not supported by ATmega 328 because of its small RAM
+ *  - uncomment to enable
+ */
+
+//#define FONT_CACHE
+
+
+/*
+ *  Use a RAM framebuffer for monochrome graphic displays (ST7565R).
+ *  - drawing is done in RAM and only changed parts of the pages are sent
+ *    to the display when output is done (e.g. before waiting for a key)
+ *  - unchanged chars cause no bus traffic at all
+ *  - requires 1 byte per 8 dots of the display RAM, e.g. 1056 bytes
+ *    for a 128x64 display
+ *  - not supported by ATmega 328 because of its small RAM
+ *  - uncomment to enable
+ */
+
+//#define LCD_FRAMEBUFFER
+
+
+/*
+ *  Batch updates for the ST7920 in graphics mode.
+ *  - chars are stored in the char matrix only and the changed 16 bit
+ *    words of the current text line are sent when moving to another line
+ *    or when output is done (e.g. before waiting for a key)
+ *  - one GDRAM address setup per row for contiguous words instead of
+ *    one per char and row
+ *  - not supported for rotated display (LCD_ROT180)
+ *  - uncomment to enable
+ */
+
+//#define LCD_BATCH_UPDATE
+
+
+/*
+ *  Fast bulk writes for the 8 bit parallel bus (ILI9341, ILI9481, ILI9486,
+ *  ILI9488).
+ *  - write strobes for filling areas and clearing lines are created by
+ *    writing the complete control port (LCD_PORT) with precalculated levels,
+ *    and the write loop is unrolled (4 pixels per run)
+ *  - for colors with identical MSB and LSB (e.g. black) the data signals
+ *    aren't changed at all
+ *  - the other pins of LCD_PORT mustn't be changed by an ISR meanwhile
+ *  - uncomment to enable
+ */
+
+//#define LCD_FAST_WRITE
+
+
 /*
  *  fancy pinout: show right-hand probe numbers above/below symbol
  *  - requires component symbols (SW_SYMBOLS) to be enabled
@@ -1124,6 +1975,18 @@
 //#define SW_SYMBOL_TEST
 
 
+/*
+ *  main menu: display benchmark
+ *  - measures speed of clearing the screen, clearing lines, displaying
+ *    chars and component symbols (SW_SYMBOLS)
+ *  - shows operations per second and pixels per second (graphic display)
+ *  - results are also sent to serial with UI_SERIAL_COPY
+ *  - uncomment to enable
+ */
+
+//#define SW_DISPLAY_BENCH
+
+
 /*
  *  Round some values if appropriate.
  *  - for
@@ -1143,6 +2006,49 @@
 //#define UI_CENTER_ALIGN
 
 
+/*
+ *  Shadow of the character grid in RAM for change-only display updates
+ *  - characters already displayed at the same position (and with the
+ *    same color) aren't sent again, and clearing a text line is deferred
+ *    until it's clear which old characters are left over
+ *  - speeds up the tools with continuous output (monitors, frequency
+ *    counter etc.) on displays with a slow bus, and also the VT100
+ *    terminal (only changed characters are sent)
+ *  - the value is the size of the grid in characters and should match
+ *    the display (characters per line * number of lines), e.g. 16x8 = 128
+ *  - requires 1 byte of RAM per character, color displays 3 bytes
+ *  - uncomment to enable and adjust size
+ */
+
+//#define UI_SHADOW_GRID        128
+
+
+/*
+ *  Partial refresh of probing results in continuous mode
+ *  - the old result stays on the display while probing and the new one
+ *    is written over it, i.e. only changed characters are updated and
+ *    the symbol is kept when it's the same one (SW_SYMBOLS)
+ *  - no "probing..." between results and no flicker of static parts
+ *  - requires UI_SHADOW_GRID covering the complete display
+ *  - uncomment to enable
+ */
+
+//#define UI_PARTIAL_REFRESH
+
+
+/*
+ *  Hardware scrolling of text lines
+ *  - when the last text line is reached, the display scrolls up by one
+ *    line instead of being cleared (pages with LINE_KEY still wait for
+ *    a key press after a full page of new lines)
+ *  - supported by ILI9341/ILI9342 and ILI9488
+ *  - not supported with LCD_ROTATE or LCD_FLIP_Y
+ *  - uncomment to enable
+ */
+
+//#define UI_HW_SCROLL
+
+
 /*
  *  confirmation beep when probing is done
  *  - requires buzzer (HW_BUZZER)
@@ -1152,6 +2058,21 @@
 //#define UI_PROBING_DONE_BEEP
 
 
+/*
+ *  show preliminary result while probing
+ *  - resistors are shown right after identification, while the
+ *    remaining probe pairs are checked for capacitors (which may take
+ *    a while for large caps)
+ *  - the final result replaces the preliminary one
+ *  - other components are shown at once anyway and measurements done
+ *    by the output functions (e.g. I_R, C, L or ESR) are displayed as
+ *    soon as they are finished
+ *  - uncomment to enable
+ */
+
+//#define UI_EARLY_RESULT
+
+
 /*
  *  storage of firmware data (texts, tables etc)
  *  - self-adjustment data is always stored in EEPROM
@@ -1249,8 +2170,29 @@
 #define BAT_LOW          6400 
 
 
+/*
+ *  Background battery monitoring with runtime estimate
+ *  - samples the battery every 100ms with a few ADC samples (BAT_SAMPLES)
+ *    while waiting for user feedback, and filters the readings
+ *  - the battery check of the probing cycle takes the filtered voltage
+ *    instead of reading the ADC
+ *  - estimates the remaining runtime from the voltage drop per minute,
+ *    and warns (weak) when it's below BAT_RUNTIME_WARN (in minutes)
+ *  - with power-state statistics (SW_POWER_STATS) the remote command
+ *    PWR also returns the remaining runtime
+ *  - requires background tasks (SYSTEM_TASKS)
+ *  - uncomment to enable
+ */
+
+//#define BAT_BACKGROUND
+#define BAT_SAMPLES      4
+#define BAT_RUNTIME_WARN 30
+
+
 /*
  *  Enter sleep mode when idle to save power.
+ *  - settling times in measurements also use the idle sleep mode instead
+ *    of busy waiting
  *  - uncomment to enable
  */
 
@@ -1324,6 +2266,41 @@
 //#define R_MULTIOFFSET
 
 
+/*
+ *  Current reversal for small resistors (< 10 Ohms)
+ *  - measures in both directions and takes the mean, which cancels
+ *    offsets like thermal EMF and ADC offsets
+ *  - 25 instead of 100 ADC samples per voltage and direction, i.e.
+ *    faster measurement (also for resistance monitors)
+ *  - uncomment to enable
+ */
+
+//#define R_REVERSAL
+
+
+/*
+ *  Faster self-adjustment
+ *  - each adjustment step ends as soon as the values of two consecutive
+ *    runs agree (min. 3 runs, max. 5 runs)
+ *  - values of a run are shown for 300ms instead of 1s
+ *  - uncomment to enable
+ */
+
+//#define ADJUST_CONVERGE
+
+
+/*
+ *  Quick adjustment of probe leads
+ *  - menu item for measuring just the resistance and capacitance offsets
+ *    of the probe leads (R0 and C0, also probe pair specific)
+ *  - keeps all other adjustment values
+ *  - useful after swapping probe leads
+ *  - uncomment to enable
+ */
+
+//#define SW_LEAD_ADJUST
+
+
 /* 
  *  Capacitance of probes (in pF).
  *  - default offset for MCU, PCB tracks and probe leads
@@ -1357,6 +2334,19 @@
 #define CAP_DISCHARGED   2
 
 
+/*
+ *  Adaptive discharging of probes.
+ *  - estimates the remaining discharge time based on the measured voltage
+ *    decay and adapts the wait time between rounds of probe checks
+ *    (instead of a fixed 50ms wait after each probe)
+ *  - displays estimated remaining time for long discharges (>1s) in
+ *    line #3 while probing (requires a display with 3 lines or more)
+ *  - uncomment to enable
+ */
+
+//#define DISCHARGE_ADAPTIVE
+
+
 /*
  *  Correction factors for capacitors (in 0.1%)
  *  - positive factor increases capacitance value
@@ -1371,6 +2361,56 @@
 #define CAP_FACTOR_LARGE      -90    /* -9.0% */
 
 
+/*
+ *  finish probing early for a single two-pin resistor
+ *  - skips the remaining probe combinations when the resistor is
+ *    confirmed in both directions and the third probe has no DC path
+ *    to the resistor's probes (checked via Rh)
+ *  - a resistor > about 50M at the third probe might be missed
+ *  - uncomment to enable
+ */
+
+//#define PROBE_EARLY_EXIT
+
+
+/*
+ *  pre-screen special semiconductors while probing
+ *  - skips the checks for Thyristor/TRIAC, PUT and UJT when the voltages
+ *    measured before already rule them out, e.g. for BJTs, MOSFETs,
+ *    diodes and resistors
+ *  - saves 25-60ms per probe combination
+ *  - Thyristors/TRIACs with an on-state voltage below 250mV or a gate
+ *    voltage above 2.5V would be missed (not seen in practice)
+ *  - uncomment to enable
+ */
+
+//#define PROBE_PRESCREEN
+
+
+/*
+ *  quick re-probing in continuous mode
+ *  - keeps a fingerprint of the last component (single resistor or
+ *    capacitor: probe pins and value)
+ *  - next cycle measures just the known probe pins and skips the
+ *    identification when the value is within 10% and the third probe
+ *    has no DC path, otherwise it runs the full probing cycle
+ *  - uncomment to enable
+ */
+
+//#define PROBE_FINGERPRINT
+
+
+/*
+ *  precomputed table of all 6 probe permutations
+ *  - UpdateProbes() copies the resolved probe IDs, resistor and pin masks
+ *    and ADC channels in one block instead of looking up each value
+ *  - costs about 90 bytes of EEPROM/Flash (DATA_EEPROM/DATA_FLASH)
+ *  - uncomment to enable
+ */
+
+//#define PROBE_TABLE
+
+
 /*
  *  Number of ADC samples to perform for each mesurement.
  *  - Valid values are in the range of 1 - 255.
@@ -1379,6 +2419,42 @@
 #define ADC_SAMPLES      25
 
 
+/*
+ *  adaptive number of ADC samples
+ *  - ReadU() stops sampling as soon as the mean of the readings is
+ *    within the confidence bound (2 sigma), but takes at least 5 samples
+ *  - ADC_SAMPLES (Cfg.Samples) becomes the upper limit
+ *  - value is the confidence bound in ADC steps (1-10)
+ *  - uncomment to enable
+ */
+
+//#define ADC_ADAPTIVE     1
+
+
+/*
+ *  runtime ADC clock profiles
+ *  - precise profile: standard ADC clock (ADC_FREQ)
+ *  - fast profile: high ADC clock with lower resolution (ADC_FREQ_FAST)
+ *  - used by monitoring tools and logic probe for faster updates
+ *  - uncomment to enable
+ */
+
+//#define ADC_CLOCK_PROFILES
+
+
+/*
+ *  settle detection for ReadU_5ms() and ReadU_20ms()
+ *  - instead of the fixed delay quick readings are taken until the
+ *    voltage settles, the delay becomes the timeout
+ *  - value is the threshold for consecutive readings in mV (1-10)
+ *  - speeds up probing, but a slowly changing voltage (e.g. gate charge
+ *    of a power MOSFET) might be taken as settled
+ *  - uncomment to enable
+ */
+
+//#define ADC_SETTLE       2
+
+
 /*
  *  100nF AREF buffer capacitor
  *  - used by some MCU boards
@@ -1390,6 +2466,71 @@
 //#define ADC_LARGE_BUFFER_CAP
 
 
+/*
+ *  oversampling and decimation for increased ADC resolution
+ *  - adds ReadU_HiRes() returning the voltage in 0.1mV
+ *  - value is the default number of additional bits (1-3), i.e. 11-13 bits
+ *    effective resolution (4^n samples)
+ *  - used by Zener tool (alternative mode, 10:1 divider) and leakage
+ *    current measurement via Rh (resolution 1nA instead of 10nA)
+ *  - SmallResistor() sums 100 samples already and isn't affected
+ *  - uncomment to enable
+ */
+
+//#define ADC_OVERSAMPLING      2
+
+
+/*
+ *  interrupt driven ADC sampling
+ *  - conversions are managed by an ISR instead of busy waiting
+ *  - allows functions to do other things while sampling
+ *    (ADC_Start(), ADC_Ready() and ADC_Collect())
+ *  - uncomment to enable
+ */
+
+//#define ADC_INTERRUPT
+
+
+/*
+ *  ADC Noise Reduction sleep mode for low voltages
+ *  - samples based on the bandgap reference (< 1V) are taken while the
+ *    MCU sleeps to lower digital noise
+ *  - I/O clock is halted while sleeping, i.e. timers and hardware
+ *    USART pause during such a conversion
+ *  - allows to reduce ADC_SAMPLES for the same precision
+ *  - requires ADC_INTERRUPT
+ *  - uncomment to enable
+ */
+
+//#define ADC_NOISE_REDUCTION
+
+
+/*
+ *  cached voltage references
+ *  - CheckVoltageRefs() measures the bandgap reference (and the optional
+ *    2.5V reference) only when the cached values expired instead of every
+ *    probing cycle (saves about 400 ADC samples per cycle)
+ *  - refresh on a battery voltage change or after 60s (with SYSTEM_TICK)
+ *  - a refresh takes just 50 samples when the last value was stable
+ *  - value is the number of probing cycles the cache is valid (1-50)
+ *  - uncomment to enable
+ */
+
+//#define REF_CACHE        10
+
+
+/*
+ *  precomputed slopes for interpolation of cap and inductor factors
+ *  - GetFactor() interpolates with a per-segment slope stored in a table
+ *    (shift and multiply) instead of dividing by the table step
+ *  - results may differ by 1 in the last digit of the factor
+ *  - requires about 170 bytes of additional flash
+ *  - uncomment to enable
+ */
+
+//#define FACTOR_SLOPES
+
+
 
 /* ************************************************************************
  *   R & D - meant for firmware developers
@@ -1426,6 +2567,223 @@
 //#define SW_DISPLAY_REG
 
 
+/*
+ *  Profiler for the probing cycle.
+ *  - measures the time spent in each stage of the probing cycle
+ *    (discharging, probe checks, capacitance measurement, output) and
+ *    in major sub-measurements (ESR, large/small caps, inductance)
+ *  - results of last cycle are returned by remote command PROF
+ *  - Timer2 runs free with a 1024 prescaler as time base
+ *    (resolution 128s at 8MHz, 64s at 16MHz)
+ *  - the overflow interrupt adds some jitter to time critical
+ *    measurements, so don't use this for production builds
+ *  - requires remote commands (UI_SERIAL_COMMANDS)
+ *  - uncomment to enable
+ */
+
+//#define SW_PROFILER
+
+
+/*
+ *  Streaming of R, C or L values via remote commands (MON_R, MON_C, MON_L)
+ *  - values are measured continuously on probes #1 and #3 and sent with
+ *    a time stamp (in ms) until the remote command STOP is received
+ *  - no display output while streaming
+ *  - Timer2 runs free with a 1024 prescaler as time base (see SW_PROFILER)
+ *  - requires remote commands (UI_SERIAL_COMMANDS)
+ *  - uncomment to enable
+ */
+
+//#define SW_STREAM
+
+
+/*
+ *  Streaming of raw ADC readings via remote command RAW
+ *  - sets up each probe (HiZ, Vcc, Gnd, pull-up/down via Rl or Rh) and
+ *    streams the raw readings of a probe as compact hex until the remote
+ *    command STOP is received
+ *  - meant for debugging fixtures and probe hardware
+ *  - increases the RX buffer for command arguments by 6 bytes
+ *  - requires remote commands (UI_SERIAL_COMMANDS)
+ *  - uncomment to enable
+ */
+
+//#define SW_RAW_STREAM
+
+
+/*
+ *  Binary frames for remote commands
+ *  - after the remote command BIN, the commands ALL, MON_x and BURST
+ *    send compact binary frames with raw values (value and scale) and a
+ *    CRC instead of formatted text, TXT switches back to text
+ *  - requires remote commands (UI_SERIAL_COMMANDS)
+ *  - uncomment to enable
+ */
+
+//#define SW_BIN_FRAMES
+
+
+/*
+ *  Burst probing via remote command BURST
+ *  - probes BURST_RUNS parts in a row without further commands, the
+ *    first one at once and each other after a part change (probes open,
+ *    then a new part connected)
+ *  - sends a record for each part as soon as it has been probed and
+ *    a completion message at the end
+ *  - can be canceled by CANCEL or a key press while waiting for a part
+ *  - requires remote commands (UI_SERIAL_COMMANDS)
+ *  - uncomment to enable
+ *  - runs: 1 - 255
+ */
+
+//#define SW_BURST
+#define BURST_RUNS            10        /* 10 parts */
+
+
+/*
+ *  Remote control of main menu tools via remote commands
+ *  - TOOL <item ID> runs a tool of the main menu, KEY <key> simulates
+ *    user feedback while the tool runs and STOP ends it
+ *  - some tools send their readings as records (like ALL) for each new
+ *    measurement: ESR tool, frequency counter, DS18B20 and RCL monitor
+ *  - requires remote commands (UI_SERIAL_COMMANDS) and hardware serial
+ *    (SERIAL_HARDWARE), since bit-bang RX needs Timer0 which is used
+ *    by some tools
+ *  - uncomment to enable
+ */
+
+//#define SW_REMOTE_TOOLS
+
+
+/*
+ *  System tick with software timers
+ *  - free running ms counter based on Timer2 (see SW_PROFILER)
+ *  - software timers with deadlines instead of counted delay loops
+ *  - TestKey() uses them for the feedback timeout and battery monitoring,
+ *    which makes both independent of the time spent for reading inputs
+ *  - the overflow interrupt adds some jitter to time critical measurements
+ *  - uncomment to enable
+ */
+
+//#define SYSTEM_TICK
+
+
+/*
+ *  Cooperative scheduler for background tasks
+ *  - battery monitoring, blinking cursor and auto-power-off run as
+ *    run-to-completion tasks driven by software timers while TestKey()
+ *    waits for user feedback
+ *  - requires system tick (SYSTEM_TICK)
+ *  - uncomment to enable
+ */
+
+//#define SYSTEM_TASKS
+
+
+/*
+ *  Input event queue for test push button
+ *  - the Timer2 overflow interrupt scans the test push button and queues
+ *    short and long key presses, so they aren't lost while the tester is
+ *    busy measuring
+ *  - TestKey() drains the queue, and tools can check it with Key_Get()
+ *    without blocking
+ *  - rotary encoder is covered by its pin change interrupt (ENCODER_PCINT)
+ *  - requires system tick (SYSTEM_TICK)
+ *  - uncomment to enable
+ */
+
+//#define INPUT_QUEUE
+
+
+/*
+ *  Power-down sleep while waiting for user feedback
+ *  - when TestKey() waits without timeout (e.g. auto-hold mode) the MCU
+ *    enters the power-down sleep mode and is woken up by pin change
+ *    interrupts of the test push button, the rotary encoder and the touch
+ *    screen
+ *  - the watchdog wakes the MCU up each second for battery monitoring
+ *    and auto-power-off
+ *  - not used with blinking cursor or part detection
+ *  - requires SAVE_POWER, PCINT for test push button (BUTTON_PCINT, see
+ *    config_<MCU>.h), ENCODER_PCINT for a rotary encoder and TOUCH_PCINT
+ *    for a touch screen
+ *  - not supported with increase/decrease push buttons, system tick
+ *    (SYSTEM_TICK), TTL serial RW (SERIAL_RW) or hardware TTL serial
+ *    (SERIAL_HARDWARE, power-down would stop the USART)
+ *  - uncomment to enable
+ */
+
+//#define UI_DEEP_SLEEP
+
+
+/*
+ *  Power-state statistics
+ *  - accumulates the time spent in idle and power save sleep modes by
+ *    MilliSleep() and the active time since power-on
+ *  - returned by remote command PWR
+ *  - requires SAVE_POWER, system tick (SYSTEM_TICK) and remote commands
+ *    (UI_SERIAL_COMMANDS)
+ *  - uncomment to enable
+ */
+
+//#define SW_POWER_STATS
+
+
+/*
+ *  Machine-readable selftest report
+ *  - remote command SELFTEST runs all selftest steps without waiting for
+ *    any user feedback and returns the measured values, the pass/fail
+ *    status and the duration of each step
+ *  - steps not matching the state of the probes are skipped: shorted
+ *    probes for the Rl/Rh tests, open probes for the leakage tests
+ *  - Timer2 runs free with a 1024 prescaler as time base (see SW_PROFILER)
+ *  - requires remote commands (UI_SERIAL_COMMANDS)
+ *  - uncomment to enable
+ */
+
+//#define SW_SELFTEST_REPORT
+
+
+/*
+ *  Stack high-water mark
+ *  - paints the free SRAM between static data and stack with a canary
+ *    pattern at startup and checks later how much of it was never touched
+ *  - reports static data, max. stack usage and min. free SRAM via menu
+ *    entry "Memory" and remote command MEM (UI_SERIAL_COMMANDS)
+ *  - uncomment to enable
+ */
+
+//#define SW_STACK_CHECK
+
+
+/*
+ *  Cycle benchmark of hot routines
+ *  - remote command BENCH runs ReadU(), LCD_Char(), Display_Value(),
+ *    FindCommand() and GetENormValue() with fixed inputs and returns the
+ *    MCU cycles per call
+ *  - LCD_Char() writes to the actual display
+ *  - Timer2 runs free with a 1024 prescaler as time base (see SW_PROFILER)
+ *  - requires remote commands (UI_SERIAL_COMMANDS)
+ *  - uncomment to enable
+ */
+
+//#define SW_CYCLE_BENCH
+
+
+/*
+ *  Performance counters
+ *  - global counters for ADC conversions, bytes sent via SPI and I2C
+ *    (displays and other bus devices), EEPROM writes and calls of the
+ *    ISRs for serial RX, Timer0, Timer1, Timer2 and pin changes
+ *  - menu entry "Counters" and remote command PERF (UI_SERIAL_COMMANDS)
+ *    show the counters and reset them
+ *  - adds a few MCU cycles to each counted event
+ *  - uncomment to enable
+ */
+
+//#define SW_PERF_COUNTERS
+
+
 
 /* ************************************************************************
  *   MCU specific setup to support different AVRs
@@ -1483,6 +2841,8 @@
  *  - hardware I2C (TWI) uses automatically the proper MCU pins
  *  - uncomment either I2C_BITBANG or I2C_HARDWARE to enable
  *  - uncomment one of the bus speed modes
+ *  - I2C_TWI_IRQ: interrupt driven job queue for hardware TWI, allows
+ *    I2C displays to send whole buffers in the background
  */
 
 //#define I2C_BITBANG                /* bit-bang I2C */
@@ -1490,6 +2850,7 @@
 //#define I2C_STANDARD_MODE          /* 100kHz bus speed */
 //#define I2C_FAST_MODE              /* 400kHz bus speed */
 //#define I2C_RW                     /* enable I2C read support (untested) */
+//#define I2C_TWI_IRQ                /* interrupt driven TWI (job queue) */
 
 
 /*
@@ -1520,6 +2881,67 @@
 //#define SERIAL_RW                  /* enable serial read support */
 
 
+/*
+ *  baud rate of bit-bang serial
+ *  - 9600: RX samples bits via Timer0, so RX is blocked while a tool
+ *    needs Timer0
+ *  - 19200, 38400 or 57600: no timer needed, cycle-exact delays for TX and
+ *    RX (RX samples a complete char within the pin change ISR)
+ *    interrupts are blocked for one char while sending or receiving
+ *  - 57600 with 8MHz MCU clock: host should add a small pause between
+ *    chars (e.g. 1 stop bit more), otherwise use 38400
+ */
+
+#define SERIAL_BITBANG_BAUD        9600
+
+
+/*
+ *  RX queue for remote commands
+ *  - buffers several commands sent back-to-back by the host
+ *  - commands are processed in order of reception
+ *  - hardware serial keeps RX running while probing
+ *  - number of queued commands: 2 - 8
+ *    ATmega 328: max. 2 (RAM), ATmega 644/1280: up to 8
+ *  - uses 11 bytes RAM per command (plus 3 bytes)
+ *  - requires SERIAL_RW
+ *  - uncomment to enable and adjust number of commands
+ */
+
+//#define SERIAL_RX_QUEUE       2
+
+/*
+ *  TX ring buffer for hardware serial
+ *  - sends data in background via USART Data Register Empty interrupt
+ *  - serial output doesn't stall measurements and display output anymore
+ *  - full buffer: waits for free space, no data is dropped
+ *  - requires SERIAL_HARDWARE
+ *  - uses 34 bytes RAM
+ *  - uncomment to enable
+ */
+
+//#define SERIAL_TX_BUFFER
+
+
+/*
+ *  Addressed multi-drop mode for hardware serial
+ *  - several testers share a single host port (TX lines connected
+ *    together, RX lines connected together)
+ *  - commands are prefixed with the tester's address: "<address>:<cmd>",
+ *    e.g. "3:TYPE", address 1-254, '*' for all testers (broadcast)
+ *  - lines without prefix are for the tester addressed last
+ *  - a tester only sends data after being addressed and stays silent
+ *    after a broadcast or a command for another tester
+ *  - TX pin is tri-stated (input with pull-up) while idle
+ *  - address is stored in EEPROM, remote command "ADDR <n>" changes it
+ *  - SERIAL_ADDRESS: default address
+ *  - requires SERIAL_HARDWARE, SERIAL_RW and UI_SERIAL_COMMANDS
+ *  - uncomment to enable
+ */
+
+//#define SERIAL_MULTIDROP
+#define SERIAL_ADDRESS        1     /* default address (1-254) */
+
+
 /*
  *  OneWire bus
  *  - for dedicated I/O pin please see ONEWIRE_PORT (config_<MCU>.h)
@@ -1530,6 +2952,19 @@
 //#define ONEWIRE_IO_PIN             /* via dedicated I/O pin */
 
 
+/*
+ *  OneWire: interrupt driven bit engine
+ *  - time slots are driven by Timer1 (CTC mode, ICF1 interrupt)
+ *  - other interrupts (e.g. serial) are processed between the timing
+ *    critical parts of the time slots
+ *  - ONEWIRE_OVERDRIVE: support for overdrive speed
+ *  - uncomment to enable
+ */
+
+//#define ONEWIRE_ASYNC
+//#define ONEWIRE_OVERDRIVE
+
+
 
 /* ************************************************************************
  *   ADC clock
@@ -1553,6 +2988,22 @@
 #endif
 
 
+/*
+ *  ADC clock for fast profile (ADC_CLOCK_PROFILES)
+ *  - The ADC clock is 1MHz by default.
+ *  - Resolution drops to about 8 bits.
+ *  - Special case for 20MHz MCU clock: 625kHz
+ */
+
+#if CPU_FREQ == 20000000
+  /* 20MHz MCU clock */
+  #define ADC_FREQ_FAST    625000
+#else
+  /* all other MCU clocks */
+  #define ADC_FREQ_FAST    1000000
+#endif
+
+
 
 /* ************************************************************************
  *   additional stuff supporting this configuration
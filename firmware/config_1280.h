@@ -37,6 +37,7 @@
 /*
  *  HD44780
  *  - 4 bit parallel interface
+ *  - optional busy flag polling: connect R/W and set LCD_RW and LCD_PIN
  *  - enable LCD_DB_STD when using port pins 0-3 for LCD_DB4/5/6/7
  */
 
@@ -54,6 +55,8 @@
 #define LCD_DB7          PB3            /* port pin used for DB7 */
 #define LCD_RS           PB4            /* port pin used for RS */
 #define LCD_EN1          PB5            /* port pin used for E */
+//#define LCD_RW           PB?            /* port pin used for R/W (optional) */
+//#define LCD_PIN          PINB           /* port input pins register (busy flag) */
 /* display settings */
 #define LCD_CHAR_X       16             /* characters per line */
 #define LCD_CHAR_Y       2              /* number of lines */
@@ -246,12 +249,14 @@
  *  - 8 bit parallel interface
  *  - LCD_DB0 to LCD_DB7 have to match port pins 0 to 7
  *  - ILI9488 untested
+ *  - LCD_ILI948X detects the controller at runtime (requires LCD_RD)
  */
 
 //#if 0
 //#define LCD_ILI9481                     /* display controller ILI9481 */
 #define LCD_ILI9486                     /* display controller ILI9486 */
 //#define LCD_ILI9488                     /* display controller ILI9488 */
+//#define LCD_ILI948X                     /* any of ILI9481/9486/9488 */
 #define LCD_GRAPHIC                     /* graphic display */
 #define LCD_COLOR                       /* color display */
 #define LCD_PAR_8                       /* 8 bit parallel interface */
@@ -664,6 +669,7 @@
 /*
  *  ST7036
  *  - 4 bit parallel interface
+ *  - optional busy flag polling: connect R/W and set LCD_RW and LCD_PIN
  *  - enable LCD_DB_STD when using port pins 0-3 for LCD_DB4/5/6/7
  *  - untested!!!
  */
@@ -683,6 +689,7 @@
 #define LCD_RS           PB4            /* port pin used for RS */
 #define LCD_EN           PB5            /* port pin used for E */
 //#define LCD_RW           ???            /* port pin used for R/W (optional) */
+//#define LCD_PIN          PINB           /* port input pins register (busy flag) */
 //#define LCD_RESET        ???            /* port pin used for XRESET (optional) */
 /* display settings */
 #define LCD_CHAR_X       16             /* characters per line */
@@ -1118,6 +1125,7 @@
 /*
  *  test push button
  *  - can't be same port as ADC_PORT or R_PORT
+ *  - port A has no pin change interrupts (no BUTTON_PCINT)
  */
 
 #define BUTTON_PORT      PORTA     /* port data register */
@@ -1158,6 +1166,7 @@
 #define COUNTER_PORT          PORTD     /* port data register */
 #define COUNTER_DDR           DDRD      /* port data direction register */
 #define COUNTER_IN            PD7       /* signal input T0 */
+#define COUNTER_PIN           PIND      /* port input pins register */
 
 /* control of extended frequency counter */
 #define COUNTER_CTRL_PORT     PORTD     /* port data register */ 
@@ -37,6 +37,7 @@
 /*
  *  HD44780
  *  - 4 bit parallel interface
+ *  - optional busy flag polling: connect R/W and set LCD_RW and LCD_PIN
  *  - if you change LCD_DB4/5/6/7 comment out LCD_DB_STD!
  */
 
@@ -54,6 +55,8 @@
 #define LCD_DB7          PD3            /* port pin used for DB7 */
 #define LCD_RS           PD4            /* port pin used for RS */
 #define LCD_EN1          PD5            /* port pin used for E */
+//#define LCD_RW           PD?            /* port pin used for R/W (optional) */
+//#define LCD_PIN          PIND           /* port input pins register (busy flag) */
 /* display settings */
 #define LCD_CHAR_X       16             /* characters per line */
 #define LCD_CHAR_Y       2              /* number of lines */
@@ -552,6 +555,7 @@
 /*
  *  ST7036
  *  - 4 bit parallel interface
+ *  - optional busy flag polling: connect R/W and set LCD_RW and LCD_PIN
  *  - enable LCD_DB_STD when using port pins 0-3 for LCD_DB4/5/6/7
  *  - untested!!!
  */
@@ -571,6 +575,7 @@
 #define LCD_RS           PD4            /* port pin used for RS */
 #define LCD_EN           PD5            /* port pin used for E */
 //#define LCD_RW           ???            /* port pin used for R/W (optional) */
+//#define LCD_PIN          PIND           /* port input pins register (busy flag) */
 //#define LCD_RESET        ???            /* port pin used for XRESET (optional) */
 /* display settings */
 #define LCD_CHAR_X       16             /* characters per line */
@@ -886,6 +891,7 @@
 #define TP1              PC0       /* test pin / probe #1 */
 #define TP2              PC1       /* test pin / probe #2 */
 #define TP3              PC2       /* test pin / probe #3 */
+#define ADC_PCINT        8         /* PCINT# for pin #0 of ADC port */
 
 #define TP_ZENER         PC3       /* test pin for for Zener check (10:1 voltage divider) */
 #define TP_REF           PC4       /* test pin for 2.5V reference and relay */
@@ -938,6 +944,7 @@
 #define BUTTON_DDR       DDRD      /* port data direction register */
 #define BUTTON_PIN       PIND      /* port input pins register */
 #define TEST_BUTTON      PD7       /* test/start push button (low active) */
+#define BUTTON_PCINT     16        /* PCINT# for pin #0 of button port (pin change interrupt) */
 
 
 /*
@@ -949,6 +956,7 @@
 #define ENCODER_PIN      PIND      /* port input pins register */
 #define ENCODER_A        PD3       /* rotary encoder A signal */
 #define ENCODER_B        PD2       /* rotary encoder B signal */
+//#define ENCODER_PCINT    16        /* PCINT# for pin #0 of encoder port (pin change interrupt) */
 
 
 /*
@@ -970,6 +978,7 @@
 #define COUNTER_PORT     PORTD     /* port data register */
 #define COUNTER_DDR      DDRD      /* port data direction register */
 #define COUNTER_IN       PD4       /* signal input T0 */
+#define COUNTER_PIN      PIND      /* port input pins register */
 
 
 /*
@@ -992,6 +1001,7 @@
 #define IR_DDR           DDRD      /* port data direction register */
 #define IR_PIN           PIND      /* port input pins register */
 #define IR_DATA          PD5       /* data signal */
+#define IR_PCINT         21        /* PCINT# for data pin */
 
 
 /*
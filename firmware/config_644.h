@@ -37,6 +37,7 @@
 /*
  *  HD44780
  *  - 4 bit parallel interface
+ *  - optional busy flag polling: connect R/W and set LCD_RW and LCD_PIN
  *  - enable LCD_DB_STD when using port pins 0-3 for LCD_DB4/5/6/7
  */
 
@@ -54,6 +55,8 @@
 #define LCD_DB7          PB7            /* port pin used for DB7 */
 #define LCD_RS           PB2            /* port pin used for RS */
 #define LCD_EN1          PB3            /* port pin used for E */
+//#define LCD_RW           PB?            /* port pin used for R/W (optional) */
+//#define LCD_PIN          PINB           /* port input pins register (busy flag) */
 /* display settings */
 #define LCD_CHAR_X       16             /* characters per line */
 #define LCD_CHAR_Y       2              /* number of lines */
@@ -195,12 +198,14 @@
  *  - 8 bit parallel interface
  *  - LCD_DB0 to LCD_DB7 have to match port pins 0 to 7
  *  - ILI9488 untested
+ *  - LCD_ILI948X detects the controller at runtime (requires LCD_RD)
  */
 
 #if 0
 //#define LCD_ILI9481                     /* display controller ILI9481 */
 #define LCD_ILI9486                     /* display controller ILI9486 */
 //#define LCD_ILI9488                     /* display controller ILI9488 */
+//#define LCD_ILI948X                     /* any of ILI9481/9486/9488 */
 #define LCD_GRAPHIC                     /* graphic display */
 #define LCD_COLOR                       /* color display */
 #define LCD_PAR_8                       /* 8 bit parallel interface */
@@ -613,6 +618,7 @@
 /*
  *  ST7036
  *  - 4 bit parallel interface
+ *  - optional busy flag polling: connect R/W and set LCD_RW and LCD_PIN
  *  - enable LCD_DB_STD when using port pins 0-3 for LCD_DB4/5/6/7
  *  - untested!!!
  */
@@ -632,6 +638,7 @@
 #define LCD_RS           PB2            /* port pin used for RS */
 #define LCD_EN           PB3            /* port pin used for E */
 //#define LCD_RW           ???            /* port pin used for R/W (optional) */
+//#define LCD_PIN          PINB           /* port input pins register (busy flag) */
 //#define LCD_RESET        ???            /* port pin used for XRESET (optional) */
 /* display settings */
 #define LCD_CHAR_X       16             /* characters per line */
@@ -944,6 +951,7 @@
 #define TOUCH_PIN        PINB      /* port input pins register */
 #define TOUCH_CS         PB0       /* port pin used for /CS */
 #define TOUCH_PEN        PB1       /* port pin used for /PENIRQ */
+//#define TOUCH_PCINT      9         /* PCINT# for /PENIRQ (pen interrupt) */
 //#define TOUCH_FLIP_X               /* enable horizontal flip */
 //#define TOUCH_FLIP_Y               /* enable vertical flip */
 //#define TOUCH_ROTATE               /* switch X and Y (rotate by 90) */
@@ -971,6 +979,7 @@
 #define TP1              PA0       /* test pin / probe #1 */
 #define TP2              PA1       /* test pin / probe #2 */
 #define TP3              PA2       /* test pin / probe #3 */
+#define ADC_PCINT        0         /* PCINT# for pin #0 of ADC port */
 
 #define TP_ZENER         PA3       /* test pin for for Zener check (10:1 voltage divider) */
 #define TP_REF           PA4       /* test pin for 2.5V reference and relay */
@@ -1024,6 +1033,7 @@
 #define BUTTON_DDR       DDRC      /* port data direction register */
 #define BUTTON_PIN       PINC      /* port input pins register */
 #define TEST_BUTTON      PC7       /* test/start push button (low active) */
+#define BUTTON_PCINT     16        /* PCINT# for pin #0 of button port (pin change interrupt) */
 
 
 /*
@@ -1035,6 +1045,7 @@
 #define ENCODER_PIN      PINC      /* port input pins register */
 #define ENCODER_A        PC3       /* rotary encoder A signal */
 #define ENCODER_B        PC4       /* rotary encoder B signal */
+//#define ENCODER_PCINT    16        /* PCINT# for pin #0 of encoder port (pin change interrupt) */
 
 
 /*
@@ -1058,6 +1069,7 @@
 #define COUNTER_PORT          PORTB     /* port data register */
 #define COUNTER_DDR           DDRB      /* port data direction register */
 #define COUNTER_IN            PB0       /* signal input T0 */
+#define COUNTER_PIN           PINB      /* port input pins register */
 
 /* control of extended frequency counter */
 #define COUNTER_CTRL_PORT     PORTC     /* port data register */ 
@@ -1098,6 +1110,7 @@
 #define IR_DDR           DDRC      /* port data direction register */
 #define IR_PIN           PINC      /* port input pins register */
 #define IR_DATA          PC2       /* data signal */
+#define IR_PCINT         18        /* PCINT# for data pin */
 
 
 /*
@@ -55,6 +55,47 @@
 #endif
 
 
+/*
+ *  define clock divider for fast profile
+ *  - 1MHz MCU clock: prescaler 2 (500kHz)
+ *  - ADC_DIV_FAST: prescaler value (to derive the sampling time)
+ */
+
+#if defined (ADC_CLOCK_PROFILES) || defined (SW_SCOPE) || defined (PHOTODIODE_TIMING)
+
+/* 1MHz/1MHz 2MHz/1MHz */
+#if CPU_FREQ / ADC_FREQ_FAST <= 2
+  #define ADC_CLOCK_DIV_FAST (1 << ADPS0)
+  #define ADC_DIV_FAST       2
+#endif
+
+/* 4MHz/1MHz */
+#if CPU_FREQ / ADC_FREQ_FAST == 4
+  #define ADC_CLOCK_DIV_FAST (1 << ADPS1)
+  #define ADC_DIV_FAST       4
+#endif
+
+/* 8MHz/1MHz */
+#if CPU_FREQ / ADC_FREQ_FAST == 8
+  #define ADC_CLOCK_DIV_FAST (1 << ADPS1) | (1 << ADPS0)
+  #define ADC_DIV_FAST       8
+#endif
+
+/* 16MHz/1MHz */
+#if CPU_FREQ / ADC_FREQ_FAST == 16
+  #define ADC_CLOCK_DIV_FAST (1 << ADPS2)
+  #define ADC_DIV_FAST       16
+#endif
+
+/* 20MHz/625kHz */
+#if CPU_FREQ / ADC_FREQ_FAST == 32
+  #define ADC_CLOCK_DIV_FAST (1 << ADPS2) | (1 << ADPS0)
+  #define ADC_DIV_FAST       32
+#endif
+
+#endif
+
+
 
 /* ************************************************************************
  *   derived values
@@ -101,6 +142,26 @@
 #endif
 
 
+/*
+ *  ILI948X: ILI9481, ILI9486 or ILI9488 detected at runtime
+ *  - handled by ILI9486 driver
+ */
+
+#ifdef LCD_ILI948X
+  /* requires 8 bit parallel interface with RDX */
+  #if ! defined (LCD_PAR_8) || ! defined (LCD_RD)
+    #error <<< ILI948X: requires 8 bit parallel interface and LCD_RD! >>>
+  #endif
+
+  /* select ILI9486 driver */
+  #undef LCD_ILI9481
+  #undef LCD_ILI9488
+  #ifndef LCD_ILI9486
+    #define LCD_ILI9486
+  #endif
+#endif
+
+
 /*
  *  check if more than one display module is enabled
  *  - does not work for enabling same display driver multiple times
@@ -286,6 +347,14 @@
 #undef DISPLAY_MULTI
 
 
+/* character displays with 4 bit parallel interface: busy flag polling */
+#if defined (LCD_HD44780) || defined (LCD_ST7036)
+  #if defined (LCD_PAR_4) && defined (LCD_RW) && defined (LCD_PIN)
+    #define LCD_BUSY_FLAG
+  #endif
+#endif
+
+
 
 /* ************************************************************************
  *   check touchscreen drivers
@@ -325,6 +394,8 @@
   /* read functions */
   #define DATA_read_byte(addr)     eeprom_read_byte(addr)
   #define DATA_read_word(addr)     eeprom_read_word(addr)
+  #define DATA_read_dword(addr)    eeprom_read_dword(addr)
+  #define DATA_read_block(dst, addr, n)      eeprom_read_block(dst, addr, n)
 #elif defined (DATA_FLASH)
   /* memory type Flash */
   #define MEM_TYPE            PROGMEM
@@ -332,6 +403,8 @@
   /* read functions */
   #define DATA_read_byte(addr)     pgm_read_byte(addr)
   #define DATA_read_word(addr)     pgm_read_word(addr)
+  #define DATA_read_dword(addr)    pgm_read_dword(addr)
+  #define DATA_read_block(dst, addr, n)      memcpy_P(dst, addr, n)
 #endif
 
 
@@ -348,6 +421,31 @@
 #endif
 
 
+/* hardware scrolling: supported controllers and orientations only */
+#ifdef UI_HW_SCROLL
+  #if ! defined (LCD_ILI9341) && ! defined (LCD_ILI9488)
+    #undef UI_HW_SCROLL
+  #elif defined (LCD_ROTATE) || defined (LCD_FLIP_Y)
+    #undef UI_HW_SCROLL
+  #endif
+#endif
+
+
+/* partial refresh of probing results: requires shadow grid */
+#ifdef UI_PARTIAL_REFRESH
+  #ifndef UI_SHADOW_GRID
+    #undef UI_PARTIAL_REFRESH
+  #endif
+#endif
+
+
+/* interrupt driven rotary encoder */
+#ifndef HW_ENCODER
+  #ifdef ENCODER_PCINT
+    #undef ENCODER_PCINT
+  #endif
+#endif
+
 /* additional keys */
 /* rotary encoder, increase/decrease push buttons or touch screen */
 #if defined (HW_ENCODER) || defined (HW_INCDEC_KEYS) | defined (HW_TOUCH)
@@ -373,6 +471,11 @@
     #undef SW_SQUAREWAVE
   #endif
 
+  /* DDS signal generator */
+  #ifdef SW_DDS
+    #undef SW_DDS
+  #endif
+
   /* Servo Check */
   #ifdef SW_SERVO
     #undef SW_SERVO
@@ -396,6 +499,14 @@
 #endif
 
 
+/* fused V_loss measurement requires V_loss */
+#ifndef SW_C_VLOSS
+  #ifdef C_VLOSS_FUSED
+    #undef C_VLOSS_FUSED
+  #endif
+#endif
+
+
 /* options which require inductance measurement */
 #ifndef SW_INDUCTOR
 
@@ -414,6 +525,55 @@
     #undef SW_MONITOR_RL
   #endif
 
+  /* median of timings */
+  #ifdef SW_L_MEDIAN
+    #undef SW_L_MEDIAN
+  #endif
+
+  /* noise canceler for input capture */
+  #ifdef L_NOISE_CANCEL
+    #undef L_NOISE_CANCEL
+  #endif
+
+#endif
+
+
+/* number of timings for median of inductance measurement */
+#ifdef SW_L_MEDIAN
+  #if (L_SAMPLES < 3) || (L_SAMPLES > 9)
+    #error <<< Inductor: L_SAMPLES out of range (3-9)! >>>
+  #endif
+#endif
+
+
+/* pipelined ESR measurement requires the new ESR measurement */
+#if defined (ESR_PIPELINED) && ! defined (SW_ESR)
+  #undef ESR_PIPELINED
+#endif
+
+/* number of pulse pairs for pipelined ESR measurement */
+#ifdef ESR_PIPELINED
+  #if (ESR_PULSES < 16) || (ESR_PULSES > 255)
+    #error <<< ESR: ESR_PULSES out of range (16-255)! >>>
+  #endif
+#endif
+
+/* fast mode of ESR tool requires the new ESR measurement */
+#ifdef ESR_TOOL_FAST
+  #if ! defined (SW_ESR) || ! defined (SW_ESR_TOOL)
+    #undef ESR_TOOL_FAST
+  #endif
+
+  /* relay would switch for each reading */
+  #ifdef HW_DISCHARGE_RELAY
+    #undef ESR_TOOL_FAST
+  #endif
+#endif
+
+#ifdef ESR_TOOL_FAST
+  #if (ESR_FAST_PULSES < 16) || (ESR_FAST_PULSES > 255)
+    #error <<< ESR: ESR_FAST_PULSES out of range (16-255)! >>>
+  #endif
 #endif
 
 
@@ -426,6 +586,23 @@
 #endif
 
 
+/* options which require interrupt driven ADC sampling */
+#ifndef ADC_INTERRUPT
+  /* ADC Noise Reduction sleep mode */
+  #ifdef ADC_NOISE_REDUCTION
+    #undef ADC_NOISE_REDUCTION
+  #endif
+#endif
+
+
+/* cached voltage references: number of probing cycles */
+#ifdef REF_CACHE
+  #if (REF_CACHE < 1) || (REF_CACHE > 50)
+    #error <<< REF_CACHE out of range (1-50)! >>>
+  #endif
+#endif
+
+
 /* buzzer type: either active or passive */
 #ifdef HW_BUZZER
   #if defined (BUZZER_ACTIVE) && defined (BUZZER_PASSIVE)
@@ -457,6 +634,16 @@
 
 #endif
 
+/* continuity check: comparator mode */
+#if defined (CONTINUITY_COMPARATOR) && ! defined (SW_CONTINUITY_CHECK)
+  #undef CONTINUITY_COMPARATOR
+#endif
+
+/* logic probe: pulse catcher */
+#if defined (LOGIC_PROBE_PULSE) && ! defined (HW_LOGIC_PROBE)
+  #undef LOGIC_PROBE_PULSE
+#endif
+
 
 /* options which require a MCU clock >= 8MHz */
 #if CPU_FREQ < 8000000
@@ -507,12 +694,32 @@
   #endif
 #endif
 
+/* SPI: repeated write for color displays (filling areas) */
+/* SPI: block write for color displays (bulk transfers) */
+#if defined (LCD_SPI) && ! defined (SPI_9)
+  #if defined (LCD_ILI9163) || defined (LCD_ILI9341) || defined (LCD_ST7735)
+    #define SPI_REPEAT
+    #define SPI_BLOCK
+  #endif
+  #if defined (LCD_ILI9481) || defined (LCD_ILI9486) || defined (LCD_ILI9488)
+    #define SPI_REPEAT
+  #endif
+#endif
+
 /* options which require SPI */
 #ifndef HW_SPI
   /* SPI read support */
   #ifdef SPI_RW
     #undef SPI_RW
   #endif
+  /* repeated write */
+  #ifdef SPI_REPEAT
+    #undef SPI_REPEAT
+  #endif
+  /* block write */
+  #ifdef SPI_BLOCK
+    #undef SPI_BLOCK
+  #endif
 #endif
 
 /* options which require SPI read support */
@@ -527,6 +734,13 @@
   #endif
 #endif
 
+/* thermocouple logging requires MAX6675 or MAX31855 */
+#if ! defined (HW_MAX6675) && ! defined (HW_MAX31855)
+  #ifdef THERMOCOUPLE_LOG
+    #undef THERMOCOUPLE_LOG
+  #endif
+#endif
+
 /* bit-bang SPI with read support requires SPI_PIN and SPI_MISO */
 #if defined (SPI_BITBANG) && defined (SPI_RW)
   #ifndef SPI_PIN
@@ -548,17 +762,80 @@
   #define HW_I2C
 #endif
 
+/* I2C: job queue requires hardware TWI */
+#if defined (I2C_TWI_IRQ) && ! defined (I2C_HARDWARE)
+  #undef I2C_TWI_IRQ
+#endif
+
+/* I2C scan tool requires I2C */
+#if defined (SW_I2C_SCAN) && ! defined (HW_I2C)
+  #undef SW_I2C_SCAN
+#endif
+
+/* external ADC ADS1115 requires I2C with read support */
+#ifdef HW_ADS1115
+  #if ! defined (HW_I2C) || ! defined (I2C_RW)
+    #undef HW_ADS1115
+  #endif
+#endif
+
+/* measurements using ADS1115 */
+#ifndef HW_ADS1115
+  #ifdef ADS1115_R_SMALL
+    #undef ADS1115_R_SMALL
+  #endif
+  #ifdef ADS1115_LEAKAGE
+    #undef ADS1115_LEAKAGE
+  #endif
+#endif
+
 
 /* TTL serial: either bit-bang or hardware */
 #if defined (SERIAL_BITBANG) && defined (SERIAL_HARDWARE)
   #error <<< Serial: select either bitbang or hardware serial interface! >>>
 #endif
 
+/* bit-bang serial: baud rate */
+#ifdef SERIAL_BITBANG
+  #ifndef SERIAL_BITBANG_BAUD
+    #define SERIAL_BITBANG_BAUD      9600
+  #endif
+  #if (SERIAL_BITBANG_BAUD != 9600) && (SERIAL_BITBANG_BAUD != 19200) && (SERIAL_BITBANG_BAUD != 38400) && (SERIAL_BITBANG_BAUD != 57600)
+    #error <<< Serial: bit-bang baud rate has to be 9600, 19200, 38400 or 57600! >>>
+  #endif
+  #if SERIAL_BITBANG_BAUD > 9600
+    /* timer-less bit-bang serial with cycle-exact delays */
+    #define SERIAL_BITBANG_FAST
+  #endif
+#endif
+
 /* TTL serial: common switch */
 #if defined (SERIAL_BITBANG) || defined (SERIAL_HARDWARE)
   #define HW_SERIAL
 #endif
 
+/* mirroring text output on VT100 terminal */
+#ifdef UI_SERIAL_MIRROR
+  /* requires TTL serial and a real display */
+  #if ! defined (HW_SERIAL) || defined (LCD_VT100)
+    #undef UI_SERIAL_MIRROR
+  #endif
+#endif
+
+/* mirror disables other options for serial interface */
+#ifdef UI_SERIAL_MIRROR
+  /* terminal can't follow hardware scrolling */
+  #ifdef UI_HW_SCROLL
+    #undef UI_HW_SCROLL
+  #endif
+  #ifdef UI_SERIAL_COPY
+    #undef UI_SERIAL_COPY
+  #endif
+  #ifdef UI_SERIAL_COMMANDS
+    #undef UI_SERIAL_COMMANDS
+  #endif
+#endif
+
 /* VT100 display driver disables other options for serial interface */
 #ifdef LCD_VT100
   #ifdef UI_SERIAL_COPY
@@ -589,6 +866,30 @@
   #endif
 #endif
 
+/* RX command queue requires TTL serial RW */
+#ifndef SERIAL_RW
+  #ifdef SERIAL_RX_QUEUE
+    #undef SERIAL_RX_QUEUE
+  #endif
+#endif
+
+/* RX command queue: size */
+#ifdef SERIAL_RX_QUEUE
+  #if (SERIAL_RX_QUEUE < 2) || (SERIAL_RX_QUEUE > 8)
+    #error <<< SERIAL_RX_QUEUE: 2 - 8 commands! >>>
+  #endif
+  #if (RES_RAM <= 2) && (SERIAL_RX_QUEUE > 2)
+    #error <<< SERIAL_RX_QUEUE: max. 2 commands for this MCU! >>>
+  #endif
+#endif
+
+/* TX ring buffer requires hardware serial */
+#ifndef SERIAL_HARDWARE
+  #ifdef SERIAL_TX_BUFFER
+    #undef SERIAL_TX_BUFFER
+  #endif
+#endif
+
 /* options which require TTL serial RW */
 #ifndef SERIAL_RW
   #ifdef UI_SERIAL_COMMANDS
@@ -596,6 +897,20 @@
   #endif
 #endif
 
+/* multi-drop mode requires hardware serial and remote commands */
+#ifdef SERIAL_MULTIDROP
+  #if ! defined (SERIAL_HARDWARE) || ! defined (UI_SERIAL_COMMANDS)
+    #undef SERIAL_MULTIDROP
+  #endif
+#endif
+
+/* multi-drop mode: address */
+#ifdef SERIAL_MULTIDROP
+  #if (SERIAL_ADDRESS < 1) || (SERIAL_ADDRESS > 254)
+    #error <<< SERIAL_ADDRESS: 1 - 254! >>>
+  #endif
+#endif
+
 
 /* OneWire */
 #if defined (ONEWIRE_PROBES) && defined (ONEWIRE_IO_PIN)
@@ -620,6 +935,18 @@
     #undef SW_ONEWIRE_SCAN
   #endif
 
+  /* bit engine */
+  #ifdef ONEWIRE_ASYNC
+    #undef ONEWIRE_ASYNC
+  #endif
+
+#endif
+
+/* OneWire overdrive speed requires bit engine */
+#ifdef ONEWIRE_OVERDRIVE
+  #ifndef ONEWIRE_ASYNC
+    #undef ONEWIRE_OVERDRIVE
+  #endif
 #endif
 
 
@@ -670,7 +997,45 @@
   #ifdef SW_R_E96_CC
     #undef SW_R_E96_CC
   #endif
+  #ifdef SW_R_E192_CC
+    #undef SW_R_E192_CC
+  #endif
+
+  /* scope */
+  #ifdef SW_SCOPE
+    #undef SW_SCOPE
+  #endif
+
+#endif
+
+
+/* scope: trace drawing supported only by ILI9341 and ST7735 */
+#if defined (SW_SCOPE)
+  #if ! defined (LCD_ILI9341) && ! defined (LCD_ST7735)
+    #undef SW_SCOPE
+  #endif
+#endif
+
+
+/* graph of monitors: supported only by ILI9341 and ST7735 */
+#if defined (UI_MONITOR_GRAPH)
+  #if ! defined (LCD_ILI9341) && ! defined (LCD_ST7735)
+    #undef UI_MONITOR_GRAPH
+  #endif
+#endif
+
+#ifdef UI_MONITOR_GRAPH
+  #if (GRAPH_SAMPLES != 16) && (GRAPH_SAMPLES != 32) && (GRAPH_SAMPLES != 64) && (GRAPH_SAMPLES != 128)
+    #error <<< GRAPH_SAMPLES: invalid number of samples! >>>
+  #endif
+#endif
 
+
+/* curve tracer: plot supported only by ILI9341 and ST7735 */
+#if defined (SW_CURVE_TRACER)
+  #if defined (LCD_ILI9341) || defined (LCD_ST7735)
+    #define FUNC_CURVE_PLOT
+  #endif
 #endif
 
 
@@ -729,6 +1094,85 @@
 #endif
 
 
+/* compressed symbols */
+#ifdef SYMBOLS_RLE
+  /* requires component symbols */
+  #ifndef SW_SYMBOLS
+    #undef SYMBOLS_RLE
+  /* and horizontally aligned symbol set */
+  #elif ! defined (SYMBOLS_24X24_H) && ! defined (SYMBOLS_24X24_OLD_H) && ! defined (SYMBOLS_24X24_ALT1_H) && ! defined (SYMBOLS_24X24_ALT2_H) && ! defined (SYMBOLS_24X24_HF) && ! defined (SYMBOLS_24X24_OLD_HF) && ! defined (SYMBOLS_24X24_ALT1_HF) && ! defined (SYMBOLS_24X24_ALT2_HF) && ! defined (SYMBOLS_30X32_HF) && ! defined (SYMBOLS_30X32_OLD_HF) && ! defined (SYMBOLS_30X32_ALT1_HF) && ! defined (SYMBOLS_30X32_ALT2_HF) && ! defined (SYMBOLS_32X32_HF) && ! defined (SYMBOLS_32X32_OLD_HF) && ! defined (SYMBOLS_32X32_ALT1_HF) && ! defined (SYMBOLS_32X32_ALT2_HF) && ! defined (SYMBOLS_32X39_HF)
+    #undef SYMBOLS_RLE
+  #endif
+#endif
+
+
+/* compressed fonts: only for large horizontally aligned fonts */
+#ifdef FONT_RLE
+  #if ! defined (FONT_10X16_HF) && ! defined (FONT_10X16_ISO8859_2_HF) && ! defined (FONT_12X16_HF) && ! defined (FONT_12X16_ISO8859_2_HF) && ! defined (FONT_16X26_HF) && ! defined (FONT_16X26_ISO8859_2_HF) && ! defined (FONT_16X26_WIN1251_HF)
+    #undef FONT_RLE
+  #endif
+#endif
+
+
+/* font cache: color displays with horizontally aligned fonts only */
+#ifdef FONT_CACHE
+  #if ! defined (LCD_ILI9163) && ! defined (LCD_ILI9341) && ! defined (LCD_ILI9481) && ! defined (LCD_ILI9486) && ! defined (LCD_ILI9488) && ! defined (LCD_ST7735) && ! defined (LCD_SEMI_ST7735)
+    #undef FONT_CACHE
+  #endif
+
+  /* ATmega 328: not enough RAM */
+  #if defined(__AVR_ATmega328__)
+    #undef FONT_CACHE
+  #endif
+#endif
+
+#ifdef UI_ENGLISH_2ND
+  /* English is already the primary language */
+  #ifdef UI_ENGLISH
+    #undef UI_ENGLISH_2ND
+  #endif
+
+  /* ATmega 328: not enough flash/EEPROM */
+  #if defined(__AVR_ATmega328__)
+    #undef UI_ENGLISH_2ND
+  #endif
+#endif
+
+#ifdef LCD_FRAMEBUFFER
+  #ifndef LCD_ST7565R
+    #undef LCD_FRAMEBUFFER
+  #endif
+
+  /* ATmega 328: not enough RAM */
+  #if defined(__AVR_ATmega328__)
+    #undef LCD_FRAMEBUFFER
+  #endif
+#endif
+
+#ifdef LCD_BATCH_UPDATE
+  #ifndef LCD_ST7920
+    #undef LCD_BATCH_UPDATE
+  #endif
+
+  /* not supported for rotated display */
+  #ifdef LCD_ROT180
+    #undef LCD_BATCH_UPDATE
+  #endif
+#endif
+
+#ifdef LCD_FAST_WRITE
+  /* 8 bit parallel bus only */
+  #ifndef LCD_PAR_8
+    #undef LCD_FAST_WRITE
+  #endif
+
+  /* supported display controllers */
+  #if ! defined (LCD_ILI9341) && ! defined (LCD_ILI9481) && ! defined (LCD_ILI9486) && ! defined (LCD_ILI9488)
+    #undef LCD_FAST_WRITE
+  #endif
+#endif
+
+
 /* additional component symbols */
 #if defined (UI_QUESTION_MARK) || defined (UI_ZENER_DIODE) || defined (UI_QUARTZ_CRYSTAL) || defined (UI_ONEWIRE)
   #ifndef SYMBOLS_EXTRA
@@ -778,6 +1222,17 @@
   #error <<< PWM: select either PWM generator with simple UI or fancy UI! >>>
 #endif
 
+/* PWM generator: frequency sweep */
+#if defined (PWM_SWEEP) && ! defined (SW_PWM_PLUS)
+  #undef PWM_SWEEP
+#endif
+
+#ifdef PWM_SWEEP
+  #if (PWM_SWEEP_STEPS < 2) || (PWM_SWEEP_STEPS > 32)
+    #error <<< PWM: PWM_SWEEP_STEPS out of range! >>>
+  #endif
+#endif
+
 
 /* frequency counter: can't have both variants */
 #if defined (HW_FREQ_COUNTER_BASIC) && defined (HW_FREQ_COUNTER_EXT)
@@ -789,6 +1244,38 @@
   #define HW_FREQ_COUNTER
 #endif
 
+/* frequency counter: reciprocal counting */
+#if defined (FREQ_COUNTER_RECIPROCAL) && ! defined (HW_FREQ_COUNTER)
+  #undef FREQ_COUNTER_RECIPROCAL
+#endif
+
+/* frequency counter: continuous gating */
+#if defined (FREQ_COUNTER_CONTINUOUS) && ! defined (HW_FREQ_COUNTER_BASIC)
+  #undef FREQ_COUNTER_CONTINUOUS
+#endif
+
+/* frequency counter: statistics */
+#if defined (FREQ_COUNTER_STATS) && ! defined (HW_FREQ_COUNTER)
+  #undef FREQ_COUNTER_STATS
+#endif
+
+#ifdef FREQ_COUNTER_STATS
+  #if (FREQ_STATS_WINDOW < 2) || (FREQ_STATS_WINDOW > 255)
+    #error <<< Counter: FREQ_STATS_WINDOW out of range! >>>
+  #endif
+#endif
+
+/* event counter: log mode */
+#if defined (EVENT_COUNTER_LOG) && ! defined (HW_EVENT_COUNTER)
+  #undef EVENT_COUNTER_LOG
+#endif
+
+#ifdef EVENT_COUNTER_LOG
+  #if (EVENT_LOG_SIZE < 2) || (EVENT_LOG_SIZE > 255)
+    #error <<< Event counter: EVENT_LOG_SIZE out of range! >>>
+  #endif
+#endif
+
 
 /* ring tester */
 #if defined (HW_RING_TESTER)
@@ -802,6 +1289,22 @@
   #endif
 #endif
 
+/* ring tester: averaging and pass/fail check */
+#if defined (RING_TESTER_AUTO) && ! defined (HW_RING_TESTER)
+  #undef RING_TESTER_AUTO
+#endif
+
+/* crystal ringdown test: requires frequency counter */
+#if defined (CRYSTAL_RINGDOWN) && ! defined (HW_FREQ_COUNTER)
+  #undef CRYSTAL_RINGDOWN
+#endif
+
+#ifdef CRYSTAL_RINGDOWN
+  #if (CRYSTAL_RING_LN < 10) || (CRYSTAL_RING_LN > 1000)
+    #error <<< Crystal ringdown: CRYSTAL_RING_LN out of range! >>>
+  #endif
+#endif
+
 
 /* IR detector/decoder: can't have probes and dedicated pin */
 #if defined (SW_IR_RECEIVER) && defined (HW_IR_RECEIVER)
@@ -817,6 +1320,97 @@
 #endif
 
 
+/* timer driven IR sender: replaces delay loops */
+#ifdef SW_IR_TX_TIMER
+  #ifndef SW_IR_TRANSMITTER
+    #undef SW_IR_TX_TIMER
+  #endif
+#endif
+
+#ifdef SW_IR_TX_TIMER
+  #ifdef SW_IR_TX_ALTDELAY
+    #undef SW_IR_TX_ALTDELAY
+  #endif
+  #if defined (SERIAL_BITBANG) && defined (SERIAL_RW) && ! defined (SERIAL_BITBANG_FAST)
+    /* shared OCR0B interrupt: dispatch by Timer0's owner */
+    #define TIMER_MANAGER
+  #endif
+#endif
+
+
+/* IR learn & replay: requires IR detector and IR sender */
+#ifdef SW_IR_LEARN
+  #if ! defined (SW_IR_RECEIVER) && ! defined (HW_IR_RECEIVER)
+    #undef SW_IR_LEARN
+  #elif ! defined (SW_IR_TRANSMITTER)
+    #undef SW_IR_LEARN
+  #endif
+#endif
+
+#ifdef SW_IR_LEARN
+  #if (IR_LEARN_SLOTS < 1) || (IR_LEARN_SLOTS > 4)
+    #error <<< IR learn: IR_LEARN_SLOTS out of range! >>>
+  #endif
+#endif
+
+
+/* IR detector/decoder: edge capture requires PCINT for data pin */
+#ifdef SW_IR_RX_PCINT
+  #if defined (SW_IR_RECEIVER) && ! defined (ADC_PCINT)
+    #undef SW_IR_RX_PCINT
+  #elif defined (HW_IR_RECEIVER) && ! defined (IR_PCINT)
+    #undef SW_IR_RX_PCINT
+  #elif ! defined (SW_IR_RECEIVER) && ! defined (HW_IR_RECEIVER)
+    #undef SW_IR_RX_PCINT
+  #endif
+#endif
+
+
+/* IR detector/decoder: carrier measurement requires counter input */
+#ifdef SW_IR_RX_CARRIER
+  #if ! defined (SW_IR_RECEIVER) && ! defined (HW_IR_RECEIVER)
+    #undef SW_IR_RX_CARRIER
+  #elif ! defined (HW_FREQ_COUNTER_BASIC) || defined (SW_IR_RX_PCINT)
+    #undef SW_IR_RX_CARRIER
+  #endif
+#endif
+
+
+/* multiple DS18B20 sensors require DS18B20 support */
+#ifdef DS18B20_MULTI
+  #ifndef SW_DS18B20
+    #undef DS18B20_MULTI
+  #endif
+#endif
+
+#ifdef DS18B20_MULTI
+  #if (DS18B20_MULTI < 2) || (DS18B20_MULTI > 8)
+    #error <<< DS18B20_MULTI: invalid number of sensors! >>>
+  #endif
+#endif
+
+/* ROM code cache requires multiple DS18B20 sensors */
+#ifdef DS18B20_ROM_CACHE
+  #ifndef DS18B20_MULTI
+    #undef DS18B20_ROM_CACHE
+  #endif
+#endif
+
+
+/* DS18B20 resolution requires DS18B20 support */
+#ifdef DS18B20_RESOLUTION
+  #ifndef SW_DS18B20
+    #undef DS18B20_RESOLUTION
+  #endif
+#endif
+
+#ifdef DS18B20_RESOLUTION
+  #if (DS18B20_RESOLUTION < 9) || (DS18B20_RESOLUTION > 12)
+    #error <<< DS18B20_RESOLUTION: invalid number of bits! >>>
+  #endif
+#endif
+
+
 /* rounding for DS18B20 requires DS18B20 support */
 #ifdef UI_ROUND_DS18B20
   #ifndef SW_DS18B20
@@ -847,6 +1441,30 @@
 #endif
 
 
+/* Servo Check: auto test */
+#if defined (SERVO_AUTO_TEST) && ! defined (SW_SERVO)
+  #undef SERVO_AUTO_TEST
+#endif
+
+
+/* cap leakage check: curve capture */
+#if defined (CAP_LEAK_PREDICT) && ! defined (SW_CAP_LEAKAGE)
+  #undef CAP_LEAK_PREDICT
+#endif
+
+
+/* opto coupler check: CTR sweep */
+#if defined (OPTO_CTR_SWEEP) && ! defined (SW_OPTO_COUPLER)
+  #undef OPTO_CTR_SWEEP
+#endif
+
+
+/* Zener check: auto hold requires Zener tool in switched mode */
+#if defined (ZENER_AUTO_HOLD) && ! (defined (HW_ZENER) && defined (ZENER_SWITCHED))
+  #undef ZENER_AUTO_HOLD
+#endif
+
+
 /* Zener check during normal probing requires unswitched or switched mode */
 #ifdef HW_PROBE_ZENER
   #if ! defined (ZENER_UNSWITCHED) && ! defined (ZENER_SWITCHED)
@@ -854,6 +1472,11 @@
   #endif
 #endif
 
+/* quick Zener check requires Zener check during normal probing in switched mode */
+#if defined (ZENER_QUICK_CHECK) && ! (defined (HW_PROBE_ZENER) && defined (ZENER_SWITCHED))
+  #undef ZENER_QUICK_CHECK
+#endif
+
 
 /* read functions for display require bus with read support enabled */
 #ifdef LCD_READ
@@ -884,6 +1507,153 @@
   #endif
 #endif
 
+/* probing profiler requires remote commands */
+#ifdef SW_PROFILER
+  #ifndef UI_SERIAL_COMMANDS
+    #undef SW_PROFILER
+  #endif
+#endif
+
+/* data logger requires system tick and serial output */
+#ifdef SW_LOGGER
+  #if ! defined (SYSTEM_TICK) || (! defined (UI_SERIAL_COPY) && ! defined (UI_SERIAL_COMMANDS))
+    #undef SW_LOGGER
+  #endif
+#endif
+
+/* streaming requires remote commands */
+#ifdef SW_STREAM
+  #ifndef UI_SERIAL_COMMANDS
+    #undef SW_STREAM
+  #endif
+#endif
+
+/* binary frames require remote commands */
+#ifdef SW_BIN_FRAMES
+  #ifndef UI_SERIAL_COMMANDS
+    #undef SW_BIN_FRAMES
+  #endif
+#endif
+
+/* raw ADC streaming requires remote commands */
+#ifdef SW_RAW_STREAM
+  #ifndef UI_SERIAL_COMMANDS
+    #undef SW_RAW_STREAM
+  #endif
+#endif
+
+/* burst probing requires remote commands */
+#ifdef SW_BURST
+  #ifndef UI_SERIAL_COMMANDS
+    #undef SW_BURST
+  #endif
+#endif
+
+#ifdef SW_BURST
+  #if (BURST_RUNS < 1) || (BURST_RUNS > 255)
+    #error <<< BURST_RUNS out of range! >>>
+  #endif
+#endif
+
+/* remote tools require remote commands and hardware serial */
+#ifdef SW_REMOTE_TOOLS
+  #if ! defined (UI_SERIAL_COMMANDS) || ! defined (SERIAL_HARDWARE)
+    #undef SW_REMOTE_TOOLS
+  #endif
+#endif
+
+/* fractional squarewave: Timer1 overflow ISR used by reciprocal counting */
+#ifdef SQUAREWAVE_FRACTIONAL
+  #if ! defined (SW_SQUAREWAVE) || defined (FREQ_COUNTER_RECIPROCAL)
+    #undef SQUAREWAVE_FRACTIONAL
+  #endif
+#endif
+
+/* part detection: discharge relay shorts probes while waiting */
+#ifdef UI_PART_DETECT
+  #ifdef HW_DISCHARGE_RELAY
+    #undef UI_PART_DETECT
+  #endif
+#endif
+
+#ifdef UI_PART_DETECT
+  #if (PART_POLL < 10) || (PART_POLL > 500)
+    #error <<< PART_POLL out of range! >>>
+  #endif
+#endif
+
+/* quick check for a connected part */
+#if defined (SW_BURST) || defined (UI_PART_DETECT)
+  #ifndef FUNC_PART_PRESENT
+    #define FUNC_PART_PRESENT
+  #endif
+#endif
+
+/* cycle benchmark requires remote commands */
+#ifdef SW_CYCLE_BENCH
+  #ifndef UI_SERIAL_COMMANDS
+    #undef SW_CYCLE_BENCH
+  #endif
+#endif
+
+/* selftest report requires remote commands */
+#ifdef SW_SELFTEST_REPORT
+  #ifndef UI_SERIAL_COMMANDS
+    #undef SW_SELFTEST_REPORT
+  #endif
+#endif
+
+/* power-state statistics require sleep modes, system tick and remote commands */
+#ifdef SW_POWER_STATS
+  #if ! defined (SAVE_POWER) || ! defined (SYSTEM_TICK) || ! defined (UI_SERIAL_COMMANDS)
+    #undef SW_POWER_STATS
+  #endif
+#endif
+
+/* background tasks require system tick */
+#ifdef SYSTEM_TASKS
+  #ifndef SYSTEM_TICK
+    #undef SYSTEM_TASKS
+  #endif
+#endif
+
+/* background battery monitoring requires background tasks and battery */
+#if defined (BAT_BACKGROUND)
+  #if ! defined (SYSTEM_TASKS) || defined (BAT_NONE)
+    #undef BAT_BACKGROUND
+  #endif
+#endif
+
+/* drift check of fixed cap requires fixed cap and background tasks */
+#ifdef ADJUST_CAP_DRIFT
+  #if ! defined (HW_ADJUST_CAP) || ! defined (SYSTEM_TASKS)
+    #undef ADJUST_CAP_DRIFT
+  #endif
+#endif
+
+/* input event queue requires system tick */
+#ifdef INPUT_QUEUE
+  #ifndef SYSTEM_TICK
+    #undef INPUT_QUEUE
+  #endif
+#endif
+
+/* power-down sleep: all inputs have to wake up the MCU */
+#ifdef UI_DEEP_SLEEP
+  #if ! defined (SAVE_POWER) || ! defined (BUTTON_PCINT)
+    #undef UI_DEEP_SLEEP
+  #elif defined (HW_ENCODER) && ! defined (ENCODER_PCINT)
+    #undef UI_DEEP_SLEEP
+  #elif defined (HW_TOUCH) && ! defined (TOUCH_PCINT)
+    #undef UI_DEEP_SLEEP
+  #elif defined (HW_INCDEC_KEYS) || defined (SYSTEM_TICK) || defined (SERIAL_RW)
+    #undef UI_DEEP_SLEEP
+  #elif defined (SERIAL_HARDWARE)
+    /* USART needs clk_IO for sending (see Serial_Setup()) */
+    #undef UI_DEEP_SLEEP
+  #endif
+#endif
+
 
 
 /* ************************************************************************
@@ -891,8 +1661,14 @@
  * ************************************************************************ */
 
 
+/* comparator edge detection */
+#if defined (CONTINUITY_COMPARATOR) || defined (LOGIC_PROBE_PULSE)
+  #define FUNC_COMP_EDGE
+#endif
+
+
 /* ProbePinout() */
-#if defined (SW_PWM_SIMPLE) || defined (SW_PWM_PLUS) || defined (SW_SQUAREWAVE) || defined (SW_SERVO)
+#if defined (SW_PWM_SIMPLE) || defined (SW_PWM_PLUS) || defined (SW_SQUAREWAVE) || defined (SW_SERVO) || defined (SW_DDS)
   #ifndef FUNC_PROBE_PINOUT
     #define FUNC_PROBE_PINOUT
   #endif
@@ -904,12 +1680,33 @@
   #endif
 #endif
 
-#if defined (SW_MONITOR_R) || defined (SW_MONITOR_C) || defined (SW_MONITOR_L) || defined(SW_MONITOR_RCL) || defined(SW_MONITOR_RL)
+#if defined (SW_MONITOR_R) || defined (SW_MONITOR_C) || defined (SW_MONITOR_L) || defined(SW_MONITOR_RCL) || defined(SW_MONITOR_RL) || defined (SW_SORTING)
+  #ifndef FUNC_PROBE_PINOUT
+    #define FUNC_PROBE_PINOUT
+  #endif
+#endif
+
+#ifdef SW_LED_BINNING
   #ifndef FUNC_PROBE_PINOUT
     #define FUNC_PROBE_PINOUT
   #endif
 #endif
 
+
+/* Check_LED() */
+#if defined (SW_OPTO_COUPLER) || defined (SW_LED_BINNING)
+  #ifndef FUNC_CHECK_LED
+    #define FUNC_CHECK_LED
+  #endif
+#endif
+
+/* remote commands with arguments */
+#if defined (SW_RAW_STREAM) || defined (SERIAL_MULTIDROP) || defined (SW_REMOTE_TOOLS)
+  #ifndef FUNC_CMD_ARGS
+    #define FUNC_CMD_ARGS
+  #endif
+#endif
+
 #if defined (HW_RING_TESTER) && defined (RING_TESTER_PROBES)
   #ifndef FUNC_PROBE_PINOUT
     #define FUNC_PROBE_PINOUT
@@ -922,6 +1719,63 @@
   #endif
 #endif
 
+/* photodiode check: response time */
+#if defined (PHOTODIODE_TIMING) && ! defined (SW_PHOTODIODE)
+  #undef PHOTODIODE_TIMING
+#endif
+
+
+/* DHTxx: edge capture requires PCINT for probes */
+#ifdef SW_DHTXX_PCINT
+  #ifndef SW_DHTXX
+    #undef SW_DHTXX_PCINT
+  #elif ! defined (ADC_PCINT)
+    #undef SW_DHTXX_PCINT
+  #endif
+#endif
+
+
+/* rotary encoder check: edge capture requires PCINT for probes */
+#ifdef ENCODER_STATS
+  #ifndef SW_ENCODER
+    #undef ENCODER_STATS
+  #elif ! defined (ADC_PCINT)
+    #undef ENCODER_STATS
+  #endif
+#endif
+
+
+/* scratch arena for tool-exclusive buffers */
+#if defined (SW_IR_RX_PCINT) || defined (SW_IR_TX_TIMER) || defined (SW_DHTXX_PCINT) || defined (SW_DDS) || defined (ENCODER_STATS)
+  #ifndef FUNC_SCRATCH
+    #define FUNC_SCRATCH
+  #endif
+#endif
+
+
+/* s time stamp (Timer1) */
+#if defined (SW_DHTXX) || defined (SW_IR_RX_PCINT) || defined (SW_IR_RX_CARRIER) || defined (SW_I2C_SCAN) || defined (ENCODER_STATS)
+  #ifndef FUNC_TIMESTAMP
+    #define FUNC_TIMESTAMP
+  #endif
+#endif
+
+
+/* deferred display output */
+#if defined (LCD_FRAMEBUFFER) || defined (LCD_BATCH_UPDATE)
+  #ifndef FUNC_LCD_FLUSH
+    #define FUNC_LCD_FLUSH
+  #endif
+#endif
+
+
+/* free running time base (Timer2) */
+#if defined (SW_PROFILER) || defined (SW_STREAM) || defined (SYSTEM_TICK) || defined (SW_DISPLAY_BENCH) || defined (THERMOCOUPLE_LOG) || defined (SW_SELFTEST_REPORT) || defined (SW_CYCLE_BENCH) || defined (LOGIC_PROBE_PULSE)
+  #ifndef FUNC_TIMEBASE
+    #define FUNC_TIMEBASE
+  #endif
+#endif
+
 
 /* E6 norm values */
 #if defined (SW_C_E6_T) || defined (SW_L_E6_T)
@@ -943,9 +1797,14 @@
   #define SW_E96
 #endif
 
+/* E192 norm values (includes E96) */
+#if defined (SW_R_E192_T) || defined (SW_R_E192_CC)
+  #define SW_E192
+#endif
+
 
 /* Show_ENormValues(), Display_EValue() */
-#if defined (SW_R_E24_5_T) || defined (SW_R_E24_1_T) || defined (SW_R_E96_T)
+#if defined (SW_R_E24_5_T) || defined (SW_R_E24_1_T) || defined (SW_R_E96_T) || defined (SW_R_E192_T)
   #ifndef FUNC_EVALUE
     #define FUNC_EVALUE
   #endif
@@ -962,7 +1821,7 @@
 
 
 /* Show_ENormCodes(), Display_ColorCode() */
-#if defined (SW_R_E24_5_CC) || defined (SW_R_E24_1_CC) || defined (SW_R_E96_CC)
+#if defined (SW_R_E24_5_CC) || defined (SW_R_E24_1_CC) || defined (SW_R_E96_CC) || defined (SW_R_E192_CC)
   #ifndef FUNC_COLORCODE
     #define FUNC_COLORCODE
   #endif
@@ -992,7 +1851,7 @@
 
 
 /* Display_FullValue() */
-#if defined (SW_SQUAREWAVE) || defined (SW_PWM_PLUS) || defined (HW_FREQ_COUNTER_EXT) || defined (SW_SERVO)
+#if defined (SW_SQUAREWAVE) || defined (SW_PWM_PLUS) || defined (HW_FREQ_COUNTER_EXT) || defined (SW_SERVO) || defined (FREQ_COUNTER_RECIPROCAL)
   #ifndef FUNC_DISPLAY_FULLVALUE
     #define FUNC_DISPLAY_FULLVALUE
   #endif
@@ -1010,9 +1869,27 @@
   #endif
 #endif
 
+#if defined (SW_STREAM) || defined (FREQ_COUNTER_STATS) || defined (SW_DDS) || defined (SW_HISTORY)
+  #ifndef FUNC_DISPLAY_FULLVALUE
+    #define FUNC_DISPLAY_FULLVALUE
+  #endif
+#endif
+
+#if defined (SW_LOGGER) || defined (SW_SELFTEST_REPORT) || defined (SW_STACK_CHECK) || defined (SW_CYCLE_BENCH) || defined (SW_PERF_COUNTERS)
+  #ifndef FUNC_DISPLAY_FULLVALUE
+    #define FUNC_DISPLAY_FULLVALUE
+  #endif
+#endif
+
+#if defined (ENCODER_STATS) || defined (SERIAL_MULTIDROP)
+  #ifndef FUNC_DISPLAY_FULLVALUE
+    #define FUNC_DISPLAY_FULLVALUE
+  #endif
+#endif
+
 
 /* Display_SignedFullValue() */
-#if defined (SW_DS18B20) || defined (SW_DS18S20) || defined (SW_DHTXX) || defined (HW_MAX31855)
+#if defined (SW_DS18B20) || defined (SW_DS18S20) || defined (SW_DHTXX) || defined (HW_MAX31855) || defined (THERMOCOUPLE_LOG) || defined (SW_LOGGER) || defined (SW_SELFTEST_REPORT)
   #ifndef FUNC_DISPLAY_SIGNEDFULLVALUE
     #define FUNC_DISPLAY_SIGNEDFULLVALUE
   #endif
@@ -1020,7 +1897,7 @@
 
 
 /* Display_HexByte() */
-#if defined (SW_IR_RECEIVER) || defined (HW_IR_RECEIVER) || defined (ONEWIRE_READ_ROM) || defined (SW_ONEWIRE_SCAN)
+#if defined (SW_IR_RECEIVER) || defined (HW_IR_RECEIVER) || defined (ONEWIRE_READ_ROM) || defined (SW_ONEWIRE_SCAN) || defined (DS18B20_MULTI) || defined (SW_I2C_SCAN)
   #ifndef FUNC_DISPLAY_HEXBYTE
     #define FUNC_DISPLAY_HEXBYTE
   #endif
@@ -1034,7 +1911,7 @@
 
 
 /* Display_HexValue() */
-#if defined (SW_IR_TRANSMITTER) || defined (SW_DISPLAY_ID)
+#if defined (SW_IR_TRANSMITTER) || defined (SW_DISPLAY_ID) || defined (SW_RAW_STREAM)
   #ifndef FUNC_DISPLAY_HEXVALUE
     #define FUNC_DISPLAY_HEXVALUE
   #endif
@@ -1059,6 +1936,54 @@
 #endif
 
 
+/* targeted measurement of compare tool */
+#if defined (SW_COMPARE) || defined (SW_MATCHING)
+  #ifndef FUNC_COMPARE
+    #define FUNC_COMPARE
+  #endif
+#endif
+
+
+/* matching tool: number of parts */
+#ifdef SW_MATCHING
+  #if (MATCH_PARTS < 4) || (MATCH_PARTS > 16)
+    #error <<< MATCH_PARTS: invalid number of parts! >>>
+  #endif
+#endif
+
+
+/* history: number of records */
+#ifdef SW_HISTORY
+  #if (HISTORY_SIZE < 2) || (HISTORY_SIZE > 255)
+    #error <<< HISTORY_SIZE out of range! >>>
+  #endif
+#endif
+
+
+/* repeat measurement: number of runs */
+#ifdef SW_REPEAT_STATS
+  #if (REPEAT_RUNS < 2) || (REPEAT_RUNS > 100)
+    #error <<< REPEAT_RUNS out of range! >>>
+  #endif
+#endif
+
+
+/* Stats_Sqrt() */
+#if defined (FREQ_COUNTER_STATS) || defined (SW_REPEAT_STATS)
+  #ifndef FUNC_STATS_SQRT
+    #define FUNC_STATS_SQRT
+  #endif
+#endif
+
+
+/* range memory for MeasureCap() */
+#if defined (SW_MONITOR_C) || defined (SW_MONITOR_RCL) || defined (SW_STREAM) || defined (SW_LOGGER)
+  #ifndef FUNC_CAP_RANGE
+    #define FUNC_CAP_RANGE
+  #endif
+#endif
+
+
 /* variable Start_str */
 #if defined (SW_OPTO_COUPLER) || defined (HW_EVENT_COUNTER) || defined (SW_DS18B20) || defined (SW_DS18S20) || defined (SW_ONEWIRE_SCAN)
   #ifndef VAR_START_STR
@@ -1066,7 +1991,7 @@
   #endif
 #endif
 
-#if defined (SW_DHTXX) || defined (HW_MAX6675) || defined (HW_MAX31855)
+#if defined (SW_DHTXX) || defined (HW_MAX6675) || defined (HW_MAX31855) || defined (SW_I2C_SCAN)
   #ifndef VAR_START_STR
     #define VAR_START_STR
   #endif
@@ -27,6 +27,870 @@
 
 
 
+/* ************************************************************************
+ *   mirror of text output on VT100 terminal
+ * ************************************************************************ */
+
+
+#ifdef UI_SERIAL_MIRROR
+
+/*
+ *  The text output to the display is mirrored on a VT100 terminal
+ *  connected to the TTL serial interface. Both output sinks get the
+ *  same characters at the same positions. Outside of display.c the LCD
+ *  output functions are mapped to the mirror functions (see functions.h).
+ *  - terminal's cursor is moved only when needed
+ *  - graphics (symbols, boxes etc.) and colors aren't mirrored
+ */
+
+/*
+ *  local constants
+ */
+
+#define MIRROR_ESCAPE         0x1b      /* escape character */
+
+
+/*
+ *  local variables
+ */
+
+/* terminal's cursor position (0 = unknown) */
+uint8_t             MirrorPos_X = 0;    /* x position */
+uint8_t             MirrorPos_Y = 0;    /* y position */
+
+
+
+/*
+ *  send start of control sequence: Esc[
+ */
+
+void Mirror_Escape(void)
+{
+  Serial_WriteByte(MIRROR_ESCAPE);      /* send: escape */
+  Serial_WriteByte('[');                /* send: [ */
+}
+
+
+
+/*
+ *  send number as decimal string
+ *
+ *  requires:
+ *  - number (0-255)
+ */
+
+void Mirror_Number(uint8_t Number)
+{
+  uint8_t           Digit;         /* decimal digit */
+
+  if (Number >= 100)               /* 3 digits */
+  {
+    Digit = Number / 100;          /* get first digit */
+    Number -= Digit * 100;         /* update value */
+    Serial_WriteByte('0' + Digit);      /* send digit */
+    Digit = 1;                     /* force next digit */
+  }
+  else
+  {
+    Digit = 0;
+  }
+
+  if ((Number >= 10) || Digit)     /* 2 digits */
+  {
+    Digit = Number / 10;           /* get first digit */
+    Number -= Digit * 10;          /* update value */
+    Serial_WriteByte('0' + Digit);      /* send digit */
+  }
+
+  Serial_WriteByte('0' + Number);       /* send last digit */
+}
+
+
+
+/*
+ *  move terminal's cursor to character position
+ *  - sends escape sequence only if cursor isn't there already
+ *
+ *  requires:
+ *  - x: character position (1-)
+ *  - y: line number (1-)
+ */
+
+void Mirror_Cursor(uint8_t x, uint8_t y)
+{
+  if ((x == MirrorPos_X) && (y == MirrorPos_Y))   /* already there */
+  {
+    return;                        /* nothing to do */
+  }
+
+  Mirror_Escape();                 /* send: Esc[ */
+
+  if ((y == MirrorPos_Y) && (x > MirrorPos_X) && (MirrorPos_X > 0))
+  {
+    /* move cursor forward: Esc[<n>C */
+    Mirror_Number(x - MirrorPos_X);     /* send number of columns */
+    Serial_WriteByte('C');              /* send: C */
+  }
+  else
+  {
+    /* move cursor to screen location x,y: Esc[<y>;<x>H */
+    Mirror_Number(y);                   /* send y pos */
+    Serial_WriteByte(';');              /* send: ; */
+    Mirror_Number(x);                   /* send x pos */
+    Serial_WriteByte('H');              /* send: H */
+  }
+
+  /* update cursor position */
+  MirrorPos_X = x;
+  MirrorPos_Y = y;
+}
+
+
+
+/*
+ *  display a single character on both output sinks
+ *  - replaces LCD_Char()
+ *
+ *  requires:
+ *  - Char: character to display
+ */
+
+void Mirror_Char(unsigned char Char)
+{
+  uint8_t           x;             /* x position */
+  uint8_t           y;             /* y position */
+
+  x = UI.CharPos_X;
+  y = UI.CharPos_Y;
+
+  LCD_Char(Char);                  /* display char */
+
+  if (x > UI.CharMax_X) return;    /* beyond right margin */
+
+  Mirror_Cursor(x, y);             /* move terminal's cursor */
+  Serial_Char(Char);               /* send char */
+
+  /* terminal's cursor moves also, but might stop at the right margin */
+  if (x < UI.CharMax_X) MirrorPos_X++;
+  else MirrorPos_X = 0;            /* unknown */
+}
+
+
+
+/*
+ *  clear one single character line on both output sinks
+ *  - replaces LCD_ClearLine()
+ *
+ *  requires:
+ *  - Line: line number (1-)
+ *    special case line 0: clear remaining space in current line
+ */
+
+void Mirror_ClearLine(uint8_t Line)
+{
+  uint8_t           x = 1;         /* x position */
+  uint8_t           y;             /* y position */
+
+  y = Line;
+  if (Line == 0)                   /* special case: rest of current line */
+  {
+    x = UI.CharPos_X;              /* get current character position */
+    y = UI.CharPos_Y;              /* get current line */
+  }
+
+  LCD_ClearLine(Line);             /* clear line on display */
+
+  if (x > UI.CharMax_X) return;    /* beyond right margin */
+
+  Mirror_Cursor(x, y);             /* move terminal's cursor */
+
+  /*
+   *  clear entire line: Esc[2K
+   *  clear line from cursor right: Esc[K
+   */
+
+  Mirror_Escape();                 /* send: Esc[ */
+  if (x == 1)                      /* complete line */
+  {
+    Serial_WriteByte('2');         /* send: 2 */
+  }
+  Serial_WriteByte('K');           /* send: K */
+}
+
+
+
+/*
+ *  clear both output sinks
+ *  - replaces LCD_Clear()
+ */
+
+void Mirror_Clear(void)
+{
+  LCD_Clear();                     /* clear display */
+
+  /* clear entire screen: Esc[2J */
+  Mirror_Escape();                 /* send: Esc[ */
+  Serial_WriteByte('2');           /* send: 2 */
+  Serial_WriteByte('J');           /* send: J */
+
+  MirrorPos_X = 0;                 /* cursor position unknown */
+}
+
+
+/* map LCD output functions to mirror functions for the rest of display.c */
+#define LCD_Char         Mirror_Char
+#define LCD_ClearLine    Mirror_ClearLine
+#define LCD_Clear        Mirror_Clear
+
+#endif
+
+
+
+/* ************************************************************************
+ *   shadow of character grid
+ * ************************************************************************ */
+
+
+#ifdef UI_SHADOW_GRID
+
+/*
+ *  The shadow grid keeps a copy of the characters (and pen colors) shown
+ *  on the display. Outside of display.c the LCD output functions are
+ *  mapped to the shadow functions (see functions.h):
+ *  - characters already displayed at the same position with the same
+ *    color are skipped
+ *  - clearing a complete text line is deferred (pending line) and only
+ *    the cells not overwritten by new characters are cleared later on
+ *  - graphics (symbols, boxes etc.) aren't tracked
+ *  - with UI_SERIAL_MIRROR the shadow functions call the mirror functions
+ *  - with UI_PARTIAL_REFRESH a new probing result is written over the
+ *    old one (only changed characters) and a symbol is kept when the
+ *    same symbol is displayed at the same position again
+ */
+
+/*
+ *  local constants
+ */
+
+#define SHADOW_BLANK          0         /* blank cell */
+#define SHADOW_UNKNOWN        0xFF      /* unknown cell content */
+#define SHADOW_NONE           0xFFFF    /* cell not in shadow grid */
+
+
+/*
+ *  local variables
+ */
+
+uint8_t             ShadowChar[UI_SHADOW_GRID];    /* characters */
+#ifdef LCD_COLOR
+uint16_t            ShadowColor[UI_SHADOW_GRID];   /* pen colors */
+#endif
+uint8_t             ShadowLine = 0;     /* pending line (0 = none) */
+uint8_t             ShadowPos;          /* next char position in pending line */
+#ifdef UI_PARTIAL_REFRESH
+uint8_t             RefreshLine = 0;    /* next line to refresh (0 = none) */
+  #ifdef SW_SYMBOLS
+uint8_t             RefreshSymbol = 0;  /* displayed symbol (ID + 1, 0 = none) */
+uint8_t             RefreshKeep = 0;    /* keep symbol area */
+  #endif
+#endif
+
+
+
+/*
+ *  get index of character cell in shadow grid
+ *
+ *  requires:
+ *  - x: character position (1-)
+ *  - y: line number (1-)
+ *
+ *  returns:
+ *  - index
+ *  - SHADOW_NONE if cell isn't covered by shadow grid
+ */
+
+uint16_t Shadow_Index(uint8_t x, uint8_t y)
+{
+  uint16_t          Index;         /* return value */
+
+  if ((x == 0) || (x > UI.CharMax_X) || (y == 0))
+  {
+    return SHADOW_NONE;            /* out of range */
+  }
+
+  Index = y - 1;                   /* lines start at 0 */
+  Index *= UI.CharMax_X;           /* offset for line */
+  Index += x - 1;                  /* add char position */
+
+  if (Index >= UI_SHADOW_GRID)     /* beyond shadow grid */
+  {
+    Index = SHADOW_NONE;
+  }
+
+  return Index;
+}
+
+
+
+/*
+ *  clear old characters in pending line
+ *  - sends only spaces for cells which aren't blank
+ *
+ *  requires:
+ *  - End: char position to stop at (not cleared)
+ */
+
+void Shadow_Blank(uint8_t End)
+{
+  uint8_t           x;             /* current char position */
+  uint8_t           y;             /* current line */
+  uint16_t          Index;         /* cell index */
+
+  /* save current position */
+  x = UI.CharPos_X;
+  y = UI.CharPos_Y;
+
+  while (ShadowPos < End)          /* for all cells */
+  {
+    Index = Shadow_Index(ShadowPos, ShadowLine);
+    if (Index == SHADOW_NONE) break;    /* end of shadow grid */
+
+    if (ShadowChar[Index] != SHADOW_BLANK)   /* old char */
+    {
+      LCD_CharPos(ShadowPos, ShadowLine);    /* move to cell */
+      LCD_Char(' ');                         /* clear cell */
+      ShadowChar[Index] = SHADOW_BLANK;      /* update shadow */
+    }
+
+    ShadowPos++;                   /* next cell */
+  }
+
+  LCD_CharPos(x, y);               /* restore position */
+}
+
+
+
+#if defined (UI_PARTIAL_REFRESH) && defined (SW_SYMBOLS)
+
+/*
+ *  get start of symbol area in a text line
+ *  - symbol area: symbol and probe numbers, starting with the left-hand
+ *    probe numbers up to the end of the line
+ *  - based on position of last symbol displayed
+ *
+ *  requires:
+ *  - Line: line number (1-)
+ *
+ *  returns:
+ *  - char position of symbol area
+ *  - 0 if line isn't part of symbol area
+ */
+
+uint8_t Shadow_SymbolArea(uint8_t Line)
+{
+  uint8_t           Top;           /* top line of symbol area */
+  uint8_t           Bottom;        /* bottom line of symbol area */
+
+  Top = UI.SymbolPos_Y;                 /* top line of symbol */
+  Bottom = Top + UI.SymbolSize_Y - 1;   /* bottom line of symbol */
+  #ifdef UI_PINOUT_ALT
+  Top--;                           /* probe number above symbol */
+  Bottom++;                        /* probe number below symbol */
+  #endif
+
+  if ((Line < Top) || (Line > Bottom))  /* not part of symbol area */
+  {
+    return 0;
+  }
+
+  return UI.SymbolPos_X - 1;       /* left-hand probe numbers */
+}
+
+
+
+/*
+ *  manage cells of symbol area
+ *  - the shadow grid doesn't know the symbol's graphics, so the cells
+ *    are marked as unknown after displaying the symbol
+ *
+ *  requires:
+ *  - Mode: 0 mark all cells as unknown
+ *          1 clear cells still unknown (old symbol)
+ */
+
+void Shadow_SymbolCells(uint8_t Mode)
+{
+  uint8_t           x;             /* char position */
+  uint8_t           y;             /* line */
+  uint8_t           Pos_X;         /* saved char position */
+  uint8_t           Pos_Y;         /* saved line */
+  uint16_t          Index;         /* cell index */
+
+  /* save current position */
+  Pos_X = UI.CharPos_X;
+  Pos_Y = UI.CharPos_Y;
+
+  y = 1;
+  while (y <= UI.CharMax_Y)        /* for all lines */
+  {
+    x = Shadow_SymbolArea(y);      /* start of symbol area */
+
+    if (x)                         /* part of symbol area */
+    {
+      while (x <= UI.CharMax_X)    /* for all cells up to end of line */
+      {
+        Index = Shadow_Index(x, y);
+        if (Index == SHADOW_NONE) break;     /* end of shadow grid */
+
+        if (Mode == 0)                       /* mark cell */
+        {
+          ShadowChar[Index] = SHADOW_UNKNOWN;
+        }
+        else if (ShadowChar[Index] == SHADOW_UNKNOWN)    /* old cell */
+        {
+          LCD_CharPos(x, y);                 /* move to cell */
+          LCD_Char(' ');                     /* clear cell */
+          ShadowChar[Index] = SHADOW_BLANK;  /* update shadow */
+        }
+
+        x++;                       /* next cell */
+      }
+    }
+
+    y++;                           /* next line */
+  }
+
+  LCD_CharPos(Pos_X, Pos_Y);       /* restore position */
+}
+
+#endif
+
+
+
+/*
+ *  finish pending line
+ *  - clears remaining old characters
+ *  - partial refresh: keeps symbol area if requested
+ */
+
+void Shadow_Flush(void)
+{
+  uint8_t           End;           /* char position to stop at */
+  #if defined (UI_PARTIAL_REFRESH) && defined (SW_SYMBOLS)
+  uint8_t           Pos;           /* start of symbol area */
+  #endif
+
+  if (ShadowLine)                  /* pending line */
+  {
+    End = UI.CharMax_X + 1;        /* end of line */
+
+    #if defined (UI_PARTIAL_REFRESH) && defined (SW_SYMBOLS)
+    if (RefreshKeep)               /* keep symbol */
+    {
+      Pos = Shadow_SymbolArea(ShadowLine);
+      if (Pos) End = Pos;          /* stop at symbol area */
+    }
+    #endif
+
+    Shadow_Blank(End);             /* clear rest of line */
+    ShadowLine = 0;                /* line done */
+  }
+}
+
+
+
+#ifdef UI_PARTIAL_REFRESH
+
+/*
+ *  refresh text lines
+ *  - lines not refreshed yet are cleared lazily (via pending line)
+ *  - the given line becomes the pending line
+ *
+ *  requires:
+ *  - Line: line number (1-)
+ */
+
+void Shadow_RefreshLines(uint8_t Line)
+{
+  Shadow_Flush();                  /* finish pending line */
+
+  while (RefreshLine <= Line)      /* for all lines up to the given one */
+  {
+    ShadowLine = RefreshLine;      /* set pending line */
+    ShadowPos = 1;                 /* start of line */
+    if (RefreshLine < Line)        /* skipped line */
+    {
+      Shadow_Flush();              /* clear old characters */
+    }
+
+    RefreshLine++;                 /* next line */
+  }
+}
+
+
+
+/*
+ *  finish partial refresh of the display
+ *  - clears old characters in the lines not refreshed
+ *
+ *  requires:
+ *  - Line: last line to refresh (refresh is done with the last line
+ *    of the screen)
+ */
+
+void Shadow_RefreshDone(uint8_t Line)
+{
+  if (RefreshLine)                 /* partial refresh */
+  {
+    Shadow_RefreshLines(Line);     /* refresh remaining lines */
+    Shadow_Flush();                /* finish pending line */
+
+    if (Line >= UI.CharMax_Y)      /* last line */
+    {
+      RefreshLine = 0;             /* refresh done */
+    }
+  }
+}
+
+#endif
+
+
+
+/*
+ *  display a single character
+ *  - replaces LCD_Char()
+ *  - skips character if already displayed
+ *
+ *  requires:
+ *  - Char: character to display
+ */
+
+void Shadow_Char(unsigned char Char)
+{
+  uint8_t           x;             /* char position */
+  uint8_t           y;             /* line */
+  uint8_t           Old;           /* character in shadow */
+  uint16_t          Index;         /* cell index */
+  #ifdef LCD_COLOR
+  uint16_t          Color;         /* pen color */
+
+  Color = UI.PenColor;             /* get current pen color */
+  #endif
+
+  x = UI.CharPos_X;
+  y = UI.CharPos_Y;
+
+  #ifdef UI_PARTIAL_REFRESH
+  /* partial refresh: line not refreshed yet */
+  if (RefreshLine && (y >= RefreshLine))
+  {
+    Shadow_RefreshLines(y);        /* refresh lines up to current one */
+  }
+  #endif
+
+  /* manage pending line */
+  if (ShadowLine)                  /* pending line */
+  {
+    if (y != ShadowLine)           /* moved to another line */
+    {
+      Shadow_Flush();              /* finish pending line */
+    }
+    else if (x > ShadowPos)        /* skipped some cells */
+    {
+      Shadow_Blank(x);             /* clear skipped cells */
+    }
+  }
+
+  Index = Shadow_Index(x, y);
+
+  if (Index == SHADOW_NONE)        /* not covered by shadow grid */
+  {
+    LCD_Char(Char);                /* simply display char */
+  }
+  else                             /* covered by shadow grid */
+  {
+    if (Char == ' ') Char = SHADOW_BLANK;    /* space looks like blank */
+    Old = ShadowChar[Index];                 /* get old char */
+
+    #ifdef LCD_COLOR
+    /* a blank doesn't consider the pen color */
+    if ((Char != SHADOW_BLANK) && (Color != ShadowColor[Index]))
+    {
+      Old = SHADOW_UNKNOWN;        /* force update */
+    }
+    #endif
+
+    if (Char == Old)               /* same char already displayed */
+    {
+      LCD_CharPos(x + 1, y);       /* simply move to next position */
+    }
+    else                           /* new char */
+    {
+      ShadowChar[Index] = Char;    /* update shadow */
+      #ifdef LCD_COLOR
+      ShadowColor[Index] = Color;
+      #endif
+
+      if (Char == SHADOW_BLANK) Char = ' ';  /* restore space */
+      LCD_Char(Char);              /* display char */
+    }
+  }
+
+  if (y == ShadowLine)             /* pending line */
+  {
+    ShadowPos = x + 1;             /* update position */
+  }
+}
+
+
+
+/*
+ *  clear a single text line
+ *  - replaces LCD_ClearLine()
+ *  - complete lines are cleared lazily
+ *
+ *  requires:
+ *  - Line: line number (1-)
+ *    special case line 0: clear remaining space in current line
+ */
+
+void Shadow_ClearLine(uint8_t Line)
+{
+  uint8_t           x;             /* char position */
+  uint16_t          Index;         /* cell index */
+
+  #ifdef UI_PARTIAL_REFRESH
+  /* partial refresh: stop and clear all old characters */
+  if (RefreshLine)
+  {
+    Shadow_RefreshDone(UI.CharMax_Y);   /* clear lines not refreshed */
+
+    #ifdef SW_SYMBOLS
+    if (RefreshKeep)               /* kept symbol area */
+    {
+      Shadow_SymbolCells(1);       /* clear old symbol */
+      RefreshKeep = 0;             /* don't keep anymore */
+    }
+    RefreshSymbol = 0;             /* no symbol */
+    #endif
+  }
+  #endif
+
+  Shadow_Flush();                  /* finish pending line */
+
+  /* complete line covered by shadow grid */
+  if ((Line > 0) && (Shadow_Index(UI.CharMax_X, Line) != SHADOW_NONE))
+  {
+    /* defer clearing */
+    ShadowLine = Line;             /* set pending line */
+    ShadowPos = 1;                 /* start of line */
+    LCD_CharPos(1, Line);          /* move to start of line */
+  }
+  else                             /* clear line right away */
+  {
+    if (Line == 0)                 /* current line */
+    {
+      x = UI.CharPos_X;            /* from current position */
+      Line = UI.CharPos_Y;
+      LCD_ClearLine(0);            /* clear rest of line */
+    }
+    else                           /* complete line */
+    {
+      x = 1;                       /* from start of line */
+      LCD_ClearLine(Line);         /* clear line */
+    }
+
+    /* update shadow */
+    while (x <= UI.CharMax_X)      /* for all cells */
+    {
+      Index = Shadow_Index(x, Line);
+      if (Index == SHADOW_NONE) break;  /* end of shadow grid */
+      ShadowChar[Index] = SHADOW_BLANK; /* blank cell */
+      x++;                              /* next cell */
+    }
+  }
+}
+
+
+
+/*
+ *  clear the display
+ *  - replaces LCD_Clear()
+ */
+
+void Shadow_Clear(void)
+{
+  uint16_t          n;             /* counter */
+
+  LCD_Clear();                     /* clear display */
+
+  /* update shadow */
+  n = 0;
+  while (n < UI_SHADOW_GRID)       /* for all cells */
+  {
+    ShadowChar[n] = SHADOW_BLANK;  /* blank cell */
+    n++;                           /* next cell */
+  }
+
+  ShadowLine = 0;                  /* no pending line */
+
+  #ifdef UI_PARTIAL_REFRESH
+  RefreshLine = 0;                 /* no partial refresh */
+    #ifdef SW_SYMBOLS
+    RefreshSymbol = 0;             /* no symbol */
+    RefreshKeep = 0;
+    #endif
+  #endif
+}
+
+
+
+#ifdef UI_PARTIAL_REFRESH
+
+/*
+ *  start partial refresh of the display
+ *  - replaces LCD_Clear() for a new probing result in continuous mode
+ *  - a line is refreshed when it's written to and only the old
+ *    characters left over are cleared
+ *  - clears the display if the shadow grid doesn't cover the complete
+ *    screen
+ *
+ *  requires:
+ *  - Keep: 1 for keeping symbol (if the same) / 0 for no symbol
+ */
+
+void Shadow_Refresh(uint8_t Keep)
+{
+  /* check that the shadow grid covers the complete screen */
+  if (Shadow_Index(UI.CharMax_X, UI.CharMax_Y) == SHADOW_NONE)
+  {
+    Shadow_Clear();                /* clear display */
+    return;
+  }
+
+  Shadow_Flush();                  /* finish pending line */
+  RefreshLine = 1;                 /* start with line #1 */
+
+  #ifdef SW_SYMBOLS
+  /* keep symbol area only for the same symbol */
+  RefreshKeep = 0;                 /* default: don't keep */
+  if (Keep && (RefreshSymbol == Check.Symbol + 1))
+  {
+    RefreshKeep = 1;               /* keep */
+  }
+  #endif
+
+  LCD_CharPos(1, 1);               /* move to start of screen */
+}
+
+#endif
+
+
+
+/*
+ *  set cursor
+ *  - replaces LCD_Cursor()
+ *  - the cursor is displayed in the bottom right cell
+ *
+ *  requires:
+ *  - Mode: cursor mode
+ */
+
+void Shadow_Cursor(uint8_t Mode)
+{
+  uint16_t          Index;         /* cell index */
+
+  Shadow_Flush();                  /* finish pending line */
+
+  Index = Shadow_Index(UI.CharMax_X, UI.CharMax_Y);
+  if (Index != SHADOW_NONE)        /* covered by shadow grid */
+  {
+    ShadowChar[Index] = SHADOW_UNKNOWN; /* content changes */
+  }
+
+  LCD_Cursor(Mode);                /* set cursor */
+}
+
+
+
+#ifdef UI_HW_SCROLL
+
+/*
+ *  scroll text lines up by one line
+ *  - replaces LCD_Scroll()
+ */
+
+void Shadow_Scroll(void)
+{
+  uint16_t          n;             /* counter */
+  uint16_t          Next;          /* cell in next line */
+  uint16_t          Cells;         /* number of cells on display */
+
+  Shadow_Flush();                  /* finish pending line */
+
+  /* move cells up by one line */
+  Cells = UI.CharMax_Y;
+  Cells *= UI.CharMax_X;
+  n = 0;
+  while ((n < UI_SHADOW_GRID) && (n < Cells))     /* for all cells */
+  {
+    Next = n + UI.CharMax_X;       /* same cell in next line */
+
+    if (Next >= Cells)             /* last line */
+    {
+      ShadowChar[n] = SHADOW_BLANK;     /* will be cleared */
+    }
+    else if (Next >= UI_SHADOW_GRID)    /* not covered by shadow grid */
+    {
+      ShadowChar[n] = SHADOW_UNKNOWN;   /* unknown content */
+    }
+    else                           /* copy cell */
+    {
+      ShadowChar[n] = ShadowChar[Next];
+      #ifdef LCD_COLOR
+      ShadowColor[n] = ShadowColor[Next];
+      #endif
+    }
+
+    n++;                           /* next cell */
+  }
+
+  LCD_Scroll();                    /* scroll display */
+}
+
+#endif
+
+
+/* map LCD output functions to shadow functions for the rest of display.c */
+#ifdef UI_SERIAL_MIRROR
+  #undef LCD_Char
+  #undef LCD_ClearLine
+  #undef LCD_Clear
+#endif
+#define LCD_Char         Shadow_Char
+#define LCD_ClearLine    Shadow_ClearLine
+#define LCD_Clear        Shadow_Clear
+#define LCD_Cursor       Shadow_Cursor
+#ifdef UI_HW_SCROLL
+#define LCD_Scroll       Shadow_Scroll
+#endif
+
+#endif
+
+
+
+#ifdef UI_HW_SCROLL
+
+/*
+ *  local variables
+ */
+
+uint8_t             ScrollLines = 0;    /* lines scrolled since key press */
+
+#endif
+
+
+
 /* ************************************************************************
  *   display of characters and strings
  * ************************************************************************ */
@@ -44,6 +908,10 @@
  *  - LINE_KEY   same as LINE_STD,
  *               but also wait for test key/timeout
  *  - LINE_KEEP  keep first line when clearing the display
+ *
+ *  With hardware scrolling (UI_HW_SCROLL) the display is scrolled up
+ *  by one line instead of being cleared, and LINE_KEY waits only after
+ *  a full page of new lines.
  */
 
 void Display_NextLine(void)
@@ -66,7 +934,16 @@ void Display_NextLine(void)
     /* check if we reached the last line */
     if (Line == UI.CharMax_Y)
     {
+      #ifdef UI_HW_SCROLL
+      /* scrolling: wait only after a full page of new lines */
+      if ((Mode & LINE_KEEP) || (ScrollLines == 0))
+      {
+        if (Mode & LINE_KEY) WaitKey();      /* wait for key press */
+        ScrollLines = UI.CharMax_Y - 1;      /* lines till next page */
+      }
+      #else
       if (Mode & LINE_KEY) WaitKey();   /* wait for key press */
+      #endif
 
       /* clear screen */
       if (Mode & LINE_KEEP)        /* keep first line */
@@ -82,11 +959,20 @@ void Display_NextLine(void)
       }
       else                         /* clear complete screen */
       {
+        #ifdef UI_HW_SCROLL
+        ScrollLines--;             /* one line less */
+        LCD_Scroll();              /* scroll up and move to last line */
+        #else
         LCD_Clear();               /* clear screen */
+        #endif
       }
     }
     else
     {
+      #ifdef UI_HW_SCROLL
+      ScrollLines = 0;             /* new page */
+      #endif
+
       /* simply move to the next line */
       Line++;                      /* add one line */
       LCD_CharPos(1, Line);        /* move to new line */
@@ -211,8 +1097,19 @@ void Display_EEString(const unsigned char *String)
 
 #ifdef UI_CENTER_ALIGN
 
+/*
+ *  local constants
+ */
+
+#define CENTER_BUFFER         24        /* size of character buffer */
+
+
+
 /*
  *  display a fixed string stored in EEPROM/Flash center-aligned
+ *  - string is read only once: the first characters are buffered
+ *    while getting the length, which saves a second pass of slow
+ *    EEPROM reads
  *
  *  requires:
  *  - pointer to fixed string
@@ -223,12 +1120,18 @@ void Display_EEString_Center(const unsigned char *String)
   uint8_t                Length = 0;    /* string length */
   uint8_t                n;             /* temporary value */
   const unsigned char    *TempStr;      /* string pointer */
+  unsigned char          Buffer[CENTER_BUFFER];   /* character buffer */
 
-  /* get string length */
+  /* get string length and buffer first characters */
   TempStr = String;
   /* read characters until we get the terminating 0 */
   while ((n = DATA_read_byte(TempStr)))
   {
+    if (Length < CENTER_BUFFER)    /* buffer not full yet */
+    {
+      Buffer[Length] = n;          /* save character */
+    }
+
     Length++;                      /* got one character */
     TempStr++;                     /* next one */
   }
@@ -248,7 +1151,20 @@ void Display_EEString_Center(const unsigned char *String)
 
   /* display string in center of line */
   LCD_CharPos(n, UI.CharPos_Y);    /* move cursor to start position */
-  Display_EEString(String);        /* display string */
+
+  /* display buffered characters */
+  n = 0;
+  while ((n < Length) && (n < CENTER_BUFFER))
+  {
+    Display_Char(Buffer[n]);       /* send character */
+    n++;                           /* next one */
+  }
+
+  /* display remaining characters (longer than buffer) */
+  if (Length > CENTER_BUFFER)
+  {
+    Display_EEString(String + CENTER_BUFFER);
+  }
 }
 
 #endif
@@ -795,6 +1711,56 @@ void Display_HexValue(uint16_t Value, uint8_t Bits)
 
 
 
+/*
+ *  convert unsigned value into decimal string
+ *  - division-free: digits are derived by subtracting powers of ten
+ *  - string is stored in OutBuffer (max. 10 chars + /0)
+ *
+ *  requires:
+ *  - Value: unsigned value
+ *
+ *  returns:
+ *  - string length (number of digits)
+ */
+
+uint8_t Value2String(uint32_t Value)
+{
+  uint8_t           Length = 0;         /* string length */
+  uint8_t           n = 0;              /* counter */
+  unsigned char     Digit;              /* digit */
+  uint32_t          Power;              /* power of ten */
+
+  /* digits for 10^9 to 10^1 */
+  while (n < NUM_POWER10)               /* for all powers of ten */
+  {
+    Power = DATA_read_dword(&Power10_table[n]);
+    Digit = '0';                        /* start with zero */
+
+    while (Value >= Power)              /* count powers of ten */
+    {
+      Value -= Power;                   /* subtract power */
+      Digit++;                          /* next digit */
+    }
+
+    if ((Digit != '0') || (Length > 0)) /* skip leading zeros */
+    {
+      OutBuffer[Length] = Digit;        /* add digit */
+      Length++;                         /* next char */
+    }
+
+    n++;                                /* next power */
+  }
+
+  /* last digit (10^0): simply the remainder */
+  OutBuffer[Length] = '0' + (uint8_t)Value;
+  Length++;                             /* next char */
+  OutBuffer[Length] = 0;                /* terminate string */
+
+  return Length;
+}
+
+
+
 #if defined (FUNC_DISPLAY_FULLVALUE) || defined (FUNC_DISPLAY_SIGNEDFULLVALUE)
 
 /*
@@ -818,8 +1784,7 @@ void Display_FullValue(uint32_t Value, uint8_t DecPlaces, unsigned char Unit)
   #endif
 
   /* convert value into string */
-  ultoa(Value, OutBuffer, 10);          /* radix 10: max. 10 chars + /0 */
-  Length = strlen(OutBuffer);           /* get string length */
+  Length = Value2String(Value);         /* max. 10 chars + /0 */
 
   /* determine position of dot */
   if (DecPlaces == 0)                   /* no dot requested */
@@ -930,13 +1895,50 @@ void Display_Value(uint32_t Value, int8_t Exponent, unsigned char Unit)
   uint8_t           Index;              /* index ID */
   uint8_t           Length;             /* string length */
 
+  #ifdef SW_BIN_FRAMES
+  /* capture value for binary frame instead of output */
+  if (Frame.Mode & FRAME_CAPTURE)
+  {
+    if (Frame.Count == 0)               /* first value */
+    {
+      Frame.Value = Value;
+      Frame.Scale = Exponent;
+    }
+    Frame.Count++;                      /* one value more */
+    return;
+  }
+  #endif
+
+  /* convert value into string */
+  Length = Value2String(Value);         /* max. 10 chars + /0 */
+
   /* scale value down to 4 digits */
-  while (Value >= 10000)
+  while (Length > 4)
   {
-    Value += 5;                       /* for automagic rounding */
-    Value = Value / 10;               /* scale down by 10^1 */
+    Length--;                         /* drop last digit */
     Exponent++;                       /* increase exponent by 1 */
-  } 
+
+    /* automagic rounding */
+    if (OutBuffer[Length] >= '5')     /* round up */
+    {
+      Index = Length;                 /* start at new last digit */
+      do
+      {
+        Index--;                      /* next digit to the left */
+        OutBuffer[Index]++;           /* add one */
+        if (OutBuffer[Index] <= '9') break;    /* no carry */
+        OutBuffer[Index] = '0';       /* carry to next digit */
+      } while (Index > 0);
+
+      if (OutBuffer[0] == '0')        /* carry beyond first digit */
+      {
+        /* all 9s turned into 0s: add leading 1 */
+        OutBuffer[0] = '1';           /* 10^n */
+        OutBuffer[Length] = '0';      /* one digit more */
+        Length++;
+      }
+    }
+  }
 
 
   /*
@@ -971,10 +1973,6 @@ void Display_Value(uint32_t Value, int8_t Exponent, unsigned char Unit)
   Display_UseValueColor();              /* set value color */
   #endif
 
-  /* convert value into string */
-  utoa((uint16_t)Value, OutBuffer, 10);   /* radix 10: max. 5 chars + /0 */
-  Length = strlen(OutBuffer);             /* get string length */
-
   /* we misuse Exponent for the dot position */
   Exponent = Length - Offset;           /* calculate position */
 
@@ -1046,6 +2044,11 @@ void Display_SignedValue(int32_t Value, int8_t Exponent, unsigned char Unit)
   /* take care about sign */
   if (Value < 0)              /* negative value */
   {
+    #ifdef SW_BIN_FRAMES
+    /* first captured value is negative */
+    if ((Frame.Mode & FRAME_CAPTURE) && (Frame.Count == 0)) Frame.Sign = 1;
+    #endif
+
     #ifdef UI_COLORED_VALUES
     Display_UseValueColor();  /* set value color */
     #endif
@@ -1184,6 +2187,100 @@ void Display_EIA96(uint8_t Index, int8_t Scale)
 
 
 
+/* ************************************************************************
+ *   compressed bitmaps (component symbols and fonts)
+ * ************************************************************************ */
+
+
+#if defined (SYMBOLS_RLE) || defined (FONT_RLE)
+
+/*
+ *  Compressed bitmaps are decoded row by row into a small row buffer
+ *  provided by LCD_Symbol() or LCD_Char(). Each row is stored as XOR
+ *  difference to the previous row, and runs of unchanged bytes are
+ *  run-length encoded (see symbols_<size>_h.h for the format).
+ */
+
+/*
+ *  local variables
+ */
+
+uint8_t             *BitmapPtr;         /* pointer to compressed data */
+uint8_t             BitmapZeros;        /* pending unchanged bytes */
+uint8_t             BitmapBytes;        /* pending data bytes */
+
+
+
+/*
+ *  start decoding a compressed bitmap
+ *
+ *  requires:
+ *  - Data: address of compressed bitmap data
+ *  - Row: pointer to row buffer
+ *  - Bytes: number of bytes per row
+ */
+
+void Bitmap_Start(uint8_t *Data, uint8_t *Row, uint8_t Bytes)
+{
+  BitmapPtr = Data;                /* set data pointer */
+  BitmapZeros = 0;                 /* reset counters */
+  BitmapBytes = 0;
+
+  /* clear row buffer (first row is XORed with zeros) */
+  while (Bytes > 0)
+  {
+    *Row = 0;                      /* clear byte */
+    Row++;                         /* next byte */
+    Bytes--;
+  }
+}
+
+
+
+/*
+ *  decode next row of a compressed bitmap
+ *  - updates previous row in row buffer
+ *
+ *  requires:
+ *  - Row: pointer to row buffer
+ *  - Bytes: number of bytes per row
+ */
+
+void Bitmap_Row(uint8_t *Row, uint8_t Bytes)
+{
+  uint8_t           Data;          /* control byte */
+
+  while (Bytes > 0)
+  {
+    if ((BitmapZeros == 0) && (BitmapBytes == 0))    /* run done */
+    {
+      /* get next control byte */
+      Data = pgm_read_byte(BitmapPtr);
+      BitmapPtr++;
+      BitmapZeros = Data >> 4;          /* number of unchanged bytes */
+      BitmapBytes = Data & 0x0F;        /* number of data bytes */
+    }
+
+    if (BitmapZeros > 0)           /* unchanged byte */
+    {
+      BitmapZeros--;               /* just skip byte */
+    }
+    else                           /* data byte */
+    {
+      *Row ^= pgm_read_byte(BitmapPtr); /* apply difference */
+      BitmapPtr++;
+      BitmapBytes--;
+    }
+
+    Row++;                         /* next byte */
+    Bytes--;
+  }
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   fancy pinout
  * ************************************************************************ */
@@ -1327,6 +2424,9 @@ void Display_FancySemiPinout(uint8_t Line)
   #ifdef LCD_COLOR
   uint16_t          Color;         /* pen color */ 
   #endif
+  #ifdef UI_PARTIAL_REFRESH
+  uint8_t           Keep = 0;      /* symbol still displayed */
+  #endif
 
   /* get height values */
   Pos = UI.SymbolSize_Y;           /* get symbol height */
@@ -1390,6 +2490,23 @@ void Display_FancySemiPinout(uint8_t Line)
      *  display symbol with pinout
      */
 
+    #ifdef UI_PARTIAL_REFRESH
+    /* partial refresh: check for same symbol at the same position */
+    if (RefreshKeep)               /* kept symbol area */
+    {
+      if ((UI.SymbolPos_X == Pos) && (UI.SymbolPos_Y == Line))
+      {
+        Keep = 1;                  /* symbol still displayed */
+      }
+      else                         /* position changed */
+      {
+        Shadow_SymbolCells(1);     /* clear old symbol */
+      }
+
+      RefreshKeep = 0;             /* done */
+    }
+    #endif
+
     /* determine start position (top left of symbol) */
     UI.SymbolPos_X = Pos;               /* x position */
     UI.SymbolPos_Y = Line;              /* y position */
@@ -1405,6 +2522,11 @@ void Display_FancySemiPinout(uint8_t Line)
     Display_FancyProbeNumber(Semi.C, 2);     /* C pin */
 
     /* display symbol */
+    #ifdef UI_PARTIAL_REFRESH
+    if (! Keep)                         /* not displayed yet */
+    {
+    #endif
+
     #ifdef LCD_COLOR
     Color = UI.PenColor;                /* save color */
     UI.PenColor = COLOR_SYMBOL;         /* set pen color */
@@ -1417,6 +2539,14 @@ void Display_FancySemiPinout(uint8_t Line)
     UI.PenColor = Color;                /* restore pen color */
     #endif
 
+    #ifdef UI_PARTIAL_REFRESH
+    }
+
+    /* partial refresh: keep track of symbol */
+    Shadow_SymbolCells(0);              /* mark symbol area as unknown */
+    RefreshSymbol = Check.Symbol + 1;   /* symbol displayed */
+    #endif
+
     /* hint: we don't restore the old char position */
 
     #if defined (UI_KEY_HINTS) || defined (UI_BATTERY_LASTLINE)
@@ -1800,6 +2930,250 @@ void SymbolTest(void)
 
 
 
+#ifdef SW_DISPLAY_BENCH
+
+/*
+ *  local constants for display benchmark
+ */
+
+#define BENCH_TICKS_S    (CPU_FREQ / 1024)   /* time base ticks per second */
+#define BENCH_RUNS       4              /* runs per test */
+
+/* test IDs */
+#define BENCH_CLEAR      0              /* clear screen */
+#define BENCH_LINE       1              /* clear line */
+#define BENCH_CHAR       2              /* display char */
+#define BENCH_SYMBOL     3              /* display symbol */
+
+#ifdef SW_SYMBOLS
+  #define BENCH_TESTS    4              /* number of tests */
+#else
+  #define BENCH_TESTS    3              /* number of tests */
+#endif
+
+
+
+/*
+ *  calculate rate per second
+ *
+ *  requires:
+ *  - number of items processed
+ *  - time in time base ticks
+ *
+ *  returns:
+ *  - items per second
+ */
+
+uint32_t Bench_Rate(uint32_t Count, uint32_t Ticks)
+{
+  uint32_t          Rate;               /* return value */
+
+  if (Ticks == 0) Ticks = 1;            /* below resolution of time base */
+
+  /* split to prevent overflow: Count * BENCH_TICKS_S / Ticks */
+  Rate = (Count / Ticks) * BENCH_TICKS_S;
+  Count %= Ticks;                       /* remainder */
+  Rate += (Count * BENCH_TICKS_S) / Ticks;
+
+  return Rate;
+}
+
+
+
+/*
+ *  display benchmark
+ *  - measures speed of basic display functions using the time base
+ *  - shows operations per second and, for graphic displays, pixels
+ *    per second (based on the char cell size)
+ */
+
+void DisplayBench(void)
+{
+  uint8_t           Test;               /* test ID */
+  uint8_t           Run;                /* run counter */
+  uint8_t           Max_X;              /* max chars per line */
+  uint8_t           Max_Y;              /* max char lines */
+  uint8_t           Pos_X;              /* char X position */
+  uint8_t           Pos_Y;              /* char Y position */
+  uint16_t          Ops[BENCH_TESTS];        /* operations per test */
+  uint16_t          Cells[BENCH_TESTS];      /* char cells per operation */
+  uint32_t          Ticks[BENCH_TESTS];      /* time per test */
+  uint32_t          Start;              /* start tick */
+  #ifdef LCD_GRAPHIC
+  uint32_t          Cell;               /* pixels per char cell */
+  #endif
+  const unsigned char *Label;           /* test label */
+
+  /* manage display size */
+  Max_X = UI.CharMax_X;            /* get maximum number of chars per line */
+  Max_Y = UI.CharMax_Y;            /* get maximum number of lines */
+
+  #ifdef LCD_GRAPHIC
+  Cell = (uint32_t)LCD_DOTS_X * LCD_DOTS_Y;      /* pixels of screen */
+  Cell /= (uint16_t)Max_X * Max_Y;               /* pixels per char cell */
+  #endif
+
+
+  /*
+   *  clear screen
+   */
+
+  Start = Profile_Tick();          /* get start tick */
+  Run = BENCH_RUNS;
+  while (Run > 0)
+  {
+    LCD_Clear();                   /* clear screen */
+    Run--;                         /* next run */
+  }
+  Ticks[BENCH_CLEAR] = Profile_Tick() - Start;
+  Ops[BENCH_CLEAR] = BENCH_RUNS;
+  Cells[BENCH_CLEAR] = (uint16_t)Max_X * Max_Y;
+
+
+  /*
+   *  clear single lines
+   */
+
+  Start = Profile_Tick();          /* get start tick */
+  Run = BENCH_RUNS;
+  while (Run > 0)
+  {
+    Pos_Y = Max_Y;
+    while (Pos_Y > 0)              /* all lines */
+    {
+      LCD_ClearLine(Pos_Y);        /* clear line */
+      Pos_Y--;                     /* next line */
+    }
+    Run--;                         /* next run */
+  }
+  Ticks[BENCH_LINE] = Profile_Tick() - Start;
+  Ops[BENCH_LINE] = BENCH_RUNS * Max_Y;
+  Cells[BENCH_LINE] = Max_X;
+
+
+  /*
+   *  fill screen with chars
+   */
+
+  Start = Profile_Tick();          /* get start tick */
+  Run = BENCH_RUNS;
+  while (Run > 0)
+  {
+    Pos_Y = 1;
+    while (Pos_Y <= Max_Y)         /* all lines */
+    {
+      LCD_CharPos(1, Pos_Y);       /* start of line */
+      Pos_X = 0;
+      while (Pos_X < Max_X)        /* all chars in line */
+      {
+        /* vary chars a bit: A-P */
+        LCD_Char('A' + ((Pos_X + Pos_Y + Run) & 0x0f));
+        Pos_X++;                   /* next char */
+      }
+      Pos_Y++;                     /* next line */
+    }
+    Run--;                         /* next run */
+  }
+  Ticks[BENCH_CHAR] = Profile_Tick() - Start;
+  Ops[BENCH_CHAR] = BENCH_RUNS * Max_X * Max_Y;
+  Cells[BENCH_CHAR] = 1;
+
+
+  /*
+   *  display symbols
+   */
+
+  #ifdef SW_SYMBOLS
+  Start = Profile_Tick();          /* get start tick */
+  Run = 0;
+  while (Run < NUM_SYMBOLS)        /* all symbols */
+  {
+    LCD_CharPos(1, 1);             /* top left corner */
+    LCD_Symbol(Run);               /* display symbol */
+    Run++;                         /* next symbol */
+  }
+  Ticks[BENCH_SYMBOL] = Profile_Tick() - Start;
+  Ops[BENCH_SYMBOL] = NUM_SYMBOLS;
+  Cells[BENCH_SYMBOL] = (uint16_t)UI.SymbolSize_X * UI.SymbolSize_Y;
+  #endif
+
+
+  /*
+   *  show results
+   *  - label, operations/s, pixels/s
+   */
+
+  LCD_Clear();
+  #ifdef UI_SERIAL_COPY
+  Display_Serial_On();             /* enable serial output & NL */
+  #endif
+  #ifdef UI_COLORED_TITLES
+    /* display: Display Bench */
+    Display_ColoredEEString(DisplayBench_str, COLOR_TITLE);
+  #else
+    Display_EEString(DisplayBench_str);   /* display: Display Bench */
+  #endif
+  UI.LineMode = LINE_KEY | LINE_KEEP;   /* next-line mode: wait for key */
+
+  Test = 0;
+  while (Test < BENCH_TESTS)       /* all tests */
+  {
+    /* get label */
+    switch (Test)
+    {
+      case BENCH_CLEAR:
+        Label = BenchClear_str;
+        break;
+
+      case BENCH_LINE:
+        Label = BenchLine_str;
+        break;
+
+      case BENCH_CHAR:
+        Label = BenchChar_str;
+        break;
+
+      default:
+        Label = BenchSymbol_str;
+        break;
+    }
+
+    Display_NextLine();
+    Display_EEString_Space(Label);                /* display: label */
+    Display_Value(Bench_Rate(Ops[Test], Ticks[Test]), 0, 0);   /* ops/s */
+
+    #ifdef LCD_GRAPHIC
+    Display_Space();
+    Start = (uint32_t)Ops[Test] * Cells[Test];   /* char cells */
+    Start *= Cell;                               /* pixels */
+    Display_Value(Bench_Rate(Start, Ticks[Test]), 0, 0);   /* pixels/s */
+    #endif
+
+    Test++;                        /* next test */
+  }
+
+  #ifdef UI_SERIAL_COPY
+  Display_Serial_Off();            /* disable serial output & NL */
+  #endif
+
+  /* wait for user input */
+  WaitKey();
+}
+
+
+/* clean up local constants */
+#undef BENCH_TICKS_S
+#undef BENCH_RUNS
+#undef BENCH_CLEAR
+#undef BENCH_LINE
+#undef BENCH_CHAR
+#undef BENCH_SYMBOL
+#undef BENCH_TESTS
+
+#endif
+
+
+
 /* ************************************************************************
  *   color code
  * ************************************************************************ */
@@ -1825,8 +3199,7 @@ void Display_ColorCode(uint16_t Value, int8_t Scale, uint16_t TolBand)
   uint16_t          Color = 0;          /* display color */
 
   /* convert value into string */
-  utoa(Value, OutBuffer, 10);           /* radix 10: max. 3 chars + /0 */
-  Length = strlen(OutBuffer);           /* get string length */
+  Length = Value2String(Value);         /* max. 3 chars + /0 */
 
 
   /*
@@ -1895,6 +3268,16 @@ void Display_ColorCode(uint16_t Value, int8_t Scale, uint16_t TolBand)
  *   clean-up of local constants
  * ************************************************************************ */
 
+#ifdef UI_SHADOW_GRID
+  #undef SHADOW_BLANK
+  #undef SHADOW_UNKNOWN
+  #undef SHADOW_NONE
+#endif
+
+#ifdef UI_CENTER_ALIGN
+  #undef CENTER_BUFFER
+#endif
+
 /* source management */
 #undef DISPLAY_C
 
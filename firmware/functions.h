@@ -34,6 +34,11 @@
   extern void CheckBattery(void);
   #endif
 
+  #ifdef BAT_BACKGROUND
+  extern void SampleBattery(void);
+  extern uint16_t BatteryRuntime(void);
+  #endif
+
 #endif
 
 
@@ -51,6 +56,10 @@
   extern void LCD_Cursor(uint8_t Mode);
   extern void LCD_Char(unsigned char Char);
 
+  #ifdef FUNC_LCD_FLUSH
+  extern void LCD_Flush(void);
+  #endif
+
   #if ! defined (UI_SERIAL_COPY) && ! defined (UI_SERIAL_COMMANDS)
     /* make Display_Char() an alias for LCD_Char() */
     #define Display_Char LCD_Char
@@ -68,6 +77,40 @@
   extern void LCD_Band(uint16_t Color, uint8_t Align);
   #endif
 
+  #ifdef SW_SCOPE
+  extern void LCD_ScopeTrace(uint8_t *Buffer, uint8_t Start, uint8_t Level);
+  #endif
+
+  #ifdef FUNC_CURVE_PLOT
+  extern void LCD_CurvePlot(IV_Type *Buffer, uint8_t Points);
+  #endif
+
+  #ifdef UI_MONITOR_GRAPH
+  extern void LCD_GraphInit(void);
+  extern void LCD_GraphBar(uint8_t Level);
+  extern void LCD_GraphTrend(uint8_t *Buffer, uint8_t Pos);
+  #endif
+
+  #ifdef UI_HW_SCROLL
+  extern void LCD_Scroll(void);
+  #endif
+
+  #if defined (UI_SHADOW_GRID) && ! defined (DISPLAY_C)
+    /* map text output to shadow grid functions in display.c */
+    #define LCD_Char         Shadow_Char
+    #define LCD_ClearLine    Shadow_ClearLine
+    #define LCD_Clear        Shadow_Clear
+    #define LCD_Cursor       Shadow_Cursor
+    #ifdef UI_HW_SCROLL
+    #define LCD_Scroll       Shadow_Scroll
+    #endif
+  #elif defined (UI_SERIAL_MIRROR) && ! defined (DISPLAY_C)
+    /* map text output to mirror functions in display.c */
+    #define LCD_Char         Mirror_Char
+    #define LCD_ClearLine    Mirror_ClearLine
+    #define LCD_Clear        Mirror_Clear
+  #endif
+
 #endif
 
 
@@ -86,8 +129,15 @@
     extern void SPI_Write_Bit(uint8_t Bit);
     #endif
   extern void SPI_Write_Byte(uint8_t Byte);
+    #ifdef SPI_REPEAT
+    extern void SPI_Write_Repeat(uint8_t *Data, uint8_t Size, uint16_t Count);
+    #endif
+    #ifdef SPI_BLOCK
+    extern void SPI_Write_Block(uint8_t *Data, uint16_t Size);
+    #endif
     #ifdef SPI_RW
     extern uint8_t SPI_WriteRead_Byte(uint8_t Byte);
+    extern void SPI_Read_Block(uint8_t *Data, uint8_t Size);
     #endif
   #endif
 
@@ -108,6 +158,14 @@
     #ifdef I2C_RW
     extern uint8_t I2C_ReadByte(uint8_t Type);
     #endif
+    #ifdef I2C_TWI_IRQ
+    extern void I2C_Queue(uint8_t Address, uint8_t *Data, uint8_t Size, uint8_t Mode, void (*Callback)(uint8_t));
+    extern uint8_t I2C_Busy(void);
+    extern void I2C_Flush(void);
+    #endif
+    #ifdef SW_I2C_SCAN
+    extern void I2C_Scan_Tool(void);
+    #endif
   #endif
 
 #endif
@@ -122,9 +180,15 @@
   #ifdef HW_SERIAL
   extern void Serial_Setup(void);
   extern void Serial_WriteByte(uint8_t Byte);
+    #ifdef SERIAL_TX_BUFFER
+    extern void Serial_Flush(void);
+    #endif
     #ifdef SERIAL_RW
     void Serial_Ctrl(uint8_t Control);
     #endif
+    #ifdef TIMER_MANAGER
+    extern void Serial_RX_Sample(void);
+    #endif
 
     extern void Serial_Char(unsigned char Char);
 
@@ -132,6 +196,11 @@
     extern void Serial_NewLine(void);
     #endif
 
+    #ifdef SERIAL_MULTIDROP
+    extern uint8_t Serial_CheckAddress(void);
+    extern uint8_t Serial_Address(uint8_t Addr);
+    #endif
+
   #endif
 
 #endif
@@ -155,15 +224,43 @@
   extern uint8_t OneWire_ResetBus(void);
   #endif
 
+  #ifdef ONEWIRE_ASYNC
+  extern void OneWire_Async_Reset(void);
+  extern void OneWire_Async_Transfer(uint8_t *Data, uint8_t Bits, uint8_t Mode);
+  extern uint8_t OneWire_Async_Busy(void);
+  extern uint8_t OneWire_Async_Wait(void);
+  #endif
+
+  #ifdef ONEWIRE_OVERDRIVE
+  extern void OneWire_SetSpeed(uint8_t Speed);
+  extern uint8_t OneWire_Overdrive(void);
+  #endif
+
   #ifdef SW_ONEWIRE_SCAN
   extern uint8_t OneWire_Scan_Tool(void);
   #endif
 
   #ifdef SW_DS18B20
+  extern uint8_t DS18B20_Convert(void);
+  extern uint8_t DS18B20_GetTemperature(uint8_t *ROM, int32_t *Value, int8_t *Scale);
   extern uint8_t DS18B20_ReadTemperature(int32_t *Value, int8_t *Scale);
+  extern void DS18B20_DisplayTemperature(int32_t Value, int8_t Scale);
   extern uint8_t DS18B20_Tool(void);
   #endif
 
+  #ifdef DS18B20_MULTI
+  extern uint8_t DS18B20_Scan(uint8_t *ROM, uint8_t Max);
+  #endif
+
+  #ifdef DS18B20_ROM_CACHE
+  extern uint8_t DS18B20_LoadCache(uint8_t *ROM, uint8_t Max);
+  extern void DS18B20_SaveCache(uint8_t *ROM, uint8_t Sensors);
+  #endif
+
+  #ifdef DS18B20_RESOLUTION
+  extern uint8_t DS18B20_SetResolution(uint8_t Bits);
+  #endif
+
   #ifdef SW_DS18S20
   extern uint8_t DS18S20_ReadTemperature(int32_t *Value, int8_t *Scale);
   extern uint8_t DS18S20_Tool(void);
@@ -190,6 +287,7 @@
 #ifndef MAX6675_C
 
   extern void MAX6675_BusSetup(void);
+  extern uint8_t MAX6675_ReadTemperature(int32_t *Value, int8_t *Scale);
   extern void MAX6675_Tool(void);
 
 #endif
@@ -202,6 +300,7 @@
 #ifndef MAX31855_C
 
   extern void MAX31855_BusSetup(void);
+  extern uint8_t MAX31855_ReadTemperature(int32_t *Value, int8_t *Scale);
   extern void MAX31855_Tool(void);
 
 #endif
@@ -229,6 +328,27 @@
 
 #ifndef DISPLAY_C
 
+  #ifdef UI_SERIAL_MIRROR
+  extern void Mirror_Char(unsigned char Char);
+  extern void Mirror_ClearLine(uint8_t Line);
+  extern void Mirror_Clear(void);
+  #endif
+
+  #ifdef UI_SHADOW_GRID
+  extern void Shadow_Flush(void);
+  extern void Shadow_Char(unsigned char Char);
+  extern void Shadow_ClearLine(uint8_t Line);
+  extern void Shadow_Clear(void);
+  extern void Shadow_Cursor(uint8_t Mode);
+  #ifdef UI_HW_SCROLL
+  extern void Shadow_Scroll(void);
+  #endif
+  #ifdef UI_PARTIAL_REFRESH
+  extern void Shadow_Refresh(uint8_t Keep);
+  extern void Shadow_RefreshDone(uint8_t Line);
+  #endif
+  #endif
+
   extern void Display_NextLine(void);
   #if defined (UI_KEY_HINTS) || defined (UI_BATTERY_LASTLINE)
   extern void Display_LastLine(void);
@@ -304,6 +424,8 @@
   extern void Display_HexValue(uint16_t Value, uint8_t Bits);
   #endif
 
+  extern uint8_t Value2String(uint32_t Value);
+
   #if defined (FUNC_DISPLAY_FULLVALUE) || defined (FUNC_DISPLAY_SIGNEDFULLVALUE)
   extern void Display_FullValue(uint32_t Value, uint8_t DecPlaces, unsigned char Unit);
   #endif
@@ -323,6 +445,11 @@
   extern void Display_EIA96(uint8_t Index, int8_t Scale);
   #endif
 
+  #if defined (SYMBOLS_RLE) || defined (FONT_RLE)
+  extern void Bitmap_Start(uint8_t *Data, uint8_t *Row, uint8_t Bytes);
+  extern void Bitmap_Row(uint8_t *Row, uint8_t Bytes);
+  #endif
+
   #ifdef SW_SYMBOLS
   extern void Display_FancySemiPinout(uint8_t Line);
   #endif
@@ -343,6 +470,10 @@
   extern void SymbolTest(void);
   #endif
 
+  #ifdef SW_DISPLAY_BENCH
+  extern void DisplayBench(void);
+  #endif
+
   #ifdef FUNC_COLORCODE
   extern void Display_ColorCode(uint16_t Value, int8_t Scale, uint16_t TolBand);
   #endif
@@ -358,6 +489,38 @@
 
   extern void MilliSleep(uint16_t Time);
 
+  #ifdef SAVE_POWER
+  extern void IdleWait(uint16_t Time);
+  #endif
+
+  #ifdef FUNC_TIMEBASE
+  extern void Profile_Init(void);
+  extern uint32_t Profile_Tick(void);
+  #endif
+
+  #ifdef FUNC_TIMESTAMP
+  extern void Timestamp_Start(void);
+  extern void Timestamp_Stop(void);
+  #endif
+
+  extern uint8_t Capture_Wait(uint32_t *Ticks, uint16_t Timeout);
+
+  #ifdef SYSTEM_TICK
+  extern uint32_t SysTick_Get(void);
+  extern void SysTimer_Start(uint8_t ID, uint16_t Time, uint16_t Period);
+  extern uint8_t SysTimer_Expired(uint8_t ID);
+  #endif
+
+  #ifdef SW_PROFILER
+  extern void Profile_Reset(void);
+  extern void Profile_Add(uint8_t Stage, uint32_t Start);
+  #endif
+
+  #ifdef TIMER_MANAGER
+  extern uint8_t Timer_Claim(uint8_t Timer, uint8_t Owner);
+  extern void Timer_Release(uint8_t Timer, uint8_t Owner);
+  #endif
+
 #endif
 
 
@@ -375,9 +538,15 @@
   extern void ManageAdjustmentStorage(uint8_t Mode, uint8_t ID);
 
   extern void ShowAdjustmentValues(void);
+  #ifdef ADJUST_CONVERGE
+  extern uint8_t Compare_Adjust(uint16_t Value1, uint16_t Value2, uint8_t Tolerance);
+  #endif
   extern uint8_t SelfAdjustment(void);
+  #ifdef SW_LEAD_ADJUST
+  extern uint8_t LeadAdjustment(void);
+  #endif
 
-  extern uint8_t SelfTest(void);
+  extern uint8_t SelfTest(uint8_t Mode);
 
 #endif
 
@@ -391,6 +560,20 @@
   #ifdef UI_SERIAL_COMMANDS
   extern uint8_t GetCommand(void);
   extern uint8_t RunCommand(uint8_t ID);
+  extern uint8_t ProbeCanceled(void);
+    #ifdef SW_BURST
+    extern void Burst_Record(void);
+    extern void Burst_Done(void);
+    extern uint8_t Burst_WaitPart(void);
+    #endif
+    #ifdef SW_REMOTE_TOOLS
+    extern uint8_t Tool_Command(void);
+    extern void Tool_Done(uint8_t Flag);
+    extern uint8_t Tool_RecordStart(void);
+    extern void Tool_RecordField(const unsigned char *Name, int32_t Value, int8_t Scale, unsigned char Unit);
+    extern void Tool_RecordEnd(void);
+    extern void Tool_CapRecord(Capacitor_Type *Cap, uint16_t ESR);
+    #endif
   #endif
 
 #endif
@@ -402,6 +585,12 @@
 
 #ifndef USER_C
 
+  #ifdef FUNC_SCRATCH
+  extern void *Scratch_Acquire(uint8_t Owner);
+  extern void Scratch_Release(uint8_t Owner);
+  #endif
+
+  extern uint32_t Power10(uint8_t Exponent);
   extern int8_t CmpValue(uint32_t Value1, int8_t Scale1,
     uint32_t Value2, int8_t Scale2);
   extern uint32_t RescaleValue(uint32_t Value, int8_t Scale, int8_t NewScale);
@@ -414,6 +603,10 @@
   extern int32_t RoundSignedValue(int32_t Value, uint8_t Scale, uint8_t RoundScale);
   #endif
 
+  #ifdef FUNC_STATS_SQRT
+  extern uint16_t Stats_Sqrt(uint32_t Value);
+  #endif
+
   #ifdef FUNC_CELSIUS2FAHRENHEIT
   extern int32_t Celsius2Fahrenheit(int32_t Value, uint8_t Scale);
   #endif
@@ -422,6 +615,16 @@
   extern void PassiveBuzzer(uint8_t Mode);
   #endif
 
+  #ifdef INPUT_QUEUE
+  extern void Key_Scan(uint16_t Time);
+  extern uint8_t Key_Get(void);
+  extern void Key_Flush(void);
+  #endif
+
+  #ifdef ENCODER_PCINT
+  extern void Encoder_Init(void);
+  #endif
+
   extern uint8_t TestKey(uint16_t Timeout, uint8_t Mode);
   extern void WaitKey(void);
   #ifdef FUNC_SMOOTHLONGKEYPRESS
@@ -431,8 +634,15 @@
   extern int8_t ShortCircuit(uint8_t Mode);
 
   extern void MarkItem(uint8_t Item, uint8_t Selected);
+  extern uint8_t MenuTool(uint8_t Items, uint8_t Type, void *Menu[], unsigned char *Unit);
 
   extern void AdjustmentMenu(uint8_t Mode);
+  #ifdef UI_PRESETS
+  extern void PresetMenu(void);
+  #endif
+  #ifdef UI_ENGLISH_2ND
+  extern void LanguageMenu(void);
+  #endif
   extern uint8_t MainMenu(void);
 
 #endif
@@ -461,6 +671,10 @@
   extern void IR_RemoteControl(void);
   #endif
 
+  #ifdef TIMER_MANAGER
+  extern void IR_Send_Next(void);
+  #endif
+
 #endif
 
 
@@ -470,10 +684,25 @@
 
 #ifndef TOOLS_MISC_C
 
+  #ifdef FUNC_COMP_EDGE
+  extern void Comparator_Arm(uint8_t Channel, uint8_t Mode);
+  extern void Comparator_Disarm(void);
+  extern void Comparator_CheckBattery(void);
+  #endif
+
   #ifdef FUNC_PROBE_PINOUT
   extern void ProbePinout(uint8_t Mode);
   #endif
 
+  #ifdef UI_MONITOR_GRAPH
+  extern void Graph_Init(Graph_Type *Graph);
+  extern void Graph_Add(Graph_Type *Graph, uint32_t Value, int8_t Scale);
+  #endif
+
+  #ifdef ZENER_AUTO_HOLD
+  extern void Zener_Boost(uint8_t State);
+  #endif
+
   #ifdef HW_ZENER
   extern void Zener_Tool(void);
   #endif
@@ -494,6 +723,10 @@
   extern void OptoCoupler_Tool(void);
   #endif
 
+  #ifdef OPTO_CTR_SWEEP
+  extern uint32_t Opto_CTR_Step(uint8_t Mode, uint32_t *I_f);
+  #endif
+
   #ifdef SW_CAP_LEAKAGE
   extern void Cap_Leakage(void);
   #endif
@@ -510,6 +743,11 @@
   extern void Monitor_L(void);
   #endif
 
+  #if defined (SW_MONITOR_RCL) || defined (SW_MONITOR_RL)
+  extern uint8_t Monitor_Stable(uint32_t Value, int8_t Scale, uint32_t Last, int8_t LastScale);
+  extern void Monitor_Indicator(uint8_t Count);
+  #endif
+
   #ifdef SW_MONITOR_RCL
   extern void Monitor_RCL(void);
   #endif
@@ -518,6 +756,77 @@
   extern void Monitor_RL(void);
   #endif
 
+  #ifdef THERMOCOUPLE_LOG
+  extern void Thermo_Log(uint8_t (*Read)(int32_t *Value, int8_t *Scale), uint16_t Interval);
+  #endif
+
+  #ifdef SW_SORTING
+  extern uint8_t Sort_Measure(uint8_t Type, Fingerprint_Type *Part);
+  extern uint8_t Sort_Bin(Fingerprint_Type *Nominal, Fingerprint_Type *Part, uint8_t Tolerance);
+  extern void Sort_Value(Fingerprint_Type *Part);
+  extern void Sorting_Tool(void);
+  #endif
+
+  #ifdef SW_LED_BINNING
+  extern void LED_Binning_Tool(void);
+  #endif
+
+  #ifdef FUNC_COMPARE
+  extern uint8_t Compare_Init(Golden_Type *Ref);
+  extern uint16_t Compare_Vf(uint8_t Anode, uint8_t Cathode);
+  extern uint8_t Compare_Measure(Golden_Type *Ref, Golden_Type *Part);
+  #endif
+
+  #ifdef SW_COMPARE
+  extern uint8_t Compare_Value(uint32_t RefValue, int8_t RefScale, uint32_t Value, int8_t Scale);
+  extern void Compare_Show(uint8_t Line, const unsigned char *String, int32_t Value, int8_t Scale, unsigned char Unit, uint8_t Bin);
+  extern void Compare_Tool(void);
+  #endif
+
+  #ifdef SW_MATCHING
+  extern uint32_t Match_Spread(Match_Type *Parts, uint8_t *Index, uint8_t Size, uint16_t *Value, uint16_t *U);
+  extern void Match_Report(Match_Type *Parts, uint8_t Count, uint8_t Size);
+  extern void Matching_Tool(void);
+  #endif
+
+  #ifdef SW_HISTORY
+  extern void History_Add(void);
+  extern History_Type *History_Get(uint8_t Age);
+  extern void History_Part(History_Type *Entry);
+  extern void History_Value(History_Type *Entry, uint8_t Mode);
+    #ifdef UI_SERIAL_COMMANDS
+    extern uint8_t History_Send(void);
+    #endif
+  extern void History_Tool(void);
+  #endif
+
+  #ifdef SW_REPEAT_STATS
+  extern void Repeat_Reset(Repeat_Type *Stats, uint8_t Quantity);
+  extern void Repeat_Add(Repeat_Type *Stats, uint32_t Value, int8_t Scale);
+  extern void Repeat_Show(Repeat_Type *Stats, uint8_t Mode);
+  extern uint8_t Repeat_Run(Repeat_Type *Stats, uint8_t Mode);
+    #ifdef UI_SERIAL_COMMANDS
+    extern uint8_t Repeat_Send(void);
+    #endif
+  extern void Repeat_Tool(void);
+  #endif
+
+  #ifdef SW_STACK_CHECK
+  extern void Memory_Show(uint8_t Mode);
+  extern void Memory_Tool(void);
+  #endif
+
+  #ifdef SW_PERF_COUNTERS
+  extern void Perf_Show(uint8_t Mode);
+  extern void Perf_Tool(void);
+  #endif
+
+  #ifdef SW_LOGGER
+  extern uint16_t Logger_Select(uint8_t Line, uint8_t Items, const uint16_t *Table, uint8_t Index, uint8_t DecPlaces, unsigned char Unit);
+  extern uint8_t Logger_Sample(uint8_t Source, int32_t *Value, int8_t *Scale);
+  extern void Logger_Tool(void);
+  #endif
+
   #ifdef HW_LOGIC_PROBE
   extern void LogicProbe(void);
   #endif
@@ -534,6 +843,16 @@
   extern void PhotodiodeCheck(void);
   #endif
 
+  #ifdef SW_SCOPE
+  extern uint8_t Scope_Capture(uint8_t *Buffer, uint8_t Mode, uint8_t Level);
+  extern void Scope_Tool(void);
+  #endif
+
+  #ifdef SW_CURVE_TRACER
+  extern void IV_Measure(IV_Type *Point, uint8_t Config);
+  extern void CurveTracer_Tool(void);
+  #endif
+
 #endif
 
 
@@ -551,6 +870,10 @@
   extern void PWM_Tool(void);
   #endif
 
+  #ifdef PWM_SWEEP
+  extern void PWM_Sweep(uint32_t Start, uint32_t Stop, uint8_t Ratio);
+  #endif
+
   #ifdef SW_SERVO
   extern void Servo_Check(void);
   #endif
@@ -559,6 +882,10 @@
   extern void SquareWave_SignalGenerator(void);
   #endif
 
+  #ifdef SW_DDS
+  extern void DDS_Generator(void);
+  #endif
+
 #endif
 
 
@@ -576,10 +903,19 @@
   extern void RingTester(void);
   #endif
 
+  #ifdef CRYSTAL_RINGDOWN
+  extern uint16_t Crystal_Ring(uint16_t *Periods, uint32_t *Ticks);
+  extern void CrystalRingdown(void);
+  #endif
+
   #ifdef HW_EVENT_COUNTER
   extern void EventCounter(void);
   #endif
 
+  #ifdef EVENT_COUNTER_LOG
+  extern uint8_t EventLog_Send(void);
+  #endif
+
 #endif
 
 
@@ -605,14 +941,23 @@
   extern void SemiPinDesignators(void);
   extern void GetGateThreshold(uint8_t Type);
   extern uint32_t Get_hfe_c(uint8_t Type);
-  extern void GetLeakageCurrent(uint8_t Mode);
+  extern void GetLeakageCurrent(uint8_t Mode, uint16_t U_Hint);
+
+  #ifdef SW_HFE_SWEEP
+  extern void Get_hFE_Sweep(uint8_t Type);
+  #endif
+
+  #ifdef SW_REPEAT_STATS
+  extern uint32_t Get_hFE_C(uint8_t Type);
+  #endif
 
   extern Diode_Type *SearchDiode(uint8_t A, uint8_t C);
   extern void CheckDiode(void);
 
+  extern uint8_t ReversedBodyDiode(void);
   extern void VerifyMOSFET(void);
   extern void CheckTransistor(uint8_t BJT_Type, uint16_t U_Rl);
-  extern void CheckDepletionModeFET(uint16_t U_Rl);
+  extern void CheckDepletionModeFET(Perm_Type *Perm);
 
   extern uint8_t CheckThyristorTriac(void);
   extern void CheckPUT(void);
@@ -660,12 +1005,17 @@
   extern uint16_t MeasureESR(Capacitor_Type *Cap);
   #endif
 
+  extern uint8_t CapPossible(uint8_t Probe1, uint8_t Probe2);
   extern void MeasureCap(uint8_t Probe1, uint8_t Probe2, uint8_t ID);
 
   #ifdef HW_ADJUST_CAP
   extern uint8_t RefCap(void);
   #endif
 
+  #ifdef ADJUST_CAP_DRIFT
+  extern void RefCap_Drift(void);
+  #endif
+
 #endif
 
 
@@ -680,9 +1030,15 @@
   extern void RestoreProbes(void);
   extern void BackupProbes(void);
   extern uint8_t ShortedProbes(void);
+  #ifdef FUNC_PART_PRESENT
+  extern uint8_t PartPresent(void);
+  #endif
   #if defined (SW_ESR) || defined (SW_OLD_ESR)
   extern void DischargeCap(uint8_t Probe1, uint8_t Probe2);
   #endif
+  #ifdef DISCHARGE_ADAPTIVE
+  extern uint16_t DischargeTime(uint16_t U_1, uint16_t U_2, uint8_t Interval);
+  #endif
   extern void DischargeProbes(void);
   extern void PullProbe(uint8_t Probe, uint8_t Mode);
 
@@ -692,6 +1048,16 @@
   #endif
 
   extern void CheckProbes(uint8_t Probe1, uint8_t Probe2, uint8_t Probe3);
+  #if defined (PROBE_EARLY_EXIT) || defined (PROBE_FINGERPRINT)
+  extern uint8_t IsolatedProbe(uint8_t Probe1, uint8_t Probe2);
+  #endif
+  #ifdef PROBE_EARLY_EXIT
+  extern uint8_t CheckEarlyExit(uint8_t Probe);
+  #endif
+  #ifdef PROBE_FINGERPRINT
+  extern void SaveFingerprint(Fingerprint_Type *Print);
+  extern uint8_t QuickReprobe(Fingerprint_Type *Print);
+  #endif
   extern void CheckAlternatives(void);
 
 #endif
@@ -703,8 +1069,44 @@
 
 #ifndef ADC_C
 
+  extern uint16_t ADC_Voltage(uint32_t Value, uint8_t Ref, uint8_t Samples);
+  extern uint8_t ADC_SetReference(uint8_t Channel);
+
+  #ifdef ADC_CLOCK_PROFILES
+  extern void ADC_Profile(uint8_t Profile);
+  #endif
+
+  #ifdef HW_ADS1115
+  extern uint8_t ADS1115_WriteConfig(uint16_t Config);
+  extern uint8_t ADS1115_ReadConversion(int16_t *Value);
+  extern void ADC_Backend(uint8_t Backend);
+  extern uint32_t ReadU_Ext(uint8_t Channel, uint8_t Samples);
+  #endif
+
+  #ifdef ADC_ADAPTIVE
+  extern uint8_t ADC_Stable(uint8_t Samples, int32_t Sum, uint32_t Sum2);
+  #endif
+
+  extern uint16_t ReadU_Desc(uint8_t Channel, uint16_t Desc);
   extern uint16_t ReadU(uint8_t Channel);
+  extern void ReadU_Multi(uint8_t Mask, uint16_t *U);
+  extern uint32_t ReadU_Raw(uint8_t Channel);
+  extern uint32_t ADC_Counts(uint16_t U);
+
+  #ifdef ADC_OVERSAMPLING
+  extern uint16_t ReadU_HiRes(uint8_t Channel, uint8_t Bits);
+  #endif
+
+  #ifdef ADC_INTERRUPT
+  extern void ADC_Run(uint8_t Channel);
+  extern void ADC_Start(uint8_t Channel, uint16_t Desc);
+  extern uint8_t ADC_Ready(void);
+  extern uint16_t ADC_Collect(void);
+  #endif
 
+  #ifdef ADC_SETTLE
+  extern uint16_t ReadU_Settled(uint8_t Channel, uint8_t Timeout);
+  #endif
   extern uint16_t ReadU_5ms(uint8_t Channel);
   extern uint16_t ReadU_20ms(uint8_t Channel);
 
@@ -764,6 +1166,20 @@
 #endif
 
 
+/* settling times: idle sleep instead of busy waiting */
+#ifdef SAVE_POWER
+  #define settle5ms()        IdleWait(5)
+  #define settle10ms()       IdleWait(10)
+  #define settle20ms()       IdleWait(20)
+  #define settle50ms()       IdleWait(50)
+#else
+  #define settle5ms()        wait5ms()
+  #define settle10ms()       wait10ms()
+  #define settle20ms()       wait20ms()
+  #define settle50ms()       wait50ms()
+#endif
+
+
 /* ************************************************************************
  *   EOF
  * ************************************************************************ */
@@ -0,0 +1,37 @@
+/* ************************************************************************
+ *
+ *   host build: stub for <avr/eeprom.h>
+ *
+ *   (c) 2026 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/*
+ *  hints:
+ *  - EEPROM variables are plain RAM variables
+ *  - functions are provided by host/mock.c
+ */
+
+#ifndef HOST_AVR_EEPROM_H
+#define HOST_AVR_EEPROM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define EEMEM
+
+extern uint8_t eeprom_read_byte(const uint8_t *Addr);
+extern uint16_t eeprom_read_word(const uint16_t *Addr);
+extern uint32_t eeprom_read_dword(const uint32_t *Addr);
+extern void eeprom_read_block(void *Dst, const void *Src, size_t Size);
+extern void eeprom_write_byte(uint8_t *Addr, uint8_t Value);
+extern void eeprom_write_word(uint16_t *Addr, uint16_t Value);
+extern void eeprom_write_block(const void *Src, void *Dst, size_t Size);
+extern void eeprom_update_byte(uint8_t *Addr, uint8_t Value);
+extern void eeprom_update_word(uint16_t *Addr, uint16_t Value);
+extern void eeprom_update_block(const void *Src, void *Dst, size_t Size);
+
+#define eeprom_busy_wait()
+
+#endif
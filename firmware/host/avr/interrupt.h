@@ -0,0 +1,29 @@
+/* ************************************************************************
+ *
+ *   host build: stub for <avr/interrupt.h>
+ *
+ *   (c) 2026 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/*
+ *  hints:
+ *  - ISRs are plain functions, host/mock.c calls them
+ *  - sei() and cli() just manage the I flag in SREG
+ */
+
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+#define ISR(Vector, ...)      void Vector(void); void Vector(void)
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+#define ISR_NAKED
+#define EMPTY_INTERRUPT(Vector)    void Vector(void) {}
+
+#define sei()            (SREG |= (1 << SREG_I))
+#define cli()            (SREG &= ~(1 << SREG_I))
+#define reti()
+
+#endif
@@ -0,0 +1,391 @@
+/* ************************************************************************
+ *
+ *   host build: stub for <avr/io.h> (ATmega328)
+ *
+ *   (c) 2026 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/*
+ *  hints:
+ *  - I/O registers are plain variables defined by host/mock.c
+ *  - ADCSRA is routed through Host_ADCSRA(), which runs a pending
+ *    conversion on the simulated probe network
+ */
+
+#ifndef HOST_AVR_IO_H
+#define HOST_AVR_IO_H
+
+#include <stdint.h>
+
+
+/*
+ *  registers
+ *  - host/mock.c defines HOST_REG8() and HOST_REG16() to allocate them
+ */
+
+#ifndef HOST_REG8
+  #define HOST_REG8(Name)     extern volatile uint8_t Name;
+  #define HOST_REG16(Name)    extern volatile uint16_t Name;
+#endif
+
+/* I/O ports */
+HOST_REG8(PINB)
+HOST_REG8(DDRB)
+HOST_REG8(PORTB)
+HOST_REG8(PINC)
+HOST_REG8(DDRC)
+HOST_REG8(PORTC)
+HOST_REG8(PIND)
+HOST_REG8(DDRD)
+HOST_REG8(PORTD)
+HOST_REG8(TIFR0)
+HOST_REG8(TIFR1)
+HOST_REG8(TIFR2)
+HOST_REG8(PCIFR)
+HOST_REG8(EIFR)
+HOST_REG8(EIMSK)
+HOST_REG8(GPIOR0)
+HOST_REG8(EECR)
+HOST_REG8(EEDR)
+HOST_REG8(EEARL)
+HOST_REG8(EEARH)
+HOST_REG8(GPIOR1)
+HOST_REG8(GPIOR2)
+HOST_REG8(GTCCR)
+HOST_REG8(TCCR0A)
+HOST_REG8(TCCR0B)
+HOST_REG8(TCNT0)
+HOST_REG8(OCR0A)
+HOST_REG8(OCR0B)
+HOST_REG8(SPCR)
+HOST_REG8(SPSR)
+HOST_REG8(SPDR)
+HOST_REG8(ACSR)
+HOST_REG8(SMCR)
+HOST_REG8(MCUSR)
+HOST_REG8(MCUCR)
+HOST_REG8(SPMCSR)
+HOST_REG8(SPL)
+HOST_REG8(SPH)
+HOST_REG8(SREG)
+HOST_REG8(WDTCSR)
+HOST_REG8(CLKPR)
+HOST_REG8(PRR)
+HOST_REG8(OSCCAL)
+HOST_REG8(PCICR)
+HOST_REG8(EICRA)
+HOST_REG8(PCMSK0)
+HOST_REG8(PCMSK1)
+HOST_REG8(PCMSK2)
+HOST_REG8(TIMSK0)
+HOST_REG8(TIMSK1)
+HOST_REG8(TIMSK2)
+HOST_REG8(ADCL)
+HOST_REG8(ADCH)
+HOST_REG8(ADCSRB)
+HOST_REG8(ADMUX)
+HOST_REG8(DIDR0)
+HOST_REG8(DIDR1)
+HOST_REG8(TCCR1A)
+HOST_REG8(TCCR1B)
+HOST_REG8(TCCR1C)
+HOST_REG8(TCCR2A)
+HOST_REG8(TCCR2B)
+HOST_REG8(TCNT2)
+HOST_REG8(OCR2A)
+HOST_REG8(OCR2B)
+HOST_REG8(ASSR)
+HOST_REG8(TWBR)
+HOST_REG8(TWSR)
+HOST_REG8(TWAR)
+HOST_REG8(TWDR)
+HOST_REG8(TWCR)
+HOST_REG8(TWAMR)
+HOST_REG8(UCSR0A)
+HOST_REG8(UCSR0B)
+HOST_REG8(UCSR0C)
+HOST_REG8(UBRR0L)
+HOST_REG8(UBRR0H)
+HOST_REG8(UDR0)
+HOST_REG8(ICR1L)
+HOST_REG8(ICR1H)
+HOST_REG8(OCR1AL)
+HOST_REG8(OCR1AH)
+HOST_REG8(OCR1BL)
+HOST_REG8(OCR1BH)
+HOST_REG8(TCNT1L)
+HOST_REG8(TCNT1H)
+HOST_REG16(ADCW)
+HOST_REG16(TCNT1)
+HOST_REG16(ICR1)
+HOST_REG16(OCR1A)
+HOST_REG16(OCR1B)
+HOST_REG16(UBRR0)
+HOST_REG16(EEAR)
+HOST_REG16(SP)
+
+/* ADC control: conversion is triggered by accessing the register */
+extern volatile uint8_t *Host_ADCSRA(void);
+#define ADCSRA           (*Host_ADCSRA())
+
+#define _BV(Bit)         (1 << (Bit))
+
+
+/*
+ *  register bits
+ */
+
+#define PB0              0
+#define PB1              1
+#define PB2              2
+#define PB3              3
+#define PB4              4
+#define PB5              5
+#define PB6              6
+#define PB7              7
+#define PC0              0
+#define PC1              1
+#define PC2              2
+#define PC3              3
+#define PC4              4
+#define PC5              5
+#define PC6              6
+#define PD0              0
+#define PD1              1
+#define PD2              2
+#define PD3              3
+#define PD4              4
+#define PD5              5
+#define PD6              6
+#define PD7              7
+#define ADSC             6
+#define ADEN             7
+#define ADATE            5
+#define ADIF             4
+#define ADIE             3
+#define ADPS2            2
+#define ADPS1            1
+#define ADPS0            0
+#define REFS1            7
+#define REFS0            6
+#define ADLAR            5
+#define MUX3             3
+#define MUX2             2
+#define MUX1             1
+#define MUX0             0
+#define ACME             6
+#define ADTS2            2
+#define ADTS1            1
+#define ADTS0            0
+#define ACD              7
+#define ACBG             6
+#define ACO              5
+#define ACI              4
+#define ACIE             3
+#define ACIC             2
+#define ACIS1            1
+#define ACIS0            0
+#define AIN1D            1
+#define AIN0D            0
+#define ICNC1            7
+#define ICES1            6
+#define WGM13            4
+#define WGM12            3
+#define CS12             2
+#define CS11             1
+#define CS10             0
+#define COM1A1           7
+#define COM1A0           6
+#define COM1B1           5
+#define COM1B0           4
+#define WGM11            1
+#define WGM10            0
+#define FOC1A            7
+#define FOC1B            6
+#define ICIE1            5
+#define OCIE1B           2
+#define OCIE1A           1
+#define TOIE1            0
+#define ICF1             5
+#define OCF1B            2
+#define OCF1A            1
+#define TOV1             0
+#define COM0A1           7
+#define COM0A0           6
+#define COM0B1           5
+#define COM0B0           4
+#define WGM01            1
+#define WGM00            0
+#define WGM02            3
+#define CS02             2
+#define CS01             1
+#define CS00             0
+#define OCIE0B           2
+#define OCIE0A           1
+#define TOIE0            0
+#define OCF0B            2
+#define OCF0A            1
+#define TOV0             0
+#define COM2A1           7
+#define COM2A0           6
+#define COM2B1           5
+#define COM2B0           4
+#define WGM21            1
+#define WGM20            0
+#define WGM22            3
+#define CS22             2
+#define CS21             1
+#define CS20             0
+#define OCIE2B           2
+#define OCIE2A           1
+#define TOIE2            0
+#define OCF2B            2
+#define OCF2A            1
+#define TOV2             0
+#define AS2              5
+#define TCN2UB           4
+#define OCR2AUB          3
+#define OCR2BUB          2
+#define TCR2AUB          1
+#define TCR2BUB          0
+#define TSM              7
+#define PSRASY           1
+#define PSRSYNC          0
+#define SPIE             7
+#define SPE              6
+#define DORD             5
+#define MSTR             4
+#define CPOL             3
+#define CPHA             2
+#define SPR1             1
+#define SPR0             0
+#define SPIF             7
+#define WCOL             6
+#define SPI2X            0
+#define TWINT            7
+#define TWEA             6
+#define TWSTA            5
+#define TWSTO            4
+#define TWWC             3
+#define TWEN             2
+#define TWIE             0
+#define TWPS1            1
+#define TWPS0            0
+#define RXC0             7
+#define TXC0             6
+#define UDRE0            5
+#define FE0              4
+#define DOR0             3
+#define UPE0             2
+#define U2X0             1
+#define MPCM0            0
+#define RXCIE0           7
+#define TXCIE0           6
+#define UDRIE0           5
+#define RXEN0            4
+#define TXEN0            3
+#define UCSZ02           2
+#define RXB80            1
+#define TXB80            0
+#define UMSEL01          7
+#define UMSEL00          6
+#define UPM01            5
+#define UPM00            4
+#define USBS0            3
+#define UCSZ01           2
+#define UCSZ00           1
+#define UCPOL0           0
+#define INT1             1
+#define INT0             0
+#define INTF1            1
+#define INTF0            0
+#define ISC11            3
+#define ISC10            2
+#define ISC01            1
+#define ISC00            0
+#define PCIE2            2
+#define PCIE1            1
+#define PCIE0            0
+#define PCIF2            2
+#define PCIF1            1
+#define PCIF0            0
+#define PCINT0           0
+#define PCINT1           1
+#define PCINT2           2
+#define PCINT3           3
+#define PCINT4           4
+#define PCINT5           5
+#define PCINT6           6
+#define PCINT7           7
+#define PCINT8           0
+#define PCINT9           1
+#define PCINT10          2
+#define PCINT11          3
+#define PCINT12          4
+#define PCINT13          5
+#define PCINT14          6
+#define PCINT16          0
+#define PCINT17          1
+#define PCINT18          2
+#define PCINT19          3
+#define PCINT20          4
+#define PCINT21          5
+#define PCINT22          6
+#define PCINT23          7
+#define SE               0
+#define SM0              1
+#define SM1              2
+#define SM2              3
+#define WDIF             7
+#define WDIE             6
+#define WDP3             5
+#define WDCE             4
+#define WDE              3
+#define WDP2             2
+#define WDP1             1
+#define WDP0             0
+#define WDRF             3
+#define BORF             2
+#define EXTRF            1
+#define PORF             0
+#define PUD              4
+#define BODS             6
+#define BODSE            5
+#define IVSEL            1
+#define IVCE             0
+#define EERE             0
+#define EEPE             1
+#define EEMPE            2
+#define EERIE            3
+#define PRADC            0
+#define PRUSART0         1
+#define PRSPI            2
+#define PRTIM1           3
+#define PRTIM0           5
+#define PRTIM2           6
+#define PRTWI            7
+#define CLKPCE           7
+#define ADC0D            0
+#define ADC1D            1
+#define ADC2D            2
+#define ADC3D            3
+#define ADC4D            4
+#define ADC5D            5
+#define SREG_I           7
+#define SREG_T           6
+#define SREG_C           0
+
+
+/*
+ *  memory layout
+ */
+
+#define RAMSTART         0x0100
+#define RAMEND           0x08FF
+#define E2END            0x03FF
+#define FLASHEND         0x7FFF
+#define SPM_PAGESIZE     128
+
+#endif
@@ -0,0 +1,33 @@
+/* ************************************************************************
+ *
+ *   host build: stub for <avr/pgmspace.h>
+ *
+ *   (c) 2026 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/*
+ *  hints:
+ *  - flash and RAM share the same address space
+ */
+
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(String)          (String)
+
+#define pgm_read_byte(Addr)   (*(const uint8_t *)(Addr))
+#define pgm_read_word(Addr)   (*(const uint16_t *)(Addr))
+#define pgm_read_dword(Addr)  (*(const uint32_t *)(Addr))
+#define pgm_read_ptr(Addr)    (*(void * const *)(Addr))
+#define pgm_read_byte_near    pgm_read_byte
+#define pgm_read_word_near    pgm_read_word
+
+#define memcpy_P         memcpy
+#define strlen_P         strlen
+
+#endif
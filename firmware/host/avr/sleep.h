@@ -0,0 +1,32 @@
+/* ************************************************************************
+ *
+ *   host build: stub for <avr/sleep.h>
+ *
+ *   (c) 2026 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/*
+ *  hints:
+ *  - there's no sleeping, sleep_cpu() returns at once
+ */
+
+#ifndef HOST_AVR_SLEEP_H
+#define HOST_AVR_SLEEP_H
+
+#define SLEEP_MODE_IDLE       0
+#define SLEEP_MODE_ADC        2
+#define SLEEP_MODE_PWR_DOWN   4
+#define SLEEP_MODE_PWR_SAVE   6
+#define SLEEP_MODE_STANDBY    12
+#define SLEEP_MODE_EXT_STANDBY     14
+
+#define set_sleep_mode(Mode)  (SMCR = (Mode))
+#define sleep_enable()        (SMCR |= (1 << SE))
+#define sleep_disable()       (SMCR &= ~(1 << SE))
+#define sleep_cpu()
+#define sleep_mode()
+#define sleep_bod_disable()
+
+#endif
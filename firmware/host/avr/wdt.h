@@ -0,0 +1,33 @@
+/* ************************************************************************
+ *
+ *   host build: stub for <avr/wdt.h>
+ *
+ *   (c) 2026 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/*
+ *  hints:
+ *  - there's no watchdog
+ */
+
+#ifndef HOST_AVR_WDT_H
+#define HOST_AVR_WDT_H
+
+#define WDTO_15MS        0
+#define WDTO_30MS        1
+#define WDTO_60MS        2
+#define WDTO_120MS       3
+#define WDTO_250MS       4
+#define WDTO_500MS       5
+#define WDTO_1S          6
+#define WDTO_2S          7
+#define WDTO_4S          8
+#define WDTO_8S          9
+
+#define wdt_enable(Timeout)
+#define wdt_disable()
+#define wdt_reset()
+
+#endif
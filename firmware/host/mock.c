@@ -0,0 +1,585 @@
+/* ************************************************************************
+ *
+ *   host build: simulated probe network and AVR stubs
+ *
+ *   (c) 2026 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/*
+ *  hints:
+ *  - replaces main.c (global variables), wait.S and pause.c
+ *  - supports only the polled ADC (no ADC_INTERRUPT)
+ */
+
+
+/*
+ *  local constants
+ */
+
+/* source management */
+#define MAIN_C
+
+/* allocate I/O registers (see host/avr/io.h) */
+#define HOST_REG8(Name)     volatile uint8_t Name;
+#define HOST_REG16(Name)    volatile uint16_t Name;
+
+/* network */
+#define NODES            3              /* number of probes */
+#define G_FLOAT          1e-9           /* leakage of a floating pin (S) */
+#define R_PULLUP         35000.0        /* MCU's internal pull-up (Ohms) */
+#define V_T              0.02585        /* thermal voltage at 27C (V) */
+#define NEWTON_RUNS      100            /* max. Newton-Raphson iterations */
+
+
+/*
+ *  include header files
+ */
+
+/* local includes */
+#include "config.h"           /* global configuration */
+#include "common.h"           /* common header file */
+#include "variables.h"        /* global variables */
+#include "functions.h"        /* external functions */
+#include "mock.h"             /* simulated probe network */
+
+#ifdef ADC_INTERRUPT
+  #error <<< Host build: ADC_INTERRUPT is not supported! >>>
+#endif
+
+
+/*
+ *  local variables
+ */
+
+/* simulated time */
+uint32_t            Host_Time;          /* in s */
+uint32_t            Host_Conversions;   /* number of ADC conversions */
+
+/* ADC control register */
+uint8_t             ADCSRA_Reg;
+
+/* component models */
+typedef struct
+{
+  uint8_t           Type;               /* HOST_* */
+  uint8_t           A;                  /* probe #1 / anode */
+  uint8_t           B;                  /* probe #2 / cathode */
+  double            Value;              /* resistance / saturation current */
+  double            N;                  /* emission coefficient */
+} Part_Type;
+
+Part_Type           Parts[HOST_PARTS_MAX];
+uint8_t             PartCount;
+
+/* node voltages of last solution (start values for next one) */
+double              Node_V[NODES];
+
+/* ADC channels and pin bits for probes */
+const uint8_t       ADC_Channels[NODES] = {TP1, TP2, TP3};
+const uint8_t       ADC_Bits[NODES] = {(1 << TP1), (1 << TP2), (1 << TP3)};
+const uint8_t       Rl_Bits[NODES] = {(1 << R_RL_1), (1 << R_RL_2), (1 << R_RL_3)};
+const uint8_t       Rh_Bits[NODES] = {(1 << R_RH_1), (1 << R_RH_2), (1 << R_RH_3)};
+
+
+
+/* ************************************************************************
+ *   component models
+ * ************************************************************************ */
+
+
+/*
+ *  remove all component models and reset simulated time
+ */
+
+void Host_Reset(void)
+{
+  uint8_t           n;
+
+  PartCount = 0;
+  Host_Time = 0;
+  Host_Conversions = 0;
+
+  for (n = 0; n < NODES; n++) Node_V[n] = 0.0;
+}
+
+
+
+/*
+ *  add component model
+ *
+ *  requires:
+ *  - Type: HOST_*
+ *  - A: probe ID #1 / anode
+ *  - B: probe ID #2 / cathode
+ *  - Value: resistance (Ohms) / saturation current (A)
+ *  - N: emission coefficient
+ */
+
+void AddPart(uint8_t Type, uint8_t A, uint8_t B, double Value, double N)
+{
+  Part_Type         *Part;
+
+  if (PartCount >= HOST_PARTS_MAX) return;   /* no free slot */
+
+  Part = &Parts[PartCount];
+  Part->Type = Type;
+  Part->A = A;
+  Part->B = B;
+  Part->Value = Value;
+  Part->N = N;
+  PartCount++;
+}
+
+
+
+/*
+ *  add resistor
+ *
+ *  requires:
+ *  - Probe1: probe ID #1
+ *  - Probe2: probe ID #2
+ *  - R: resistance (Ohms)
+ */
+
+void Host_AddResistor(uint8_t Probe1, uint8_t Probe2, double R)
+{
+  AddPart(HOST_RESISTOR, Probe1, Probe2, R, 0.0);
+}
+
+
+
+/*
+ *  add diode
+ *
+ *  requires:
+ *  - Anode: probe ID of anode
+ *  - Cathode: probe ID of cathode
+ *  - I_s: saturation current (A)
+ *  - N: emission coefficient
+ */
+
+void Host_AddDiode(uint8_t Anode, uint8_t Cathode, double I_s, double N)
+{
+  AddPart(HOST_DIODE, Anode, Cathode, I_s, N);
+}
+
+
+
+/* ************************************************************************
+ *   network
+ * ************************************************************************ */
+
+
+/*
+ *  add conductance between node and fixed voltage
+ *
+ *  requires:
+ *  - G: conductance matrix
+ *  - I: current vector
+ *  - Node: node ID
+ *  - R: resistance (Ohms)
+ *  - V: voltage (V)
+ */
+
+void AddSource(double G[NODES][NODES], double I[NODES], uint8_t Node, double R, double V)
+{
+  G[Node][Node] += 1.0 / R;
+  I[Node] += V / R;
+}
+
+
+
+/*
+ *  add conductance between two nodes
+ *
+ *  requires:
+ *  - G: conductance matrix
+ *  - A: node ID #1
+ *  - B: node ID #2
+ *  - Cond: conductance (S)
+ */
+
+void AddConductance(double G[NODES][NODES], uint8_t A, uint8_t B, double Cond)
+{
+  G[A][A] += Cond;
+  G[B][B] += Cond;
+  G[A][B] -= Cond;
+  G[B][A] -= Cond;
+}
+
+
+
+/*
+ *  solve linear system (Gaussian elimination)
+ *
+ *  requires:
+ *  - G: conductance matrix (destroyed)
+ *  - I: current vector (destroyed)
+ *  - V: node voltages (result)
+ */
+
+void Solve(double G[NODES][NODES], double I[NODES], double V[NODES])
+{
+  uint8_t           i, j, k;
+  double            Factor;
+
+  for (i = 0; i < NODES; i++)      /* forward elimination */
+  {
+    for (j = i + 1; j < NODES; j++)
+    {
+      Factor = G[j][i] / G[i][i];
+      for (k = i; k < NODES; k++) G[j][k] -= Factor * G[i][k];
+      I[j] -= Factor * I[i];
+    }
+  }
+
+  for (i = NODES; i > 0; i--)      /* back substitution */
+  {
+    j = i - 1;
+    V[j] = I[j];
+    for (k = i; k < NODES; k++) V[j] -= G[j][k] * V[k];
+    V[j] /= G[j][j];
+  }
+}
+
+
+
+/*
+ *  calculate node voltages for current port settings
+ *  - diodes are linearized around the last solution (Newton-Raphson)
+ */
+
+void UpdateNetwork(void)
+{
+  double            G[NODES][NODES];    /* conductance matrix */
+  double            I[NODES];           /* current vector */
+  double            V[NODES];           /* new node voltages */
+  double            Vcc = HOST_VCC;
+  double            V_d, I_d, G_d, Diff;
+  double            R;
+  uint8_t           Run, n, m;
+  Part_Type         *Part;
+
+  for (Run = 0; Run < NEWTON_RUNS; Run++)
+  {
+    /* reset matrix */
+    for (n = 0; n < NODES; n++)
+    {
+      for (m = 0; m < NODES; m++) G[n][m] = 0.0;
+      I[n] = 0.0;
+    }
+
+    /* tester's output stages */
+    for (n = 0; n < NODES; n++)
+    {
+      G[n][n] += G_FLOAT;               /* leakage */
+
+      /* MCU pin of probe (ADC port) */
+      if (ADC_DDR & ADC_Bits[n])        /* output */
+      {
+        if (ADC_PORT & ADC_Bits[n])     /* high */
+        {
+          AddSource(G, I, n, R_MCU_HIGH / 10.0, Vcc);
+        }
+        else                            /* low */
+        {
+          AddSource(G, I, n, R_MCU_LOW / 10.0, 0.0);
+        }
+      }
+      else if (ADC_PORT & ADC_Bits[n])  /* input with pull-up */
+      {
+        AddSource(G, I, n, R_PULLUP, Vcc);
+      }
+
+      /* Rl (plus MCU pin) */
+      if (R_DDR & Rl_Bits[n])           /* enabled */
+      {
+        if (R_PORT & Rl_Bits[n])        /* pull-up */
+        {
+          AddSource(G, I, n, R_LOW + R_MCU_HIGH / 10.0, Vcc);
+        }
+        else                            /* pull-down */
+        {
+          AddSource(G, I, n, R_LOW + R_MCU_LOW / 10.0, 0.0);
+        }
+      }
+
+      /* Rh */
+      if (R_DDR & Rh_Bits[n])           /* enabled */
+      {
+        if (R_PORT & Rh_Bits[n])        /* pull-up */
+        {
+          AddSource(G, I, n, R_HIGH, Vcc);
+        }
+        else                            /* pull-down */
+        {
+          AddSource(G, I, n, R_HIGH, 0.0);
+        }
+      }
+    }
+
+    /* component models */
+    for (n = 0; n < PartCount; n++)
+    {
+      Part = &Parts[n];
+
+      if (Part->Type == HOST_RESISTOR)
+      {
+        R = Part->Value;
+        AddConductance(G, Part->A, Part->B, 1.0 / R);
+      }
+      else if (Part->Type == HOST_DIODE)
+      {
+        /* linear companion model at last solution */
+        V_d = Node_V[Part->A] - Node_V[Part->B];
+        if (V_d > 1.5) V_d = 1.5;       /* keep exp() sane */
+        I_d = Part->Value * (exp(V_d / (Part->N * V_T)) - 1.0);
+        G_d = Part->Value / (Part->N * V_T) * exp(V_d / (Part->N * V_T));
+        G_d += 1e-12;                   /* minimum conductance */
+        I_d -= G_d * V_d;               /* equivalent current source */
+
+        AddConductance(G, Part->A, Part->B, G_d);
+        I[Part->A] -= I_d;
+        I[Part->B] += I_d;
+      }
+    }
+
+    Solve(G, I, V);
+
+    /* update solution, limit steps for convergence */
+    Diff = 0.0;
+    for (n = 0; n < NODES; n++)
+    {
+      V_d = V[n] - Node_V[n];
+      if (V_d > 0.1) V_d = 0.1;
+      else if (V_d < -0.1) V_d = -0.1;
+      Node_V[n] += V_d;
+      Diff += fabs(V_d);
+    }
+
+    if (Diff < 1e-7) break;             /* converged */
+  }
+}
+
+
+
+/*
+ *  get voltage at probe for current port settings
+ *
+ *  requires:
+ *  - Probe: probe ID
+ *
+ *  returns:
+ *  - voltage (V)
+ */
+
+double Host_Voltage(uint8_t Probe)
+{
+  UpdateNetwork();
+
+  return Node_V[Probe];
+}
+
+
+
+/* ************************************************************************
+ *   ADC
+ * ************************************************************************ */
+
+
+/*
+ *  run ADC conversion based on ADMUX
+ */
+
+void Convert(void)
+{
+  double            U = 0.0;       /* input voltage */
+  double            U_Ref;         /* reference voltage */
+  uint8_t           Channel;
+  uint8_t           n;
+  int32_t           Value;
+
+  Channel = ADMUX & ADC_CHAN_MASK;
+
+  /* reference */
+  if ((ADMUX & ADC_REF_MASK) == ADC_REF_BANDGAP) U_Ref = HOST_BANDGAP;
+  else U_Ref = HOST_VCC;
+
+  /* input */
+  if (Channel == ADC_CHAN_BANDGAP)      /* bandgap */
+  {
+    U = HOST_BANDGAP;
+  }
+  else                                  /* probe (others read 0V) */
+  {
+    UpdateNetwork();
+
+    for (n = 0; n < NODES; n++)
+    {
+      if (Channel == ADC_Channels[n]) U = Node_V[n];
+    }
+  }
+
+  Value = (int32_t)(U / U_Ref * 1024.0);
+  if (Value > 1023) Value = 1023;
+  else if (Value < 0) Value = 0;
+
+  ADCW = (uint16_t)Value;
+  Host_Conversions++;
+  Host_Time += (13UL * 1000000UL) / ADC_FREQ;    /* 13 ADC clock cycles */
+}
+
+
+
+/*
+ *  access ADCSRA
+ *  - finishes a conversion started by setting ADSC
+ *
+ *  returns:
+ *  - pointer to register
+ */
+
+volatile uint8_t *Host_ADCSRA(void)
+{
+  if (ADCSRA_Reg & (1 << ADSC))    /* conversion started */
+  {
+    Convert();
+    ADCSRA_Reg &= ~(1 << ADSC);         /* done */
+    ADCSRA_Reg |= (1 << ADIF);
+  }
+
+  return &ADCSRA_Reg;
+}
+
+
+
+/* ************************************************************************
+ *   timing (wait.S and pause.c)
+ * ************************************************************************ */
+
+
+#define WAIT(Name, Time)      void Name(void) { Host_Time += (Time); }
+
+WAIT(wait1000ms, 1000000UL)
+WAIT(wait500ms, 500000UL)
+WAIT(wait400ms, 400000UL)
+WAIT(wait300ms, 300000UL)
+WAIT(wait200ms, 200000UL)
+WAIT(wait100ms, 100000UL)
+WAIT(wait50ms, 50000UL)
+WAIT(wait40ms, 40000UL)
+WAIT(wait30ms, 30000UL)
+WAIT(wait20ms, 20000UL)
+WAIT(wait10ms, 10000UL)
+WAIT(wait5ms, 5000UL)
+WAIT(wait4ms, 4000UL)
+WAIT(wait3ms, 3000UL)
+WAIT(wait2ms, 2000UL)
+WAIT(wait1ms, 1000UL)
+WAIT(wait500us, 500UL)
+WAIT(wait400us, 400UL)
+WAIT(wait300us, 300UL)
+WAIT(wait200us, 200UL)
+WAIT(wait100us, 100UL)
+WAIT(wait50us, 50UL)
+WAIT(wait40us, 40UL)
+WAIT(wait30us, 30UL)
+WAIT(wait20us, 20UL)
+WAIT(wait10us, 10UL)
+WAIT(wait5us, 5UL)
+WAIT(wait4us, 4UL)
+WAIT(wait3us, 3UL)
+WAIT(wait2us, 2UL)
+WAIT(wait1us, 1UL)
+
+
+void MilliSleep(uint16_t Time)
+{
+  Host_Time += Time * 1000UL;
+}
+
+
+void IdleWait(uint16_t Time)
+{
+  Host_Time += Time * 1000UL;
+}
+
+
+/*
+ *  Timer1 input capture: the comparator never triggers
+ *  (no capacitance simulated), so it's always a timeout
+ */
+
+uint8_t Capture_Wait(uint32_t *Ticks, uint16_t Timeout)
+{
+  *Ticks = (uint32_t)Timeout << 16;     /* timer overflows */
+  TCCR1B = 0;                           /* stop timer */
+  Host_Time += ((uint32_t)Timeout << 16) / (CPU_FREQ / 1000000);
+
+  return 0;
+}
+
+
+
+/* ************************************************************************
+ *   EEPROM
+ * ************************************************************************ */
+
+
+uint8_t eeprom_read_byte(const uint8_t *Addr)
+{
+  return *Addr;
+}
+
+uint16_t eeprom_read_word(const uint16_t *Addr)
+{
+  return *Addr;
+}
+
+uint32_t eeprom_read_dword(const uint32_t *Addr)
+{
+  return *Addr;
+}
+
+void eeprom_read_block(void *Dst, const void *Src, size_t Size)
+{
+  memcpy(Dst, Src, Size);
+}
+
+void eeprom_write_byte(uint8_t *Addr, uint8_t Value)
+{
+  *Addr = Value;
+}
+
+void eeprom_write_word(uint16_t *Addr, uint16_t Value)
+{
+  *Addr = Value;
+}
+
+void eeprom_write_block(const void *Src, void *Dst, size_t Size)
+{
+  memcpy(Dst, Src, Size);
+}
+
+void eeprom_update_byte(uint8_t *Addr, uint8_t Value)
+{
+  *Addr = Value;
+}
+
+void eeprom_update_word(uint16_t *Addr, uint16_t Value)
+{
+  *Addr = Value;
+}
+
+void eeprom_update_block(const void *Src, void *Dst, size_t Size)
+{
+  memcpy(Dst, Src, Size);
+}
+
+
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
@@ -0,0 +1,59 @@
+/* ************************************************************************
+ *
+ *   host build: simulated probe network
+ *
+ *   (c) 2026 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/*
+ *  hints:
+ *  - the probe network consists of the tester's output stages (MCU pin,
+ *    Rl and Rh for each probe) and the component models added by
+ *    Host_AddResistor() and Host_AddDiode()
+ *  - the node voltages are calculated for each ADC conversion based
+ *    on the current port settings, so only static behaviour is
+ *    simulated (no capacitance or inductance)
+ *  - Host_Time tracks the simulated time spent in wait functions and
+ *    ADC conversions
+ */
+
+#ifndef HOST_MOCK_H
+#define HOST_MOCK_H
+
+#include <stdint.h>
+
+
+/*
+ *  constants
+ */
+
+/* component models */
+#define HOST_PARTS_MAX        6         /* max. number of component models */
+#define HOST_RESISTOR         1         /* resistor */
+#define HOST_DIODE            2         /* diode (Shockley) */
+
+/* simulated supply and reference voltages (in V) */
+#define HOST_VCC              (UREF_VCC / 1000.0)
+#define HOST_BANDGAP          1.1
+
+
+/*
+ *  variables
+ */
+
+extern uint32_t        Host_Time;       /* simulated time (in s) */
+extern uint32_t        Host_Conversions;     /* number of ADC conversions */
+
+
+/*
+ *  functions
+ */
+
+extern void Host_Reset(void);
+extern void Host_AddResistor(uint8_t Probe1, uint8_t Probe2, double R);
+extern void Host_AddDiode(uint8_t Anode, uint8_t Cathode, double I_s, double N);
+extern double Host_Voltage(uint8_t Probe);
+
+#endif
@@ -0,0 +1,349 @@
+/* ************************************************************************
+ *
+ *   host build: regression tests
+ *
+ *   (c) 2026 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/*
+ *  hints:
+ *  - runs the probing functions against the simulated probe network
+ *    (see host/mock.c) and checks the results
+ *  - reports the simulated probing time for each component model
+ *  - returns the number of failed tests
+ */
+
+
+/*
+ *  include header files
+ */
+
+/* basic includes */
+#include <stdio.h>
+#include <unistd.h>
+
+/* local includes */
+#include "config.h"           /* global configuration */
+#include "common.h"           /* common header file */
+#include "variables.h"        /* global variables */
+#include "functions.h"        /* external functions */
+#include "mock.h"             /* simulated probe network */
+
+
+/*
+ *  local variables
+ */
+
+unsigned int        Tests;              /* number of tests */
+unsigned int        Failed;             /* number of failed tests */
+
+
+
+/* ************************************************************************
+ *   support functions
+ * ************************************************************************ */
+
+
+/*
+ *  report test result
+ *
+ *  requires:
+ *  - Flag: 1 for passed / 0 for failed
+ *  - Name: test name
+ */
+
+void Result(uint8_t Flag, const char *Name)
+{
+  Tests++;
+
+  if (Flag)                   /* passed */
+  {
+    printf("  ok    %s\n", Name);
+  }
+  else                        /* failed */
+  {
+    printf("  FAIL  %s\n", Name);
+    Failed++;
+  }
+}
+
+
+
+/*
+ *  check if value is within tolerance
+ *
+ *  requires:
+ *  - Value: value
+ *  - Target: expected value
+ *  - Tolerance: relative tolerance (in %)
+ *
+ *  returns:
+ *  - 1 if within tolerance
+ *  - 0 if not
+ */
+
+uint8_t Near(double Value, double Target, double Tolerance)
+{
+  uint8_t           Flag = 0;      /* return value */
+  double            Diff;
+
+  Diff = Value - Target;
+  if (Diff < 0) Diff = -Diff;
+
+  if (Diff <= Target * Tolerance / 100.0) Flag = 1;
+
+  return Flag;
+}
+
+
+
+/*
+ *  init tester like main() after power-on
+ */
+
+void Setup(void)
+{
+  SetAdjustmentDefaults();              /* default offsets */
+
+  Cfg.Samples = ADC_SAMPLES;            /* number of ADC samples */
+  Cfg.AutoScale = 1;                    /* enable ADC auto scaling */
+  Cfg.Ref = 1;                          /* no ADC reference set yet */
+  #ifdef ADC_CLOCK_PROFILES
+  Cfg.ADC_Clock = ADC_CLOCK_DIV;        /* precise ADC clock profile */
+  #endif
+  #ifdef HW_ADS1115
+  Cfg.ADC_Backend = ADC_INT;            /* internal ADC */
+  #endif
+  Cfg.Vcc = UREF_VCC;                   /* voltage of Vcc */
+
+  /* bandgap reference */
+  Cfg.Bandgap = ReadU(ADC_CHAN_BANDGAP);     /* dummy read */
+  Cfg.Bandgap = ReadU_Desc(ADC_CHAN_BANDGAP, SAMPLE_REF);
+  Cfg.Bandgap += NV.RefOffset;               /* add voltage offset */
+}
+
+
+
+/*
+ *  run probing like one cycle of main()
+ *  - no capacitance measurement (not simulated)
+ */
+
+void Probe(void)
+{
+  /* reset variables */
+  Check.Found = COMP_NONE;         /* no component */
+  Check.Type = 0;                  /* reset type flags */
+  Check.Done = DONE_NONE;          /* no transistor */
+  Check.AltFound = COMP_NONE;      /* no alternative component */
+  Check.Diodes = 0;                /* reset diode counter */
+  Check.Resistors = 0;             /* reset resistor counter */
+  Semi.Flags = 0;                  /* reset flags */
+
+  Host_Time = 0;                   /* reset simulated time */
+  Host_Conversions = 0;
+
+  DischargeProbes();
+  if (Check.Found == COMP_ERROR) return;
+
+  /* check all 6 combinations of the 3 probes */
+  CheckProbes(PROBE_1, PROBE_2, PROBE_3);
+  CheckProbes(PROBE_2, PROBE_1, PROBE_3);
+  CheckProbes(PROBE_1, PROBE_3, PROBE_2);
+  CheckProbes(PROBE_3, PROBE_1, PROBE_2);
+  CheckProbes(PROBE_2, PROBE_3, PROBE_1);
+  CheckProbes(PROBE_3, PROBE_2, PROBE_1);
+
+  CheckAlternatives();             /* process alternatives */
+
+  printf("        %lu.%03lu ms, %lu ADC conversions\n",
+    (unsigned long)(Host_Time / 1000), (unsigned long)(Host_Time % 1000),
+    (unsigned long)Host_Conversions);
+}
+
+
+
+/* ************************************************************************
+ *   tests
+ * ************************************************************************ */
+
+
+/*
+ *  value handling (user.c)
+ */
+
+void Test_Values(void)
+{
+  printf("values\n");
+
+  Result(Power10(3) == 1000UL, "Power10(3)");
+  Result(RescaleValue(1234, -3, -6) == 1234000UL, "RescaleValue() downscale");
+  Result(RescaleValue(1234567, -6, -3) == 1234UL, "RescaleValue() upscale");
+  Result(RescaleValue(5000000, -3, -9) == UINT32_MAX, "RescaleValue() saturation");
+  Result(CmpValue(1000, -3, 1, 0) == 0, "CmpValue() equal");
+  Result(CmpValue(1, 0, 999, -3) == 1, "CmpValue() larger");
+  Result(CmpValue(47, 3, 1, 6) == -1, "CmpValue() smaller");
+  #ifdef FUNC_ROUNDSIGNEDVALUE
+  Result(RoundSignedValue(-1255, 2, 1) == -126, "RoundSignedValue()");
+  #endif
+  #ifdef FUNC_STATS_SQRT
+  Result(Stats_Sqrt(1000000UL) == 1000, "Stats_Sqrt()");
+  #endif
+}
+
+
+
+/*
+ *  ADC readings (ADC.c)
+ */
+
+void Test_ADC(void)
+{
+  uint16_t          U;
+
+  printf("ADC\n");
+
+  /* divider: probe-1 -- Vcc / 1k / probe-2 -- Rl -- Gnd */
+  Host_Reset();
+  Host_AddResistor(PROBE_1, PROBE_2, 1000);
+  UpdateProbes(PROBE_1, PROBE_2, PROBE_3);
+  ADC_PORT = Probes.Pin_1;
+  ADC_DDR = Probes.Pin_1;
+  R_PORT = 0;
+  R_DDR = Probes.Rl_2;
+  U = ReadU(Probes.Ch_2);
+  Result(Near(U, Host_Voltage(PROBE_2) * 1000.0, 0.5), "ReadU() divider");
+
+  /*
+   *  low voltage (about 130mV): auto-scaling to bandgap reference
+   *  - Vcc reference would give a resolution of about 5mV only
+   *  probe-1 -- Rl -- Vcc / 47 / probe-2 -- Gnd
+   */
+
+  Host_Reset();
+  Host_AddResistor(PROBE_1, PROBE_2, 47);
+  ADC_PORT = 0;
+  ADC_DDR = Probes.Pin_2;
+  R_PORT = Probes.Rl_1;
+  R_DDR = Probes.Rl_1;
+  U = ReadU(Probes.Ch_2);
+  Result(Near(U, Host_Voltage(PROBE_2) * 1000.0, 1.0), "ReadU() bandgap");
+  U = ReadU_Desc(Probes.Ch_2, SAMPLE_FAST);
+  Result(Near(U, Host_Voltage(PROBE_2) * 1000.0, 1.0), "ReadU_Desc() fast, bandgap");
+
+  ADC_DDR = 0;
+  R_DDR = 0;
+}
+
+
+
+/*
+ *  open probes
+ */
+
+void Test_None(void)
+{
+  printf("open probes\n");
+
+  Host_Reset();
+  Probe();
+  Result(Check.Found == COMP_NONE, "no component");
+}
+
+
+
+/*
+ *  resistors
+ */
+
+void Test_Resistors(void)
+{
+  const double      Values[] = {100, 1000, 4700, 10000, 100000, 470000};
+  Resistor_Type     *R;
+  double            Value;
+  int8_t            Scale;
+  uint8_t           n;
+  char              Name[40];
+
+  printf("resistors\n");
+
+  for (n = 0; n < sizeof(Values) / sizeof(Values[0]); n++)
+  {
+    Host_Reset();
+    Host_AddResistor(PROBE_1, PROBE_3, Values[n]);
+    Probe();
+
+    R = &Resistors[0];
+    Value = (double)R->Value;
+    for (Scale = R->Scale; Scale < 0; Scale++) Value /= 10.0;
+    for (; Scale > 0; Scale--) Value *= 10.0;
+
+    snprintf(Name, sizeof(Name), "R %.0f Ohms: %.1f", Values[n], Value);
+    Result((Check.Found == COMP_RESISTOR) && (Check.Resistors == 1) &&
+      Near(Value, Values[n], 2.0), Name);
+  }
+}
+
+
+
+/*
+ *  diodes
+ */
+
+void Test_Diodes(void)
+{
+  Diode_Type        *D;
+  char              Name[40];
+
+  printf("diodes\n");
+
+  /* small signal diode (1N4148 like) */
+  Host_Reset();
+  Host_AddDiode(PROBE_2, PROBE_3, 2.5e-9, 1.75);
+  Probe();
+  D = &Diodes[0];
+  snprintf(Name, sizeof(Name), "diode: V_f %umV / %umV", D->V_f, D->V_f2);
+  Result((Check.Found == COMP_DIODE) && (Check.Diodes == 1) &&
+    (D->A == PROBE_2) && (D->C == PROBE_3) &&
+    (D->V_f > 550) && (D->V_f < 850) && (D->V_f2 < D->V_f), Name);
+
+  /* anti-parallel diodes */
+  Host_Reset();
+  Host_AddDiode(PROBE_1, PROBE_2, 2.5e-9, 1.75);
+  Host_AddDiode(PROBE_2, PROBE_1, 2.5e-9, 1.75);
+  Probe();
+  Result((Check.Found == COMP_DIODE) && (Check.Diodes == 2), "anti-parallel diodes");
+}
+
+
+
+/* ************************************************************************
+ *   main
+ * ************************************************************************ */
+
+
+int main(void)
+{
+  alarm(60);                       /* abort if firmware code hangs */
+
+  Host_Reset();
+  Setup();
+
+  Test_Values();
+  Test_ADC();
+  Test_None();
+  Test_Resistors();
+  Test_Diodes();
+
+  printf("%u tests, %u failed\n", Tests, Failed);
+
+  return (Failed > 0);
+}
+
+
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
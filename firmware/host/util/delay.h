@@ -0,0 +1,24 @@
+/* ************************************************************************
+ *
+ *   host build: stub for <util/delay.h>
+ *
+ *   (c) 2026 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/*
+ *  hints:
+ *  - delays don't wait, see wait*() in host/mock.c for simulated time
+ */
+
+#ifndef HOST_UTIL_DELAY_H
+#define HOST_UTIL_DELAY_H
+
+#define _delay_ms(Time)
+#define _delay_us(Time)
+#define _delay_loop_1(Count)
+#define _delay_loop_2(Count)
+#define __builtin_avr_delay_cycles(Cycles)
+
+#endif
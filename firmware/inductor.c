@@ -140,8 +140,6 @@ uint8_t MeasureInductance(uint32_t *Time, uint8_t Mode)
   uint8_t           Flag = 3;      /* return value */
   uint8_t           Test;          /* test flag */
   uint8_t           Offset;        /* counter offet */
-  uint16_t          Ticks_L;       /* timer counter */
-  uint16_t          Ticks_H;       /* timer overflow counter */
   uint32_t          Counter;       /* counter */
 
   /* sanity check */
@@ -191,7 +189,7 @@ uint8_t MeasureInductance(uint32_t *Time, uint8_t Mode)
     wait1ms();                          /* time for voltage stabilization */
   #else
     /* buffer cap: 100nF */
-    wait10ms();                         /* time for voltage stabilization */
+    settle10ms();                       /* time for voltage stabilization */
   #endif
   wdt_reset();                          /* reset watchdog */
 
@@ -200,10 +198,14 @@ uint8_t MeasureInductance(uint32_t *Time, uint8_t Mode)
    *  set up timer
    */
 
-  Ticks_H = 0;                          /* reset timer overflow counter */
   TCCR1A = 0;                           /* set default mode */
+  #ifdef L_NOISE_CANCEL
+  TCCR1B = (1 << ICNC1);                /* set more timer modes */
+  /* timer stopped, falling edge detection, noise canceler enabled */
+  #else
   TCCR1B = 0;                           /* set more timer modes */
   /* timer stopped, falling edge detection, noise canceler disabled */
+  #endif
   TCNT1 = 0;                            /* set Counter1 to 0 */
   /* clear all flags (input capture, compare A & B, overflow */
   TIFR1 = (1 << ICF1) | (1 << OCF1B) | (1 << OCF1A) | (1 << TOV1);
@@ -239,53 +241,21 @@ uint8_t MeasureInductance(uint32_t *Time, uint8_t Mode)
 
 
   /*
-   *  timer loop
-   *  - run until voltage threshold is reached
-   *  - detect timer overflows
+   *  wait until voltage threshold is reached
+   *  - timeout: 0.26s
    */
 
-  while (1)
+  if (! Capture_Wait(&Counter, CPU_FREQ / 250000))
   {
-    Test = TIFR1;                       /* get timer1 flags */
-
-    /* end loop if input capture flag is set (= same voltage) */
-    if (Test & (1 << ICF1)) break;
-
-    /* detect timer overflow by checking the overflow flag */
-    if (Test & (1 << TOV1))
-    {
-      /* happens at 65.536ms for 1MHz or 8.192ms for 8MHz */
-      TIFR1 = (1 << TOV1);              /* reset flag */
-      Ticks_H++;                        /* increase overflow counter */
-
-      /* if it takes too long (0.26s) */
-      if (Ticks_H == (CPU_FREQ / 250000))
-      {
-        Flag = 0;             /* signal timeout */
-        break;                /* end loop */
-      }
-    }
+    Flag = 0;                 /* signal timeout */
   }
 
-  /* stop counter */
-  TCCR1B = 0;                           /* stop timer */
-  TIFR1 = (1 << ICF1);                  /* reset Input Capture flag */
-
-  Ticks_L = ICR1;                       /* get counter value */
-
   /* prepare cut off: Gnd -- Rl -- probe-2 / probe-1 -- Rl -- Gnd */
   R_DDR = Probes.Rl_2 | Probes.Rl_1;  
 
   /* stop current flow */
   ADC_DDR = 0;
 
-  /* catch missed timer overflow */
-  if ((TCNT1 > Ticks_L) && (Test & (1 << TOV1)))
-  {
-    TIFR1 = (1 << TOV1);                /* reset overflow flag */
-    Ticks_H++;                          /* increase overflow counter */
-  }
-
   /* enable ADC again */
   ADCSRA = (1 << ADEN) | (1 << ADIF) | ADC_CLOCK_DIV;
   ADCSRB &= ~(1 << ACME);     /* disable ADC multiplexer as negative input */
@@ -297,16 +267,16 @@ uint8_t MeasureInductance(uint32_t *Time, uint8_t Mode)
 
   if (Flag)                   /* got valid measurement */
   {
-    /* combine both counter values */
-    Counter = (uint32_t)Ticks_L;             /* lower 16 bits */
-    Counter |= (uint32_t)Ticks_H << 16;      /* upper 16 bits */
-
     /*
      *  offset handling
      */
 
     Offset = 3;               /* processing overhead */
 
+    #ifdef L_NOISE_CANCEL
+    Offset += 4;              /* capture delayed by noise canceler */
+    #endif
+
     /* start offset */
     if (Mode & MODE_DELAYED_START)      /* delayed start */
     {
@@ -396,6 +366,13 @@ uint8_t MeasureInductor(Resistor_Type *Resistor)
   int16_t           Offset = 0;    /* offset for U_ref */
   uint32_t          Value;         /* value */
   uint32_t          Time1;         /* time #1 */
+  #ifdef SW_L_MEDIAN
+  uint8_t           n;             /* number of timings */
+  uint8_t           Runs;          /* number of measurement runs */
+  uint8_t           i;             /* index */
+  uint32_t          Time2;         /* time #2 */
+  uint32_t          Times[L_SAMPLES];   /* sorted timings */
+  #endif
 
   /* reset data */
   Inductor.Scale = 0;
@@ -465,6 +442,61 @@ uint8_t MeasureInductor(Resistor_Type *Resistor)
   if (Test != 3) Test = 0;         /* all measurements failed */
 
 
+  #ifdef SW_L_MEDIAN
+  /*
+   *  median of several timings
+   *  - repeat measurement in the mode found
+   *  - keep timings sorted (insertion sort)
+   *  - accept early when all timings agree within 1/32 (about 3%)
+   */
+
+  if (Test == 3)                   /* valid measurement */
+  {
+    Times[0] = Time1;              /* first timing */
+    n = 1;
+    Runs = 1;
+
+    while (Runs < L_SAMPLES)
+    {
+      Runs++;                      /* one more run */
+      wdt_reset();                 /* reset watchdog */
+
+      if (MeasureInductance(&Time2, Mode) == 3)     /* valid measurement */
+      {
+        /* delayed mode: valid time should be larger than the delay */
+        if ((Mode & MODE_DELAYED_START) && (Time2 <= 5000)) continue;
+
+        /* insert timing */
+        i = n;
+        while ((i > 0) && (Times[i - 1] > Time2))
+        {
+          Times[i] = Times[i - 1];      /* move up */
+          i--;
+        }
+        Times[i] = Time2;
+        n++;
+
+        /* early acceptance: spread of timings */
+        if (n >= 3)
+        {
+          Value = Times[n - 1] - Times[0];   /* max - min */
+          if (Value <= (Times[n / 2] / 32)) break;
+        }
+      }
+    }
+
+    /* median */
+    i = n / 2;
+    Time1 = Times[i];
+    if ((n & 1) == 0)              /* even number of timings */
+    {
+      Time1 += Times[i - 1];       /* mean of middle two */
+      Time1 /= 2;
+    }
+  }
+  #endif
+
+
   /*
    *  calculate inductance
    */
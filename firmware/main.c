@@ -36,6 +36,32 @@
 #if CYCLE_MAX < 255
 uint8_t        MissedParts;          /* counter for failed/missed components */
 #endif
+#ifdef PROBE_FINGERPRINT
+Fingerprint_Type    LastPart;        /* fingerprint of last component */
+#endif
+
+/* voltage references */
+#ifdef REF_CACHE
+uint8_t        RefCycles = 0;        /* probing cycles until next refresh */
+uint8_t        RefStable = 0;        /* flag for stable readings */
+uint16_t       RefBandgap;           /* cached bandgap voltage (mV, no offset) */
+#ifndef BAT_NONE
+uint16_t       RefVbat;              /* battery voltage at last refresh (mV) */
+#endif
+#ifdef SYSTEM_TICK
+uint32_t       RefTime;              /* time of last refresh (ms) */
+#endif
+#endif
+
+#ifdef BAT_BACKGROUND
+/* background battery monitoring */
+uint32_t       BatFilter = 0;        /* filtered battery voltage (1/16 mV) */
+uint32_t       BatTime;              /* time of last sample (ms) */
+uint32_t       BatTrendU;            /* filtered voltage at last trend sample (1/16 mV) */
+uint32_t       BatTrendTime;         /* time of last trend sample (ms) */
+uint16_t       BatDrop = 0;          /* filtered voltage drop (1/16 mV per minute) */
+uint8_t        BatMinutes = 0;       /* number of trend samples */
+#endif
 
 
 /* ************************************************************************
@@ -204,7 +230,10 @@ void Show_ENormValues(uint32_t Value, int8_t Scale, uint8_t ESeries, uint8_t Tol
   {
     Pos = 1;                            /* one decimal place */
   }
-  Temp /= 10;                           /* scale to 1 */
+  else                                  /* >= 1% */
+  {
+    Temp /= 10;                         /* scale to 1 */
+  }
 
   Display_FullValue(Temp, Pos, '%');    /* display tolerance */
 
@@ -566,6 +595,43 @@ void Show_SingleResistor(uint8_t ID1, uint8_t ID2)
 
 
 
+#ifdef UI_EARLY_RESULT
+
+/*
+ *  show preliminary result while checking for capacitors
+ *  - first resistor with pinout and value in the next line
+ *  - "+" signals additional resistors
+ *  - gets replaced by the final result
+ */
+
+void Show_EarlyResult(void)
+{
+  Resistor_Type     *Resistor;     /* pointer to resistor */
+
+  Resistor = &Resistors[0];        /* pointer to first resistor */
+
+  Display_NextLine();              /* move to next line */
+
+  /* show pinout */
+  Display_ProbeNumber(Resistor->A);
+  Display_EEString(Resistor_str);
+  Display_ProbeNumber(Resistor->B);
+
+  /* show resistance value */
+  Display_Space();
+  Display_Value(Resistor->Value, Resistor->Scale, LCD_CHAR_OMEGA);
+
+  if (Check.Resistors > 1)         /* more resistors */
+  {
+    Display_Space();
+    Display_Char('+');
+  }
+}
+
+#endif
+
+
+
 /*
  *  show resistor(s)
  */
@@ -575,6 +641,10 @@ void Show_Resistor(void)
   Resistor_Type     *R1;           /* pointer to resistor #1 */
   Resistor_Type     *R2;           /* pointer to resistor #2 */
   uint8_t           Pin;           /* ID of common pin */
+  #if defined (SW_INDUCTOR) && defined (SW_PROFILER)
+  uint8_t           Flag;          /* result of inductance measurement */
+  uint32_t          Start;         /* profiler: start of stage */
+  #endif
 
   R1 = &Resistors[0];              /* pointer to first resistor */
 
@@ -729,7 +799,21 @@ void Show_Resistor(void)
   else                   /* single resistor */
   {
     /* get inductance and display if relevant */
+    #ifdef SW_PROFILER
+    Start = Profile_Tick();             /* start of stage */
+      #ifdef UI_PRESETS
+      Flag = 0;                         /* no inductance */
+      if (NV.Preset == PRESET_FULL)     /* not for fast preset */
+      #endif
+    Flag = MeasureInductor(R1);         /* measure inductance */
+    Profile_Add(PROF_INDUCTOR, Start);  /* end of stage */
+    if (Flag == 1)                      /* inductor */
+    #elif defined (UI_PRESETS)
+    /* not for fast preset */
+    if ((NV.Preset == PRESET_FULL) && (MeasureInductor(R1) == 1))
+    #else
     if (MeasureInductor(R1) == 1)       /* inductor */
+    #endif
     {
       Display_Space();
       Display_Value(Inductor.Value, Inductor.Scale, 'H');
@@ -786,6 +870,16 @@ void Show_Resistor(void)
       /* show E series norm value EIA-96 codes for E96 1% */
       Show_ENormEIA96(R1->Value, R1->Scale);
       #endif
+
+      #ifdef SW_R_E192_T
+      /* show E series norm values for E192 0.1% */
+      Show_ENormValues(R1->Value, R1->Scale, E192, 1, LCD_CHAR_OMEGA);
+      #endif
+
+      #ifdef SW_R_E192_CC
+      /* show E series norm value color-codes for E192 0.1% */
+      Show_ENormCodes(R1->Value, R1->Scale, E192, 1, COLOR_CODE_VIOLET);
+      #endif
     }
     #endif
   }
@@ -826,6 +920,16 @@ void Show_Resistor(void)
     /* show E series norm value EIA-96 codes for E96 1% */
     Show_ENormEIA96(R1->Value, R1->Scale);
     #endif
+
+    #ifdef SW_R_E192_T
+    /* show E series norm values for E192 0.1% */
+    Show_ENormValues(R1->Value, R1->Scale, E192, 1, LCD_CHAR_OMEGA);
+    #endif
+
+    #ifdef SW_R_E192_CC
+    /* show E series norm value color-codes for E192 0.1% */
+    Show_ENormCodes(R1->Value, R1->Scale, E192, 1, COLOR_CODE_VIOLET);
+    #endif
   }
   #endif
 }
@@ -842,6 +946,9 @@ void Show_Capacitor(void)
   #if defined (SW_ESR) || defined (SW_OLD_ESR)
   uint16_t          ESR;           /* ESR (in 0.01 Ohms) */
   #endif
+  #if (defined (SW_ESR) || defined (SW_OLD_ESR)) && defined (SW_PROFILER)
+  uint32_t          Start;         /* profiler: start of stage */
+  #endif
   uint8_t           Counter;       /* loop counter */
 
   /*
@@ -894,7 +1001,20 @@ void Show_Capacitor(void)
 
   #if defined (SW_ESR) || defined (SW_OLD_ESR)
   /* measure and display ESR */
+  #ifdef SW_PROFILER
+  Start = Profile_Tick();          /* start of stage */
+  #endif
+  #ifdef UI_PRESETS
+  if (NV.Preset == PRESET_FAST)    /* fast preset */
+  {
+    ESR = UINT16_MAX;              /* skip ESR */
+  }
+  else
+  #endif
   ESR = MeasureESR(MaxCap);        /* measure ESR */
+  #ifdef SW_PROFILER
+  Profile_Add(PROF_ESR, Start);    /* end of stage */
+  #endif
   if (ESR < UINT16_MAX)            /* if successful */
   {
     Display_Space();
@@ -1231,7 +1351,7 @@ void Show_Diode(void)
 
     /* reverse leakage current */
     UpdateProbes2(D1->C, D1->A);        /* reverse diode */
-    GetLeakageCurrent(1);               /* get current */
+    GetLeakageCurrent(1, LEAK_NO_HINT); /* get current */
     Show_SemiCurrent(I_R_str);          /* display I_R */
 
     #ifdef UI_SERIAL_COMMANDS
@@ -1300,6 +1420,9 @@ void Show_BJT(void)
   #endif
   uint16_t          V_BE = 0;      /* V_BE */
   int16_t           Slope;         /* slope of forward voltage */
+  #ifdef SW_HFE_SWEEP
+  uint8_t           n;             /* counter */
+  #endif
 
   /*
    *  Mapping for Semi structure:
@@ -1472,6 +1595,25 @@ void Show_BJT(void)
   Display_SignedValue(Semi.U_3, -6, 'A');      /* display I_C/I_E */
   #endif
 
+  #ifdef SW_HFE_SWEEP
+  /* display hFE sweep: circuit, hFE and I_C/I_E for each setup */
+  n = 0;                           /* reset counter */
+  while (n < HFE_SWEEP_POINTS)
+  {
+    if (hFE_Sweep[n].Flags)        /* valid entry */
+    {
+      Display_NextLine();
+      if (hFE_Sweep[n].Flags & HFE_COMMON_EMITTER) Display_Char('e');
+      else Display_Char('c');
+      Display_Space();
+      Display_Value(hFE_Sweep[n].hFE, 0, 0);    /* display hFE */
+      Display_Space();
+      Display_Value(hFE_Sweep[n].I, -9, 'A');   /* display current */
+    }
+    n++;                           /* next entry */
+  }
+  #endif
+
   #ifdef SW_REVERSE_HFE
   /* display reverse hFE */
   if (Diode == NULL)               /* no freewheeling diode */
@@ -2057,8 +2199,22 @@ void Show_Zener(void)
  * ************************************************************************ */
 
 
+#ifdef REF_CACHE
+
+/* cache parameters */
+#define REF_SAMPLES_FAST    50     /* ADC samples for refreshing stable values */
+#define REF_CACHE_TOL       1      /* max. deviation of stable bandgap (mV) */
+#define REF_CACHE_VBAT      100    /* max. change of battery voltage (mV) */
+#define REF_CACHE_TIME      60000  /* max. age of cached values (ms) */
+
+#endif
+
+
 /*
  *  manage voltage references
+ *  - with REF_CACHE the references are re-measured only when the cached
+ *    values expired (number of probing cycles, time) or the battery
+ *    voltage changed
  */
 
 void CheckVoltageRefs(void)
@@ -2067,6 +2223,54 @@ void CheckVoltageRefs(void)
   uint16_t          U_Ref;         /* reference voltage */
   uint32_t          Temp;          /* temporary value */
   #endif
+  #ifdef REF_CACHE
+  uint16_t          Desc = SAMPLE_REF;   /* sampling descriptor */
+  uint8_t           Flag = 0;      /* refresh flag */
+  uint16_t          U_Gap;         /* new bandgap voltage */
+
+
+  /*
+   *  check cached values
+   */
+
+  if (RefCycles == 0)              /* cache expired */
+  {
+    Flag = 1;                      /* refresh */
+  }
+  else                             /* cache still valid */
+  {
+    RefCycles--;                   /* one cycle less */
+  }
+
+  #ifndef BAT_NONE
+  /* battery voltage changed (affects Vcc and bandgap) */
+  if ((Cfg.Vbat > RefVbat + REF_CACHE_VBAT) ||
+      (Cfg.Vbat + REF_CACHE_VBAT < RefVbat))
+  {
+    Flag = 1;                      /* refresh */
+  }
+  #endif
+
+  #ifdef SYSTEM_TICK
+  /* maximum age (temperature drift) */
+  if ((SysTick_Get() - RefTime) > REF_CACHE_TIME)
+  {
+    Flag = 1;                      /* refresh */
+  }
+  #endif
+
+  if (Flag == 0)                   /* use cached values */
+  {
+    /* Vcc and OP_EXT_REF are kept from last refresh */
+    Cfg.Bandgap = RefBandgap + NV.RefOffset;      /* add voltage offset */
+    return;                        /* done */
+  }
+
+  if (RefStable)                   /* last values were stable */
+  {
+    Desc = REF_SAMPLES_FAST | SAMPLE_FULL;   /* fewer samples for refresh */
+  }
+  #endif
 
 
   /*
@@ -2074,8 +2278,12 @@ void CheckVoltageRefs(void)
    */
 
   #ifdef HW_REF25
-  Cfg.Samples = 200;               /* perform 200 ADC samples for high accuracy */
-  U_Ref = ReadU(TP_REF);           /* read voltage of reference (mV) */
+  /* read voltage of reference (mV) */
+  #ifdef REF_CACHE
+  U_Ref = ReadU_Desc(TP_REF, Desc);
+  #else
+  U_Ref = ReadU_Desc(TP_REF, SAMPLE_REF);    /* 200 samples for high accuracy */
+  #endif
 
   /* check for valid voltage range */
   if ((U_Ref > 2250) && (U_Ref < 2750))      /* voltage is fine */
@@ -2098,12 +2306,40 @@ void CheckVoltageRefs(void)
    */
 
   Cfg.Bandgap = ReadU(ADC_CHAN_BANDGAP);     /* dummy read for bandgap stabilization */
-  Cfg.Samples = 200;                         /* perform 200 ADC samples for high accuracy */
-  Cfg.Bandgap = ReadU(ADC_CHAN_BANDGAP);     /* get voltage of bandgap reference (mV) */
-  Cfg.Bandgap += NV.RefOffset;               /* add voltage offset */
+  #ifdef REF_CACHE
+  U_Gap = ReadU_Desc(ADC_CHAN_BANDGAP, Desc);     /* get voltage of bandgap reference (mV) */
+
+  /*
+   *  Keep the cache only when the new value matches the last one.
+   *  Otherwise measure again with all samples in the next cycle.
+   */
 
-  /* clean up */
-  Cfg.Samples = ADC_SAMPLES;            /* set ADC samples back to default */
+  if ((U_Gap <= RefBandgap + REF_CACHE_TOL) &&
+      (U_Gap + REF_CACHE_TOL >= RefBandgap))
+  {
+    RefStable = 1;                           /* stable */
+    RefCycles = REF_CACHE;                   /* reset cache timer */
+  }
+  else                                       /* changed */
+  {
+    RefStable = 0;                           /* unstable */
+    RefCycles = 0;                           /* refresh next cycle */
+  }
+
+  RefBandgap = U_Gap;                        /* update cache */
+  #ifndef BAT_NONE
+  RefVbat = Cfg.Vbat;
+  #endif
+  #ifdef SYSTEM_TICK
+  RefTime = SysTick_Get();
+  #endif
+
+  Cfg.Bandgap = U_Gap;
+  #else
+  /* get voltage of bandgap reference (mV), 200 samples for high accuracy */
+  Cfg.Bandgap = ReadU_Desc(ADC_CHAN_BANDGAP, SAMPLE_REF);
+  #endif
+  Cfg.Bandgap += NV.RefOffset;               /* add voltage offset */
 }
 
 
@@ -2132,6 +2368,9 @@ void PowerOff(void)
   #endif
 
   /* disable stuff */
+  #ifdef SERIAL_TX_BUFFER
+  Serial_Flush();                       /* send pending serial output */
+  #endif
   cli();                                /* disable interrupts */
   wdt_disable();                        /* disable watchdog */
 
@@ -2157,6 +2396,144 @@ void PowerOff(void)
 
 #ifndef BAT_NONE
 
+/*
+ *  read battery voltage
+ *  - considers voltage divider and offset
+ *
+ *  requires:
+ *  - Desc: sampling descriptor (see ReadU_Desc())
+ *
+ *  returns:
+ *  - battery voltage in mV
+ */
+
+uint16_t ReadBattery(uint16_t Desc)
+{
+  uint16_t          U_Bat;         /* battery voltage */
+
+  /* get current battery voltage */
+  U_Bat = ReadU_Desc(TP_BAT, Desc);     /* read voltage (mV) */
+
+  #ifdef BAT_DIVIDER
+  uint32_t          Temp;          /* temporary value */
+
+  /*
+   *  ADC pin is connected to a voltage divider (top: R1 / bottom: R2).
+   *  - U2 = (Uin / (R1 + R2)) * R2 
+   *  - Uin = (U2 * (R1 + R2)) / R2
+   */
+
+  Temp = (((uint32_t)(BAT_R1 + BAT_R2) * 1000) / BAT_R2);   /* factor (0.001) */
+  Temp *= U_Bat;                   /* Uin (0.001 mV) */
+  Temp /= 1000;                    /* Uin (mV) */
+  U_Bat = (uint16_t)Temp;          /* keep 2 bytes */
+  #endif
+
+  U_Bat += BAT_OFFSET;             /* add offset for voltage drop */
+
+  return U_Bat;
+}
+
+
+
+#ifdef BAT_BACKGROUND
+
+/*
+ *  sample battery in background
+ *  - light sampling (BAT_SAMPLES ADC samples) and IIR filter
+ *  - tracks the filtered voltage drop per minute for the runtime estimate
+ *  - called by RunTasks() every 100ms
+ */
+
+void SampleBattery(void)
+{
+  uint32_t          U_Bat;         /* battery voltage (1/16 mV) */
+  uint32_t          Now;           /* current time */
+
+  /* light sampling */
+  U_Bat = ReadBattery(BAT_SAMPLES);     /* quick reading (mV) */
+  U_Bat *= 16;                     /* scale to 1/16 mV */
+
+  Now = SysTick_Get();             /* get time */
+  BatTime = Now;                   /* save time of sample */
+
+  if (BatFilter == 0)              /* first sample */
+  {
+    /* set start values */
+    BatFilter = U_Bat;
+    BatTrendU = U_Bat;
+    BatTrendTime = Now;
+  }
+  else                             /* filter */
+  {
+    /* y = (15 * y + x) / 16 */
+    BatFilter *= 15;
+    BatFilter += U_Bat;
+    BatFilter /= 16;
+  }
+
+  /* voltage drop per minute */
+  if ((Now - BatTrendTime) >= 60000)    /* 1 minute passed */
+  {
+    U_Bat = 0;                     /* no drop by default */
+    if (BatTrendU > BatFilter)     /* voltage dropped */
+    {
+      U_Bat = BatTrendU - BatFilter;
+      if (U_Bat > UINT16_MAX) U_Bat = UINT16_MAX;
+    }
+
+    if (BatMinutes == 0)           /* first trend sample */
+    {
+      BatDrop = (uint16_t)U_Bat;
+    }
+    else                           /* filter: y = (3 * y + x) / 4 */
+    {
+      U_Bat += (uint32_t)BatDrop * 3;
+      BatDrop = (uint16_t)(U_Bat / 4);
+    }
+
+    if (BatMinutes < 255) BatMinutes++;
+    BatTrendU = BatFilter;         /* update reference */
+    BatTrendTime = Now;
+  }
+}
+
+
+
+/*
+ *  estimate remaining runtime of battery
+ *  - based on the voltage drop per minute and the low battery level
+ *
+ *  returns:
+ *  - time in minutes
+ *  - UINT16_MAX if unknown (no or too few trend samples)
+ */
+
+uint16_t BatteryRuntime(void)
+{
+  uint32_t          Time = UINT16_MAX;  /* return value */
+
+  /* need a few minutes of trend and a dropping voltage */
+  if ((BatMinutes >= 2) && (BatDrop > 0))
+  {
+    Time = 0;                      /* battery is empty */
+
+    if (BatFilter > ((uint32_t)BAT_LOW * 16))
+    {
+      /* runtime = (U_bat - U_low) / drop_per_minute */
+      Time = BatFilter - ((uint32_t)BAT_LOW * 16);
+      Time /= BatDrop;
+      if (Time >= UINT16_MAX) Time = UINT16_MAX - 1;
+    }
+  }
+
+  return (uint16_t)Time;
+}
+
+#endif
+
+
+
 /*
  *  display battery status
  *  - uses voltage stored in Cfg.Vbat
@@ -2168,6 +2545,15 @@ void ShowBattery(void)
   uint8_t           Char1;         /* battery icon left part */
   uint8_t           Char2;         /* battery icon right part */
   #endif
+  uint16_t          U_Weak = BAT_WEAK;  /* warning level */
+
+  #ifdef BAT_BACKGROUND
+  /* early warning when battery is about to run out */
+  if (BatteryRuntime() < BAT_RUNTIME_WARN)
+  {
+    U_Weak = UINT16_MAX;           /* force warning */
+  }
+  #endif
 
   #ifndef UI_BATTERY
   /* display battery info (text) */
@@ -2203,7 +2589,7 @@ void ShowBattery(void)
         #endif
         Display_EEString(Low_str);      /* display: low */
       }
-      else if (Cfg.Vbat < BAT_WEAK)     /* warning level reached */
+      else if (Cfg.Vbat < U_Weak)     /* warning level reached */
       {
         #ifdef LCD_COLOR
         UI.PenColor = COLOR_BAT_WEAK;   /* set WEAK color */
@@ -2255,7 +2641,7 @@ void ShowBattery(void)
       Char1 = LCD_CHAR_BAT_LL;          /* left: low */
       Char2 = LCD_CHAR_BAT_RL;          /* right: low */
     }
-    else if (Cfg.Vbat < BAT_WEAK)       /* warning level reached */
+    else if (Cfg.Vbat < U_Weak)       /* warning level reached */
     {
       #ifdef LCD_COLOR
       UI.PenColor = COLOR_BAT_WEAK;     /* set WEAK color */
@@ -2315,25 +2701,18 @@ void CheckBattery(void)
 {
   uint16_t          U_Bat;         /* battery voltage */
 
-  /* get current battery voltage */
-  U_Bat = ReadU(TP_BAT);           /* read voltage (mV) */
-
-  #ifdef BAT_DIVIDER
-  uint32_t          Temp;          /* temporary value */
-
-  /*
-   *  ADC pin is connected to a voltage divider (top: R1 / bottom: R2).
-   *  - U2 = (Uin / (R1 + R2)) * R2 
-   *  - Uin = (U2 * (R1 + R2)) / R2
-   */
-
-  Temp = (((uint32_t)(BAT_R1 + BAT_R2) * 1000) / BAT_R2);   /* factor (0.001) */
-  Temp *= U_Bat;                   /* Uin (0.001 mV) */
-  Temp /= 1000;                    /* Uin (mV) */
-  U_Bat = (uint16_t)Temp;          /* keep 2 bytes */
+  #ifdef BAT_BACKGROUND
+  /* take filtered voltage from background sampling */
+  if ((BatFilter == 0) || ((SysTick_Get() - BatTime) > 10000))
+  {
+    /* no recent sample (not waiting for user feedback for some time) */
+    SampleBattery();
+  }
+  U_Bat = BatFilter / 16;          /* scale to mV */
+  #else
+  U_Bat = ReadBattery(SAMPLE_STD);      /* read voltage (mV) */
   #endif
 
-  U_Bat += BAT_OFFSET;             /* add offset for voltage drop */
   Cfg.Vbat = U_Bat;                /* save battery voltage */
   Cfg.BatTimer = 100;              /* reset timer for next battery check (in 100ms) */
                                    /* about 10s */
@@ -2381,6 +2760,16 @@ int main(void)
 {
   uint8_t           Test;          /* test value */
   uint8_t           Key;           /* user feedback */
+  #ifdef SW_PROFILER
+  uint32_t          Start;         /* profiler: start of stage */
+  uint32_t          CycleStart;    /* profiler: start of probing */
+  #endif
+  #ifdef UI_FAST_BOOT
+  uint8_t           FastBoot = 0;  /* fast boot flag */
+  #endif
+  #ifdef UI_PARTIAL_REFRESH
+  uint8_t           Refresh = 0;   /* partial refresh flag */
+  #endif
 
 
   /*
@@ -2556,6 +2945,11 @@ int main(void)
     }
   }
 
+  #ifdef UI_FAST_BOOT
+  /* any key press except reset enables fast boot */
+  if ((Key == 1) || (Key == 2)) FastBoot = 1;
+  #endif
+
   #ifndef UI_SERIAL_COMMANDS
   /* key press >300ms selects alternative operation mode */
   if (Key > 1)
@@ -2679,6 +3073,9 @@ int main(void)
   UI.PenColor = COLOR_PEN;              /* set pen color */
   #endif
 
+  #ifdef UI_FAST_BOOT
+  if (! FastBoot)                       /* normal boot */
+  #endif
   MilliSleep(1500);                     /* let the user read the display */
 
 
@@ -2690,12 +3087,21 @@ int main(void)
   #if CYCLE_MAX < 255
   MissedParts = 0;                      /* reset counter */
   #endif
+  #ifdef PROBE_FINGERPRINT
+  LastPart.Found = COMP_NONE;           /* no fingerprint yet */
+  #endif
   Key = KEY_POWER_ON;                   /* just powered on */
 
   /* default offsets and values */
   Cfg.Samples = ADC_SAMPLES;            /* number of ADC samples */
   Cfg.AutoScale = 1;                    /* enable ADC auto scaling */
   Cfg.Ref = 1;                          /* no ADC reference set yet */
+  #ifdef ADC_CLOCK_PROFILES
+  Cfg.ADC_Clock = ADC_CLOCK_DIV;        /* precise ADC clock profile */
+  #endif
+  #ifdef HW_ADS1115
+  Cfg.ADC_Backend = ADC_INT;            /* internal ADC */
+  #endif
   Cfg.Vcc = UREF_VCC;                   /* voltage of Vcc */
 
   /* MCU */
@@ -2729,6 +3135,9 @@ int main(void)
 
   #ifdef UI_CHOOSE_PROFILE
   /* select adjustment profile */
+    #ifdef UI_FAST_BOOT
+    if (! FastBoot)                /* normal boot */
+    #endif
   AdjustmentMenu(STORAGE_LOAD | STORAGE_SHORT);
   #endif
 
@@ -2737,6 +3146,24 @@ int main(void)
    *  interrupts
    */
 
+  #ifdef FUNC_TIMEBASE
+  Profile_Init();                  /* start free running time base */
+  #endif
+
+  #ifdef ENCODER_PCINT
+  Encoder_Init();                  /* pin change interrupt for rotary encoder */
+  #endif
+
+  #if defined (SYSTEM_TICK) && ! defined (BAT_NONE)
+  /* periodic timer for battery monitoring by TestKey() */
+  SysTimer_Start(SYS_TIMER_BAT, 100, 100);
+  #endif
+
+  #ifdef ADJUST_CAP_DRIFT
+  /* periodic timer for drift check of fixed cap by TestKey() */
+  SysTimer_Start(SYS_TIMER_REFCAP, 60000, 60000);
+  #endif
+
   sei();                           /* enable interrupts */
 
 
@@ -2789,6 +3216,15 @@ cycle_start:
   #endif
 
   UI.LineMode = LINE_KEEP;              /* next-line mode: keep first line */
+  #ifdef UI_PARTIAL_REFRESH
+  /* continuous mode: keep last result until the new one is shown */
+  if (Key != KEY_TIMEOUT) Refresh = 0;  /* not in continuous mode */
+  if (! Refresh)
+  #endif
+  #ifdef UI_TWEEZERS
+  /* two-terminal mode: keep last result until the new one is shown */
+  if (! (Cfg.OP_Mode & OP_TWEEZERS))
+  #endif
   LCD_Clear();                          /* clear LCD */
 
 
@@ -2798,11 +3234,38 @@ cycle_start:
 
   CheckVoltageRefs();                   /* manage voltage references */
 
+  #ifdef UI_PRESETS
+  /* ADC samples for fast preset */
+  if (NV.Preset == PRESET_FAST) Cfg.Samples = PRESET_FAST_SAMPLES;
+  #endif
+
 
   /*
    *  battery check (default display)
    */
 
+  #ifdef UI_TWEEZERS
+  if (Cfg.OP_Mode & OP_TWEEZERS)        /* two-terminal mode */
+  {
+    #if ! defined (BAT_NONE) && ! defined (UI_BATTERY_LASTLINE)
+    CheckBattery();                     /* check battery voltage */
+                                        /* will power off on low battery */
+    #endif
+    goto tweezers;                      /* skip display output */
+  }
+  #endif
+
+  #ifdef UI_PARTIAL_REFRESH
+  if (Refresh)                          /* partial refresh */
+  {
+    #if ! defined (BAT_NONE) && ! defined (UI_BATTERY_LASTLINE)
+    CheckBattery();                     /* check battery voltage */
+                                        /* will power off on low battery */
+    #endif
+    goto refresh;                       /* skip display output */
+  }
+  #endif
+
   #if defined (BAT_NONE) || defined (UI_BATTERY_LASTLINE)
     /* no battery monitoring */
     Display_EEString(Tester_str);       /* display (line #1): Component Tester */
@@ -2838,13 +3301,51 @@ cycle_start:
     Display_NL_EEString(Probing_str);        /* display (line #2): probing... */
   #endif
 
+  #ifdef FUNC_LCD_FLUSH
+  LCD_Flush();                     /* update display */
+  #endif
+
+  #ifdef UI_TWEEZERS
+tweezers:
+  #endif
+
+  #ifdef UI_PARTIAL_REFRESH
+refresh:
+  #endif
+
+  #ifdef SW_PROFILER
+  Profile_Reset();                 /* reset profiling data */
+  CycleStart = Profile_Tick();     /* start of probing */
+  Start = CycleStart;              /* start of stage */
+  #endif
+
   /* try to discharge any connected component */
+  #ifdef DISCHARGE_ADAPTIVE
+    #ifdef UI_PARTIAL_REFRESH
+    /* partial refresh: don't mess up last result */
+    if (! Refresh)
+    #endif
+  Cfg.OP_Control |= OP_DISCHARGE_INFO;  /* display remaining time */
+  #endif
   DischargeProbes();
+  #ifdef DISCHARGE_ADAPTIVE
+  Cfg.OP_Control &= ~OP_DISCHARGE_INFO; /* reset flag */
+  #endif
+  #ifdef SW_PROFILER
+  Profile_Add(PROF_DISCHARGE, Start);   /* end of stage */
+  #endif
   if (Check.Found == COMP_ERROR)   /* discharge failed */
   {
     goto show_component;           /* skip all other checks */
   }
 
+  #ifdef UI_SERIAL_COMMANDS
+  if (ProbeCanceled())             /* remote command CANCEL */
+  {
+    goto probing_canceled;         /* skip all other checks */
+  }
+  #endif
+
   #ifdef UI_SHORT_CIRCUIT_MENU
   /* enter main menu if requested by short-circuiting all probes */
   if (ShortedProbes() == 3)        /* all probes short-circuited */
@@ -2854,41 +3355,160 @@ cycle_start:
   }
   #endif
 
+  #ifdef PROBE_FINGERPRINT
+  /* quick re-probing of last component */
+  if (Key == KEY_TIMEOUT)          /* implies continuous mode */
+  {
+    if (QuickReprobe(&LastPart))   /* same component */
+    {
+      goto show_component;         /* skip identification */
+    }
+  }
+  #endif
+
+  #ifdef UI_TWEEZERS
+  /*
+   *  two-terminal mode
+   *  - probe pair #1/#2 only: resistor, diode and capacitor
+   *  - no 3-pin identification
+   */
+
+  if (Cfg.OP_Mode & OP_TWEEZERS)   /* two-terminal mode */
+  {
+    #ifdef SW_PROFILER
+    Start = Profile_Tick();        /* start of stage */
+    #endif
+    CheckProbes(PROBE_1, PROBE_2, PROBE_3);
+    CheckProbes(PROBE_2, PROBE_1, PROBE_3);
+    #ifdef SW_PROFILER
+    Profile_Add(PROF_CHECKPROBES, Start);    /* end of stage */
+    #endif
+
+    /* only resistors and diodes are valid */
+    if (Check.Found > COMP_DIODE)
+    {
+      Check.Found = COMP_NONE;     /* ignore anything else */
+    }
+
+    /* check for capacitor */
+    Caps[1].Value = 0;             /* reset data of unused pairs */
+    Caps[2].Value = 0;
+    if ((Check.Found == COMP_NONE) ||
+        (Check.Found == COMP_RESISTOR))
+    {
+      #ifdef SW_PROFILER
+      Start = Profile_Tick();      /* start of stage */
+      #endif
+      MeasureCap(PROBE_2, PROBE_1, 0);
+      #ifdef SW_PROFILER
+      Profile_Add(PROF_MEASURECAP, Start);   /* end of stage */
+      #endif
+    }
+    else                           /* diode */
+    {
+      Caps[0].Value = 0;           /* no cap */
+    }
+
+    goto show_component;           /* output result */
+  }
+  #endif
+
   /* check all 6 combinations of the 3 probes */
+  #ifdef SW_PROFILER
+  Start = Profile_Tick();          /* start of stage */
+  #endif
   CheckProbes(PROBE_1, PROBE_2, PROBE_3);
   CheckProbes(PROBE_2, PROBE_1, PROBE_3);
+  #ifdef PROBE_EARLY_EXIT
+  /* single resistor at probes #1 and #2 */
+  if (CheckEarlyExit(PROBE_3)) goto probing_done;
+  #endif
   CheckProbes(PROBE_1, PROBE_3, PROBE_2);
   CheckProbes(PROBE_3, PROBE_1, PROBE_2);
+  #ifdef PROBE_EARLY_EXIT
+  /* single resistor at probes #1 and #3 */
+  if (CheckEarlyExit(PROBE_2)) goto probing_done;
+  #endif
   CheckProbes(PROBE_2, PROBE_3, PROBE_1);
   CheckProbes(PROBE_3, PROBE_2, PROBE_1);
 
+  #ifdef PROBE_EARLY_EXIT
+probing_done:
+  #endif
+
+  #ifdef SW_PROFILER
+  Profile_Add(PROF_CHECKPROBES, Start); /* end of stage */
+  #endif
+
+  #ifdef UI_SERIAL_COMMANDS
+  if (ProbeCanceled())             /* remote command CANCEL */
+  {
+    goto probing_canceled;         /* skip all other checks */
+  }
+  #endif
+
   CheckAlternatives();             /* process alternatives */
   SemiPinDesignators();            /* manage semi pin designators */
 
   /* if component might be a capacitor */
+  Test = 0;                        /* no probe pair to check */
   if ((Check.Found == COMP_NONE) ||
       (Check.Found == COMP_RESISTOR))
+  {
+    /* probe pairs which might be a cap (based on R and D found) */
+    Test = CapPossible(PROBE_3, PROBE_1);
+    Test |= CapPossible(PROBE_3, PROBE_2);
+    Test |= CapPossible(PROBE_2, PROBE_1);
+  }
+
+  if (Test)                        /* at least one pair left */
   {
     /* check for capacitors */
+    /* (MeasureCap() just resets the data for impossible pairs) */
 
     /* tell user to be patient with large caps :) */
     Display_Space();
     Display_Char('C');    
 
+    #ifdef UI_EARLY_RESULT
+    /* show resistor(s) found so far while checking for caps */
+    if (Check.Found == COMP_RESISTOR)
+    {
+      Show_EarlyResult();
+    }
+    #endif
+
     /* check all possible combinations */
+    #ifdef SW_PROFILER
+    Start = Profile_Tick();        /* start of stage */
+    #endif
     MeasureCap(PROBE_3, PROBE_1, 0);
     MeasureCap(PROBE_3, PROBE_2, 1);
     MeasureCap(PROBE_2, PROBE_1, 2);
+    #ifdef SW_PROFILER
+    Profile_Add(PROF_MEASURECAP, Start);     /* end of stage */
+    #endif
   }
 
   #ifdef HW_PROBE_ZENER
   /* when no component is found check for Zener diode */
+  #ifdef UI_PRESETS
+  if ((Check.Found == COMP_NONE) && (NV.Preset == PRESET_FULL))
+  #else
   if (Check.Found == COMP_NONE)
+  #endif
   {
     CheckZener();
   }
   #endif
 
+  #ifdef UI_SERIAL_COMMANDS
+  goto show_component;             /* output result */
+
+probing_canceled:
+  Check.Found = COMP_NONE;         /* discard partial results */
+  #endif
+
 
   /*
    *  output test results
@@ -2896,6 +3516,14 @@ cycle_start:
 
 show_component:
 
+  #ifdef UI_PARTIAL_REFRESH
+  if (Refresh)                     /* continuous mode */
+  {
+    /* write new result over old one, keep same symbol */
+    Shadow_Refresh(Check.Found >= COMP_BJT);
+  }
+  else
+  #endif
   LCD_Clear();                     /* clear LCD */
 
   /* next-line mode */
@@ -2933,6 +3561,9 @@ show_component:
   #endif
 
   /* call output function based on component type */
+  #ifdef SW_PROFILER
+  Start = Profile_Tick();          /* start of stage */
+  #endif
   switch (Check.Found)
   {
     case COMP_ERROR:          /* error */
@@ -2992,10 +3623,24 @@ show_component:
       break;
   }
 
+  #ifdef SW_PROFILER
+  Profile_Add(PROF_SHOW, Start);   /* end of stage */
+  Profile_Add(PROF_CYCLE, CycleStart);   /* end of probing */
+  #endif
+
   #ifdef UI_SERIAL_COPY
   Display_Serial_Off();            /* disable serial output & NL */
   #endif
 
+  #ifdef UI_PARTIAL_REFRESH
+    /* clear old characters left over */
+    #if ! defined (BAT_NONE) && defined (UI_BATTERY_LASTLINE)
+    Shadow_RefreshDone(UI.CharMax_Y - 1);    /* last line follows below */
+    #else
+    Shadow_RefreshDone(UI.CharMax_Y);        /* all lines */
+    #endif
+  #endif
+
   #ifdef SW_SYMBOLS
   /* display fancy pinout for 3-pin semiconductors */
   if (Check.Found >= COMP_BJT)     /* 3-pin semi */
@@ -3014,14 +3659,45 @@ show_component:
   Display_LastLine();              /* manage last line */
   LCD_CharPos(1, UI.CharMax_Y);    /* move to start of last line */
   ShowBattery();                   /* display battery status */
+    #ifdef UI_PARTIAL_REFRESH
+    Shadow_RefreshDone(UI.CharMax_Y);   /* finish last line */
+    #endif
   #endif
 
   #ifdef UI_SERIAL_COMMANDS
-  /* feedback for remote command 'PROBE' */
+  /* feedback for remote commands 'PROBE' and 'APROBE' */
   if (Key == KEY_PROBE)       /* probing by command */
   {
     Display_Serial_Only();              /* switch output to serial */
-    Display_EEString_NL(Cmd_OK_str);    /* send: OK & newline */
+
+    if (Cfg.OP_Control & OP_PROBE_ASYNC)     /* asynchronous probing */
+    {
+      #ifdef SW_BURST
+      if (BurstRuns > 0)                     /* burst probing */
+      {
+        BurstRuns--;                         /* one run less */
+        Burst_Record();                      /* send result record */
+        if (BurstRuns == 0) Burst_Done();    /* last run */
+      }
+      else if (BurstCount > 0)               /* burst got canceled */
+      {
+        Burst_Done();                        /* send completion message */
+      }
+      else
+      #endif
+      {
+        Cfg.OP_Control &= ~OP_PROBE_ASYNC;   /* reset flag */
+        /* unsolicited completion message */
+        Display_EEString_Space(Cmd_DONE_str);     /* send: DONE & space */
+        Display_Value(Check.Found, 0, 0);    /* send component type ID */
+        Serial_NewLine();                    /* send newline */
+      }
+    }
+    else                                /* synchronous probing */
+    {
+      Display_EEString_NL(Cmd_OK_str);  /* send: OK & newline */
+    }
+
     Display_LCD_Only();                 /* switch output back to display */
 
     /* We don't have to restore the next-line mode since it will be 
@@ -3037,6 +3713,18 @@ show_component:
   }
   #endif
 
+  #ifdef SW_HISTORY
+  History_Add();                   /* add result to history */
+  #endif
+
+  #ifdef PROBE_FINGERPRINT
+  SaveFingerprint(&LastPart);      /* for quick re-probing */
+  #endif
+
+  #ifdef UI_PARTIAL_REFRESH
+  Refresh = 1;                     /* result is displayed */
+  #endif
+
 
   /*
    *  manage cycling and power-off
@@ -3056,14 +3744,76 @@ cycle_control:
 
   UI.LineMode = LINE_STD;          /* reset next-line mode */
 
+  #ifdef SW_BURST
+  /* burst probing: wait for next part instead of user feedback */
+  if (BurstRuns > 0)
+  {
+    Key = Burst_WaitPart();        /* wait for part change */
+    if (Key == KEY_PROBE) goto cycle_action;      /* probe new part */
+  }
+  #endif
+
   /* wait for key press or timeout */
-  #ifdef UI_KEY_HINTS
-    Display_LastLine();
-    UI.KeyHint = (unsigned char *)Menu_or_Test_str;
-    Key = TestKey((uint16_t)CYCLE_DELAY, CURSOR_BLINK | CURSOR_TEXT | CHECK_OP_MODE | CHECK_KEY_TWICE | CHECK_BAT);
-  #else
-    Key = TestKey((uint16_t)CYCLE_DELAY, CURSOR_BLINK | CHECK_OP_MODE | CHECK_KEY_TWICE | CHECK_BAT);
+  #ifdef UI_TWEEZERS
+  if (Cfg.OP_Mode & OP_TWEEZERS)   /* two-terminal mode */
+  {
+    /* continuous mode with short delay */
+    Key = TestKey((uint16_t)TWEEZERS_DELAY, CHECK_KEY_TWICE | CHECK_BAT);
+    #if CYCLE_MAX < 255
+    MissedParts = 0;               /* don't power off */
+    #endif
+  }
+  else
   #endif
+  {
+    #ifdef UI_PRESETS
+      /* shorter delay for fast preset */
+      #define CYCLE_TIMEOUT  ((NV.Preset == PRESET_FAST) ? (uint16_t)PRESET_FAST_DELAY : (uint16_t)CYCLE_DELAY)
+    #else
+      #define CYCLE_TIMEOUT  (uint16_t)CYCLE_DELAY
+    #endif
+
+    #ifdef UI_PART_DETECT
+      /* start probing when a new part is connected */
+      #define CYCLE_PART     CHECK_PART
+    #else
+      #define CYCLE_PART     0
+    #endif
+
+    #ifdef ADJUST_CAP_DRIFT
+      /* drift check of fixed cap while waiting */
+      #define CYCLE_REFCAP   CHECK_REFCAP
+    #else
+      #define CYCLE_REFCAP   0
+    #endif
+
+    #ifdef UI_KEY_HINTS
+      Display_LastLine();
+      UI.KeyHint = (unsigned char *)Menu_or_Test_str;
+      Key = TestKey(CYCLE_TIMEOUT, CURSOR_BLINK | CURSOR_TEXT | CHECK_OP_MODE | CHECK_KEY_TWICE | CHECK_BAT | CYCLE_PART | CYCLE_REFCAP);
+    #else
+      Key = TestKey(CYCLE_TIMEOUT, CURSOR_BLINK | CHECK_OP_MODE | CHECK_KEY_TWICE | CHECK_BAT | CYCLE_PART | CYCLE_REFCAP);
+    #endif
+
+    #undef CYCLE_TIMEOUT
+    #undef CYCLE_PART
+    #undef CYCLE_REFCAP
+
+    #ifdef UI_PART_DETECT
+    /* continuous mode: pause while probes are open */
+    if ((Key == KEY_TIMEOUT) && (PartPresent() == 0))
+    {
+      /* skip probing, but count as missed part */
+      #if CYCLE_MAX < 255
+      MissedParts++;               /* increase counter */
+      if (MissedParts < CYCLE_MAX)
+      #endif
+      {
+        goto cycle_control;        /* keep waiting */
+      }
+    }
+    #endif
+  }
 
   if (Key == KEY_TIMEOUT)          /* timeout (no key press) */
   {
@@ -3116,13 +3866,31 @@ cycle_control:
 cycle_action:
 #endif
 
+  #ifdef UI_SERIAL_COMMANDS
+  if (Key != KEY_PROBE)            /* no probing by command */
+  {
+    Cfg.OP_Control &= ~OP_PROBE_ASYNC;  /* reset flag */
+  }
+  #endif
+
   #ifdef SERIAL_RW
+    #if defined (SERIAL_RX_QUEUE) && defined (SERIAL_HARDWARE)
+    /* keep RX running while probing to queue further commands */
+    if ((Key == KEY_MAINMENU) || (Key == KEY_POWER_OFF))
+    #elif defined (UI_SERIAL_COMMANDS) && defined (SERIAL_HARDWARE)
+    /* keep RX running while probing asynchronously to catch CANCEL */
+    if (! (Cfg.OP_Control & OP_PROBE_ASYNC))
+    #endif
   Serial_Ctrl(SER_RX_PAUSE);       /* disable TTL serial RX */
   /* todo: when we got a locked buffer meanwhile? */
   #endif
 
   if (Key == KEY_MAINMENU)         /* run main menu */
   {
+    #ifdef UI_PARTIAL_REFRESH
+    Refresh = 0;                   /* result will be gone */
+    #endif
+
     #ifdef SAVE_POWER
     /* change sleep mode the Idle to keep timers & other stuff running */
     Test = Cfg.SleepMode;               /* get current mode */
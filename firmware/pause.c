@@ -26,6 +26,526 @@
 #include "functions.h"        /* external functions */
 
 
+/*
+ *  local constants
+ */
+
+#ifdef SYSTEM_TICK
+/* time of a Timer2 overflow (256 * 1024 MCU cycles) */
+#define TICK_OVF_US      (262144UL / MCU_CYCLES_PER_US)  /* in s */
+#define TICK_OVF_MS      (TICK_OVF_US / 1000)            /* full ms */
+#define TICK_OVF_REST    (TICK_OVF_US % 1000)            /* remaining s */
+/* time of a Timer2 cycle (1024 MCU cycles) */
+#define TICK_US          (1024 / MCU_CYCLES_PER_US)      /* in s */
+#endif
+
+
+/*
+ *  local variables
+ */
+
+#ifdef FUNC_TIMEBASE
+/* free running time base */
+volatile uint16_t         TickOverflows = 0;  /* Timer2 overflows */
+volatile uint8_t          SleepFlag;          /* MilliSleep() timeout */
+#endif
+
+#ifdef SYSTEM_TICK
+/* system tick */
+volatile uint32_t         SysTicks = 0;       /* ms counter */
+volatile uint16_t         TickRest = 0;       /* s not counted yet */
+SysTimer_Type             SysTimer[NUM_SYS_TIMERS];     /* software timers */
+#endif
+
+#ifdef TIMER_MANAGER
+/* timer manager */
+volatile uint8_t          TimerOwner[NUM_TIMERS] = {TIMER_FREE, TIMER_FREE, TIMER_FREE};
+#endif
+
+
+
+/* ************************************************************************
+ *   time base and profiler
+ * ************************************************************************ */
+
+
+#ifdef FUNC_TIMEBASE
+
+/*
+ *  set up Timer2 as free running time base
+ *  - normal mode, prescaler 1024
+ *  - overflow interrupt extends counter to 24 bits
+ *  - doesn't reset counter when already running
+ */
+
+void Profile_Init(void)
+{
+  TCCR2A = 0;                      /* normal mode */
+  TIMSK2 |= (1 << TOIE2);          /* enable overflow interrupt */
+
+  /* start timer by setting clock prescaler to 1024 */
+  TCCR2B = (1 << CS22) | (1 << CS21) | (1 << CS20);
+}
+
+
+
+/*
+ *  get current profiler tick
+ *  - 1024 MCU cycles per tick
+ *
+ *  returns:
+ *  - tick counter
+ */
+
+uint32_t Profile_Tick(void)
+{
+  uint32_t          Ticks;              /* return value */
+  uint8_t           Counter;            /* Timer2 counter */
+  uint8_t           Old_SREG;           /* status register */
+
+  Old_SREG = SREG;                 /* save status register */
+  cli();                           /* disable interrupts */
+
+  Counter = TCNT2;                 /* get timer counter */
+  Ticks = TickOverflows;           /* get overflows */
+
+  /* consider overflow not processed yet */
+  if ((TIFR2 & (1 << TOV2)) && (Counter < 128))
+  {
+    Ticks++;
+  }
+
+  SREG = Old_SREG;                 /* restore status register */
+
+  Ticks <<= 8;                     /* overflows * 256 */
+  Ticks |= Counter;                /* add timer counter */
+
+  return Ticks;
+}
+
+#endif
+
+
+
+#ifdef SYSTEM_TICK
+
+/*
+ *  get system tick
+ *  - time since Timer2 was started
+ *  - wraps around after about 49 days
+ *
+ *  returns:
+ *  - time in ms
+ */
+
+uint32_t SysTick_Get(void)
+{
+  uint32_t          Ticks;              /* return value */
+  uint32_t          Rest;               /* remaining time (in s) */
+  uint8_t           Counter;            /* Timer2 counter */
+  uint8_t           Old_SREG;           /* status register */
+
+  Old_SREG = SREG;                 /* save status register */
+  cli();                           /* disable interrupts */
+
+  Counter = TCNT2;                 /* get timer counter */
+  Ticks = SysTicks;                /* get ms */
+  Rest = TickRest;                 /* get remaining s */
+
+  /* consider overflow not processed yet */
+  if ((TIFR2 & (1 << TOV2)) && (Counter < 128))
+  {
+    Ticks += TICK_OVF_MS;
+    Rest += TICK_OVF_REST;
+  }
+
+  SREG = Old_SREG;                 /* restore status register */
+
+  /* add time of current timer cycles */
+  Rest += (uint32_t)Counter * TICK_US;
+  Ticks += Rest / 1000;            /* s -> ms */
+
+  return Ticks;
+}
+
+
+
+/*
+ *  start software timer
+ *
+ *  requires:
+ *  - ID: timer ID
+ *  - Time: time until expiry (in ms)
+ *  - Period: reload period after expiry (in ms)
+ *    0 for one-shot timer
+ */
+
+void SysTimer_Start(uint8_t ID, uint16_t Time, uint16_t Period)
+{
+  SysTimer_Type     *Timer;             /* pointer to timer */
+
+  Timer = &SysTimer[ID];           /* get timer */
+
+  Timer->Deadline = SysTick_Get() + Time;
+  Timer->Period = Period;
+  Timer->State = TIMER_RUNNING;
+}
+
+
+
+/*
+ *  check software timer for expiry
+ *  - a one-shot timer is stopped after expiry
+ *  - a periodic timer is restarted from the current time, so a late
+ *    check doesn't cause a burst of expiries
+ *
+ *  requires:
+ *  - ID: timer ID
+ *
+ *  returns:
+ *  - 1 if timer expired
+ *  - 0 if timer is still running or is stopped
+ */
+
+uint8_t SysTimer_Expired(uint8_t ID)
+{
+  uint8_t           Flag = 0;           /* return value */
+  uint32_t          Now;                /* current time */
+  SysTimer_Type     *Timer;             /* pointer to timer */
+
+  Timer = &SysTimer[ID];           /* get timer */
+
+  if (Timer->State == TIMER_RUNNING)    /* timer is running */
+  {
+    Now = SysTick_Get();                /* get current time */
+
+    /* deadline reached (signed difference handles wrap-around) */
+    if ((int32_t)(Now - Timer->Deadline) >= 0)
+    {
+      Flag = 1;                         /* signal expiry */
+
+      if (Timer->Period)                /* periodic timer */
+      {
+        Timer->Deadline = Now + Timer->Period;    /* restart */
+      }
+      else                              /* one-shot timer */
+      {
+        Timer->State = TIMER_STOPPED;   /* stop timer */
+      }
+    }
+  }
+
+  return Flag;
+}
+
+#endif
+
+
+
+#ifdef SW_PROFILER
+
+/*
+ *  reset profiling data
+ */
+
+void Profile_Reset(void)
+{
+  uint8_t           n = 0;         /* counter */
+
+  while (n < NUM_PROF_STAGES)
+  {
+    Profile.Ticks[n] = 0;
+    Profile.Runs[n] = 0;
+    n++;
+  }
+}
+
+
+
+/*
+ *  add time spent in a stage
+ *
+ *  requires:
+ *  - Stage: stage ID
+ *  - Start: tick at start of stage
+ */
+
+void Profile_Add(uint8_t Stage, uint32_t Start)
+{
+  Profile.Ticks[Stage] += Profile_Tick() - Start;
+  if (Profile.Runs[Stage] < UINT8_MAX)  /* prevent overflow */
+  {
+    Profile.Runs[Stage]++;
+  }
+}
+
+#endif
+
+
+
+#ifdef FUNC_TIMEBASE
+
+/*
+ *  ISR for overflow of Timer2
+ */
+
+ISR(TIMER2_OVF_vect, ISR_BLOCK)
+{
+  /*
+   *  hints:
+   *  - the TOV2 interrupt flag is cleared automatically
+   */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_TIMER2]++;   /* count ISR call */
+  #endif
+
+  TickOverflows++;            /* one more overflow */
+
+  #ifdef SYSTEM_TICK
+  /* update ms counter */
+  SysTicks += TICK_OVF_MS;    /* add full ms */
+  TickRest += TICK_OVF_REST;  /* add remaining s */
+  if (TickRest >= 1000)       /* another ms */
+  {
+    SysTicks++;
+    TickRest -= 1000;
+  }
+  #endif
+
+  #ifdef INPUT_QUEUE
+  Key_Scan((uint16_t)SysTicks);    /* scan test push button */
+  #endif
+}
+
+#endif
+
+
+
+#ifdef FUNC_TIMESTAMP
+
+/* ************************************************************************
+ *   s time stamp
+ * ************************************************************************ */
+
+
+/*
+ *  start s time stamp
+ *  - Timer1 in normal mode, counts up from 0
+ *  - prescaler depends on MCU clock (see TIMESTAMP_PRESCALER)
+ *  - get time stamp by reading TCNT1 and convert time limits with
+ *    TIMESTAMP_TICKS() at compile time
+ *  - 16 bit counter wraps around, so use differences of time stamps
+ *  - Timer1 must not be used by anything else meanwhile
+ */
+
+void Timestamp_Start(void)
+{
+  TCCR1B = 0;                      /* stop timer */
+  TCCR1A = 0;                      /* normal mode */
+  TCNT1 = 0;                       /* reset counter */
+  TIMSK1 = 0;                      /* no interrupts */
+
+  TCCR1B = TIMESTAMP_CLOCK;        /* start timer by setting prescaler */
+}
+
+
+
+/*
+ *  stop s time stamp
+ */
+
+void Timestamp_Stop(void)
+{
+  TCCR1B = 0;                      /* stop timer */
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   32 bit input capture (Timer1)
+ * ************************************************************************ */
+
+
+/*
+ *  wait for input capture of Timer1 and extend it by the overflows
+ *  - caller sets up the trigger source (e.g. analog comparator) and
+ *    starts Timer1 in normal mode
+ *  - counts overflows while waiting, stops Timer1 when done
+ *  - overflow at 65.536ms for 1MHz or 8.192ms for 8MHz
+ *
+ *  requires:
+ *  - Ticks: pointer to 32 bit counter value (in timer ticks)
+ *  - Timeout: max. number of timer overflows
+ *
+ *  returns:
+ *  - 1 on capture
+ *  - 0 on timeout
+ */
+
+uint8_t Capture_Wait(uint32_t *Ticks, uint16_t Timeout)
+{
+  uint8_t           Flag = 1;           /* return value */
+  uint8_t           Test;               /* timer flags */
+  uint16_t          Ticks_L;            /* capture value */
+  uint16_t          Ticks_H = 0;        /* overflow counter */
+
+  while (1)
+  {
+    Test = TIFR1;                  /* get Timer1 flags */
+
+    /* end loop if input capture flag is set */
+    if (Test & (1 << ICF1)) break;
+
+    /* detect timer overflow by checking the overflow flag */
+    if (Test & (1 << TOV1))
+    {
+      TIFR1 = (1 << TOV1);         /* reset flag */
+      wdt_reset();                 /* reset watchdog */
+      Ticks_H++;                   /* increase overflow counter */
+
+      /* end loop if it takes too long */
+      if (Ticks_H == Timeout)
+      {
+        Flag = 0;                  /* signal timeout */
+        break;                     /* end loop */
+      }
+    }
+  }
+
+  /* stop counter */
+  TCCR1B = 0;                      /* stop timer */
+  TIFR1 = (1 << ICF1);             /* reset Input Capture flag */
+
+  Ticks_L = ICR1;                  /* get counter value */
+
+  /* catch missed timer overflow (before capture) */
+  if ((TCNT1 > Ticks_L) && (Test & (1 << TOV1)))
+  {
+    TIFR1 = (1 << TOV1);           /* reset overflow flag */
+    Ticks_H++;                     /* increase overflow counter */
+  }
+
+  /* combine both counter values */
+  *Ticks = (uint32_t)Ticks_L;           /* lower 16 bits */
+  *Ticks |= (uint32_t)Ticks_H << 16;    /* upper 16 bits */
+
+  return Flag;
+}
+
+
+
+#ifdef TIMER_MANAGER
+
+/* ************************************************************************
+ *   timer manager
+ * ************************************************************************ */
+
+
+/*
+ *  claim hardware timer
+ *  - for functions sharing a timer and its interrupt vectors
+ *  - claiming an already owned timer again is allowed
+ *  - can be called by ISRs too
+ *
+ *  requires:
+ *  - Timer: TIMER_0, TIMER_1 or TIMER_2
+ *  - Owner: ID of owner (TIMER_SERIAL etc.)
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 if timer is owned by someone else
+ */
+
+uint8_t Timer_Claim(uint8_t Timer, uint8_t Owner)
+{
+  uint8_t           Flag = 0;           /* return value */
+  uint8_t           Old_SREG;           /* status register */
+
+  Old_SREG = SREG;                 /* save status register */
+  cli();                           /* disable interrupts */
+
+  if ((TimerOwner[Timer] == TIMER_FREE) || (TimerOwner[Timer] == Owner))
+  {
+    TimerOwner[Timer] = Owner;     /* set new owner */
+    Flag = 1;                      /* signal success */
+  }
+
+  SREG = Old_SREG;                 /* restore status register */
+
+  return Flag;
+}
+
+
+
+/*
+ *  release hardware timer
+ *  - only the current owner can release the timer
+ *  - timer should be stopped and its interrupts disabled already
+ *
+ *  requires:
+ *  - Timer: TIMER_0, TIMER_1 or TIMER_2
+ *  - Owner: ID of owner (TIMER_SERIAL etc.)
+ */
+
+void Timer_Release(uint8_t Timer, uint8_t Owner)
+{
+  uint8_t           Old_SREG;           /* status register */
+
+  Old_SREG = SREG;                 /* save status register */
+  cli();                           /* disable interrupts */
+
+  if (TimerOwner[Timer] == Owner)
+  {
+    TimerOwner[Timer] = TIMER_FREE;
+  }
+
+  SREG = Old_SREG;                 /* restore status register */
+}
+
+
+
+/*
+ *  ISR for match of Timer0's OCR0B (Output Compare Register B)
+ *  - shared by bit-bang serial RX and timer driven IR sender
+ *  - passes on to handler of current owner
+ */
+
+ISR(TIMER0_COMPB_vect, ISR_BLOCK)
+{
+  /*
+   *  hints:
+   *  - the OCF0B interrupt flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_TIMER0]++;   /* count ISR call */
+  #endif
+
+  switch (TimerOwner[TIMER_0])
+  {
+    case TIMER_SERIAL:        /* bit-bang serial RX */
+      Serial_RX_Sample();
+      break;
+
+    case TIMER_IR_TX:         /* IR sender */
+      IR_Send_Next();
+      break;
+
+    default:                  /* no owner */
+      TCCR0B = 0;             /* stop Timer0 */
+      TIMSK0 = 0;             /* disable interrupts */
+      break;
+  }
+}
+
+#endif
+
+
 
 /* ************************************************************************
  *   sleep functions
@@ -47,6 +567,14 @@ void MilliSleep(uint16_t Time)
   #ifdef SAVE_POWER
   uint8_t                Mode;          /* sleep mode */
   #endif
+  #ifdef SW_POWER_STATS
+  uint32_t               Start;         /* start tick */
+  #endif
+
+  #ifdef FUNC_LCD_FLUSH
+  /* show pending output while we wait */
+  LCD_Flush();
+  #endif
 
   /*
    *  calculate stuff
@@ -107,10 +635,27 @@ void MilliSleep(uint16_t Time)
    *  set up timer
    */
 
+  #ifdef FUNC_TIMEBASE
+  /* keep Timer2 running since it's also the free running time base */
+  Profile_Init();                  /* make sure timer is running */
+  TIFR2 = (1 << OCF2A);            /* clear pending OCR2A match flag */
+  TIMSK2 = (1 << TOIE2) | (1 << OCIE2A);   /* enable OCR2A match too */
+  #else
   TCCR2B = 0;                      /* stop timer */
   TCNT2 = 0;                       /* set counter to 0 */
   TCCR2A = (1 << WGM21);           /* set CTC mode */
   TIMSK2 = (1 << OCIE2A);          /* enable interrupt for OCR2A match */
+  #endif
+
+  #ifdef I2C_TWI_IRQ
+  /* TWI isn't clocked in power save mode */
+  I2C_Flush();                     /* finish queued I2C jobs */
+  #endif
+
+  #ifdef SERIAL_TX_BUFFER
+  /* USART isn't clocked in power save mode */
+  Serial_Flush();                  /* send pending serial output */
+  #endif
 
   #ifdef SAVE_POWER
   set_sleep_mode(Mode);            /* set sleep mode */
@@ -125,6 +670,10 @@ void MilliSleep(uint16_t Time)
     sei();                         /* enable interrupts */
   }
 
+  #ifdef SW_POWER_STATS
+  Start = Profile_Tick();          /* start of sleep */
+  #endif
+
 
   /*
    *  processing loop
@@ -149,6 +698,17 @@ void MilliSleep(uint16_t Time)
     }
 
     Cycles -= Timeout;        /* update counter */
+
+    #ifdef FUNC_TIMEBASE
+    /* free running timer: match is relative to current counter */
+    if (Timeout < 2)          /* prevent match in the past */
+    {
+      Timeout = 2;            /* slightly longer */
+    }
+
+    SleepFlag = 1;                 /* set flag */
+    OCR2A = TCNT2 + Timeout;       /* set compare value (timeout) */
+    #else
     Timeout--;                /* interrupt is triggered by cycle after match */
     /* todo: what happens if Timeout is 0? */
 
@@ -157,6 +717,7 @@ void MilliSleep(uint16_t Time)
 
     /* start timer by setting clock prescaler to 1024 */
     TCCR2B = (1 << CS22) | (1 << CS21) | (1 << CS20);
+    #endif
 
     /*
      *  sleep
@@ -164,7 +725,11 @@ void MilliSleep(uint16_t Time)
      *    that we track the right interrupt
      */
 
+    #ifdef FUNC_TIMEBASE
+    while (SleepFlag)         /* as long as timeout isn't reached */
+    #else
     while (TCCR2B != 0)       /* as long as Timer2 is running */
+    #endif
     {
       #ifdef SAVE_POWER
         /* enter sleep mode to save power */
@@ -181,6 +746,23 @@ void MilliSleep(uint16_t Time)
     }
   }
 
+  #ifdef FUNC_TIMEBASE
+  TIMSK2 = (1 << TOIE2);      /* disable interrupt for OCR2A match */
+  #endif
+
+  #ifdef SW_POWER_STATS
+  /* account time slept (time base has 24 bits) */
+  Start = (Profile_Tick() - Start) & 0x00FFFFFF;
+  if (Mode == SLEEP_MODE_PWR_SAVE)      /* power save mode */
+  {
+    SleepStats.PwrSave += Start;
+  }
+  else                                  /* idle mode */
+  {
+    SleepStats.Idle += Start;
+  }
+  #endif
+
   if (Flag == 0)              /* restore former interrupt setting */
   {
     cli();                    /* disable interrupts */
@@ -189,6 +771,34 @@ void MilliSleep(uint16_t Time)
 
 
 
+#ifdef SAVE_POWER
+
+/*
+ *  wait with MCU in idle sleep mode
+ *  - replacement for busy waits of settling times in measurements
+ *    (see settle*ms() in functions.h)
+ *  - idle mode keeps I/O ports, ADC and bandgap reference running
+ *  - about 2.4% longer than requested (see MilliSleep())
+ *  - don't use this function for timing a measurement!
+ *
+ *  requires:
+ *  - Time: time to wait (in ms)
+ */
+
+void IdleWait(uint16_t Time)
+{
+  uint8_t           Mode;          /* sleep mode */
+
+  Mode = Cfg.SleepMode;            /* save current sleep mode */
+  Cfg.SleepMode = SLEEP_MODE_IDLE; /* no oscillator start-up delay */
+  MilliSleep(Time);                /* sleep */
+  Cfg.SleepMode = Mode;            /* restore sleep mode */
+}
+
+#endif
+
+
+
 /*
  *  ISR for match of Timer2's OCR2A (Output Compare Register A)
  */
@@ -202,7 +812,15 @@ ISR(TIMER2_COMPA_vect, ISR_BLOCK)
    *    (no nested interrupts)
    */
 
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_TIMER2]++;   /* count ISR call */
+  #endif
+
+  #ifdef FUNC_TIMEBASE
+  SleepFlag = 0;              /* signal timeout */
+  #else
   TCCR2B = 0;                 /* stop Timer2 */
+  #endif
 }
 
 
@@ -212,6 +830,14 @@ ISR(TIMER2_COMPA_vect, ISR_BLOCK)
  * ************************************************************************ */
 
 
+/* timing for system tick */
+#ifdef SYSTEM_TICK
+  #undef TICK_OVF_US
+  #undef TICK_OVF_MS
+  #undef TICK_OVF_REST
+  #undef TICK_US
+#endif
+
 /* source management */
 #undef PAUSE_C
 
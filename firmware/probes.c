@@ -40,10 +40,31 @@
  *  - Probe1: pin ID [0-2], mostly high level pin
  *  - Probe2: pin ID [0-2], mostly low level pin
  *  - Probe3: pin ID [0-2], mostly switch/gate pin
+ *  - PROBE_TABLE: the table covers only permutations of the pin IDs,
+ *    other combinations (e.g. the same ID twice) are looked up one by one
  */
 
 void UpdateProbes(uint8_t Probe1, uint8_t Probe2, uint8_t Probe3)
 {
+  #ifdef PROBE_TABLE
+  uint8_t           Index;              /* table index */
+
+  /* check for permutation */
+  if ((Probe1 != Probe2) && (Probe1 != Probe3) && (Probe2 != Probe3))
+  {
+    /*
+     *  copy precomputed settings
+     *  - index: probe-1 * 2 + (probe-2 > probe-3)
+     *  - entry matches the order of IDs and masks in Probe_Type
+     */
+
+    Index = Probe1 * 2;
+    if (Probe2 > Probe3) Index++;
+    DATA_read_block(&Probes, &Probe_table[Index], PROBE_PERM_SIZE);
+    return;
+  }
+  #endif
+
   /* set probe IDs */
   Probes.ID_1 = Probe1;
   Probes.ID_2 = Probe2;
@@ -164,7 +185,11 @@ uint8_t ShortedPair(uint8_t Probe1, uint8_t Probe2)
 
   /* read voltages */
   U1 = ReadU_5ms(Probes.Ch_1);
+  #ifdef ADC_INTERRUPT
+  ADC_Start(Probes.Ch_2, SAMPLE_STD);     /* sample probe-2 in background */
+  #else
   U2 = ReadU(Probes.Ch_2);
+  #endif
 
   /*
    *  We expect both probe voltages to be about the same and
@@ -174,6 +199,10 @@ uint8_t ShortedPair(uint8_t Probe1, uint8_t Probe2)
   Min = (Cfg.Vcc / 2) - 30;        /* lower voltage */
   Max = (Cfg.Vcc / 2) + 30;        /* upper voltage */
 
+  #ifdef ADC_INTERRUPT
+  U2 = ADC_Collect();              /* get voltage at probe-2 */
+  #endif
+
   if ((U1 > Min) && (U1 < Max))    /* U1 within window */
   { 
     if ((U2 > Min) && (U2 < Max))  /* U2 within window */
@@ -211,6 +240,59 @@ uint8_t ShortedProbes(void)
 
 
 
+#ifdef FUNC_PART_PRESENT
+
+/*
+ *  quick check for a connected part
+ *  - pulls up each probe in turn via Rh with the other two probes
+ *    pulled down directly
+ *  - anything conducting (R up to a few MOhms, diode junction, larger
+ *    cap) pulls the voltage down distinctly from Vcc
+ *
+ *  returns:
+ *  - 1 if a part is connected
+ *  - 0 if probes are open
+ */
+
+uint8_t PartPresent(void)
+{
+  uint8_t           Flag = 0;      /* return value */
+  uint8_t           n = 0;         /* counter */
+  uint16_t          U;             /* voltage */
+
+  while (n <= 2)
+  {
+    UpdateProbes(n, (n + 1) % 3, (n + 2) % 3);
+
+    /* set probes: Gnd -- probe-2 & probe-3 / probe-1 -- Rh -- Vcc */
+    ADC_PORT = 0;
+    ADC_DDR = Probes.Pin_2 | Probes.Pin_3;  /* pull down directly */
+    R_DDR = Probes.Rh_1;           /* enable Rh for probe-1 */
+    R_PORT = Probes.Rh_1;          /* pull up probe-1 via Rh */
+    U = ReadU_5ms(Probes.Ch_1);    /* get voltage at probe-1 */
+
+    /* open probe: about Vcc (allow 1/16 for leakage) */
+    if (U < (Cfg.Vcc - (Cfg.Vcc / 16)))
+    {
+      Flag = 1;                    /* part connected */
+      n = 3;                       /* end loop */
+    }
+
+    n++;                           /* next probe */
+  }
+
+  /* reset probes */
+  ADC_DDR = 0;
+  R_DDR = 0;
+  R_PORT = 0;
+
+  return Flag;
+}
+
+#endif
+
+
+
 #if defined (SW_ESR) || defined (SW_OLD_ESR)
 
 /*
@@ -302,6 +384,67 @@ void DischargeCap(uint8_t Probe1, uint8_t Probe2)
 
 
 
+#ifdef DISCHARGE_ADAPTIVE
+
+/*
+ *  estimate remaining discharge time based on exponential decay
+ *  - simulates further decay with the ratio of the last two readings
+ *    until the voltage drops to CAP_DISCHARGED
+ *  - doubles the simulation step every 16 steps to support slow decays
+ *
+ *  requires:
+ *  - U_1: former voltage (mV)
+ *  - U_2: current voltage (mV)
+ *  - Interval: time between both readings (ms)
+ *
+ *  returns:
+ *  - estimated time in ms
+ *  - UINT16_MAX if no decay or time out of range
+ */
+
+uint16_t DischargeTime(uint16_t U_1, uint16_t U_2, uint8_t Interval)
+{
+  uint32_t          U;                  /* simulated voltage */
+  uint32_t          Ratio;              /* decay per step (16 bit fraction) */
+  uint32_t          Time = 0;           /* remaining time */
+  uint32_t          Step;               /* simulation step */
+  uint8_t           n = 0;              /* step counter */
+
+  if (U_2 >= U_1) return UINT16_MAX;    /* no decay */
+
+  Ratio = (uint32_t)U_2 << 16;          /* U_2 / U_1 as fraction */
+  Ratio /= U_1;
+  Step = Interval;
+  U = U_2;
+
+  while (U > CAP_DISCHARGED)
+  {
+    U *= Ratio;                         /* voltage after next step */
+    U >>= 16;
+    Time += Step;                       /* add time of step */
+
+    if (Time >= UINT16_MAX)             /* out of range */
+    {
+      return UINT16_MAX;
+    }
+
+    n++;                                /* next step */
+    if (n == 16)                        /* 16 steps done */
+    {
+      Ratio *= Ratio;                   /* decay for double time */
+      Ratio >>= 16;
+      Step <<= 1;                       /* double step */
+      n = 0;                            /* reset counter */
+    }
+  }
+
+  return (uint16_t)Time;
+}
+
+#endif
+
+
+
 /*
  *  try to discharge any connected components, e.g. capacitors
  *  - detect batteries
@@ -317,6 +460,12 @@ void DischargeProbes(void)
   uint8_t           Channel;            /* ADC MUX channel */
   uint16_t          U_c;                /* current voltage */
   uint16_t          U_old[3];           /* old voltages */
+  #ifdef DISCHARGE_ADAPTIVE
+  uint8_t           Wait = 0;           /* wait time of last round (ms) */
+  uint8_t           Seconds = 0;        /* displayed remaining time (s) */
+  uint16_t          Time = 0;           /* estimated remaining time (ms) */
+  uint16_t          Temp;               /* temporary value */
+  #endif
 
 
   /*
@@ -374,6 +523,15 @@ void DischargeProbes(void)
 
     if (U_c < U_old[ID])                /* voltage decreased */
     {
+      #ifdef DISCHARGE_ADAPTIVE
+      /* estimate remaining time (no clue about time in first round) */
+      if (Wait > 0)
+      {
+        Temp = DischargeTime(U_old[ID], U_c, Wait);
+        if (Temp > Time) Time = Temp;   /* use slowest probe */
+      }
+      #endif
+
       U_old[ID] = U_c;                  /* update old value */
 
       /* adapt timeout based on discharge rate */
@@ -423,11 +581,69 @@ void DischargeProbes(void)
 
       Counter = 0;                      /* end loop */
     }
+    #ifdef DISCHARGE_ADAPTIVE
+    else if (((~Flags & 0b00000111) >> (ID + 1)) == 0)
+    {
+      /*
+       *  last pending probe of this round
+       *  - wait before next round based on estimated remaining time
+       *  - if voltage didn't decrease: 50ms per pending probe to keep
+       *    the timing of the no-changes counter
+       */
+
+      if (Wait == 0)                    /* first round */
+      {
+        Wait = 5;                       /* short wait to get the decay */
+      }
+      else if (Time == 0)               /* no decay */
+      {
+        Wait = 0;
+        Temp = ~Flags & 0b00000111;     /* pending probes */
+        while (Temp)                    /* 50ms for each one */
+        {
+          if (Temp & 1) Wait += 50;
+          Temp >>= 1;
+        }
+      }
+      else if (Time >= 50)              /* slow decay */
+      {
+        Wait = 50;                      /* default */
+      }
+      else                              /* fast decay */
+      {
+        Wait = (uint8_t)Time;           /* wait just the remaining time */
+        if (Wait == 0) Wait = 1;        /* minimum 1ms */
+      }
+
+      /* display estimated remaining time for long discharges */
+      if ((Cfg.OP_Control & OP_DISCHARGE_INFO) && (UI.CharMax_Y >= 3) &&
+          (Time >= 1000) && (Time < UINT16_MAX))
+      {
+        Temp = Time / 1000;             /* in s */
+        Temp++;                         /* round up */
+
+        if (Temp != Seconds)            /* changed */
+        {
+          Seconds = (uint8_t)Temp;      /* update value */
+          LCD_ClearLine(3);             /* clear line #3 */
+          LCD_CharPos(1, 3);            /* move to line #3 */
+          Display_EEString_Space(Discharge_str);  /* display: Discharge */
+          Display_Value(Seconds, 0, 's');         /* display time */
+        }
+      }
+
+      Time = 0;                         /* reset estimate for next round */
+
+      wdt_reset();                      /* reset watchdog */
+      MilliSleep(Wait);                 /* wait */
+    }
+    #else
     else                                /* go for another round */
     {
       wdt_reset();                      /* reset watchdog */
       MilliSleep(50);                   /* wait for 50ms */
     }
+    #endif
   }
 
   /* reset probes */
@@ -486,6 +702,7 @@ void PullProbe(uint8_t Mask, uint8_t Mode)
 /*
  *  lookup a voltage/ratio based factor in a table and interpolate it's value
  *  - value decreases with index position
+ *  - table details are taken from Factor_table
  *
  *  requires:
  *  - voltage (in mV) or ratio
@@ -499,73 +716,79 @@ uint16_t GetFactor(uint16_t U_in, uint8_t ID)
 {
   uint16_t          Factor;             /* return value */
   uint16_t          U_Diff;             /* voltage difference to table start */
-  uint16_t          Fact1, Fact2;       /* table entries */
-  uint16_t          TabStart;           /* table start voltage */
-  uint16_t          TabStep;            /* table step voltage */
-  uint16_t          TabIndex;           /* table entries (-2) */
+  #ifndef FACTOR_SLOPES
+  uint16_t          Fact1;              /* table entry */
+  #endif
+  uint16_t          Fact2;              /* table entry */
   uint16_t          *Table;             /* pointer to table */
   uint8_t           Index;              /* table index */
   uint8_t           Diff;               /* difference to next entry */
+  Factor_Type       Data;               /* table details */
+  #ifdef FACTOR_SLOPES
+  uint32_t          Value;              /* interpolated difference */
+  #endif
 
   /*
-   *  set up table specific stuff
+   *  get table specific stuff
    */
 
-  if (ID == TABLE_SMALL_CAP)
-  {
-    TabStart = 1000;                         /* table starts at 1000mV */
-    TabStep = 50;                            /* 50mV steps between entries */
-    TabIndex = (NUM_SMALL_CAP - 2);          /* entries in table - 2 */
-    Table = (uint16_t *)&SmallCap_table[0];  /* pointer to table */
-  }
-  else if (ID == TABLE_LARGE_CAP)
-  {
-    TabStart = 300;                          /* table starts at 1000mV */
-    TabStep = 25;                            /* 25mV steps between entries */
-    TabIndex = (NUM_LARGE_CAP - 2);          /* entries in table - 2 */
-    Table = (uint16_t *)&LargeCap_table[0];  /* pointer to table */
-  }
-  #ifdef SW_INDUCTOR
-  else if (ID == TABLE_INDUCTOR)
-  {
-    TabStart = 200;                          /* table starts at 200 */
-    TabStep = 25;                            /* steps between entries */
-    TabIndex = (NUM_INDUCTOR - 2);           /* entries in table - 2 */
-    Table = (uint16_t *)&Inductor_table[0];  /* pointer to table */
-  }
-  #endif
-  else
+  if ((ID == 0) || (ID > NUM_FACTOR_TABLES))      /* unknown table */
   {
     return 0;                 /* signal error */
   }
 
+  DATA_read_block(&Data, &Factor_table[ID - 1], sizeof(Factor_Type));
+
   /*
    *  We interpolate the table values corresponding to the given voltage/ratio.
    */
 
   /* difference to start of table */
-  if (U_in >= TabStart) U_Diff = U_in - TabStart;  
+  if (U_in >= Data.Start) U_Diff = U_in - Data.Start;
   else U_Diff = 0;
 
   /* calculate table index */
-  Index = U_Diff / TabStep;             /* index (position in table) */
-  Diff = U_Diff % TabStep;              /* difference to index */
-  Diff = TabStep - Diff;                /* difference to next entry */
+  Factor = (uint16_t)Data.Step * (Data.Index + 1);     /* end of table */
 
-  /* prevent index overflow */
-  if (Index > TabIndex) Index = TabIndex;
+  if (U_Diff < Factor)                  /* within table */
+  {
+    /* U_Diff / Step by multiplying with reciprocal (exact for this range) */
+    Index = ((uint32_t)U_Diff * Data.Recip) >> 16;
+    Diff = U_Diff - Index * Data.Step;  /* difference to index */
+    Diff = Data.Step - Diff;            /* difference to next entry */
+  }
+  else                                  /* beyond end of table */
+  {
+    Index = Data.Index;                 /* last segment */
+    Diff = U_Diff % Data.Step;          /* difference to index */
+    Diff = Data.Step - Diff;            /* difference to next entry */
+  }
 
-  /* get values for index and next entry */
+  /* get value of next entry */
+  Table = (uint16_t *)Data.Table;       /* pointer to table */
   Table += Index;                       /* advance to index */
+  #ifndef FACTOR_SLOPES
   Fact1 = DATA_read_word(Table);
+  #endif
   Table++;                              /* next entry */
   Fact2 = DATA_read_word(Table);
 
   /* interpolate values based on the difference */
+  #ifdef FACTOR_SLOPES
+  /* slope * difference, with rounding */
+  Table = (uint16_t *)Data.Slope;       /* pointer to slopes */
+  Table += Index;                       /* advance to segment */
+  Value = DATA_read_word(Table);
+  Value *= Diff;
+  Value += (1UL << (Data.Shift - 1));
+  Value >>= Data.Shift;
+  Factor = (uint16_t)Value;
+  #else
   Factor = Fact1 - Fact2;
   Factor *= Diff;
-  Factor += TabStep / 2;
-  Factor /= TabStep;
+  Factor += Data.Step / 2;
+  Factor /= Data.Step;
+  #endif
   Factor += Fact2;
 
   return Factor;
@@ -589,7 +812,7 @@ uint16_t GetFactor(uint16_t U_in, uint8_t ID)
  *  requires:
  *  - Value: unsigned value
  *  - Scale: exponent/multiplier (* 10^n)
- *  - E_Series: E6 - E96
+ *  - E_Series: E6 - E192
  *  - Tolerance: tolerance (in 0.1%)
  *
  *  returns:
@@ -602,8 +825,11 @@ uint8_t GetENormValue(uint32_t Value, int8_t Scale, uint8_t E_Series, uint8_t To
 {
   uint8_t           Flag = 0;           /* return values */
   uint16_t          *Table;             /* pointer to table */
-  uint8_t           Index;              /* table index */
-  uint8_t           n;                  /* counter */
+  uint8_t           Index;              /* number of norm values */
+  uint8_t           Step = 1;           /* step size for table */
+  uint8_t           n;                  /* table index */
+  uint8_t           Low;                /* first index of search range */
+  uint8_t           Mid;                /* middle of search range */
   uint16_t          Norm;               /* norm value */
   uint16_t          LowVal = 0;         /* lower norm value */
   uint16_t          HighVal = 0;        /* higher norm value */
@@ -655,11 +881,24 @@ uint8_t GetENormValue(uint32_t Value, int8_t Scale, uint8_t E_Series, uint8_t To
 
     #ifdef SW_E96
     case E96:                                /* E96 */
+      #ifdef SW_E192
+      /* E96 is every second value of E192 */
+      Table = (uint16_t *)&E192_table[0];    /* pointer to table */
+      Step = 2;                              /* skip odd values */
+      #else
       Table = (uint16_t *)&E96_table[0];     /* pointer to table */
+      #endif
       Index = NUM_E96;                       /* 96 values */
       break;
     #endif
 
+    #ifdef SW_E192
+    case E192:                               /* E192 */
+      Table = (uint16_t *)&E192_table[0];    /* pointer to table */
+      Index = NUM_E192;                      /* 192 values */
+      break;
+    #endif
+
     default:                                 /* no matching E series */
       return Flag;                           /* signal error */
       break;
@@ -704,36 +943,47 @@ uint8_t GetENormValue(uint32_t Value, int8_t Scale, uint8_t E_Series, uint8_t To
 
   /*
    *  get lower and higher norm value from table
+   *  - binary search for the first norm value not lower than the
+   *    component value (higher norm value)
+   *  - the norm value before is the lower norm value
    */
 
-  n = 0;                      /* reset counter */
+  Low = 0;                    /* first index */
+  n = Index;                  /* last index + 1 */
 
-  while (n < Index)           /* loop through table */
+  while (Low < n)             /* search range left */
   {
-    Norm = DATA_read_word(Table);  /* read norm value */
+    Mid = Low + ((n - Low) / 2);             /* middle element */
+    Norm = DATA_read_word(Table + (Mid * Step));  /* read norm value */
 
     if (Norm < (uint16_t)Value)    /* norm value lower */
     {
-      LowVal = Norm;               /* update lower norm value */
-      #ifdef FUNC_EIA96
-      LowIndex = n;                /* update index number */
-      #endif
+      Low = Mid + 1;               /* search upper half */
     }
     else                           /* norm value higher */
     {
-      HighVal = Norm;              /* save higher norm value */
-      #ifdef FUNC_EIA96
-      HighIndex = n;               /* save index number */
-      #endif
-      break;                       /* end loop */
+      n = Mid;                     /* search lower half */
     }
+  }
 
-    Table++;                       /* next element */
-    n++;                           /* next one */
+  /* n is index of higher norm value now */
+
+  if (n > 0)                       /* got lower norm value */
+  {
+    LowVal = DATA_read_word(Table + ((n - 1) * Step));
+    #ifdef FUNC_EIA96
+    LowIndex = n - 1;              /* save index number */
+    #endif
   }
 
-  /* manage table index overflow */
-  if (n == Index)                  /* reached last element */
+  if (n < Index)                   /* got higher norm value */
+  {
+    HighVal = DATA_read_word(Table + (n * Step));
+    #ifdef FUNC_EIA96
+    HighIndex = n;                 /* save index number */
+    #endif
+  }
+  else                             /* table index overflow */
   {
     /* higher norm value is 1000 (100 and multiplier + 1) */
     HighVal = 1000;
@@ -850,6 +1100,10 @@ void CheckProbes(uint8_t Probe1, uint8_t Probe2, uint8_t Probe3)
   uint8_t           Flag;          /* temporary value */
   uint16_t          U_Rl;          /* voltage across Rl (load) */
   uint16_t          U_1;           /* voltage #1 */
+  Perm_Type         Perm;          /* measurements for checks */
+  #ifdef PROBE_PRESCREEN
+  uint16_t          U_2;           /* voltage #2 */
+  #endif
 
   /* init */
   if (Check.Found == COMP_ERROR) return;   /* skip check on any error */
@@ -901,6 +1155,9 @@ void CheckProbes(uint8_t Probe1, uint8_t Probe2, uint8_t Probe3)
     U_Rl = U_1;                         /* use U_1 instead */
   }
 
+  Perm.U_G_Low = U_Rl;                  /* save for later checks */
+  Perm.U_G_High = 0;                    /* not measured yet */
+
 
   /*
    *  If we got conduction we could have a p-channel FET. For any
@@ -916,6 +1173,7 @@ void CheckProbes(uint8_t Probe1, uint8_t Probe2, uint8_t Probe3)
 
     PullProbe(Probes.Rl_3, PULL_10MS | PULL_UP);  /* discharge gate via Rl */
     U_Rl = ReadU_5ms(Probes.Ch_2);                /* get voltage at Rl */
+    Perm.U_G_High = U_Rl;                         /* save for later checks */
 
 
     /*
@@ -954,7 +1212,8 @@ void CheckProbes(uint8_t Probe1, uint8_t Probe2, uint8_t Probe3)
   {
     if (Check.Done == DONE_NONE)        /* not sure yet */
     {
-      CheckDepletionModeFET(U_Rl);
+      Perm.U_Rl = U_Rl;
+      CheckDepletionModeFET(&Perm);
     }
   }
 
@@ -989,7 +1248,7 @@ void CheckProbes(uint8_t Probe1, uint8_t Probe2, uint8_t Probe3)
       R_PORT = 0;                         /* pull down collector via Rl */
       ADC_DDR = Probes.Pin_1;             /* set probe-1 to output */
       ADC_PORT = Probes.Pin_1;            /* pull up emitter directly */
-      wait5ms();
+      settle5ms();
       R_DDR = Probes.Rl_2 | Probes.Rl_3;  /* pull down base via Rl */
       U_1 = ReadU_5ms(Probes.Ch_2);       /* get voltage at collector */
 
@@ -1036,8 +1295,30 @@ void CheckProbes(uint8_t Probe1, uint8_t Probe2, uint8_t Probe3)
 
       if (U_1 < 1600)                   /* detected current > 4.8mA */
       {
+        #ifdef PROBE_PRESCREEN
+        /*
+         *  Pre-screen for Thyristor and TRIAC:
+         *  - The on-state voltage includes a junction drop, i.e. a
+         *    saturated BJT or a MOSFET (U_1 < 250mV) can't be one.
+         *  - The gate is a junction too. An insulated gate (MOSFET, IGBT)
+         *    draws no current via Rl and stays close to Vcc.
+         */
+
+        Flag = 0;                       /* no Thyristor or TRIAC */
+        if (U_1 > 250)                  /* could be a junction */
+        {
+          U_2 = ReadU(Probes.Ch_3);     /* get voltage at gate */
+
+          if (U_2 < 2500)               /* gate current flows */
+          {
+            /* first check for Thyristor and TRIAC */
+            Flag = CheckThyristorTriac();
+          }
+        }
+        #else
         /* first check for Thyristor and TRIAC */
         Flag = CheckThyristorTriac();
+        #endif
 
         if (Flag == 0)                 /* no Thyristor or TRIAC */
         {
@@ -1058,7 +1339,18 @@ void CheckProbes(uint8_t Probe1, uint8_t Probe2, uint8_t Probe3)
 
     if (Check.Done == DONE_NONE)        /* not sure yet */
     {
-      CheckUJT();
+      #ifdef PROBE_PRESCREEN
+      /*
+       *  Pre-screen for UJT: R_BB (3k - 15k) between probe-1 and probe-2
+       *  causes a U_Rl of at least Vcc/23. CheckUJT() would reject
+       *  anything above 15k anyway after measuring the resistance.
+       */
+
+      if (U_Rl > (Cfg.Vcc / 32))        /* R < about 21k */
+      #endif
+      {
+        CheckUJT();
+      }
     }
     #endif
   }
@@ -1078,7 +1370,27 @@ void CheckProbes(uint8_t Probe1, uint8_t Probe2, uint8_t Probe3)
 
     if (Check.Done == DONE_NONE)        /* not sure yet */
     {
-      CheckPUT();
+      #ifdef PROBE_PRESCREEN
+      /*
+       *  Pre-screen for PUT: The gate of a conducting PUT is tied to the
+       *  anode by a junction and stays high when pulled down via Rh.
+       *  An open probe-3 (any two-pin part) drops to Gnd.
+       */
+
+      /* set probes: Gnd -- Rl -- probe-2 / probe-1 -- Vcc / probe-3 -- Rh -- Gnd */
+      ADC_DDR = Probes.Pin_1;               /* set probe-1 to output */
+      ADC_PORT = Probes.Pin_1;              /* pull up probe-1 directly */
+      R_PORT = 0;                           /* set resistor port to Gnd */
+      R_DDR = Probes.Rl_2 | Probes.Rh_3;    /* pull down probe-3 via Rh */
+      U_1 = ReadU_5ms(Probes.Ch_3);         /* get voltage at gate */
+      /* set probes: Gnd -- Rl -- probe-2 / probe-1 -- Vcc */
+      R_DDR = Probes.Rl_2;                  /* pull down probe-2 via Rl */
+
+      if (U_1 > 1000)                       /* gate might be connected */
+      #endif
+      {
+        CheckPUT();
+      }
     }
 
     /*
@@ -1129,6 +1441,234 @@ void CheckProbes(uint8_t Probe1, uint8_t Probe2, uint8_t Probe3)
 
 
 
+#if defined (PROBE_EARLY_EXIT) || defined (PROBE_FINGERPRINT)
+
+/*
+ *  check if third probe is isolated
+ *  - no DC path to the other two probes
+ *  - third probe is pulled up and down via Rh
+ *
+ *  requires:
+ *  - Probe1: ID of first probe (0-2)
+ *  - Probe2: ID of second probe (0-2)
+ *
+ *  returns:
+ *  - 1 if isolated
+ *  - 0 if not
+ */
+
+uint8_t IsolatedProbe(uint8_t Probe1, uint8_t Probe2)
+{
+  uint8_t           Flag = 0;      /* return value */
+  uint16_t          U_1;           /* voltage #1 */
+  uint16_t          U_2;           /* voltage #2 */
+
+  UpdateProbes2(Probe1, Probe2);        /* update probes */
+
+  /* set probes: Gnd -- probe-1 and probe-2 / probe-3 -- Rh -- Vcc */
+  ADC_PORT = 0;                         /* pull down directly */
+  ADC_DDR = Probes.Pin_1 | Probes.Pin_2;
+  R_PORT = Probes.Rh_3;                 /* pull up probe-3 via Rh */
+  R_DDR = Probes.Rh_3;                  /* enable resistor */
+  U_1 = ReadU_5ms(Probes.Ch_3);         /* get voltage at probe-3 */
+
+  /* set probes: Vcc -- probe-1 and probe-2 / probe-3 -- Rh -- Gnd */
+  ADC_PORT = Probes.Pin_1 | Probes.Pin_2;    /* pull up directly */
+  R_PORT = 0;                           /* pull down probe-3 via Rh */
+  U_2 = ReadU_5ms(Probes.Ch_3);         /* get voltage at probe-3 */
+
+  /* no current through Rh: < 50mV across Rh (I < 0.1A) */
+  if ((U_1 > (Cfg.Vcc - 50)) && (U_2 < 50))
+  {
+    Flag = 1;                           /* isolated */
+  }
+
+  /* clean up */
+  ADC_DDR = 0;           /* set ADC port to HiZ mode */
+  ADC_PORT = 0;          /* set ADC port low */
+  R_DDR = 0;             /* set resistor port to HiZ mode */
+  R_PORT = 0;            /* set resistor port low */
+
+  return Flag;
+}
+
+#endif
+
+
+
+#ifdef PROBE_EARLY_EXIT
+
+/*
+ *  check if probing can be finished early
+ *  - single resistor confirmed by measurements in both directions
+ *  - remaining probe without any DC path to the resistor's probes
+ *
+ *  requires:
+ *  - Probe: ID of probe not checked yet
+ *
+ *  returns:
+ *  - 1 if done
+ *  - 0 if not
+ */
+
+uint8_t CheckEarlyExit(uint8_t Probe)
+{
+  uint8_t           Flag = 0;      /* return value */
+
+  /* we need a single resistor which was confirmed */
+  if (Check.Found != COMP_RESISTOR) return Flag;
+  if (Check.Resistors != 1) return Flag;
+
+  /* resistor must not be connected to the remaining probe */
+  if ((Resistors[0].A == Probe) || (Resistors[0].B == Probe)) return Flag;
+
+  Flag = IsolatedProbe(Resistors[0].A, Resistors[0].B);
+
+  return Flag;
+}
+
+#endif
+
+
+
+#ifdef PROBE_FINGERPRINT
+
+/*
+ *  save fingerprint of probing result
+ *  - supports a single resistor or capacitor
+ *
+ *  requires:
+ *  - Print: pointer to fingerprint
+ */
+
+void SaveFingerprint(Fingerprint_Type *Print)
+{
+  Capacitor_Type    *MaxCap;       /* pointer to largest cap */
+  uint8_t           n;             /* counter */
+
+  Print->Found = COMP_NONE;        /* reset fingerprint */
+
+  if ((Check.Found == COMP_RESISTOR) && (Check.Resistors == 1))
+  {
+    /* single resistor */
+    Print->Found = COMP_RESISTOR;
+    Print->A = Resistors[0].A;
+    Print->B = Resistors[0].B;
+    Print->Scale = Resistors[0].Scale;
+    Print->Value = Resistors[0].Value;
+  }
+  else if (Check.Found == COMP_CAPACITOR)
+  {
+    /* find largest cap (same as Show_Capacitor()) */
+    MaxCap = &Caps[0];
+    for (n = 1; n <= 2; n++)
+    {
+      if (CmpValue(Caps[n].Value, Caps[n].Scale, MaxCap->Value, MaxCap->Scale) == 1)
+      {
+        MaxCap = &Caps[n];
+      }
+    }
+
+    Print->Found = COMP_CAPACITOR;
+    Print->A = MaxCap->A;
+    Print->B = MaxCap->B;
+    Print->Scale = MaxCap->Scale;
+    Print->Value = MaxCap->Value;
+  }
+}
+
+
+
+/*
+ *  quick re-probing based on the fingerprint of the last component
+ *  - measures the component via the known probe pins only
+ *  - verification: value within 10% of the last one and third probe
+ *    isolated
+ *  - resets check results when fingerprint doesn't match
+ *
+ *  requires:
+ *  - Print: pointer to fingerprint
+ *
+ *  returns:
+ *  - 1 if component matches
+ *  - 0 if not (run full probing cycle)
+ */
+
+uint8_t QuickReprobe(Fingerprint_Type *Print)
+{
+  uint8_t           Flag = 0;      /* return value */
+  uint8_t           n;             /* counter */
+  int8_t            Scale = 0;     /* scale of new value */
+  uint32_t          Value = 0;     /* new value */
+  uint32_t          Temp;          /* tolerance */
+
+  if (Print->Found == COMP_RESISTOR)         /* resistor */
+  {
+    /* measure in both directions, same order as CheckProbes() */
+    UpdateProbes2(Print->B, Print->A);
+    CheckResistor();
+    UpdateProbes2(Print->A, Print->B);
+    CheckResistor();
+
+    /* confirmed single resistor */
+    if ((Check.Found == COMP_RESISTOR) && (Check.Resistors == 1))
+    {
+      Value = Resistors[0].Value;
+      Scale = Resistors[0].Scale;
+      Flag = 1;
+    }
+  }
+  else if (Print->Found == COMP_CAPACITOR)   /* capacitor */
+  {
+    /* reset data of other caps */
+    n = 1;
+    while (n <= 2)
+    {
+      Caps[n].Scale = -12;
+      Caps[n].Value = 0;
+      n++;
+    }
+
+    /* measure cap: probe B pulled up, probe A pulled down */
+    MeasureCap(Print->B, Print->A, 0);
+
+    if (Check.Found == COMP_CAPACITOR)
+    {
+      Value = Caps[0].Value;
+      Scale = Caps[0].Scale;
+      Flag = 1;
+    }
+  }
+
+  if (Flag)                        /* got component */
+  {
+    Flag = 0;                      /* reset flag */
+
+    /* check if last value is within 10% of new value */
+    Temp = Value / 10;
+    if ((CmpValue(Print->Value, Print->Scale, Value - Temp, Scale) >= 0) &&
+        (CmpValue(Print->Value, Print->Scale, Value + Temp, Scale) <= 0))
+    {
+      /* and nothing is connected to third probe */
+      Flag = IsolatedProbe(Print->A, Print->B);
+    }
+  }
+
+  if (Flag == 0)                   /* no match */
+  {
+    /* reset check results */
+    Check.Found = COMP_NONE;
+    Check.Resistors = 0;
+    Print->Found = COMP_NONE;      /* reset fingerprint */
+  }
+
+  return Flag;
+}
+
+#endif
+
+
+
 /*
  *  logic for alternative components which might be found
  */
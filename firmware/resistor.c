@@ -66,18 +66,21 @@ uint16_t SmallResistor(uint8_t ZeroFlag)
    *  - measure voltage at high side of DUT for 100 times 
    *  - repeat that for the low side of the DUT
    *  - use ADC directly
+   *  - the sum of the samples is kept (0.01mV), which is oversampling
+   *    already, so ReadU_HiRes() wouldn't increase the resolution
+   *  - current reversal (R_REVERSAL): measure both directions with 25
+   *    samples each and take the mean to cancel offsets
    */
 
-  /* set probes: GND -- probe 2 / probe 1 -- Rl -- 5V */
-  ADC_PORT = 0;                         /* set ADC port to low */
-  ADC_DDR = Probes.Pin_2;               /* pull-down probe 2 directly */
-  R_PORT = Probes.Rl_1;                 /* pull-up probe 1 via Rl */
-  R_DDR = Probes.Rl_1;                  /* enable Rl for probe 1 */
-  wait10ms();                           /* settle time */
-  /* todo: check if we have to increase the delay for large inductances */
-
 #define MODE_HIGH        0b00000001
 #define MODE_LOW         0b00000010
+#define MODE_REVERSED    0b00000100
+
+#ifdef R_REVERSAL
+  #define R_SAMPLES      25        /* samples per direction */
+#else
+  #define R_SAMPLES      100       /* samples */
+#endif
 
 
   /*
@@ -91,6 +94,14 @@ uint16_t SmallResistor(uint8_t ZeroFlag)
     /* set up measurement */
     if (Mode & MODE_HIGH)     /* high side mode */
     {
+      /* set probes: GND -- probe 2 / probe 1 -- Rl -- 5V */
+      ADC_PORT = 0;                     /* set ADC port to low */
+      ADC_DDR = Probes.Pin_2;           /* pull-down probe 2 directly */
+      R_PORT = Probes.Rl_1;             /* pull-up probe 1 via Rl */
+      R_DDR = Probes.Rl_1;              /* enable Rl for probe 1 */
+      settle10ms();                     /* settle time */
+      /* todo: check if we have to increase the delay for large inductances */
+
       Probe = Probes.Ch_1;    /* measure at probe 1 */
     }
     else                      /* low side mode */
@@ -100,55 +111,92 @@ uint16_t SmallResistor(uint8_t ZeroFlag)
 
     wdt_reset();              /* reset watchdog */
     Counter = 0;              /* reset loop counter */
-    Value = 0;                /* reset sample value */
-
-    /* set ADC to use bandgap reference and run a dummy conversion */
-    Probe |= ADC_REF_BANDGAP;
-    ADMUX = Probe;                   /* set input channel and U reference */
-    #ifndef ADC_LARGE_BUFFER_CAP
-      /* buffer cap: 1nF or none at all */
-      wait100us();                   /* time for voltage stabilization */
-    #else
-      /* buffer cap: 100nF */
-      wait10ms();                    /* time for voltage stabilization */
-    #endif
-    ADCSRA |= (1 << ADSC);           /* start conversion */
-    while (ADCSRA & (1 << ADSC));    /* wait until conversion is done */
-
 
+    #ifdef ADS1115_R_SMALL
     /*
-     *  measurement loop (about 0.5ms per cycle)
+     *  external ADC: voltage in 0.01mV, which matches the sum of
+     *  100 samples in mV below
      */
 
-    while (Counter < 100)
+    Value = ReadU_Ext(Probe, ADS1115_SAMPLES);
+    if (Value == ADC_EXT_ERROR)      /* failed */
+    #endif
     {
-      /* get ADC reading (about 100s) */
-      ADCSRA |= (1 << ADSC);            /* start conversion */
-      while (ADCSRA & (1 << ADSC));     /* wait until conversion is done */
-      Value += ADCW;                    /* add ADC reading */
+      Value = 0;                     /* reset sample value */
+
+      /* set ADC to use bandgap reference and run a dummy conversion */
+      Probe |= ADC_REF_BANDGAP;
+      ADMUX = Probe;                   /* set input channel and U reference */
+      #ifndef ADC_LARGE_BUFFER_CAP
+        /* buffer cap: 1nF or none at all */
+        wait100us();                   /* time for voltage stabilization */
+      #else
+        /* buffer cap: 100nF */
+        settle10ms();                  /* time for voltage stabilization */
+      #endif
+      ADCSRA |= (1 << ADSC);           /* start conversion */
+      while (ADCSRA & (1 << ADSC));    /* wait until conversion is done */
 
-      wait400us();                      /* wait */
 
-      Counter++;                        /* next round */
-    }
+      /*
+       *  measurement loop (about 0.5ms per cycle)
+       */
+
+      while (Counter < R_SAMPLES)
+      {
+        /* get ADC reading (about 100s) */
+        ADCSRA |= (1 << ADSC);            /* start conversion */
+        while (ADCSRA & (1 << ADSC));     /* wait until conversion is done */
+        Value += ADCW;                    /* add ADC reading */
 
-    /* convert ADC reading into voltage (sum of samples) */
-    Value *= Cfg.Bandgap;          /* * U_bandgap */
-    Value /= 1024;                 /* / 1024 for 10bit ADC */
+        wait400us();                      /* wait */
+
+        Counter++;                        /* next round */
+      }
+
+      /* convert ADC reading into voltage (sum of samples) */
+      Value *= Cfg.Bandgap;          /* * U_bandgap */
+      #if R_SAMPLES < 100
+      Value *= (100 / R_SAMPLES);    /* scale to sum of 100 samples */
+      #endif
+      Value /= 1024;                 /* / 1024 for 10bit ADC */
+    }
 
     /* loop control */
     if (Mode & MODE_HIGH)          /* probe #1 / Rl */
     {
-      Mode = MODE_LOW;             /* switch to low side */
-      Value1 = Value;              /* save measured value */
+      Mode &= MODE_REVERSED;       /* keep direction */
+      Mode |= MODE_LOW;            /* switch to low side */
+      Value1 += Value;             /* add measured value */
     }
     else                           /* probe #2 / R_i_L */
     {
-      Mode = 0;                    /* end loop */
-      Value2 = Value;              /* save measured value */
+      Value2 += Value;             /* add measured value */
+
+      #ifdef R_REVERSAL
+      if (! (Mode & MODE_REVERSED))     /* first direction */
+      {
+        /* reverse current: swap probe #1 and #2 */
+        UpdateProbes2(Probes.ID_2, Probes.ID_1);
+        Mode = MODE_REVERSED | MODE_HIGH;    /* high side again */
+      }
+      else                              /* both directions done */
+      #endif
+      {
+        Mode = 0;                  /* end loop */
+      }
     }
   }
 
+  #ifdef R_REVERSAL
+  /* restore probes */
+  UpdateProbes2(Probes.ID_2, Probes.ID_1);
+
+  /* mean of both directions (offsets cancel out) */
+  Value1 /= 2;
+  Value2 /= 2;
+  #endif
+
   /* stop current */
   R_PORT = 0;
   ADC_DDR = Probes.Pin_2 | Probes.Pin_1;
@@ -198,6 +246,8 @@ uint16_t SmallResistor(uint8_t ZeroFlag)
     }
   }
 
+#undef R_SAMPLES
+#undef MODE_REVERSED
 #undef MODE_LOW
 #undef MODE_HIGH
 
@@ -231,6 +281,7 @@ void CheckResistor(void)
   uint16_t          U_Ri_L;        /* voltage at Ri pulled down */
   uint16_t          U_Rh_H;        /* voltage at Rh pulled up */
   uint16_t          U_Rh_L;        /* voltage ar Rh pulled down */
+  uint16_t          U[3];          /* probe voltages */
 
   wdt_reset();                     /* reset watchdog */
 
@@ -273,8 +324,10 @@ void CheckResistor(void)
   ADC_DDR = Probes.Pin_2;               /* pull down probe-2 directly */
   R_DDR = Probes.Rl_1;                  /* enable Rl for probe-1 */
   R_PORT = Probes.Rl_1;                 /* pull up probe-1 via Rl */
-  U_Ri_L = ReadU_5ms(Probes.Ch_2);      /* get voltage at internal R of MCU */
-  U_Rl_H = ReadU(Probes.Ch_1);          /* get voltage at Rl pulled up */
+  settle5ms();                          /* settle time */
+  ReadU_Multi(READ_CH_1 | READ_CH_2, U);     /* get probe voltages */
+  U_Ri_L = U[1];                        /* voltage at internal R of MCU */
+  U_Rl_H = U[0];                        /* voltage at Rl pulled up */
 
 
   /*
@@ -298,6 +351,54 @@ void CheckResistor(void)
     U_Rh_H = ReadU_5ms(Probes.Ch_1);         /* get voltage at Rh pulled up */
 
 
+    /*
+     *  reverse direction of a high value resistor found already
+     *  - the forward measurement (done with Rh) is conclusive, so we
+     *    just have to check if the measurement with Rh pulled up
+     *    matches within 5%
+     *  - saves the measurements with Rl and Rh pulled down
+     */
+
+    if ((U_Rl_H >= 4400) && (U_Rh_H < 4972))     /* R >= 5.1k and R < 83.4M */
+    {
+      n = 0;
+      while (n < Check.Resistors)           /* loop through resistors */
+      {
+        Resistor = &Resistors[n];           /* pointer to element */
+
+        if ((Resistor->A == Probes.ID_1) && (Resistor->B == Probes.ID_2))
+        {
+          /* forward measurement done with Rh (>= 20k) */
+          if (CmpValue(Resistor->Value, Resistor->Scale, 20, 3) >= 0)
+          {
+            /* R = Rh * U_Rh_H / (Vcc - U_Rh_H), see below */
+            Value = R_HIGH * U_Rh_H;
+            Value /= (Cfg.Vcc - U_Rh_H);
+            Value += RH_OFFSET;             /* add offset value for Rh */
+            Value *= 10;                    /* upscale to 0.1 Ohms */
+
+            Temp = Value / 20;              /* 5% */
+            Value1 = Value - Temp;          /* 95% */
+            Value2 = Value + Temp;          /* 105% */
+
+            if ((CmpValue(Resistor->Value, Resistor->Scale, Value1, -1) >= 0) &&
+                (CmpValue(Resistor->Value, Resistor->Scale, Value2, -1) <= 0))
+            {
+              Check.Found = COMP_RESISTOR;  /* keep forward measurement */
+              return;
+            }
+          }
+
+          n = Check.Resistors;              /* end loop */
+        }
+        else                                /* no match */
+        {
+          n++;                              /* next one */
+        }
+      }
+    }
+
+
     /*
      *  get voltage for Rl pulled down and Rh pulled down
      */
@@ -307,12 +408,10 @@ void CheckResistor(void)
     ADC_PORT = Probes.Pin_1;                 /* pull up probe-1 directly */
     R_PORT = 0;                              /* set resistor port to low */ 
     R_DDR = Probes.Rl_2;                     /* pull down probe-2 via Rl */
-    U_Ri_H = ReadU_5ms(Probes.Ch_1);         /* get voltage at internal R of MCU */
-    U_Rl_L = ReadU(Probes.Ch_2);             /* get voltage at Rl pulled down */
-
-    /* set probes: Gnd -- Rh -- probe-2 / probe-1 -- Vcc */
-    R_DDR = Probes.Rh_2;                /* pull down probe-2 via Rh */
-    U_Rh_L = ReadU_5ms(Probes.Ch_2);    /* get voltage at Rh pulled down */
+    settle5ms();                             /* settle time */
+    ReadU_Multi(READ_CH_1 | READ_CH_2, U);   /* get probe voltages */
+    U_Ri_H = U[0];                           /* voltage at internal R of MCU */
+    U_Rl_L = U[1];                           /* voltage at Rl pulled down */
 
     /* check voltage breakdown to filter out other components */
     if ((U_Rl_H >= 4400) || (U_Rh_H <= 97))   /* R >= 5.1k or R < 9.3k */
@@ -330,6 +429,11 @@ void CheckResistor(void)
            *  use measurements done with Rh
            */
 
+          /* set probes: Gnd -- Rh -- probe-2 / probe-1 -- Vcc */
+          /* (just required for high resistances) */
+          R_DDR = Probes.Rh_2;                /* pull down probe-2 via Rh */
+          U_Rh_L = ReadU_5ms(Probes.Ch_2);    /* get voltage at Rh pulled down */
+
           /* resistor is less than 60MOhm */
           if (U_Rh_L >= 38)        /* R < 61.4M & prevent division by zero */
           {
@@ -37,6 +37,8 @@
  *  manage pin designators for semiconductors
  *  - results in smaller firmware than setting the designators in
  *    each semiconductor check function
+ *  - designators are taken from SemiPin_table
+ *  - no semiconductor: all designators are 0
  */
 
 void SemiPinDesignators(void)
@@ -44,59 +46,36 @@ void SemiPinDesignators(void)
   uint8_t           A = 0;         /* designator for pin A */
   uint8_t           B = 0;         /* designator for pin B */
   uint8_t           C = 0;         /* designator for pin C */
+  uint8_t           ID;            /* component ID */
+  uint8_t           *Addr;         /* address of table entry */
 
   /*
-   *  set pin designators based on semiconductor type
+   *  look up pin designators based on semiconductor type
    */
 
-  switch (Check.Found)
-  {
-    case COMP_BJT:            /* BJT */
-      A = 'B';                /* base */
-      B = 'C';                /* collector */
-      C = 'E';                /* emitter */
-      break;
-
-    case COMP_FET:            /* FET */
-      A = 'G';                /* gate */
-      if (Check.Type & TYPE_SYMMETRICAL)     /* symmetrical */
-      {
-        B = 'x';              /* drain */
-        C = 'x';              /* source */
-      }
-      else                                   /* normal */
-      {
-        B = 'D';              /* drain */
-        C = 'S';              /* source */
-      }
-      break;
+  Addr = (uint8_t *)&SemiPin_table;     /* start of table */
 
-    case COMP_IGBT:           /* IGBT */
-      A = 'G';                /* gate */
-      B = 'C';                /* collector */
-      C = 'E';                /* emitter */
-      break;
+  while (1)
+  {
+    ID = DATA_read_byte(Addr);          /* read component ID */
+    if (ID == COMP_NONE) break;         /* end of table */
 
-    case COMP_THYRISTOR:      /* Thyristor / SCR */
-    case COMP_PUT:            /* PUT */
-      A = 'G';                /* gate */
-      B = 'A';                /* anode */
-      C = 'C';                /* cathode */
+    if (ID == Check.Found)              /* match */
+    {
+      A = DATA_read_byte(Addr + 1);     /* designator for pin A */
+      B = DATA_read_byte(Addr + 2);     /* designator for pin B */
+      C = DATA_read_byte(Addr + 3);     /* designator for pin C */
       break;
+    }
 
-    case COMP_TRIAC:          /* TRIAC */
-      A = 'G';                /* gate */
-      B = '2';                /* MT2 */
-      C = '1';                /* MT1 */
-      break;
+    Addr += 4;                          /* next entry */
+  }
 
-    #ifdef SW_UJT
-    case COMP_UJT:            /* UJT */
-      A = 'E';                /* emitter */
-      B = '2';                /* B2 */
-      C = '1';                /* B1 */
-      break;
-    #endif
+  /* FET with symmetrical drain and source */
+  if ((Check.Found == COMP_FET) && (Check.Type & TYPE_SYMMETRICAL))
+  {
+    B = 'x';                  /* drain */
+    C = 'x';                  /* source */
   }
 
   /* update pin designators */
@@ -111,14 +90,18 @@ void SemiPinDesignators(void)
  *  measure leakage current
  *  - current through a semiconducter in non-conducting mode
  *  - result is stored in Semi.I_value & I.scale
+ *  - a range hint (voltage across Rl from an earlier check with the same
+ *    setup) selects the shunt right away and shortens settling for Rl
  *
  *  requires:
  *  - mode:
  *    0 = normal
  *    1 = high current
+ *  - U_Hint: voltage across Rl from earlier check (in mV)
+ *    LEAK_NO_HINT if unknown
  */
 
-void GetLeakageCurrent(uint8_t Mode)
+void GetLeakageCurrent(uint8_t Mode, uint16_t U_Hint)
 {
   int8_t                 Scale;         /* exponent of factor (value * 10^x) */
   uint32_t               Value;         /* current */
@@ -140,7 +123,26 @@ void GetLeakageCurrent(uint8_t Mode)
   R_DDR = Probes.Rl_2;             /* pull down probe-2 via Rl */
   ADC_DDR = Probes.Pin_1;          /* set probe-1 to output */
   ADC_PORT = Probes.Pin_1;         /* pull-up probe-1 directly */
-  U_Rl = ReadU_5ms(Probes.Ch_2);   /* get voltage at Rl */
+
+  if (U_Hint == LEAK_NO_HINT)      /* unknown range */
+  {
+    U_Rl = ReadU_5ms(Probes.Ch_2);      /* get voltage at Rl */
+  }
+  else if (U_Hint > 3)             /* expected: > 5A */
+  {
+    /* Rl settles fast, no need to wait 5ms */
+    #ifdef ADC_SETTLE
+      U_Rl = ReadU_Settled(Probes.Ch_2, 1);
+    #else
+      wait1ms();
+      U_Rl = ReadU(Probes.Ch_2);        /* get voltage at Rl */
+    #endif
+  }
+  else                             /* expected: < 5A */
+  {
+    /* skip Rl and go for Rh directly */
+    U_Rl = 0;
+  }
 
   if (U_Rl > 3)          /* > 5A */
   {
@@ -180,16 +182,38 @@ void GetLeakageCurrent(uint8_t Mode)
     /*
      *  For low currents we take a second measurement using Rh:
      *  - with 1mV ADC resolution we get down to 2nA
+     *  - with oversampling (0.1mV) the result has a resolution of 1nA
      *  - max. current is 5V/470kOhms = 10A
      *  - set probes: Gnd -- Rh -- probe-2 / probe-1 -- Vcc
      */
 
     R_DDR = Probes.Rh_2;                /* pull down probe-2 via Rh */
-    U_Rl = ReadU_5ms(Probes.Ch_2);      /* get voltage at Rh */
 
     /* neglect MCU's internal resistance */
     R_Shunt =  R_HIGH;
+
+    #ifdef ADC_OVERSAMPLING
+    settle5ms();                        /* settle time */
+    /* get voltage at Rh (in 0.1mV) */
+    U_Rl = ReadU_HiRes(Probes.Ch_2, ADC_OVERSAMPLING);
+    Scale = -9;                    /* 1n (0.1mV * 10^5 / Ohms) */
+    #else
+    U_Rl = ReadU_5ms(Probes.Ch_2);      /* get voltage at Rh */
     Scale = -8;                    /* 10n */
+    #endif
+
+    #ifdef ADC_OVERSAMPLING
+    if ((U_Hint <= 3) && (U_Rl > 40000))     /* wrong range hint (> 8.5A) */
+    #else
+    if ((U_Hint <= 3) && (U_Rl > 4000)) /* wrong range hint (> 8.5A) */
+    #endif
+    {
+      /* measure via Rl after all */
+      R_DDR = Probes.Rl_2;              /* pull down probe-2 via Rl */
+      U_Rl = ReadU_5ms(Probes.Ch_2);    /* get voltage at Rl */
+      R_Shunt = (uint32_t)NV.RiL + (R_LOW * 10);     /* in 0.1 Ohms */
+      Scale = -7;                       /* 100n */
+    }
   }
 
   /* clean up */
@@ -198,8 +222,12 @@ void GetLeakageCurrent(uint8_t Mode)
   R_DDR = 0;             /* set resistor port to HiZ mode */
   R_PORT = 0;            /* set resistor port low */
 
-  /* calculate current */
-  Value = U_Rl * 100000;           /* scale voltage to 10nV */
+  /*
+   *  calculate current
+   *  - U_Rl < 4.3V (0.1mV) for Rh, otherwise it would overflow
+   */
+
+  Value = U_Rl * 100000;           /* scale voltage to 10nV (1nV for 0.1mV) */
   Value /= R_Shunt;                /* I = U/R */
 
   /* save result */
@@ -269,6 +297,7 @@ void CheckDiode(void)
   uint16_t          U2_Rh;         /* Vf #2 with Rh pull-down */
   uint16_t          U2_Zero;       /* Vf #2 zero */
   uint16_t          U_Diff;        /* Vf difference */
+  uint16_t          U[3];          /* probe voltages */
 
   wdt_reset();                          /* reset watchdog */
 
@@ -333,8 +362,9 @@ void CheckDiode(void)
   R_DDR = Probes.Rl_1;                  /* enable Rl for probe-1 */
   R_PORT = Probes.Rl_1;                 /* pull up anode via Rl */
   PullProbe(Probes.Rl_3, PULL_10MS | PULL_UP);     /* discharge gate */
-  U1_Rl = ReadU_5ms(Probes.Ch_1);       /* get voltage at anode */
-  U1_Rl -= ReadU(Probes.Ch_2);          /* substract voltage at cathode */
+  settle5ms();                          /* settle time */
+  ReadU_Multi(READ_CH_1 | READ_CH_2, U);     /* get voltages at anode and cathode */
+  U1_Rl = U[0] - U[1];                  /* anode - cathode */
 
 
   DischargeProbes();                    /* try to discharge probes */
@@ -373,8 +403,9 @@ void CheckDiode(void)
   /* set probes: Gnd -- Rl -- probe-2 / probe-1 -- Vcc */
   R_DDR = Probes.Rl_2;                  /* pull down cathode via Rl */
   PullProbe(Probes.Rl_3, PULL_10MS | PULL_DOWN);   /* discharge gate */
-  U2_Rl = ReadU_5ms(Probes.Ch_1);       /* get voltage at anode */
-  U2_Rl -= ReadU(Probes.Ch_2);          /* substract voltage at cathode */
+  settle5ms();                          /* settle time */
+  ReadU_Multi(READ_CH_1 | READ_CH_2, U);     /* get voltages at anode and cathode */
+  U2_Rl = U[0] - U[1];                  /* anode - cathode */
 
   ADC_DDR = 0;                     /* stop pulling up */
 
@@ -513,14 +544,20 @@ void CheckDiode(void)
 
 
 /*
- *  verify MOSFET by checking the body diode
+ *  search for a body diode with reversed polarity
+ *  - uses Semi.B (drain), Semi.C (source) and Check.Type
+ *  - doesn't change anything
+ *
+ *  returns:
+ *  - 1 when a reversed diode was found (can't be a MOSFET)
+ *  - 0 otherwise
  */
 
-void VerifyMOSFET(void)
+uint8_t ReversedBodyDiode(void)
 {
+  uint8_t           Flag = 0;           /* return value */
   uint8_t           Anode;
   uint8_t           Cathode;
-  Diode_Type        *Diode;             /* pointer to diode */
 
   /* set expected body diode */
   if (Check.Type & TYPE_N_CHANNEL)      /* n-channel */
@@ -535,8 +572,23 @@ void VerifyMOSFET(void)
   }
 
   /* search for a diode with reversed polarity */
-  Diode = SearchDiode(Cathode, Anode);  /* search for reversed diode */
-  if (Diode != NULL)                    /* got it */
+  if (SearchDiode(Cathode, Anode) != NULL)   /* got it */
+  {
+    Flag = 1;
+  }
+
+  return Flag;
+}
+
+
+
+/*
+ *  verify MOSFET by checking the body diode
+ */
+
+void VerifyMOSFET(void)
+{
+  if (ReversedBodyDiode())              /* reversed diode */
   {
     /* this can't be a MOSFET, so let's reset */
     Check.Found = COMP_NONE;
@@ -549,6 +601,9 @@ void VerifyMOSFET(void)
 
 /*
  *  measure the gate threshold voltage of a depletion-mode MOSFET
+ *  - successive approximation: charge gate via Rh to a target level,
+ *    hold it (HiZ) and check the drain, then halve the step
+ *  - V_th is the average of the final bracketing levels
  *
  *  requires:
  *  - Type: n-channel or p-channel
@@ -560,7 +615,27 @@ void GetGateThreshold(uint8_t Type)
   uint8_t           Drain_Rl;      /* Rl register bits for drain */
   uint8_t           Drain_ADC;     /* ADC port register bits for drain */
   uint8_t           PullMode;      /* pull-up/down mode */
+  uint8_t           Port;          /* original R_PORT */
+  uint8_t           Port_On;       /* R_PORT for charging gate */
+  uint8_t           Port_Off;      /* R_PORT for discharging gate */
+  uint8_t           Pulse;         /* charging pulse (in 10s) */
+  uint8_t           Dir;           /* charging direction */
+  uint8_t           Old_Dir;       /* previous charging direction */
   uint8_t           Counter;       /* loop counter */
+  uint8_t           n;             /* counter */
+  uint16_t          Level;         /* gate level (ADC, towards conduction) */
+  uint16_t          Target;        /* target gate level */
+  uint16_t          Step;          /* step size */
+  uint16_t          Level_On;      /* lowest level with FET conducting */
+  uint16_t          Level_Off;     /* highest level with FET blocking */
+
+  /* local constants for Dir */
+  #define DIR_NONE       0         /* level reached */
+  #define DIR_UP         1         /* charge gate */
+  #define DIR_DOWN       2         /* discharge gate */
+
+  /* max. deviation from target level (ADC steps) */
+  #define TOLERANCE      2
 
   /*
    *  init variables
@@ -587,12 +662,24 @@ void GetGateThreshold(uint8_t Type)
     PullMode = PULL_10MS | PULL_UP;
   }
 
+  /* gate: n-channel conducts when pulled up, p-channel when pulled down */
+  Port = R_PORT;                   /* save port */
+  Port_Off = Port & ~Probes.Rh_3;  /* gate bit cleared */
+  Port_On = Port | Probes.Rh_3;    /* gate bit set */
+  if (! (Type & TYPE_N_CHANNEL))   /* p-channel */
+  {
+    /* swap */
+    Pulse = Port_On;
+    Port_On = Port_Off;
+    Port_Off = Pulse;
+  }
+
 
   /*
    *  For low reaction times we use the ADC directly.
    */
 
-  /* sanitize register bits for drain to prevent a never-ending loop */ 
+  /* sanitize register bits for drain */ 
   Drain_ADC &= ((1 << TP1) | (1 << TP2) | (1 << TP3));
   ADMUX = Probes.Ch_3 | ADC_REF_VCC;    /* select probe-3 for ADC input */
                                         /* and use Vcc as reference */
@@ -601,60 +688,141 @@ void GetGateThreshold(uint8_t Type)
     wait100us();                   /* time for voltage stabilization */
   #else
     /* buffer cap: 100nF */
-    wait10ms();                    /* time for voltage stabilization */
+    settle10ms();                  /* time for voltage stabilization */
   #endif
 
-  /* sample 10 times */
-  for (Counter = 0; Counter < 10; Counter++) 
+  /* discharge gate via Rl for 10 ms */
+  PullProbe(Probes.Rl_3, PullMode);
+  R_DDR = Drain_Rl;                /* gate in HiZ mode */
+
+
+  /*
+   *  successive approximation
+   *  - start at Vcc/2 and halve step size down to TOLERANCE
+   */
+
+  Level_On = 1023;                 /* no conduction yet */
+  Level_Off = 0;                   /* no blocking yet */
+  Level = 0;                       /* gate is discharged */
+  Target = 512;                    /* Vcc/2 */
+  Step = 256;
+
+  while (Step >= TOLERANCE)
   {
-    wdt_reset();                         /* reset watchdog */
+    wdt_reset();                   /* reset watchdog */
 
-    /* discharge gate via Rl for 10 ms */
-    PullProbe(Probes.Rl_3, PullMode);
+    /*
+     *  charge gate to target level via Rh
+     *  - double pulse length while approaching target
+     *  - halve pulse length when overshooting target
+     */
 
-    /* pull up/down gate via Rh to slowly charge gate */
-    R_DDR = Drain_Rl | Probes.Rh_3;
+    Pulse = 1;                     /* 10s */
+    Old_Dir = DIR_NONE;
+    Counter = 0;
 
-    /* wait until FET conducts */
-    /* any problem will cause a watchdog timeout */
-    if (Type & TYPE_N_CHANNEL)          /* n-channel */
-    {
-      /* FET conducts when the voltage at the drain reaches low level */
-      while (ADC_PIN & Drain_ADC);
-    }
-    else                                /* p-channel */
+    while (Counter < 100)          /* limit number of pulses */
     {
-      /* FET conducts when the voltage at the drain reaches high level */
-      while (!(ADC_PIN & Drain_ADC));             
+      /* get direction */
+      if (Level + TOLERANCE < Target) Dir = DIR_UP;
+      else if (Level > Target + TOLERANCE) Dir = DIR_DOWN;
+      else break;                  /* target level reached */
+
+      if (Old_Dir != DIR_NONE)     /* not the first pulse */
+      {
+        if (Dir != Old_Dir)        /* overshoot */
+        {
+          if (Pulse == 1) break;   /* best we can do */
+          Pulse /= 2;              /* shorter pulse */
+        }
+        else if (Pulse < 128)      /* still approaching */
+        {
+          Pulse *= 2;              /* longer pulse */
+        }
+      }
+      Old_Dir = Dir;
+
+      /* charge/discharge gate via Rh */
+      if (Dir == DIR_UP) R_PORT = Port_On;
+      else R_PORT = Port_Off;
+      R_DDR = Drain_Rl | Probes.Rh_3;
+      n = Pulse;
+      while (n > 0)
+      {
+        wait10us();
+        n--;
+      }
+      R_DDR = Drain_Rl;            /* hold gate: HiZ */
+
+      /* get level of gate */
+      ADCSRA |= (1 << ADSC);            /* start ADC conversion */
+      while (ADCSRA & (1 << ADSC));     /* wait until conversion is done */
+      Level = ADCW;
+      if (! (Type & TYPE_N_CHANNEL))    /* p-channel */
+      {
+        Level = 1023 - Level;           /* level relative to Vcc */
+      }
+
+      Counter++;                   /* next pulse */
     }
 
-    R_DDR = Drain_Rl;                   /* set probe-3 to HiZ mode */
 
-    /* get voltage of gate */
-    ADCSRA |= (1 << ADSC);              /* start ADC conversion */
-    while (ADCSRA & (1 << ADSC));       /* wait until conversion is done */
+    /*
+     *  check drain and select next target level
+     */
 
-    /* add ADC reading */
-    if (Type & TYPE_N_CHANNEL)          /* n-channel */
+    if (Type & TYPE_N_CHANNEL)     /* n-channel */
     {
-      Ugs += ADCW;                        /* Ugs = U_g */
+      /* FET conducts when the voltage at the drain is at low level */
+      n = ! (ADC_PIN & Drain_ADC);
     }
-    else                                /* p-channel */
+    else                           /* p-channel */
     {
-      Ugs -= (1023 - ADCW);               /* Ugs = - (Vcc - U_g) */
+      /* FET conducts when the voltage at the drain is at high level */
+      n = (ADC_PIN & Drain_ADC);
     }
+
+    if (n)                         /* conducting */
+    {
+      if (Level < Level_On) Level_On = Level;
+      if (Target > Step) Target -= Step;
+      else Target = 0;
+    }
+    else                           /* blocking */
+    {
+      if (Level > Level_Off) Level_Off = Level;
+      Target += Step;
+    }
+
+    Step /= 2;                     /* next step */
   }
 
-  /* calculate V_th */
-  Ugs /= 10;                     /* average of 10 samples */
-  Ugs *= Cfg.Vcc;                /* convert to voltage */
-  Ugs /= 1024;                   /* using 10 bit resolution */
+
+  /* calculate V_th: average of final bracketing levels */
+  Ugs = Level_On;
+  Ugs += Level_Off;
+  Ugs /= 2;
+  if (! (Type & TYPE_N_CHANNEL))   /* p-channel */
+  {
+    Ugs = -Ugs;                    /* Ugs = - (Vcc - U_g) */
+  }
+  Ugs *= Cfg.Vcc;                  /* convert to voltage */
+  Ugs /= 1024;                     /* using 10 bit resolution */
 
   /* save data */
-  Semi.U_2 = (int16_t)Ugs;       /* gate threshold voltage (in mV) */
+  Semi.U_2 = (int16_t)Ugs;         /* gate threshold voltage (in mV) */
+
+  /* restore pull-up/down of gate */
+  R_PORT = Port;
 
   /* update reference source for next ADC run */
-  Cfg.Ref = ADC_REF_VCC;         /* we've used Vcc as reference */
+  Cfg.Ref = ADC_REF_VCC;           /* we've used Vcc as reference */
+
+  /* clean up */
+  #undef DIR_NONE
+  #undef DIR_UP
+  #undef DIR_DOWN
+  #undef TOLERANCE
 }
 
 
@@ -901,6 +1069,174 @@ uint32_t Get_hFE_C(uint8_t Type)
 
 
 
+#ifdef SW_HFE_SWEEP
+
+/*
+ *  measure hFE for all usable drive configurations
+ *  - common collector: R_e/R_b = Rh/Rh, Rl/Rh and Rl/Rl
+ *  - common emitter: R_c/R_b = Rl/Rh
+ *    (other combinations would drive the BJT into saturation, and Rh as
+ *     emitter resistor with Rl at the base leaves no measurable U_R_b)
+ *  - results are stored in hFE_Sweep[] sorted by current
+ *  - probes have to be set up already
+ *
+ *  requires:
+ *  - Type: NPN or PNP
+ */
+
+void Get_hFE_Sweep(uint8_t Type)
+{
+  uint8_t           n, m;          /* counters */
+  uint8_t           Setup;         /* drive configuration */
+  uint8_t           Up;            /* measurement resistor pulled up */
+  uint8_t           R_x;           /* measurement resistor (C or E) */
+  uint8_t           R_b;           /* base resistor */
+  uint8_t           Channel;       /* ADC channel of measurement resistor */
+  uint16_t          U_R_x;         /* voltage across measurement resistor */
+  uint16_t          U_R_b;         /* voltage across base resistor */
+  uint32_t          Res_x;         /* measurement resistor (in Ohms) */
+  uint32_t          Res_b;         /* base resistor (in Ohms) */
+  uint32_t          hFE;           /* hFE */
+  hFE_Type          Temp;          /* temporary table entry */
+
+  /* local constants for drive configuration (besides HFE_COMMON_*) */
+  #define SWEEP_X_RL     0b01000000     /* C/E resistor: Rl (default: Rh) */
+  #define SWEEP_B_RL     0b10000000     /* base resistor: Rl (default: Rh) */
+
+  /* drive configurations */
+  const uint8_t     Sweep_Setup[HFE_SWEEP_POINTS] =
+  {
+    HFE_COMMON_COLLECTOR,
+    HFE_COMMON_COLLECTOR | SWEEP_X_RL,
+    HFE_COMMON_EMITTER | SWEEP_X_RL,
+    HFE_COMMON_COLLECTOR | SWEEP_X_RL | SWEEP_B_RL
+  };
+
+
+  /*
+   *  We assume:
+   *  - NPN: probe-1 = C / probe-2 = E / probe-3 = B
+   *  - PNP: probe-1 = E / probe-2 = C / probe-3 = B
+   *  The measurement resistor is at probe-1 (pulled up to Vcc) for NPN in
+   *  common emitter and PNP in common collector circuit, otherwise at
+   *  probe-2 (pulled down to Gnd). The other pin is connected directly.
+   */
+
+  n = 0;
+  while (n < HFE_SWEEP_POINTS)
+  {
+    Setup = Sweep_Setup[n];
+
+    /* position of measurement resistor */
+    if (Type == TYPE_NPN) Up = Setup & HFE_COMMON_EMITTER;
+    else Up = Setup & HFE_COMMON_COLLECTOR;
+
+    /* set up probes */
+    if (Up)                        /* resistor at probe-1 */
+    {
+      if (Setup & SWEEP_X_RL) R_x = Probes.Rl_1;
+      else R_x = Probes.Rh_1;
+      Channel = Probes.Ch_1;
+      ADC_PORT = 0;                     /* pull down ... */
+      ADC_DDR = Probes.Pin_2;           /* ... probe-2 directly */
+    }
+    else                           /* resistor at probe-2 */
+    {
+      if (Setup & SWEEP_X_RL) R_x = Probes.Rl_2;
+      else R_x = Probes.Rh_2;
+      Channel = Probes.Ch_2;
+      ADC_DDR = Probes.Pin_1;           /* pull up ... */
+      ADC_PORT = Probes.Pin_1;          /* ... probe-1 directly */
+    }
+
+    if (Setup & SWEEP_B_RL) R_b = Probes.Rl_3;
+    else R_b = Probes.Rh_3;
+
+    R_DDR = R_x | R_b;                  /* enable resistors */
+    m = 0;                              /* pull down */
+    if (Up) m = R_x;                    /* pull up C/E resistor */
+    if (Type == TYPE_NPN) m |= R_b;     /* pull up base (NPN) */
+    R_PORT = m;
+
+    /* get voltages across resistors */
+    U_R_x = ReadU_5ms(Channel);
+    U_R_b = ReadU(Probes.Ch_3);
+    if (Up) U_R_x = Cfg.Vcc - U_R_x;         /* U_R_x = Vcc - U_x */
+    if (Type == TYPE_NPN) U_R_b = Cfg.Vcc - U_R_b;    /* U_R_b = Vcc - U_b */
+
+    /* resistor values (Rl plus internal resistance of pin) */
+    Res_x = R_HIGH;
+    if (Setup & SWEEP_X_RL)
+    {
+      if (Up) Res_x = R_LOW + (NV.RiH / 10);
+      else Res_x = R_LOW + (NV.RiL / 10);
+    }
+
+    Res_b = R_HIGH;
+    if (Setup & SWEEP_B_RL)
+    {
+      if (Type == TYPE_NPN) Res_b = R_LOW + (NV.RiH / 10);
+      else Res_b = R_LOW + (NV.RiL / 10);
+    }
+
+    /*
+     *  hFE = I_x / I_b
+     *      = (U_R_x * R_b) / (U_R_b * R_x)
+     *  - common collector: I_c = I_e - I_b -> hFE - 1
+     */
+
+    hFE = 0;
+
+    /* skip common emitter circuit in saturation (U_CE < 300mV) */
+    if ((Setup & HFE_COMMON_COLLECTOR) || (U_R_x < Cfg.Vcc - 300))
+    {
+      if (U_R_b == 0) U_R_b = 1;        /* prevent division by zero */
+      hFE = U_R_x * Res_b;              /* U_R_x * R_b */
+      hFE /= U_R_b;                     /* / U_R_b */
+      hFE /= Res_x;                     /* / R_x */
+      if ((Setup & HFE_COMMON_COLLECTOR) && (hFE > 0)) hFE--;
+    }
+
+    /* save result */
+    hFE_Sweep[n].Flags = Setup & HFE_CIRCUIT_MASK;
+    hFE_Sweep[n].hFE = hFE;
+    /* I = U_R_x / R_x (in nA, 10nA resolution) */
+    hFE_Sweep[n].I = (uint32_t)U_R_x * 100000 / Res_x * 10;
+    if (hFE == 0) hFE_Sweep[n].Flags = 0;    /* invalid */
+
+    n++;                           /* next configuration */
+  }
+
+  /* all probes to HiZ */
+  ADC_DDR = 0;
+  R_DDR = 0;
+  ADC_PORT = 0;
+  R_PORT = 0;
+
+  /* sort table by current (insertion sort) */
+  n = 1;
+  while (n < HFE_SWEEP_POINTS)
+  {
+    Temp = hFE_Sweep[n];
+    m = n;
+    while ((m > 0) && (hFE_Sweep[m - 1].I > Temp.I))
+    {
+      hFE_Sweep[m] = hFE_Sweep[m - 1];
+      m--;
+    }
+    hFE_Sweep[m] = Temp;
+    n++;
+  }
+
+  /* clean up */
+  #undef SWEEP_X_RL
+  #undef SWEEP_B_RL
+}
+
+#endif
+
+
+
 /*
  *  check for BJT, enhancement-mode MOSFET and IGBT
  *  - sets hFE test circuit type in Semi.Flags (when SW_HFE_CIRCUIT)
@@ -948,7 +1284,7 @@ void CheckTransistor(uint8_t BJT_Type, uint16_t U_Rl)
 
     R_DDR = Probes.Rl_1 | Probes.Rh_3;       /* enable Rl for probe-1 & Rh for probe-3 */
     R_PORT = Probes.Rl_1 | Probes.Rh_3;      /* pull up collector via Rl and base via Rh */
-    wait50ms();                              /* wait to skip gate charging of a FET */
+    settle50ms();                            /* wait to skip gate charging of a FET */
     U_R_c = Cfg.Vcc - ReadU(Probes.Ch_1);    /* U_R_c = Vcc - U_c */ 
     U_R_b = Cfg.Vcc - ReadU(Probes.Ch_3);    /* U_R_b = Vcc - U_b */
 
@@ -1144,7 +1480,11 @@ void CheckTransistor(uint8_t BJT_Type, uint16_t U_Rl)
 
     if (FET_Type > 0)              /* update requested */
     {
-      GetLeakageCurrent(0);             /* get leakage current */
+      #ifdef SW_HFE_SWEEP
+      Get_hFE_Sweep(BJT_Type);          /* get hFE for all drive setups */
+      #endif
+
+      GetLeakageCurrent(0, U_Rl);       /* get leakage current */
 
       /* save data */
       Semi.F_1 = hFE_E;                 /* hFE */
@@ -1275,10 +1615,6 @@ void CheckTransistor(uint8_t BJT_Type, uint16_t U_Rl)
       #endif
     }
 
-    GetGateThreshold(FET_Type);    /* measure gate threshold voltage */
-
-    Check.Done |= DONE_SEMI;       /* transistor detected */
-
     /* save data */
     Semi.A = Probes.ID_3;           /* probe ID for gate */
 
@@ -1293,10 +1629,26 @@ void CheckTransistor(uint8_t BJT_Type, uint16_t U_Rl)
       Semi.C = Probes.ID_1;        /* probe ID for source */
     }
 
-    /* Gate-Source capacitance */
-    MeasureCap(Semi.A, Semi.C, 0);      /* measure capacitance */
-    Semi.C_value = Caps[0].Value;       /* save value */
-    Semi.C_scale = Caps[0].Scale;
+    Check.Done |= DONE_SEMI;       /* transistor detected */
+
+    /*
+     *  Skip the slow gate threshold and C_GS measurements for a MOSFET
+     *  with a reversed diode found by a former run. The diode list only
+     *  grows during probing, so the final VerifyMOSFET() in CheckProbes()
+     *  will reject this MOSFET. Detection flags are kept to follow the
+     *  same path as before.
+     */
+
+    if (! ((Check.Type & TYPE_MOSFET) && ReversedBodyDiode()))
+    {
+      GetGateThreshold(FET_Type);       /* measure gate threshold voltage */
+
+      /* Gate-Source capacitance */
+      MeasureCap(Semi.A, Semi.C, 0);    /* measure capacitance */
+      Semi.C_value = Caps[0].Value;     /* save value */
+      Semi.C_scale = Caps[0].Scale;
+    }
+
     RestoreProbes();                    /* restore original probe IDs */
   }
 }
@@ -1308,11 +1660,14 @@ void CheckTransistor(uint8_t BJT_Type, uint16_t U_Rl)
  *  - JFET or dep. mode MOSFET
  *
  *  requires:
- *  - U_Rl: voltage across Rl pulled down (Gate HiZ)
+ *  - Perm: measurements of CheckProbes()
+ *    U_Rl: voltage across Rl pulled down (Gate HiZ)
+ *    U_G_Low/U_G_High: U_Rl with gate pulled down/up before
  */
 
-void CheckDepletionModeFET(uint16_t U_Rl)
+void CheckDepletionModeFET(Perm_Type *Perm)
 {
+  uint16_t          U_Rl;          /* voltage across Rl */
   uint16_t          Offset;        /* offset voltage */
   uint16_t          U_1;           /* voltage #1 */
   uint16_t          U_2;           /* voltage #2 */
@@ -1335,6 +1690,9 @@ void CheckDepletionModeFET(uint16_t U_Rl)
    */
 
 
+  U_Rl = Perm->U_Rl;
+
+
   /*
    *  select detection offset based on U_Rl
    */
@@ -1365,16 +1723,34 @@ void CheckDepletionModeFET(uint16_t U_Rl)
   /* we assume: probe-1 = D / probe-2 = S / probe-3 = G */
   /* probes already set to: Gnd -- Rl -- probe-2 / probe-1 -- Vcc */
 
-  /* get source voltage when gate is pulled down */
-  /* should create a slightly negative V_GS via voltage drop across Rl at source */
-  /* set probes: Gnd -- Rl -- probe-2 / probe-1 -- Vcc / probe-3 -- Rh -- Gnd */
-  R_DDR = Probes.Rl_2 | Probes.Rh_3;    /* pull down gate via Rh */
-  U_1 = ReadU_20ms(Probes.Ch_2);        /* voltage at source */
+  /*
+   *  CheckProbes() has measured this setup already with the gate pulled
+   *  down and up via Rl. If pulling up the gate didn't increase the
+   *  source voltage, it can't be an n-channel FET and we skip both
+   *  measurements (40ms). That's the case for diodes and resistors.
+   */
+
+  if ((Perm->U_G_High > 0) &&
+      (Perm->U_G_High <= (Perm->U_G_Low + Offset / 2)))
+  {
+    /* no n-channel FET */
+    U_1 = 0;
+    U_2 = 0;
+  }
+  else                             /* n-channel FET possible */
+  {
+    /* get source voltage when gate is pulled down */
+    /* should create a slightly negative V_GS via voltage drop across Rl at source */
+    /* set probes: Gnd -- Rl -- probe-2 / probe-1 -- Vcc / probe-3 -- Rh -- Gnd */
+    R_DDR = Probes.Rl_2 | Probes.Rh_3;  /* pull down gate via Rh */
+    U_1 = ReadU_20ms(Probes.Ch_2);      /* voltage at source */
+
+    /* get source voltage when gate is pulled up */
+    /* set probes: Gnd -- Rl -- probe-2 / probe-1 -- Vcc / probe-3 -- Rh -- Vcc */
+    R_PORT = Probes.Rh_3;               /* pull up gate via Rh */
+    U_2 = ReadU_20ms(Probes.Ch_2);      /* voltage at source */
+  }
 
-  /* get source voltage when gate is pulled up */
-  /* set probes: Gnd -- Rl -- probe-2 / probe-1 -- Vcc / probe-3 -- Rh -- Vcc */
-  R_PORT = Probes.Rh_3;                 /* pull up gate via Rh */
-  U_2 = ReadU_20ms(Probes.Ch_2);        /* voltage at source */
   Diff_1 = U_2 - U_1;                   /* source voltage difference */
 
 
@@ -1780,7 +2156,7 @@ void CheckDepletionModeFET(uint16_t U_Rl)
     }
 
     /* get voltages at source and gate */
-    wait10ms();                         /* setting time */
+    settle10ms();                       /* setting time */
     U_1 = ReadU(Probes.Ch_2);           /* voltage at source */
     U_2 = ReadU(Probes.Ch_3);           /* voltage at gate */
 
@@ -1865,7 +2241,7 @@ uint8_t CheckThyristorTriac(void)
 
   /* simulate short loss of current and check load current again */ 
   R_PORT = 0;                           /* pull down anode */
-  wait5ms();
+  settle5ms();
   R_PORT = Probes.Rl_1;                 /* and pull up anode again */
   U_2 = ReadU_5ms(Probes.Ch_1);         /* get voltage at anode (below Rl) */
 
@@ -1886,7 +2262,7 @@ uint8_t CheckThyristorTriac(void)
     R_DDR = 0;                          /* disable all probe resistors */
     R_PORT = 0;
     ADC_PORT = Probes.Pin_2;            /* pull up Cathode directly */
-    wait5ms();
+    settle5ms();
     R_DDR = Probes.Rl_1;                /* pull down Anode via Rl */ 
     /* probe-3 = gate is in HiZ mode */
 
@@ -1920,7 +2296,7 @@ uint8_t CheckThyristorTriac(void)
 
         /* drop load current for a moment */
         R_PORT = Probes.Rl_1;           /* pull up MT2 via Rl */
-        wait5ms();
+        settle5ms();
         R_PORT = 0;                     /* and pull down MT2 via Rl */
 
         /* and check load current again */
@@ -73,6 +73,8 @@
   #define REG_UCSR_B     UCSR0B    /* USART Control and Status Register B */
   #define BIT_RXCIE      RXCIE0    /* RX Complete Interrupt Enable */
   #define BIT_RXEN       RXEN0     /* Receiver Enable */
+  #define BIT_UDRIE      UDRIE0    /* Data Register Empty Interrupt Enable */
+  #define BIT_TXCIE      TXCIE0    /* TX Complete Interrupt Enable */
   #define BIT_TXEN       TXEN0     /* Transmitter Enable */
   #define BIT_UCSZ_2     UCSZ02    /* USART Character Size 2 */
 
@@ -90,6 +92,8 @@
   #define REG_UBRR       UBRR0     /* USART Baud Rate Register combined */
 
   #define ISR_USART_RX   USART0_RX_vect      /* ISR */
+  #define ISR_USART_UDRE USART0_UDRE_vect    /* ISR */
+  #define ISR_USART_TX   USART0_TX_vect      /* ISR */
 #endif
 
 /* USART1 */
@@ -107,6 +111,8 @@
   #define REG_UCSR_B     UCSR1B    /* USART Control and Status Register B */
   #define BIT_RXCIE      RXCIE1    /* RX Complete Interrupt Enable */
   #define BIT_RXEN       RXEN1     /* Receiver Enable */
+  #define BIT_UDRIE      UDRIE1    /* Data Register Empty Interrupt Enable */
+  #define BIT_TXCIE      TXCIE1    /* TX Complete Interrupt Enable */
   #define BIT_TXEN       TXEN1     /* Transmitter Enable */
   #define BIT_UCSZ_2     UCSZ12    /* Character Size 0 */
 
@@ -124,6 +130,8 @@
   #define REG_UBRR       UBRR1     /* USART Baud Rate Register combined */
 
   #define ISR_USART_RX   USART1_RX_vect      /* ISR */
+  #define ISR_USART_UDRE USART1_UDRE_vect    /* ISR */
+  #define ISR_USART_TX   USART1_TX_vect      /* ISR */
 #endif
 
 /* USART2 */
@@ -141,6 +149,8 @@
   #define REG_UCSR_B     UCSR2B    /* USART Control and Status Register B */
   #define BIT_RXCIE      RXCIE2    /* RX Complete Interrupt Enable */
   #define BIT_RXEN       RXEN2     /* Receiver Enable */
+  #define BIT_UDRIE      UDRIE2    /* Data Register Empty Interrupt Enable */
+  #define BIT_TXCIE      TXCIE2    /* TX Complete Interrupt Enable */
   #define BIT_TXEN       TXEN2     /* Transmitter Enable */
   #define BIT_UCSZ_2     UCSZ22    /* Character Size 0 */
 
@@ -158,6 +168,8 @@
   #define REG_UBRR       UBRR2     /* USART Baud Rate Register combined */
 
   #define ISR_USART_RX   USART2_RX_vect      /* ISR */
+  #define ISR_USART_UDRE USART2_UDRE_vect    /* ISR */
+  #define ISR_USART_TX   USART2_TX_vect      /* ISR */
 #endif
 
 /* USART3 */
@@ -175,6 +187,8 @@
   #define REG_UCSR_B     UCSR3B    /* USART Control and Status Register B */
   #define BIT_RXCIE      RXCIE3    /* RX Complete Interrupt Enable */
   #define BIT_RXEN       RXEN3     /* Receiver Enable */
+  #define BIT_UDRIE      UDRIE3    /* Data Register Empty Interrupt Enable */
+  #define BIT_TXCIE      TXCIE3    /* TX Complete Interrupt Enable */
   #define BIT_TXEN       TXEN3     /* Transmitter Enable */
   #define BIT_UCSZ_2     UCSZ32    /* Character Size 0 */
 
@@ -192,6 +206,8 @@
   #define REG_UBRR       UBRR3     /* USART Baud Rate Register combined */
 
   #define ISR_USART_RX   USART3_RX_vect      /* ISR */
+  #define ISR_USART_UDRE USART3_UDRE_vect    /* ISR */
+  #define ISR_USART_TX   USART3_TX_vect      /* ISR */
 #endif
 
 
@@ -229,6 +245,111 @@
   #define ISR_PINCHANGE  PCINT3_vect    /* ISR */
 #endif
 
+/* timing for fast bit-bang USART (in MCU cycles) */
+#ifdef SERIAL_BITBANG_FAST
+  /* bit period */
+  #define BIT_CYCLES     ((CPU_FREQ + (SERIAL_BITBANG_BAUD / 2)) / SERIAL_BITBANG_BAUD)
+  /* TX: compensate bit loop (about 9 cycles) */
+  #define TX_DELAY       (BIT_CYCLES - 9)
+  /* RX: compensate bit loop (about 9 cycles) */
+  #define RX_DELAY       (BIT_CYCLES - 9)
+  /* RX: 1.5 bit periods to middle of first data bit, minus ISR latency */
+  #define RX_START       (((BIT_CYCLES * 3) / 2) - 40)
+#endif
+
+
+/*
+ *  local variables
+ */
+
+#ifdef SERIAL_MULTIDROP
+/* multi-drop mode */
+uint8_t             Serial_Addr;        /* address of this tester */
+uint8_t             Serial_Talk = 0;    /* flag: addressed, may transmit */
+#endif
+
+#if defined (SERIAL_TX_BUFFER) && ! defined (SERIAL_MULTIDROP)
+/* TX ring buffer */
+volatile uint8_t    TX_Sent = 0;        /* flag: byte sent since last flush */
+#endif
+
+
+
+/* ************************************************************************
+ *   RX command queue
+ * ************************************************************************ */
+
+
+#ifdef SERIAL_RX_QUEUE
+
+/*
+ *  add received char to RX queue
+ *  - called by RX ISR
+ *  - collects text lines and queues them as commands
+ *  - line too long: queues empty line (triggers ERR) and skips rest
+ *  - queue full: drops line
+ *
+ *  requires:
+ *  - Char: received character
+ */
+
+void Serial_QueueChar(unsigned char Char)
+{
+  char              *Line;         /* pointer to current line */
+  uint8_t           Flag = 0;      /* line done */
+
+  if (Cfg.OP_Control & OP_RX_OVERFLOW)  /* skip rest of line */
+  {
+    if (Char == '\n')                   /* NL (new line) */
+    {
+      Cfg.OP_Control &= ~OP_RX_OVERFLOW;     /* end skipping */
+    }
+  }
+  else if (RX_Count == SERIAL_RX_QUEUE) /* queue full */
+  {
+    if (Char != '\n')                   /* new line started */
+    {
+      Cfg.OP_Control |= OP_RX_OVERFLOW;      /* drop line */
+    }
+  }
+  else if (Char != '\r')                /* ignore CR (carriage return) */
+  {
+    Line = &RX_Queue[RX_In][0];         /* current line */
+
+    if (Char == '\n')                   /* NL (new line) */
+    {
+      if (RX_Pos > 0)                   /* not an empty line */
+      {
+        Line[RX_Pos] = 0;               /* terminate string */
+        Flag = 1;                       /* line done */
+      }
+    }
+    else if (RX_Pos == (RX_BUFFER_SIZE - 1))  /* no control char & overflow */
+    {
+      Line[0] = 0;                      /* invalid line */
+      Cfg.OP_Control |= OP_RX_OVERFLOW; /* skip rest of line */
+      Flag = 1;                         /* line done */
+    }
+    else                                /* standard char */
+    {
+      Line[RX_Pos] = Char;              /* copy to buffer */
+      RX_Pos++;                         /* next char */
+    }
+
+    if (Flag)                           /* line done */
+    {
+      /* queue line */
+      RX_Pos = 0;                       /* reset position */
+      RX_In++;                          /* next line */
+      if (RX_In == SERIAL_RX_QUEUE) RX_In = 0;     /* overflow: roll over */
+      RX_Count++;                       /* one more command */
+      Cfg.OP_Control |= OP_RX_LOCKED;   /* signal pending command */
+    }
+  }
+}
+
+#endif
+
 
 
 /* ************************************************************************
@@ -271,6 +392,8 @@ void Serial_Setup(void)
  *  - Byte: byte to send
  */
 
+#ifndef SERIAL_BITBANG_FAST
+
 void Serial_WriteByte(uint8_t Byte)
 {
   uint8_t           n = 8;    /* bit counter */
@@ -309,6 +432,63 @@ void Serial_WriteByte(uint8_t Byte)
   wait3us();
 }
 
+#endif
+
+
+
+#ifdef SERIAL_BITBANG_FAST
+
+/*
+ *  send byte
+ *  - SERIAL_BITBANG_BAUD 8N1
+ *  - cycle-exact delays, interrupts are blocked while sending
+ *
+ *  requires:
+ *  - Byte: byte to send
+ */
+
+void Serial_WriteByte(uint8_t Byte)
+{
+  uint8_t           n = 8;    /* bit counter */
+  uint8_t           Old_SREG; /* status register */
+
+  /* R_PORT & R_DDR / ADC_PORT & ADC_DDR can interfere (input/HiZ) */
+  Serial_Setup();        /* quick and dirty */
+
+  Old_SREG = SREG;                      /* save status register */
+  cli();                                /* disable interrupts */
+
+  /* start bit (0/low) */
+  SERIAL_PORT &= ~(1 << SERIAL_TX);     /* clear TX */
+  __builtin_avr_delay_cycles(TX_DELAY);
+
+  /* 8 data bits (LSB first) */
+  while (n > 0)
+  {
+    if (Byte & 0b00000001)    /* 1 */
+    {
+      SERIAL_PORT |= (1 << SERIAL_TX);    /* set TX */
+    }
+    else                      /* 0 */
+    {
+      SERIAL_PORT &= ~(1 << SERIAL_TX);   /* clear TX */
+    }
+
+    __builtin_avr_delay_cycles(TX_DELAY);
+
+    Byte >>= 1;               /* shift right */
+    n--;                      /* next bit */
+  }
+
+  /* 1 stop bit (1/high) and stay idle (high) */
+  SERIAL_PORT |= (1 << SERIAL_TX);      /* set TX */
+  __builtin_avr_delay_cycles(BIT_CYCLES);
+
+  SREG = Old_SREG;                      /* restore status register */
+}
+
+#endif
+
 
 
 #ifdef SERIAL_RW
@@ -341,6 +521,8 @@ void Serial_Ctrl(uint8_t Control)
 
 
 
+#ifndef SERIAL_BITBANG_FAST
+
 /*
  *  ISR for PCIn (Pin Change Interrupt n)
  *  - 9600 8N1
@@ -358,9 +540,18 @@ ISR(ISR_PINCHANGE, ISR_BLOCK)
    *    (no nested interrupts)
    */
 
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_PCINT]++;    /* count ISR call */
+  #endif
+
   /* check if RX pin has changed to 0/low (start bit) */
   if (! (SERIAL_PIN & (1 << SERIAL_RX)))     /* low state */
   {
+    #ifdef TIMER_MANAGER
+    /* Timer0 is busy: ignore start bit */
+    if (! Timer_Claim(TIMER_0, TIMER_SERIAL)) return;
+    #endif
+
     PCICR &= ~(1 << BIT_PC_IRQ);        /* disable pin change interrupt */
 
     /* reset variables for new char */
@@ -406,9 +597,14 @@ ISR(ISR_PINCHANGE, ISR_BLOCK)
  *  - can't be used when by some measurement/tool needs Timer0
  *  - puts received char into a buffer
  *  - collects full text line and manages the buffer
+ *  - with timer manager: called by shared ISR in pause.c
  */
 
+#ifdef TIMER_MANAGER
+void Serial_RX_Sample(void)
+#else
 ISR(TIMER0_COMPB_vect, ISR_BLOCK)
+#endif
 {
   uint8_t           Bit;           /* bit flag */
 
@@ -419,6 +615,11 @@ ISR(TIMER0_COMPB_vect, ISR_BLOCK)
    *    (no nested interrupts)
    */
 
+  #if defined (SW_PERF_COUNTERS) && ! defined (TIMER_MANAGER)
+  /* with timer manager counted by shared ISR */
+  PerfCount[PERF_TIMER0]++;   /* count ISR call */
+  #endif
+
   TCCR0B = 0;                 /* stop Timer0 */
 
 
@@ -459,6 +660,9 @@ ISR(TIMER0_COMPB_vect, ISR_BLOCK)
 
   if (RX_Bits == 10)          /* got all bits */
   {
+    #ifdef SERIAL_RX_QUEUE
+    Serial_QueueChar(RX_Char);          /* add char to queue */
+    #else
     if (! (Cfg.OP_Control & OP_RX_LOCKED))   /* buffer unlocked */
     {
       if (RX_Char == '\r')              /* CR (carriage return) */
@@ -488,6 +692,7 @@ ISR(TIMER0_COMPB_vect, ISR_BLOCK)
       }
     }
     /* else: drop char */
+    #endif
 
     RX_Bits = 0;              /* end RX */
   }
@@ -500,6 +705,9 @@ ISR(TIMER0_COMPB_vect, ISR_BLOCK)
   if (RX_Bits == 0)      /* char done, no more bits expected */
   {
     TIMSK0 = 0;                    /* disable Timer0 interrupts */
+    #ifdef TIMER_MANAGER
+    Timer_Release(TIMER_0, TIMER_SERIAL);
+    #endif
     PCIFR |= (1 << BIT_PC_FLAG);   /* clear pin change interrupt flag */
     PCICR |= (1 << BIT_PC_IRQ);    /* enable pin change interrupt */
   }
@@ -540,6 +748,126 @@ ISR(TIMER0_COMPB_vect, ISR_BLOCK)
 
 #endif
 
+
+
+#ifdef SERIAL_BITBANG_FAST
+
+#ifndef SERIAL_RX_QUEUE
+
+/*
+ *  put received char into RX buffer
+ *  - called by RX ISR
+ *  - collects full text line and manages the buffer
+ *
+ *  requires:
+ *  - Char: received character
+ */
+
+void Serial_BufferChar(unsigned char Char)
+{
+  if (! (Cfg.OP_Control & OP_RX_LOCKED))     /* buffer unlocked */
+  {
+    if (Char == '\r')                   /* CR (carriage return) */
+    {
+      Char = 0;                         /* terminate string */
+    }
+    else if (Char == '\n')              /* NL (new line) */
+    {
+      Char = 0;                         /* terminate string */
+      if (RX_Pos > 0)                   /* not an empty line */
+      {
+        Cfg.OP_Control |= OP_RX_LOCKED;      /* lock buffer for processing */
+      }
+    }
+    else if (RX_Pos == (RX_BUFFER_SIZE - 1))  /* no control char & overflow */
+    {
+      Char = 0;                               /* terminate string */
+      /* lock buffer & signal overflow */
+      Cfg.OP_Control |= OP_RX_LOCKED | OP_RX_OVERFLOW;
+    }
+
+    RX_Buffer[RX_Pos] = Char;           /* copy to buffer */
+
+    if (Char > 0)                       /* no control char */
+    {
+      RX_Pos++;                         /* next char */
+    }
+  }
+  /* else: drop char */
+}
+
+#endif
+
+
+
+/*
+ *  ISR for PCIn (Pin Change Interrupt n)
+ *  - SERIAL_BITBANG_BAUD 8N1
+ *  - detects start bit and samples complete char with cycle-exact delays
+ *  - doesn't need a timer
+ *  - blocks other interrupts for about one char
+ *  - puts received char into a buffer
+ */
+
+ISR(ISR_PINCHANGE, ISR_BLOCK)
+{
+  uint8_t           Char = 0;      /* received char */
+  uint8_t           n = 8;         /* bit counter */
+
+  /*
+   *  hints:
+   *  - the PCIFn flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_PCINT]++;    /* count ISR call */
+  #endif
+
+  if (! (SERIAL_PIN & (1 << SERIAL_RX)))     /* falling edge: start bit */
+  {
+    /* wait for middle of first data bit */
+    __builtin_avr_delay_cycles(RX_START);
+
+    /* sample 8 data bits (LSB first) */
+    while (n > 0)
+    {
+      Char >>= 1;                       /* shift right */
+      if (SERIAL_PIN & (1 << SERIAL_RX))     /* 1 */
+      {
+        Char |= 0b10000000;             /* set MSB */
+      }
+
+      __builtin_avr_delay_cycles(RX_DELAY);
+      n--;                              /* next bit */
+    }
+
+    /*
+     *  we are in the middle of the stop bit now
+     *  - clear pin changes caused by data bits
+     *  - the next start bit will trigger the interrupt again
+     */
+
+    PCIFR = (1 << BIT_PC_FLAG);         /* clear interrupt flag */
+
+    if (SERIAL_PIN & (1 << SERIAL_RX))  /* valid stop bit (high) */
+    {
+      #ifdef SERIAL_RX_QUEUE
+      Serial_QueueChar(Char);           /* add char to queue */
+      #else
+      Serial_BufferChar(Char);          /* add char to buffer */
+      #endif
+    }
+    /* else: frame error, drop char */
+  }
+  /* else: ignore pin change to 1/high */
+}
+
+#endif
+
+#endif
+
 #endif
 
 
@@ -569,7 +897,21 @@ void Serial_Setup(void)
   REG_UBRR = (CPU_FREQ / (16UL * 9600)) - 1;
   REG_UCSR_C = (1 << BIT_UCSZ_1) | (1 << BIT_UCSZ_0);
 
-  #ifdef SERIAL_RW
+  #ifdef SERIAL_MULTIDROP
+    /* get address (erased EEPROM: use default) */
+    Serial_Addr = eeprom_read_byte(&NV_Serial_Addr);
+    if ((Serial_Addr == 0) || (Serial_Addr == 255))
+    {
+      Serial_Addr = SERIAL_ADDRESS;
+    }
+
+    /* tri-state TX while idle: input with pull-up */
+    SERIAL_DDR &= ~(1 << SERIAL_TX);
+    SERIAL_PORT |= (1 << SERIAL_TX);
+
+    /* enable RX only, TX is enabled when sending */
+    REG_UCSR_B = (1 << BIT_RXEN);
+  #elif defined (SERIAL_RW)
     /* enable TX and RX */
     REG_UCSR_B = (1 << BIT_RXEN) | (1 << BIT_TXEN);
     /* hint: use Serial_Ctrl() to enable interrupt for RX Complete later on */
@@ -594,20 +936,218 @@ void Serial_Setup(void)
  *  - Byte: byte to send
  */
 
+#ifndef SERIAL_TX_BUFFER
+
 void Serial_WriteByte(uint8_t Byte)
 {
+  #ifdef SERIAL_MULTIDROP
+  uint8_t           Old_SREG;      /* status register */
+
+  if (! Serial_Talk) return;       /* not addressed: stay silent */
+  #endif
+
   /* wait for empty Tx buffer */
   while (! (REG_UCSR_A & (1 << BIT_UDRE)));
 
+  #ifdef SERIAL_MULTIDROP
+  Old_SREG = SREG;                 /* save status register */
+  cli();                           /* disable interrupts */
+
+  /* clear USART Transmit Complete flag and enable TX */
+  REG_UCSR_A = (1 << BIT_TXC);
+  REG_UCSR_B |= (1 << BIT_TXEN) | (1 << BIT_TXCIE);
+
+  /* copy byte to Tx buffer, triggers sending */
+  REG_UDR = Byte;
+
+  SREG = Old_SREG;                 /* restore status register */
+  #else
   /* clear USART Transmit Complete flag */
   //REG_UCSR_A = (1 << BIT_TXC);
 
   /* copy byte to Tx buffer, triggers sending */
   REG_UDR = Byte;
+  #endif
+}
+
+#endif
+
+
+
+#ifdef SERIAL_TX_BUFFER
+
+/*
+ *  send oldest byte of TX ring buffer directly
+ *  - for use with interrupts disabled (UDRE ISR can't run)
+ *  - buffer must not be empty
+ */
+
+void Serial_SendDirect(void)
+{
+  /* wait for empty Tx buffer */
+  while (! (REG_UCSR_A & (1 << BIT_UDRE)));
+
+  /* clear TX Complete flag */
+  REG_UCSR_A = (1 << BIT_TXC);
+  #ifdef SERIAL_MULTIDROP
+  /* enable TX (might be released already) */
+  REG_UCSR_B |= (1 << BIT_TXEN) | (1 << BIT_TXCIE);
+  #else
+  TX_Sent = 1;
+  #endif
+
+  REG_UDR = TX_Buffer[TX_Tail];         /* send oldest byte */
+  TX_Tail = (TX_Tail + 1) & (TX_BUFFER_SIZE - 1);
+}
+
+
+
+/*
+ *  send byte via TX ring buffer
+ *  - 9600 8N1 (set by Serial_Setup())
+ *  - byte is sent in background by UDRE ISR
+ *  - full buffer: wait for free slot (no byte is dropped)
+ *    with interrupts disabled the oldest byte is sent directly
+ *
+ *  requires:
+ *  - Byte: byte to send
+ */
+
+void Serial_WriteByte(uint8_t Byte)
+{
+  uint8_t           Next;          /* next head position */
+
+  #ifdef SERIAL_MULTIDROP
+  if (! Serial_Talk) return;       /* not addressed: stay silent */
+  #endif
+
+  Next = (TX_Head + 1) & (TX_BUFFER_SIZE - 1);
+
+  /* wait for free slot */
+  while (Next == TX_Tail)          /* buffer full */
+  {
+    if (! (SREG & (1 << SREG_I)))  /* interrupts disabled */
+    {
+      /* ISR can't run, so we have to send the oldest byte ourself */
+      Serial_SendDirect();
+    }
+  }
+
+  /* add byte to buffer */
+  TX_Buffer[TX_Head] = Byte;
+  TX_Head = Next;
+
+  /* enable UDRE interrupt (ISR disables it when buffer is empty) */
+  REG_UCSR_B |= (1 << BIT_UDRIE);
+}
+
+
+
+/*
+ *  wait until all bytes are sent
+ *  - call before disabling interrupts for good or sleeping in a mode
+ *    stopping clk_IO
+ *  - UDRE only signals that the last byte was moved to the shift
+ *    register, so we wait for TX Complete
+ */
+
+void Serial_Flush(void)
+{
+  /* wait for ISR to send all bytes */
+  while (TX_Tail != TX_Head)       /* buffer not empty */
+  {
+    if (! (SREG & (1 << SREG_I)))  /* interrupts disabled */
+    {
+      /* ISR can't run, so we have to send the bytes ourself */
+      Serial_SendDirect();
+    }
+  }
+
+  #ifdef SERIAL_MULTIDROP
+  /* wait for TXC ISR to release TX line (clears TXC flag itself) */
+  while (REG_UCSR_B & (1 << BIT_TXEN))
+  {
+    if ((! (SREG & (1 << SREG_I))) && (REG_UCSR_A & (1 << BIT_TXC)))
+    {
+      /* ISR can't run, so we have to release TX ourself */
+      REG_UCSR_A = (1 << BIT_TXC);
+      REG_UCSR_B &= ~((1 << BIT_TXEN) | (1 << BIT_TXCIE));
+    }
+  }
+  #else
+  /* wait for USART to shift out the last byte */
+  if (TX_Sent)                     /* TXC is set only after sending */
+  {
+    while (! (REG_UCSR_A & (1 << BIT_TXC)));
+    TX_Sent = 0;                   /* reset flag */
+  }
+  #endif
 }
 
 
 
+/*
+ *  ISR for UDREn (USART Data Register Empty n)
+ *  - sends next byte from TX buffer
+ *  - disables itself when buffer is empty
+ */
+
+ISR(ISR_USART_UDRE, ISR_BLOCK)
+{
+  /*
+   *  hints:
+   *  - the UDREn flag is cleared by writing UDRn
+   *    if not cleared it will retrigger the interrupt
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  if (TX_Tail != TX_Head)          /* buffer not empty */
+  {
+    /* clear TX Complete flag */
+    REG_UCSR_A = (1 << BIT_TXC);
+    #ifdef SERIAL_MULTIDROP
+    /* enable TX (might be released already) */
+    REG_UCSR_B |= (1 << BIT_TXEN) | (1 << BIT_TXCIE);
+    #else
+    TX_Sent = 1;
+    #endif
+    REG_UDR = TX_Buffer[TX_Tail];       /* send oldest byte */
+    TX_Tail = (TX_Tail + 1) & (TX_BUFFER_SIZE - 1);
+  }
+  else                             /* buffer empty */
+  {
+    REG_UCSR_B &= ~(1 << BIT_UDRIE);    /* disable UDRE interrupt */
+  }
+}
+
+#endif
+
+
+
+#ifdef SERIAL_MULTIDROP
+
+/*
+ *  ISR for TXCn (Transmit Complete n)
+ *  - all data is sent
+ *  - releases TX line (tri-state) for the other testers on the bus
+ */
+
+ISR(ISR_USART_TX, ISR_BLOCK)
+{
+  /*
+   *  hints:
+   *  - the TXCn flag is cleared automatically
+   *  - pin returns to port setting (input with pull-up)
+   */
+
+  REG_UCSR_B &= ~((1 << BIT_TXEN) | (1 << BIT_TXCIE));
+}
+
+#endif
+
+
+
 #ifdef SERIAL_RW
 
 /*
@@ -656,11 +1196,18 @@ ISR(ISR_USART_RX, ISR_BLOCK)
    *    (no nested interrupts)
    */
 
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_RX]++;       /* count ISR call */
+  #endif
+
   /* todo: shall we allow nested interrupts for more critical things? */
   /* todo: check receiver error flags? UCSRnA must be read before UDRn! */
 
   Char = REG_UDR;                       /* get received char & clear flag */
 
+  #ifdef SERIAL_RX_QUEUE
+  Serial_QueueChar(Char);               /* add char to queue */
+  #else
   if (! (Cfg.OP_Control & OP_RX_LOCKED))     /* buffer unlocked */
   {
     if (Char == '\r')                   /* CR (carriage return) */
@@ -690,6 +1237,7 @@ ISR(ISR_USART_RX, ISR_BLOCK)
     }
   }
   /* else: drop char, otherwise it would block the firmware */
+  #endif
 }
 
 #endif
@@ -793,11 +1341,126 @@ void Serial_NewLine(void)
  * ************************************************************************ */
 
 
+#ifdef SERIAL_MULTIDROP
+
+/*
+ *  check address prefix of received command line (multi-drop mode)
+ *  - format: "<address>:<command>"
+ *    address: 1-254 or '*' for all testers (broadcast)
+ *  - strips prefix from RX buffer
+ *  - manages TX: tester transmits only after being addressed and stays
+ *    silent after a broadcast or a command for another tester
+ *  - line without prefix is for the currently addressed tester
+ *
+ *  returns:
+ *  - 1 if command is for this tester
+ *  - 0 if not (ignore command)
+ */
+
+uint8_t Serial_CheckAddress(void)
+{
+  uint8_t           Flag;               /* return value */
+  uint8_t           n = 0;              /* position in RX buffer */
+  uint8_t           i = 0;              /* position in RX buffer */
+  uint16_t          Addr = 0;           /* received address */
+  unsigned char     Char;               /* char */
+
+  /* get address */
+  Char = RX_Buffer[0];
+  if (Char == '*')                 /* broadcast */
+  {
+    n = 1;                              /* skip char */
+    Addr = 256;                         /* mark broadcast */
+  }
+  else                             /* decimal address */
+  {
+    while ((Char >= '0') && (Char <= '9') && (n < 3))
+    {
+      Addr *= 10;
+      Addr += Char - '0';               /* add digit */
+      n++;                              /* next char */
+      Char = RX_Buffer[n];
+    }
+  }
+
+  if ((n > 0) && (RX_Buffer[n] == ':'))  /* valid prefix */
+  {
+    Flag = 0;                           /* default: not for us */
+
+    if (Addr == Serial_Addr)            /* this tester */
+    {
+      Serial_Talk = 1;                  /* may transmit */
+      Flag = 1;                         /* run command */
+    }
+    else                                /* another tester or broadcast */
+    {
+      Serial_Talk = 0;                  /* stay silent */
+      if (Addr == 256) Flag = 1;        /* broadcast: run command */
+    }
+
+    /* strip prefix (buffer is terminated by 0) */
+    n++;                                /* skip colon */
+    do
+    {
+      Char = RX_Buffer[n];
+      RX_Buffer[i] = Char;              /* move char */
+      i++;                              /* next char */
+      n++;                              /* next char */
+    } while (Char != 0);
+  }
+  else                             /* no prefix */
+  {
+    /* for the currently addressed tester */
+    Flag = Serial_Talk;
+  }
+
+  return Flag;
+}
+
+
+
+/*
+ *  get or change address for multi-drop mode
+ *  - new address is stored in EEPROM
+ *
+ *  requires:
+ *  - Addr: new address (1-254)
+ *    0 to keep current address
+ *
+ *  returns:
+ *  - current address
+ */
+
+uint8_t Serial_Address(uint8_t Addr)
+{
+  if (Addr > 0)                    /* new address */
+  {
+    Serial_Addr = Addr;
+    #ifdef SW_PERF_COUNTERS
+    PerfCount[PERF_EEPROM]++; /* count EEPROM write */
+    #endif
+    eeprom_update_byte((uint8_t *)&NV_Serial_Addr, Addr);
+  }
+
+  return Serial_Addr;
+}
+
+#endif
+
+
 
 /* ************************************************************************
  *   clean-up of local constants
  * ************************************************************************ */
 
+/* timing for fast bit-bang USART */
+#ifdef SERIAL_BITBANG_FAST
+  #undef BIT_CYCLES
+  #undef TX_DELAY
+  #undef RX_DELAY
+  #undef RX_START
+#endif
+
 /* source management */
 #undef SERIAL_C
 
@@ -51,6 +51,14 @@
 #define FP_MIN           400000    /* 400 kHz */
 #define FP_MAX           440000    /* 440 kHz */
 
+/* tracking of f_i: tolerance (f_i / x) and number of readings */
+#define LC_TRACK_TOLER   4096      /* about 150 Hz or 0.5 pF */
+#define LC_TRACK_COUNT   10        /* consecutive near-zero readings */
+
+/* fast update mode: moving window of gate periods */
+#define LC_FAST_GATE     200       /* gate time in ms (divisor of 1000) */
+#define LC_WINDOW_SIZE   5         /* gate periods (1s total) */
+
 
 
 /*
@@ -70,6 +78,13 @@
   /* capacitances */
   uint32_t                    C_i;           /* C_i (in 0.1 pF) */
 
+  /* moving window for fast update mode */
+  #ifdef LC_METER_FAST
+  uint32_t                    LC_Window[LC_WINDOW_SIZE];  /* pulses per gate */
+  uint8_t                     LC_WinIndex;   /* next window position */
+  uint8_t                     LC_WinCount;   /* number of gate periods */
+  #endif
+
 #endif
 
 
@@ -152,7 +167,9 @@ Measurement ranges:
  *  - frequency input: T0
  *  - requires idle sleep mode to keep timers running when MCU is sleeping
  *  - max. frequency is 1/4 of MCU clock
- *  - stores frequency in global variable xxx
+ *  - stores frequency in global variable LC_Freq
+ *  - fast update mode: runs a single short gate period and returns the
+ *    average over the moving window of the last gate periods
  *
  *  returns:
  *  - 0 for measurement done
@@ -169,6 +186,11 @@ uint8_t Get_LC_Frequency(void)
   uint16_t          GateTime;           /* gate time in ms */
   uint16_t          Top;                /* top value for timer */
   uint32_t          Value;              /* temporary value */
+  #ifdef LC_METER_FAST
+  uint8_t           n;                  /* counter */
+  uint32_t          Last;               /* last average */
+  uint32_t          Delta;              /* allowed deviation */
+  #endif
 
   /* control flags */
   #define RUN_FLAG       1         /* run flag */
@@ -180,6 +202,9 @@ uint8_t Get_LC_Frequency(void)
    *  unknown signal. Max. frequency for Timer0 is 1/4 of the MCU clock.
    */
 
+  #ifdef LC_METER_FAST
+  Last = LC_Freq;             /* save last average */
+  #endif
   LC_Freq = 0;                /* reset frequency value */
   Flag = RUN_FLAG;            /* enter measurement loop */
 
@@ -204,9 +229,15 @@ uint8_t Get_LC_Frequency(void)
       < 400kHz          100ms         64  all        > 1nF
    */
 
+  #ifdef LC_METER_FAST
+  /* fixed gate time, no autoranging */
+  GateTime = LC_FAST_GATE;         /* short gate time */
+  Index = 3;                       /* prescaler table index (prescaler 256:1) */
+  #else
   /* start values for autoranging (assuming high frequency) */
   GateTime = 100;                  /* gate time 100ms */
   Index = 2;                       /* prescaler table index (prescaler 64:1) */
+  #endif
 
   /* set up Timer0 (pulse counter) */
   TCCR0A = 0;                      /* normal mode (count up) */
@@ -294,6 +325,45 @@ uint8_t Get_LC_Frequency(void)
       Value /= GateTime;                /* divide by gatetime (in ms) */
       Flag = 0;                         /* end loop */
 
+      #ifdef LC_METER_FAST
+      /*
+       *  moving window
+       *  - sum of the last gate periods gives the resolution of a
+       *    1s gate time, updated after each short gate period
+       *  - restart window on a large change (new DUT)
+       */
+
+      if (LC_WinCount > 0)              /* window not empty */
+      {
+        Delta = Last / 256;             /* 0.4% of last average */
+        if ((Value + Delta < Last) || (Value > Last + Delta))
+        {
+          LC_WinCount = 0;              /* restart window */
+        }
+      }
+
+      /* add gate period to window */
+      LC_Window[LC_WinIndex] = Pulses;
+      LC_WinIndex++;                    /* next position */
+      if (LC_WinIndex >= LC_WINDOW_SIZE) LC_WinIndex = 0;
+      if (LC_WinCount < LC_WINDOW_SIZE) LC_WinCount++;
+
+      /* average of window */
+      Value = 0;
+      n = 0;
+      while (n < LC_WinCount)
+      {
+        /* sum up the last gate periods (backwards from new one) */
+        Index = LC_WinIndex + LC_WINDOW_SIZE - 1 - n;
+        if (Index >= LC_WINDOW_SIZE) Index -= LC_WINDOW_SIZE;
+        Value += LC_Window[Index];
+        n++;
+      }
+      Value *= (1000 / LC_FAST_GATE);   /* pulses per second */
+      Value /= LC_WinCount;             /* average */
+      LC_Freq = Value;                  /* save frequency */
+      #else
+
       /* autoranging */
       if (Value < 400000UL)             /* range overrun */
       {
@@ -324,6 +394,7 @@ uint8_t Get_LC_Frequency(void)
       {
         LC_Freq = Value;                /* save frequency */
       }
+      #endif
     }
   }
 
@@ -348,6 +419,35 @@ uint8_t Get_LC_Frequency(void)
 
 
 
+#ifdef LC_METER_FAST
+
+/*
+ *  measure frequency of LC oscillator with a full moving window
+ *  - for self-adjustment
+ *
+ *  returns:
+ *  - 0 for measurement done
+ *  - key code >0 in case of any user feedback
+ */
+
+uint8_t Get_LC_FullWindow(void)
+{
+  uint8_t           Test;               /* user feedback */
+
+  LC_WinCount = 0;                 /* restart window */
+
+  do
+  {
+    Test = Get_LC_Frequency();     /* next gate period */
+  } while ((Test == 0) && (LC_WinCount < LC_WINDOW_SIZE));
+
+  return Test;
+}
+
+#endif
+
+
+
 /*
  *  calculate C_x or C_i
  *  - C_x = C_i * ((f_i/f_x)^2 - 1)
@@ -515,7 +615,11 @@ uint8_t LC_SelfAdjust(void)
   MilliSleep(100);                      /* settling time */
 
   /* measure base frequency f_i */
+  #ifdef LC_METER_FAST
+  Test = Get_LC_FullWindow();
+  #else
   Test = Get_LC_Frequency();
+  #endif
 
   if (Test == 0)              /* got frequency */
   {
@@ -529,7 +633,11 @@ uint8_t LC_SelfAdjust(void)
       MilliSleep(100);                       /* settling time */
 
       /* measure f_p */
+      #ifdef LC_METER_FAST
+      Test = Get_LC_FullWindow();
+      #else
       Test = Get_LC_Frequency();
+      #endif
 
       if (Test == 0)                         /* got frequency */
       {
@@ -555,6 +663,10 @@ uint8_t LC_SelfAdjust(void)
   /* restore old state of L/C selection */
   LC_CTRL_PORT |= OldState;             /* set bit (when set in OldState) */
 
+  #ifdef LC_METER_FAST
+  LC_WinCount = 0;                      /* restart window for DUT */
+  #endif
+
   return Flag;
 }
 
@@ -576,6 +688,10 @@ uint8_t LC_Meter(void)
   uint8_t           CtrlDir;            /* control DDR state */
   uint8_t           Mode;               /* measurement mode (L/C) */
   uint8_t           Delay;              /* delay flag */
+  #ifdef LC_METER_TRACK
+  uint8_t           Track = 0;          /* near-zero readings */
+  uint32_t          Delta;              /* tolerance for near-zero */
+  #endif
 
   /* control flags */
   #define RUN_FLAG            0b00000001     /* run flag */
@@ -649,6 +765,14 @@ uint8_t LC_Meter(void)
       /* trigger output of "no value" */
       Run |= SHOW_VALUE | NO_VALUE;
 
+      #ifdef LC_METER_FAST
+      LC_WinCount = 0;             /* restart window */
+      #endif
+
+      #ifdef LC_METER_TRACK
+      Track = 0;                   /* reset tracking */
+      #endif
+
       Run &= ~UPDATE_MODE;         /* clear flag */
     }
 
@@ -667,15 +791,46 @@ uint8_t LC_Meter(void)
       {
         f_x = LC_Freq;             /* save f_x/f_s */
 
+        #ifdef LC_METER_TRACK
+        /*
+         *  track drift of f_i
+         *  - C mode with open fixture: f_x stays close to f_i
+         *  - after several near-zero readings take f_x as new f_i
+         */
+
+        if (Mode == MODE_C)        /* C */
+        {
+          Delta = f_i / LC_TRACK_TOLER;     /* tolerance */
+
+          if ((f_x + Delta >= f_i) && (f_x <= f_i + Delta))
+          {
+            /* near zero */
+            Track++;                        /* another reading */
+
+            if (Track >= LC_TRACK_COUNT)    /* near zero for a while */
+            {
+              f_i = f_x;                    /* update f_i */
+              Track = 0;                    /* reset counter */
+            }
+          }
+          else                              /* DUT connected */
+          {
+            Track = 0;                      /* reset counter */
+          }
+        }
+        #endif
+
         /* f_x must be lower than f_i */
         if (f_i >= f_x)            /* f_x lower than f_i */
         {
           Delay = 0;               /* reset flag */
 
+          #ifndef LC_METER_FAST
           if (f_x < 400000UL)      /* < 400 kHz / 100 ms gate time */
           {
             Delay = 1;             /* set flag for short gate time */
           }
+          #endif
 
           if (Mode == MODE_C)      /* C */
           {
@@ -771,6 +926,10 @@ uint8_t LC_Meter(void)
         /* repeat self-ajustment */
         Test = LC_SelfAdjust();         /* run self-ajustment */
 
+        #ifdef LC_METER_TRACK
+        Track = 0;                      /* reset tracking */
+        #endif
+
         if (Test)                       /* adjustment done */
         {
           Run |= SHOW_VALUE | NO_VALUE;      /* display "no value" */
@@ -878,6 +1037,12 @@ uint8_t LC_Meter(void)
 #undef FP_MIN
 #undef FP_MAX
 
+#undef LC_TRACK_TOLER
+#undef LC_TRACK_COUNT
+
+#undef LC_FAST_GATE
+#undef LC_WINDOW_SIZE
+
 
 /* source management */
 #undef TOOLS_LC_METER_C
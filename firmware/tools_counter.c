@@ -14,6 +14,17 @@
 /* source management */
 #define TOOLS_COUNTER_C
 
+/* reciprocal counting */
+#define RECIP_MAX_FREQ   10000                /* crossover frequency (in Hz) */
+#define RECIP_WINDOW     (CPU_FREQ / 10)      /* min. measurement time: 100ms (in MCU cycles) */
+#define RECIP_TIMEOUT    ((CPU_FREQ / 65536) * 5 / 2)   /* timeout: 2.5s (in Timer1 overflows) */
+
+/* event log */
+#define LOG_BINS         16                   /* max. number of histogram bins */
+
+/* frequency statistics */
+#define STATS_MAX_DEV    4095                 /* max. deviation from first sample */
+
 
 
 /*
@@ -45,6 +56,44 @@ volatile uint8_t         TimeTicks;     /* tick counter */
 volatile uint16_t        TimeCounter;   /* time counter */
 #endif
 
+/* event log */
+#ifdef EVENT_COUNTER_LOG
+volatile uint8_t         LogMode;       /* 1 = Timer0 overflow is event */
+volatile uint8_t         LogIndex;      /* next log position */
+volatile uint8_t         LogCount;      /* number of log entries */
+volatile uint32_t        LogBase;       /* time base (Timer1 ticks) */
+volatile uint32_t        LogLast;       /* timestamp of last event */
+volatile uint16_t        EventLog[EVENT_LOG_SIZE];     /* inter-event times (Timer1 ticks) */
+#endif
+
+/* reciprocal counting */
+#ifdef FREQ_COUNTER_RECIPROCAL
+volatile uint8_t         RecipMode;     /* 1 = Timer0 overflow is edge event */
+volatile uint16_t        RecipOverflows;     /* Timer1 overflows */
+volatile uint16_t        RecipEdges;    /* number of edges */
+volatile uint32_t        RecipStart;    /* timestamp of first edge */
+volatile uint32_t        RecipStop;     /* timestamp of last edge */
+#endif
+
+/* continuous gating */
+#ifdef FREQ_COUNTER_CONTINUOUS
+volatile uint8_t         GateMode;      /* 1 = continuous gating */
+volatile uint8_t         GateReady;     /* 1 = new gate result */
+volatile uint16_t        GatePulses;    /* pulses of last gate period */
+uint16_t                 GateTotal;     /* pulse count at end of last gate */
+#endif
+
+/* frequency statistics */
+#ifdef FREQ_COUNTER_STATS
+uint8_t                  StatsN;        /* number of samples */
+uint8_t                  StatsDot;      /* decimal places of samples */
+uint32_t                 StatsFirst;    /* first sample (reference) */
+uint32_t                 StatsMin;      /* minimum */
+uint32_t                 StatsMax;      /* maximum */
+int32_t                  StatsSum;      /* sum of deviations */
+uint32_t                 StatsSumSq;    /* sum of squared deviations */
+#endif
+
 
 
 /* ************************************************************************
@@ -62,6 +111,11 @@ volatile uint16_t        TimeCounter;   /* time counter */
 
 ISR(TIMER0_OVF_vect, ISR_BLOCK)
 {
+  #if defined (FREQ_COUNTER_RECIPROCAL) || defined (EVENT_COUNTER_LOG)
+  uint32_t          Time;          /* timestamp */
+  uint16_t          Counter;       /* Timer1 counter */
+  #endif
+
   /*
    *  hints:
    *  - the TOV0 interrupt flag is cleared automatically
@@ -69,6 +123,88 @@ ISR(TIMER0_OVF_vect, ISR_BLOCK)
    *    (no nested interrupts)
    */
 
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_TIMER0]++;   /* count ISR call */
+  #endif
+
+  #ifdef FREQ_COUNTER_RECIPROCAL
+  if (RecipMode)              /* reciprocal counting: edge event */
+  {
+    /* get timestamp (Timer1 overflows and counter) */
+    Counter = TCNT1;               /* get Timer1 counter */
+    Time = RecipOverflows;         /* get overflows */
+
+    /* consider overflow not processed yet */
+    if ((TIFR1 & (1 << TOV1)) && (Counter < 0x8000))
+    {
+      Time++;
+    }
+
+    Time <<= 16;                   /* overflows are upper 16 bits */
+    Time |= Counter;               /* add counter */
+
+    if (RecipEdges == 0)           /* first edge */
+    {
+      RecipStart = Time;           /* start of first period */
+    }
+
+    RecipStop = Time;              /* end of last period */
+    RecipEdges++;                  /* one edge more */
+
+    if ((Time - RecipStart) >= RECIP_WINDOW)     /* measurement window passed */
+    {
+      /* stop timers */
+      TCCR1B = 0;                  /* disable Timer1 */
+      TCCR0B = 0;                  /* disable Timer0 */
+
+      /* break TestKey() processing */
+      Cfg.OP_Control |= OP_BREAK_KEY;      /* set break signal */
+    }
+    else                           /* keep going */
+    {
+      TCNT0 = 0xFF;                /* overflow with next edge */
+    }
+
+    return;
+  }
+  #endif
+
+  #ifdef EVENT_COUNTER_LOG
+  if (LogMode)                /* event log: edge event */
+  {
+    TCNT0 = 0xFF;                  /* overflow with next edge */
+
+    /* get timestamp (time base and Timer1 counter) */
+    Counter = TCNT1;               /* get Timer1 counter */
+    Time = LogBase;                /* get time base */
+
+    /* consider tick not processed yet */
+    if ((TIFR1 & (1 << OCF1B)) && (Counter < (OCR1A / 2)))
+    {
+      Time += OCR1A + 1;
+    }
+
+    Time += Counter;               /* add counter */
+
+    /* log time since last event (saturated to 16 bits) */
+    Counter = UINT16_MAX;
+    if ((Time - LogLast) < UINT16_MAX)
+    {
+      Counter = (uint16_t)(Time - LogLast);
+    }
+    LogLast = Time;
+
+    EventLog[LogIndex] = Counter;  /* save time */
+    LogIndex++;                    /* next position */
+    if (LogIndex >= EVENT_LOG_SIZE) LogIndex = 0;     /* ring buffer */
+    if (LogCount < EVENT_LOG_SIZE) LogCount++;        /* one entry more */
+
+    Pulses++;                      /* one event more */
+
+    return;
+  }
+  #endif
+
   Pulses += 256;              /* add overflow to global counter */
 }
 
@@ -76,6 +212,44 @@ ISR(TIMER0_OVF_vect, ISR_BLOCK)
 
 
 
+#ifdef FREQ_COUNTER_RECIPROCAL
+
+/*
+ *  ISR for overflow of Timer1
+ *  - time base for reciprocal counting
+ *  - ends measurement on timeout
+ */
+
+ISR(TIMER1_OVF_vect, ISR_BLOCK)
+{
+  /*
+   *  hints:
+   *  - the TOV1 interrupt flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_TIMER1]++;   /* count ISR call */
+  #endif
+
+  RecipOverflows++;           /* one more overflow */
+
+  if (RecipOverflows >= RECIP_TIMEOUT)  /* timeout */
+  {
+    /* stop timers */
+    TCCR1B = 0;               /* disable Timer1 */
+    TCCR0B = 0;               /* disable Timer0 */
+
+    /* break TestKey() processing */
+    Cfg.OP_Control |= OP_BREAK_KEY;     /* set break signal */
+  }
+}
+
+#endif
+
+
+
 #if defined (HW_FREQ_COUNTER_BASIC) || defined (HW_FREQ_COUNTER_EXT) || defined (HW_LC_METER) || defined (HW_RING_TESTER)
 
 /*
@@ -85,6 +259,11 @@ ISR(TIMER0_OVF_vect, ISR_BLOCK)
 
 ISR(TIMER1_COMPA_vect, ISR_BLOCK)
 {
+  #ifdef FREQ_COUNTER_CONTINUOUS
+  uint16_t          Total;         /* total number of pulses */
+  uint8_t           Counter;       /* Timer0 counter */
+  #endif
+
   /*
    *  hints:
    *  - the OCF1A interrupt flag is cleared automatically
@@ -92,6 +271,37 @@ ISR(TIMER1_COMPA_vect, ISR_BLOCK)
    *    (no nested interrupts)
    */
 
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_TIMER1]++;   /* count ISR call */
+  #endif
+
+  #ifdef FREQ_COUNTER_CONTINUOUS
+  if (GateMode)               /* continuous gating */
+  {
+    /* Timer1 restarts gate by itself (CTC mode), Timer0 keeps counting */
+    Counter = TCNT0;               /* get pulse counter */
+    Total = Pulses;                /* get overflows */
+
+    /* consider overflow not processed yet */
+    if ((TIFR0 & (1 << TOV0)) && (Counter < 128))
+    {
+      Total += 256;
+    }
+
+    Total += Counter;              /* total number of pulses */
+
+    /* double buffering: pulses of this gate period */
+    GatePulses = Total - GateTotal;     /* 16 bit wrap-around is fine */
+    GateTotal = Total;                  /* start of next gate period */
+    GateReady = 1;                      /* signal new result */
+
+    /* break TestKey() processing */
+    Cfg.OP_Control |= OP_BREAK_KEY;     /* set break signal */
+
+    return;
+  }
+  #endif
+
   /* gate time has passed */
   TCCR1B = 0;                 /* disable Timer1 */
   TCCR0B = 0;                 /* disable Timer0 */
@@ -104,6 +314,296 @@ ISR(TIMER1_COMPA_vect, ISR_BLOCK)
 
 
 
+#ifdef FREQ_COUNTER_RECIPROCAL
+
+/* ************************************************************************
+ *   reciprocal counting for frequency counters
+ * ************************************************************************ */
+
+
+/*
+ *  start reciprocal counting
+ *  - Timer0 counts edges on T0 and is preloaded to overflow with each
+ *    edge, the overflow ISR timestamps the edge with Timer1 running at
+ *    the MCU clock
+ *  - measurement ends after RECIP_WINDOW or RECIP_TIMEOUT
+ *  - T0 has to be set up as input
+ */
+
+void Reciprocal_Start(void)
+{
+  /* reset variables */
+  RecipOverflows = 0;
+  RecipEdges = 0;
+  RecipMode = 1;                   /* Timer0 overflow is edge event */
+
+  /* set up Timer1 (time base) */
+  TCNT1 = 0;                       /* reset counter */
+  TIFR1 = (1 << TOV1);             /* clear overflow flag */
+  TIMSK1 = (1 << TOIE1);           /* enable overflow interrupt */
+
+  /* set up Timer0 (edge detection) */
+  TCNT0 = 0xFF;                    /* overflow with next edge */
+  TIFR0 = (1 << TOV0);             /* clear overflow flag */
+
+  /* start timers */
+  TCCR1B = (1 << CS10);                 /* start Timer1: prescaler 1:1 */
+  TCCR0B = (1 << CS02) | (1 << CS01);   /* start Timer0: clock source T0 on falling edge */
+}
+
+
+
+/*
+ *  stop reciprocal counting and calculate frequency
+ *  - also restores timer interrupts for gated counting
+ *
+ *  returns:
+ *  - frequency in mHz
+ *  - 0 if no signal or measurement interrupted
+ */
+
+uint32_t Reciprocal_Result(void)
+{
+  uint32_t          Value = 0;          /* return value */
+  uint32_t          Ticks;              /* time in MCU cycles */
+  uint32_t          Rest;               /* remainder */
+  uint8_t           n;                  /* counter */
+
+  /* stop timers */
+  TCCR1B = 0;                      /* disable Timer1 */
+  TCCR0B = 0;                      /* disable Timer0 */
+  RecipMode = 0;                   /* back to pulse counting */
+
+  /* restore interrupts for gated counting */
+  TIFR0 = (1 << TOV0);             /* clear overflow flag */
+  TIFR1 = (1 << OCF1A);            /* clear output compare A match flag */
+  TIMSK0 = (1 << TOIE0);           /* enable overflow interrupt */
+  TIMSK1 = (1 << OCIE1A);          /* enable output compare A match interrupt */
+
+  if (RecipEdges >= 2)             /* got at least one period */
+  {
+    Ticks = RecipStop - RecipStart;     /* time for all periods */
+
+    /*
+     *  f = periods * f_MCU / ticks
+     *  - scale to mHz: periods * (f_MCU / 1000) * 10^6 / ticks
+     *  - long division with decimal steps to prevent an overflow
+     */
+
+    Value = RecipEdges - 1;             /* number of periods */
+    Value *= (CPU_FREQ / 1000);         /* * f_MCU in kHz */
+    Rest = Value % Ticks;               /* remainder */
+    Value /= Ticks;                     /* integer part (in kHz/1000) */
+
+    n = 6;                              /* 10^6 */
+    while (n > 0)
+    {
+      Rest *= 10;                       /* next decimal place */
+      Value *= 10;
+      Value += Rest / Ticks;
+      Rest %= Ticks;
+      n--;
+    }
+  }
+
+  return Value;
+}
+
+#endif
+
+
+
+#ifdef FREQ_COUNTER_STATS
+
+/* ************************************************************************
+ *   frequency statistics for frequency counters
+ * ************************************************************************ */
+
+
+/*
+ *  add frequency to statistics window
+ *  - tracks min/max and sums of the deviations from the first sample
+ *    of the window (keeps the sum of squares within 32 bits)
+ *  - starts a new window when the window is full, the unit has changed
+ *    or the deviation exceeds STATS_MAX_DEV
+ *
+ *  requires:
+ *  - Value: frequency
+ *  - DecPlaces: decimal places of Value (0: Hz, 3: mHz)
+ *
+ *  returns:
+ *  - 1 if window is complete
+ *  - 0 if not
+ */
+
+uint8_t Stats_Add(uint32_t Value, uint8_t DecPlaces)
+{
+  int32_t           Dev;                /* deviation */
+
+  Dev = (int32_t)(Value - StatsFirst);  /* deviation from first sample */
+
+  /* check window */
+  if ((StatsN >= FREQ_STATS_WINDOW) || (DecPlaces != StatsDot) ||
+      (Dev > STATS_MAX_DEV) || (Dev < -STATS_MAX_DEV))
+  {
+    StatsN = 0;                    /* start new window */
+  }
+
+  if (StatsN == 0)                 /* new window */
+  {
+    StatsDot = DecPlaces;
+    StatsFirst = Value;            /* reference */
+    StatsMin = Value;
+    StatsMax = Value;
+    StatsSum = 0;
+    StatsSumSq = 0;
+    Dev = 0;
+  }
+
+  /* update min/max */
+  if (Value < StatsMin) StatsMin = Value;
+  if (Value > StatsMax) StatsMax = Value;
+
+  /* update sums */
+  StatsSum += Dev;
+  StatsSumSq += (uint32_t)(Dev * Dev);
+  StatsN++;
+
+  return (StatsN >= FREQ_STATS_WINDOW);
+}
+
+
+
+/*
+ *  display frequency with prefix
+ *
+ *  requires:
+ *  - Value: frequency
+ *  - DecPlaces: decimal places of Value (0: Hz, 3: mHz)
+ */
+
+void Stats_Value(uint32_t Value, uint8_t DecPlaces)
+{
+  unsigned char     Unit = 0;           /* prefix */
+
+  if (DecPlaces == 0)              /* Hz */
+  {
+    if (Value >= 1000000)          /* f >= 1MHz */
+    {
+      DecPlaces = 6;               /* 10^6 */
+      Unit = 'M';                  /* M for mega */
+    }
+    else if (Value >= 1000)        /* f >= 1kHz */
+    {
+      DecPlaces = 3;               /* 10^3 */
+      Unit = 'k';                  /* k for kilo */
+    }
+  }
+
+  Display_FullValue(Value, DecPlaces, Unit);
+  Display_EEString(Hertz_str);     /* display: Hz */
+}
+
+
+
+/*
+ *  display statistics of current window
+ *  - min, max, mean and standard deviation, one per line
+ *  - as many lines as the display provides
+ *  - sends "n,min,max,mean,sd" via TTL serial when the window is
+ *    complete (UI_SERIAL_COPY or UI_SERIAL_COMMANDS), values in Hz or mHz
+ *
+ *  requires:
+ *  - Line: first line
+ *  - Complete: 1 if window is complete
+ */
+
+void Stats_Show(uint8_t Line, uint8_t Complete)
+{
+  uint8_t           n = 0;              /* counter */
+  unsigned char     *String = NULL;     /* string pointer (EEPROM) */
+  uint32_t          Value = 0;          /* value */
+  uint32_t          Mean;               /* mean */
+  uint32_t          Dev;                /* standard deviation */
+  int32_t           Temp;               /* mean deviation */
+  #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+  uint8_t           Control;            /* output control */
+  #endif
+
+  /*
+   *  mean and standard deviation
+   *  - mean = first + sum(d) / n
+   *  - variance = sum(d^2) / n - (sum(d) / n)^2
+   */
+
+  Temp = StatsSum / (int32_t)StatsN;    /* mean deviation */
+  Mean = StatsFirst + Temp;
+  Dev = StatsSumSq / StatsN;
+  Dev -= (uint32_t)(Temp * Temp);       /* variance */
+  Dev = Stats_Sqrt(Dev);                /* standard deviation */
+
+  /* display values */
+  while ((n < 4) && (Line <= UI.CharMax_Y))
+  {
+    switch (n)
+    {
+      case 0:
+        String = (unsigned char *)StatsMin_str;
+        Value = StatsMin;
+        break;
+
+      case 1:
+        String = (unsigned char *)StatsMax_str;
+        Value = StatsMax;
+        break;
+
+      case 2:
+        String = (unsigned char *)StatsMean_str;
+        Value = Mean;
+        break;
+
+      case 3:
+        String = (unsigned char *)StatsDev_str;
+        Value = Dev;
+        break;
+    }
+
+    LCD_ClearLine(Line);                /* clear line */
+    Display_EEString_Space(String);     /* display name */
+    Stats_Value(Value, StatsDot);       /* display value */
+
+    Line++;                             /* next line */
+    n++;                                /* next value */
+  }
+
+  #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+  if (Complete)                    /* window complete */
+  {
+    /* send values via TTL serial (CSV) */
+    Control = Cfg.OP_Control;           /* save output control */
+    Cfg.OP_Control &= ~OP_OUT_LCD;      /* disable display output */
+    Cfg.OP_Control |= OP_OUT_SER;       /* enable serial output */
+
+    Display_FullValue(StatsN, 0, 0);
+    Display_Char(',');
+    Display_FullValue(StatsMin, 0, 0);
+    Display_Char(',');
+    Display_FullValue(StatsMax, 0, 0);
+    Display_Char(',');
+    Display_FullValue(Mean, 0, 0);
+    Display_Char(',');
+    Display_FullValue(Dev, 0, 0);
+    Serial_NewLine();
+
+    Cfg.OP_Control = Control;           /* restore output control */
+  }
+  #endif
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   simple frequency counter
  * ************************************************************************ */
@@ -115,6 +615,9 @@ ISR(TIMER1_COMPA_vect, ISR_BLOCK)
  *  basic frequency counter
  *  - frequency input: T0
  *  - requires idle sleep mode to keep timers running when MCU is sleeping
+ *  - continuous gating (FREQ_COUNTER_CONTINUOUS): Timer1 runs in CTC mode
+ *    and the ISR takes the pulse count at the end of each gate period
+ *    while Timer0 keeps counting
  */
 
 void FrequencyCounter(void)
@@ -127,6 +630,13 @@ void FrequencyCounter(void)
   uint16_t          GateTime;           /* gate time in ms */
   uint16_t          Top;                /* top value for timer */
   uint32_t          Value;              /* temporary value */
+  #ifdef FREQ_COUNTER_RECIPROCAL
+  uint8_t           Recip = 0;          /* reciprocal counting */
+  #endif
+  #ifdef FREQ_COUNTER_CONTINUOUS
+  uint8_t           Running = 0;        /* timers running for index */
+  #endif
+  uint16_t          Count;              /* pulses of gate period */
 
   /* local constants for Flag */
   #define RUN_FLAG       1         /* run flag */
@@ -150,6 +660,9 @@ void FrequencyCounter(void)
    */
 
   Flag = RUN_FLAG;            /* enter measurement loop */
+  #ifdef FREQ_COUNTER_STATS
+  StatsN = 0;                 /* reset statistics */
+  #endif
 
   /*
       auto ranging
@@ -170,6 +683,9 @@ void FrequencyCounter(void)
                        1000ms        256  <= 16MHz   <10k      
       10kHz-100kHz      100ms         64  all        1k-10k
       >100kHz            10ms          8  all        >1k (<50k)
+
+      With reciprocal counting (FREQ_COUNTER_RECIPROCAL) frequencies
+      below 10kHz are measured via their period instead.
    */
 
   /* start values for autoranging (assuming high frequency) */
@@ -193,6 +709,13 @@ void FrequencyCounter(void)
 
   while (Flag > 0)
   {
+    Flag = WAIT_FLAG;                   /* enter waiting loop */
+
+    #ifdef FREQ_COUNTER_CONTINUOUS
+    if (Running == 0)                   /* timers stopped */
+    {
+    #endif
+
     /* set up T0 as input (pin might be shared with display) */
     Old_DDR = COUNTER_DDR;              /* save current settings */
     COUNTER_DDR &= ~(1 << COUNTER_IN);  /* signal input */
@@ -212,17 +735,42 @@ void FrequencyCounter(void)
 
     /* start timers */
     Pulses = 0;                         /* reset pulse counter */
-    Flag = WAIT_FLAG;                   /* enter waiting loop */
-    TCNT0 = 0;                          /* Timer0: reset pulse counter */
-    TCNT1 = 0;                          /* Timer1: reset gate time counter */
-    OCR1A = Top;                        /* Timer1: set gate time */
-    TCCR1B = Bits;                      /* start Timer1: prescaler */
-    TCCR0B = (1 << CS02) | (1 << CS01); /* start Timer0: clock source T0 on falling edge */
+    #ifdef FREQ_COUNTER_RECIPROCAL
+    if (Recip)                          /* reciprocal counting */
+    {
+      Reciprocal_Start();               /* start period measurement */
+    }
+    else                                /* gated counting */
+    #endif
+    {
+      TCNT0 = 0;                          /* Timer0: reset pulse counter */
+      TCNT1 = 0;                          /* Timer1: reset gate time counter */
+      #ifdef FREQ_COUNTER_CONTINUOUS
+      GateTotal = 0;                      /* reset pulse count */
+      GateReady = 0;                      /* no result yet */
+      GateMode = 1;                       /* continuous gating */
+      OCR1A = Top - 1;                    /* Timer1: set gate time (CTC: top + 1) */
+      Bits |= (1 << WGM12);               /* Timer1: CTC mode */
+      Running = Index + 1;                /* timers running for current range */
+      #else
+      OCR1A = Top;                        /* Timer1: set gate time */
+      #endif
+      TCCR1B = Bits;                      /* start Timer1: prescaler */
+      TCCR0B = (1 << CS02) | (1 << CS01); /* start Timer0: clock source T0 on falling edge */
+    }
+
+    #ifdef FREQ_COUNTER_CONTINUOUS
+    }
+    #endif
 
     /* wait for timer1 or key press */
     while (Flag == WAIT_FLAG)
     {
+      #ifdef FREQ_COUNTER_CONTINUOUS
+      if ((TCCR1B == 0) || GateReady)   /* Timer1 stopped or gate result */
+      #else
       if (TCCR1B == 0)                  /* Timer1 stopped by ISR */
+      #endif
       {
         Flag = GATE_FLAG;               /* end loop and signal Timer1 event */
       }
@@ -238,8 +786,13 @@ void FrequencyCounter(void)
       }
     }
 
-    /* T0 pin might be shared with display */
-    COUNTER_DDR = Old_DDR;              /* restore old settings */
+    #ifdef FREQ_COUNTER_CONTINUOUS
+    if (Running == 0)                   /* timers stopped */
+    #endif
+    {
+      /* T0 pin might be shared with display */
+      COUNTER_DDR = Old_DDR;            /* restore old settings */
+    }
 
     Cfg.OP_Control &= ~OP_BREAK_KEY;    /* clear break signal (just in case) */
 
@@ -248,10 +801,40 @@ void FrequencyCounter(void)
      *  process measurement
      */
 
+    #ifdef FREQ_COUNTER_RECIPROCAL
+    if (Recip)                          /* reciprocal counting */
+    {
+      Value = Reciprocal_Result();      /* stop and get frequency (in mHz) */
+
+      if (Flag == GATE_FLAG)            /* got measurement */
+      {
+        /* prevent display of "0 Hz" */
+        if (Value) Flag = SHOW_FREQ;    /* display frequency */
+        else Flag = RUN_FLAG;           /* no signal or f too low */
+
+        /* above crossover frequency: back to gated counting (100ms) */
+        if (Value >= RECIP_MAX_FREQ * 1000)
+        {
+          Recip = 0;
+          Flag = RUN_FLAG;              /* don't display frequency */
+        }
+      }
+    }
+    #endif
+
     if (Flag == GATE_FLAG)              /* got measurement */
     {
+      #ifdef FREQ_COUNTER_CONTINUOUS
+      /* pulses of last gate period (buffered by ISR) */
+      cli();                            /* disable interrupts */
+      Count = GatePulses;               /* get pulses */
+      GateReady = 0;                    /* clear flag */
+      sei();                            /* enable interrupts */
+      #else
       /* total sum of pulses during gate period */
       Pulses += TCNT0;                  /* add counter of Timer0 */
+      Count = Pulses;                   /* get pulses */
+      #endif
 
       /*
        *  calculate frequency
@@ -260,13 +843,13 @@ void FrequencyCounter(void)
        *    with 10ms gate time max. 50k pulses
        */
 
-      Value = Pulses;                   /* number of pulses */
+      Value = Count;                    /* number of pulses */
       Value *= 1000;                    /* scale to ms */
       Value /= GateTime;                /* divide by gatetime (in ms) */
       Flag = SHOW_FREQ;                 /* display frequency */
 
       /* autoranging */
-      if (Pulses > 10000)               /* range overrun */
+      if (Count > 10000)                /* range overrun */
       {
         if (GateTime > 10)              /* upper range limit not reached yet */
         {
@@ -278,8 +861,16 @@ void FrequencyCounter(void)
           Flag = RUN_FLAG;              /* don't display frequency */
         }
       }
-      else if (Pulses < 1000)           /* range underrun */
+      else if (Count < 1000)            /* range underrun */
       {
+        #ifdef FREQ_COUNTER_RECIPROCAL
+        if (GateTime == 100)            /* f below crossover frequency */
+        {
+          Recip = 1;                    /* switch to reciprocal counting */
+          Flag = RUN_FLAG;              /* don't display frequency */
+        }
+        else
+        #endif
         if (GateTime < 1000)            /* lower range limit not reached yet */
         {
           GateTime *= 10;               /* 1ms -> 10ms -> 100ms -> 1000ms */
@@ -291,8 +882,24 @@ void FrequencyCounter(void)
         }
       }
 
+      #ifdef FREQ_COUNTER_CONTINUOUS
+      /* range changed: stop timers to restart with new settings */
+      #ifdef FREQ_COUNTER_RECIPROCAL
+      if ((Running != Index + 1) || Recip)
+      #else
+      if (Running != Index + 1)
+      #endif
+      {
+        TCCR1B = 0;                     /* disable Timer1 */
+        TCCR0B = 0;                     /* disable Timer0 */
+        GateMode = 0;                   /* single gate period */
+        Running = 0;                    /* signal restart */
+        COUNTER_DDR = Old_DDR;          /* restore old settings */
+      }
+      #endif
+
       /* prevent display of "0 Hz" */
-      if (Pulses == 0)                  /* no signal or f too low */
+      if (Count == 0)                   /* no signal or f too low */
       {
         Flag = RUN_FLAG;                /* don't display frequency */
       }
@@ -309,13 +916,57 @@ void FrequencyCounter(void)
 
     if (Flag == SHOW_FREQ)              /* valid frequency */
     {
-      Display_Value(Value, 0, 0);       /* display frequency */
+      #ifdef FREQ_COUNTER_RECIPROCAL
+      if (Recip)                        /* reciprocal counting */
+      {
+        Display_FullValue(Value, 3, 0); /* display frequency (in mHz) */
+      }
+      else                              /* gated counting */
+      #endif
+      {
+        Display_Value(Value, 0, 0);     /* display frequency */
+      }
       Display_EEString(Hertz_str);      /* display: Hz */
       Flag = RUN_FLAG;                  /* clear flag */
+
+      #ifdef SW_REMOTE_TOOLS
+      /* send record to remote host */
+      if (Tool_RecordStart())
+      {
+        #ifdef FREQ_COUNTER_RECIPROCAL
+        Tool_RecordField(Cmd_F_str, Value, Recip ? -3 : 0, 0);
+        #else
+        Tool_RecordField(Cmd_F_str, Value, 0, 0);
+        #endif
+        Display_EEString(Hertz_str);    /* send: Hz */
+        Tool_RecordEnd();
+      }
+      #endif
+
+      #ifdef FREQ_COUNTER_STATS
+      /* update statistics and display them in line #3 and up */
+      Test = 0;                         /* Hz */
+      #ifdef FREQ_COUNTER_RECIPROCAL
+      if (Recip) Test = 3;              /* mHz */
+      #endif
+      Test = Stats_Add(Value, Test);    /* add frequency */
+      Stats_Show(3, Test);              /* display statistics */
+      #endif
     }
     else                                /* invalid frequency */
     {
       Display_Minus();                  /* display: no value */
+      #ifdef FREQ_COUNTER_STATS
+      StatsN = 0;                       /* start new window */
+      #endif
+
+      #ifdef SW_REMOTE_TOOLS
+      /* send empty record to remote host (but not when exiting) */
+      if (Flag && Tool_RecordStart())
+      {
+        Tool_RecordEnd();
+      }
+      #endif
     }
   }
 
@@ -326,6 +977,18 @@ void FrequencyCounter(void)
 
   TIMSK0 = 0;                 /* disable all interrupts for Timer0 */
   TIMSK1 = 0;                 /* disable all interrupts for Timer1 */
+  #ifdef FREQ_COUNTER_RECIPROCAL
+  RecipMode = 0;              /* reset ISR mode */
+  #endif
+  #ifdef FREQ_COUNTER_CONTINUOUS
+  if (Running)                /* timers still running */
+  {
+    TCCR1B = 0;               /* disable Timer1 */
+    TCCR0B = 0;               /* disable Timer0 */
+    COUNTER_DDR = Old_DDR;    /* restore old settings */
+  }
+  GateMode = 0;               /* reset ISR mode */
+  #endif
 
   /* local constants for Flag */
   #undef RUN_FLAG
@@ -381,6 +1044,9 @@ void FrequencyCounter(void)
   uint32_t          MinPulses = 0;      /* minimim pulses for range */
 //  uint32_t          MaxPulses = 0;      /* maximum pulses for range */
   uint32_t          Value;              /* temporary value */
+  #ifdef FREQ_COUNTER_RECIPROCAL
+  uint8_t           Recip = 0;          /* reciprocal counting */
+  #endif
 
   /* local constants for Flag (bitfield) */
   #define RUN_FLAG            0b00000001     /* run flag */
@@ -429,6 +1095,9 @@ void FrequencyCounter(void)
       100kHz-1MHz    100ms         64  all             1:1  10k-100k
       >1MHz          100ms         64  all            16:1  >6250 (<500k)
                      100ms         64  all            32:1  >3125 (<500k)
+
+      With reciprocal counting (FREQ_COUNTER_RECIPROCAL) frequencies
+      below 10kHz are measured via their period in the lowest range.
    */
 
   /* set up control lines */
@@ -450,6 +1119,9 @@ void FrequencyCounter(void)
   Channel = 0;                     /* source channel: ext. frequency */
   Range = 2;                       /* start with highest range */
   Flag = RUN_FLAG | UPDATE_CHANNEL | UPDATE_RANGE;     /* set control flags */
+  #ifdef FREQ_COUNTER_STATS
+  StatsN = 0;                      /* reset statistics */
+  #endif
   #ifdef UI_QUARTZ_CRYSTAL
   Check.Symbol = SYMBOL_CRYSTAL;   /* set symbol ID */
   #endif
@@ -512,6 +1184,9 @@ void FrequencyCounter(void)
       Range = 2;                             /* select top range */
       Flag |= UPDATE_RANGE;                  /* update range */
       Flag &= ~(RESCAN_FLAG | SKIP_FREQ);    /* reset rescan */
+      #ifdef FREQ_COUNTER_STATS
+      StatsN = 0;                            /* start new window */
+      #endif
 
       Flag &= ~UPDATE_CHANNEL;          /* clear flag */
     }
@@ -558,6 +1233,11 @@ void FrequencyCounter(void)
           break;
       }
 
+      #ifdef FREQ_COUNTER_RECIPROCAL
+      /* reciprocal counting is used by the lowest range only */
+      if (Range > 0) Recip = 0;
+      #endif
+
       /* update Timer1 prescaler */
       Top = DATA_read_word(&T1_Prescaler_table[Index]);     /* prescaler value */
       Bits = DATA_read_byte(&T1_RegBits_table[Index]);      /* prescaler bits */
@@ -597,11 +1277,20 @@ void FrequencyCounter(void)
     /* start timers */
     Flag |= WAIT_FLAG;                  /* enter waiting loop */
     Pulses = 0;                         /* reset pulse counter */
-    TCNT0 = 0;                          /* Timer0: reset pulse counter */
-    TCNT1 = 0;                          /* Timer1: reset gate time counter */
-    OCR1A = Top;                        /* Timer1: set gate time */
-    TCCR1B = Bits;                      /* start Timer1: prescaler */
-    TCCR0B = (1 << CS02) | (1 << CS01); /* start Timer0: clock source T0 on falling edge */
+    #ifdef FREQ_COUNTER_RECIPROCAL
+    if (Recip)                          /* reciprocal counting */
+    {
+      Reciprocal_Start();               /* start period measurement */
+    }
+    else                                /* gated counting */
+    #endif
+    {
+      TCNT0 = 0;                          /* Timer0: reset pulse counter */
+      TCNT1 = 0;                          /* Timer1: reset gate time counter */
+      OCR1A = Top;                        /* Timer1: set gate time */
+      TCCR1B = Bits;                      /* start Timer1: prescaler */
+      TCCR0B = (1 << CS02) | (1 << CS01); /* start Timer0: clock source T0 on falling edge */
+    }
 
 
     /*
@@ -666,6 +1355,27 @@ void FrequencyCounter(void)
      *  process measurement
      */
 
+    #ifdef FREQ_COUNTER_RECIPROCAL
+    if (Recip)                          /* reciprocal counting */
+    {
+      Pulses = Reciprocal_Result();     /* stop and get frequency (in mHz) */
+
+      if (Flag & GATE_FLAG)             /* got measurement */
+      {
+        /* prevent display of "0 Hz" (no signal or f too low) */
+        if (Pulses)                     /* got signal */
+        {
+          Flag |= SHOW_FREQ;            /* show frequency */
+        }
+
+        /* rescan starting with top range */
+        Range = 2;                                /* change to top range */
+        Flag &= ~(GATE_FLAG | SKIP_FREQ);         /* reset flags */
+        Flag |= (UPDATE_RANGE | RESCAN_FLAG);     /* update range and rescan */
+      }
+    }
+    #endif
+
     if (Flag & GATE_FLAG)               /* got measurement */
     {
       /* total sum of pulses during gate period */
@@ -679,6 +1389,14 @@ void FrequencyCounter(void)
       {
         if (Range > 0)                  /* not lowest range yet */
         {
+          #ifdef FREQ_COUNTER_RECIPROCAL
+          /* 100ms gate time: f below crossover frequency */
+          if ((Range == 1) && (Pulses < (RECIP_MAX_FREQ / 10)))
+          {
+            Recip = 1;                  /* switch to reciprocal counting */
+          }
+          #endif
+
           Range--;                      /* change to lower range */
           Flag |= UPDATE_RANGE;         /* update range */
         }
@@ -751,30 +1469,79 @@ void FrequencyCounter(void)
 
       if (Flag & SHOW_FREQ)        /* valid frequency */
       {
-        /* determine prefix */
-        Test = 0;                  /* dot position */
-        Index = 0;                 /* unit char */
-
-        if (Pulses >= 1000000)     /* f >= 1MHz */
+        #ifdef FREQ_COUNTER_RECIPROCAL
+        if (Recip)                 /* reciprocal counting */
         {
-          Test = 6;                     /* 10^6 */
-          Index = 'M';                  /* M for mega */
+          /* display frequency (in mHz) */
+          Display_FullValue(Pulses, 3, 0);
         }
-        else if (Pulses >= 1000)   /* f >= 1kHz */
+        else                       /* gated counting */
+        #endif
         {
-          Test = 3;                     /* 10^3 */
-          Index = 'k';                  /* k for kilo */
-        }
+          /* determine prefix */
+          Test = 0;                /* dot position */
+          Index = 0;               /* unit char */
+
+          if (Pulses >= 1000000)   /* f >= 1MHz */
+          {
+            Test = 6;                   /* 10^6 */
+            Index = 'M';                /* M for mega */
+          }
+          else if (Pulses >= 1000) /* f >= 1kHz */
+          {
+            Test = 3;                   /* 10^3 */
+            Index = 'k';                /* k for kilo */
+          }
 
-        /* display frequency */
-        Display_FullValue(Pulses, Test, Index);
+          /* display frequency */
+          Display_FullValue(Pulses, Test, Index);
+        }
         Display_EEString(Hertz_str);    /* display: "Hz" */
 
         Flag &= ~SHOW_FREQ;             /* clear flag */
+
+        #ifdef SW_REMOTE_TOOLS
+        /* send record to remote host */
+        if (Tool_RecordStart())
+        {
+          #ifdef FREQ_COUNTER_RECIPROCAL
+          Tool_RecordField(Cmd_F_str, Pulses, Recip ? -3 : 0, 0);
+          #else
+          Tool_RecordField(Cmd_F_str, Pulses, 0, 0);
+          #endif
+          Display_EEString(Hertz_str);  /* send: Hz */
+          Tool_RecordEnd();
+        }
+        #endif
+
+        #ifdef FREQ_COUNTER_STATS
+        /* update statistics and display them below channel (and symbol) */
+        Test = 0;                       /* Hz */
+        #ifdef FREQ_COUNTER_RECIPROCAL
+        if (Recip) Test = 3;            /* mHz */
+        #endif
+        Test = Stats_Add(Pulses, Test); /* add frequency */
+        Index = 4;                      /* line #4 */
+        #ifdef UI_QUARTZ_CRYSTAL
+        if (Channel > 0) Index += UI.SymbolSize_Y;     /* skip symbol */
+        #endif
+        Stats_Show(Index, Test);        /* display statistics */
+        #endif
       }
       else                         /* invalid frequency */
       {
         Display_Minus();           /* display: no value */
+        #ifdef FREQ_COUNTER_STATS
+        StatsN = 0;                /* start new window */
+        #endif
+
+        #ifdef SW_REMOTE_TOOLS
+        /* send empty record to remote host (but not when exiting) */
+        if (Flag && Tool_RecordStart())
+        {
+          Tool_RecordEnd();
+        }
+        #endif
       }
 
       /* manage rescan */
@@ -793,6 +1560,9 @@ void FrequencyCounter(void)
 
   TIMSK0 = 0;                 /* disable all interrupts for Timer0 */
   TIMSK1 = 0;                 /* disable all interrupts for Timer1 */
+  #ifdef FREQ_COUNTER_RECIPROCAL
+  RecipMode = 0;              /* reset ISR mode */
+  #endif
 
   /* filter control lines which were in input mode */ 
   CtrlDir ^= (1 << COUNTER_CTRL_DIV) | (1 << COUNTER_CTRL_CH0) | (1 << COUNTER_CTRL_CH1);
@@ -819,215 +1589,618 @@ void FrequencyCounter(void)
  * ************************************************************************ */
 
 
-#ifdef HW_RING_TESTER
+#ifdef HW_RING_TESTER
+
+/*
+ *  ring tester (LOPT/FBT tester)
+ *  - uses frontend for ring detection
+ *  - counter input: T0
+ *  - control via probes (RING_TESTER_PROBES)
+ *    probe #1: +5V
+ *    probe #2: pulse output
+ *    probe #3: Gnd
+ *  - control via dedicated pin (RING_TESTER_PIN)
+ *    RINGTESTER_OUT: pulse output
+ *  - requires idle sleep mode to keep timers running when MCU is sleeping
+ */
+
+void RingTester(void)
+{
+  uint8_t           Flag;               /* loop control flag */
+  uint8_t           Test;               /* user feedback */
+  uint8_t           Old_DDR;            /* old DDR state */
+  #ifdef RING_TESTER_AUTO
+  uint8_t           Shots = 0;          /* number of shots */
+  uint16_t          Rings = 0;          /* average number of rings */
+  uint32_t          Sum = 0;            /* sum of rings */
+  #endif
+
+  /* local constants for Flag (bitfield) */
+  #define RUN_FLAG       1         /* run flag */
+  #define WAIT_FLAG      2         /* enter/run waiting loop */
+  #define GATE_FLAG      3         /* gatetime flag */
+  #define SHOW_RINGS     4         /* display rings */
+
+  /* show info */
+  LCD_Clear();                          /* clear display */
+  #ifdef UI_COLORED_TITLES
+    /* display: Ring Tester */
+    Display_ColoredEEString(RingTester_str, COLOR_TITLE);
+  #else
+    Display_EEString(RingTester_str);   /* display: Ring Tester */
+  #endif
+
+  #ifdef RING_TESTER_PROBES
+  ProbePinout(PROBES_RINGTESTER);       /* show probes used */
+  #endif
+
+  /*
+   *  working priciple:
+   *  - a shorted or bad inductor has a low Q value
+   *  - a trigger pulse causes a damped oscillation in a tank circuit
+   *  - the higher the inductor's Q the longer the oscillation lasts
+   *  - so we simply count the number of rings until the oscillation
+   *    fades away
+   */
+
+  /*
+   *  set up pulse output
+   */
+
+  #ifdef RING_TESTER_PIN
+  /* use dedicated pin */
+  RINGTESTER_PORT &= ~(1 << RINGTESTER_OUT);      /* low by default */
+  RINGTESTER_DDR |= (1 << RINGTESTER_OUT);        /* enable output */
+  #endif
+
+  #ifdef RING_TESTER_PROBES
+  /* set probes: probe #1 - Vcc / probe #2 - Rl - pulse out / probe #3 - Gnd */
+  R_PORT = 0;                                /* pull down probe #2 */
+  R_DDR = (1 << R_RL_2);                     /* enable Rl for probe #2 */
+  ADC_PORT = (1 << TP1);                     /* pull up #1, pull down #3 */
+  ADC_DDR = (1 << TP1) | (1 << TP3);         /* enable direct pull for #1 and #3 */
+  #endif
+
+
+  /*
+   *  We use Timer1 for the gate time and Timer0 to count rings.
+   *  Max. frequency for Timer0 is 1/4 of the MCU clock.
+   */
+
+  Flag = RUN_FLAG;            /* enter measurement loop */
+
+  /*
+      Fixed gate time of 10ms.
+
+      Timer1 top value (gate time)
+      - top = gatetime * MCU_cycles / prescaler 
+      - gate time in s
+      - MCU cycles per s
+      - top max. 2^16 - 1
+
+      Using prescaler 8:1 - register bits: (1 << CS11)
+   */
+
+  /* set up Timer0 (ring counter) */
+  TCCR0A = 0;                      /* normal mode (count up) */
+  TIFR0 = (1 << TOV0);             /* clear overflow flag */
+  TIMSK0 = (1 << TOIE0);           /* enable overflow interrupt */
+
+  /* set up Timer1 (gate time) */
+  TCCR1A = 0;                      /* normal mode (count up) */
+  TIFR1 = (1 << OCF1A);            /* clear output compare A match flag */
+  TIMSK1 = (1 << OCIE1A);          /* enable output compare A match interrupt */
+  /* top = gatetime * MCU_cycles / timer prescaler */
+  OCR1A = (uint16_t)((10000UL * MCU_CYCLES_PER_US) / 8);
+
+
+  /*
+   *  measurement loop
+   */
+
+  while (Flag > 0)
+  {
+    /* set up T0 as input (pin might be shared with display) */
+    Old_DDR = COUNTER_DDR;              /* save current settings */
+    COUNTER_DDR &= ~(1 << COUNTER_IN);  /* signal input */
+    wait500us();                        /* settle time */
+
+    /* start timers */
+    Pulses = 0;                         /* reset pulse counter */
+    Flag = WAIT_FLAG;                   /* enter waiting loop */
+    TCNT0 = 0;                          /* Timer0: reset ring counter */
+    TCNT1 = 0;                          /* Timer1: reset gate time counter */
+    TCCR1B = (1 << CS11);               /* start Timer1: prescaler 8:1 */
+    TCCR0B = (1 << CS02) | (1 << CS01); /* start Timer0: clock source T0 on falling edge */
+
+
+    /*
+     *  create trigger pulse (2 ms)
+     *  - will create one pseudo ring since timers are already running
+     */
+
+    #ifdef RING_TESTER_PIN
+    RINGTESTER_PORT |= (1 << RINGTESTER_OUT);     /* set pin high */
+    wait2ms();                                    /* wait 2 ms */
+    RINGTESTER_PORT &= ~(1 << RINGTESTER_OUT);    /* set pin low */
+    #endif
+
+    #ifdef RING_TESTER_PROBES
+    R_PORT = (1 << R_RL_2);             /* pull up probe #2 via Rl */
+    wait2ms();                          /* wait 2 ms */
+    R_PORT = 0;                         /* pull down probe #2 */
+    #endif
+
+    /* wait for timer1 or key press */
+    while (Flag == WAIT_FLAG)
+    {
+      if (TCCR1B == 0)                  /* Timer1 stopped by ISR */
+      {
+        Flag = GATE_FLAG;               /* end loop and signal Timer1 event */
+      }
+      else                              /* Timer1 still running */
+      {
+        /* wait for user feedback */
+        Test = TestKey(0, CHECK_KEY_TWICE | CHECK_BAT);
+
+        if (Test == KEY_TWICE)          /* two short key presses */
+        {
+          Flag = 0;                     /* end processing loop */
+        }
+      }
+    }
+
+    /* T0 pin might be shared with display */
+    COUNTER_DDR = Old_DDR;              /* restore old settings */
+
+    Cfg.OP_Control &= ~OP_BREAK_KEY;    /* clear break signal (just in case) */
+
+
+    /*
+     *  process measurement
+     */
+
+    if (Flag == GATE_FLAG)              /* got measurement */
+    {
+      /* total sum of rings during gate period */
+      Pulses += TCNT0;                  /* add counter of Timer0 */
+
+      /* consider first/pseudo ring created by trigger pulse */
+      if (Pulses > 0)                   /* sanity check */
+      {
+        Pulses--;                       /* subtract one ring */
+      }
+
+      Flag = SHOW_RINGS;                /* display rings */
+    }
+
+
+    /*
+     *  display number of rings (in line #2)
+     */
+
+    LCD_ClearLine2();                   /* clear line #2 */
+    Display_Char('n');                  /* display: n */
+    Display_Space();
+
+    if (Flag == SHOW_RINGS)             /* valid number of rings */
+    {
+      Display_Value(Pulses, 0, 0);      /* display rings */
+      Flag = RUN_FLAG;                  /* clear flag */
+
+      #ifdef RING_TESTER_AUTO
+      /*
+       *  average several shots and check against threshold
+       *  - display average and pass/fail in line #3
+       *  - threshold is stored in adjustment profile
+       */
+
+      Sum += Pulses;                    /* add rings */
+      Shots++;                          /* one more shot */
+
+      if (Shots >= RING_TESTER_SHOTS)   /* got all shots */
+      {
+        Rings = Sum / Shots;            /* average */
+        Sum = 0;                        /* reset sum */
+        Shots = 0;                      /* reset counter */
+
+        LCD_ClearLine3();               /* clear line #3 */
+        Display_Char('n');              /* display: n */
+        Display_Char('~');              /* display: ~ (average) */
+        Display_Space();
+        Display_Value(Rings, 0, 0);     /* display average */
+        Display_Space();
+
+        if (Rings >= NV.RingMin)        /* enough rings */
+        {
+          Display_EEString(RingPass_str);    /* display: pass */
+        }
+        else                            /* too few rings */
+        {
+          Display_EEString(RingFail_str);    /* display: fail */
+        }
+      }
+      #endif
+    }
+    else                                /* invalid number of rings */
+    {
+      Display_Minus();                  /* display: no value */
+    }
+
+
+    /*
+     *  add some delay to slow down the update rate
+     *  and to smooth the UI
+     */
+
+    #ifdef RING_TESTER_AUTO
+    /* check test button using configured pulse interval */
+    Test = TestKey(RING_TESTER_RATE, CHECK_KEY_TWICE | CHECK_BAT);
+    #else
+    /* check test button using a timeout of 400 ms */
+    Test = TestKey(400, CHECK_KEY_TWICE | CHECK_BAT);
+    #endif
+
+    /* catch double press for exit */
+    if (Test == KEY_TWICE)              /* two short key presses */
+    {
+      Flag = 0;                         /* end processing loop */
+    }
+    #ifdef RING_TESTER_AUTO
+    else if ((Test == KEY_LONG) && (Rings > 0))    /* long key press */
+    {
+      /*
+       *  teach threshold with known good part
+       *  - threshold: 75% of average number of rings
+       *  - offer to save threshold to adjustment profile
+       */
+
+      Sum = Rings - (Rings / 4);        /* 75% */
+      if (Sum > 255) Sum = 255;         /* limit to 8 bits */
+      NV.RingMin = (uint8_t)Sum;        /* set threshold */
+      AdjustmentMenu(STORAGE_SAVE);
+
+      /* show info again */
+      LCD_Clear();                      /* clear display */
+      #ifdef UI_COLORED_TITLES
+        /* display: Ring Tester */
+        Display_ColoredEEString(RingTester_str, COLOR_TITLE);
+      #else
+        Display_EEString(RingTester_str);    /* display: Ring Tester */
+      #endif
+
+      /* start new series */
+      Sum = 0;
+      Shots = 0;
+    }
+    #endif
+  }
+
+
+  /*
+   *  clean up
+   */
+
+  TIMSK0 = 0;                 /* disable all interrupts for Timer0 */
+  TIMSK1 = 0;                 /* disable all interrupts for Timer1 */
+
+  /* local constants for Flag */
+  #undef RUN_FLAG
+  #undef WAIT_FLAG
+  #undef GATE_FLAG
+  #undef SHOW_RINGS
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   crystal ringdown test
+ * ************************************************************************ */
+
+
+#ifdef CRYSTAL_RINGDOWN
+
+/* local constants */
+#define RING_BURST       8                    /* pulses of excitation burst */
+#define RING_SHOTS       4                    /* shots per measurement */
+#define RING_IDLE        (CPU_FREQ / 500)     /* end of ringdown: 2ms without edge (in MCU cycles) */
+#define RING_TIMEOUT     (CPU_FREQ * 2)       /* max. ringdown time: 2s (in MCU cycles) */
+
+/* counter steps per ring */
+#ifdef HW_FREQ_COUNTER_EXT
+  #define RING_DIV       FREQ_COUNTER_PRESCALER    /* frequency prescaler */
+#else
+  #define RING_DIV       1                         /* no prescaler */
+#endif
+
+
+/*
+ *  capture ringdown of a crystal
+ *  - excites crystal via probe #1 with a short pulse burst
+ *  - Timer0 counts rings on T0 and Timer1 runs at the MCU clock
+ *  - both timers are polled (incl. overflows) to timestamp the first
+ *    and the last change of the ring counter
+ *  - ringdown ends when there's no edge for RING_IDLE
+ *  - T0 has to be set up as input and probe #1 as output
+ *
+ *  requires:
+ *  - Periods: pointer to number of full periods (in counter steps)
+ *  - Ticks: pointer to time for those periods (in MCU cycles)
+ *
+ *  returns:
+ *  - number of rings (in counter steps)
+ */
+
+uint16_t Crystal_Ring(uint16_t *Periods, uint32_t *Ticks)
+{
+  uint16_t          Rings = 0;          /* ring counter */
+  uint16_t          First = 0;          /* ring counter at first timestamp */
+  uint16_t          Value;              /* current ring counter */
+  uint16_t          High0 = 0;          /* Timer0 overflows (* 256) */
+  uint16_t          High1 = 0;          /* Timer1 overflows */
+  uint16_t          Counter1;           /* Timer1 counter */
+  uint8_t           Counter0;           /* Timer0 counter */
+  uint8_t           n;                  /* counter */
+  uint32_t          Time;               /* timestamp */
+  uint32_t          Start = 0;          /* timestamp of first change */
+  uint32_t          Stop = 0;           /* timestamp of last change */
+
+  /* reset timers */
+  TCNT0 = 0;                       /* Timer0: reset ring counter */
+  TCNT1 = 0;                       /* Timer1: reset time counter */
+  TIFR0 = (1 << TOV0);             /* clear overflow flag */
+  TIFR1 = (1 << TOV1);             /* clear overflow flag */
+
+  /* excite crystal: pulse burst */
+  n = RING_BURST;
+  while (n > 0)
+  {
+    ADC_PORT = (1 << TP1);         /* set probe #1 high */
+    ADC_PORT = 0;                  /* set probe #1 low */
+    n--;
+  }
+
+  /* start timers after burst (count free oscillation only) */
+  TCCR1B = (1 << CS10);                 /* start Timer1: prescaler 1:1 */
+  TCCR0B = (1 << CS02) | (1 << CS01);   /* start Timer0: clock source T0 on falling edge */
+
+  while (1)
+  {
+    /* get ring counter */
+    if (TIFR0 & (1 << TOV0))            /* Timer0 overflow */
+    {
+      TIFR0 = (1 << TOV0);              /* clear flag */
+      High0 += 256;                     /* add overflow */
+    }
+    Counter0 = TCNT0;                   /* get Timer0 counter */
+    Value = High0 + Counter0;
+
+    /* consider overflow not processed yet */
+    if ((TIFR0 & (1 << TOV0)) && (Counter0 < 128))
+    {
+      Value += 256;
+    }
+
+    /* get timestamp */
+    if (TIFR1 & (1 << TOV1))            /* Timer1 overflow */
+    {
+      TIFR1 = (1 << TOV1);              /* clear flag */
+      High1++;                          /* add overflow */
+    }
+    Counter1 = TCNT1;                   /* get Timer1 counter */
+    Time = High1;
+
+    /* consider overflow not processed yet */
+    if ((TIFR1 & (1 << TOV1)) && (Counter1 < 0x8000))
+    {
+      Time++;
+    }
+
+    Time <<= 16;                        /* overflows are upper 16 bits */
+    Time |= Counter1;                   /* add counter */
+
+    if (Value != Rings)                 /* got new rings */
+    {
+      if (Rings == 0)                   /* first change */
+      {
+        Start = Time;
+        First = Value;
+      }
+
+      Stop = Time;                      /* last change */
+      Rings = Value;
+    }
+    else if ((Time - Stop) > RING_IDLE) /* no edge for a while */
+    {
+      break;                            /* ringdown ended */
+    }
+
+    /* prevent an overflow of the ring counter */
+    if ((Time > RING_TIMEOUT) || (High0 >= 0xFE00))
+    {
+      break;                            /* end measurement */
+    }
+  }
+
+  /* stop timers */
+  TCCR1B = 0;                      /* disable Timer1 */
+  TCCR0B = 0;                      /* disable Timer0 */
+
+  *Periods = Rings - First;        /* periods between timestamps */
+  *Ticks = Stop - Start;           /* time between timestamps */
+
+  return Rings;
+}
+
+
 
 /*
- *  ring tester (LOPT/FBT tester)
- *  - uses frontend for ring detection
- *  - counter input: T0
- *  - control via probes (RING_TESTER_PROBES)
- *    probe #1: +5V
- *    probe #2: pulse output
- *    probe #3: Gnd
- *  - control via dedicated pin (RING_TESTER_PIN)
- *    RINGTESTER_OUT: pulse output
- *  - requires idle sleep mode to keep timers running when MCU is sleeping
+ *  crystal ringdown test
+ *  - crystal between probe #1 (excitation) and counter input (T0)
+ *  - frequency: f = periods * f_MCU / ticks
+ *  - Q estimate: the amplitude decays with exp(-pi * f * t / Q),
+ *    so the number of rings until the amplitude drops below the
+ *    threshold of the counter input is n = Q / pi * ln(A0 / Vth)
+ *    -> Q = pi * n / ln(A0 / Vth)
  */
 
-void RingTester(void)
+void CrystalRingdown(void)
 {
-  uint8_t           Flag;               /* loop control flag */
+  uint8_t           Flag = 1;           /* loop control flag */
   uint8_t           Test;               /* user feedback */
   uint8_t           Old_DDR;            /* old DDR state */
-
-  /* local constants for Flag (bitfield) */
-  #define RUN_FLAG       1         /* run flag */
-  #define WAIT_FLAG      2         /* enter/run waiting loop */
-  #define GATE_FLAG      3         /* gatetime flag */
-  #define SHOW_RINGS     4         /* display rings */
+  uint8_t           n;                  /* counter */
+  #ifdef HW_FREQ_COUNTER_EXT
+  uint8_t           CtrlDir;            /* control DDR state */
+  #endif
+  uint16_t          Periods;            /* periods of single shot */
+  uint32_t          Ticks;              /* time of single shot */
+  uint32_t          SumPeriods;         /* sum of periods */
+  uint32_t          SumTicks;           /* sum of times */
+  uint32_t          SumRings;           /* sum of rings */
+  uint32_t          Value;              /* temporary value */
+  uint32_t          Rest;               /* remainder */
 
   /* show info */
   LCD_Clear();                          /* clear display */
   #ifdef UI_COLORED_TITLES
-    /* display: Ring Tester */
-    Display_ColoredEEString(RingTester_str, COLOR_TITLE);
+    /* display: Crystal Ringdown */
+    Display_ColoredEEString(CrystalRing_str, COLOR_TITLE);
   #else
-    Display_EEString(RingTester_str);   /* display: Ring Tester */
-  #endif
-
-  #ifdef RING_TESTER_PROBES
-  ProbePinout(PROBES_RINGTESTER);       /* show probes used */
-  #endif
-
-  /*
-   *  working priciple:
-   *  - a shorted or bad inductor has a low Q value
-   *  - a trigger pulse causes a damped oscillation in a tank circuit
-   *  - the higher the inductor's Q the longer the oscillation lasts
-   *  - so we simply count the number of rings until the oscillation
-   *    fades away
-   */
-
-  /*
-   *  set up pulse output
-   */
-
-  #ifdef RING_TESTER_PIN
-  /* use dedicated pin */
-  RINGTESTER_PORT &= ~(1 << RINGTESTER_OUT);      /* low by default */
-  RINGTESTER_DDR |= (1 << RINGTESTER_OUT);        /* enable output */
+    Display_EEString(CrystalRing_str);  /* display: Crystal Ringdown */
   #endif
 
-  #ifdef RING_TESTER_PROBES
-  /* set probes: probe #1 - Vcc / probe #2 - Rl - pulse out / probe #3 - Gnd */
-  R_PORT = 0;                                /* pull down probe #2 */
-  R_DDR = (1 << R_RL_2);                     /* enable Rl for probe #2 */
-  ADC_PORT = (1 << TP1);                     /* pull up #1, pull down #3 */
-  ADC_DDR = (1 << TP1) | (1 << TP3);         /* enable direct pull for #1 and #3 */
+  #ifdef HW_FREQ_COUNTER_EXT
+  /* set up control lines: buffered input and prescaler enabled */
+  CtrlDir = COUNTER_CTRL_DDR;           /* get current direction */
+  COUNTER_CTRL_PORT &= ~((1 << COUNTER_CTRL_CH1) | (1 << COUNTER_CTRL_CH0));
+  COUNTER_CTRL_PORT |= (1 << COUNTER_CTRL_DIV);
+  COUNTER_CTRL_DDR |= (1 << COUNTER_CTRL_DIV) | (1 << COUNTER_CTRL_CH0) | (1 << COUNTER_CTRL_CH1);
   #endif
 
+  /* set probes: probe #1 - low (excitation) / probes #2 and #3 - HiZ */
+  R_DDR = 0;                            /* disable probe resistors */
+  R_PORT = 0;
+  ADC_PORT = 0;                         /* pull down probe #1 */
+  ADC_DDR = (1 << TP1);                 /* enable direct pull for probe #1 */
 
-  /*
-   *  We use Timer1 for the gate time and Timer0 to count rings.
-   *  Max. frequency for Timer0 is 1/4 of the MCU clock.
-   */
-
-  Flag = RUN_FLAG;            /* enter measurement loop */
-
-  /*
-      Fixed gate time of 10ms.
-
-      Timer1 top value (gate time)
-      - top = gatetime * MCU_cycles / prescaler 
-      - gate time in s
-      - MCU cycles per s
-      - top max. 2^16 - 1
-
-      Using prescaler 8:1 - register bits: (1 << CS11)
-   */
-
-  /* set up Timer0 (ring counter) */
+  /* set up timers (polled, no interrupts) */
   TCCR0A = 0;                      /* normal mode (count up) */
-  TIFR0 = (1 << TOV0);             /* clear overflow flag */
-  TIMSK0 = (1 << TOIE0);           /* enable overflow interrupt */
-
-  /* set up Timer1 (gate time) */
+  TIMSK0 = 0;                      /* disable interrupts */
   TCCR1A = 0;                      /* normal mode (count up) */
-  TIFR1 = (1 << OCF1A);            /* clear output compare A match flag */
-  TIMSK1 = (1 << OCIE1A);          /* enable output compare A match interrupt */
-  /* top = gatetime * MCU_cycles / timer prescaler */
-  OCR1A = (uint16_t)((10000UL * MCU_CYCLES_PER_US) / 8);
+  TIMSK1 = 0;                      /* disable interrupts */
 
 
   /*
    *  measurement loop
    */
 
-  while (Flag > 0)
+  while (Flag)
   {
     /* set up T0 as input (pin might be shared with display) */
     Old_DDR = COUNTER_DDR;              /* save current settings */
     COUNTER_DDR &= ~(1 << COUNTER_IN);  /* signal input */
     wait500us();                        /* settle time */
 
-    /* start timers */
-    Pulses = 0;                         /* reset pulse counter */
-    Flag = WAIT_FLAG;                   /* enter waiting loop */
-    TCNT0 = 0;                          /* Timer0: reset ring counter */
-    TCNT1 = 0;                          /* Timer1: reset gate time counter */
-    TCCR1B = (1 << CS11);               /* start Timer1: prescaler 8:1 */
-    TCCR0B = (1 << CS02) | (1 << CS01); /* start Timer0: clock source T0 on falling edge */
-
-
-    /*
-     *  create trigger pulse (2 ms)
-     *  - will create one pseudo ring since timers are already running
-     */
-
-    #ifdef RING_TESTER_PIN
-    RINGTESTER_PORT |= (1 << RINGTESTER_OUT);     /* set pin high */
-    wait2ms();                                    /* wait 2 ms */
-    RINGTESTER_PORT &= ~(1 << RINGTESTER_OUT);    /* set pin low */
-    #endif
-
-    #ifdef RING_TESTER_PROBES
-    R_PORT = (1 << R_RL_2);             /* pull up probe #2 via Rl */
-    wait2ms();                          /* wait 2 ms */
-    R_PORT = 0;                         /* pull down probe #2 */
-    #endif
-
-    /* wait for timer1 or key press */
-    while (Flag == WAIT_FLAG)
+    /* take several shots */
+    SumPeriods = 0;
+    SumTicks = 0;
+    SumRings = 0;
+    n = RING_SHOTS;
+    while (n > 0)
     {
-      if (TCCR1B == 0)                  /* Timer1 stopped by ISR */
-      {
-        Flag = GATE_FLAG;               /* end loop and signal Timer1 event */
-      }
-      else                              /* Timer1 still running */
-      {
-        /* wait for user feedback */
-        Test = TestKey(0, CHECK_KEY_TWICE | CHECK_BAT);
-
-        if (Test == KEY_TWICE)          /* two short key presses */
-        {
-          Flag = 0;                     /* end processing loop */
-        }
-      }
+      SumRings += Crystal_Ring(&Periods, &Ticks);
+      SumPeriods += Periods;
+      SumTicks += Ticks;
+      MilliSleep(10);                   /* let rest of oscillation fade away */
+      n--;
     }
 
     /* T0 pin might be shared with display */
     COUNTER_DDR = Old_DDR;              /* restore old settings */
 
-    Cfg.OP_Control &= ~OP_BREAK_KEY;    /* clear break signal (just in case) */
-
 
     /*
-     *  process measurement
+     *  display frequency (in line #2)
      */
 
-    if (Flag == GATE_FLAG)              /* got measurement */
+    LCD_ClearLine2();                   /* clear line #2 */
+    Display_Char('f');                  /* display: f */
+    Display_Space();
+
+    if ((SumPeriods >= RING_SHOTS) && (SumTicks > 0))   /* valid */
     {
-      /* total sum of rings during gate period */
-      Pulses += TCNT0;                  /* add counter of Timer0 */
+      /*
+       *  f = periods * prescaler * f_MCU / ticks
+       *  - periods * (f_MCU / 1000) * 1000 / ticks
+       *  - scale down periods and ticks to prevent an overflow
+       *  - long division with decimal steps for the last factor
+       */
 
-      /* consider first/pseudo ring created by trigger pulse */
-      if (Pulses > 0)                   /* sanity check */
+      Value = SumPeriods * RING_DIV;    /* rings */
+      while (Value > (UINT32_MAX / (CPU_FREQ / 1000)))
       {
-        Pulses--;                       /* subtract one ring */
+        Value /= 2;
+        SumTicks /= 2;
       }
 
-      Flag = SHOW_RINGS;                /* display rings */
+      Value *= (CPU_FREQ / 1000);       /* * f_MCU in kHz */
+      Rest = Value % SumTicks;          /* remainder */
+      Value /= SumTicks;                /* integer part (in kHz) */
+
+      n = 3;                            /* 10^3 */
+      while (n > 0)
+      {
+        Rest *= 10;                     /* next decimal place */
+        Value *= 10;
+        Value += Rest / SumTicks;
+        Rest %= SumTicks;
+        n--;
+      }
+
+      Display_Value(Value, 0, 0);       /* display frequency */
+      Display_EEString(Hertz_str);      /* display: Hz */
+    }
+    else                                /* no oscillation */
+    {
+      Display_Minus();                  /* display: no value */
     }
 
 
     /*
-     *  display number of rings (in line #2)
+     *  display rings and Q (in line #3)
      */
 
-    LCD_ClearLine2();                   /* clear line #2 */
+    LCD_ClearLine3();                   /* clear line #3 */
     Display_Char('n');                  /* display: n */
     Display_Space();
 
-    if (Flag == SHOW_RINGS)             /* valid number of rings */
-    {
-      Display_Value(Pulses, 0, 0);      /* display rings */
-      Flag = RUN_FLAG;                  /* clear flag */
-    }
-    else                                /* invalid number of rings */
+    /* average number of rings */
+    Value = SumRings * RING_DIV / RING_SHOTS;
+    Display_Value(Value, 0, 0);         /* display rings */
+
+    if (SumPeriods >= RING_SHOTS)       /* got oscillation */
     {
-      Display_Minus();                  /* display: no value */
+      /* Q = pi * n / ln(A0 / Vth) */
+      Value *= 314;                     /* pi * 100 */
+      Value /= CRYSTAL_RING_LN;         /* ln(A0 / Vth) * 100 */
+
+      Display_Space();
+      Display_Char('Q');                /* display: Q */
+      Display_Char('~');                /* display: ~ (estimate) */
+      Display_Value(Value, 0, 0);       /* display Q */
     }
 
 
     /*
-     *  add some delay to slow down the update rate
-     *  and to smooth the UI
+     *  user feedback
      */
 
     /* check test button using a timeout of 400 ms */
     Test = TestKey(400, CHECK_KEY_TWICE | CHECK_BAT);
 
-    /* catch double press for exit */
     if (Test == KEY_TWICE)              /* two short key presses */
     {
       Flag = 0;                         /* end processing loop */
@@ -1039,16 +2212,26 @@ void RingTester(void)
    *  clean up
    */
 
-  TIMSK0 = 0;                 /* disable all interrupts for Timer0 */
-  TIMSK1 = 0;                 /* disable all interrupts for Timer1 */
+  /* set probes to HiZ */
+  ADC_DDR = 0;
+  ADC_PORT = 0;
 
-  /* local constants for Flag */
-  #undef RUN_FLAG
-  #undef WAIT_FLAG
-  #undef GATE_FLAG
-  #undef SHOW_RINGS
+  #ifdef HW_FREQ_COUNTER_EXT
+  /* disable prescaler and restore control lines */
+  COUNTER_CTRL_PORT &= ~(1 << COUNTER_CTRL_DIV);
+  CtrlDir ^= (1 << COUNTER_CTRL_DIV) | (1 << COUNTER_CTRL_CH0) | (1 << COUNTER_CTRL_CH1);
+  CtrlDir &= (1 << COUNTER_CTRL_DIV) | (1 << COUNTER_CTRL_CH0) | (1 << COUNTER_CTRL_CH1);
+  COUNTER_CTRL_DDR &= ~CtrlDir;         /* set former direction */
+  #endif
 }
 
+/* clean up local constants */
+#undef RING_BURST
+#undef RING_SHOTS
+#undef RING_IDLE
+#undef RING_TIMEOUT
+#undef RING_DIV
+
 #endif
 
 
@@ -1075,6 +2258,10 @@ ISR(TIMER1_COMPB_vect, ISR_BLOCK)
    *    (no nested interrupts)
    */
 
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_TIMER1]++;   /* count ISR call */
+  #endif
+
   /* time ticks */
   TimeTicks++;                     /* got another tick */
   if (TimeTicks >= 5)              /* 5 ticks = 1 second */
@@ -1083,6 +2270,10 @@ ISR(TIMER1_COMPB_vect, ISR_BLOCK)
     TimeCounter++;                 /* got another second */
   }
 
+  #ifdef EVENT_COUNTER_LOG
+  LogBase += OCR1A + 1;            /* time base for event log */
+  #endif
+
   TIFR1 = (1 << OCF1A);                 /* clear output compare A match flag */
 
   /* break TestKey() processing */
@@ -1091,6 +2282,157 @@ ISR(TIMER1_COMPB_vect, ISR_BLOCK)
 
 
 
+#ifdef EVENT_COUNTER_LOG
+
+/*
+ *  send event log
+ *  - inter-event times in s, oldest first, separated by commas
+ *  - the first time refers to the start of counting or to an event
+ *    already overwritten in the ring buffer
+ *  - 65535 ticks mean "or longer"
+ *  - output goes to the currently selected channels
+ *
+ *  returns:
+ *  - number of entries sent (0 if log is empty)
+ */
+
+uint8_t EventLog_Send(void)
+{
+  uint8_t           n;                  /* counter */
+  uint8_t           Pos;                /* log position */
+  uint32_t          Value;              /* time */
+
+  /* oldest entry */
+  Pos = EVENT_LOG_SIZE + LogIndex - LogCount;
+  if (Pos >= EVENT_LOG_SIZE) Pos -= EVENT_LOG_SIZE;
+
+  n = 0;
+  while (n < LogCount)
+  {
+    if (n > 0) Display_Char(',');       /* separator */
+
+    /* Timer1 ticks (prescaler 1:64) -> s */
+    Value = EventLog[Pos];
+    Value *= 64;
+    Value /= MCU_CYCLES_PER_US;
+    Display_FullValue(Value, 0, 0);     /* send time */
+
+    Pos++;                              /* next position */
+    if (Pos >= EVENT_LOG_SIZE) Pos = 0; /* ring buffer */
+    n++;
+  }
+
+  return LogCount;
+}
+
+
+
+/*
+ *  display histogram of event log (events over time)
+ *  - splits time span of log into bins (one line per bin)
+ *  - line #1: time per bin
+ *  - bins: bar and number of events
+ *  - waits for key press
+ */
+
+void EventLog_Histogram(void)
+{
+  uint8_t           Bins[LOG_BINS];     /* events per bin */
+  uint8_t           n;                  /* counter */
+  uint8_t           Pos;                /* log position */
+  uint8_t           Lines;              /* number of bins */
+  uint8_t           Max = 1;            /* max. events per bin */
+  uint8_t           Width;              /* max. bar width */
+  uint8_t           Bar;                /* bar length */
+  uint32_t          Span = 0;           /* time span (Timer1 ticks) */
+  uint32_t          Time;               /* time */
+  uint32_t          Step;               /* time per bin (Timer1 ticks) */
+
+  if (LogCount < 2) return;        /* not enough events */
+
+  /* number of bins: use all lines below title */
+  Lines = UI.CharMax_Y - 1;
+  if (Lines > LOG_BINS) Lines = LOG_BINS;
+  if (Lines == 0) return;          /* sanity check */
+
+  /* time span: sum of times, oldest entry is the reference */
+  Pos = EVENT_LOG_SIZE + LogIndex - LogCount;
+  if (Pos >= EVENT_LOG_SIZE) Pos -= EVENT_LOG_SIZE;
+  n = 1;
+  while (n < LogCount)
+  {
+    Pos++;
+    if (Pos >= EVENT_LOG_SIZE) Pos = 0;
+    Span += EventLog[Pos];
+    n++;
+  }
+
+  Step = Span / Lines + 1;         /* time per bin */
+
+  /* count events per bin */
+  n = 0;
+  while (n < Lines)                /* clear bins */
+  {
+    Bins[n] = 0;
+    n++;
+  }
+
+  Pos = EVENT_LOG_SIZE + LogIndex - LogCount;
+  if (Pos >= EVENT_LOG_SIZE) Pos -= EVENT_LOG_SIZE;
+  Time = 0;
+  n = 0;
+  while (n < LogCount)
+  {
+    if (n > 0) Time += EventLog[Pos];   /* time of event */
+    Bar = Time / Step;                  /* bin */
+    Bins[Bar]++;                        /* one event more */
+    if (Bins[Bar] > Max) Max = Bins[Bar];
+
+    Pos++;
+    if (Pos >= EVENT_LOG_SIZE) Pos = 0;
+    n++;
+  }
+
+  /* display time per bin (in line #1) */
+  LCD_Clear();
+  Display_Char('t');
+  Display_Space();
+  /* Timer1 ticks (prescaler 1:64) -> s */
+  Time = Step * 64;
+  Time /= MCU_CYCLES_PER_US;
+  Display_Value(Time, -6, 's');
+
+  /* display bins (in line #2 and up) */
+  Width = UI.CharMax_X - 4;        /* leave space for number of events */
+  n = 0;
+  while (n < Lines)
+  {
+    LCD_CharPos(1, n + 2);              /* go to start of line */
+
+    /* bar scaled to max. events per bin */
+    Bar = ((uint16_t)Bins[n] * Width) / Max;
+    if ((Bar == 0) && Bins[n]) Bar = 1; /* show at least one char */
+    while (Bar > 0)
+    {
+      Display_Char('*');
+      Bar--;
+    }
+
+    Display_Space();
+    Display_FullValue(Bins[n], 0, 0);   /* display events of bin */
+
+    n++;                                /* next bin */
+  }
+
+  /* wait for key press */
+  SmoothLongKeyPress();            /* wait until key is released */
+  TestKey(0, CURSOR_BLINK | CHECK_BAT);
+}
+
+#endif
+
+
+
 /*
  *  event counter
  *  - counter input: T0
@@ -1099,6 +2441,8 @@ ISR(TIMER1_COMPB_vect, ISR_BLOCK)
  *    display with more than 5 lines
  *  - requires idle sleep mode to keep timers running when MCU is sleeping
  *  - requires MCU clock of 8, 16 or 20MHz
+ *  - log mode (EVENT_COUNTER_LOG): each event triggers the Timer0 ISR
+ *    which logs the time since the last event (Timer1 with 1:64)
  */
 
 void EventCounter(void)
@@ -1129,6 +2473,7 @@ void EventCounter(void)
   #define MODE_COUNT          1         /* count events and time (start/stop) */
   #define MODE_TIME           2         /* count events during given time period */
   #define MODE_EVENTS         3         /* count time for given number of events */
+  #define MODE_LOG            4         /* count events and log inter-event times */
 
   /* local constants for Item */
   #define UI_COUNTERMODE      1         /* counter mode */
@@ -1195,6 +2540,7 @@ void EventCounter(void)
    */
 
   #define TOP       (CPU_FREQ / (5 * 256)) - 1
+  #define TOP_LOG   (CPU_FREQ / (5 * 64)) - 1   /* log mode: prescaler 1:64 */
 
   /* set up Timer0 (event counter) */
   TCCR0A = 0;                      /* normal mode (count up) */
@@ -1244,9 +2590,36 @@ void EventCounter(void)
       TCNT0 = 0;                   /* Timer0: reset event/pulse counter */
       TCNT1 = 0;                   /* Timer1: reset time counter */      
 
+      #ifdef EVENT_COUNTER_LOG
+      if (CounterMode == MODE_LOG)      /* log mode */
+      {
+        /* reset log */
+        LogIndex = 0;
+        LogCount = 0;
+        LogBase = 0;
+        LogLast = 0;
+        LogMode = 1;                    /* Timer0 overflow is event */
+        TCNT0 = 0xFF;                   /* overflow with next edge */
+        OCR1B = TOP_LOG;                /* set top value for time tick */
+        OCR1A = TOP_LOG;                /* same for CTC */
+        /* prescaler 1:64, CTC mode */
+        Temp = (1 << CS11) | (1 << CS10) | (1 << WGM12);
+      }
+      else                              /* other modes */
+      {
+        OCR1B = TOP;                    /* set top value for time tick */
+        OCR1A = TOP;                    /* same for CTC */
+        /* prescaler 1:256, CTC mode */
+        Temp = (1 << CS12) | (1 << WGM12);
+      }
+
+      /* start counters */
+      TCCR1B = Temp;               /* start Timer1 */
+      #else
       /* start counters */
       /* start Timer1: prescaler 1:256, CTC mode */
       TCCR1B = (1 << CS12) | (1 << WGM12);
+      #endif
       /* start Timer0: clock source T0 on rising edge */
       TCCR0B = (1 << CS02) | (1 << CS01) | (1 << CS00);
 
@@ -1273,6 +2646,9 @@ void EventCounter(void)
 
       /* events: get current value */
       Events = Pulses;                  /* get pulses */
+      #ifdef EVENT_COUNTER_LOG
+      if (! LogMode)                    /* not in log mode */
+      #endif
       Events += TCNT0;                  /* add counter */
 
       /* prevent overflow */
@@ -1324,6 +2700,40 @@ void EventCounter(void)
       R_PORT = 0;                  /* pull down probe #2 via Rl */
       #endif
 
+      #ifdef EVENT_COUNTER_LOG
+      if (LogMode)                 /* log mode */
+      {
+        LogMode = 0;               /* back to pulse counting */
+        Events = Pulses;           /* get final value */
+
+        #ifdef UI_SERIAL_COPY
+        /* send log via TTL serial */
+        Temp = Cfg.OP_Control;          /* save output control */
+        Cfg.OP_Control &= ~OP_OUT_LCD;  /* disable display output */
+        Cfg.OP_Control |= OP_OUT_SER;   /* enable serial output */
+        Serial_NewLine();
+        EventLog_Send();                /* send log */
+        Serial_NewLine();
+        Cfg.OP_Control = Temp;          /* restore output control */
+        #endif
+
+        /* show histogram and redraw screen */
+        if (LogCount >= 2)              /* got log */
+        {
+          EventLog_Histogram();         /* display histogram */
+
+          LCD_Clear();                  /* clear display */
+          #ifdef UI_COLORED_TITLES
+            /* display: Event Counter */
+            Display_ColoredEEString(EventCounter_str, COLOR_TITLE);
+          #else
+            Display_EEString(EventCounter_str);   /* display: Event Counter */
+          #endif
+          Show |= SHOW_MODE;            /* display everything */
+        }
+      }
+      #endif
+
       /* flags are reset later on to allow output of results */
 
       /* display current values for events and time */
@@ -1350,6 +2760,12 @@ void EventCounter(void)
         case MODE_EVENTS:               /* given number of events */
           String = (unsigned char *)Events_str;
           break;
+
+        #ifdef EVENT_COUNTER_LOG
+        case MODE_LOG:                  /* log inter-event times */
+          String = (unsigned char *)Log_str;
+          break;
+        #endif
       }
 
       /* display mode (in line #2) */
@@ -1520,7 +2936,11 @@ void EventCounter(void)
             Item++;                     /* next one */
 
             /* special rules */
+            #ifdef EVENT_COUNTER_LOG
+            if ((CounterMode == MODE_COUNT) || (CounterMode == MODE_LOG))
+            #else
             if (CounterMode == MODE_COUNT)        /* counter mode */
+            #endif
             {
               /* skip events and time */
               if (Item < UI_STARTSTOP) Item = UI_STARTSTOP;
@@ -1595,7 +3015,11 @@ void EventCounter(void)
           /* change to next mode */
           CounterMode++;
           /* overrun to first mode */
+          #ifdef EVENT_COUNTER_LOG
+          if (CounterMode > MODE_LOG) CounterMode = MODE_COUNT;
+          #else
           if (CounterMode > MODE_EVENTS) CounterMode = MODE_COUNT;
+          #endif
 
           Flag &= ~WAIT_FLAG;           /* end waiting loop */
         }
@@ -1625,7 +3049,11 @@ void EventCounter(void)
           /* change to previous mode */
           CounterMode--;
           /* underrun to last mode */
+          #ifdef EVENT_COUNTER_LOG
+          if (CounterMode == 0) CounterMode = MODE_LOG;
+          #else
           if (CounterMode == 0) CounterMode = MODE_EVENTS;
+          #endif
 
           Flag &= ~WAIT_FLAG;           /* end waiting loop */
         }
@@ -1659,9 +3087,13 @@ void EventCounter(void)
   /* timers */
   TIMSK0 = 0;                 /* disable all interrupts for Timer0 */
   TIMSK1 = 0;                 /* disable all interrupts for Timer1 */
+  #ifdef EVENT_COUNTER_LOG
+  LogMode = 0;                /* reset ISR mode */
+  #endif
 
   /* local constant for timer1 */
   #undef TOP
+  #undef TOP_LOG
 
   /* local constants for Flag */
   #undef RUN_FLAG
@@ -1676,6 +3108,7 @@ void EventCounter(void)
   #undef MODE_COUNT
   #undef MODE_TIME
   #undef MODE_EVENTS
+  #undef MODE_LOG
 
   /* local constants for Item */
   #undef UI_COUNTERMODE
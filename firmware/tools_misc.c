@@ -28,12 +28,142 @@
 #include "colors.h"           /* color definitions */
 
 
+/*
+ *  local variables
+ */
+
+/* measurement history */
+#ifdef SW_HISTORY
+History_Type             History[HISTORY_SIZE];  /* ring buffer */
+uint8_t                  HistIndex = 0; /* next record position */
+uint8_t                  HistCount = 0; /* number of records */
+uint16_t                 HistNumber = 0;     /* total number of records */
+#endif
+
+/* comparator edge detection */
+#ifdef FUNC_COMP_EDGE
+volatile uint8_t         CompFlags;     /* state flags */
+volatile uint16_t        CompEdges;     /* number of edges */
+#endif
+
+
 
 /* ************************************************************************
  *   support functions
  * ************************************************************************ */
 
 
+#ifdef FUNC_COMP_EDGE
+
+/*
+ *  ISR for analog comparator
+ *  - triggered by both edges (toggle mode)
+ *  - latches direction and counts edges
+ *  - input below bandgap: switches on active buzzer if requested
+ */
+
+ISR(ANALOG_COMP_vect, ISR_BLOCK)
+{
+  /*
+   *  hints:
+   *  - the ACI interrupt flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  CompEdges++;                     /* another edge */
+
+  if (ACSR & (1 << ACO))           /* input below bandgap */
+  {
+    CompFlags |= COMP_EDGE_LOW;    /* latch falling edge */
+
+    #ifdef BUZZER_ACTIVE
+    if (CompFlags & COMP_EDGE_BUZZER)
+    {
+      /* enable buzzer */
+      BUZZER_PORT |= (1 << BUZZER_CTRL);  /* set pin high */
+    }
+    #endif
+  }
+  else                             /* input above bandgap */
+  {
+    CompFlags |= COMP_EDGE_HIGH;   /* latch rising edge */
+
+    #ifdef BUZZER_ACTIVE
+    if (CompFlags & COMP_EDGE_BUZZER)
+    {
+      /* disable buzzer */
+      BUZZER_PORT &= ~(1 << BUZZER_CTRL); /* set pin low */
+    }
+    #endif
+  }
+}
+
+
+
+/*
+ *  arm analog comparator for edge detection
+ *  - compares ADC channel with bandgap reference
+ *  - disables ADC (comparator uses ADC multiplexer)
+ *  - resets edge counter and latched edges
+ *
+ *  requires:
+ *  - Channel: ADC MUX input channel
+ *  - Mode: COMP_EDGE_BUZZER to switch active buzzer, or 0
+ */
+
+void Comparator_Arm(uint8_t Channel, uint8_t Mode)
+{
+  CompFlags = Mode;                     /* set mode, reset edges */
+  CompEdges = 0;                        /* reset counter */
+
+  /* set up analog comparator */
+  ADCSRA = ADC_CLOCK_DIV;               /* disable ADC, but keep clock dividers */
+  ADCSRB = (1 << ACME);                 /* use ADC multiplexer as negative input */
+  ADMUX = ADC_REF_VCC | Channel;        /* switch ADC multiplexer to channel */
+  ACSR = (1 << ACBG);                   /* use bandgap as positive input */
+  wait100us();                          /* time for bandgap to settle */
+
+  /* clear flag and enable interrupt for both edges */
+  ACSR = (1 << ACBG) | (1 << ACI) | (1 << ACIE);
+}
+
+
+
+/*
+ *  disarm analog comparator and enable ADC again
+ */
+
+void Comparator_Disarm(void)
+{
+  ACSR = (1 << ACI);                    /* disable interrupt and clear flag */
+  ADCSRB &= ~(1 << ACME);     /* disable ADC multiplexer as negative input */
+  ADCSRA = (1 << ADEN) | (1 << ADIF) | ADC_CLOCK_DIV;    /* enable ADC */
+}
+
+
+
+/*
+ *  check battery ahead of schedule
+ *  - TestKey() can't check the battery while the comparator runs,
+ *    since the ADC is disabled
+ */
+
+void Comparator_CheckBattery(void)
+{
+  #ifndef BAT_NONE
+  if (Cfg.BatTimer <= 2)           /* check is about due */
+  {
+    CheckBattery();                /* check battery */
+                                   /* also resets BatTimer */
+  }
+  #endif
+}
+
+#endif
+
+
+
 #ifdef FUNC_PROBE_PINOUT
 
 /*
@@ -81,7 +211,7 @@ void ProbePinout(uint8_t Mode)
       break;
     #endif
 
-    #if defined (SW_MONITOR_R) || defined (SW_MONITOR_C) || defined (SW_MONITOR_L) || defined(SW_MONITOR_RCL) || defined(SW_MONITOR_RL)
+    #if defined (SW_MONITOR_R) || defined (SW_MONITOR_C) || defined (SW_MONITOR_L) || defined(SW_MONITOR_RCL) || defined(SW_MONITOR_RL) || defined (SW_LED_BINNING)
     case PROBES_RCL:
       /* probe #1: * / probe #3: * */
       Char1 = '*';
@@ -120,11 +250,154 @@ void ProbePinout(uint8_t Mode)
 
 
 
+#ifdef UI_MONITOR_GRAPH
+
+/*
+ *  init graph of monitor
+ *  - reference is taken from the first reading
+ *
+ *  requires:
+ *  - Graph: pointer to graph data
+ */
+
+void Graph_Init(Graph_Type *Graph)
+{
+  Graph->Pos = GRAPH_SAMPLES - 1;       /* first sample goes to 0 */
+  Graph->Count = 0;                     /* no samples yet */
+  Graph->Ref = 0;                       /* no reference yet */
+
+  LCD_GraphInit();                      /* clear graph area */
+}
+
+
+
+/*
+ *  add reading to graph of monitor and update display
+ *  - linear scale, reference value is at half scale (level 128)
+ *  - values above twice the reference are clipped
+ *  - first reading after an init or reset of the reference (Ref = 0)
+ *    becomes the new reference
+ *
+ *  requires:
+ *  - Graph: pointer to graph data
+ *  - Value: reading (0 for no reading)
+ *  - Scale: exponent of factor (value * 10^x)
+ */
+
+void Graph_Add(Graph_Type *Graph, uint32_t Value, int8_t Scale)
+{
+  uint8_t           Level = 0;          /* level of reading */
+  uint8_t           Pos;                /* position in ring buffer */
+  uint32_t          Ref;                /* reference value */
+
+  if (Value > 0)                        /* got reading */
+  {
+    if (Graph->Ref == 0)                /* no reference yet */
+    {
+      Graph->Ref = Value;               /* take reading */
+      Graph->Scale = Scale;
+    }
+
+    Ref = Graph->Ref;
+
+    if (CmpValue(Value, Scale, Ref * 2, Graph->Scale) >= 0)
+    {
+      Level = 255;                      /* clip */
+    }
+    else
+    {
+      /* rescale to reference (< 2 * Ref) */
+      Value = RescaleValue(Value, Scale, Graph->Scale);
+
+      /* prevent overflow */
+      while (Ref > 1000000)
+      {
+        Ref /= 10;
+        Value /= 10;
+      }
+
+      Value *= 128;                     /* half scale is reference */
+      Value /= Ref;
+      Level = (uint8_t)Value;
+    }
+  }
+
+  /* save level in ring buffer */
+  Pos = (Graph->Pos + 1) & (GRAPH_SAMPLES - 1);
+  Graph->Pos = Pos;
+  Graph->Buffer[Pos] = Level;
+  if (Graph->Count == 0)                /* first sample */
+  {
+    /* no segment to previous sample */
+    Graph->Buffer[(Pos - 1) & (GRAPH_SAMPLES - 1)] = Level;
+    Graph->Count = 1;
+  }
+
+  /* update display */
+  LCD_GraphBar(Level);
+  LCD_GraphTrend(Graph->Buffer, Pos);
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   Zener tool / external voltage
  * ************************************************************************ */
 
 
+#ifdef ZENER_AUTO_HOLD
+
+/*
+ *  local constants for auto hold
+ */
+
+#ifndef ZENER_DIVIDER_CUSTOM
+  #define ZENER_SETTLE_TOLER  2         /* max. change in 10mV */
+#else
+  #define ZENER_SETTLE_TOLER  20        /* max. change in mV */
+#endif
+#define ZENER_SETTLE_RUNS     3         /* stable readings (30ms each) */
+#define ZENER_BOOST_RUNS      (ZENER_BOOST_TIMEOUT / 30)  /* timeout */
+
+
+
+/*
+ *  switch boost converter for Zener tool
+ *
+ *  requires:
+ *  - State: 0 for off / 1 for on
+ */
+
+void Zener_Boost(uint8_t State)
+{
+  if (State)                  /* turn on */
+  {
+    #ifdef ZENER_BOOST_HIGH
+      /* high active */
+      BOOST_PORT |= (1 << BOOST_CTRL);        /* set pin high */
+    #else
+      /* low active */
+      BOOST_PORT &= ~(1 << BOOST_CTRL);       /* set pin low */
+    #endif
+  }
+  else                        /* turn off */
+  {
+    #ifdef ZENER_BOOST_HIGH
+      /* high active */
+      BOOST_PORT &= ~(1 << BOOST_CTRL);       /* set pin low */
+    #else
+      /* low active */
+      BOOST_PORT |= (1 << BOOST_CTRL);        /* set pin high */
+    #endif
+  }
+}
+
+#endif
+
+
+
 #if defined (HW_ZENER) && ! defined (ZENER_UNSWITCHED)
 
 /*
@@ -146,6 +419,17 @@ void Zener_Tool(void)
   #ifdef ZENER_DIVIDER_CUSTOM
   uint32_t               Value;              /* value */
   #endif
+  #if defined (UI_MONITOR_GRAPH) && ! defined (UI_ZENER_DIODE)
+  Graph_Type             Graph;              /* graph data */
+  #endif
+  #ifdef ZENER_AUTO_HOLD
+  uint8_t                Boost = 0;          /* boost converter state */
+  uint8_t                Runs = 0;           /* boost converter time */
+  uint8_t                Stable = 0;         /* stable readings */
+  uint16_t               U2 = 0;             /* last voltage */
+  uint16_t               Hold_Min = UINT16_MAX;   /* min. of held values */
+  uint16_t               Hold_Max = 0;       /* max. of held values */
+  #endif
 
   /* show info */
   LCD_Clear();
@@ -161,6 +445,8 @@ void Zener_Tool(void)
   /* display Zener diode symbol */
   Check.Symbol = SYMBOL_DIODE_ZENER;    /* set symbol ID */
   Display_FancySemiPinout(3);           /* show symbol starting in line #3 */
+  #elif defined (UI_MONITOR_GRAPH)
+  Graph_Init(&Graph);                   /* prepare graph */
   #endif
 
 
@@ -194,7 +480,31 @@ void Zener_Tool(void)
 
     while (!(BUTTON_PIN & (1 << TEST_BUTTON)))    /* as long as key is pressed */
     {
-      #ifdef ZENER_SWITCHED
+      #ifdef ZENER_AUTO_HOLD
+      /*
+       *  auto hold
+       *  - boost converter runs until reading has settled or timeout
+       *  - held value is taken after settling
+       */
+
+      if (Counter == 0)            /* first loop run */
+      {
+        Zener_Boost(1);            /* turn on boost converter */
+        Boost = 1;                 /* set flag */
+        Runs = 0;                  /* reset boost time */
+        Stable = 0;                /* reset stable readings */
+        U2 = 0;                    /* reset last voltage */
+        Min = UINT16_MAX;          /* reset hold value */
+      }
+
+      if (Boost == 0)              /* reading done */
+      {
+        /* just wait for key release */
+        MilliSleep(30);            /* delay next run / also debounce by 30ms */
+        if (Counter < 100) Counter++;   /* increase key press time counter */
+        continue;
+      }
+      #elif defined (ZENER_SWITCHED)
       /* turn on boost converter */
         #ifdef ZENER_BOOST_HIGH
           /* high active */
@@ -235,8 +545,43 @@ void Zener_Tool(void)
         #else
           Display_Value(U1, -3, 'V');   /* display current voltage (1mV) */
         #endif
+
+        #if defined (UI_MONITOR_GRAPH) && ! defined (UI_ZENER_DIODE)
+          #ifndef ZENER_DIVIDER_CUSTOM
+          Graph_Add(&Graph, U1, -2);    /* update graph */
+          #else
+          Graph_Add(&Graph, U1, -3);    /* update graph */
+          #endif
+        #endif
+      }
+
+      #ifdef ZENER_AUTO_HOLD
+      /* check for settled reading */
+      if ((U1 + ZENER_SETTLE_TOLER >= U2) && (U1 <= U2 + ZENER_SETTLE_TOLER))
+      {
+        Stable++;                  /* another stable reading */
+      }
+      else                         /* still changing */
+      {
+        Stable = 0;                /* reset counter */
       }
+      U2 = U1;                     /* save voltage */
+      Runs++;                      /* increase boost time */
 
+      if (Stable >= ZENER_SETTLE_RUNS)  /* settled */
+      {
+        Min = U1;                  /* hold value */
+        if (U1 < Hold_Min) Hold_Min = U1;    /* update min */
+        if (U1 > Hold_Max) Hold_Max = U1;    /* update max */
+        Zener_Boost(0);            /* turn off boost converter */
+        Boost = 0;                 /* clear flag */
+      }
+      else if (Runs >= ZENER_BOOST_RUNS)     /* timeout */
+      {
+        Zener_Boost(0);            /* turn off boost converter */
+        Boost = 0;                 /* clear flag */
+      }
+      #else
       /* data hold */
       if (Counter == 0)            /* first loop run */
       {
@@ -246,6 +591,7 @@ void Zener_Tool(void)
       {
         if (U1 < Min) Min = U1;    /* update minimum */
       }
+      #endif
 
       /* timing */
       MilliSleep(30);              /* delay next run / also debounce by 30ms */
@@ -259,7 +605,13 @@ void Zener_Tool(void)
       }
     }
 
-    #ifdef ZENER_SWITCHED
+    #ifdef ZENER_AUTO_HOLD
+    if (Boost)                /* key released before settling */
+    {
+      Zener_Boost(0);         /* turn off boost converter */
+      Boost = 0;              /* clear flag */
+    }
+    #elif defined (ZENER_SWITCHED)
     /* turn off boost converter */
       #ifdef ZENER_BOOST_HIGH
         /* high active */
@@ -270,6 +622,10 @@ void Zener_Tool(void)
       #endif
     #endif
 
+    #ifdef INPUT_QUEUE
+    if (Counter > 0) Key_Flush();   /* key press is processed already */
+    #endif
+
 
     /*
      *  user interface logic
@@ -307,14 +663,33 @@ void Zener_Tool(void)
         #else
           Display_Value(Min, -3, 'V');     /* display minimal voltage */
         #endif
+        #ifndef ZENER_AUTO_HOLD
         Display_Space();
         Display_EEString(Min_str);         /* display: Min */
+        #endif
       }
       else                         /* unchanged default */
       {
         Display_Minus();                   /* display "no value" */
       }
 
+      #if defined (ZENER_AUTO_HOLD) && ! defined (UI_ZENER_DIODE) && ! defined (UI_MONITOR_GRAPH)
+      /* display min/max of held values in line #3 */
+      if (Hold_Max > 0)            /* got held value */
+      {
+        LCD_ClearLine3();
+        #ifndef ZENER_DIVIDER_CUSTOM
+          Display_Value(Hold_Min, -2, 'V');     /* display min */
+          Display_Minus();
+          Display_Value(Hold_Max, -2, 'V');     /* display max */
+        #else
+          Display_Value(Hold_Min, -3, 'V');     /* display min */
+          Display_Minus();
+          Display_Value(Hold_Max, -3, 'V');     /* display max */
+        #endif
+      }
+      #endif
+
       Counter2 = 0;                /* reset delay time */
     }
   }
@@ -324,6 +699,17 @@ void Zener_Tool(void)
 
 
 
+#ifdef ZENER_AUTO_HOLD
+
+/* clean-up of local constants */
+#undef ZENER_SETTLE_TOLER
+#undef ZENER_SETTLE_RUNS
+#undef ZENER_BOOST_RUNS
+
+#endif
+
+
+
 #if defined (HW_ZENER) && defined (ZENER_UNSWITCHED)
 
 /*
@@ -344,6 +730,9 @@ void Zener_Tool(void)
   #ifdef ZENER_DIVIDER_CUSTOM
   uint32_t               Value;         /* value */
   #endif
+  #if defined (UI_MONITOR_GRAPH) && ! defined (UI_ZENER_DIODE)
+  Graph_Type             Graph;         /* graph data */
+  #endif
 
   /* show info */
   LCD_Clear();
@@ -357,6 +746,8 @@ void Zener_Tool(void)
   /* display Zener diode symbol */
   Check.Symbol = SYMBOL_DIODE_ZENER;    /* set symbol ID */
   Display_FancySemiPinout(3);           /* show symbol starting in line #3 */
+  #elif defined (UI_MONITOR_GRAPH)
+  Graph_Init(&Graph);                   /* prepare graph */
   #endif
 
 
@@ -367,11 +758,15 @@ void Zener_Tool(void)
   while (Run)
   {
     /* get voltage */
+    #if defined (ADC_OVERSAMPLING) && ! defined (ZENER_DIVIDER_CUSTOM)
+    U1 = ReadU_HiRes(TP_ZENER, ADC_OVERSAMPLING);  /* read voltage (in 0.1mV) */
+    #else
     U1 = ReadU(TP_ZENER);          /* read voltage (in mV) */
+    #endif
 
     #ifndef ZENER_DIVIDER_CUSTOM
     /* ADC pin is connected to a 10:1 voltage divider */
-    /* so U1's scale is 10mV */
+    /* so U1's scale is 10mV (1mV with oversampling) */
     #endif
 
     #ifdef ZENER_DIVIDER_CUSTOM
@@ -390,11 +785,23 @@ void Zener_Tool(void)
     /* display voltage */
     LCD_ClearLine2();              /* clear line #2 */
     #ifndef ZENER_DIVIDER_CUSTOM
+      #ifdef ADC_OVERSAMPLING
+      Display_Value(U1, -3, 'V');  /* display current voltage */
+      #else
       Display_Value(U1, -2, 'V');  /* display current voltage */
+      #endif
     #else
       Display_Value(U1, -3, 'V');  /* display current voltage */
     #endif
 
+    #if defined (UI_MONITOR_GRAPH) && ! defined (UI_ZENER_DIODE)
+      #if ! defined (ZENER_DIVIDER_CUSTOM) && ! defined (ADC_OVERSAMPLING)
+      Graph_Add(&Graph, U1, -2);   /* update graph */
+      #else
+      Graph_Add(&Graph, U1, -3);   /* update graph */
+      #endif
+    #endif
+
     /* user feedback (1s delay) */
     Test = TestKey(1000, CHECK_KEY_TWICE | CHECK_BAT | CURSOR_STEADY);
 
@@ -411,6 +818,26 @@ void Zener_Tool(void)
 
 #ifdef HW_PROBE_ZENER
 
+#ifdef ZENER_QUICK_CHECK
+
+/*
+ *  local constants for quick check
+ *  - voltages at ADC pin (in mV)
+ */
+
+#ifndef ZENER_DIVIDER_CUSTOM
+  #define ZENER_OPEN_RAW      (ZENER_VOLTAGE_MAX / 10)
+#else
+  #define ZENER_OPEN_RAW      ((uint16_t)(((uint32_t)ZENER_VOLTAGE_MAX * ZENER_R2) / (ZENER_R1 + ZENER_R2)))
+#endif
+#define ZENER_QUICK_TOLER     2         /* max. change in mV */
+#define ZENER_QUICK_STABLE    3         /* stable readings (30ms each) */
+#define ZENER_QUICK_RUNS      10        /* timeout (300ms) */
+
+#endif
+
+
+
 /*
  *  check for Zener diode
  *  - hardware option for voltage measurement of Zener diode
@@ -428,6 +855,11 @@ void CheckZener(void)
   #ifdef ZENER_DIVIDER_CUSTOM
   uint32_t               Value;         /* value */
   #endif
+  #ifdef ZENER_QUICK_CHECK
+  uint16_t               U2 = 0;        /* former voltage */
+  uint8_t                Stable = 0;    /* counter for stable readings */
+  uint8_t                Runs = 0;      /* counter for loop runs */
+  #endif
 
   #ifdef ZENER_SWITCHED
   /* turn on boost converter */
@@ -438,11 +870,47 @@ void CheckZener(void)
       /* low active */
       BOOST_PORT &= ~(1 << BOOST_CTRL);      /* set pin low */
     #endif
-  MilliSleep(300);                           /* time for stabilization */
   #endif
 
+  #ifdef ZENER_QUICK_CHECK
+  /*
+   *  wait for stabilization, but end early
+   *  - open probes: voltage rises above ZENER_VOLTAGE_MAX
+   *  - Zener diode: voltage settles at V_Z
+   */
+
+  while (Runs < ZENER_QUICK_RUNS)
+  {
+    MilliSleep(30);                /* wait a little bit */
+    U1 = ReadU(TP_ZENER);          /* read voltage (in mV) */
+
+    if (U1 > ZENER_OPEN_RAW)       /* not clamped by a Zener */
+    {
+      break;                       /* end loop */
+    }
+
+    /* check for settled reading */
+    if ((U1 + ZENER_QUICK_TOLER >= U2) && (U1 <= U2 + ZENER_QUICK_TOLER))
+    {
+      Stable++;                    /* another stable reading */
+      if (Stable >= ZENER_QUICK_STABLE) break;    /* settled */
+    }
+    else                           /* still changing */
+    {
+      Stable = 0;                  /* reset counter */
+    }
+
+    U2 = U1;                       /* save voltage */
+    Runs++;                        /* next run */
+  }
+  #else
+    #ifdef ZENER_SWITCHED
+    MilliSleep(300);                         /* time for stabilization */
+    #endif
+
   /* get voltage */
   U1 = ReadU(TP_ZENER);            /* read voltage (in mV) */
+  #endif
 
   #ifdef ZENER_SWITCHED
   /* turn off boost converter */
@@ -481,6 +949,16 @@ void CheckZener(void)
   }
 }
 
+#ifdef ZENER_QUICK_CHECK
+
+/* clean-up of local constants */
+#undef ZENER_OPEN_RAW
+#undef ZENER_QUICK_TOLER
+#undef ZENER_QUICK_STABLE
+#undef ZENER_QUICK_RUNS
+
+#endif
+
 #endif
 
 
@@ -503,6 +981,13 @@ void ESR_Tool(void)
   uint8_t           Test;          /* temp. value */
   Capacitor_Type    *Cap;          /* pointer to cap */
   uint16_t          ESR;           /* ESR (in 0.01 Ohms) */
+  #ifdef UI_MONITOR_GRAPH
+  Graph_Type        Graph;         /* graph data */
+  #endif
+  #ifdef ESR_TOOL_FAST
+  uint8_t           Fast = 0;      /* fast mode */
+  uint16_t          Last = 0;      /* last ESR displayed */
+  #endif
 
   Check.Diodes = 0;                /* disable diode check in cap measurement */
   Cap = &Caps[0];                  /* pointer to first cap */
@@ -523,37 +1008,134 @@ void ESR_Tool(void)
   #endif
   ProbePinout(PROBES_ESR);         /* show probes used */
   Display_Minus();                 /* display "no value" */
+  #ifdef UI_MONITOR_GRAPH
+  Graph_Init(&Graph);              /* prepare graph */
+  #endif
 
   while (Run > 0)
   {
     /*
      *  short or long key press -> measure
      *  two short key presses -> exit tool
+     *  fast mode: long key press -> toggle fast mode
      */
 
     /* wait for user feedback */
-    Test = TestKey(0, CURSOR_BLINK | CHECK_KEY_TWICE | CHECK_BAT);
+    #ifdef ESR_TOOL_FAST
+    if (Fast)                           /* fast mode */
+    {
+      /* measure continuously */
+      Test = TestKey(100, CHECK_KEY_TWICE | CHECK_BAT);
+    }
+    else                                /* normal mode */
+    #endif
+    {
+      Test = TestKey(0, CURSOR_BLINK | CHECK_KEY_TWICE | CHECK_BAT);
+    }
 
     if (Test == KEY_TWICE)              /* two short key presses */
     {
       Run = 0;                          /* end loop */
     }
-
-    /* measure cap */
-    if (Run > 0)                        /* key pressed */
+    #ifdef ESR_TOOL_FAST
+    else if (Test == KEY_LONG)          /* long key press */
     {
-      #ifdef HW_DISCHARGE_RELAY
-      /* discharge relay: remove short circuit */
-                                        /* ADC_PORT should be 0 */
-      ADC_DDR = 0;                      /* enable relay (via extrenal reference) */
-      #endif
+      /* toggle fast mode */
+      Fast ^= 1;                        /* toggle flag */
+      LCD_CharPos(UI.CharMax_X, 1);     /* last char of line #1 */
 
+      if (Fast)                         /* fast mode */
+      {
+        ESR_Pulses = ESR_FAST_PULSES;   /* fewer pulse pairs */
+        Last = 0;                       /* force display update */
+        Display_Char('*');              /* display: * */
+      }
+      else                              /* normal mode */
+      {
+        ESR_Pulses = 0;                 /* default pulse pairs */
+        Display_Space();                /* clear mode indicator */
+      }
+    }
+
+    /* fast mode: measure and update display on change only */
+    if (Fast && (Run > 0))
+    {
+      ESR = UINT16_MAX;                 /* no reading yet */
+      Check.Found = COMP_NONE;          /* no component */
+      MeasureCap(PROBE_1, PROBE_3, 0);  /* probe-1 = Vcc, probe-3 = Gnd */
+
+      if (Check.Found == COMP_CAPACITOR)     /* found capacitor */
+      {
+        ESR = MeasureESR(Cap);          /* get ESR */
+      }
+
+      #ifdef SW_REMOTE_TOOLS
+      /* send record to remote host */
+      Tool_CapRecord((Check.Found == COMP_CAPACITOR) ? Cap : NULL, ESR);
+      #endif
+
+      if (ESR != Last)                  /* reading changed */
+      {
+        Last = ESR;                     /* update last reading */
+        LCD_ClearLine2();               /* update line #2 */
+
+        if (ESR < UINT16_MAX)           /* got valid ESR */
+        {
+          Display_Value(Cap->Value, Cap->Scale, 'F');
+          Display_Space();
+          Display_Value(ESR, -2, LCD_CHAR_OMEGA);
+        }
+        else                            /* no capacitor or ESR */
+        {
+          Display_Minus();
+        }
+      }
+
+      #ifdef HW_BUZZER
+      /* bad ESR: short beep */
+      if ((ESR < UINT16_MAX) && (ESR >= ESR_BAD))
+      {
+        #ifdef BUZZER_ACTIVE
+        BUZZER_PORT |= (1 << BUZZER_CTRL);   /* enable: set pin high */
+        MilliSleep(20);                      /* wait for 20 ms */
+        BUZZER_PORT &= ~(1 << BUZZER_CTRL);  /* disable: set pin low */
+        #endif
+
+        #ifdef BUZZER_PASSIVE
+        PassiveBuzzer(BUZZER_FREQ_LOW);      /* low frequency beep */
+        #endif
+      }
+      #endif
+
+      #ifdef UI_MONITOR_GRAPH
+      Graph_Add(&Graph, (ESR < UINT16_MAX) ? ESR : 0, -2);    /* update graph */
+      #endif
+
+      continue;                         /* next run */
+    }
+    #endif
+
+    /* measure cap */
+    if (Run > 0)                        /* key pressed */
+    {
+      #ifdef HW_DISCHARGE_RELAY
+      /* discharge relay: remove short circuit */
+                                        /* ADC_PORT should be 0 */
+      ADC_DDR = 0;                      /* enable relay (via extrenal reference) */
+      #endif
+
+      #ifdef ESR_PIPELINED
+      LCD_ClearLine(3);                 /* clear line #3 (spread) */
+      #endif
+      LCD_ClearLine2();                 /* update line #2 */
+      Display_EEString(Probing_str);    /* display: probing... */
+      Check.Found = COMP_NONE;          /* no component */
+      MeasureCap(PROBE_1, PROBE_3, 0);  /* probe-1 = Vcc, probe-3 = Gnd */
       LCD_ClearLine2();                 /* update line #2 */
-      Display_EEString(Probing_str);    /* display: probing... */
-      Check.Found = COMP_NONE;          /* no component */
-      MeasureCap(PROBE_1, PROBE_3, 0);  /* probe-1 = Vcc, probe-3 = Gnd */
-      LCD_ClearLine2();                 /* update line #2 */
-      
+      #ifdef UI_MONITOR_GRAPH
+      ESR = 0;                          /* no ESR yet */
+      #endif
+
       if (Check.Found == COMP_CAPACITOR)     /* found capacitor */
       {
         /* show capacitance */
@@ -562,20 +1144,42 @@ void ESR_Tool(void)
         /* show ESR */
         Display_Space();
         ESR = MeasureESR(Cap);
+        #ifdef SW_REMOTE_TOOLS
+        Tool_CapRecord(Cap, ESR);       /* send record to remote host */
+        #endif
         if (ESR < UINT16_MAX)           /* got valid ESR */
         {
           Display_Value(ESR, -2, LCD_CHAR_OMEGA);
+
+          #ifdef ESR_PIPELINED
+          /* show spread in line #3 */
+          LCD_CharPos(1, 3);            /* go to line #3 */
+          Display_Char('+');            /* display: +/- */
+          Display_Char('/');
+          Display_Minus();
+          Display_Value(ESR_Spread, -2, LCD_CHAR_OMEGA);
+          #endif
         }
         else                            /* no ESR */
         {
           Display_Minus();
+          #ifdef UI_MONITOR_GRAPH
+          ESR = 0;                      /* no reading */
+          #endif
         }
       }
       else                                   /* no capacitor */
       {
         Display_Minus();
+        #ifdef SW_REMOTE_TOOLS
+        Tool_CapRecord(NULL, UINT16_MAX);    /* send empty record */
+        #endif
       }
 
+      #ifdef UI_MONITOR_GRAPH
+      Graph_Add(&Graph, ESR, -2);       /* update graph */
+      #endif
+
       #ifdef HW_DISCHARGE_RELAY
       ADC_DDR = (1 << TP_REF);          /* short circuit probes */
       #endif
@@ -585,6 +1189,10 @@ void ESR_Tool(void)
   #ifdef HW_DISCHARGE_RELAY
   ADC_DDR = 0;                     /* remove short circuit */
   #endif
+
+  #ifdef ESR_TOOL_FAST
+  ESR_Pulses = 0;                  /* reset to default pulse pairs */
+  #endif
 }
 
 #endif
@@ -603,6 +1211,88 @@ void ESR_Tool(void)
 #define DIR_RIGHT        0b00000001     /* turned to the right */
 #define DIR_LEFT         0b00000010     /* turned to the left */
 
+#ifdef ENCODER_STATS
+
+/*
+ *  edge capture
+ *  - interval since last edge (Timer1 time stamp, counter is restarted
+ *    for each edge) and state of probe pins
+ *  - interval saturates at the timer's overflow (16-65ms depending on
+ *    MCU clock), which is treated as rest in a detent
+ *  - max. number of edges: ENC_MAX_EDGES (see common.h)
+ */
+
+/* PCINT# of ADC port's pin #0 needs to be first bit of mask register */
+#if (ADC_PCINT % 8) != 0
+  #error <<< Encoder: ADC_PCINT has to be pin #0 of a PCINT bank! >>>
+#endif
+
+/* PCINT0-7 */
+#if (ADC_PCINT >= 0) && (ADC_PCINT <= 7)
+  #define BIT_PC_IRQ     PCIE0          /* Pin Change Interrupt Enable 0 */
+  #define BIT_PC_FLAG    PCIF0          /* Pin Change Interrupt Flag 0 */
+  #define REG_PC_MASK    PCMSK0         /* Pin Change Mask Register 0 */
+  #define ISR_PINCHANGE  PCINT0_vect    /* ISR */
+#endif
+
+/* PCINT8-15 */
+#if (ADC_PCINT >= 8) && (ADC_PCINT <= 15)
+  #define BIT_PC_IRQ     PCIE1          /* Pin Change Interrupt Enable 1 */
+  #define BIT_PC_FLAG    PCIF1          /* Pin Change Interrupt Flag 1 */
+  #define REG_PC_MASK    PCMSK1         /* Pin Change Mask Register 1 */
+  #define ISR_PINCHANGE  PCINT1_vect    /* ISR */
+#endif
+
+/* PCINT16-23 */
+#if (ADC_PCINT >= 16) && (ADC_PCINT <= 23)
+  #define BIT_PC_IRQ     PCIE2          /* Pin Change Interrupt Enable 2 */
+  #define BIT_PC_FLAG    PCIF2          /* Pin Change Interrupt Flag 2 */
+  #define REG_PC_MASK    PCMSK2         /* Pin Change Mask Register 2 */
+  #define ISR_PINCHANGE  PCINT2_vect    /* ISR */
+#endif
+
+/* PCINT24-31 */
+#if (ADC_PCINT >= 24) && (ADC_PCINT <= 31)
+  #define BIT_PC_IRQ     PCIE3          /* Pin Change Interrupt Enable 3 */
+  #define BIT_PC_FLAG    PCIF3          /* Pin Change Interrupt Flag 3 */
+  #define REG_PC_MASK    PCMSK3         /* Pin Change Mask Register 3 */
+  #define ISR_PINCHANGE  PCINT3_vect    /* ISR */
+#endif
+
+/* other users of the same ISR */
+#if defined (SERIAL_BITBANG) && ((ADC_PCINT / 8) == (SERIAL_PCINT / 8))
+  #error <<< Encoder: bit-bang serial uses same PCINT bank! >>>
+#endif
+
+#if defined (SW_IR_RX_PCINT) && defined (SW_IR_RECEIVER)
+  #error <<< Encoder: IR detector edge capture uses same PCINT bank! >>>
+#elif defined (SW_IR_RX_PCINT) && ((IR_PCINT / 8) == (ADC_PCINT / 8))
+  #error <<< Encoder: IR detector edge capture uses same PCINT bank! >>>
+#endif
+
+#ifdef SW_DHTXX_PCINT
+  #error <<< Encoder: DHTxx edge capture uses same PCINT bank! >>>
+#endif
+
+#if defined (TOUCH_PCINT) && ((ADC_PCINT / 8) == (TOUCH_PCINT / 8))
+  #error <<< Encoder: touch screen uses same PCINT bank! >>>
+#endif
+
+#if defined (ENCODER_PCINT) && ((ADC_PCINT / 8) == ((ENCODER_PCINT + ENCODER_A) / 8))
+  #error <<< Encoder: rotary encoder uses same PCINT bank! >>>
+#endif
+
+/* bounce: max. interval of a reversal (5ms) */
+#define ENC_BOUNCE       TIMESTAMP_TICKS(5000)
+
+/* edge capture */
+volatile uint8_t    Enc_Edges;                    /* number of edges */
+/* intervals and pin states, kept in scratch arena */
+#define Enc_Ticks           ((volatile uint16_t *)Scratch)
+#define Enc_State           ((volatile uint8_t *)&Scratch[ENC_MAX_EDGES * 2])
+
+#endif
+
 
 /*
  *  check rotary encoder
@@ -733,9 +1423,263 @@ uint8_t CheckEncoder(uint8_t *History)
 }
 
 
+
+#ifdef ENCODER_STATS
+
+/*
+ *  ISR for pin change of encoder's A & B (probe pins)
+ *  - saves interval since last edge and state of probe pins
+ */
+
+ISR(ISR_PINCHANGE, ISR_BLOCK)
+{
+  uint16_t          Ticks;              /* interval */
+  uint8_t           n;                  /* counter */
+
+  /*
+   *  hints:
+   *  - the interrupt flag is cleared automatically
+   *  - all other interrupts are disabled
+   */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_PCINT]++;    /* count ISR call */
+  #endif
+
+  Ticks = TCNT1;                   /* get interval */
+  TCNT1 = 0;                       /* restart interval */
+
+  if (TIFR1 & (1 << TOV1))         /* timer overflow */
+  {
+    Ticks = UINT16_MAX;            /* saturate */
+    TIFR1 = (1 << TOV1);           /* clear flag */
+  }
+
+  n = Enc_Edges;
+  if (n < ENC_MAX_EDGES)           /* prevent buffer overflow */
+  {
+    Enc_Ticks[n] = Ticks;          /* save interval */
+    Enc_State[n] = ADC_PIN;        /* save pin state */
+    Enc_Edges = n + 1;             /* got another one */
+  }
+}
+
+
+
+/*
+ *  capture edges of detected encoder and show timing statistics
+ *  - uses pinout of last CheckEncoder() run
+ *  - captures until buffer is full, key press or no edge for 1s
+ *  - steps per detent: based on the AB states the encoder rests in
+ *  - bounce: reversals to the state before, the longest burst is
+ *    the time from the last valid edge to the last reversal
+ *  - max. reliable speed: a step has to be longer than the bounce,
+ *    without bounce the shortest step is shown as lower limit
+ */
+
+void Encoder_Stats(void)
+{
+  uint8_t           n;             /* counter */
+  uint8_t           Edges;         /* number of edges */
+  uint8_t           Pins;          /* pin state */
+  uint8_t           AB = 0;        /* AB state */
+  uint8_t           Prev;          /* last AB state */
+  uint8_t           Prev2 = 0xFF;  /* AB state before last one */
+  uint8_t           Rest = 0;      /* rest states (bitfield) */
+  uint8_t           Steps = 0;     /* Gray code steps per detent */
+  uint16_t          Ticks;         /* interval */
+  uint16_t          StepMin = UINT16_MAX;   /* shortest valid step */
+  uint32_t          Burst = 0;     /* current bounce burst */
+  uint32_t          Bounce = 0;    /* longest bounce burst */
+  uint32_t          Value;         /* temporary value */
+
+  /* buffer for edge capture */
+  if (Scratch_Acquire(SCRATCH_ENCODER) == NULL) return;
+
+  /* same probe setup as CheckEncoder() */
+  /* set up probes: probe-1 -- Rl -- Vcc / probe-2 -- Rl -- Vcc / Gnd -- probe-3 */
+  R_PORT = Probes.Rl_1 | Probes.Rl_2;   /* pullup via Rl */
+  R_DDR =  Probes.Rl_1 | Probes.Rl_2;   /* enable pull-up resistors */
+  ADC_PORT = 0;                         /* pull down directly */
+  ADC_DDR = Probes.Pin_3;               /* enable Gnd for probe-3 */
+  wait500us();                          /* settle time */
+
+  Pins = ADC_PIN;                       /* initial state */
+
+  Enc_Edges = 0;                        /* reset edge counter */
+  Timestamp_Start();                    /* start time stamp */
+
+  /* enable pin change interrupt for probe-1 and probe-2 */
+  REG_PC_MASK |= Probes.Pin_1 | Probes.Pin_2;     /* enable A & B */
+  PCIFR = (1 << BIT_PC_FLAG);           /* clear interrupt flag */
+  PCICR |= (1 << BIT_PC_IRQ);           /* enable pin change interrupt */
+
+  /*
+   *  capture edges
+   *  - busy waiting, since Timer1 stops in power-save mode
+   */
+
+  Edges = 0;
+  n = 0;                                /* idle counter */
+  while (n < 100)                       /* 100 x 10ms */
+  {
+    wdt_reset();
+    wait10ms();                         /* wait 10ms */
+
+    if (Enc_Edges >= ENC_MAX_EDGES)     /* buffer full */
+    {
+      break;                            /* end loop */
+    }
+
+    if (!(BUTTON_PIN & (1 << TEST_BUTTON)))     /* if key is pressed */
+    {
+      /* wait until key is released */
+      while (!(BUTTON_PIN & (1 << TEST_BUTTON))) wdt_reset();
+
+      #ifdef INPUT_QUEUE
+      Key_Flush();                      /* key press is processed already */
+      #endif
+      break;                            /* end loop */
+    }
+
+    if (Enc_Edges != Edges)             /* got new edges */
+    {
+      Edges = Enc_Edges;                /* update */
+      n = 0;                            /* reset idle counter */
+    }
+    else if (Edges > 0)                 /* turned already */
+    {
+      n++;                              /* idle */
+    }
+  }
+
+  /* disable pin change interrupt */
+  PCICR &= ~(1 << BIT_PC_IRQ);          /* disable pin change interrupt */
+  REG_PC_MASK &= ~(Probes.Pin_1 | Probes.Pin_2);  /* disable A & B */
+
+  Timestamp_Stop();                     /* stop time stamp */
+
+  R_DDR = 0;                  /* reset probes */
+  ADC_DDR = 0;
+
+  Edges = Enc_Edges;          /* number of edges */
+
+  /*
+   *  process edges
+   */
+
+  n = 0;
+  while (1)
+  {
+    /* get A & B signals */
+    Prev = AB;                          /* last state */
+    AB = 0;
+    if (Pins & Probes.Pin_1) AB = 0b00000010;
+    if (Pins & Probes.Pin_2) AB |= 0b00000001;
+
+    if (n == 0)                         /* initial state */
+    {
+      Prev = AB;
+    }
+    else                                /* edge */
+    {
+      Ticks = Enc_Ticks[n - 1];         /* interval since last edge */
+
+      /* last state was held for a timer overflow: rest in detent */
+      if (Ticks == UINT16_MAX) Rest |= (1 << Prev);
+
+      Pins = Prev ^ AB;                 /* get bit difference */
+
+      if (Pins == 0b00000011)           /* both changed: missed edge */
+      {
+        Burst = 0;                      /* end burst */
+      }
+      else if (((AB == Prev2) || (AB == Prev)) && (Ticks < ENC_BOUNCE))
+      {
+        /* reversal or glitch too short to be captured: bounce */
+        Burst += Ticks;                 /* add to burst */
+        if (Burst > Bounce) Bounce = Burst;
+      }
+      else                              /* valid step */
+      {
+        Burst = 0;                      /* end burst */
+        if (Ticks < StepMin) StepMin = Ticks;
+      }
+
+      Prev2 = Prev;                     /* update */
+    }
+
+    if (n == Edges) break;              /* all edges done */
+    Pins = Enc_State[n];                /* next edge */
+    n++;
+  }
+
+  Rest |= (1 << AB);               /* encoder rests in final state */
+
+  /* Gray code steps per detent: 4 / number of rest states */
+  n = 0;
+  while (Rest)                     /* count rest states */
+  {
+    if (Rest & 1) n++;
+    Rest >>= 1;
+  }
+
+  if (n == 1) Steps = 4;           /* one pulse per detent */
+  else if (n == 2) Steps = 2;      /* half a pulse per detent */
+  else if (n == 4) Steps = 1;      /* quarter pulse per detent */
+
+  /*
+   *  display statistics
+   */
+
+  if (Edges > 0)
+  {
+    /* steps per detent */
+    Display_NL_EEString_Space(EncSteps_str);    /* display: St/D */
+    if (Steps) Display_Char('0' + Steps);
+    else Display_Minus();
+
+    /* longest bounce (in s) */
+    Display_NL_EEString_Space(EncBounce_str);   /* display: t_b */
+    Value = Bounce * TIMESTAMP_PRESCALER / MCU_CYCLES_PER_US;
+    Display_Value(Value, -6, 's');
+
+    /* max. reliable speed (detents per second) */
+    Display_NL_EEString_Space(EncSpeed_str);    /* display: v_max */
+    if (Bounce == 0)                  /* no bounce */
+    {
+      Bounce = StepMin;               /* shortest step as lower limit */
+      if (Bounce < UINT16_MAX) Display_Char('>');
+    }
+
+    if (Bounce < UINT16_MAX)          /* got time */
+    {
+      if (Steps == 0) Steps = 4;      /* assume one pulse per detent */
+      Value = (CPU_FREQ / TIMESTAMP_PRESCALER) / (Bounce * Steps);
+      Display_FullValue(Value, 0, 0);
+      Display_Char('/');
+      Display_Char('s');
+    }
+    else                              /* no valid step */
+    {
+      Display_Minus();
+    }
+
+    /* let the user read the statistics */
+    TestKey(0, CURSOR_STEADY | CHECK_OP_MODE | CHECK_BAT);
+  }
+
+  Scratch_Release(SCRATCH_ENCODER);     /* free buffer */
+}
+
+#endif
+
+
+
 /*
  *  rotary encoder check
  *  - uses standard probes
+ *  - timing statistics: capture edges after detection
  */
 
 void Encoder_Tool(void)
@@ -795,14 +1739,22 @@ void Encoder_Tool(void)
 
     if (Flag > 0)             /* detected encoder */
     {
+      #ifdef ENCODER_STATS
+      /* keep turning: capture edges and show statistics */
+      Encoder_Stats();
+      #else
       /* let the user read or skip the text */
       TestKey(3000, CURSOR_STEADY | CHECK_OP_MODE | CHECK_BAT);
+      #endif
       Flag = 5;                    /* reset flag */
     }
     else                      /* nothing found yet */
     {
       if (!(BUTTON_PIN & (1 << TEST_BUTTON)))     /* if key is pressed */
       {
+        #ifdef INPUT_QUEUE
+        Key_Flush();               /* key press is processed already */
+        #endif
         MilliSleep(100);           /* smooth UI */
         Flag = 10;                 /* end loop */
       }
@@ -815,6 +1767,17 @@ void Encoder_Tool(void)
 #undef DIR_RIGHT
 #undef DIR_NONE
 
+/* clean up local constants for edge capture */
+#ifdef ENCODER_STATS
+  #undef Enc_State
+  #undef Enc_Ticks
+  #undef ENC_BOUNCE
+  #undef BIT_PC_IRQ
+  #undef BIT_PC_FLAG
+  #undef REG_PC_MASK
+  #undef ISR_PINCHANGE
+#endif
+
 #endif
 
 
@@ -824,7 +1787,7 @@ void Encoder_Tool(void)
  * ************************************************************************ */
 
 
-#ifdef SW_OPTO_COUPLER
+#ifdef FUNC_CHECK_LED
 
 /*
  *  check for LED
@@ -857,6 +1820,88 @@ void Check_LED(uint8_t Probe1, uint8_t Probe2)
   }
 }
 
+#endif
+
+
+
+#ifdef SW_OPTO_COUPLER
+
+
+#ifdef OPTO_CTR_SWEEP
+
+/*
+ *  measure CTR of BJT type opto coupler at a lower LED current
+ *  - probe-1: LED's anode
+ *    probe-2: LED's cathode & BJT's emitter (pulled down via Rl)
+ *    probe-3: BJT's collector (Vcc)
+ *  - Rl at probe-2 limits the total current to about 7mA, so the I/O pins
+ *    aren't overloaded
+ *
+ *  requires:
+ *  - Mode: 0 for LED via Rl (about 2.7mA) / 1 for LED via Rh (about 8A)
+ *  - I_f: pointer to If (in nA)
+ *
+ *  returns:
+ *  - CTR in %
+ */
+
+uint32_t Opto_CTR_Step(uint8_t Mode, uint32_t *I_f)
+{
+  uint8_t           Anode;              /* resistor for LED's anode */
+  uint16_t          U1, U2;             /* voltages */
+  uint32_t          R_a;                /* resistance at anode (Ohms) */
+  uint32_t          R_c;                /* resistance at cathode (Ohms) */
+  uint32_t          I_t;                /* total current (nA) */
+  uint32_t          CTR = 0;            /* CTR in % */
+
+  /* select resistor for LED */
+  if (Mode == 0)              /* Rl */
+  {
+    Anode = Probes.Rl_1;
+    R_a = R_LOW + (NV.RiH / 10);        /* Rl + RiH */
+  }
+  else                        /* Rh */
+  {
+    Anode = Probes.Rh_1;
+    R_a = R_HIGH;                       /* RiH is negligible */
+  }
+  R_c = R_LOW + (NV.RiL / 10);          /* Rl + RiL */
+
+  /* set probes: probe-3 -- Vcc / probe-2 -- Rl -- Gnd / probe-1 -- R -- Vcc */
+  ADC_PORT = Probes.Pin_3;              /* pull up probe-3 directly */
+  ADC_DDR = Probes.Pin_3;               /* set probe-3 to output */
+  R_PORT = Anode;                       /* turn LED on */
+  R_DDR = Anode | Probes.Rl_2;          /* pull down probe-2 via Rl */
+
+  U1 = ReadU_5ms(Probes.Ch_1);          /* voltage at LED's anode */
+  U2 = ReadU(Probes.Ch_2);              /* voltage at emitter */
+
+  R_PORT = 0;                           /* turn LED off */
+  R_DDR = 0;                            /* set resistors to HiZ */
+
+  /* If = (Vcc - U1) / R_a */
+  if (Cfg.Vcc > U1) U1 = Cfg.Vcc - U1;  /* voltage across R_a (mV) */
+  else U1 = 0;
+  *I_f = ((uint32_t)U1 * 100000) / R_a;      /* in 10nA */
+  *I_f *= 10;                                /* in nA */
+
+  /* I_total = U2 / R_c */
+  I_t = ((uint32_t)U2 * 100000) / R_c;       /* in 10nA */
+  I_t *= 10;                                 /* in nA */
+
+  /* CTR = Ie / If = (I_total - If) / If */
+  if ((*I_f > 0) && (I_t > *I_f))
+  {
+    CTR = I_t - *I_f;                   /* Ie (nA) */
+    CTR *= 100;                         /* scale up to % */
+    CTR /= *I_f;                        /* Ie / If (%) */
+  }
+
+  return CTR;
+}
+
+#endif
+
 
 
 /*
@@ -877,6 +1922,10 @@ void OptoCoupler_Tool(void)
   uint16_t          U1, U2;             /* voltages */
   uint16_t          U3, U4;             /* voltages */
   uint32_t          CTR = 0;            /* CTR in % */
+  #ifdef OPTO_CTR_SWEEP
+  uint32_t          Sweep_If[2];        /* If of sweep steps (nA) */
+  uint32_t          Sweep_CTR[2];       /* CTR of sweep steps (%) */
+  #endif
 
   /* local constants for status */
   #define DETECTED_LED        50
@@ -1029,13 +2078,12 @@ void OptoCoupler_Tool(void)
         ADC_PORT = Probes.Pin_3;                  /* pull up probe-3 directly */
 
         /* get voltages at current shunts */
-        Cfg.Samples = 10;               /* just a few samples for 1ms runtime */
+        /* just a few samples for 1ms runtime */
         R_PORT = Probes.Rl_1;           /* turn LED on */
         wait1ms();                      /* time for propagation delay */
-        U1 = ReadU(Probes.Ch_1);        /* voltage at LED's anode (Rl) */
-        U2 = ReadU(Probes.Ch_2);        /* voltage at emitter (RiL) */
+        U1 = ReadU_Desc(Probes.Ch_1, SAMPLE_SHORT);   /* voltage at LED's anode (Rl) */
+        U2 = ReadU_Desc(Probes.Ch_2, SAMPLE_SHORT);   /* voltage at emitter (RiL) */
         R_PORT = 0;                     /* turn LED off */
-        Cfg.Samples = ADC_SAMPLES;      /* reset samples to default */
 
         /* calculate LED's If */
         /* If = (Vcc - U1) / (RiH + Rl) */
@@ -1136,6 +2184,15 @@ void OptoCoupler_Tool(void)
           Run = 1;            /* reset value */
           Test = 100;         /* reset value */
         }
+
+        #ifdef OPTO_CTR_SWEEP
+        /* CTR at lower LED currents */
+        if (Test == DETECTED_BJT)
+        {
+          Sweep_CTR[0] = Opto_CTR_Step(0, &Sweep_If[0]);  /* LED via Rl */
+          Sweep_CTR[1] = Opto_CTR_Step(1, &Sweep_If[1]);  /* LED via Rh */
+        }
+        #endif
       }
 
 
@@ -1177,6 +2234,20 @@ void OptoCoupler_Tool(void)
 
         Display_NL_EEString_Space(Vf_str);        /* display: Vf */
         Display_Value(Diodes[0].V_f, -3, 'V');    /* display Vf */
+
+        #ifdef OPTO_CTR_SWEEP
+        /* display CTR sweep: If and CTR for each step */
+        Run = 0;
+        while (Run < 2)
+        {
+          Display_NL_EEString_Space(If_str);      /* display: If */
+          Display_Value(Sweep_If[Run], -9, 'A');  /* display If */
+          Display_Space();
+          Display_Value(Sweep_CTR[Run], 0, '%');  /* display CTR */
+          Run++;
+        }
+        Run = 1;                                  /* reset value */
+        #endif
       }
       else if (Test == DETECTED_TRIAC)  /* TRIAC type */
       {
@@ -1226,9 +2297,18 @@ void Cap_Leakage(void)
   uint8_t           Mode;               /* mode */
   uint16_t          U1 = 0;             /* voltage #1 */
   uint32_t          Value;              /* temp. value */
+  #ifdef CAP_LEAK_PREDICT
+  uint8_t           Runs = 0;           /* loop runs since last sample */
+  uint8_t           Samples = 0;        /* number of samples logged */
+  uint8_t           Stable = 0;         /* counter for stable predictions */
+  uint32_t          Leak[3];            /* logged leakage currents */
+  uint32_t          Predict = 0;        /* predicted leakage current */
+  uint32_t          Diff1, Diff2;       /* differences of samples */
+  #endif
 
   /* local constants for Flag (bitfield) */
   #define RUN_FLAG            0b00000001     /* run flag */
+  #define VALID_VALUE         0b00000010     /* valid current value */
   #define CHANGED_MODE        0b00000100     /* mode has changed */
 
   /* local constants for Mode */
@@ -1237,6 +2317,13 @@ void Cap_Leakage(void)
   #define MODE_LOW            2         /* charge cap: low current */
   #define MODE_DISCHARGE      3         /* discharge cap */
 
+  #ifdef CAP_LEAK_PREDICT
+  /* local constants for curve capture */
+  #define LEAK_INTERVAL       5         /* loop runs between samples (about 10s) */
+  #define LEAK_TOLER          32        /* tolerance for predictions (1/32) */
+  #define LEAK_CONVERGED      2         /* stable predictions for converged state */
+  #endif
+
   /* show info */
   LCD_Clear();                          /* clear display */
   #ifdef UI_COLORED_TITLES
@@ -1252,6 +2339,10 @@ void Cap_Leakage(void)
 
   UpdateProbes(PROBE_1, 0, PROBE_3);    /* update register bits and probes */
 
+  #ifdef ADS1115_LEAKAGE
+  ADC_Backend(ADC_EXT);                 /* use external ADC */
+  #endif
+
   while (Flag > 0)       /* processing loop */
   {
     /*
@@ -1262,7 +2353,18 @@ void Cap_Leakage(void)
     {
       LCD_ClearLine2();            /* clear line #2 */
 
-      switch (Mode)                /* based on mode */
+      #ifdef CAP_LEAK_PREDICT
+      /* new shunt resistor or mode: start new curve */
+      Runs = 0;
+      Samples = 0;
+      Stable = 0;
+      if (UI.CharMax_Y >= 4)       /* display has 4 lines or more */
+      {
+        LCD_ClearLine(4);          /* clear line #4 */
+      }
+      #endif
+
+      switch (Mode)                /* based on mode */
       {
         case MODE_NONE:            /* display pinout */
           /* probe-1: Vcc / probe-3: Gnd */
@@ -1314,6 +2416,7 @@ void Cap_Leakage(void)
     if (Mode != MODE_NONE)
     {
       LCD_ClearLine3();            /* clear line #3 */
+      Flag &= ~VALID_VALUE;        /* reset flag */
 
       switch (Mode)                /* based on mode */
       {
@@ -1326,6 +2429,7 @@ void Cap_Leakage(void)
           Value *= 100000;                   /* scale to 0.01 V */
           Value /= ((R_LOW * 10) + NV.RiL);  /* 0.01 V / 0.1 Ohms = 0.1 A */
           Display_Value(Value, -7, 'A');     /* display current */
+          Flag |= VALID_VALUE;               /* set flag */
 
           /* change to low current mode when current is quite low */
           if (U1 <= 3)                       /* I <= 4.2A */
@@ -1346,6 +2450,7 @@ void Cap_Leakage(void)
             Value *= 10000;                    /* scale to 0.1 V */
             Value /= (R_HIGH / 1000);          /* 0.1 V / kOhms = 0.1 nA */
             Display_Value(Value, -10, 'A');    /* display current */
+            Flag |= VALID_VALUE;               /* set flag */
           }
           else                          /* in the noise floor */
           {
@@ -1377,6 +2482,105 @@ void Cap_Leakage(void)
         Display_Value(U1, -3, 'V');          /* display voltage */
         Display_Char(')');
       }
+
+      #ifdef CAP_LEAK_PREDICT
+      /*
+       *  log decay curve and predict settled leakage current
+       *  - model: I(t) = I_end + A * exp(-t/tau)
+       *  - three equally spaced samples I0, I1, I2 give
+       *    I_end = I2 - (I1 - I2)^2 / ((I0 - I1) - (I1 - I2))
+       *  - uses the unit of the current mode (0.1A or 0.1nA)
+       */
+
+      if (Flag & VALID_VALUE)           /* got current */
+      {
+        Runs++;                         /* another loop run */
+
+        if (Runs >= LEAK_INTERVAL)      /* time for next sample */
+        {
+          Runs = 0;                     /* reset counter */
+
+          /* log sample */
+          Leak[0] = Leak[1];
+          Leak[1] = Leak[2];
+          Leak[2] = Value;
+          if (Samples < 3) Samples++;
+
+          if (Samples == 3)             /* got three samples */
+          {
+            Test = 0;                   /* reset flag for valid prediction */
+
+            if ((Leak[0] >= Leak[1]) && (Leak[1] >= Leak[2]))
+            {
+              /* decaying current */
+              Diff1 = Leak[0] - Leak[1];
+              Diff2 = Leak[1] - Leak[2];
+
+              if (Diff2 == 0)           /* settled already */
+              {
+                Value = Leak[2];        /* take last sample */
+                Test = 1;               /* valid prediction */
+              }
+              else if ((Diff1 > Diff2) && (Diff2 <= UINT16_MAX))
+              {
+                /* decay slows down: extrapolate */
+                Diff1 -= Diff2;         /* (I0 - I1) - (I1 - I2) */
+                Diff2 *= Diff2;         /* (I1 - I2)^2 */
+                Diff2 /= Diff1;
+
+                if (Diff2 < Leak[2])    /* sane result */
+                {
+                  Value = Leak[2] - Diff2;   /* I_end */
+                  Test = 1;             /* valid prediction */
+                }
+              }
+            }
+
+            if (Test)                   /* valid prediction */
+            {
+              /* compare with last prediction */
+              if (Value > Predict) Diff1 = Value - Predict;
+              else Diff1 = Predict - Value;
+
+              if (Diff1 <= (Value / LEAK_TOLER))  /* within tolerance */
+              {
+                if (Stable < LEAK_CONVERGED) Stable++;
+              }
+              else                      /* prediction still moving */
+              {
+                Stable = 0;             /* reset counter */
+              }
+
+              Predict = Value;          /* save prediction */
+            }
+            else                        /* no exponential decay */
+            {
+              Stable = 0;               /* reset counter */
+              Predict = 0;              /* reset prediction */
+            }
+
+            /* display prediction in line #4 */
+            if (UI.CharMax_Y >= 4)      /* display has 4 lines or more */
+            {
+              LCD_ClearLine(4);         /* clear line #4 */
+              LCD_CharPos(1, 4);        /* go to start of line #4 */
+
+              if (Predict)              /* got prediction */
+              {
+                /* "=" once converged, "~" while converging */
+                Display_Char((Stable >= LEAK_CONVERGED) ? '=' : '~');
+                Display_Space();
+                Display_Value(Predict, (Mode == MODE_HIGH) ? -7 : -10, 'A');
+              }
+              else                      /* no prediction (yet) */
+              {
+                Display_Minus();
+              }
+            }
+          }
+        }
+      }
+      #endif
     }
 
 
@@ -1429,6 +2633,10 @@ void Cap_Leakage(void)
    *  clean up
    */
 
+  #ifdef ADS1115_LEAKAGE
+  ADC_Backend(ADC_INT);                 /* back to internal ADC */
+  #endif
+
   /* local constants for Mode */
   #undef MODE_NONE
   #undef MODE_CHARGE
@@ -1437,7 +2645,15 @@ void Cap_Leakage(void)
 
   /* local constants for Flag */
   #undef RUN_FLAG
+  #undef VALID_VALUE
   #undef CHANGED_MODE
+
+  #ifdef CAP_LEAK_PREDICT
+  /* local constants for curve capture */
+  #undef LEAK_INTERVAL
+  #undef LEAK_TOLER
+  #undef LEAK_CONVERGED
+  #endif
 }
 
 #endif
@@ -1460,6 +2676,9 @@ void Monitor_R(void)
   uint8_t           Flag = 1;           /* loop control flag */
   uint8_t           Test;               /* user feedback */
   Resistor_Type     *R1;                /* pointer to resistor #1 */
+  #ifdef UI_MONITOR_GRAPH
+  Graph_Type        Graph;              /* graph data */
+  #endif
 
   /* show info */
   LCD_Clear();
@@ -1470,12 +2689,18 @@ void Monitor_R(void)
     Display_EEString(Monitor_R_str);    /* display: R monitor */
   #endif
   ProbePinout(PROBES_RCL);              /* show probes used */
+  #ifdef UI_MONITOR_GRAPH
+  Graph_Init(&Graph);                   /* prepare graph */
+  #endif
 
   /* init */
   UpdateProbes2(PROBE_1, PROBE_3);      /* set probes */
   R1 = &Resistors[0];                   /* pointer to first resistor */
   /* increase number of samples to lower spread of measurement values */
   Cfg.Samples = 100;                    /* perform 100 ADC samples */
+  #ifdef ADC_CLOCK_PROFILES
+  ADC_Profile(ADC_FAST);                /* fast ADC clock */
+  #endif
 
 
   /*
@@ -1493,10 +2718,18 @@ void Monitor_R(void)
     {
       /* display value */
       Display_Value(R1->Value, R1->Scale, LCD_CHAR_OMEGA);
+
+      #ifdef UI_MONITOR_GRAPH
+      Graph_Add(&Graph, R1->Value, R1->Scale);    /* update graph */
+      #endif
     }
     else                                /* no resistor */
     {
       Display_Minus();                  /* display: nothing */
+
+      #ifdef UI_MONITOR_GRAPH
+      Graph_Add(&Graph, 0, 0);          /* update graph */
+      #endif
     }
 
     /* user feedback (1s delay) */
@@ -1506,10 +2739,19 @@ void Monitor_R(void)
     {
       Flag = 0;                    /* end processing loop */
     }
+    #ifdef UI_MONITOR_GRAPH
+    else if (Test == KEY_SHORT)    /* short key press */
+    {
+      Graph.Ref = 0;               /* take next reading as reference */
+    }
+    #endif
   }
 
   /* clean up */
   Cfg.Samples = ADC_SAMPLES;       /* set ADC samples back to default */
+  #ifdef ADC_CLOCK_PROFILES
+  ADC_Profile(ADC_PRECISE);             /* standard ADC clock */
+  #endif
 }
 
 #endif
@@ -1531,6 +2773,9 @@ void Monitor_C(void)
   #if defined (SW_ESR) || defined (SW_OLD_ESR)
   uint16_t          ESR;                /* ESR (in 0.01 Ohms) */
   #endif
+  #ifdef UI_MONITOR_GRAPH
+  Graph_Type        Graph;              /* graph data */
+  #endif
 
   /* show info */
   LCD_Clear();
@@ -1541,10 +2786,14 @@ void Monitor_C(void)
     Display_EEString(Monitor_C_str);    /* display: C monitor */
   #endif
   ProbePinout(PROBES_RCL);              /* show probes used */
+  #ifdef UI_MONITOR_GRAPH
+  Graph_Init(&Graph);                   /* prepare graph */
+  #endif
 
   /* init */
   Check.Diodes = 0;                     /* reset diode counter */
   Cap = &Caps[0];                       /* pointer to first cap */
+  Check.CapRange = CAP_RANGE_MEMORY;    /* enable range memory */
 
 
   /*
@@ -1597,6 +2846,12 @@ void Monitor_C(void)
       Display_Minus();                       /* display: nothing */
     }
 
+    #ifdef UI_MONITOR_GRAPH
+    /* update graph */
+    if (Check.Found == COMP_CAPACITOR) Graph_Add(&Graph, Cap->Value, Cap->Scale);
+    else Graph_Add(&Graph, 0, 0);
+    #endif
+
     /* user feedback (2s delay) */
     Test = TestKey(2000, CHECK_KEY_TWICE | CHECK_BAT | CURSOR_STEADY);
 
@@ -1604,7 +2859,15 @@ void Monitor_C(void)
     {
       Flag = 0;                    /* end processing loop */
     }
+    #ifdef UI_MONITOR_GRAPH
+    else if (Test == KEY_SHORT)    /* short key press */
+    {
+      Graph.Ref = 0;               /* take next reading as reference */
+    }
+    #endif
   }
+
+  Check.CapRange = CAP_RANGE_NONE;      /* disable range memory */
 }
 
 #endif
@@ -1697,16 +2960,86 @@ void Monitor_L(void)
 
 
 
+#if defined (SW_MONITOR_RCL) || defined (SW_MONITOR_RL)
+
+/* local constants */
+#define MON_CHANGE_TOL   1    /* max. deviation of a stable reading (in %) */
+
+
+/*
+ *  check quick reading of monitor for change
+ *  - deviation from last full measurement within MON_CHANGE_TOL
+ *
+ *  requires:
+ *  - Value: value of quick reading
+ *  - Scale: exponent of factor (value * 10^x)
+ *  - Last: value of last full measurement
+ *  - LastScale: exponent of factor (value * 10^x)
+ *
+ *  returns:
+ *  - 1 if reading is stable
+ *  - 0 if changed
+ */
+
+uint8_t Monitor_Stable(uint32_t Value, int8_t Scale, uint32_t Last, int8_t LastScale)
+{
+  uint32_t          Limit;              /* max. deviation */
+
+  if (Last == 0) return 0;              /* no valid reference */
+
+  Limit = Last / 100 * MON_CHANGE_TOL;
+  if (Limit == 0) Limit = 1;            /* at least one count */
+
+  /* check upper and lower limit */
+  if (CmpValue(Value, Scale, Last + Limit, LastScale) > 0) return 0;
+  if (CmpValue(Value, Scale, Last - Limit, LastScale) < 0) return 0;
+
+  return 1;
+}
+
+
+
+/*
+ *  display stability indicator of monitor
+ *  - blinking '*' at the end of line #2
+ *
+ *  requires:
+ *  - Count: number of stable readings
+ */
+
+void Monitor_Indicator(uint8_t Count)
+{
+  uint8_t           Char = ' ';         /* indicator */
+
+  if (Count & 1) Char = '*';            /* toggle */
+  LCD_CharPos(UI.CharMax_X, 2);         /* end of line #2 */
+  Display_Char(Char);
+}
+
+/* clean-up of local constants */
+#undef MON_CHANGE_TOL
+
+#endif
+
+
+
 #ifdef SW_MONITOR_RCL
 
 /*
  *  monitor R plus L, or C plus ESR on probes #1 and #3
+ *  - if there's a component a quick reading (R or C only) checks for
+ *    a change first, and only a changed value triggers a full measurement
+ *    and an update of the display
  */
 
 void Monitor_RCL(void)
 {
   uint8_t           Run = 1;            /* loop control flag */
   uint8_t           Test;               /* user feedback */
+  uint8_t           Stable = 0;         /* number of stable readings */
+  uint16_t          Timeout;            /* timeout for user feedback */
+  uint32_t          Last = 0;           /* value of last measurement */
+  int8_t            LastScale = 0;      /* scale of last measurement */
   Resistor_Type     *R1;                /* pointer to resistor #1 */
   Capacitor_Type    *Cap;               /* pointer to cap */
   #if defined (SW_ESR) || defined (SW_OLD_ESR)
@@ -1727,6 +3060,7 @@ void Monitor_RCL(void)
   R1 = &Resistors[0];                   /* pointer to first resistor */
   Cap = &Caps[0];                       /* pointer to first cap */
   Check.Diodes = 0;                     /* reset diode counter */
+  Check.CapRange = CAP_RANGE_MEMORY;    /* enable range memory */
 
 
   /*
@@ -1735,6 +3069,50 @@ void Monitor_RCL(void)
 
   while (Run)
   {
+    /*
+     *  quick check for change of R or C
+     */
+
+    Timeout = 1000;                     /* 1s delay after full update */
+
+    if (Run > 1)                        /* got component */
+    {
+      Check.Found = COMP_NONE;          /* no component */
+      Test = 0;                         /* reset flag */
+
+      if (Run == COMP_CAPACITOR)        /* C */
+      {
+        /* measure C with range memory */
+        MeasureCap(PROBE_3, PROBE_1, 0);
+        if (Check.Found == COMP_CAPACITOR)
+        {
+          Test = Monitor_Stable(Cap->Value, Cap->Scale, Last, LastScale);
+        }
+      }
+      else                              /* R or L */
+      {
+        /* measure R with default number of ADC samples */
+        UpdateProbes2(PROBE_1, PROBE_3);
+        Check.Resistors = 0;
+        CheckResistor();
+        if (Check.Resistors == 1)
+        {
+          Test = Monitor_Stable(R1->Value, R1->Scale, Last, LastScale);
+        }
+      }
+
+      if (Test)                         /* no change */
+      {
+        Stable++;                       /* one more */
+        Monitor_Indicator(Stable);      /* update indicator */
+        Timeout = 250;                  /* short delay */
+        goto feedback;                  /* skip full measurement */
+      }
+    }
+
+    Stable = 0;                         /* reset counter */
+
+
     /*
      *  check for R, L and C
      */
@@ -1803,6 +3181,10 @@ void Monitor_RCL(void)
     }
     else if (Run == COMP_CAPACITOR)     /* C */
     {
+      /* reference for quick check */
+      Last = Cap->Value;
+      LastScale = Cap->Scale;
+
       /* display capacitance */
       Display_Value(Cap->Value, Cap->Scale, 'F');
 
@@ -1818,6 +3200,10 @@ void Monitor_RCL(void)
     }
     else                                 /* R or L */
     {
+      /* reference for quick check */
+      Last = R1->Value;
+      LastScale = R1->Scale;
+
       /* display resistance */
       Display_Value(R1->Value, R1->Scale, LCD_CHAR_OMEGA);
 
@@ -1829,15 +3215,47 @@ void Monitor_RCL(void)
       }
     }
 
+    #ifdef SW_REMOTE_TOOLS
+    /*
+     *  send record to remote host
+     */
+
+    if (Run == COMP_CAPACITOR)          /* C */
+    {
+      #if defined (SW_ESR) || defined (SW_OLD_ESR)
+      Tool_CapRecord(Cap, ESR);         /* C and ESR */
+      #else
+      Tool_CapRecord(Cap, UINT16_MAX);  /* C only */
+      #endif
+    }
+    else if (Tool_RecordStart())        /* none, R or L */
+    {
+      if (Run > 1)                      /* R or L */
+      {
+        Tool_RecordField(Cmd_R_str, R1->Value, R1->Scale, LCD_CHAR_OMEGA);
+
+        if (Run == COMP_INDUCTOR)       /* L */
+        {
+          Tool_RecordField(Cmd_L_str, Inductor.Value, Inductor.Scale, 'H');
+        }
+      }
+
+      Tool_RecordEnd();                 /* finish record */
+    }
+    #endif
 
-    /* user feedback (1s delay) */
-    Test = TestKey(1000, CHECK_KEY_TWICE | CHECK_BAT | CURSOR_STEADY);
+
+    /* user feedback (1s delay, shorter while stable) */
+feedback:
+    Test = TestKey(Timeout, CHECK_KEY_TWICE | CHECK_BAT | CURSOR_STEADY);
 
     if (Test == KEY_TWICE)         /* two short key presses */
     {
       Run = 0;                     /* end processing loop */
     }
   }
+
+  Check.CapRange = CAP_RANGE_NONE;      /* disable range memory */
 }
 
 #endif
@@ -1848,12 +3266,19 @@ void Monitor_RCL(void)
 
 /*
  *  monitor R plus L on probes #1 and #3
+ *  - if there's a resistor a quick reading of R (default number of ADC
+ *    samples) checks for a change first, and only a changed value
+ *    triggers a full measurement and an update of the display
  */
 
 void Monitor_RL(void)
 {
   uint8_t           Flag = 1;           /* loop control flag */
   uint8_t           Test;               /* user feedback */
+  uint8_t           Stable = 0;         /* number of stable readings */
+  uint16_t          Timeout;            /* timeout for user feedback */
+  uint32_t          Last = 0;           /* value of last measurement */
+  int8_t            LastScale = 0;      /* scale of last measurement */
   Resistor_Type     *R1;                /* pointer to resistor #1 */
 
   /* show info */
@@ -1868,8 +3293,9 @@ void Monitor_RL(void)
 
   /* init */
   R1 = &Resistors[0];                   /* pointer to first resistor */
-  /* increase number of samples to lower spread of measurement values */
-  Cfg.Samples = 100;                    /* perform 100 ADC samples */
+  #ifdef ADC_CLOCK_PROFILES
+  ADC_Profile(ADC_FAST);                /* fast ADC clock */
+  #endif
 
 
   /*
@@ -1878,6 +3304,32 @@ void Monitor_RL(void)
 
   while (Flag)
   {
+    Timeout = 1000;                     /* 1s delay after full update */
+
+    /* quick check for change of R */
+    if (Last)                           /* got resistor */
+    {
+      Cfg.Samples = ADC_SAMPLES;        /* default number of ADC samples */
+      UpdateProbes2(PROBE_1, PROBE_3);  /* set probes */
+      Check.Resistors = 0;              /* reset resistor counter */
+      CheckResistor();                  /* check for resistor */
+
+      if ((Check.Resistors == 1) &&
+          Monitor_Stable(R1->Value, R1->Scale, Last, LastScale))
+      {
+        Stable++;                       /* one more */
+        Monitor_Indicator(Stable);      /* update indicator */
+        Timeout = 250;                  /* short delay */
+        goto feedback;                  /* skip full measurement */
+      }
+    }
+
+    Stable = 0;                         /* reset counter */
+    Last = 0;                           /* reset reference */
+
+    /* increase number of samples to lower spread of measurement values */
+    Cfg.Samples = 100;                  /* perform 100 ADC samples */
+
     /* measure R and display value */
     UpdateProbes2(PROBE_1, PROBE_3);    /* set probes */
     Check.Resistors = 0;                /* reset resistor counter */
@@ -1886,6 +3338,10 @@ void Monitor_RL(void)
 
     if (Check.Resistors == 1)           /* found resistor */
     {
+      /* reference for quick check */
+      Last = R1->Value;
+      LastScale = R1->Scale;
+
       /* display value */
       Display_Value(R1->Value, R1->Scale, LCD_CHAR_OMEGA);
 
@@ -1901,8 +3357,9 @@ void Monitor_RL(void)
       Display_Minus();                  /* display: nothing */
     }
 
-    /* user feedback (1s delay) */
-    Test = TestKey(1000, CHECK_KEY_TWICE | CHECK_BAT | CURSOR_STEADY);
+    /* user feedback (1s delay, shorter while stable) */
+feedback:
+    Test = TestKey(Timeout, CHECK_KEY_TWICE | CHECK_BAT | CURSOR_STEADY);
 
     if (Test == KEY_TWICE)         /* two short key presses */
     {
@@ -1912,6 +3369,9 @@ void Monitor_RL(void)
 
   /* clean up */
   Cfg.Samples = ADC_SAMPLES;       /* set ADC samples back to default */
+  #ifdef ADC_CLOCK_PROFILES
+  ADC_Profile(ADC_PRECISE);             /* standard ADC clock */
+  #endif
 }
 
 #endif
@@ -1919,313 +3379,415 @@ void Monitor_RL(void)
 
 
 /* ************************************************************************
- *   logic probe
+ *   sorting/binning
  * ************************************************************************ */
 
 
-#ifdef HW_LOGIC_PROBE
+#ifdef SW_SORTING
 
 /*
- *  Logic Probe
- *  - analog input: TP_LOGIC
- *  - uses voltage divider (default: 4:1)
- *    LOGIC_PROBE_R1 and LOGIC_PROBE_R2
+ *  measure part for sorting tool on probes #1 and #3
+ *  - runs just the measurement required for the component type
+ *
+ *  requires:
+ *  - Type: expected component type
+ *    COMP_RESISTOR, COMP_CAPACITOR or COMP_INDUCTOR
+ *    COMP_NONE for auto-detection
+ *  - Part: pointer to part data
+ *
+ *  returns:
+ *  - component type found (COMP_NONE for no part)
  */
 
-void LogicProbe(void)
+uint8_t Sort_Measure(uint8_t Type, Fingerprint_Type *Part)
 {
-  uint8_t           Flag;               /* loop control */
-  uint8_t           Test;               /* user feedback */
-  uint8_t           Item;               /* menu item */
-  uint8_t           VccIndex;           /* index for Vcc table */
-  unsigned char     State;              /* logic state */
-  uint16_t          U1;                 /* measured voltage */
-  uint16_t          U_max = 0;          /* Vcc/Vdd */
-  uint16_t          U_low = 0;          /* voltage threshold for low */
-  uint16_t          U_high = 0;         /* voltage threshold for high */
-  uint32_t          Value;              /* temporary value */
+  uint8_t           Found = COMP_NONE;  /* return value */
 
-  /* local constants for Flag (bitfield) */
-  #define RUN_FLAG            0b00000001     /* run / otherwise end */
-  #define CHANGE_TYPE         0b00000010     /* change logic type */
-  #define CHANGE_LOW          0b00001000     /* change low threshold */
-  #define CHANGE_HIGH         0b00010000     /* change high threshold */
+  Check.Found = COMP_NONE;              /* no component */
 
-  /* local constants for Item */
-  #define ITEM_TYPE      1              /* logic type (family and Vcc) */
-  #define ITEM_LOW       2              /* voltage threshold for low */
-  #define ITEM_HIGH      3              /* voltage threshold for high */
+  if (Type != COMP_CAPACITOR)           /* none, R or L */
+  {
+    /* measure R */
+    UpdateProbes2(PROBE_1, PROBE_3);    /* set probes */
+    Check.Resistors = 0;                /* reset resistor counter */
+    CheckResistor();                    /* check for resistor */
 
+    if (Check.Resistors == 1)           /* found resistor */
+    {
+      Found = COMP_RESISTOR;
+      Part->Value = Resistors[0].Value;
+      Part->Scale = Resistors[0].Scale;
 
-  /*
-   *  show info
-   */
+      #ifdef SW_INDUCTOR
+      if (Type != COMP_RESISTOR)        /* none or L */
+      {
+        /* measure L */
+        if (MeasureInductor(&Resistors[0]) == 1)    /* got inductance */
+        {
+          Found = COMP_INDUCTOR;
+          Part->Value = Inductor.Value;
+          Part->Scale = Inductor.Scale;
+        }
+        else if (Type == COMP_INDUCTOR) /* expected L */
+        {
+          Found = COMP_NONE;            /* no inductor */
+        }
+      }
+      #endif
+    }
+  }
 
-  LCD_Clear();
-  #ifdef UI_COLORED_TITLES
-    /* display: Logic Probe */
-    Display_ColoredEEString(LogicProbe_str, COLOR_TITLE);
-  #else
-    Display_EEString(LogicProbe_str);   /* display: Logic Probe */
-  #endif
+  if ((Type == COMP_CAPACITOR) ||
+      ((Type == COMP_NONE) && (Found == COMP_NONE)))
+  {
+    /* measure C (keep probe order of normal probing cycle) */
+    MeasureCap(PROBE_3, PROBE_1, 0);
 
+    if (Check.Found == COMP_CAPACITOR)  /* found cap */
+    {
+      Found = COMP_CAPACITOR;
+      Part->Value = Caps[0].Value;
+      Part->Scale = Caps[0].Scale;
+    }
+  }
 
-  /*
-   *  init
-   */
+  Part->Found = Found;                  /* save type */
 
-  ADC_DDR &= ~(1 << TP_LOGIC);          /* set pin to HiZ */
-  Cfg.Samples = 5;                      /* do just 5 samples to be fast */
-  VccIndex = 0;                         /* TTL 5V */
-  Item = ITEM_TYPE;                     /* default item */
-  Flag = RUN_FLAG | CHANGE_TYPE | CHANGE_LOW | CHANGE_HIGH;
+  return Found;
+}
 
 
-  /*
-   *  processing loop
-   */
 
-  while (Flag > 0)
+/*
+ *  sort part into bin
+ *
+ *  requires:
+ *  - Nominal: pointer to nominal part data
+ *    (value normalized to 100000-999999)
+ *  - Part: pointer to part data
+ *  - Tolerance: tolerance in %
+ *
+ *  returns:
+ *  - BIN_LOW, BIN_PASS or BIN_HIGH
+ */
+
+uint8_t Sort_Bin(Fingerprint_Type *Nominal, Fingerprint_Type *Part, uint8_t Tolerance)
+{
+  uint8_t           Bin = BIN_PASS;     /* return value */
+  uint32_t          Value;              /* value of part */
+  uint32_t          Limit;              /* max. deviation */
+
+  /* prevent overflow when rescaling the part's value */
+  if (CmpValue(Part->Value, Part->Scale, Nominal->Value * 2, Nominal->Scale) > 0)
   {
-    /*
-     *  display family and Vcc/Vdd
-     */
+    return BIN_HIGH;                    /* way too high */
+  }
 
-    if (Flag & CHANGE_TYPE)
-    {
-      LCD_ClearLine2();                 /* line #2 */
-      MarkItem(ITEM_TYPE, Item);        /* mark item if selected */
+  /* rescale part's value to scale of nominal value */
+  Value = RescaleValue(Part->Value, Part->Scale, Nominal->Scale);
 
-      /* display family */
-      if (VccIndex == 0)                /* TTL */
-      {
-        Display_EEString(TTL_str);      /* display: TTL */
-      }
-      else                              /* CMOS */
-      {
-        Display_EEString(CMOS_str);     /* display: CMOS */
-      }
+  /* max. deviation */
+  Limit = Nominal->Value / 100;         /* 1% */
+  Limit *= Tolerance;                   /* tolerance */
 
-      /* read Vcc/Vdd from table */
-      U_max = DATA_read_word(&Logic_Vcc_table[VccIndex]);
+  if ((Value + Limit) < Nominal->Value)      /* below lower limit */
+  {
+    Bin = BIN_LOW;
+  }
+  else if (Value > (Nominal->Value + Limit)) /* above upper limit */
+  {
+    Bin = BIN_HIGH;
+  }
 
-      /* display Vcc/Vdd */
-      Display_Space();
-      U1 = U_max / 100;                 /* scale to 0.1V */
-      Display_Value(U1, -1, 'V');       /* display voltage in 0.1V */
+  return Bin;
+}
 
-      /* update thresholds */
-      if (VccIndex == 0)                /* TTL */
-      {
-        /* fixed thresholds for 5V */
-        U_low = 800;                    /* 0.8V */
-        U_high = 2000;                  /* 2.0V */
-      }
-      else                              /* CMOS */
-      {
-        /* thresholds based on Vdd (in mV) */
-        /* L: 0.3 Vdd */
-        U_low = U1 * 30;                /* U in 0.1V * 0.3 * 100 */
 
-        /* H: 0.7 Vdd */
-        U_high = U1 * 70;               /* U in 0.1V * 0.7 * 100  */
-      }
 
-      Flag &= ~CHANGE_TYPE;             /* clear flag */
-    }
+/*
+ *  display value of part including unit
+ *
+ *  requires:
+ *  - Part: pointer to part data
+ */
 
+void Sort_Value(Fingerprint_Type *Part)
+{
+  unsigned char     Unit;               /* unit char */
 
-    /*
-     *  display low threshold
-     */
+  if (Part->Found == COMP_CAPACITOR)    /* C */
+  {
+    Unit = 'F';
+  }
+  else if (Part->Found == COMP_INDUCTOR)     /* L */
+  {
+    Unit = 'H';
+  }
+  else                                  /* R */
+  {
+    Unit = LCD_CHAR_OMEGA;
+  }
 
-    if (Flag & CHANGE_LOW)
-    {
-      LCD_ClearLine3();                 /* clear line #3 */
-      MarkItem(ITEM_LOW, Item);         /* mark item if selected */
-      LCD_Char('L');                    /* display: L */
-      Display_Space();
-      U1 = U_low / 100;                 /* scale to 0.1V */
-      Display_Value(U1, -1, 'V');       /* display voltage in 0.1V */
+  Display_Value(Part->Value, Part->Scale, Unit);
+}
 
-      Flag &= ~CHANGE_LOW;              /* clear flag */
-    }
 
 
-    /*
-     *  display high threshold
-     */
+/*
+ *  sorting/binning tool for R, C or L on probes #1 and #3
+ *  - nominal value is taken from a reference part
+ *  - each inserted part is measured once and sorted into a bin
+ *  - indication by color and buzzer, running counts per bin
+ */
 
-    if (Flag & CHANGE_HIGH)
-    {
-      LCD_ClearLine(4);                 /* line #4 */
-      LCD_CharPos(1, 4);
-      MarkItem(ITEM_HIGH, Item);        /* mark item if selected */
-      LCD_Char('H');                    /* display: H */
-      Display_Space();
-      U1 = U_high / 100;                /* scale to 0.1V */
-      Display_Value(U1, -1, 'V');       /* display voltage in 0.1V */
+void Sorting_Tool(void)
+{
+  uint8_t           Mode;               /* tool mode / loop control */
+  uint8_t           Test;               /* user feedback */
+  uint8_t           Present = 0;        /* part inserted flag */
+  uint8_t           Bin;                /* bin of part */
+  uint8_t           Index = 2;          /* index for tolerance table (5%) */
+  uint8_t           Tolerance = 5;      /* tolerance in % */
+  uint16_t          Timeout;            /* timeout for user feedback */
+  uint16_t          Count[3];           /* counters for bins */
+  Fingerprint_Type  Nominal;            /* nominal part */
+  Fingerprint_Type  Part;               /* current part */
 
-      Flag &= ~CHANGE_HIGH;             /* clear flag */
-    }
+  /* local constants for Mode */
+  #define MODE_EXIT        0            /* exit tool */
+  #define MODE_REF         1            /* measure reference part */
+  #define MODE_TOL         2            /* select tolerance */
+  #define MODE_SORT        3            /* sort parts */
 
+  /* show info */
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    /* display: Sorting */
+    Display_ColoredEEString(Sorting_str, COLOR_TITLE);
+  #else
+    Display_EEString(Sorting_str);      /* display: Sorting */
+  #endif
+  ProbePinout(PROBES_RCL);              /* show probes used */
 
-    /*
-     *  display logic state
-     *  - 0, 1 or Z
-     *  - ADC pin is connected to a voltage divider (top: R1 / bottom: R2).
-     *    - U2 = (Uin / (R1 + R2)) * R2 
-     *    - Uin = (U2 * (R1 + R2)) / R2
-     */
+  /* init */
+  Check.Diodes = 0;                     /* reset diode counter */
+  Mode = MODE_REF;                      /* start with reference part */
+  Count[0] = 0;
+  Count[1] = 0;
+  Count[2] = 0;
 
-    /* get voltage */
-    U1 = ReadU(TP_LOGIC);          /* read voltage */
 
-    /* consider voltage divider */
-    Value = (((uint32_t)(LOGIC_PROBE_R1 + LOGIC_PROBE_R2) * 1000) / LOGIC_PROBE_R2);  /* factor (0.001) */
-    Value *= U1;                   /* voltage (0.001 mV) */
-    Value /= 1000;                 /* scale to mV */
-    U1 = (uint16_t)Value;          /* keep 2 bytes */
+  /*
+   *  processing loop
+   */
 
-    /* compare with thresholds  */
-    if (U1 <= U_low)               /* below low threshold */
+  while (Mode)
+  {
+    Timeout = 1000;                     /* default: 1s */
+
+    if (Mode == MODE_REF)               /* reference part */
     {
-      State = '0';                 /* 0 for low */
+      /* measure and display reference part */
+      Sort_Measure(COMP_NONE, &Part);   /* auto-detect */
+      LCD_ClearLine2();                 /* clear line #2 */
+
+      if (Part.Found != COMP_NONE)      /* got part */
+      {
+        Sort_Value(&Part);              /* display value */
+      }
+      else                              /* no part */
+      {
+        Display_Minus();                /* display: nothing */
+      }
     }
-    else if (U1 >= U_high)         /* above high threshold */
+    else if (Mode == MODE_TOL)          /* tolerance */
     {
-      State = '1';                 /* 1 for high */
+      /* display nominal value and tolerance in line #3 */
+      LCD_ClearLine3();                 /* clear line #3 */
+      Sort_Value(&Nominal);             /* display nominal value */
+      Display_Space();
+      Display_Char('+');
+      Display_Char('-');
+      Display_Value(Tolerance, 0, '%'); /* display tolerance */
+
+      Timeout = 0;                      /* wait for key press */
     }
-    else                           /* in between (undefined, HiZ) */
+    else                                /* sort */
     {
-      State = 'Z';                 /* z for undefined/HiZ */
-    }
-
-    /* display state and voltage */
-    LCD_ClearLine(5);                   /* line #5 */
-    LCD_CharPos(1, 5);
-    #ifdef LCD_COLOR
-    UI.PenColor = COLOR_SYMBOL;         /* change color */
-    #endif
-    LCD_Char(State);                    /* display state */
-    #ifdef LCD_COLOR
-    UI.PenColor = COLOR_PEN;            /* reset color */
-    #endif
-    Display_Space();
-    Display_Value(U1, -3, 'V');         /* display voltage */
+      /* measure part */
+      Sort_Measure(Nominal.Found, &Part);
 
+      if (Part.Found == COMP_NONE)      /* no part */
+      {
+        if (Present)                    /* part removed */
+        {
+          Present = 0;                  /* reset flag */
+          LCD_ClearLine2();             /* clear line #2 */
+          Display_Minus();              /* display: nothing */
+        }
+      }
+      else if (Present == 0)            /* new part */
+      {
+        Present = 1;                    /* set flag */
 
-    /*
-     *  user feedback
-     */
+        /* sort part and update counter */
+        Bin = Sort_Bin(&Nominal, &Part, Tolerance);
+        Count[Bin - 1]++;
 
-    /* check for user feedback and slow down update rate */
-    Test = TestKey(200, CHECK_KEY_TWICE | CHECK_BAT);
+        /* display value and bin in line #2 */
+        LCD_ClearLine2();               /* clear line #2 */
+        Sort_Value(&Part);              /* display value */
+        Display_Space();
+        #ifdef LCD_COLOR
+        if (Bin == BIN_PASS) UI.PenColor = COLOR_BIN_PASS;
+        else UI.PenColor = COLOR_BIN_FAIL;
+        #endif
+        if (Bin == BIN_PASS)            /* pass */
+        {
+          Display_EEString(Pass_str);   /* display: pass */
+        }
+        else if (Bin == BIN_LOW)        /* too low */
+        {
+          Display_Char('<');            /* display: < */
+        }
+        else                            /* too high */
+        {
+          Display_Char('>');            /* display: > */
+        }
+        #ifdef LCD_COLOR
+        UI.PenColor = COLOR_PEN;        /* reset color */
+        #endif
 
-    /* process user input */
-    if (Test == KEY_SHORT)              /* short key press */
-    {
-      /* select next item */
-      Item++;                           /* next item */
+        /* display counters in line #4 */
+        LCD_ClearLine(4);               /* clear line #4 */
+        LCD_CharPos(1, 4);              /* move to line #4 */
+        Display_Char('<');
+        Display_Value(Count[0], 0, 0);
+        Display_Space();
+        Display_EEString_Space(Pass_str);
+        Display_Value(Count[1], 0, 0);
+        Display_Space();
+        Display_Char('>');
+        Display_Value(Count[2], 0, 0);
+
+        /* buzzer: short beep for pass, long/double beep for fail */
+        #ifdef BUZZER_ACTIVE
+        BUZZER_PORT |= (1 << BUZZER_CTRL);   /* enable: set pin high */
+        if (Bin == BIN_PASS) MilliSleep(20); /* wait for 20 ms */
+        else MilliSleep(200);                /* wait for 200 ms */
+        BUZZER_PORT &= ~(1 << BUZZER_CTRL);  /* disable: set pin low */
+        #endif
 
-      if (Item > ITEM_HIGH)             /* overflow */
-      {
-        Item = ITEM_TYPE;               /* ... to first item */
+        #ifdef BUZZER_PASSIVE
+        if (Bin == BIN_PASS)            /* pass */
+        {
+          PassiveBuzzer(BUZZER_FREQ_HIGH);   /* high frequency beep */
+        }
+        else                            /* fail */
+        {
+          PassiveBuzzer(BUZZER_FREQ_LOW);    /* low frequency beep */
+          MilliSleep(50);
+          PassiveBuzzer(BUZZER_FREQ_LOW);    /* low frequency beep */
+        }
+        #endif
       }
 
-      Flag |= CHANGE_TYPE | CHANGE_LOW | CHANGE_HIGH;       /* update display */
+      Timeout = 100;                    /* fast polling */
     }
-    else if (Test == KEY_TWICE)         /* two short key presses */
+
+
+    /*
+     *  user feedback
+     */
+
+    Test = TestKey(Timeout, CHECK_KEY_TWICE | CHECK_BAT | CURSOR_STEADY);
+
+    if (Test == KEY_TWICE)              /* two short key presses */
     {
-      Flag = 0;                         /* end loop */
+      Mode = MODE_EXIT;                 /* end processing loop */
     }
-    else if (Test == KEY_RIGHT)         /* right key */
+    else if (Mode == MODE_REF)          /* reference part */
     {
-      if (Item == ITEM_TYPE)                 /* family and Vcc/Vdd */
+      if ((Test == KEY_SHORT) && (Part.Found != COMP_NONE))
       {
-        /* next set */
-        VccIndex++;                          /* increase index */
-        if (VccIndex >= NUM_LOGIC_TYPES)     /* overflow */
+        /* take part as nominal value */
+        Nominal = Part;
+
+        /* normalize value to 100000-999999 for binning */
+        while (Nominal.Value >= 1000000)
         {
-          VccIndex = 0;                      /* roll over to first */
+          Nominal.Value /= 10;
+          Nominal.Scale++;
         }
-        Flag |= CHANGE_TYPE | CHANGE_LOW | CHANGE_HIGH;     /* update display */
-      }
-      else if (Item == ITEM_LOW)             /* low threshold */
-      {
-        /* increase low threshold */
-        U_low += 100;                        /* + 100mV */
-        if (U_low > U_high)                  /* prevent overflow */
+        while ((Nominal.Value > 0) && (Nominal.Value < 100000))
         {
-          U_low = U_high;                    /* limit to high threshold */
+          Nominal.Value *= 10;
+          Nominal.Scale--;
         }
-        Flag |= CHANGE_LOW;                  /* update display */
-      }
-      else if (Item == ITEM_HIGH)            /* high threshold */
-      {
-        /* increase high threshold */
-        U_high += 100;                       /* + 100mV */
-        if (U_high > U_max)                  /* prevent overflow */
+
+        if (Nominal.Value > 0)          /* valid value */
         {
-          U_high = U_max;                    /* limit to Vcc/Vdd */
+          Mode = MODE_TOL;              /* select tolerance */
         }
-        Flag |= CHANGE_HIGH;                 /* update display */
       }
     }
-    else if (Test == KEY_LEFT)          /* left key */
+    else if (Mode == MODE_TOL)          /* tolerance */
     {
-      if (Item == ITEM_TYPE)                 /* family and Vcc/Vdd */
+      if (Test == KEY_LONG)             /* long key press */
       {
-        /* previous set */
-        if (VccIndex > 0)                    /* prevent underun */
+        /* start sorting */
+        Count[0] = 0;                   /* reset counters */
+        Count[1] = 0;
+        Count[2] = 0;
+        Present = 1;                    /* don't count reference part */
+        LCD_ClearLine(4);               /* clear line #4 */
+        Mode = MODE_SORT;
+      }
+      else                              /* next/previous tolerance */
+      {
+        #ifdef HW_KEYS
+        if (Test == KEY_LEFT)           /* left key */
         {
-          VccIndex--;                        /* decrease index */
+          if (Index == 0) Index = NUM_SORT_TOL;
+          Index--;
         }
-        else                                 /* roll over */
+        else if ((Test == KEY_SHORT) || (Test == KEY_RIGHT))
+        #else
+        if (Test == KEY_SHORT)          /* short key press */
+        #endif
         {
-          VccIndex = NUM_LOGIC_TYPES - 1;    /* ... to last */
+          Index++;
+          if (Index >= NUM_SORT_TOL) Index = 0;
         }
-        Flag |= CHANGE_TYPE | CHANGE_LOW | CHANGE_HIGH;     /* update display */
+
+        Tolerance = DATA_read_byte(&Sort_Tol_table[Index]);
       }
-      else if (Item == ITEM_LOW)             /* low threshold */
+    }
+    else                                /* sort */
+    {
+      if (Test == KEY_SHORT)            /* short key press */
       {
-        /* decrease low threshold */
-        if (U_low >= 100)                    /* prevent underflow (limit to 0V) */
-        {
-          U_low -= 100;                      /* - 100mV */
-        }
-        Flag |= CHANGE_LOW;                  /* update display */
+        /* new reference part */
+        LCD_ClearLine3();               /* clear line #3 */
+        LCD_ClearLine(4);               /* clear line #4 */
+        Mode = MODE_REF;
       }
-      else if (Item == ITEM_HIGH)            /* high threshold */
+      else if (Test == KEY_LONG)        /* long key press */
       {
-        /* decrease high threshold */
-        U1 = U_low + 100;                    /* limit to low threshold */
-        if (U_high >= U1)                    /* prevent underflow */
-        {
-          U_high -= 100;                     /* - 100mV */
-        }
-        Flag |= CHANGE_HIGH;                 /* update display */
+        /* reset counters */
+        Count[0] = 0;
+        Count[1] = 0;
+        Count[2] = 0;
+        Present = 0;                    /* measure current part again */
       }
     }
   }
 
-
-  /*
-   *  clean up
-   */
-
-  /* global settings */
-  Cfg.Samples = ADC_SAMPLES;            /* set ADC samples back to default */
-
-  /* local constants for Flag */
-  #undef RUN_FLAG
-  #undef CHANGE_TYPE
-  #undef CHANGE_LOW
-  #undef CHANGE_HIGH
-
-  /* local constants for Item */
-  #undef ITEM_LOW
-  #undef ITEM_HIGH
+  /* clean up */
+  #undef MODE_EXIT
+  #undef MODE_REF
+  #undef MODE_TOL
+  #undef MODE_SORT
 }
 
 #endif
@@ -2233,381 +3795,4956 @@ void LogicProbe(void)
 
 
 /* ************************************************************************
- *   continuity check
+ *   LED binning
  * ************************************************************************ */
 
 
-#ifdef SW_CONTINUITY_CHECK
+#ifdef SW_LED_BINNING
+
+/* local constants */
+#define LED_BINS         4         /* number of bins (without < and >) */
+
+
+/*
+ *  measure LED on probes #1 and #3
+ *  - checks both orientations
+ *
+ *  returns:
+ *  - pointer to diode data
+ *  - NULL if no LED was found
+ */
+
+Diode_Type *LED_Measure(void)
+{
+  Diode_Type        *LED = NULL;        /* return value */
+
+  Check.Diodes = 0;                     /* reset diode counter */
+  Check_LED(PROBE_1, PROBE_3);          /* anode at probe #1 */
+
+  if (Check.Diodes == 0)                /* not found */
+  {
+    Check_LED(PROBE_3, PROBE_1);        /* anode at probe #3 */
+  }
+
+  /* set probes to HiZ */
+  R_DDR = 0;
+  ADC_DDR = 0;
+
+  if (Check.Diodes == 1)                /* single diode */
+  {
+    LED = &Diodes[0];
+  }
+
+  return LED;
+}
+
+
+
+/*
+ *  get bin for LED
+ *  - bins 1 to LED_BINS are centered around the reference V_f
+ *
+ *  requires:
+ *  - V_f: forward voltage (mV)
+ *  - Bins: pointer to bin data
+ *
+ *  returns:
+ *  - 0 for below first bin
+ *  - 1 to LED_BINS for bin
+ *  - LED_BINS + 1 for above last bin
+ */
+
+uint8_t LED_Bin(uint16_t V_f, LED_Bins_Type *Bins)
+{
+  uint8_t           Bin = 0;            /* return value */
+  uint16_t          Low;                /* lower limit of first bin */
+
+  /* lower limit of first bin */
+  Low = (uint16_t)Bins->Step * (LED_BINS / 2);
+  if (Bins->Center > Low) Low = Bins->Center - Low;
+  else Low = 0;
+
+  if (V_f >= Low)                       /* not below */
+  {
+    V_f = (V_f - Low) / Bins->Step;     /* number of bins above limit */
+
+    if (V_f < LED_BINS) Bin = V_f + 1;  /* in one of the bins */
+    else Bin = LED_BINS + 1;            /* above */
+  }
+
+  return Bin;
+}
+
+
+
+/*
+ *  display bin designator
+ *
+ *  requires:
+ *  - Bin: bin number (0 to LED_BINS + 1)
+ */
+
+void LED_ShowBin(uint8_t Bin)
+{
+  if (Bin == 0)                         /* below */
+  {
+    Display_Char('<');
+  }
+  else if (Bin > LED_BINS)              /* above */
+  {
+    Display_Char('>');
+  }
+  else                                  /* bin */
+  {
+    Display_Char('0' + Bin);
+  }
+}
+
+
+
+/*
+ *  display bins (center and width) in line #3
+ *
+ *  requires:
+ *  - Bins: pointer to bin data
+ */
+
+void LED_ShowBins(LED_Bins_Type *Bins)
+{
+  LCD_ClearLine3();                     /* clear line #3 */
+  Display_Value(Bins->Center, -3, 'V'); /* center */
+  Display_Char('/');
+  Display_Value(Bins->Step, -3, 'V');   /* width */
+}
+
+
+
+/*
+ *  LED binning tool on probes #1 and #3
+ *  - bins are centered around the V_f of a reference LED
+ *  - each inserted LED is measured once and sorted into a bin
+ *  - indication by buzzer, running counts per bin
+ */
+
+void LED_Binning_Tool(void)
+{
+  uint8_t           Mode;               /* tool mode / loop control */
+  uint8_t           Test;               /* user feedback */
+  uint8_t           Present = 0;        /* LED inserted flag */
+  uint8_t           Bin;                /* bin of LED */
+  uint8_t           Index = 1;          /* index for width table (20mV) */
+  uint8_t           n;                  /* counter */
+  uint16_t          Timeout;            /* timeout for user feedback */
+  uint16_t          Count[LED_BINS + 2];     /* counters for bins */
+  LED_Bins_Type     Bins;               /* bins */
+  Diode_Type        *LED;               /* current LED */
+
+  /* local constants for Mode */
+  #define MODE_EXIT        0            /* exit tool */
+  #define MODE_REF         1            /* measure reference LED */
+  #define MODE_STEP        2            /* select bin width */
+  #define MODE_SORT        3            /* sort LEDs */
+
+  /* show info */
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    /* display: LED Binning */
+    Display_ColoredEEString(LED_Binning_str, COLOR_TITLE);
+  #else
+    Display_EEString(LED_Binning_str);  /* display: LED Binning */
+  #endif
+  ProbePinout(PROBES_RCL);              /* show probes used */
+
+  /* load bins from EEPROM */
+  eeprom_read_block((void *)&Bins, (const void *)&NV_LED_Bins, sizeof(LED_Bins_Type));
+
+  /* get index of bin width */
+  n = 0;
+  while (n < NUM_LED_STEPS)
+  {
+    if (DATA_read_byte(&LED_Step_table[n]) == Bins.Step) break;
+    n++;
+  }
+
+  if (n < NUM_LED_STEPS)                /* valid width */
+  {
+    Index = n;
+  }
+  else                                  /* EEPROM not written yet */
+  {
+    Bins.Center = 2000;                 /* 2.000V */
+    Bins.Step = DATA_read_byte(&LED_Step_table[Index]);
+  }
+
+  /* init */
+  Mode = MODE_REF;                      /* start with reference LED */
+  for (n = 0; n < LED_BINS + 2; n++) Count[n] = 0;
+
+
+  /*
+   *  processing loop
+   */
+
+  while (Mode)
+  {
+    Timeout = 1000;                     /* default: 1s */
+
+    if (Mode == MODE_REF)               /* reference LED */
+    {
+      /* measure and display reference LED */
+      LED = LED_Measure();
+      LCD_ClearLine2();                 /* clear line #2 */
+
+      if (LED)                          /* got LED */
+      {
+        Display_Value(LED->V_f, -3, 'V');     /* V_f at high current */
+        Display_Space();
+        Display_Value(LED->V_f2, -3, 'V');    /* V_f at low current */
+      }
+      else                              /* no LED */
+      {
+        Display_Minus();                /* display: nothing */
+      }
+
+      LED_ShowBins(&Bins);              /* display stored bins */
+    }
+    else if (Mode == MODE_STEP)         /* bin width */
+    {
+      LED_ShowBins(&Bins);              /* display new bins */
+      Timeout = 0;                      /* wait for key press */
+    }
+    else                                /* sort */
+    {
+      /* measure LED */
+      LED = LED_Measure();
+
+      if (LED == NULL)                  /* no LED */
+      {
+        if (Present)                    /* LED removed */
+        {
+          Present = 0;                  /* reset flag */
+          LCD_ClearLine2();             /* clear line #2 */
+          Display_Minus();              /* display: nothing */
+        }
+      }
+      else if (Present == 0)            /* new LED */
+      {
+        Present = 1;                    /* set flag */
+
+        /* sort LED and update counter */
+        Bin = LED_Bin(LED->V_f, &Bins);
+        Count[Bin]++;
+
+        /* display V_f and bin in line #2 */
+        LCD_ClearLine2();               /* clear line #2 */
+        Display_Value(LED->V_f, -3, 'V');     /* V_f at high current */
+        Display_Space();
+        Display_Value(LED->V_f2, -3, 'V');    /* V_f at low current */
+        Display_Space();
+        #ifdef LCD_COLOR
+        if ((Bin == 0) || (Bin > LED_BINS)) UI.PenColor = COLOR_BIN_FAIL;
+        else UI.PenColor = COLOR_BIN_PASS;
+        #endif
+        LED_ShowBin(Bin);               /* display bin */
+        #ifdef LCD_COLOR
+        UI.PenColor = COLOR_PEN;        /* reset color */
+        #endif
+
+        /* display counters in lines #3 and #4 */
+        LCD_ClearLine3();               /* clear line #3 */
+        for (n = 0; n < LED_BINS + 2; n++)
+        {
+          if (n == (LED_BINS + 2) / 2)  /* second half */
+          {
+            LCD_ClearLine(4);           /* clear line #4 */
+            LCD_CharPos(1, 4);          /* move to line #4 */
+          }
+          else if (n > 0)               /* not first one */
+          {
+            Display_Space();
+          }
+
+          LED_ShowBin(n);               /* display bin */
+          if ((n > 0) && (n <= LED_BINS)) Display_Colon();
+          Display_Value(Count[n], 0, 0);
+        }
+
+        /* buzzer: short beep for bin, long/double beep for < and > */
+        #ifdef BUZZER_ACTIVE
+        BUZZER_PORT |= (1 << BUZZER_CTRL);   /* enable: set pin high */
+        if ((Bin == 0) || (Bin > LED_BINS)) MilliSleep(200);   /* wait for 200 ms */
+        else MilliSleep(20);                 /* wait for 20 ms */
+        BUZZER_PORT &= ~(1 << BUZZER_CTRL);  /* disable: set pin low */
+        #endif
+
+        #ifdef BUZZER_PASSIVE
+        if ((Bin == 0) || (Bin > LED_BINS))  /* outside bins */
+        {
+          PassiveBuzzer(BUZZER_FREQ_LOW);    /* low frequency beep */
+          MilliSleep(50);
+          PassiveBuzzer(BUZZER_FREQ_LOW);    /* low frequency beep */
+        }
+        else                            /* in bin */
+        {
+          PassiveBuzzer(BUZZER_FREQ_HIGH);   /* high frequency beep */
+        }
+        #endif
+      }
+
+      Timeout = 100;                    /* fast polling */
+    }
+
+
+    /*
+     *  user feedback
+     */
+
+    Test = TestKey(Timeout, CHECK_KEY_TWICE | CHECK_BAT | CURSOR_STEADY);
+
+    if (Test == KEY_TWICE)              /* two short key presses */
+    {
+      Mode = MODE_EXIT;                 /* end processing loop */
+    }
+    else if (Mode == MODE_REF)          /* reference LED */
+    {
+      if ((Test == KEY_SHORT) && LED)   /* got LED */
+      {
+        /* take V_f of LED as center of bins */
+        Bins.Center = LED->V_f;
+        Mode = MODE_STEP;               /* select bin width */
+      }
+      else if (Test == KEY_LONG)        /* long key press */
+      {
+        /* keep stored bins */
+        Mode = MODE_SORT;
+      }
+    }
+    else if (Mode == MODE_STEP)         /* bin width */
+    {
+      if (Test == KEY_LONG)             /* long key press */
+      {
+        /* save bins to EEPROM */
+        #ifdef SW_PERF_COUNTERS
+        PerfCount[PERF_EEPROM]++; /* count EEPROM write */
+        #endif
+        eeprom_update_block((const void *)&Bins, (void *)&NV_LED_Bins, sizeof(LED_Bins_Type));
+        Mode = MODE_SORT;
+      }
+      else                              /* next/previous width */
+      {
+        #ifdef HW_KEYS
+        if (Test == KEY_LEFT)           /* left key */
+        {
+          if (Index == 0) Index = NUM_LED_STEPS;
+          Index--;
+        }
+        else if ((Test == KEY_SHORT) || (Test == KEY_RIGHT))
+        #else
+        if (Test == KEY_SHORT)          /* short key press */
+        #endif
+        {
+          Index++;
+          if (Index >= NUM_LED_STEPS) Index = 0;
+        }
+
+        Bins.Step = DATA_read_byte(&LED_Step_table[Index]);
+      }
+    }
+    else                                /* sort */
+    {
+      if (Test == KEY_SHORT)            /* short key press */
+      {
+        /* new reference LED */
+        LCD_ClearLine(4);               /* clear line #4 */
+        Mode = MODE_REF;
+      }
+      /* long key press: reset counters (see below) */
+    }
+
+    if ((Mode == MODE_SORT) && (Test == KEY_LONG))   /* start or restart */
+    {
+      /* reset counters */
+      for (n = 0; n < LED_BINS + 2; n++) Count[n] = 0;
+
+      /* skip LED which is still inserted */
+      Present = 1;
+      LCD_ClearLine2();                 /* clear line #2 */
+      Display_Minus();
+      LCD_ClearLine3();                 /* clear line #3 */
+      LCD_ClearLine(4);                 /* clear line #4 */
+    }
+  }
+
+  /* clean up */
+  #undef MODE_EXIT
+  #undef MODE_REF
+  #undef MODE_STEP
+  #undef MODE_SORT
+}
+
+/* clean up local constants */
+#undef LED_BINS
+
+#endif
+
+
+
+/* ************************************************************************
+ *   compare (golden part)
+ * ************************************************************************ */
+
+
+#ifdef FUNC_COMPARE
+
+/*
+ *  get reference part for compare tool from last probing result
+ *  - component type and pinout
+ *
+ *  requires:
+ *  - Ref: pointer to reference data
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 if component isn't supported
+ */
+
+uint8_t Compare_Init(Golden_Type *Ref)
+{
+  uint8_t           Flag = 1;           /* return value */
+  uint8_t           n;                  /* counter */
+  Capacitor_Type    *MaxCap;            /* pointer to largest cap */
+
+  /* type and pins of 3-pin semiconductors */
+  Ref->Found = Check.Found;
+  Ref->Type = Check.Type & (TYPE_NPN | TYPE_PNP);  /* also n/p-channel */
+  Ref->A = Semi.A;
+  Ref->B = Semi.B;
+  Ref->C = Semi.C;
+
+  switch (Check.Found)
+  {
+    case COMP_RESISTOR:
+      if (Check.Resistors != 1) Flag = 0;   /* single resistor only */
+      Ref->A = Resistors[0].A;
+      Ref->B = Resistors[0].B;
+      break;
+
+    case COMP_CAPACITOR:
+      /* find largest cap (same as Show_Capacitor()) */
+      MaxCap = &Caps[0];
+      for (n = 1; n <= 2; n++)
+      {
+        if (CmpValue(Caps[n].Value, Caps[n].Scale, MaxCap->Value, MaxCap->Scale) == 1)
+        {
+          MaxCap = &Caps[n];
+        }
+      }
+      Ref->A = MaxCap->A;
+      Ref->B = MaxCap->B;
+      break;
+
+    case COMP_DIODE:
+      if (Check.Diodes != 1) Flag = 0;      /* single diode only */
+      Ref->A = Diodes[0].A;                 /* anode */
+      Ref->B = Diodes[0].C;                 /* cathode */
+      break;
+
+    case COMP_BJT:
+      break;
+
+    case COMP_FET:
+    case COMP_IGBT:
+      /* enhancement mode only */
+      if (Check.Type & TYPE_DEPLETION) Flag = 0;
+      break;
+
+    default:                                /* not supported */
+      Flag = 0;
+      break;
+  }
+
+  if (Flag == 0) Ref->Found = COMP_NONE;    /* no reference */
+
+  return Flag;
+}
+
+
+
+/*
+ *  get V_f of a diode found by the compare tool
+ *
+ *  requires:
+ *  - Anode: probe ID of anode
+ *  - Cathode: probe ID of cathode
+ *
+ *  returns:
+ *  - V_f in mV
+ *  - 0 if there's no matching diode
+ */
+
+uint16_t Compare_Vf(uint8_t Anode, uint8_t Cathode)
+{
+  uint16_t          U = 0;              /* return value */
+  uint8_t           n = 0;              /* counter */
+
+  while (n < Check.Diodes)
+  {
+    if ((Diodes[n].A == Anode) && (Diodes[n].C == Cathode))
+    {
+      U = Diodes[n].V_f;                /* high current V_f */
+    }
+
+    n++;
+  }
+
+  return U;
+}
+
+
+
+/*
+ *  targeted measurement of the reference part's parameters
+ *  - uses just the pinout of the reference part
+ *  - runs only the checks required for the component type
+ *
+ *  requires:
+ *  - Ref: pointer to reference data (type and pinout)
+ *  - Part: pointer to part data (may be same as Ref)
+ *
+ *  returns:
+ *  - 1 if component with same type and pinout was found
+ *  - 0 if not
+ */
+
+uint8_t Compare_Measure(Golden_Type *Ref, Golden_Type *Part)
+{
+  uint8_t           Flag = 0;           /* return value */
+  uint8_t           Probe;              /* remaining probe */
+
+  /* reset check results (same as probing cycle) */
+  Check.Found = COMP_NONE;
+  Check.Type = 0;
+  Check.Done = DONE_NONE;
+  Check.AltFound = COMP_NONE;
+  Check.Diodes = 0;
+  Check.Resistors = 0;
+  Semi.Flags = 0;
+  Semi.U_1 = 0;
+  Semi.U_2 = 0;
+  Semi.U_3 = 0;
+  Semi.F_1 = 0;
+  #ifdef SW_REVERSE_HFE
+  Semi.F_2 = 0;
+  #endif
+
+  /* reset part data */
+  Part->Scale = 0;
+  Part->Value = 0;
+  Part->U = 0;
+
+  DischargeProbes();                    /* try to discharge probes */
+  if (Check.Found == COMP_ERROR) return Flag;     /* discharge failed */
+
+  /* probe not used by 2-pin components */
+  Probe = 3 - Ref->A - Ref->B;
+
+  if (Ref->Found == COMP_RESISTOR)           /* resistor */
+  {
+    /* measure in both directions, same order as CheckProbes() */
+    UpdateProbes2(Ref->B, Ref->A);
+    CheckResistor();
+    UpdateProbes2(Ref->A, Ref->B);
+    CheckResistor();
+
+    /* confirmed single resistor */
+    if ((Check.Found == COMP_RESISTOR) && (Check.Resistors == 1))
+    {
+      Part->Value = Resistors[0].Value;
+      Part->Scale = Resistors[0].Scale;
+      Flag = 1;
+    }
+  }
+  else if (Ref->Found == COMP_CAPACITOR)     /* capacitor */
+  {
+    /* measure cap: probe B pulled up, probe A pulled down */
+    MeasureCap(Ref->B, Ref->A, 0);
+
+    if (Check.Found == COMP_CAPACITOR)
+    {
+      Part->Value = Caps[0].Value;
+      Part->Scale = Caps[0].Scale;
+      Flag = 1;
+    }
+  }
+  else if (Ref->Found == COMP_DIODE)         /* diode */
+  {
+    /* probe-1 = anode, probe-2 = cathode */
+    CheckProbes(Ref->A, Ref->B, Probe);
+
+    Part->U = Compare_Vf(Ref->A, Ref->B);    /* get V_f */
+    if (Part->U > 0) Flag = 1;               /* found diode */
+  }
+  else                                       /* BJT, FET or IGBT */
+  {
+    if (Ref->Found == COMP_BJT)              /* BJT */
+    {
+      /* B-E diode for V_BE: probe-1 = anode, probe-2 = cathode */
+      if (Ref->Type == TYPE_NPN)        /* NPN */
+      {
+        CheckProbes(Ref->A, Ref->C, Ref->B);      /* B -> E */
+      }
+      else                              /* PNP */
+      {
+        CheckProbes(Ref->C, Ref->A, Ref->B);      /* E -> B */
+      }
+    }
+
+    /*
+     *  transistor (pin A = B/G, pin B = C/D, pin C = E/S):
+     *  - NPN/n-ch: probe-1 = C/D, probe-2 = E/S, probe-3 = B/G
+     *  - PNP/p-ch: probe-1 = E/S, probe-2 = C/D, probe-3 = B/G
+     */
+
+    if (Ref->Type == TYPE_NPN)          /* NPN or n-channel */
+    {
+      CheckProbes(Ref->B, Ref->C, Ref->A);
+    }
+    else                                /* PNP or p-channel */
+    {
+      CheckProbes(Ref->C, Ref->B, Ref->A);
+    }
+
+    /* same component type and pinout */
+    if ((Check.Found == Ref->Found) &&
+        ((Check.Type & (TYPE_NPN | TYPE_PNP)) == Ref->Type) &&
+        (Semi.A == Ref->A) && (Semi.B == Ref->B) && (Semi.C == Ref->C))
+    {
+      if (Ref->Found == COMP_BJT)            /* BJT */
+      {
+        Part->Value = Semi.F_1;              /* hFE */
+
+        /* V_BE (V_f of B-E diode) */
+        if (Ref->Type == TYPE_NPN)      /* NPN */
+        {
+          Part->U = Compare_Vf(Ref->A, Ref->C);
+        }
+        else                            /* PNP */
+        {
+          Part->U = Compare_Vf(Ref->C, Ref->A);
+        }
+      }
+      else                                   /* FET or IGBT */
+      {
+        Part->Value = Semi.U_1;              /* R_DS_on (0 for IGBT) */
+        Part->Scale = -2;                    /* 0.01 Ohms */
+        Part->U = Semi.U_2;                  /* V_th */
+      }
+
+      Flag = 1;
+    }
+  }
+
+  return Flag;
+}
+
+#endif
+
+
+
+#ifdef SW_COMPARE
+
+/*
+ *  compare value with reference value
+ *  - tolerance COMPARE_TOL (in %)
+ *
+ *  requires:
+ *  - RefValue: reference value
+ *  - RefScale: exponent of reference value (value * 10^x)
+ *  - Value: value
+ *  - Scale: exponent of value (value * 10^x)
+ *
+ *  returns:
+ *  - BIN_LOW, BIN_PASS or BIN_HIGH
+ */
+
+uint8_t Compare_Value(uint32_t RefValue, int8_t RefScale, uint32_t Value, int8_t Scale)
+{
+  uint8_t           Bin = BIN_PASS;     /* return value */
+  uint32_t          Limit;              /* max. deviation */
+
+  /* max. deviation */
+  if (RefValue > 10000000)              /* large value */
+  {
+    /* prevent overflow */
+    Limit = RefValue / 100;             /* 1% */
+    Limit *= COMPARE_TOL;               /* tolerance */
+  }
+  else                                  /* small value */
+  {
+    /* keep resolution (e.g. hFE) */
+    Limit = RefValue * COMPARE_TOL;     /* tolerance */
+    Limit /= 100;                       /* in % */
+  }
+
+  if (CmpValue(Value, Scale, RefValue - Limit, RefScale) < 0)
+  {
+    Bin = BIN_LOW;                      /* below lower limit */
+  }
+  else if (CmpValue(Value, Scale, RefValue + Limit, RefScale) > 0)
+  {
+    Bin = BIN_HIGH;                     /* above upper limit */
+  }
+
+  return Bin;
+}
+
+
+
+/*
+ *  display deviating parameter of compare tool
+ *
+ *  requires:
+ *  - Line: line number
+ *  - String: name of parameter (NULL for none)
+ *  - Value: value
+ *  - Scale: exponent of factor (value * 10^x)
+ *  - Unit: unit char (0 for none)
+ *  - Bin: BIN_LOW or BIN_HIGH
+ */
+
+void Compare_Show(uint8_t Line, const unsigned char *String, int32_t Value, int8_t Scale, unsigned char Unit, uint8_t Bin)
+{
+  LCD_ClearLine(Line);                  /* clear line */
+  LCD_CharPos(1, Line);                 /* move to start of line */
+
+  #ifdef LCD_COLOR
+  UI.PenColor = COLOR_BIN_FAIL;         /* change color */
+  #endif
+
+  if (String)                           /* got name */
+  {
+    Display_EEString_Space(String);     /* display name */
+  }
+  Display_SignedValue(Value, Scale, Unit);   /* display value */
+  Display_Space();
+
+  if (Bin == BIN_LOW)                   /* too low */
+  {
+    Display_Char('<');                  /* display: < */
+  }
+  else                                  /* too high */
+  {
+    Display_Char('>');                  /* display: > */
+  }
+
+  #ifdef LCD_COLOR
+  UI.PenColor = COLOR_PEN;              /* reset color */
+  #endif
+}
+
+
+
+/*
+ *  compare tool for checking parts against a known-good one
+ *  - reference is the last probing result (type and pinout)
+ *  - re-measures just the reference part's parameters and
+ *    displays only deviations beyond the limits
+ */
+
+void Compare_Tool(void)
+{
+  uint8_t           Flag;               /* loop control */
+  uint8_t           Test;               /* user feedback */
+  uint8_t           Line;               /* line number */
+  uint8_t           Bin;                /* deviation */
+  int16_t           Diff;               /* voltage difference */
+  unsigned char     Unit;               /* unit char */
+  const unsigned char *Value_str;       /* name of value */
+  const unsigned char *U_str;           /* name of voltage */
+  Golden_Type       Golden;             /* reference part */
+  Golden_Type       Part;               /* current part */
+
+  /* show info */
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    /* display: Compare */
+    Display_ColoredEEString(Compare_str, COLOR_TITLE);
+  #else
+    Display_EEString(Compare_str);      /* display: Compare */
+  #endif
+
+  /* reference part: type and pinout of last probing result */
+  Flag = Compare_Init(&Golden);
+
+  if (Flag)                             /* supported part */
+  {
+    /* get reference values using the same targeted measurement */
+    Flag = Compare_Measure(&Golden, &Golden);
+  }
+
+  if (Flag == 0)                        /* no reference */
+  {
+    LCD_ClearLine2();                   /* clear line #2 */
+    Display_EEString(Failed1_str);      /* display: No component */
+    WaitKey();                          /* let the user read */
+  }
+
+  /* names and units of parameters */
+  Value_str = NULL;                     /* R or C: just the unit */
+  Unit = LCD_CHAR_OMEGA;                /* R or R_DS_on */
+  U_str = Vth_str;                      /* FET or IGBT */
+
+  if (Golden.Found == COMP_CAPACITOR)
+  {
+    Unit = 'F';
+  }
+  else if (Golden.Found == COMP_DIODE)
+  {
+    U_str = Vf_str;
+  }
+  else if (Golden.Found == COMP_BJT)
+  {
+    Value_str = h_FE_str;
+    Unit = 0;
+    U_str = V_BE_str;
+  }
+  else if (Golden.Found >= COMP_FET)    /* FET or IGBT */
+  {
+    Value_str = R_DS_str;
+  }
+
+
+  /*
+   *  processing loop
+   */
+
+  while (Flag)
+  {
+    /* targeted re-measurement */
+    Test = Compare_Measure(&Golden, &Part);
+
+    LCD_ClearLine2();                   /* clear line #2 */
+    LCD_ClearLine3();                   /* clear line #3 */
+    Line = 2;                           /* start with line #2 */
+
+    if (Test == 0)                      /* no or different part */
+    {
+      LCD_CharPos(1, 2);                /* move to line #2 */
+      Display_EEString(Failed1_str);    /* display: No component */
+    }
+    else                                /* same part */
+    {
+      /* value: R, C, hFE or R_DS_on */
+      if (Golden.Value > 0)             /* got value */
+      {
+        Bin = Compare_Value(Golden.Value, Golden.Scale, Part.Value, Part.Scale);
+
+        if (Bin != BIN_PASS)            /* deviation */
+        {
+          Compare_Show(Line, Value_str, Part.Value, Part.Scale, Unit, Bin);
+          Line++;                       /* next line */
+        }
+      }
+
+      /* voltage: V_f, V_BE or V_th */
+      if (Golden.Found >= COMP_DIODE)   /* semiconductor */
+      {
+        Diff = Part.U - Golden.U;
+
+        if ((Diff > COMPARE_TOL_U) || (Diff < -COMPARE_TOL_U))
+        {
+          if (Diff < 0) Bin = BIN_LOW;
+          else Bin = BIN_HIGH;
+
+          Compare_Show(Line, U_str, Part.U, -3, 'V', Bin);
+          Line++;                       /* next line */
+        }
+      }
+
+      if (Line == 2)                    /* no deviation */
+      {
+        LCD_CharPos(1, 2);              /* move to line #2 */
+        #ifdef LCD_COLOR
+        UI.PenColor = COLOR_BIN_PASS;   /* change color */
+        #endif
+        Display_EEString(Pass_str);     /* display: pass */
+        #ifdef LCD_COLOR
+        UI.PenColor = COLOR_PEN;        /* reset color */
+        #endif
+      }
+    }
+
+
+    /*
+     *  user feedback
+     */
+
+    Test = TestKey(1000, CHECK_KEY_TWICE | CHECK_BAT | CURSOR_STEADY);
+
+    if (Test == KEY_TWICE)              /* two short key presses */
+    {
+      Flag = 0;                         /* end processing loop */
+    }
+  }
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   transistor matching
+ * ************************************************************************ */
+
+
+#ifdef SW_MATCHING
+
+/*
+ *  get spread of a group of matched parts
+ *  - score: value spread (in 0.1%) + voltage spread (in 0.1mV)
+ *    (1mV counts like 1%)
+ *
+ *  requires:
+ *  - Parts: pointer to array of parts
+ *  - Index: pointer to array of indexes of the group's parts
+ *    (sorted by value)
+ *  - Size: number of parts in group
+ *  - Value: pointer to variable for value spread (in 0.1%)
+ *  - U: pointer to variable for voltage spread (in mV)
+ *
+ *  returns:
+ *  - score (lower is better)
+ */
+
+uint32_t Match_Spread(Match_Type *Parts, uint8_t *Index, uint8_t Size, uint16_t *Value, uint16_t *U)
+{
+  uint32_t          Spread;             /* value spread */
+  int16_t           U_Min, U_Max;       /* min/max voltage */
+  uint8_t           n;                  /* counter */
+
+  /* value spread: (max - min) / min, in 0.1% */
+  Spread = Parts[Index[Size - 1]].Value - Parts[Index[0]].Value;
+  Spread *= 1000;
+  if (Parts[Index[0]].Value > 0) Spread /= Parts[Index[0]].Value;
+  if (Spread > UINT16_MAX) Spread = UINT16_MAX;
+  *Value = (uint16_t)Spread;
+
+  /* voltage spread */
+  U_Min = Parts[Index[0]].U;
+  U_Max = U_Min;
+  n = 1;
+  while (n < Size)
+  {
+    if (Parts[Index[n]].U < U_Min) U_Min = Parts[Index[n]].U;
+    if (Parts[Index[n]].U > U_Max) U_Max = Parts[Index[n]].U;
+    n++;
+  }
+  *U = U_Max - U_Min;
+
+  return (Spread + ((uint32_t)*U * 10));
+}
+
+
+
+/*
+ *  find and report closest-matching groups of parts
+ *  - groups are formed from parts with neighbouring values, best
+ *    group first, each part is used only once
+ *  - output to display and TTL serial
+ *
+ *  requires:
+ *  - Parts: pointer to array of parts
+ *  - Count: number of parts
+ *  - Size: parts per group (2 or 4)
+ */
+
+void Match_Report(Match_Type *Parts, uint8_t Count, uint8_t Size)
+{
+  uint8_t           Sorted[MATCH_PARTS];     /* part indexes sorted by value */
+  uint8_t           Group[4];           /* part indexes of group */
+  uint8_t           Best[4];            /* part indexes of best group */
+  uint8_t           n, m, k;            /* counters */
+  uint8_t           Start;              /* start position of group */
+  uint8_t           Found;              /* number of parts in group */
+  uint16_t          Used = 0;           /* used parts (bitfield) */
+  uint16_t          Value;              /* value spread */
+  uint16_t          U;                  /* voltage spread */
+  uint32_t          Score;              /* score of group */
+  uint32_t          Best_Score;         /* score of best group */
+  #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+  uint8_t           Control;            /* output control */
+  #endif
+
+  /* sort part indexes by value (insertion sort) */
+  n = 0;
+  while (n < Count)
+  {
+    m = n;
+    while ((m > 0) && (Parts[Sorted[m - 1]].Value > Parts[n].Value))
+    {
+      Sorted[m] = Sorted[m - 1];
+      m--;
+    }
+    Sorted[m] = n;
+    n++;
+  }
+
+  /* display: groups in lines #2 and up */
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    /* display: Matching */
+    Display_ColoredEEString(Matching_str, COLOR_TITLE);
+  #else
+    Display_EEString(Matching_str);     /* display: Matching */
+  #endif
+
+  /* next-line mode: keep first line and wait for key/timeout */
+  UI.LineMode = LINE_KEEP | LINE_KEY;
+
+  #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+  Control = Cfg.OP_Control;             /* save output control */
+  Cfg.OP_Control |= OP_OUT_SER;         /* enable serial output */
+  Serial_NewLine();
+  #endif
+
+  n = Count;                            /* parts left */
+  while (n >= Size)                     /* enough parts left */
+  {
+    /* find best group of neighbouring unused parts */
+    Best_Score = UINT32_MAX;
+    Start = 0;
+    while (Start < Count)               /* loop through start positions */
+    {
+      /* get next unused parts */
+      Found = 0;
+      m = Start;
+      while ((m < Count) && (Found < Size))
+      {
+        k = Sorted[m];
+        if (! (Used & (1 << k)))        /* unused part */
+        {
+          Group[Found] = k;
+          Found++;
+        }
+        m++;
+      }
+
+      if (Found == Size)                /* complete group */
+      {
+        Score = Match_Spread(Parts, Group, Size, &Value, &U);
+        if (Score < Best_Score)         /* better group */
+        {
+          Best_Score = Score;
+          for (k = 0; k < Size; k++) Best[k] = Group[k];
+        }
+      }
+
+      Start++;                          /* next start position */
+    }
+
+    if (Best_Score == UINT32_MAX) break;     /* no group left */
+
+    /* mark parts as used */
+    for (k = 0; k < Size; k++) Used |= (1 << Best[k]);
+    n -= Size;
+
+    /* report group: part numbers, value spread, voltage spread */
+    Match_Spread(Parts, Best, Size, &Value, &U);
+    Display_NextLine();
+    for (k = 0; k < Size; k++)
+    {
+      if (k > 0) Display_Char('-');
+      Display_Value(Best[k] + 1, 0, 0);
+    }
+    Display_Space();
+    Display_Value(Value, -1, '%');
+    Display_Space();
+    Display_Value(U, -3, 'V');
+  }
+
+  #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+  Cfg.OP_Control = Control;             /* restore output control */
+  #endif
+
+  WaitKey();                            /* let the user read */
+  UI.LineMode = LINE_STD;               /* reset next-line mode */
+}
+
+
+
+/*
+ *  transistor matching tool
+ *  - type and pinout are taken from the last probing result (BJT or JFET)
+ *  - each inserted part is measured by the targeted measurement of the
+ *    compare tool and recorded
+ *  - BJT: hFE, V_BE and I_CEO
+ *  - JFET: I_DSS and V_GS(off)
+ *  - shows running statistics (count, min and max) and reports the
+ *    closest-matching pairs or quads
+ */
+
+void Matching_Tool(void)
+{
+  uint8_t           Flag;               /* loop control */
+  uint8_t           Test;               /* user feedback */
+  uint8_t           Present = 0;        /* part inserted flag */
+  uint8_t           Update = 1;         /* display update flag */
+  uint8_t           Count = 0;          /* number of recorded parts */
+  uint8_t           Size = 2;           /* parts per group */
+  uint8_t           n;                  /* counter */
+  int8_t            Scale = 0;          /* exponent of value */
+  unsigned char     Unit = 0;           /* unit of value */
+  Match_Type        Parts[MATCH_PARTS]; /* recorded parts */
+  Match_Type        *Part;              /* current part */
+  Match_Type        Min, Max;           /* statistics */
+  Golden_Type       Ref;                /* reference type and pinout */
+  Golden_Type       Data;               /* measurement data */
+  #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+  uint8_t           Control;            /* output control */
+  #endif
+
+  /* show info */
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    /* display: Matching */
+    Display_ColoredEEString(Matching_str, COLOR_TITLE);
+  #else
+    Display_EEString(Matching_str);     /* display: Matching */
+  #endif
+
+  /* reference: type and pinout of last probing result */
+  Flag = 0;
+  if (Check.Found == COMP_BJT)          /* BJT */
+  {
+    Flag = Compare_Init(&Ref);
+  }
+  else if ((Check.Found == COMP_FET) && (Check.Type & TYPE_JFET))
+  {
+    /* JFET (not supported by Compare_Init()) */
+    Ref.Found = COMP_FET;
+    Ref.Type = Check.Type & (TYPE_N_CHANNEL | TYPE_P_CHANNEL);
+    Ref.A = Semi.A;
+    Ref.B = Semi.B;
+    Ref.C = Semi.C;
+    Scale = -6;                         /* I_DSS in A */
+    Unit = 'A';
+    Flag = 1;
+  }
+
+  if (Flag == 0)                        /* no reference */
+  {
+    LCD_ClearLine2();                   /* clear line #2 */
+    Display_EEString(Failed1_str);      /* display: No component */
+    WaitKey();                          /* let the user read */
+  }
+
+
+  /*
+   *  processing loop
+   */
+
+  while (Flag)
+  {
+    /* targeted measurement */
+    Test = Compare_Measure(&Ref, &Data);
+
+    if (Test == 0)                      /* no or different part */
+    {
+      if (Present)                      /* part removed */
+      {
+        Present = 0;                    /* reset flag */
+        Update = 1;                     /* update display */
+      }
+    }
+    else if (Present == 0)              /* new part */
+    {
+      Present = 1;                      /* set flag */
+      Update = 1;                       /* update display */
+
+      if (Count < MATCH_PARTS)          /* free slot */
+      {
+        /* record part */
+        Part = &Parts[Count];
+        Count++;
+
+        if (Ref.Found == COMP_BJT)      /* BJT */
+        {
+          Part->Value = Data.Value;          /* hFE */
+          Part->U = Data.U;                  /* V_BE */
+          Part->I = RescaleValue(Semi.I_value, Semi.I_scale, -9);   /* I_CEO */
+        }
+        else                            /* JFET */
+        {
+          Part->Value = Semi.I_value;        /* I_DSS */
+          Part->U = Semi.U_3;                /* V_GS(off) */
+          if (Part->U < 0) Part->U = -Part->U;    /* magnitude */
+          Part->I = 0;
+        }
+
+        #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+        /* send part via TTL serial: number,value,U in mV,I in nA */
+        Control = Cfg.OP_Control;       /* save output control */
+        Cfg.OP_Control &= ~OP_OUT_LCD;  /* disable display output */
+        Cfg.OP_Control |= OP_OUT_SER;   /* enable serial output */
+        Serial_NewLine();
+        Display_FullValue(Count, 0, 0);
+        Display_Char(',');
+        Display_FullValue(Part->Value, 0, 0);
+        Display_Char(',');
+        Display_FullValue(Part->U, 0, 0);
+        Display_Char(',');
+        Display_FullValue(Part->I, 0, 0);
+        Cfg.OP_Control = Control;       /* restore output control */
+        #endif
+      }
+    }
+
+
+    /*
+     *  update display
+     */
+
+    if (Update)
+    {
+      Update = 0;                       /* reset flag */
+
+      /* group size in line #1 */
+      LCD_Clear();
+      #ifdef UI_COLORED_TITLES
+        /* display: Matching */
+        Display_ColoredEEString_Space(Matching_str, COLOR_TITLE);
+      #else
+        Display_EEString_Space(Matching_str);     /* display: Matching */
+      #endif
+      Display_Char('0' + Size);         /* parts per group */
+
+      /* last part in line #2 */
+      LCD_CharPos(1, 2);
+      if (Present == 0)                 /* no part */
+      {
+        Display_Minus();                /* display: nothing */
+      }
+      else if (Count > 0)               /* got part */
+      {
+        Part = &Parts[Count - 1];
+        Display_Char('#');
+        Display_Value(Count, 0, 0);
+        if (Count == MATCH_PARTS) Display_Char('!');   /* buffer full */
+        Display_Space();
+        Display_Value(Part->Value, Scale, Unit);
+        Display_Space();
+        Display_Value(Part->U, -3, 'V');
+      }
+
+      if (Count > 0)                    /* got parts */
+      {
+        /* running statistics: min and max */
+        Min = Parts[0];
+        Max = Parts[0];
+        n = 1;
+        while (n < Count)
+        {
+          Part = &Parts[n];
+          if (Part->Value < Min.Value) Min.Value = Part->Value;
+          if (Part->Value > Max.Value) Max.Value = Part->Value;
+          if (Part->U < Min.U) Min.U = Part->U;
+          if (Part->U > Max.U) Max.U = Part->U;
+          n++;
+        }
+
+        /* value range in line #3 */
+        LCD_CharPos(1, 3);
+        Display_Value(Min.Value, Scale, Unit);
+        Display_Minus();
+        Display_Value(Max.Value, Scale, Unit);
+
+        /* voltage range in line #4 */
+        LCD_CharPos(1, 4);
+        Display_Value(Min.U, -3, 'V');
+        Display_Minus();
+        Display_Value(Max.U, -3, 'V');
+      }
+    }
+
+
+    /*
+     *  user feedback
+     *  - short key press: report matching groups
+     *  - long key press: toggle pairs/quads
+     *  - two short key presses: exit tool
+     */
+
+    Test = TestKey(100, CHECK_KEY_TWICE | CHECK_BAT | CURSOR_STEADY);
+
+    if (Test == KEY_TWICE)              /* two short key presses */
+    {
+      Flag = 0;                         /* end processing loop */
+    }
+    else if (Test == KEY_SHORT)         /* short key press */
+    {
+      Match_Report(Parts, Count, Size); /* report groups */
+      Update = 1;                       /* update display */
+    }
+    else if (Test == KEY_LONG)          /* long key press */
+    {
+      if (Size == 2) Size = 4;          /* pairs -> quads */
+      else Size = 2;                    /* quads -> pairs */
+      Update = 1;                       /* update display */
+    }
+  }
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   logic probe
+ * ************************************************************************ */
+
+
+#ifdef HW_LOGIC_PROBE
+
+/*
+ *  Logic Probe
+ *  - analog input: TP_LOGIC
+ *  - uses voltage divider (default: 4:1)
+ *    LOGIC_PROBE_R1 and LOGIC_PROBE_R2
+ *  - optional pulse catcher: the analog comparator counts edges while
+ *    waiting for the next reading (threshold: bandgap)
+ */
+
+void LogicProbe(void)
+{
+  uint8_t           Flag;               /* loop control */
+  uint8_t           Test;               /* user feedback */
+  uint8_t           Item;               /* menu item */
+  uint8_t           VccIndex;           /* index for Vcc table */
+  unsigned char     State;              /* logic state */
+  uint16_t          U1;                 /* measured voltage */
+  uint16_t          U_max = 0;          /* Vcc/Vdd */
+  uint16_t          U_low = 0;          /* voltage threshold for low */
+  uint16_t          U_high = 0;         /* voltage threshold for high */
+  uint32_t          Value;              /* temporary value */
+  #ifdef LOGIC_PROBE_PULSE
+  uint16_t          Edges;              /* number of edges */
+  uint32_t          Start;              /* start of time window */
+  #endif
+
+  /* local constants for Flag (bitfield) */
+  #define RUN_FLAG            0b00000001     /* run / otherwise end */
+  #define CHANGE_TYPE         0b00000010     /* change logic type */
+  #define CHANGE_LOW          0b00001000     /* change low threshold */
+  #define CHANGE_HIGH         0b00010000     /* change high threshold */
+
+  /* local constants for Item */
+  #define ITEM_TYPE      1              /* logic type (family and Vcc) */
+  #define ITEM_LOW       2              /* voltage threshold for low */
+  #define ITEM_HIGH      3              /* voltage threshold for high */
+
+
+  /*
+   *  show info
+   */
+
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    /* display: Logic Probe */
+    Display_ColoredEEString(LogicProbe_str, COLOR_TITLE);
+  #else
+    Display_EEString(LogicProbe_str);   /* display: Logic Probe */
+  #endif
+
+
+  /*
+   *  init
+   */
+
+  ADC_DDR &= ~(1 << TP_LOGIC);          /* set pin to HiZ */
+  Cfg.Samples = 5;                      /* do just 5 samples to be fast */
+  #ifdef ADC_CLOCK_PROFILES
+  ADC_Profile(ADC_FAST);                /* fast ADC clock */
+  #endif
+  VccIndex = 0;                         /* TTL 5V */
+  Item = ITEM_TYPE;                     /* default item */
+  Flag = RUN_FLAG | CHANGE_TYPE | CHANGE_LOW | CHANGE_HIGH;
+
+
+  /*
+   *  processing loop
+   */
+
+  while (Flag > 0)
+  {
+    /*
+     *  display family and Vcc/Vdd
+     */
+
+    if (Flag & CHANGE_TYPE)
+    {
+      LCD_ClearLine2();                 /* line #2 */
+      MarkItem(ITEM_TYPE, Item);        /* mark item if selected */
+
+      /* display family */
+      if (VccIndex == 0)                /* TTL */
+      {
+        Display_EEString(TTL_str);      /* display: TTL */
+      }
+      else                              /* CMOS */
+      {
+        Display_EEString(CMOS_str);     /* display: CMOS */
+      }
+
+      /* read Vcc/Vdd from table */
+      U_max = DATA_read_word(&Logic_Vcc_table[VccIndex]);
+
+      /* display Vcc/Vdd */
+      Display_Space();
+      U1 = U_max / 100;                 /* scale to 0.1V */
+      Display_Value(U1, -1, 'V');       /* display voltage in 0.1V */
+
+      /* update thresholds */
+      if (VccIndex == 0)                /* TTL */
+      {
+        /* fixed thresholds for 5V */
+        U_low = 800;                    /* 0.8V */
+        U_high = 2000;                  /* 2.0V */
+      }
+      else                              /* CMOS */
+      {
+        /* thresholds based on Vdd (in mV) */
+        /* L: 0.3 Vdd */
+        U_low = U1 * 30;                /* U in 0.1V * 0.3 * 100 */
+
+        /* H: 0.7 Vdd */
+        U_high = U1 * 70;               /* U in 0.1V * 0.7 * 100  */
+      }
+
+      Flag &= ~CHANGE_TYPE;             /* clear flag */
+    }
+
+
+    /*
+     *  display low threshold
+     */
+
+    if (Flag & CHANGE_LOW)
+    {
+      LCD_ClearLine3();                 /* clear line #3 */
+      MarkItem(ITEM_LOW, Item);         /* mark item if selected */
+      LCD_Char('L');                    /* display: L */
+      Display_Space();
+      U1 = U_low / 100;                 /* scale to 0.1V */
+      Display_Value(U1, -1, 'V');       /* display voltage in 0.1V */
+
+      Flag &= ~CHANGE_LOW;              /* clear flag */
+    }
+
+
+    /*
+     *  display high threshold
+     */
+
+    if (Flag & CHANGE_HIGH)
+    {
+      LCD_ClearLine(4);                 /* line #4 */
+      LCD_CharPos(1, 4);
+      MarkItem(ITEM_HIGH, Item);        /* mark item if selected */
+      LCD_Char('H');                    /* display: H */
+      Display_Space();
+      U1 = U_high / 100;                /* scale to 0.1V */
+      Display_Value(U1, -1, 'V');       /* display voltage in 0.1V */
+
+      Flag &= ~CHANGE_HIGH;             /* clear flag */
+    }
+
+
+    /*
+     *  display logic state
+     *  - 0, 1 or Z
+     *  - ADC pin is connected to a voltage divider (top: R1 / bottom: R2).
+     *    - U2 = (Uin / (R1 + R2)) * R2 
+     *    - Uin = (U2 * (R1 + R2)) / R2
+     */
+
+    /* get voltage */
+    U1 = ReadU(TP_LOGIC);          /* read voltage */
+
+    /* consider voltage divider */
+    Value = (((uint32_t)(LOGIC_PROBE_R1 + LOGIC_PROBE_R2) * 1000) / LOGIC_PROBE_R2);  /* factor (0.001) */
+    Value *= U1;                   /* voltage (0.001 mV) */
+    Value /= 1000;                 /* scale to mV */
+    U1 = (uint16_t)Value;          /* keep 2 bytes */
+
+    /* compare with thresholds  */
+    if (U1 <= U_low)               /* below low threshold */
+    {
+      State = '0';                 /* 0 for low */
+    }
+    else if (U1 >= U_high)         /* above high threshold */
+    {
+      State = '1';                 /* 1 for high */
+    }
+    else                           /* in between (undefined, HiZ) */
+    {
+      State = 'Z';                 /* z for undefined/HiZ */
+    }
+
+    /* display state and voltage */
+    LCD_ClearLine(5);                   /* line #5 */
+    LCD_CharPos(1, 5);
+    #ifdef LCD_COLOR
+    UI.PenColor = COLOR_SYMBOL;         /* change color */
+    #endif
+    LCD_Char(State);                    /* display state */
+    #ifdef LCD_COLOR
+    UI.PenColor = COLOR_PEN;            /* reset color */
+    #endif
+    Display_Space();
+    Display_Value(U1, -3, 'V');         /* display voltage */
+
+
+    /*
+     *  user feedback
+     */
+
+    #ifdef LOGIC_PROBE_PULSE
+    /* catch pulses while waiting */
+    Comparator_CheckBattery();          /* requires ADC */
+    Comparator_Arm(TP_LOGIC, 0);        /* switch to comparator */
+    Start = Profile_Tick();             /* start time window */
+    #endif
+
+    /* check for user feedback and slow down update rate */
+    Test = TestKey(200, CHECK_KEY_TWICE | CHECK_BAT);
+
+    #ifdef LOGIC_PROBE_PULSE
+    /* get time window and edges */
+    Value = (Profile_Tick() - Start) & 0x00FFFFFF;   /* ticks */
+    Edges = CompEdges;                  /* get edges */
+    Comparator_Disarm();                /* switch back to ADC */
+
+    /* display pulses */
+    LCD_ClearLine(6);                   /* line #6 */
+    LCD_CharPos(1, 6);
+    LCD_Char('P');                      /* display: P */
+    Display_Space();
+
+    if (Edges == 0)                     /* no activity */
+    {
+      LCD_Char('.');                    /* display: . */
+    }
+    else if ((Edges < 4) || (Value == 0))     /* single pulse */
+    {
+      /* display latched edges: + for rising / - for falling */
+      if (CompFlags & COMP_EDGE_HIGH) LCD_Char('+');
+      if (CompFlags & COMP_EDGE_LOW) LCD_Char('-');
+    }
+    else                                /* pulse train */
+    {
+      /* frequency: (edges / 2) / (ticks / ticks per second) */
+      Value = ((uint32_t)Edges * (CPU_FREQ / 1024)) / (Value * 2);
+      Display_Value(Value, 0, 0);       /* display frequency */
+      Display_EEString(Hertz_str);      /* display: Hz */
+    }
+    #endif
+
+    /* process user input */
+    if (Test == KEY_SHORT)              /* short key press */
+    {
+      /* select next item */
+      Item++;                           /* next item */
+
+      if (Item > ITEM_HIGH)             /* overflow */
+      {
+        Item = ITEM_TYPE;               /* ... to first item */
+      }
+
+      Flag |= CHANGE_TYPE | CHANGE_LOW | CHANGE_HIGH;       /* update display */
+    }
+    else if (Test == KEY_TWICE)         /* two short key presses */
+    {
+      Flag = 0;                         /* end loop */
+    }
+    else if (Test == KEY_RIGHT)         /* right key */
+    {
+      if (Item == ITEM_TYPE)                 /* family and Vcc/Vdd */
+      {
+        /* next set */
+        VccIndex++;                          /* increase index */
+        if (VccIndex >= NUM_LOGIC_TYPES)     /* overflow */
+        {
+          VccIndex = 0;                      /* roll over to first */
+        }
+        Flag |= CHANGE_TYPE | CHANGE_LOW | CHANGE_HIGH;     /* update display */
+      }
+      else if (Item == ITEM_LOW)             /* low threshold */
+      {
+        /* increase low threshold */
+        U_low += 100;                        /* + 100mV */
+        if (U_low > U_high)                  /* prevent overflow */
+        {
+          U_low = U_high;                    /* limit to high threshold */
+        }
+        Flag |= CHANGE_LOW;                  /* update display */
+      }
+      else if (Item == ITEM_HIGH)            /* high threshold */
+      {
+        /* increase high threshold */
+        U_high += 100;                       /* + 100mV */
+        if (U_high > U_max)                  /* prevent overflow */
+        {
+          U_high = U_max;                    /* limit to Vcc/Vdd */
+        }
+        Flag |= CHANGE_HIGH;                 /* update display */
+      }
+    }
+    else if (Test == KEY_LEFT)          /* left key */
+    {
+      if (Item == ITEM_TYPE)                 /* family and Vcc/Vdd */
+      {
+        /* previous set */
+        if (VccIndex > 0)                    /* prevent underun */
+        {
+          VccIndex--;                        /* decrease index */
+        }
+        else                                 /* roll over */
+        {
+          VccIndex = NUM_LOGIC_TYPES - 1;    /* ... to last */
+        }
+        Flag |= CHANGE_TYPE | CHANGE_LOW | CHANGE_HIGH;     /* update display */
+      }
+      else if (Item == ITEM_LOW)             /* low threshold */
+      {
+        /* decrease low threshold */
+        if (U_low >= 100)                    /* prevent underflow (limit to 0V) */
+        {
+          U_low -= 100;                      /* - 100mV */
+        }
+        Flag |= CHANGE_LOW;                  /* update display */
+      }
+      else if (Item == ITEM_HIGH)            /* high threshold */
+      {
+        /* decrease high threshold */
+        U1 = U_low + 100;                    /* limit to low threshold */
+        if (U_high >= U1)                    /* prevent underflow */
+        {
+          U_high -= 100;                     /* - 100mV */
+        }
+        Flag |= CHANGE_HIGH;                 /* update display */
+      }
+    }
+  }
+
+
+  /*
+   *  clean up
+   */
+
+  /* global settings */
+  Cfg.Samples = ADC_SAMPLES;            /* set ADC samples back to default */
+  #ifdef ADC_CLOCK_PROFILES
+  ADC_Profile(ADC_PRECISE);             /* standard ADC clock */
+  #endif
+
+  /* local constants for Flag */
+  #undef RUN_FLAG
+  #undef CHANGE_TYPE
+  #undef CHANGE_LOW
+  #undef CHANGE_HIGH
+
+  /* local constants for Item */
+  #undef ITEM_LOW
+  #undef ITEM_HIGH
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   continuity check
+ * ************************************************************************ */
+
+
+#ifdef SW_CONTINUITY_CHECK
+
+/*
+ *  continuity check
+ *  - uses probes #1 (pos) and #3 (neg)
+ *  - requires buzzer
+ */
+
+void ContinuityCheck(void)
+{
+  uint8_t           Flag;               /* loop control */
+  uint8_t           Test;               /* user feedback */
+  uint16_t          U1;                 /* measured voltage #1 */
+  uint16_t          U2;                 /* measured voltage #2 */
+
+  /* local constants for Flag (bitfield) */
+  #define RUN_FLAG            0b00000001     /* run / otherwise end */
+  #define BEEP_SHORT          0b00000010     /* short beep */
+
+
+  /*
+   *  show info
+   */
+
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    /* display: Continuity */
+    Display_ColoredEEString(ContinuityCheck_str, COLOR_TITLE);
+  #else
+    Display_EEString(ContinuityCheck_str);   /* display: Continuity */
+  #endif
+  ProbePinout(PROBES_ESR);         /* show probes used */
+
+
+  /*
+   *  init
+   */
+
+  UpdateProbes(PROBE_1, PROBE_2, PROBE_3);        /* update probes */
+
+  /* set probes: Vcc -- Rl -- probe #1 / probe #3 -- Gnd */
+  R_PORT = Probes.Rl_1;                 /* pull up probe #1 via Rl */
+  R_DDR = Probes.Rl_1;                  /* enable pull-up resistor */
+  ADC_PORT = 0;                         /* pull down directly */
+  ADC_DDR = Probes.Pin_3;               /* enable Gnd for probe #3 */
+
+  Cfg.Samples = 5;                      /* do just 5 samples to be fast */
+  #ifdef ADC_CLOCK_PROFILES
+  ADC_Profile(ADC_FAST);                /* fast ADC clock */
+  #endif
+  Flag = RUN_FLAG;                      /* enter processing loop */
+
+
+  /*
+   *  processing loop
+   */
+
+  while (Flag > 0)
+  {
+    /*
+     *  check voltage across probes
+     *  and output result
+     */
+
+    #ifdef CONTINUITY_COMPARATOR
+    Comparator_Disarm();                /* switch back to ADC */
+    #endif
+
+    U1 = ReadU(Probes.Ch_1);            /* read voltage at probe #1 */
+    U2 = ReadU(Probes.Ch_3);            /* read voltage at probe #3 */
+
+    /* consider voltage drop by RiL */
+    if (U1 > U2)                        /* sanity check */
+    {
+      U1 -= U2;                         /* subtract voltage of RiL */
+    }
+
+    /* compare voltage with thresholds */
+    if (U1 < 100)                       /* < 100mV */
+    {
+      /* short: continuous beep */
+
+      #ifdef BUZZER_ACTIVE
+      /* enable buzzer */
+      BUZZER_PORT |= (1 << BUZZER_CTRL);     /* set pin high */
+      #endif
+
+      #ifdef BUZZER_PASSIVE
+      PassiveBuzzer(BUZZER_FREQ_HIGH);       /* high frequency beep */
+      #endif
+    }
+    else if (U1 <= 700)                 /* 100-700mV */
+    {
+      /* pn junction: short beep */
+
+      #ifdef BUZZER_ACTIVE
+      /* enable buzzer */
+      BUZZER_PORT |= (1 << BUZZER_CTRL);     /* set pin high */
+      Flag |= BEEP_SHORT;                    /* set flag */
+      #endif
+
+      #ifdef BUZZER_PASSIVE
+      PassiveBuzzer(BUZZER_FREQ_LOW);        /* low frequency beep */
+      #endif
+    }
+    #ifdef CONTINUITY_COMPARATOR
+    else if (CompFlags & COMP_EDGE_LOW) /* intermittent contact */
+    {
+      /* contact while waiting: short beep */
+
+      #ifdef BUZZER_ACTIVE
+      /* enable buzzer */
+      BUZZER_PORT |= (1 << BUZZER_CTRL);     /* set pin high */
+      Flag |= BEEP_SHORT;                    /* set flag */
+      #endif
+
+      #ifdef BUZZER_PASSIVE
+      PassiveBuzzer(BUZZER_FREQ_HIGH);       /* high frequency beep */
+      #endif
+    }
+    #endif
+    else                                /* > 700mV */
+    {
+      /* something else or open circuit: no beep */
+
+      #ifdef BUZZER_ACTIVE
+      /* disable buzzer */
+      BUZZER_PORT &= ~(1 << BUZZER_CTRL);    /* set pin low */
+      #endif
+    }
+
+    /* display voltage */
+    LCD_ClearLine2();                   /* line #2 */
+    Display_Value(U1, -3, 'V');         /* display voltage */
+    /* this is also used as delay for the short beep */
+    /* todo: do we need an additional delay for fast displays? */
+
+    #ifdef BUZZER_ACTIVE
+    if (Flag & BEEP_SHORT)              /* short beep */
+    {
+      /* disable buzzer */
+      BUZZER_PORT &= ~(1 << BUZZER_CTRL);    /* set pin low */
+      Flag &= ~BEEP_SHORT;                   /* clear flag */
+    }
+    #endif
+
+
+    /*
+     *  user feedback
+     */
+
+    #ifdef CONTINUITY_COMPARATOR
+    Comparator_CheckBattery();          /* requires ADC */
+    Comparator_Arm(Probes.Ch_1, COMP_EDGE_BUZZER);   /* switch to comparator */
+    #endif
+
+    /* check for user feedback and slow down update rate */
+    Test = TestKey(50, CHECK_KEY_TWICE | CHECK_BAT);
+
+    if (Test == KEY_TWICE)         /* two short key presses */
+    {
+      Flag = 0;                    /* end loop */
+    }
+  }
+
+
+  /*
+   *  clean up
+   */
+
+  #ifdef CONTINUITY_COMPARATOR
+  Comparator_Disarm();                  /* switch back to ADC */
+
+  #ifdef BUZZER_ACTIVE
+  /* disable buzzer */
+  BUZZER_PORT &= ~(1 << BUZZER_CTRL);   /* set pin low */
+  #endif
+  #endif
+
+  /* global settings */
+  Cfg.Samples = ADC_SAMPLES;            /* set ADC samples back to default */
+  #ifdef ADC_CLOCK_PROFILES
+  ADC_Profile(ADC_PRECISE);             /* standard ADC clock */
+  #endif
+
+  /* local constants for Flag */
+  #undef RUN_FLAG
+  #undef BEEP_SHORT
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   flashlight / general purpose switched output
+ * ************************************************************************ */
+
+
+#ifdef HW_FLASHLIGHT
+
+/*
+ *  flashlight / general purpose switched output
+ *  - toggles output pin between high and low
+ */
+
+void Flashlight(void)
+{
+  uint8_t           Flag;          /* status flag */
+
+
+  /*
+   *  toggle output
+   */
+
+  /* get current state */
+  Flag = FLASHLIGHT_PORT;          /* read port register */
+  Flag &= (1 << FLASHLIGHT_CTRL);  /* filter pin */
+
+  /* set output based on current state */
+  if (Flag)                   /* pin high */
+  {
+    /* toggle off */
+    FLASHLIGHT_PORT &= ~(1 << FLASHLIGHT_CTRL);   /* set pin low */
+  }
+  else                        /* pin low */
+  {
+    /* toggle on */
+    FLASHLIGHT_PORT |= (1 << FLASHLIGHT_CTRL);    /* set pin high */
+  }
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   photodiode check
+ * ************************************************************************ */
+
+
+#ifdef SW_PHOTODIODE
+
+#ifdef PHOTODIODE_TIMING
+
+/* local constants for response time */
+#define PD_SAMPLES       128       /* number of samples */
+#define PD_PRE           16        /* samples before LED step */
+#define PD_DIV_MAX       64        /* max. sample divider */
+#define PD_MIN_AMP       8         /* min. amplitude (8 bit ADC) */
+#define PD_STEP_ON       1         /* LED step: switch on */
+#define PD_STEP_OFF      0         /* LED step: switch off */
+
+/* time between two conversions of free-running ADC (in ns) */
+#define PD_SAMPLE_TIME   ((13UL * ADC_DIV_FAST * 1000) / MCU_CYCLES_PER_US)
+
+
+/*
+ *  measure response time of photodiode for a step of the LED
+ *  - photodiode: probe #1 (anode) and probe #3 (cathode), reverse-bias
+ *    with Rh as load
+ *  - LED: probe #2 (anode) via Rl and probe #1 (cathode)
+ *  - free-running ADC at fast ADC clock with 8 bit resolution
+ *  - takes every n-th sample (1 - PD_DIV_MAX) until the response
+ *    settles within the capture window
+ *
+ *  requires:
+ *  - Buffer: pointer to buffer with PD_SAMPLES bytes
+ *  - Step: PD_STEP_ON or PD_STEP_OFF
+ *
+ *  returns:
+ *  - 10-90% time in ns
+ *  - 0 if amplitude is too low or response isn't settled
+ */
+
+uint32_t Photodiode_Response(uint8_t *Buffer, uint8_t Step)
+{
+  uint32_t          Time = 0;           /* return value */
+  uint8_t           Div = 1;            /* sample divider */
+  uint8_t           Bits;               /* register bits */
+  uint8_t           LED;                /* LED's resistor bit */
+  uint8_t           n;                  /* counter */
+  uint8_t           m;                  /* counter */
+  uint16_t          Low;                /* level before step */
+  uint16_t          High;               /* level after step */
+  int16_t           Amp;                /* amplitude */
+  int16_t           V;                  /* value relative to Low (x10) */
+  int16_t           Prev;               /* last value (x10) */
+  int16_t           Level;              /* threshold (x10) */
+  uint16_t          T10 = 0;            /* time at 10% (in 1/16 samples) */
+  uint16_t          T90 = 0;            /* time at 90% (in 1/16 samples) */
+  uint8_t           Sign;               /* direction of response */
+
+  LED = Probes.Rl_2;               /* pull up probe #2 via Rl */
+
+  while (Div <= PD_DIV_MAX)
+  {
+    wdt_reset();
+
+    /*
+     *  set up probes
+     *  - probe #1: Gnd
+     *  - probe #3: pulled up via Rh
+     *  - probe #2: LED in state before step
+     */
+
+    ADC_PORT = 0;                  /* pull down directly */
+    ADC_DDR = Probes.Pin_1;        /* enable Gnd for probe #1 */
+    R_DDR = Probes.Rh_3 | LED;     /* enable resistors */
+    if (Step == PD_STEP_ON)        /* LED off before */
+      R_PORT = Probes.Rh_3;
+    else                           /* LED on before */
+      R_PORT = Probes.Rh_3 | LED;
+    wait20ms();                    /* settle time */
+
+
+    /*
+     *  set up ADC
+     *  - probe #3, Vcc reference, left adjusted result (ADCH = 8 bits)
+     *  - free-running mode
+     */
+
+    ADC_SetReference(Probes.Ch_3 | ADC_REF_VCC | (1 << ADLAR));
+    ADCSRB = 0;                    /* auto trigger source: free-running */
+    Bits = (1 << ADEN) | (1 << ADSC) | (1 << ADATE) | (1 << ADIF) | ADC_CLOCK_DIV_FAST;
+    ADCSRA = Bits;                 /* start ADC */
+
+    /* skip first conversion (longer one after enabling/ADMUX change) */
+    while (!(ADCSRA & (1 << ADIF)));    /* wait until conversion is done */
+    ADCSRA = Bits;                 /* clear flag */
+
+
+    /*
+     *  sample loop
+     *  - nothing else in here to keep up with the ADC
+     */
+
+    n = 0;
+    while (n < PD_SAMPLES)
+    {
+      m = Div;
+      while (m > 0)                /* skip samples */
+      {
+        while (!(ADCSRA & (1 << ADIF)));  /* wait until conversion is done */
+        ADCSRA = Bits;             /* clear flag */
+        m--;
+      }
+
+      Buffer[n] = ADCH;            /* save 8 bit value */
+      n++;                         /* next sample */
+
+      if (n == PD_PRE)             /* LED step */
+      {
+        R_PORT ^= LED;             /* toggle LED */
+      }
+    }
+
+    /* stop free-running mode and restore standard ADC clock */
+    ADCSRA = (1 << ADEN) | (1 << ADIF) | ADC_CLOCK_DIV;
+    while (ADCSRA & (1 << ADSC));  /* wait for running conversion */
+
+
+    /*
+     *  levels before and after step
+     */
+
+    Low = 0;
+    for (n = 0; n < PD_PRE; n++) Low += Buffer[n];
+    Low /= PD_PRE;
+
+    High = 0;
+    for (n = PD_SAMPLES - 8; n < PD_SAMPLES; n++) High += Buffer[n];
+    High /= 8;
+
+    Amp = High - Low;
+    Sign = 0;
+    if (Amp < 0)                   /* falling voltage */
+    {
+      Amp = -Amp;
+      Sign = 1;
+    }
+
+    if (Amp < PD_MIN_AMP)          /* no response */
+    {
+      break;                       /* end loop */
+    }
+
+
+    /*
+     *  check if response settled
+     *  - sample at 3/4 of window within 10% of final level
+     */
+
+    V = Buffer[PD_SAMPLES * 3 / 4] - Low;
+    if (Sign) V = -V;
+
+    if ((Amp - V) * 10 <= Amp)     /* settled */
+    {
+      /*
+       *  get 10% and 90% crossings (linear interpolation)
+       */
+
+      Prev = 0;                    /* step starts at Low */
+      Level = Amp;                 /* 10% (x10) */
+      n = PD_PRE;
+
+      while (n < PD_SAMPLES)
+      {
+        V = Buffer[n] - Low;
+        if (Sign) V = -V;
+        V *= 10;                   /* scale to x10 */
+
+        if (V >= Level)            /* passed threshold */
+        {
+          /* interpolate between last and current sample */
+          m = ((uint16_t)(Level - Prev) * 16) / (uint16_t)(V - Prev);
+          if (Level == Amp)        /* 10% */
+          {
+            T10 = ((n - PD_PRE) * 16) + m;
+            Level = Amp * 9;       /* 90% (x10) */
+            continue;              /* check sample again */
+          }
+          else                     /* 90% */
+          {
+            T90 = ((n - PD_PRE) * 16) + m;
+            break;                 /* done */
+          }
+        }
+
+        Prev = V;                  /* save value */
+        n++;                       /* next sample */
+      }
+
+      /* time = difference * n samples * sample time */
+      if (T90 > T10)               /* got both crossings */
+      {
+        Time = T90 - T10;
+        Time *= Div;
+        Time *= PD_SAMPLE_TIME;
+        Time /= 16;
+      }
+      break;                       /* end loop */
+    }
+
+    Div <<= 1;                     /* lower sampling rate */
+  }
+
+  /* set probes to HiZ */
+  R_DDR = 0;
+  R_PORT = 0;
+  ADC_DDR = 0;
+
+  return Time;
+}
+
+#endif
+
+
+
+/*
+ *  check photodiode
+ *  - supports reverse-bias and no-bias mode
+ *  - pulse mode: response time (with PHOTODIODE_TIMING)
+ *  - uses probe #1 (anode) and probe #3 (cathode)
+ */
+
+void PhotodiodeCheck(void)
+{
+  uint8_t           Flag;               /* loop control */
+  uint8_t           Test;               /* user feedback */
+  uint16_t          U;                  /* measured voltage */
+  uint16_t          R = 0;              /* resistance (current shunt) */
+  uint32_t          I;                  /* current I_P */
+  #ifdef PHOTODIODE_TIMING
+  uint8_t           Buffer[PD_SAMPLES]; /* sample buffer */
+  #endif
+
+  /* local constants for Flag (bitfield) */
+  #define RUN_FLAG            0b00000001     /* run / otherwise end */
+  #define NO_BIAS             0b00000010     /* no-bias mode */
+  #define REVERSE_BIAS        0b00000100     /* reverse-bias mode */
+  #define UPDATE_BIAS         0b00001000     /* update bias mode */
+  #define PULSE_MODE          0b00010000     /* response time */
+
+
+  /*
+   *  show info
+   */
+
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    /* display: Photodiode */
+    Display_ColoredEEString(Photodiode_str, COLOR_TITLE);
+  #else
+    Display_EEString(Photodiode_str);        /* display: Photodiode */
+  #endif
+  ProbePinout(PROBES_DIODE);                 /* show probes used */
+
+
+  /*
+   *  init
+   */
+
+  UpdateProbes(PROBE_1, PROBE_2, PROBE_3);   /* update probes */
+
+  /* enter processing loop and set reverse-bias mode */
+  Flag = RUN_FLAG | REVERSE_BIAS | UPDATE_BIAS;
+
+
+  /*
+   *  processing loop
+   */
+
+  while (Flag > 0)
+  {
+    #ifdef PHOTODIODE_TIMING
+    /*
+     *  pulse mode: measure rise and fall time
+     *  - display is updated after both captures
+     */
+
+    if (Flag & PULSE_MODE)
+    {
+      /* display: t_r */
+      LCD_ClearLine2();
+      Display_EEString_Space(PD_Rise_str);
+      I = Photodiode_Response(Buffer, PD_STEP_ON);
+      if (I) Display_Value(I, -9, 's');
+      else Display_Minus();
+
+      /* display: t_f */
+      LCD_ClearLine3();
+      Display_EEString_Space(PD_Fall_str);
+      I = Photodiode_Response(Buffer, PD_STEP_OFF);
+      if (I) Display_Value(I, -9, 's');
+      else Display_Minus();
+    }
+    else
+    #endif
+
+    /*
+     *  set up bias mode
+     */
+
+    if (Flag & UPDATE_BIAS)        /* update requested */
+    {
+      /* probe #1: anode, probe #3: cathode */
+
+      if (Flag & REVERSE_BIAS)     /* reverse-bias mode */
+      {
+        /* safeguard when switching from no-bias mode */
+        ADC_DDR = 0;                    /* remove direct pull down */
+
+        /* set probes: Vcc -- Rl -- probe #3 / probe #1 -- Gnd */
+        R_PORT = Probes.Rl_3;           /* pull up probe #3 via Rl */
+        R_DDR = Probes.Rl_3;            /* enable pull-up resistor */
+        ADC_PORT = 0;                   /* pull down directly */
+        ADC_DDR = Probes.Pin_1;         /* enable Gnd for probe #1 */
+
+        /* current shunt: Rl + RiH */
+        R = (R_LOW * 10) + NV.RiH;      /* in 0.1 Ohms */
+      }
+      else                         /* no-bias mode */
+      {
+        /* set probes: probe #1 -- Rl -- Gnd / probe #3 -- Gnd */
+        R_PORT = 0;                     /* pull down ... */
+        R_DDR = Probes.Rl_1;            /* ... probe #1 via Rl */
+        ADC_PORT = 0;                   /* pull down directly */
+        ADC_DDR = Probes.Pin_3;         /* enable Gnd for probe #3 */
+
+        /* current shunt: Rl + RiL */
+        R = (R_LOW * 10) + NV.RiL;      /* in 0.1 Ohms */
+      }
+
+      Flag &= ~UPDATE_BIAS;                  /* clear flag */
+    }
+
+
+    /*
+     *  monitor current I_P
+     *  - measure voltage across current shunt Rl
+     *  - calculate current
+     *  - display current
+     */
+
+    #ifdef PHOTODIODE_TIMING
+    if (! (Flag & PULSE_MODE))     /* not in pulse mode */
+    #endif
+    {
+      /* measure voltage */
+      if (Flag & REVERSE_BIAS)     /* reverse-bias mode */
+      {
+        U = Cfg.Vcc - ReadU(Probes.Ch_3);    /* voltage at probe #3 (cathode), in mV */
+      }
+      else                         /* no-bias mode */
+      {
+        U = ReadU(Probes.Ch_1);    /* voltage at probe #1 (anode), in mV */
+      }
+
+      /* calculate I_P (= U / R) */
+      I = U * 100000;              /* scale voltage to 0.01 V */
+      I /= R;                      /* / R (in 0.1 Ohms) -> I in 0.1 A */ 
+
+      /* display I_P */
+      LCD_ClearLine2();            /* line #2 */
+      if (Flag & REVERSE_BIAS)     /* reverse-bias mode */
+      {
+        Display_EEString_Space(ReverseBias_str);  /* display: rev */
+      }
+      else                         /* no-bias mode */
+      {
+        Display_EEString_Space(NoBias_str);       /* display: no */
+      }
+      Display_Value(I, -7, 'A');   /* display current */
+    }
+
+
+    /*
+     *  user feedback
+     */
+
+    /* check for user feedback and slow down update rate */
+    Test = TestKey(200, CHECK_KEY_TWICE | CHECK_BAT);
+
+    if (Test == KEY_SHORT)         /* short key press */
+    {
+      /* toggle bias mode */
+      if (Flag & REVERSE_BIAS)     /* in reverse-bias mode */
+      {
+        /* switch to no-bias mode */
+        Flag &= ~REVERSE_BIAS;               /* clear flag */
+        Flag |= NO_BIAS | UPDATE_BIAS;       /* set flag for new mode */
+      }
+      else                         /* in no-bias mode */
+      {
+        /* switch to reverse-bias mode */
+        Flag &= ~NO_BIAS;                    /* clear flag */
+        Flag |= REVERSE_BIAS | UPDATE_BIAS;  /* set flag for new mode */
+      }
+    }
+    else if (Test == KEY_TWICE)    /* two short key presses */
+    {
+      Flag = 0;                    /* end loop */
+    }
+    #ifdef PHOTODIODE_TIMING
+    else if (Test == KEY_LONG)     /* long key press */
+    {
+      /* toggle pulse mode */
+      Flag ^= PULSE_MODE;          /* toggle flag */
+      Flag |= UPDATE_BIAS;         /* restore bias mode afterwards */
+      LCD_ClearLine3();            /* clear line #3 */
+    }
+    #endif
+  }
+
+
+  /*
+   *  clean up
+   */
+
+  /* local constants for Flag */
+  #undef RUN_FLAG
+  #undef NO_BIAS
+  #undef REVERSE_BIAS
+  #undef UPDATE_BIAS
+  #undef PULSE_MODE
+}
+
+/* clean up local constants for response time */
+#ifdef PHOTODIODE_TIMING
+  #undef PD_SAMPLE_TIME
+  #undef PD_STEP_OFF
+  #undef PD_STEP_ON
+  #undef PD_MIN_AMP
+  #undef PD_DIV_MAX
+  #undef PD_PRE
+  #undef PD_SAMPLES
+#endif
+
+#endif
+
+
+
+#ifdef SW_SCOPE
+
+/*
+ *  capture probe #1 into ring buffer (single shot)
+ *  - free-running ADC at fast ADC clock with 8 bit resolution
+ *  - keeps SCOPE_PRE samples before the trigger event
+ *  - auto trigger if no edge is found within 65535 samples
+ *  - probe #3 is tied to Gnd, probe #1 is in HiZ mode for edge
+ *    triggers or driven via Rl/Rh for step responses
+ *
+ *  requires:
+ *  - Buffer: pointer to ring buffer with SCOPE_SAMPLES bytes
+ *  - Mode: trigger mode
+ *    SCOPE_RISING   rising edge
+ *    SCOPE_FALLING  falling edge
+ *    SCOPE_STEP_RL  step response via Rl
+ *    SCOPE_STEP_RH  step response via Rh
+ *  - Level: trigger level (8 bit ADC value)
+ *
+ *  returns:
+ *  - index of oldest sample in ring buffer
+ */
+
+uint8_t Scope_Capture(uint8_t *Buffer, uint8_t Mode, uint8_t Level)
+{
+  uint8_t           State;              /* capture state */
+  uint8_t           Bits;               /* register bits */
+  uint8_t           Pull = 0;           /* resistor for step response */
+  uint8_t           Pos = 0;            /* write position */
+  uint8_t           Count = 0;          /* sample counter */
+  uint8_t           Old = 0;            /* previous sample */
+  uint8_t           New;                /* current sample */
+  uint16_t          Timeout = 0;        /* counter for auto trigger */
+
+  /* local constants for State */
+  #define STATE_DONE          0         /* capture finished */
+  #define STATE_PRE           1         /* pre-trigger samples */
+  #define STATE_ARMED         2         /* wait for trigger */
+  #define STATE_POST          3         /* post-trigger samples */
+
+
+  /*
+   *  set up probes
+   *  - probe #3: Gnd
+   *  - probe #1: HiZ, or pulled down via Rl/Rh for step response
+   */
+
+  ADC_PORT = 0;                    /* pull down directly */
+  ADC_DDR = Probes.Pin_3;          /* enable Gnd for probe #3 */
+  R_PORT = 0;                      /* pull down ... */
+
+  if (Mode == SCOPE_STEP_RL)       /* step via Rl */
+  {
+    Pull = Probes.Rl_1;
+  }
+  else if (Mode == SCOPE_STEP_RH)  /* step via Rh */
+  {
+    Pull = Probes.Rh_1;
+  }
+
+  R_DDR = Pull;                    /* ... probe #1 via Rl/Rh */
+  if (Pull) wait20ms();            /* discharge DUT */
+
+
+  /*
+   *  set up ADC
+   *  - probe #1, Vcc reference, left adjusted result (ADCH = 8 bits)
+   *  - free-running mode
+   */
+
+  ADC_SetReference(Probes.Ch_1 | ADC_REF_VCC | (1 << ADLAR));
+  ADCSRB = 0;                      /* auto trigger source: free-running */
+  Bits = (1 << ADEN) | (1 << ADSC) | (1 << ADATE) | (1 << ADIF) | ADC_CLOCK_DIV_FAST;
+  ADCSRA = Bits;                   /* start ADC */
+
+  /* skip first conversion (longer one after enabling/ADMUX change) */
+  while (!(ADCSRA & (1 << ADIF)));  /* wait until conversion is done */
+  ADCSRA = Bits;                   /* clear flag */
+
+
+  /*
+   *  sample loop
+   *  - has to be faster than one conversion (13 ADC clock cycles)
+   */
+
+  State = STATE_PRE;
+  while (State != STATE_DONE)
+  {
+    while (!(ADCSRA & (1 << ADIF)));  /* wait until conversion is done */
+    ADCSRA = Bits;                 /* clear flag */
+    New = ADCH;                    /* get 8 bit value */
+
+    /* save sample */
+    Buffer[Pos] = New;
+    Pos++;                         /* next position */
+    Pos &= (SCOPE_SAMPLES - 1);    /* wrap around */
+    Count++;                       /* one more sample */
+
+    if (State == STATE_PRE)        /* pre-trigger */
+    {
+      if (Count == SCOPE_PRE)      /* got all pre-trigger samples */
+      {
+        if (Pull)                  /* step response */
+        {
+          R_PORT = Pull;           /* pull up probe #1 via Rl/Rh */
+          State = STATE_POST;      /* step is next sample */
+        }
+        else                       /* edge trigger */
+        {
+          State = STATE_ARMED;
+        }
+      }
+    }
+    else if (State == STATE_ARMED) /* wait for trigger */
+    {
+      Timeout++;                   /* one more try */
+
+      if (Mode == SCOPE_RISING)    /* rising edge */
+      {
+        if ((Old < Level) && (New >= Level)) Timeout = 0;
+      }
+      else                         /* falling edge */
+      {
+        if ((Old > Level) && (New <= Level)) Timeout = 0;
+      }
+
+      if ((Timeout == 0) || (Timeout == UINT16_MAX))
+      {
+        /* trigger event or auto trigger */
+        Count = SCOPE_PRE + 1;     /* trigger sample at SCOPE_PRE */
+        State = STATE_POST;
+      }
+    }
+    else                           /* post-trigger */
+    {
+      if (Count == SCOPE_SAMPLES)  /* buffer full */
+      {
+        State = STATE_DONE;        /* end loop */
+      }
+    }
+
+    Old = New;                     /* save sample */
+  }
+
+
+  /*
+   *  clean up
+   */
+
+  /* stop free-running mode and restore standard ADC clock */
+  ADCSRA = (1 << ADEN) | (1 << ADIF) | ADC_CLOCK_DIV;
+  while (ADCSRA & (1 << ADSC));    /* wait for running conversion */
+
+  /* set probes to HiZ */
+  R_DDR = 0;
+  R_PORT = 0;
+  ADC_DDR = 0;
+
+  /* local constants for State */
+  #undef STATE_DONE
+  #undef STATE_PRE
+  #undef STATE_ARMED
+  #undef STATE_POST
+
+  return Pos;                      /* oldest sample */
+}
+
+
+
+/*
+ *  scope
+ *  - single-shot capture of probe #1 (probe #3 is Gnd)
+ *  - trace is drawn between line #2 and the last line
+ *  - short key press: new capture
+ *    long key press: change trigger mode
+ *    right/left key: change trigger level
+ *    two short key presses: exit tool
+ */
+
+void Scope_Tool(void)
+{
+  uint8_t           Buffer[SCOPE_SAMPLES];   /* sample ring buffer */
+  uint8_t           Start;              /* index of oldest sample */
+  uint8_t           Mode = SCOPE_RISING;     /* trigger mode */
+  uint8_t           Level = 128;        /* trigger level, Vcc/2 */
+  uint8_t           Test = KEY_SHORT;   /* user feedback / loop control */
+  uint32_t          Value;              /* voltage/time */
+  #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+  uint8_t           Control;            /* output control */
+  uint8_t           n;                  /* counter */
+  #endif
+  #ifdef HW_KEYS
+  uint16_t          Temp;               /* temporary value */
+  #endif
+
+  /* sampling time for one sample: 13 ADC clock cycles (in 0.1 s) */
+  #define SAMPLE_TIME    (13UL * ADC_DIV_FAST * 10000000UL / CPU_FREQ)
+
+
+  /*
+   *  show info
+   */
+
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    /* display: Scope */
+    Display_ColoredEEString(Scope_str, COLOR_TITLE);
+  #else
+    Display_EEString(Scope_str);             /* display: Scope */
+  #endif
+
+  UpdateProbes(PROBE_1, PROBE_2, PROBE_3);   /* update probes */
+
+
+  /*
+   *  processing loop
+   */
+
+  while (Test > 0)
+  {
+    /* show trigger mode and level in line #2 */
+    LCD_ClearLine2();
+    if (Mode == SCOPE_RISING)           /* rising edge */
+    {
+      Display_EEString_Space(Rising_str);
+    }
+    else if (Mode == SCOPE_FALLING)     /* falling edge */
+    {
+      Display_EEString_Space(Falling_str);
+    }
+    else                                /* step response */
+    {
+      Display_Char('R');
+      if (Mode == SCOPE_STEP_RL) Display_Char('l');
+      else Display_Char('h');
+    }
+
+    if (Mode <= SCOPE_FALLING)          /* edge trigger */
+    {
+      /* trigger level: Level * Vcc / 256 */
+      Value = (uint32_t)Level * Cfg.Vcc;
+      Value /= 256;
+      Display_Value(Value, -3, 'V');
+    }
+
+    /* capture and draw trace */
+    Start = Scope_Capture(Buffer, Mode, Level);
+    LCD_ScopeTrace(Buffer, Start, Level);
+
+    /* show time span of trace in last line */
+    LCD_ClearLine(UI.CharMax_Y);
+    LCD_CharPos(1, UI.CharMax_Y);
+    Value = SAMPLE_TIME * SCOPE_SAMPLES;
+    Display_Value(Value, -7, 's');
+
+    #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+    /* send samples via TTL serial (in mV) */
+    Control = Cfg.OP_Control;           /* save output control */
+    Cfg.OP_Control &= ~OP_OUT_LCD;      /* disable display output */
+    Cfg.OP_Control |= OP_OUT_SER;       /* enable serial output */
+    Serial_NewLine();
+    n = 0;
+    while (n < SCOPE_SAMPLES)
+    {
+      Value = (uint32_t)Buffer[Start] * Cfg.Vcc;
+      Value /= 256;
+      Display_FullValue(Value, 0, 0);
+      Display_NextLine();
+      Start++;                          /* next sample */
+      Start &= (SCOPE_SAMPLES - 1);     /* wrap around */
+      n++;
+    }
+    Cfg.OP_Control = Control;           /* restore output control */
+    #endif
+
+
+    /*
+     *  user feedback
+     */
+
+    Test = TestKey(0, CHECK_KEY_TWICE | CHECK_BAT);
+
+    if (Test == KEY_LONG)               /* long key press */
+    {
+      /* next trigger mode */
+      Mode++;
+      if (Mode > SCOPE_STEP_RH) Mode = SCOPE_RISING;
+    }
+    else if (Test == KEY_TWICE)         /* two short key presses */
+    {
+      Test = 0;                         /* end loop */
+    }
+    #ifdef HW_KEYS
+    else if (Test == KEY_RIGHT)         /* right key */
+    {
+      Temp = Level + (4 * UI.KeyStep);  /* increase level */
+      if (Temp > 255) Temp = 255;       /* limit to max */
+      Level = (uint8_t)Temp;
+    }
+    else if (Test == KEY_LEFT)          /* left key */
+    {
+      Temp = 4 * UI.KeyStep;            /* step */
+      if (Level > Temp) Level -= Temp;  /* decrease level */
+      else Level = 1;                   /* limit to min */
+    }
+    #endif
+  }
+
+  #undef SAMPLE_TIME
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   I-V curve tracer
+ * ************************************************************************ */
+
+
+#ifdef SW_CURVE_TRACER
+
+/*
+ *  measure single I-V point
+ *  - probe-1: high side (anode, collector of NPN, emitter of PNP)
+ *  - probe-2: low side (cathode, emitter of NPN, collector of PNP)
+ *  - probe-3: base (BJT only)
+ *  - probes have to be set up by UpdateProbes()
+ *
+ *  requires:
+ *  - Point: pointer to I-V point
+ *  - Config: probe setup (bitfield)
+ *    IV_HIGH_RL / IV_HIGH_RH  high side via Rl/Rh (default: direct)
+ *    IV_LOW_RL / IV_LOW_RH    low side via Rl/Rh (default: direct)
+ *    IV_BASE_RL / IV_BASE_RH  base driven via Rl/Rh (default: none)
+ *    IV_BASE_DOWN             pull base down instead of up
+ *    IV_I_LOW                 get current at low side (default: high side)
+ */
+
+void IV_Measure(IV_Type *Point, uint8_t Config)
+{
+  uint8_t           Port = 0;      /* port bits for Rl/Rh */
+  uint8_t           DDR = 0;       /* direction bits for Rl/Rh */
+  uint8_t           Mode;          /* resistor of current sense side */
+  uint16_t          U_High;        /* voltage at high side (mV) */
+  uint16_t          U_Low;         /* voltage at low side (mV) */
+  uint16_t          U_R;           /* voltage across resistor (mV) */
+  uint16_t          Ri;            /* internal resistance of MCU pin */
+  uint32_t          Value;         /* current (nA) */
+
+  /*
+   *  set up probes
+   */
+
+  /* high side */
+  if (Config & IV_HIGH_RL)         /* via Rl */
+  {
+    Port = Probes.Rl_1;
+  }
+  else if (Config & IV_HIGH_RH)    /* via Rh */
+  {
+    Port = Probes.Rh_1;
+  }
+  DDR = Port;
+
+  /* low side */
+  if (Config & IV_LOW_RL)          /* via Rl */
+  {
+    DDR |= Probes.Rl_2;
+  }
+  else if (Config & IV_LOW_RH)     /* via Rh */
+  {
+    DDR |= Probes.Rh_2;
+  }
+
+  /* base */
+  Mode = 0;
+  if (Config & IV_BASE_RL)         /* via Rl */
+  {
+    Mode = Probes.Rl_3;
+  }
+  else if (Config & IV_BASE_RH)    /* via Rh */
+  {
+    Mode = Probes.Rh_3;
+  }
+  DDR |= Mode;
+  if (! (Config & IV_BASE_DOWN)) Port |= Mode;   /* pull up */
+
+  /* direct connections */
+  if (Config & (IV_HIGH_RL | IV_HIGH_RH))   /* high side via resistor */
+  {
+    ADC_PORT = 0;
+    ADC_DDR = 0;
+  }
+  else                                      /* high side directly */
+  {
+    ADC_PORT = Probes.Pin_1;
+    ADC_DDR = Probes.Pin_1;
+  }
+  if (! (Config & (IV_LOW_RL | IV_LOW_RH))) /* low side directly */
+  {
+    ADC_DDR |= Probes.Pin_2;
+  }
+
+  R_PORT = Port;
+  R_DDR = DDR;
+
+
+  /*
+   *  get voltages and current
+   */
+
+  U_High = ReadU_5ms(Probes.Ch_1);      /* voltage at high side */
+  U_Low = ReadU(Probes.Ch_2);           /* voltage at low side */
+
+  /* voltage across DUT */
+  if (U_High > U_Low) Point->U = U_High - U_Low;
+  else Point->U = 0;
+
+  /* current via sense resistor */
+  if (Config & IV_I_LOW)           /* low side */
+  {
+    U_R = U_Low;
+    Mode = Config >> 2;            /* low side flags */
+    Ri = NV.RiL;
+  }
+  else                             /* high side */
+  {
+    if (Cfg.Vcc > U_High) U_R = Cfg.Vcc - U_High;
+    else U_R = 0;
+    Mode = Config;                 /* high side flags */
+    Ri = NV.RiH;
+  }
+
+  if (Mode & IV_HIGH_RL)           /* Rl (and Ri of pin) */
+  {
+    /* I = U / (R_l + R_i), in 0.1 A, scaled to nA */
+    Value = (uint32_t)U_R * 100000;
+    Value /= (R_LOW * 10) + Ri;
+    Value *= 100;
+  }
+  else                             /* Rh */
+  {
+    /* I = U / R_h, in nA */
+    Value = (uint32_t)U_R * 10000;
+    Value /= (R_HIGH / 100);
+  }
+  Point->I = Value;
+
+  /* all probes to HiZ */
+  ADC_DDR = 0;
+  R_DDR = 0;
+  ADC_PORT = 0;
+  R_PORT = 0;
+}
+
+
+
+/*
+ *  I-V curve tracer
+ *  - traces diode (I_F vs. V_F) or BJT (I_C vs. V_CE)
+ *  - uses the component found by the last probing cycle
+ *  - source resistors are limited to Rl/Rh, so the sweep is a set of
+ *    operating points spanning several decades of current
+ *  - BJT: one curve for each base drive level (Rh, Rl)
+ *  - plots points on color graphics displays, otherwise lists them
+ *  - sends points also as CSV via TTL serial if UI_SERIAL_COPY or
+ *    UI_SERIAL_COMMANDS is enabled
+ */
+
+void CurveTracer_Tool(void)
+{
+  IV_Type           Buffer[IV_POINTS];  /* I-V points */
+  uint8_t           Points;             /* number of points */
+  uint8_t           High, Low, Base;    /* probe pins */
+  uint8_t           Drive;              /* base drive */
+  const uint8_t     *Setup;             /* probe setups */
+  uint8_t           Test = KEY_SHORT;   /* user feedback / loop control */
+  uint8_t           n, m;               /* counters */
+  #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+  uint8_t           Control;            /* output control */
+  #endif
+
+  /* probe setups for diode: Rh/Rh, Rh, Rl/Rl, Rl */
+  const uint8_t     Diode_Setup[4] =
+    { IV_HIGH_RH | IV_LOW_RH, IV_HIGH_RH, IV_HIGH_RL | IV_LOW_RL, IV_HIGH_RL };
+
+  /* probe setups for NPN: C via Rh, C/E via Rl, C via Rl */
+  const uint8_t     NPN_Setup[3] =
+    { IV_HIGH_RH, IV_HIGH_RL | IV_LOW_RL, IV_HIGH_RL };
+
+  /* probe setups for PNP: C via Rh, C/E via Rl, C via Rl */
+  const uint8_t     PNP_Setup[3] =
+    { IV_LOW_RH | IV_BASE_DOWN | IV_I_LOW,
+      IV_HIGH_RL | IV_LOW_RL | IV_BASE_DOWN | IV_I_LOW,
+      IV_LOW_RL | IV_BASE_DOWN | IV_I_LOW };
+
+
+  /*
+   *  show info
+   */
+
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    /* display: I-V Curve */
+    Display_ColoredEEString(Curve_str, COLOR_TITLE);
+  #else
+    Display_EEString(Curve_str);             /* display: I-V Curve */
+  #endif
+
+  #ifndef FUNC_CURVE_PLOT
+  /* next-line mode: keep first line and wait for key/timeout */
+  UI.LineMode = LINE_KEEP | LINE_KEY;
+  #endif
+
+
+  /*
+   *  processing loop
+   */
+
+  while (Test > 0)
+  {
+    LCD_ClearLine2();
+    Points = 0;
+
+    if (Check.Found == COMP_DIODE)      /* diode */
+    {
+      /* high side: anode, low side: cathode */
+      UpdateProbes2(Diodes[0].A, Diodes[0].C);
+      Display_ProbeNumber(Diodes[0].A);
+      Display_Char('-');
+      Display_Char(LCD_CHAR_DIODE_AC);
+      Display_Char('-');
+      Display_ProbeNumber(Diodes[0].C);
+
+      n = 0;
+      while (n < 4)
+      {
+        Buffer[Points].Curve = 0;
+        IV_Measure(&Buffer[Points], Diode_Setup[n]);
+        Points++;
+        n++;
+      }
+    }
+    else if (Check.Found == COMP_BJT)   /* BJT */
+    {
+      if (Check.Type & TYPE_NPN)        /* NPN */
+      {
+        /* high side: collector, low side: emitter */
+        High = Semi.B;
+        Low = Semi.C;
+        Setup = NPN_Setup;
+        Display_EEString(NPN_str);
+      }
+      else                              /* PNP */
+      {
+        /* high side: emitter, low side: collector */
+        High = Semi.C;
+        Low = Semi.B;
+        Setup = PNP_Setup;
+        Display_EEString(PNP_str);
+      }
+      Base = Semi.A;
+      UpdateProbes(High, Low, Base);
+
+      /* base drive levels */
+      n = 0;
+      while (n < 2)
+      {
+        if (n == 0) Drive = IV_BASE_RH; /* low base current */
+        else Drive = IV_BASE_RL;        /* high base current */
+
+        m = 0;
+        while (m < 3)
+        {
+          Buffer[Points].Curve = n;
+          IV_Measure(&Buffer[Points], Setup[m] | Drive);
+          Points++;
+          m++;
+        }
+
+        n++;
+      }
+    }
+    else                                /* unsupported */
+    {
+      Display_EEString(Failed1_str);    /* display: No component */
+    }
+
+
+    /*
+     *  show points
+     */
+
+    if (Points)
+    {
+      #ifdef FUNC_CURVE_PLOT
+      /* plot I-V points */
+      LCD_CurvePlot(Buffer, Points);
+
+      /* show voltage span of plot in last line */
+      LCD_ClearLine(UI.CharMax_Y);
+      LCD_CharPos(1, UI.CharMax_Y);
+      Display_Value(Cfg.Vcc, -3, 'V');
+      #else
+      /* list I-V points */
+      n = 0;
+      while (n < Points)
+      {
+        Display_NextLine();
+        Display_Char('1' + Buffer[n].Curve);
+        Display_Space();
+        Display_Value(Buffer[n].U, -3, 'V');
+        Display_Space();
+        Display_Value(Buffer[n].I, -9, 'A');
+        n++;
+      }
+      #endif
+
+      #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+      /* send points via TTL serial: curve,U in mV,I in A */
+      Control = Cfg.OP_Control;         /* save output control */
+      Cfg.OP_Control &= ~OP_OUT_LCD;    /* disable display output */
+      Cfg.OP_Control |= OP_OUT_SER;     /* enable serial output */
+      Serial_NewLine();
+      n = 0;
+      while (n < Points)
+      {
+        Display_Char('1' + Buffer[n].Curve);
+        Display_Char(',');
+        Display_FullValue(Buffer[n].U, 0, 0);
+        Display_Char(',');
+        Display_FullValue(Buffer[n].I, 3, 0);
+        Display_NextLine();
+        n++;
+      }
+      Cfg.OP_Control = Control;         /* restore output control */
+      #endif
+    }
+
+
+    /*
+     *  user feedback
+     *  - short key press: re-run trace
+     *  - two short key presses: exit tool
+     */
+
+    Test = TestKey(0, CHECK_KEY_TWICE | CHECK_BAT);
+
+    if (Test == KEY_TWICE)              /* two short key presses */
+    {
+      Test = 0;                         /* end loop */
+    }
+  }
+
+  #ifndef FUNC_CURVE_PLOT
+  UI.LineMode = LINE_STD;               /* reset next-line mode */
+  #endif
+}
+
+#endif
+
+
+#ifdef THERMOCOUPLE_LOG
+
+/*
+ *  continuous logging of thermocouple temperature
+ *  - samples at a fixed grid based on the free running time base,
+ *    so display and serial output don't stretch the sampling interval
+ *    (missed slots are skipped)
+ *  - displays current value, rate of change, min/max and mean
+ *  - sends time stamp (in ms) and value via TTL serial
+ *  - any key press ends logging
+ *  - mean is a running mean, i.e. sum and counter are halved when
+ *    getting too large
+ *
+ *  requires:
+ *  - Read: function for reading temperature (in \xb0C)
+ *  - Interval: sampling interval (in ms), should match conversion time
+ */
+
+#define LOG_RATE_SIZE    10     /* max. samples for rate of change */
+#define LOG_MEAN_MAX     8192   /* max. samples for mean */
+
+void Thermo_Log(uint8_t (*Read)(int32_t *Value, int8_t *Scale), uint16_t Interval)
+{
+  uint8_t           Flag = 1;           /* loop control */
+  uint8_t           Test;               /* key / feedback */
+  uint8_t           Pos = 0;            /* position in ring buffer */
+  uint8_t           Size;               /* samples for rate of change */
+  uint8_t           Valid = 0;          /* valid samples in ring buffer */
+  uint8_t           Old;                /* position of oldest sample */
+  uint8_t           Line;               /* line number */
+  int8_t            Scale;              /* temperature scale / decimal places */
+  uint16_t          Count = 0;          /* number of samples for mean */
+  uint32_t          Step;               /* sampling interval (in ticks) */
+  uint32_t          Next;               /* tick of next sample */
+  uint32_t          Tick;               /* current tick */
+  uint32_t          Last;               /* tick of last time stamp update */
+  uint32_t          Wait;               /* time left */
+  uint32_t          Time = 0;           /* time stamp (in ms) */
+  uint32_t          Rest = 0;           /* remainder of time (in \xb5s) */
+  int32_t           Value;              /* temperature value */
+  int32_t           Min = 0;            /* min. temperature */
+  int32_t           Max = 0;            /* max. temperature */
+  int32_t           Sum = 0;            /* sum for mean */
+  int32_t           Rate;               /* rate of change (per s) */
+  int32_t           Temp;               /* temp. value */
+  int32_t           History[LOG_RATE_SIZE];  /* values for rate of change */
+  uint32_t          Stamps[LOG_RATE_SIZE];   /* time stamps for rate of change */
+  #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+  uint8_t           Control;            /* output control */
+  #endif
+
+  /* init */
+  Size = 1000 / Interval;               /* samples within 1s */
+  if (Size > LOG_RATE_SIZE) Size = LOG_RATE_SIZE;
+  if (Size < 2) Size = 2;               /* need at least two samples */
+
+  /* interval in ticks (1024 MCU cycles per tick) */
+  Step = (uint32_t)Interval * (CPU_FREQ / 1000);
+  Step /= 1024;
+
+  Last = Profile_Tick();                /* start time */
+  Next = Last;                          /* first sample right away */
+
+  LCD_ClearLine2();                     /* clear line #2 */
+
+
+  /*
+   *  processing loop
+   */
+
+  while (Flag)
+  {
+    /*
+     *  wait for next sampling slot
+     *  - 24 bit tick counter
+     */
+
+    Test = 1;
+    while (Test)
+    {
+      Tick = Profile_Tick();
+      Wait = (Next - Tick) & 0x00FFFFFF;     /* ticks left */
+
+      if ((Wait == 0) || (Wait & 0x00800000))     /* slot reached */
+      {
+        Test = 0;                       /* end loop */
+      }
+      else                              /* some time left */
+      {
+        /* convert ticks into ms */
+        Wait = (Wait * 1024) / MCU_CYCLES_PER_US;
+        Wait /= 1000;
+
+        if (Wait > 0)                   /* at least 1ms left */
+        {
+          /* wait and check for key press at the same time */
+          if (TestKey((uint16_t)Wait, 0) != KEY_TIMEOUT)
+          {
+            Test = 0;                   /* end loop */
+            Flag = 0;                   /* end logging */
+          }
+        }
+      }
+    }
+
+    if (Flag == 0) break;               /* key press */
+
+    /* next slot (skip missed ones) */
+    while (((Next - Tick) & 0x00FFFFFF) < 0x00800000)
+    {
+      Next += Step;
+      Next &= 0x00FFFFFF;
+    }
+
+    /* update time stamp */
+    Rest += (((Tick - Last) & 0x00FFFFFF) * 1024) / MCU_CYCLES_PER_US;
+    Last = Tick;
+    Time += Rest / 1000;                /* add full ms */
+    Rest %= 1000;                       /* keep remainder */
+
+
+    /*
+     *  read temperature
+     */
+
+    LCD_ClearLine2();                   /* clear line #2 */
+
+    Test = Read(&Value, &Scale);
+
+    if (Test == 0)                      /* some error */
+    {
+      Display_Minus();                  /* display: - */
+      continue;                         /* next sample */
+    }
+
+    #ifdef UI_FAHRENHEIT
+    /* convert Celsius into Fahrenheit */
+    Value = Celsius2Fahrenheit(Value, Scale);
+    #endif
+
+
+    /*
+     *  statistics
+     */
+
+    if (Count == 0)                     /* first sample */
+    {
+      Min = Value;
+      Max = Value;
+    }
+    else                                /* update min/max */
+    {
+      if (Value < Min) Min = Value;
+      if (Value > Max) Max = Value;
+    }
+
+    /* running mean: halve sum and counter before overflow */
+    if (Count >= LOG_MEAN_MAX)
+    {
+      Sum /= 2;
+      Count /= 2;
+    }
+    Sum += Value;
+    Count++;
+
+    /* rate of change based on oldest sample in ring buffer */
+    Rate = 0;
+    if (Valid > 0)                      /* got samples */
+    {
+      Old = 0;                          /* first entry */
+      if (Valid >= Size) Old = Pos;     /* filled: entry to be overwritten */
+
+      if (Time > Stamps[Old])           /* some time passed */
+      {
+        Rate = (Value - History[Old]) * 1000;
+        Rate /= (int32_t)(Time - Stamps[Old]);
+      }
+    }
+
+    /* add sample to ring buffer */
+    History[Pos] = Value;
+    Stamps[Pos] = Time;
+    Pos++;                              /* next entry */
+    if (Pos >= Size) Pos = 0;           /* wrap around */
+    if (Valid < Size) Valid++;          /* one more valid sample */
+
+
+    /*
+     *  display values
+     */
+
+    /* line #2: current value and rate of change */
+    Display_SignedFullValue(Value, Scale, '\xb0');
+    #ifdef UI_FAHRENHEIT
+      Display_Char('F');                /* display: F (Fahrenheit) */
+    #else
+      Display_Char('C');                /* display: C (Celsius) */
+    #endif
+    Display_Space();
+    Display_SignedFullValue(Rate, Scale, '/');
+    Display_Char('s');                  /* display: /s */
+
+    /* line #3 and following: min, max and mean */
+    Test = 0;
+    Line = 3;                           /* start with line #3 */
+    while ((Test < 3) && (Line <= UI.CharMax_Y))
+    {
+      LCD_ClearLine(Line);              /* clear line */
+      LCD_CharPos(1, Line);             /* move to start of line */
+
+      switch (Test)
+      {
+        case 0:                         /* min */
+          Display_EEString_Space(StatsMin_str);
+          Temp = Min;
+          break;
+
+        case 1:                         /* max */
+          Display_EEString_Space(StatsMax_str);
+          Temp = Max;
+          break;
+
+        default:                        /* mean */
+          Display_EEString_Space(StatsMean_str);
+          Temp = Sum / (int32_t)Count;
+          break;
+      }
+
+      Display_SignedFullValue(Temp, Scale, 0);
+
+      Line++;                           /* next line */
+      Test++;                           /* next value */
+    }
+
+    #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+    /* send sample via TTL serial: time stamp in ms,temperature */
+    Control = Cfg.OP_Control;           /* save output control */
+    Cfg.OP_Control &= ~OP_OUT_LCD;      /* disable display output */
+    Cfg.OP_Control |= OP_OUT_SER;       /* enable serial output */
+    Serial_NewLine();
+    Display_FullValue(Time, 0, 0);
+    Display_Char(',');
+    Display_SignedFullValue(Value, Scale, 0);
+    Cfg.OP_Control = Control;           /* restore output control */
+    #endif
+  }
+}
+
+/* clean-up of local constants */
+#undef LOG_RATE_SIZE
+#undef LOG_MEAN_MAX
+
+#endif
+
+
+
+#ifdef SW_HISTORY
+
+/*
+ *  add current probing result to history
+ *  - stores a compact record of the component found (type, pinout and
+ *    key values)
+ *  - overwrites the oldest record when the ring buffer is full
+ */
+
+void History_Add(void)
+{
+  History_Type      *Entry;             /* pointer to record */
+  Capacitor_Type    *MaxCap;            /* pointer to largest cap */
+  uint8_t           n;                  /* counter */
+
+  if (Check.Found < COMP_RESISTOR) return;   /* no component */
+
+  Entry = &History[HistIndex];          /* next position */
+
+  /* type and pinout of 3-pin semiconductors */
+  Entry->Found = Check.Found;
+  Entry->Type = Check.Type;
+  Entry->A = Semi.A;
+  Entry->B = Semi.B;
+  for (n = 0; n <= 2; n++)              /* loop through probe pins */
+  {
+    Entry->Des[n] = Get_SemiPinDesignator(n);
+  }
+  Entry->Scale = 0;
+  Entry->Value = 0;
+  Entry->U = 0;
+
+  switch (Check.Found)
+  {
+    case COMP_RESISTOR:
+      Entry->Type = Check.Resistors;        /* number of resistors */
+      Entry->A = Resistors[0].A;
+      Entry->B = Resistors[0].B;
+      Entry->Scale = Resistors[0].Scale;
+      Entry->Value = Resistors[0].Value;
+      break;
+
+    case COMP_CAPACITOR:
+      /* find largest cap (same as Show_Capacitor()) */
+      MaxCap = &Caps[0];
+      for (n = 1; n <= 2; n++)
+      {
+        if (CmpValue(Caps[n].Value, Caps[n].Scale, MaxCap->Value, MaxCap->Scale) == 1)
+        {
+          MaxCap = &Caps[n];
+        }
+      }
+      Entry->A = MaxCap->A;
+      Entry->B = MaxCap->B;
+      Entry->Scale = MaxCap->Scale;
+      Entry->Value = MaxCap->Value;
+      break;
+
+    case COMP_DIODE:
+      Entry->Type = Check.Diodes;           /* number of diodes */
+      Entry->A = Diodes[0].A;               /* anode */
+      Entry->B = Diodes[0].C;               /* cathode */
+      Entry->U = Diodes[0].V_f;             /* V_f */
+      break;
+
+    case COMP_ZENER:
+      Entry->U = Semi.U_1;                  /* V_Z */
+      break;
+
+    case COMP_BJT:
+      Entry->Value = Semi.F_1;              /* hFE */
+      break;
+
+    case COMP_FET:
+    case COMP_IGBT:
+      Entry->U = Semi.U_2;                  /* V_th */
+      break;
+
+    case COMP_THYRISTOR:
+    case COMP_TRIAC:
+      Entry->U = Semi.U_1;                  /* V_GT */
+      break;
+
+    case COMP_PUT:
+      Entry->U = AltSemi.U_2;               /* V_T */
+      break;
+  }
+
+  /* manage ring buffer */
+  HistIndex++;                          /* next position */
+  if (HistIndex >= HISTORY_SIZE) HistIndex = 0;
+  if (HistCount < HISTORY_SIZE) HistCount++;  /* one record more */
+  HistNumber++;                         /* total number of records */
+}
+
+
+
+/*
+ *  get history record
+ *
+ *  requires:
+ *  - Age: 0 for latest record, 1 for previous one, and so on
+ *
+ *  returns:
+ *  - pointer to record
+ */
+
+History_Type *History_Get(uint8_t Age)
+{
+  uint8_t           Pos;                /* position in ring buffer */
+
+  Pos = HISTORY_SIZE + HistIndex - 1 - Age;
+  if (Pos >= HISTORY_SIZE) Pos -= HISTORY_SIZE;
+
+  return &History[Pos];
+}
+
+
+
+/*
+ *  display component type and pinout of history record
+ *  - 2-pin components: probe pins and symbol, e.g. 1-|>-3
+ *  - 3-pin semis: type, e.g. BJT NPN
+ *
+ *  requires:
+ *  - Entry: pointer to record
+ */
+
+void History_Part(History_Type *Entry)
+{
+  uint8_t           Char1;              /* left part of symbol */
+  uint8_t           Char2 = 0;          /* right part of symbol */
+
+  if (Entry->Found < COMP_DIODE)        /* R or C */
+  {
+    if (Entry->Found == COMP_RESISTOR)  /* resistor */
+    {
+      Char1 = LCD_CHAR_RESISTOR_L;
+      Char2 = LCD_CHAR_RESISTOR_R;
+    }
+    else                                /* capacitor */
+    {
+      Char1 = LCD_CHAR_CAP;
+    }
+  }
+  else if (Entry->Found <= COMP_ZENER)  /* diode */
+  {
+    Char1 = LCD_CHAR_DIODE_AC;
+  }
+  else                                  /* 3-pin semi */
+  {
+    switch (Entry->Found)
+    {
+      case COMP_BJT:
+        Display_EEString_Space(BJT_str);
+        if (Entry->Type & TYPE_NPN) Display_EEString(NPN_str);
+        else Display_EEString(PNP_str);
+        break;
+
+      case COMP_FET:
+      case COMP_IGBT:
+        if (Entry->Found == COMP_FET) Display_EEString_Space(FET_str);
+        else Display_EEString_Space(IGBT_str);
+        if (Entry->Type & TYPE_N_CHANNEL) Display_Char('N');
+        else Display_Char('P');
+        Display_EEString(Channel_str);
+        break;
+
+      case COMP_THYRISTOR:
+        Display_EEString(Thyristor_str);
+        break;
+
+      case COMP_TRIAC:
+        Display_EEString(Triac_str);
+        break;
+
+      case COMP_PUT:
+        Display_EEString(PUT_str);
+        break;
+
+      #ifdef SW_UJT
+      case COMP_UJT:
+        Display_EEString(UJT_str);
+        break;
+      #endif
+    }
+
+    return;
+  }
+
+  #ifdef HW_PROBE_ZENER
+  if (Entry->Found == COMP_ZENER)       /* Zener on dedicated probes */
+  {
+    Display_EEString(Zener_str);
+    return;
+  }
+  #endif
+
+  /* 2-pin component: probe-symbol-probe */
+  Display_ProbeNumber(Entry->A);
+  Display_Char('-');
+  Display_Char(Char1);
+  if (Char2) Display_Char(Char2);
+  Display_Char('-');
+  Display_ProbeNumber(Entry->B);
+}
+
+
+
+/*
+ *  display pinout and key value of history record
+ *  - 2-pin components: R, C, V_f or V_Z
+ *  - 3-pin semis: pinout followed by hFE, V_th, V_GT or V_T
+ *
+ *  requires:
+ *  - Entry: pointer to record
+ *  - Mode: 0 for display (value with name), 1 for serial (comma separated)
+ */
+
+void History_Value(History_Type *Entry, uint8_t Mode)
+{
+  uint8_t           n;                  /* counter */
+  const unsigned char *String = NULL;   /* name of value */
+
+  /* pinout */
+  if (Entry->Found >= COMP_BJT)         /* 3-pin semi */
+  {
+    if (Mode == 0)                      /* display */
+    {
+      for (n = 0; n <= 2; n++)          /* display: 123= */
+      {
+        Display_ProbeNumber(n);
+      }
+      Display_Char('=');
+    }
+
+    for (n = 0; n <= 2; n++)            /* pin designators */
+    {
+      Display_Char(Entry->Des[n]);
+    }
+  }
+  else if (Mode)                        /* 2-pin component via serial */
+  {
+    if (Entry->Found != COMP_ZENER)     /* not on dedicated probes */
+    {
+      Display_ProbeNumber(Entry->A);    /* send probe pins */
+      Display_ProbeNumber(Entry->B);
+    }
+  }
+
+  /* name of value */
+  switch (Entry->Found)
+  {
+    case COMP_DIODE:
+      String = Vf_str;
+      break;
+
+    case COMP_BJT:
+      String = h_FE_str;
+      break;
+
+    case COMP_FET:
+    case COMP_IGBT:
+      String = Vth_str;
+      break;
+
+    case COMP_THYRISTOR:
+    case COMP_TRIAC:
+      String = V_GT_str;
+      break;
+
+    case COMP_PUT:
+      String = V_T_str;
+      break;
+  }
+
+  if (Mode)                             /* serial */
+  {
+    Display_Char(',');                  /* field separator */
+  }
+  else if (String)                      /* display with name */
+  {
+    if (Entry->Found >= COMP_BJT)       /* below pinout */
+    {
+      Display_NL_EEString_Space(String);
+    }
+    else
+    {
+      Display_EEString_Space(String);
+    }
+  }
+
+  if (Entry->Found == COMP_UJT) return; /* no value */
+
+  /* value */
+  switch (Entry->Found)
+  {
+    case COMP_RESISTOR:
+      Display_Value(Entry->Value, Entry->Scale, LCD_CHAR_OMEGA);
+      break;
+
+    case COMP_CAPACITOR:
+      Display_Value(Entry->Value, Entry->Scale, 'F');
+      break;
+
+    case COMP_BJT:
+      Display_Value(Entry->Value, 0, 0);
+      break;
+
+    default:                            /* voltage */
+      Display_SignedValue(Entry->U, -3, 'V');
+      break;
+  }
+}
+
+
+
+#ifdef UI_SERIAL_COMMANDS
+
+/*
+ *  send history
+ *  - one record per line, oldest first
+ *  - format: <number>,<type ID>,<pinout>,<value>
+ *    pinout: probe pins of 2-pin parts (e.g. 13) or designators of
+ *    probes #1-#3 (e.g. EBC)
+ *  - output goes to the currently selected channels
+ *
+ *  returns:
+ *  - number of records sent (0 if history is empty)
+ */
+
+uint8_t History_Send(void)
+{
+  uint8_t           n;                  /* counter */
+  uint16_t          Number;             /* record number */
+  History_Type      *Entry;             /* pointer to record */
+
+  Number = HistNumber - HistCount;      /* number of oldest record -1 */
+
+  n = HistCount;
+  while (n > 0)
+  {
+    n--;                                /* age of record */
+    Number++;                           /* record number */
+    Entry = History_Get(n);
+
+    Display_FullValue(Number, 0, 0);    /* send number */
+    Display_Char(',');
+    Display_FullValue(Entry->Found, 0, 0);   /* send type ID */
+    Display_Char(',');
+
+    History_Value(Entry, 1);            /* send value(s) */
+    if (n > 0) Serial_NewLine();        /* next record */
+  }
+
+  return HistCount;
+}
+
+#endif
+
+
+
+/*
+ *  history tool
+ *  - browse the records of the last probing results
+ *  - short key press or right turn: previous (older) record
+ *  - left turn: next (newer) record
+ *  - two short key presses: exit
+ */
+
+void History_Tool(void)
+{
+  uint8_t           Flag = 1;           /* loop control */
+  uint8_t           Test;               /* user feedback */
+  uint8_t           Age = 0;            /* age of record */
+  History_Type      *Entry;             /* pointer to record */
+
+  while (Flag)
+  {
+    /* display record */
+    LCD_Clear();
+    #ifdef UI_COLORED_TITLES
+      Display_ColoredEEString(History_str, COLOR_TITLE);
+    #else
+      Display_EEString(History_str);    /* display: History */
+    #endif
+
+    if (HistCount == 0)                 /* empty history */
+    {
+      Display_Space();
+      Display_Minus();                  /* display: - */
+    }
+    else                                /* got records */
+    {
+      Display_Space();
+      Display_Char('#');
+      /* 1 is the latest record */
+      Display_FullValue(HistNumber - Age, 0, 0);
+
+      Entry = History_Get(Age);
+      LCD_CharPos(1, 2);                /* line #2 */
+      History_Part(Entry);              /* display component */
+      LCD_CharPos(1, 3);                /* line #3 */
+      History_Value(Entry, 0);          /* display value(s) */
+    }
+
+    /* user feedback */
+    Test = TestKey(0, CHECK_KEY_TWICE | CHECK_BAT | CURSOR_STEADY);
+
+    if (Test == KEY_TWICE)              /* two short key presses */
+    {
+      Flag = 0;                         /* end loop */
+    }
+    else if ((Test == KEY_SHORT) || (Test == KEY_RIGHT))
+    {
+      /* previous record */
+      Age++;
+      if (Age >= HistCount) Age = 0;    /* roll over to latest */
+    }
+    else if (Test == KEY_LEFT)          /* left turn */
+    {
+      /* next record */
+      if (Age > 0) Age--;
+      else if (HistCount > 0) Age = HistCount - 1;     /* roll over */
+    }
+  }
+}
+
+#endif
+
+
+
+#ifdef SW_REPEAT_STATS
+
+/*
+ *  local constants for repeat measurement
+ */
+
+/* quantities */
+#define REP_R              1    /* resistance */
+#define REP_L              2    /* inductance */
+#define REP_C              3    /* capacitance */
+#define REP_ESR            4    /* ESR */
+#define REP_V_F            5    /* forward voltage */
+#define REP_HFE            6    /* hFE */
+
+#define REP_DEV_MAX        5000 /* max. deviation from first sample */
+
+
+
+/*
+ *  reset running statistics
+ *
+ *  requires:
+ *  - Stats: pointer to statistics
+ *  - Quantity: quantity ID
+ */
+
+void Repeat_Reset(Repeat_Type *Stats, uint8_t Quantity)
+{
+  Stats->Quantity = Quantity;
+  Stats->N = 0;
+  Stats->Mean = 0;
+  Stats->M2 = 0;
+}
+
+
+
+/*
+ *  add sample to running statistics
+ *  - Welford's method: mean and sum of squared deviations are updated
+ *    for each sample, no samples are stored
+ *  - the first sample sets reference and scale (max. 4 digits),
+ *    following samples are taken as deviation from the reference (in
+ *    1/4 units, max. +/-REP_DEV_MAX units) to keep the sums in 32 bits
+ *
+ *  requires:
+ *  - Stats: pointer to statistics
+ *  - Value: value
+ *  - Scale: exponent of factor (value * 10^x)
+ */
+
+void Repeat_Add(Repeat_Type *Stats, uint32_t Value, int8_t Scale)
+{
+  int32_t           X;                  /* deviation (in 1/4 units) */
+  int32_t           Delta;              /* difference to mean */
+
+  if (Stats->N == 0)                    /* first sample */
+  {
+    /* normalize to 4 digits */
+    while (Value > 9999)
+    {
+      Value /= 10;
+      Scale++;
+    }
+
+    Stats->Scale = Scale;
+    Stats->First = Value;
+    Stats->Min = Value;
+    Stats->Max = Value;
+  }
+  else                                  /* following sample */
+  {
+    /* use scale of first sample */
+    Value = RescaleValue(Value, Scale, Stats->Scale);
+    if (Value < Stats->Min) Stats->Min = Value;
+    if (Value > Stats->Max) Stats->Max = Value;
+  }
+
+  /* deviation from reference */
+  if (Value >= Stats->First)            /* above reference */
+  {
+    Value -= Stats->First;
+    if (Value > REP_DEV_MAX) Value = REP_DEV_MAX;
+    X = (int32_t)Value;
+  }
+  else                                  /* below reference */
+  {
+    Value = Stats->First - Value;
+    if (Value > REP_DEV_MAX) Value = REP_DEV_MAX;
+    X = -(int32_t)Value;
+  }
+  X *= 4;                               /* scale to 1/4 units */
+
+  /* update mean and sum of squared deviations */
+  Stats->N++;
+  Delta = X - Stats->Mean;              /* difference to old mean */
+  Stats->Mean += Delta / Stats->N;      /* new mean */
+  Delta *= X - Stats->Mean;             /* * difference to new mean */
+                                        /* both have the same sign */
+
+  if (Stats->M2 > (UINT32_MAX - (uint32_t)Delta))
+  {
+    Stats->M2 = UINT32_MAX;             /* saturate */
+  }
+  else
+  {
+    Stats->M2 += (uint32_t)Delta;
+  }
+}
+
+
+
+/*
+ *  display running statistics
+ *  - display: name and mean, sd, min and max in separate lines
+ *  - serial: <name>:<mean>,<sd>,<min>,<max>
+ *  - sd is shown with one more decimal place if possible
+ *
+ *  requires:
+ *  - Stats: pointer to statistics
+ *  - Mode: 0 for display, 1 for serial
+ */
+
+void Repeat_Show(Repeat_Type *Stats, uint8_t Mode)
+{
+  const unsigned char *String = NULL;   /* name of quantity */
+  unsigned char     Name = 0;           /* single char name */
+  unsigned char     Unit = 0;           /* unit */
+  uint32_t          Value;              /* mean */
+  uint32_t          Var;                /* variance */
+  uint16_t          Dev = 0;            /* standard deviation */
+  int8_t            Scale;              /* exponent of sd */
+
+  switch (Stats->Quantity)
+  {
+    case REP_R:
+      Name = 'R';
+      Unit = LCD_CHAR_OMEGA;
+      break;
+
+    case REP_L:
+      Name = 'L';
+      Unit = 'H';
+      break;
+
+    case REP_C:
+      Name = 'C';
+      Unit = 'F';
+      break;
+
+    #if defined (SW_ESR) || defined (SW_OLD_ESR)
+    case REP_ESR:
+      String = ESR_str;
+      Unit = LCD_CHAR_OMEGA;
+      break;
+    #endif
+
+    case REP_V_F:
+      String = Vf_str;
+      Unit = 'V';
+      break;
+
+    case REP_HFE:
+      String = h_FE_str;
+      break;
+  }
+
+  /* mean: reference + mean deviation (rounded) */
+  Value = Stats->First * 4;
+  Value += Stats->Mean + 2;             /* mean deviation is >= -reference */
+  Value /= 4;
+
+  /* standard deviation: sqrt(M2 / (N - 1)) */
+  Scale = Stats->Scale;
+  if (Stats->N > 1)
+  {
+    Var = Stats->M2 / (Stats->N - 1);   /* variance (in 1/16 units^2) */
+    if (Var < (UINT32_MAX / 25))        /* one more decimal place */
+    {
+      Var *= 25;                        /* * 100/16 */
+      Var /= 4;
+      Scale--;
+    }
+    else                                /* keep scale */
+    {
+      Var /= 16;
+    }
+    Dev = Stats_Sqrt(Var);
+  }
+
+  /* name and mean */
+  if (Mode == 0)                        /* display */
+  {
+    Display_NextLine();
+  }
+  if (String) Display_EEString(String);
+  else Display_Char(Name);
+  if (Mode)                             /* serial */
+  {
+    Display_Colon();
+  }
+  else                                  /* display */
+  {
+    Display_Space();
+    Display_EEString_Space(StatsMean_str);
+  }
+  Display_Value(Value, Stats->Scale, Unit);
+
+  /* sd, min and max */
+  if (Mode)                             /* serial: comma separated */
+  {
+    Display_Char(',');
+    Display_Value(Dev, Scale, Unit);
+    Display_Char(',');
+    Display_Value(Stats->Min, Stats->Scale, Unit);
+    Display_Char(',');
+    Display_Value(Stats->Max, Stats->Scale, Unit);
+  }
+  else                                  /* display: one line each */
+  {
+    Display_NL_EEString_Space(StatsDev_str);
+    Display_Value(Dev, Scale, Unit);
+    Display_NL_EEString_Space(StatsMin_str);
+    Display_Value(Stats->Min, Stats->Scale, Unit);
+    Display_NL_EEString_Space(StatsMax_str);
+    Display_Value(Stats->Max, Stats->Scale, Unit);
+  }
+}
+
+
+
+/*
+ *  repeat value measurements of last probing result
+ *  - no identification, the pins of the last result are used
+ *  - resistor: R and L (single resistor and SW_INDUCTOR)
+ *  - capacitor: C of largest cap and ESR (SW_ESR or SW_OLD_ESR)
+ *  - diode: V_f of first diode with Rl
+ *  - BJT: hFE in common collector circuit
+ *  - restores the results of the probing cycle
+ *
+ *  requires:
+ *  - Stats: pointer to array of 2 statistics
+ *  - Mode: 1 for displaying progress in line #2, 0 for none
+ *
+ *  returns:
+ *  - number of quantities (0 for unsupported component)
+ */
+
+uint8_t Repeat_Run(Repeat_Type *Stats, uint8_t Mode)
+{
+  uint8_t           Items = 1;          /* number of quantities */
+  uint8_t           Run = 0;            /* counter */
+  uint8_t           Type = 0;           /* BJT type */
+  uint8_t           Pin1 = 0;           /* probe pin #1 */
+  uint8_t           Pin2 = 0;           /* probe pin #2 */
+  uint16_t          U[2];               /* voltages */
+  #if defined (SW_ESR) || defined (SW_OLD_ESR)
+  uint16_t          ESR;                /* ESR (in 0.01 Ohms) */
+  #endif
+  uint32_t          Value;              /* value */
+  Check_Type        Backup;             /* results of probing cycle */
+  Resistor_Type     R_Backup;           /* first resistor */
+  Capacitor_Type    C_Backup;           /* first cap */
+  Capacitor_Type    *Cap;               /* pointer to cap */
+  #ifdef SW_INDUCTOR
+  Inductor_Type     L_Backup;           /* inductance */
+  #endif
+  int16_t           I_e;                /* I_e of probing cycle */
+
+  Backup = Check;                       /* save results */
+  R_Backup = Resistors[0];
+  C_Backup = Caps[0];
+  #ifdef SW_INDUCTOR
+  L_Backup = Inductor;
+  #endif
+  I_e = Semi.U_2;
+
+
+  /*
+   *  set up quantities and probe pins
+   */
+
+  switch (Backup.Found)
+  {
+    case COMP_RESISTOR:
+      Repeat_Reset(&Stats[0], REP_R);
+      /* CheckResistor() pulls up pin B */
+      Pin1 = Resistors[0].B;
+      Pin2 = Resistors[0].A;
+      #ifdef SW_INDUCTOR
+      if (Backup.Resistors == 1)        /* single resistor */
+      {
+        Repeat_Reset(&Stats[1], REP_L);
+        Items = 2;
+      }
+      #endif
+      break;
+
+    case COMP_CAPACITOR:
+      Repeat_Reset(&Stats[0], REP_C);
+      /* find largest cap (same as Show_Capacitor()) */
+      Cap = &Caps[0];
+      for (Run = 1; Run <= 2; Run++)
+      {
+        if (CmpValue(Caps[Run].Value, Caps[Run].Scale, Cap->Value, Cap->Scale) == 1)
+        {
+          Cap = &Caps[Run];
+        }
+      }
+      Run = 0;
+      /* MeasureCap() pulls up pin B */
+      Pin1 = Cap->B;
+      Pin2 = Cap->A;
+      #if defined (SW_ESR) || defined (SW_OLD_ESR)
+      Repeat_Reset(&Stats[1], REP_ESR);
+      Items = 2;
+      #endif
+      break;
+
+    case COMP_DIODE:
+      Repeat_Reset(&Stats[0], REP_V_F);
+      Pin1 = Diodes[0].A;               /* anode */
+      Pin2 = Diodes[0].C;               /* cathode */
+      break;
+
+    case COMP_BJT:
+      Repeat_Reset(&Stats[0], REP_HFE);
+      if (Backup.Type & TYPE_NPN)       /* NPN */
+      {
+        Type = TYPE_NPN;
+      }
+      else                              /* PNP */
+      {
+        Type = TYPE_PNP;
+      }
+      break;
+
+    default:                            /* not supported */
+      return 0;
+  }
+
+
+  /*
+   *  measurement runs
+   */
+
+  while (Run < REPEAT_RUNS)
+  {
+    if (Mode)                           /* display progress */
+    {
+      LCD_CharPos(1, 2);
+      Display_Value(Run + 1, 0, 0);
+      Display_Char('/');
+      Display_Value(REPEAT_RUNS, 0, 0);
+    }
+
+    Check.Found = COMP_NONE;            /* reset component type */
+    DischargeProbes();                  /* try to discharge probes */
+    if (Check.Found == COMP_ERROR) break;    /* discharge failed */
+
+    switch (Backup.Found)
+    {
+      case COMP_RESISTOR:
+        if (CheckSingleResistor(Pin1, Pin2, 0) == 1)
+        {
+          Repeat_Add(&Stats[0], Resistors[0].Value, Resistors[0].Scale);
+
+          #ifdef SW_INDUCTOR
+          if (Items == 2)               /* single resistor */
+          {
+            if (MeasureInductor(&Resistors[0]) == 1)
+            {
+              Repeat_Add(&Stats[1], Inductor.Value, Inductor.Scale);
+            }
+          }
+          #endif
+        }
+        break;
+
+      case COMP_CAPACITOR:
+        MeasureCap(Pin1, Pin2, 0);
+        if (Check.Found == COMP_CAPACITOR)   /* found cap */
+        {
+          Repeat_Add(&Stats[0], Caps[0].Value, Caps[0].Scale);
+
+          #if defined (SW_ESR) || defined (SW_OLD_ESR)
+          ESR = MeasureESR(&Caps[0]);
+          if (ESR < UINT16_MAX)         /* valid ESR */
+          {
+            Repeat_Add(&Stats[1], ESR, -2);
+          }
+          #endif
+        }
+        break;
+
+      case COMP_DIODE:
+        /* probe-3: remaining probe */
+        UpdateProbes(Pin1, Pin2, 3 - Pin1 - Pin2);
+
+        /* same as V_f #1 of CheckDiode() */
+        /* set probes: Gnd -- probe-2 / probe-1 -- Rl -- Vcc */
+        ADC_PORT = 0;
+        ADC_DDR = Probes.Pin_2;         /* pull down cathode directly */
+        R_DDR = Probes.Rl_1;            /* enable Rl for probe-1 */
+        R_PORT = Probes.Rl_1;           /* pull up anode via Rl */
+        settle5ms();                    /* settle time */
+        ReadU_Multi(READ_CH_1 | READ_CH_2, U);   /* get voltages */
+        ADC_DDR = 0;                    /* reset probes */
+        R_DDR = 0;
+        R_PORT = 0;
+
+        if (U[0] > U[1])                /* prevent underrun */
+        {
+          Repeat_Add(&Stats[0], U[0] - U[1], -3);
+        }
+        break;
+
+      case COMP_BJT:
+        /* NPN: probe-1 = C / probe-2 = E / probe-3 = B */
+        /* PNP: probe-1 = E / probe-2 = C / probe-3 = B */
+        if (Type == TYPE_NPN) UpdateProbes(Semi.B, Semi.C, Semi.A);
+        else UpdateProbes(Semi.C, Semi.B, Semi.A);
+
+        Value = Get_hFE_C(Type);
+        if (Value > 0) Repeat_Add(&Stats[0], Value, 0);
+        break;
+    }
+
+    Run++;                              /* next run */
+  }
+
+  DischargeProbes();                    /* try to discharge probes */
+
+
+  /*
+   *  restore results of probing cycle
+   */
+
+  Check = Backup;
+  Resistors[0] = R_Backup;
+  Caps[0] = C_Backup;
+  #ifdef SW_INDUCTOR
+  Inductor = L_Backup;
+  #endif
+  Semi.U_2 = I_e;
+
+  /* check for valid samples */
+  if (Stats[0].N == 0) return 0;        /* no valid samples */
+  if ((Items == 2) && (Stats[1].N == 0)) Items = 1;
+
+  return Items;
+}
+
+
+
+#ifdef UI_SERIAL_COMMANDS
 
 /*
- *  continuity check
- *  - uses probes #1 (pos) and #3 (neg)
- *  - requires buzzer
+ *  send statistics of repeat measurement
+ *  - format: <name>:<mean>,<sd>,<min>,<max> for each quantity,
+ *    separated by a space
+ *  - output goes to the currently selected channels
+ *
+ *  returns:
+ *  - number of quantities (0 for unsupported component)
  */
 
-void ContinuityCheck(void)
+uint8_t Repeat_Send(void)
 {
-  uint8_t           Flag;               /* loop control */
+  uint8_t           Items;              /* number of quantities */
+  Repeat_Type       Stats[2];           /* statistics */
+
+  Items = Repeat_Run(Stats, 0);         /* run measurements */
+
+  if (Items > 0)
+  {
+    Repeat_Show(&Stats[0], 1);          /* send first quantity */
+
+    if (Items > 1)
+    {
+      Display_Space();
+      Repeat_Show(&Stats[1], 1);        /* send second quantity */
+    }
+  }
+
+  return Items;
+}
+
+#endif
+
+
+
+/*
+ *  repeat measurement tool
+ *  - repeats the value measurements of the last probing result and
+ *    shows mean, sd, min and max
+ *  - short key press: run again
+ *  - two short key presses: exit
+ */
+
+void Repeat_Tool(void)
+{
+  uint8_t           Flag = 1;           /* loop control */
   uint8_t           Test;               /* user feedback */
-  uint16_t          U1;                 /* measured voltage #1 */
-  uint16_t          U2;                 /* measured voltage #2 */
+  uint8_t           Items;              /* number of quantities */
+  Repeat_Type       Stats[2];           /* statistics */
 
-  /* local constants for Flag (bitfield) */
-  #define RUN_FLAG            0b00000001     /* run / otherwise end */
-  #define BEEP_SHORT          0b00000010     /* short beep */
+  while (Flag)
+  {
+    /* display: Repeat <n>x */
+    LCD_Clear();
+    #ifdef UI_COLORED_TITLES
+      Display_ColoredEEString_Space(Repeat_str, COLOR_TITLE);
+    #else
+      Display_EEString_Space(Repeat_str);    /* display: Repeat */
+    #endif
+    Display_Value(REPEAT_RUNS, 0, 'x');
+
+    Items = Repeat_Run(Stats, 1);       /* run measurements */
+
+    LCD_ClearLine2();                   /* clear progress */
+
+    if (Items == 0)                     /* unsupported component */
+    {
+      Display_Minus();                  /* display: - */
+    }
+    else                                /* got statistics */
+    {
+      /* next-line mode: keep first line and wait for key/timeout */
+      UI.LineMode = LINE_KEEP | LINE_KEY;
+      LCD_CharPos(1, 1);                /* results start at line #2 */
+
+      Repeat_Show(&Stats[0], 0);        /* display first quantity */
+      if (Items > 1)
+      {
+        Repeat_Show(&Stats[1], 0);      /* display second quantity */
+      }
+
+      UI.LineMode = LINE_STD;           /* reset next-line mode */
+    }
+
+    /* user feedback */
+    Test = TestKey(0, CHECK_KEY_TWICE | CHECK_BAT | CURSOR_STEADY);
+
+    if (Test == KEY_TWICE)              /* two short key presses */
+    {
+      Flag = 0;                         /* end loop */
+    }
+  }
+}
+
+
+/* clean-up of local constants */
+#undef REP_R
+#undef REP_L
+#undef REP_C
+#undef REP_ESR
+#undef REP_V_F
+#undef REP_HFE
+#undef REP_DEV_MAX
+
+#endif
+
+
+
+#ifdef SW_LOGGER
+
+/*
+ *  local constants for data logger
+ */
+
+/* measurement sources */
+#define LOG_SRC_R          1    /* resistance */
+#define LOG_SRC_C          2    /* capacitance */
+#define LOG_SRC_L          3    /* inductance */
+#define LOG_SRC_ESR        4    /* ESR */
+#define LOG_SRC_U          5    /* voltage */
+#define LOG_SRC_DS18B20    6    /* DS18B20 temperature */
+#define LOG_SRC_MAX31855   7    /* MAX31855 temperature */
+#define LOG_SRC_MAX6675    8    /* MAX6675 temperature */
+
+#define LOG_SOURCES        8    /* max. number of sources */
+#define LOG_LCD_UPDATE     1000 /* min. time between display updates (ms) */
+
+
+
+/*
+ *  select value from table
+ *  - short key press or right turn: next value
+ *  - left turn: previous value
+ *  - long key press: select value
+ *
+ *  requires:
+ *  - Line: line number
+ *  - Items: number of table entries
+ *  - Table: table with values stored in EEPROM
+ *  - Index: index of default value
+ *  - DecPlaces: decimal places of values
+ *  - Unit: unit character (0 = none)
+ *
+ *  returns:
+ *  - selected value
+ */
+
+uint16_t Logger_Select(uint8_t Line, uint8_t Items, const uint16_t *Table, uint8_t Index, uint8_t DecPlaces, unsigned char Unit)
+{
+  uint8_t           Test = KEY_NONE;    /* user feedback */
+  uint16_t          Value = 0;          /* return value */
+
+  while (Test != KEY_LONG)
+  {
+    /* display current value */
+    Value = DATA_read_word(&Table[Index]);
+    LCD_ClearLine(Line);
+    LCD_CharPos(1, Line);
+    Display_Char('>');
+    Display_FullValue(Value, DecPlaces, Unit);
+
+    /* wait for user input */
+    Test = TestKey(0, CURSOR_BLINK | CHECK_BAT);
+
+    #ifdef HW_KEYS
+    if (Test == KEY_LEFT)               /* left key */
+    {
+      if (Index == 0) Index = Items;
+      Index--;
+    }
+    else if ((Test == KEY_SHORT) || (Test == KEY_RIGHT))
+    #else
+    if (Test == KEY_SHORT)              /* short key press */
+    #endif
+    {
+      Index++;
+      if (Index >= Items) Index = 0;
+    }
+  }
+
+  /* remove marker */
+  LCD_CharPos(1, Line);
+  Display_Space();
+
+  return Value;
+}
+
+
+
+/*
+ *  take a single sample from the selected source
+ *
+ *  requires:
+ *  - Source: source ID
+ *  - Value: pointer to value
+ *  - Scale: pointer to exponent (value * 10^x)
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 if no valid value
+ */
+
+uint8_t Logger_Sample(uint8_t Source, int32_t *Value, int8_t *Scale)
+{
+  uint8_t           Flag = 0;           /* return value */
+  #if defined (SW_ESR) || defined (SW_OLD_ESR)
+  uint16_t          ESR;                /* ESR (in 0.01 Ohms) */
+  #endif
+
+  switch (Source)
+  {
+    case LOG_SRC_C:                     /* capacitance */
+    #if defined (SW_ESR) || defined (SW_OLD_ESR)
+    case LOG_SRC_ESR:                   /* ESR */
+    #endif
+      Check.Found = COMP_NONE;          /* no component */
+      /* keep probe order of normal probing cycle */
+      MeasureCap(PROBE_3, PROBE_1, 0);
+
+      if (Check.Found == COMP_CAPACITOR)     /* found cap */
+      {
+        Flag = 1;
+        *Value = (int32_t)Caps[0].Value;
+        *Scale = Caps[0].Scale;
+
+        #if defined (SW_ESR) || defined (SW_OLD_ESR)
+        if (Source == LOG_SRC_ESR)      /* ESR */
+        {
+          ESR = MeasureESR(&Caps[0]);
+          *Value = ESR;
+          *Scale = -2;                  /* 0.01 Ohms */
+          if (ESR == UINT16_MAX) Flag = 0;   /* no valid ESR */
+        }
+        #endif
+      }
+      break;
+
+    case LOG_SRC_U:                     /* voltage */
+      /* probe #1 as Gnd, probe #3 as input */
+      ADC_PORT = 0;                     /* pull down */
+      ADC_DDR = (1 << TP1);             /* enable pull down */
+      *Value = ReadU(TP3);              /* read voltage (mV) */
+      *Scale = -3;                      /* mV */
+      ADC_DDR = 0;                      /* reset probes */
+      Flag = 1;
+      break;
+
+    #ifdef SW_DS18B20
+    case LOG_SRC_DS18B20:               /* DS18B20 */
+      Flag = DS18B20_ReadTemperature(Value, Scale);
+      break;
+    #endif
+
+    #ifdef HW_MAX31855
+    case LOG_SRC_MAX31855:              /* MAX31855 */
+      Flag = MAX31855_ReadTemperature(Value, Scale);
+      break;
+    #endif
+
+    #ifdef HW_MAX6675
+    case LOG_SRC_MAX6675:               /* MAX6675 */
+      Flag = MAX6675_ReadTemperature(Value, Scale);
+      break;
+    #endif
+
+    default:                            /* R or L */
+      UpdateProbes2(PROBE_1, PROBE_3);  /* set probes */
+      Check.Resistors = 0;              /* reset resistor counter */
+      CheckResistor();                  /* check for resistor */
+
+      if (Check.Resistors == 1)         /* found resistor */
+      {
+        Flag = 1;
+        *Value = (int32_t)Resistors[0].Value;
+        *Scale = Resistors[0].Scale;
 
+        #ifdef SW_INDUCTOR
+        if (Source == LOG_SRC_L)        /* L */
+        {
+          Flag = 0;
+          if (MeasureInductor(&Resistors[0]) == 1)   /* got inductance */
+          {
+            Flag = 1;
+            *Value = (int32_t)Inductor.Value;
+            *Scale = Inductor.Scale;
+          }
+        }
+        #endif
+      }
+      break;
+  }
+
+  #if defined (SW_DS18B20) || defined (HW_MAX31855) || defined (HW_MAX6675)
+  if (Source >= LOG_SRC_DS18B20)        /* temperature */
+  {
+    if (Flag)                           /* valid value */
+    {
+      #ifdef UI_FAHRENHEIT
+      /* convert Celsius into Fahrenheit */
+      *Value = Celsius2Fahrenheit(*Value, *Scale);
+      #endif
+
+      *Scale = -*Scale;                 /* decimal places -> exponent */
+    }
+  }
+  #endif
+
+  return Flag;
+}
+
+
+
+/*
+ *  data logger
+ *  - samples the selected source at a fixed interval and sends each
+ *    sample as CSV line via TTL serial: <time in ms>,<value>
+ *  - value is given as <integer>e<exponent> in base units (Ohms, F,
+ *    H, V or degrees), an empty field indicates a missing value
+ *  - samples are taken at a fixed grid based on the system tick, so
+ *    display and serial output don't stretch the interval (missed slots
+ *    are skipped)
+ *  - display is updated once per second at most
+ *  - any key press ends logging
+ */
+
+void Logger_Tool(void)
+{
+  uint8_t           n = 0;              /* number of sources */
+  uint8_t           Source;             /* selected source */
+  uint8_t           Flag;               /* valid value */
+  uint8_t           Run = 1;            /* loop control */
+  uint8_t           Control;            /* output control */
+  unsigned char     Unit;               /* unit character */
+  int8_t            Scale = 0;          /* exponent of value */
+  uint16_t          Count;              /* number of samples */
+  uint16_t          Samples = 0;        /* samples taken */
+  int32_t           Value = 0;          /* sample value */
+  int32_t           Wait;               /* time left (in ms) */
+  uint32_t          Interval;           /* sampling interval (in ms) */
+  uint32_t          Start;              /* start time */
+  uint32_t          Next;               /* time of next sample */
+  uint32_t          Now;                /* current time */
+  uint32_t          Update;             /* time of last display update */
+  unsigned char     *String;            /* name of source */
+  void              *Item_Str[LOG_SOURCES];  /* menu item strings */
+  uint8_t           Item_ID[LOG_SOURCES];    /* source IDs */
 
   /*
-   *  show info
+   *  select source
    */
 
+  Item_Str[n] = (void *)Log_R_str;
+  Item_ID[n] = LOG_SRC_R;
+  n++;
+  Item_Str[n] = (void *)Log_C_str;
+  Item_ID[n] = LOG_SRC_C;
+  n++;
+  #ifdef SW_INDUCTOR
+  Item_Str[n] = (void *)Log_L_str;
+  Item_ID[n] = LOG_SRC_L;
+  n++;
+  #endif
+  #if defined (SW_ESR) || defined (SW_OLD_ESR)
+  Item_Str[n] = (void *)ESR_str;
+  Item_ID[n] = LOG_SRC_ESR;
+  n++;
+  #endif
+  Item_Str[n] = (void *)Log_U_str;
+  Item_ID[n] = LOG_SRC_U;
+  n++;
+  #ifdef SW_DS18B20
+  Item_Str[n] = (void *)DS18B20_str;
+  Item_ID[n] = LOG_SRC_DS18B20;
+  n++;
+  #endif
+  #ifdef HW_MAX31855
+  Item_Str[n] = (void *)MAX31855_str;
+  Item_ID[n] = LOG_SRC_MAX31855;
+  n++;
+  #endif
+  #ifdef HW_MAX6675
+  Item_Str[n] = (void *)MAX6675_str;
+  Item_ID[n] = LOG_SRC_MAX6675;
+  n++;
+  #endif
+
   LCD_Clear();
   #ifdef UI_COLORED_TITLES
-    /* display: Continuity */
-    Display_ColoredEEString(ContinuityCheck_str, COLOR_TITLE);
+    Display_ColoredEEString(Logger_str, COLOR_TITLE);  /* display: Logger */
   #else
-    Display_EEString(ContinuityCheck_str);   /* display: Continuity */
+    Display_EEString(Logger_str);       /* display: Logger */
   #endif
-  ProbePinout(PROBES_ESR);         /* show probes used */
+  n = MenuTool(n, 1, Item_Str, NULL);   /* menu dialog */
+  Source = Item_ID[n];                  /* get source ID */
+  String = Item_Str[n];                 /* get source name */
 
+  /* set up display and source */
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    Display_ColoredEEString_Space(Logger_str, COLOR_TITLE);
+  #else
+    Display_EEString_Space(Logger_str); /* display: Logger */
+  #endif
+  Display_EEString(String);             /* display source */
 
-  /*
-   *  init
-   */
+  #if defined (SW_DS18B20) && defined (ONEWIRE_PROBES)
+  if (Source == LOG_SRC_DS18B20)        /* DS18B20 */
+  {
+    /* inform user about pinout and check for external pull-up resistor */
+    if (OneWire_Probes(DS18B20_str) == 0)    /* bus error */
+    {
+      return;                           /* exit tool */
+    }
+  }
+  #endif
 
-  UpdateProbes(PROBE_1, PROBE_2, PROBE_3);        /* update probes */
+  /* unit for display */
+  switch (Source)
+  {
+    case LOG_SRC_C:
+      Unit = 'F';
+      break;
 
-  /* set probes: Vcc -- Rl -- probe #1 / probe #3 -- Gnd */
-  R_PORT = Probes.Rl_1;                 /* pull up probe #1 via Rl */
-  R_DDR = Probes.Rl_1;                  /* enable pull-up resistor */
-  ADC_PORT = 0;                         /* pull down directly */
-  ADC_DDR = Probes.Pin_3;               /* enable Gnd for probe #3 */
+    case LOG_SRC_L:
+      Unit = 'H';
+      break;
 
-  Cfg.Samples = 5;                      /* do just 5 samples to be fast */
-  Flag = RUN_FLAG;                      /* enter processing loop */
+    case LOG_SRC_U:
+      Unit = 'V';
+      break;
+
+    case LOG_SRC_R:
+    case LOG_SRC_ESR:
+      Unit = LCD_CHAR_OMEGA;
+      break;
+
+    default:                            /* temperature */
+      #ifdef UI_FAHRENHEIT
+        Unit = 'F';                     /* Fahrenheit */
+      #else
+        Unit = 'C';                     /* Celsius */
+      #endif
+      break;
+  }
+
+  /* select interval (0.1s) and number of samples */
+  Interval = Logger_Select(2, NUM_LOG_INTERVALS, Log_Interval_table, 3, 1, 's');
+  Interval *= 100;                      /* 0.1s -> ms */
+  n = 3;                                /* line #3 */
+  if (UI.CharMax_Y < 3) n = 2;          /* only 2 lines: line #2 */
+  Count = Logger_Select(n, NUM_LOG_COUNTS, Log_Count_table, 3, 0, 0);
+
+  /* init */
+  Check.Diodes = 0;                     /* reset diode counter */
+  Check.CapRange = CAP_RANGE_MEMORY;    /* enable range memory */
+  Control = Cfg.OP_Control;             /* save output control */
+
+  /* send CSV header */
+  Cfg.OP_Control &= ~OP_OUT_LCD;        /* disable display output */
+  Cfg.OP_Control |= OP_OUT_SER;         /* enable serial output */
+  Serial_NewLine();
+  Display_EEString(Log_Header_str);     /* send: ms, */
+  Display_EEString(String);             /* send: source */
+  Cfg.OP_Control = Control;             /* restore output control */
+
+  Start = SysTick_Get();                /* start time */
+  Next = Start;                         /* first sample right away */
+  Update = Start - LOG_LCD_UPDATE;      /* update display right away */
 
 
   /*
    *  processing loop
    */
 
-  while (Flag > 0)
+  while (Run)
   {
+    wdt_reset();                        /* reset watchdog */
+
     /*
-     *  check voltage across probes
-     *  and output result
+     *  wait for next sampling slot
      */
 
-    U1 = ReadU(Probes.Ch_1);            /* read voltage at probe #1 */
-    U2 = ReadU(Probes.Ch_3);            /* read voltage at probe #3 */
-
-    /* consider voltage drop by RiL */
-    if (U1 > U2)                        /* sanity check */
-    {
-      U1 -= U2;                         /* subtract voltage of RiL */
-    }
+    Now = SysTick_Get();
+    Wait = (int32_t)(Next - Now);       /* time left */
 
-    /* compare voltage with thresholds */
-    if (U1 < 100)                       /* < 100mV */
+    if (Wait > 0)                       /* slot not reached yet */
     {
-      /* short: continuous beep */
-
-      #ifdef BUZZER_ACTIVE
-      /* enable buzzer */
-      BUZZER_PORT |= (1 << BUZZER_CTRL);     /* set pin high */
-      #endif
+      /* wait and check for key press at the same time */
+      if (TestKey((uint16_t)Wait, 0) != KEY_TIMEOUT)
+      {
+        Run = 0;                        /* end logging */
+      }
 
-      #ifdef BUZZER_PASSIVE
-      PassiveBuzzer(BUZZER_FREQ_HIGH);       /* high frequency beep */
-      #endif
+      continue;                         /* check again */
     }
-    else if (U1 <= 700)                 /* 100-700mV */
-    {
-      /* pn junction: short beep */
 
-      #ifdef BUZZER_ACTIVE
-      /* enable buzzer */
-      BUZZER_PORT |= (1 << BUZZER_CTRL);     /* set pin high */
-      Flag |= BEEP_SHORT;                    /* set flag */
-      #endif
 
-      #ifdef BUZZER_PASSIVE
-      PassiveBuzzer(BUZZER_FREQ_LOW);        /* low frequency beep */
-      #endif
-    }
-    else                                /* > 700mV */
+    /*
+     *  take sample
+     */
+
+    Flag = Logger_Sample(Source, &Value, &Scale);
+    Samples++;                          /* one more */
+
+    /* next slot (skip missed ones) */
+    do
     {
-      /* something else or open circuit: no beep */
+      Next += Interval;
+    } while ((int32_t)(SysTick_Get() - Next) >= 0);
 
-      #ifdef BUZZER_ACTIVE
-      /* disable buzzer */
-      BUZZER_PORT &= ~(1 << BUZZER_CTRL);    /* set pin low */
-      #endif
+    if (Samples >= Count)               /* all samples taken */
+    {
+      Run = 0;                          /* end logging */
     }
 
-    /* display voltage */
-    LCD_ClearLine2();                   /* line #2 */
-    Display_Value(U1, -3, 'V');         /* display voltage */
-    /* this is also used as delay for the short beep */
-    /* todo: do we need an additional delay for fast displays? */
 
-    #ifdef BUZZER_ACTIVE
-    if (Flag & BEEP_SHORT)              /* short beep */
+    /*
+     *  send sample via TTL serial: time stamp in ms,value
+     */
+
+    Cfg.OP_Control &= ~OP_OUT_LCD;      /* disable display output */
+    Cfg.OP_Control |= OP_OUT_SER;       /* enable serial output */
+    Serial_NewLine();
+    Display_FullValue(Now - Start, 0, 0);
+    Display_Char(',');
+    if (Flag)                           /* valid value */
     {
-      /* disable buzzer */
-      BUZZER_PORT &= ~(1 << BUZZER_CTRL);    /* set pin low */
-      Flag &= ~BEEP_SHORT;                   /* clear flag */
+      Display_SignedFullValue(Value, 0, 0);
+      if (Scale)                        /* not base unit */
+      {
+        Display_Char('e');
+        Display_SignedFullValue(Scale, 0, 0);
+      }
     }
-    #endif
+    Cfg.OP_Control = Control;           /* restore output control */
 
 
     /*
-     *  user feedback
+     *  display sample number and value
      */
 
-    /* check for user feedback and slow down update rate */
-    Test = TestKey(50, CHECK_KEY_TWICE | CHECK_BAT);
-
-    if (Test == KEY_TWICE)         /* two short key presses */
+    if (((Now - Update) >= LOG_LCD_UPDATE) || (Run == 0))
     {
-      Flag = 0;                    /* end loop */
+      Update = Now;                     /* save time of update */
+      LCD_ClearLine2();                 /* clear line #2 */
+      Display_FullValue(Samples, 0, 0); /* display: sample number */
+      Display_Space();
+
+      if (Flag)                         /* valid value */
+      {
+        if (Source >= LOG_SRC_DS18B20)  /* temperature */
+        {
+          /* don't scale temperature */
+          Display_SignedFullValue(Value, -Scale, '\xb0');
+          Display_Char(Unit);           /* display: C or F */
+        }
+        else                            /* other value */
+        {
+          Display_SignedValue(Value, Scale, Unit);
+        }
+      }
+      else                              /* no valid value */
+      {
+        Display_Minus();                /* display: - */
+      }
     }
   }
 
+  /* clean up */
+  Check.CapRange = CAP_RANGE_NONE;      /* disable range memory */
 
-  /*
-   *  clean up
-   */
-
-  /* global settings */
-  Cfg.Samples = ADC_SAMPLES;            /* set ADC samples back to default */
-
-  /* local constants for Flag */
-  #undef RUN_FLAG
-  #undef BEEP_SHORT
+  if (Samples >= Count)                 /* logging completed */
+  {
+    /* wait for user before leaving */
+    TestKey(0, CURSOR_BLINK | CHECK_BAT);
+  }
 }
 
+/* clean-up of local constants */
+#undef LOG_SRC_R
+#undef LOG_SRC_C
+#undef LOG_SRC_L
+#undef LOG_SRC_ESR
+#undef LOG_SRC_U
+#undef LOG_SRC_DS18B20
+#undef LOG_SRC_MAX31855
+#undef LOG_SRC_MAX6675
+#undef LOG_SOURCES
+#undef LOG_LCD_UPDATE
+
 #endif
 
 
 
 /* ************************************************************************
- *   flashlight / general purpose switched output
+ *   stack high-water mark
  * ************************************************************************ */
 
 
-#ifdef HW_FLASHLIGHT
+#ifdef SW_STACK_CHECK
+
+/* end of static data (.data, .bss and .noinit), set by linker */
+extern uint8_t __heap_start;
+
 
 /*
- *  flashlight / general purpose switched output
- *  - toggles output pin between high and low
+ *  paint free SRAM with canary pattern
+ *  - runs before main() as part of the C runtime init (section .init3),
+ *    when the stack pointer is set up but the stack isn't used yet
+ *  - no stack frame, so just register variables
  */
 
-void Flashlight(void)
+void Stack_Paint(void) __attribute__ ((naked, used, section (".init3")));
+
+void Stack_Paint(void)
 {
-  uint8_t           Flag;          /* status flag */
+  uint8_t           *Pointer;           /* pointer to SRAM */
 
+  Pointer = &__heap_start;              /* start with free SRAM */
+  while (Pointer <= (uint8_t *)SP)      /* up to stack pointer */
+  {
+    *Pointer = STACK_CANARY;            /* paint */
+    Pointer++;                          /* next byte */
+  }
+}
 
-  /*
-   *  toggle output
-   */
 
-  /* get current state */
-  Flag = FLASHLIGHT_PORT;          /* read port register */
-  Flag &= (1 << FLASHLIGHT_CTRL);  /* filter pin */
 
-  /* set output based on current state */
-  if (Flag)                   /* pin high */
-  {
-    /* toggle off */
-    FLASHLIGHT_PORT &= ~(1 << FLASHLIGHT_CTRL);   /* set pin low */
-  }
-  else                        /* pin low */
+/*
+ *  display SRAM usage
+ *  - static data, max. stack usage (high-water mark) and min. free SRAM
+ *    (never touched by the stack) in bytes
+ *  - format: DATA:<n> STACK:<n> FREE:<n>
+ *  - also used by remote command MEM
+ *
+ *  requires:
+ *  - Mode: 0 for single line, 1 for one value per line
+ */
+
+void Memory_Show(uint8_t Mode)
+{
+  uint8_t           *Pointer;           /* pointer to SRAM */
+  uint16_t          Free = 0;           /* untouched bytes */
+  uint16_t          Size;               /* size of stack area */
+
+  /* count canary bytes from the end of static data upward */
+  Pointer = &__heap_start;
+  while ((Pointer <= (uint8_t *)RAMEND) && (*Pointer == STACK_CANARY))
   {
-    /* toggle on */
-    FLASHLIGHT_PORT |= (1 << FLASHLIGHT_CTRL);    /* set pin high */
+    Free++;
+    Pointer++;
   }
-}
 
-#endif
+  /* area between static data and end of SRAM */
+  Size = (uint16_t)((uint8_t *)RAMEND - &__heap_start) + 1;
 
+  Display_EEString(Mem_DATA_str);       /* display: DATA */
+  Display_Colon();
+  Display_FullValue((uint16_t)(&__heap_start - (uint8_t *)RAMSTART), 0, 0);
 
+  if (Mode) Display_NextLine();
+  else Display_Space();
+  Display_EEString(Mem_STACK_str);      /* display: STACK */
+  Display_Colon();
+  Display_FullValue(Size - Free, 0, 0);
 
-/* ************************************************************************
- *   photodiode check
- * ************************************************************************ */
+  if (Mode) Display_NextLine();
+  else Display_Space();
+  Display_EEString(Mem_FREE_str);       /* display: FREE */
+  Display_Colon();
+  Display_FullValue(Free, 0, 0);
+}
 
 
-#ifdef SW_PHOTODIODE
 
 /*
- *  check photodiode
- *  - supports reverse-bias and no-bias mode
- *  - uses probe #1 (anode) and probe #3 (cathode)
+ *  tool for SRAM usage
  */
 
-void PhotodiodeCheck(void)
+void Memory_Tool(void)
 {
-  uint8_t           Flag;               /* loop control */
-  uint8_t           Test;               /* user feedback */
-  uint16_t          U;                  /* measured voltage */
-  uint16_t          R = 0;              /* resistance (current shunt) */
-  uint32_t          I;                  /* current I_P */
-
-  /* local constants for Flag (bitfield) */
-  #define RUN_FLAG            0b00000001     /* run / otherwise end */
-  #define NO_BIAS             0b00000010     /* no-bias mode */
-  #define REVERSE_BIAS        0b00000100     /* reverse-bias mode */
-  #define UPDATE_BIAS         0b00001000     /* update bias mode */
-
-
-  /*
-   *  show info
-   */
-
+  /* display info */
   LCD_Clear();
   #ifdef UI_COLORED_TITLES
-    /* display: Photodiode */
-    Display_ColoredEEString(Photodiode_str, COLOR_TITLE);
+    /* display: Memory */
+    Display_ColoredEEString(Memory_str, COLOR_TITLE);
   #else
-    Display_EEString(Photodiode_str);        /* display: Photodiode */
+    Display_EEString(Memory_str);       /* display: Memory */
   #endif
-  ProbePinout(PROBES_DIODE);                 /* show probes used */
-
-
-  /*
-   *  init
-   */
-
-  UpdateProbes(PROBE_1, PROBE_2, PROBE_3);   /* update probes */
-
-  /* enter processing loop and set reverse-bias mode */
-  Flag = RUN_FLAG | REVERSE_BIAS | UPDATE_BIAS;
-
+  UI.LineMode = LINE_KEY | LINE_KEEP;   /* next-line mode: wait, keep first line */
 
-  /*
-   *  processing loop
-   */
+  Display_NextLine();
+  Memory_Show(1);                       /* display values */
 
-  while (Flag > 0)
-  {
-    /*
-     *  set up bias mode
-     */
+  WaitKey();                            /* wait for user feedback */
+}
 
-    if (Flag & UPDATE_BIAS)        /* update requested */
-    {
-      /* probe #1: anode, probe #3: cathode */
+#endif
 
-      if (Flag & REVERSE_BIAS)     /* reverse-bias mode */
-      {
-        /* safeguard when switching from no-bias mode */
-        ADC_DDR = 0;                    /* remove direct pull down */
 
-        /* set probes: Vcc -- Rl -- probe #3 / probe #1 -- Gnd */
-        R_PORT = Probes.Rl_3;           /* pull up probe #3 via Rl */
-        R_DDR = Probes.Rl_3;            /* enable pull-up resistor */
-        ADC_PORT = 0;                   /* pull down directly */
-        ADC_DDR = Probes.Pin_1;         /* enable Gnd for probe #1 */
 
-        /* current shunt: Rl + RiH */
-        R = (R_LOW * 10) + NV.RiH;      /* in 0.1 Ohms */
-      }
-      else                         /* no-bias mode */
-      {
-        /* set probes: probe #1 -- Rl -- Gnd / probe #3 -- Gnd */
-        R_PORT = 0;                     /* pull down ... */
-        R_DDR = Probes.Rl_1;            /* ... probe #1 via Rl */
-        ADC_PORT = 0;                   /* pull down directly */
-        ADC_DDR = Probes.Pin_3;         /* enable Gnd for probe #3 */
+/* ************************************************************************
+ *   performance counters
+ * ************************************************************************ */
 
-        /* current shunt: Rl + RiL */
-        R = (R_LOW * 10) + NV.RiL;      /* in 0.1 Ohms */
-      }
 
-      Flag &= ~UPDATE_BIAS;                  /* clear flag */
-    }
+#ifdef SW_PERF_COUNTERS
 
+/*
+ *  display performance counters and reset them
+ *  - counts since last reset (or power-on)
+ *  - format: <counter>:<n> (see Perf_Table)
+ *  - also used by remote command PERF
+ *
+ *  requires:
+ *  - Mode: 0 for single line, 1 for one value per line
+ */
 
-    /*
-     *  monitor current I_P
-     *  - measure voltage across current shunt Rl
-     *  - calculate current
-     *  - display current
-     */
+void Perf_Show(uint8_t Mode)
+{
+  uint8_t           n = 0;              /* counter */
+  uint8_t           Old_SREG;           /* status register */
+  uint8_t           *Addr;              /* address of table entry */
+  unsigned char     *String;            /* address of counter name */
+  uint32_t          Count[NUM_PERF_COUNTERS];     /* copy of counters */
+
+  /* copy and reset counters (shared with ISRs) */
+  Old_SREG = SREG;                 /* save status register */
+  cli();                           /* disable interrupts */
+  while (n < NUM_PERF_COUNTERS)
+  {
+    Count[n] = PerfCount[n];
+    PerfCount[n] = 0;
+    n++;
+  }
+  SREG = Old_SREG;                 /* restore status register */
 
-    /* measure voltage */
-    if (Flag & REVERSE_BIAS)       /* reverse-bias mode */
-    {
-      U = Cfg.Vcc - ReadU(Probes.Ch_3); /* voltage at probe #3 (cathode), in mV */
-    }
-    else                           /* no-bias mode */
+  n = 0;
+  while (n < NUM_PERF_COUNTERS)    /* loop through counters */
+  {
+    if (n > 0)                     /* not the first one */
     {
-      U = ReadU(Probes.Ch_1);      /* voltage at probe #1 (anode), in mV */
+      if (Mode) Display_NextLine();
+      else Display_Space();
     }
 
-    /* calculate I_P (= U / R) */
-    I = U * 100000;                /* scale voltage to 0.01 V */
-    I /= R;                        /* / R (in 0.1 Ohms) -> I in 0.1 A */ 
+    /* read address of counter name from reference table */
+    Addr = (uint8_t *)&Perf_Table[n];
+    Addr++;                        /* skip ID */
+    String = (unsigned char *)DATA_read_word((uint16_t *)Addr);
 
-    /* display I_P */
-    LCD_ClearLine2();              /* line #2 */
-    if (Flag & REVERSE_BIAS)       /* reverse-bias mode */
-    {
-      Display_EEString_Space(ReverseBias_str);    /* display: rev */
-    }
-    else                           /* no-bias mode */
-    {
-      Display_EEString_Space(NoBias_str);         /* display: no */
-    }
-    Display_Value(I, -7, 'A');     /* display current */
+    Display_EEString(String);      /* display: counter name */
+    Display_Colon();
+    Display_FullValue(Count[n], 0, 0);
 
+    n++;                           /* next counter */
+  }
+}
 
-    /*
-     *  user feedback
-     */
 
-    /* check for user feedback and slow down update rate */
-    Test = TestKey(200, CHECK_KEY_TWICE | CHECK_BAT);
 
-    if (Test == KEY_SHORT)         /* short key press */
-    {
-      /* toggle bias mode */
-      if (Flag & REVERSE_BIAS)     /* in reverse-bias mode */
-      {
-        /* switch to no-bias mode */
-        Flag &= ~REVERSE_BIAS;               /* clear flag */
-        Flag |= NO_BIAS | UPDATE_BIAS;       /* set flag for new mode */
-      }
-      else                         /* in no-bias mode */
-      {
-        /* switch to reverse-bias mode */
-        Flag &= ~NO_BIAS;                    /* clear flag */
-        Flag |= REVERSE_BIAS | UPDATE_BIAS;  /* set flag for new mode */
-      }
-    }
-    else if (Test == KEY_TWICE)    /* two short key presses */
-    {
-      Flag = 0;                    /* end loop */
-    }
-  }
+/*
+ *  tool for performance counters
+ */
 
+void Perf_Tool(void)
+{
+  /* display info */
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    /* display: Counters */
+    Display_ColoredEEString(Perf_str, COLOR_TITLE);
+  #else
+    Display_EEString(Perf_str);         /* display: Counters */
+  #endif
+  UI.LineMode = LINE_KEY | LINE_KEEP;   /* next-line mode: wait, keep first line */
 
-  /*
-   *  clean up
-   */
+  Display_NextLine();
+  Perf_Show(1);                         /* display and reset values */
 
-  /* local constants for Flag */
-  #undef RUN_FLAG
-  #undef NO_BIAS
-  #undef REVERSE_BIAS
-  #undef UPDATE_BIAS
+  WaitKey();                            /* wait for user feedback */
 }
 
 #endif
 
 
 
+
 /* ************************************************************************
  *   clean-up of local constants
  * ************************************************************************ */
@@ -38,6 +38,25 @@ uint8_t                  SweepStep;     /* sweep step */
 volatile uint8_t         SweepDir;      /* sweep direction */
 #endif
 
+/* DDS signal generator */
+#ifdef SW_DDS
+volatile uint8_t         DDS_Mode;      /* 1 = Timer0 is DDS sample clock */
+volatile uint8_t         DDS_Wave;      /* waveform */
+volatile uint16_t        DDS_Phase;     /* phase accumulator */
+volatile uint16_t        DDS_Step;      /* phase increment */
+/* quarter sine wave (RAM copy), kept in scratch arena */
+#define DDS_Table                Scratch
+#endif
+
+/* squarewave signal generator with fractional period */
+#ifdef SQUAREWAVE_FRACTIONAL
+volatile uint16_t        SquareTop;     /* integer part of top value */
+volatile uint8_t         SquareFrac;    /* fractional part (1/256) */
+volatile uint8_t         SquareAccu;    /* fraction accumulator */
+/* minimum top value for dithering (limits ISR load) */
+#define SQUARE_FRAC_MIN          255
+#endif
+
 
 
 /* ************************************************************************
@@ -282,6 +301,147 @@ void PWM_Tool(uint16_t Frequency)
 
 #ifdef SW_PWM_PLUS
 
+#ifdef PWM_SWEEP
+
+/*
+ *  PWM generator: frequency sweep
+ *  - linear sweep in PWM_SWEEP_STEPS steps
+ *  - timer settings for all steps are precomputed to keep the
+ *    transition between steps short and constant
+ *  - sends step and frequency via TTL serial (CSV)
+ *  - any key press aborts the sweep
+ *  - Timer1 has to run already in phase & frequency correct PWM mode
+ *
+ *  requires:
+ *  - Start: start frequency (in 0.01Hz)
+ *  - Stop: stop frequency (in 0.01Hz)
+ *  - Ratio: PWM ratio (in %)
+ */
+
+void PWM_Sweep(uint32_t Start, uint32_t Stop, uint8_t Ratio)
+{
+  uint8_t           n;                  /* step counter */
+  uint8_t           Index;              /* prescaler table index */
+  uint8_t           Test;               /* loop control and user feedback */
+  uint16_t          Prescaler;          /* timer prescaler */
+  int32_t           Diff;               /* frequency span */
+  uint32_t          Freq;               /* frequency of step */
+  uint32_t          Value;              /* temporary value */
+  uint16_t          SweepTop[PWM_SWEEP_STEPS];      /* top values */
+  uint16_t          SweepToggle[PWM_SWEEP_STEPS];   /* toggle values */
+  uint8_t           SweepBits[PWM_SWEEP_STEPS];     /* prescaler register bits */
+  #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+  uint8_t           Control;            /* output control */
+  #endif
+
+  Diff = (int32_t)Stop - (int32_t)Start;     /* frequency span */
+
+
+  /*
+   *  precompute timer settings
+   *  - top = f_MCU / (2 * prescaler * f_PWM)
+   *  - choose the smallest prescaler giving a 16 bit top value
+   *    for best resolution
+   */
+
+  n = 0;
+  while (n < PWM_SWEEP_STEPS)
+  {
+    /* frequency of step (in 0.01Hz) */
+    Freq = (int32_t)Start + (Diff * n) / (PWM_SWEEP_STEPS - 1);
+
+    Index = 0;
+    Test = 1;
+    while (Test)
+    {
+      Prescaler = DATA_read_word(&T1_Prescaler_table[Index]);
+
+      /* top = f_MCU * 50 / (prescaler * f_PWM in 0.01Hz) */
+      Value = CPU_FREQ * 50;       /* scale to 0.01Hz and /2 */
+      Value /= Prescaler;          /* /prescaler */
+      Value /= Freq;               /* /frequency */
+
+      if ((Value > UINT16_MAX) && (Index < (NUM_TIMER1 - 1)))
+      {
+        Index++;                   /* try next prescaler */
+      }
+      else                         /* got it */
+      {
+        Test = 0;                  /* end loop */
+      }
+    }
+
+    /* limit top value */
+    if (Value > UINT16_MAX)        /* too large */
+    {
+      Value = UINT16_MAX;          /* upper limit */
+    }
+    else if (Value < 0x0064)       /* too small for 1% ratio steps */
+    {
+      Value = 0x0064;              /* lower limit */
+    }
+
+    SweepTop[n] = (uint16_t)Value;
+    SweepBits[n] = DATA_read_byte(&T1_RegBits_table[Index]);
+
+    /* toggle = top * (ratio / 100) */
+    Value *= Ratio;
+    Value /= 100;
+    SweepToggle[n] = (uint16_t)Value;
+
+    n++;                           /* next step */
+  }
+
+
+  /*
+   *  sweep
+   */
+
+  n = 0;
+  Test = KEY_TIMEOUT;
+  while ((n < PWM_SWEEP_STEPS) && (Test == KEY_TIMEOUT))
+  {
+    /* set timer (top and toggle value are updated at BOTTOM) */
+    OCR1A = SweepTop[n];                     /* set top value */
+    OCR1B = SweepToggle[n];                  /* set toggle value */
+    TCCR1B = (1 << WGM13) | SweepBits[n];    /* set prescaler */
+
+    /* frequency of step (in 0.01Hz) */
+    Freq = (int32_t)Start + (Diff * n) / (PWM_SWEEP_STEPS - 1);
+
+    n++;                           /* next step */
+
+    /* display progress in line #4 */
+    LCD_ClearLine(4);
+    MarkItem(1, 1);                /* mark sweep mode */
+    Display_EEString_Space(Sweep_str);       /* display: <-> */
+    Display_FullValue(n, 0, 0);              /* display step */
+    Display_Char('/');
+    Display_FullValue(PWM_SWEEP_STEPS, 0, 0);  /* display number of steps */
+
+    #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
+    /* send step and frequency via TTL serial (CSV) */
+    Control = Cfg.OP_Control;           /* save output control */
+    Cfg.OP_Control &= ~OP_OUT_LCD;      /* disable display output */
+    Cfg.OP_Control |= OP_OUT_SER;       /* enable serial output */
+
+    Display_FullValue(n, 0, 0);         /* step */
+    Display_Char(',');
+    Display_FullValue(Freq, 2, 0);      /* frequency in Hz */
+    Serial_NewLine();
+
+    Cfg.OP_Control = Control;           /* restore output control */
+    #endif
+
+    /* dwell time, abort on any key press */
+    Test = TestKey(PWM_SWEEP_DWELL, 0);
+  }
+}
+
+#endif
+
+
+
 /*
  *  PWM generator with improved UI
  *  - uses probe #2 (OC1B) as PWM output
@@ -311,6 +471,9 @@ void PWM_Tool(void)
   uint16_t          TimeValue = 0;      /* duration/resolution of timer step */
   int8_t            TimeScale = 0;      /* scale of duration */
   #endif
+  #ifdef PWM_SWEEP
+  uint32_t          SweepStart = 0;     /* start frequency of sweep (in 0.01Hz) */
+  #endif
 
   /* local constants for Flag (bitfield) */
   #define RUN_FLAG       0b00000001     /* run / otherwise end */
@@ -318,10 +481,12 @@ void PWM_Tool(void)
   #define CHANGE_RATIO   0b00000100     /* change ratio */
   #define DISPLAY_FREQ   0b00001000     /* display frequency */
   #define DISPLAY_RATIO  0b00010000     /* display ratio */
+  #define DISPLAY_SWEEP  0b00100000     /* display sweep */
 
   /* local constants for Mode */
   #define MODE_FREQ               1     /* frequency mode */
   #define MODE_RATIO              2     /* ratio mode */
+  #define MODE_SWEEP              3     /* sweep mode */
 
 
   /*
@@ -543,6 +708,25 @@ void PWM_Tool(void)
       Flag &= ~DISPLAY_RATIO;           /* clear flag */
     }
 
+    #ifdef PWM_SWEEP
+    if (Flag & DISPLAY_SWEEP)      /* display sweep in line #4 */
+    {
+      LCD_ClearLine(4);                 /* clear line #4 */
+
+      if (Mode == MODE_SWEEP)           /* sweep mode */
+      {
+        MarkItem(MODE_SWEEP, Mode);     /* mark mode */
+
+        /* start frequency, stop frequency is shown in line #2 */
+        Display_EEString_Space(Sweep_str);     /* display: <-> */
+        Display_FullValue(SweepStart, 2, 0);   /* display start frequency */
+        Display_EEString(Hertz_str);           /* display: Hz */
+      }
+
+      Flag &= ~DISPLAY_SWEEP;           /* clear flag */
+    }
+    #endif
+
     /* smooth UI after long key press */
     if (Test == KEY_LONG)          /* long key press */
     {
@@ -563,7 +747,7 @@ void PWM_Tool(void)
     if (Step > 1)                  /* larger step */
     {
       /* increase step size based on turning velocity */
-      if (Mode == MODE_FREQ)       /* frequency mode */
+      if (Mode != MODE_RATIO)      /* frequency or sweep mode */
       {
         /*
          *  value ranges for each prescaler:
@@ -593,12 +777,27 @@ void PWM_Tool(void)
       {
         Mode = MODE_RATIO;         /* change to ratio mode */
       }
-      else                         /* ratio mode */
+      #ifdef PWM_SWEEP
+      else if (Mode == MODE_RATIO) /* ratio mode */
+      {
+        Mode = MODE_SWEEP;         /* change to sweep mode */
+
+        /* current frequency becomes start frequency (in 0.01Hz) */
+        Value = CPU_FREQ * 50;     /* scale to 0.01Hz and /2 */
+        Value /= Prescaler;        /* /prescaler */
+        Value /= Top;              /* /top */
+        SweepStart = Value;
+      }
+      #endif
+      else                         /* ratio or sweep mode */
       {
         Mode = MODE_FREQ;          /* change to frequency mode */
       }
 
       Flag |= DISPLAY_FREQ | DISPLAY_RATIO;  /* update display */
+      #ifdef PWM_SWEEP
+      Flag |= DISPLAY_SWEEP;
+      #endif
     }
     else if (Test == KEY_TWICE)         /* two short key presses */
     {
@@ -615,6 +814,19 @@ void PWM_Tool(void)
         Top = (CPU_FREQ / 2000);   /* 1kHz */
         Flag |= CHANGE_FREQ | DISPLAY_FREQ | CHANGE_RATIO;   /* set flags */
       }
+      #ifdef PWM_SWEEP
+      else if (Mode == MODE_SWEEP) /* sweep mode */
+      {
+        /* sweep from start frequency to current frequency */
+        Value = CPU_FREQ * 50;     /* scale to 0.01Hz and /2 */
+        Value /= Prescaler;        /* /prescaler */
+        Value /= Top;              /* /top */
+        PWM_Sweep(SweepStart, Value, Ratio);
+
+        /* restore timer settings and display */
+        Flag |= CHANGE_FREQ | CHANGE_RATIO | DISPLAY_SWEEP;
+      }
+      #endif
       else                         /* ratio mode */
       {
         /* set 50% */
@@ -624,7 +836,7 @@ void PWM_Tool(void)
     }
     else if (Test == KEY_RIGHT)    /* right key */
     {
-      if (Mode == MODE_FREQ)       /* frequency mode */
+      if (Mode != MODE_RATIO)      /* frequency or sweep mode */
       {
         /* increase frequency -> decrease top */
         Temp = Top - Step2;        /* take advantage of underflow */
@@ -650,7 +862,7 @@ void PWM_Tool(void)
     }
     else if (Test == KEY_LEFT)     /* left key */
     {
-      if (Mode == MODE_FREQ)       /* frequency mode */
+      if (Mode != MODE_RATIO)      /* frequency or sweep mode */
       {
         /* decrease frequency -> increase top */
         Temp = Top + Step2;        /* take advantage of overflow */
@@ -696,10 +908,12 @@ void PWM_Tool(void)
   #endif
 
   /* local constants for Mode */
+  #undef MODE_SWEEP
   #undef MODE_RATIO
   #undef MODE_FREQ
 
   /* local constants for Flag */
+  #undef DISPLAY_SWEEP
   #undef DISPLAY_RATIO
   #undef DISPLAY_FREQ
   #undef CHANGE_RATIO
@@ -739,6 +953,13 @@ void Servo_Check(void)
   uint16_t          Step;               /* step size */
   uint16_t          Temp;               /* temporary value */
   uint32_t          Value;              /* temporary value */
+  #ifdef SERVO_AUTO_TEST
+  uint8_t           Pos;                /* test position */
+  uint8_t           n;                  /* counter */
+  uint8_t           Frames;             /* PWM periods per test position */
+  uint16_t          U_Peak;             /* peak voltage across shunt */
+  uint16_t          Peak[3];            /* peak currents (left, mid, right) */
+  #endif
 
   /* local constants for Flag (bitfield) */
   #define RUN_FLAG       0b00000001     /* run / otherwise end */
@@ -748,10 +969,17 @@ void Servo_Check(void)
   #define DISPLAY_PULSE  0b00010000     /* display pulse width */
   #define DISPLAY_FREQ   0b00100000     /* display frequency */
   #define TOGGLE_SWEEP   0b01000000     /* enter/leave sweep operation */
+  #define RUN_AUTO_TEST  0b10000000     /* run auto test */
 
   /* local constants for Mode */
   #define MODE_PULSE              1     /* pulse width mode */
   #define MODE_FREQ               2     /* frequency mode */
+  #define MODE_AUTO               3     /* auto test mode */
+
+  #ifdef SERVO_AUTO_TEST
+  /* dwell time per test position (in 0.1ms) */
+  #define SERVO_TEST_TIME      6000     /* 600ms */
+  #endif
 
 
   /*
@@ -977,6 +1205,13 @@ void Servo_Check(void)
         Display_EEString(Sweep_str);    /* display: sweep */
       }
 
+      #ifdef SERVO_AUTO_TEST
+      LCD_ClearLine(4);                 /* clear line #4 */
+      LCD_CharPos(1, 4);                /* go to start of line #4 */
+      MarkItem(MODE_AUTO, Mode);        /* mark mode if selected */
+      Display_EEString(ServoAuto_str);  /* display: auto test */
+      #endif
+
       Flag &= ~DISPLAY_FREQ;            /* clear flag */
     }
 
@@ -1042,7 +1277,13 @@ void Servo_Check(void)
       {
         Mode = MODE_FREQ;               /* change to frequency mode */
       }
-      else                              /* frequency mode */
+      #ifdef SERVO_AUTO_TEST
+      else if (Mode == MODE_FREQ)       /* frequency mode */
+      {
+        Mode = MODE_AUTO;               /* change to auto test mode */
+      }
+      #endif
+      else                              /* frequency or auto test mode */
       {
         Mode = MODE_PULSE;              /* change to pulse width mode */
       }
@@ -1070,6 +1311,19 @@ void Servo_Check(void)
           Flag |= CHANGE_PULSE | DISPLAY_PULSE;   /* set flags */
         }
       }
+      #ifdef SERVO_AUTO_TEST
+      else if (Mode == MODE_AUTO)       /* auto test mode */
+      {
+        if (Flag & SWEEP_MODE)          /* in sweep mode */
+        {
+          /* leave sweep mode */
+          Flag &= ~SWEEP_MODE;          /* clear flag */
+          Flag |= TOGGLE_SWEEP;         /* stop sweep timer */
+        }
+
+        Flag |= RUN_AUTO_TEST;          /* run auto test */
+      }
+      #endif
       else                              /* frequency mode */
       {
         if (Flag & SWEEP_MODE)          /* in sweep mode */
@@ -1110,7 +1364,7 @@ void Servo_Check(void)
           Flag |= CHANGE_PULSE | DISPLAY_PULSE;   /* set flags */
         }
       }
-      else                              /* frequency mode */
+      else if (Mode == MODE_FREQ)       /* frequency mode */
       {
         /* next PWN frequency -> increase index */
         if (Index < 3)                  /* upper limit is 3 */
@@ -1144,7 +1398,7 @@ void Servo_Check(void)
           Flag |= CHANGE_PULSE | DISPLAY_PULSE;   /* set flags */
         }
       }
-      else                              /* frequency mode */
+      else if (Mode == MODE_FREQ)       /* frequency mode */
       {
         /* previous PWM frequency -> decrease index */
         if (Index > 0)                  /* lower limit is 0 */
@@ -1181,6 +1435,110 @@ void Servo_Check(void)
 
       Flag &= ~TOGGLE_SWEEP;            /* clear flag */
     }
+
+
+    #ifdef SERVO_AUTO_TEST
+    /*
+     *  auto test: move to endpoints and center, measure current draw
+     *  - positions: left (1.0ms), mid (1.5ms), right (2.0ms), mid
+     *  - current via external shunt between probe #1 (servo's Gnd)
+     *    and probe #3 (Gnd)
+     *  - samples are synchronized to the PWM: at Timer1's top, i.e.
+     *    between two pulses, to keep pulse edges out of the reading
+     *  - for each position: peak current while moving and
+     *    idle current at the end of the dwell time (last quarter)
+     */
+
+    if (Flag & RUN_AUTO_TEST)
+    {
+      /* set up shunt input: probe #1 HiZ, probe #3 Gnd */
+      ADC_PORT = 0;                     /* pull down directly */
+      ADC_DDR = (1 << TP3);             /* probe #3 only */
+
+      /* PWM periods per position */
+      Frames = SERVO_TEST_TIME / Period[Index];
+
+      Peak[0] = 0;                      /* reset peak values */
+      Peak[1] = 0;
+      Peak[2] = 0;
+
+      LCD_ClearLine2();                 /* clear line #2 */
+      LCD_ClearLine3();                 /* clear line #3 */
+      LCD_ClearLine(4);                 /* clear line #4 */
+
+      Pos = 0;
+      while (Pos < 4)              /* 4 test positions */
+      {
+        /* position: left, mid, right, mid */
+        Test = Pos;
+        if (Pos == 3) Test = 1;         /* mid */
+
+        /* toggle = 1.0ms + Test * 0.5ms */
+        OCR1B = SERVO_LEFT_NORM + Test * (SERVO_MID - SERVO_LEFT_NORM);
+
+        U_Peak = 0;                     /* reset peak value */
+        Value = 0;                      /* reset idle sum */
+        n = 0;
+        while (n < Frames)
+        {
+          /* wait for top of Timer1 */
+          TIFR1 = (1 << OCF1A);         /* clear flag */
+          while (! (TIFR1 & (1 << OCF1A)));
+
+          Temp = ReadU(TP1);            /* voltage across shunt */
+          if (Temp > U_Peak) U_Peak = Temp;   /* new peak */
+
+          n++;                          /* next period */
+          /* sum up last quarter for idle current */
+          if (n > (Frames - (Frames / 4))) Value += Temp;
+        }
+
+        /* idle voltage: average of last quarter */
+        Value /= Frames / 4;
+        Temp = (uint16_t)Value;
+
+        /* only keep higher peak (mid is tested twice) */
+        if (U_Peak > Peak[Test]) Peak[Test] = U_Peak;
+
+        /* display "<position> <peak current> <idle current>" */
+        LCD_ClearLine(Test + 2);        /* clear line */
+        LCD_CharPos(1, Test + 2);       /* go to start of line */
+        if (Test == 0) n = '<';         /* left */
+        else if (Test == 1) n = '|';    /* mid */
+        else n = '>';                   /* right */
+        Display_Char(n);
+
+        /* I = U / R_shunt (U in mV, R in mOhms) */
+        Value = Peak[Test];
+        Value *= 1000;                  /* scale to V */
+        Value /= SERVO_SHUNT;           /* V / mOhms = mA */
+        Display_Space();
+        Display_Value(Value, -3, 'A');  /* display peak current */
+
+        Value = Temp;
+        Value *= 1000;                  /* scale to V */
+        Value /= SERVO_SHUNT;           /* V / mOhms = mA */
+        Display_Space();
+        Display_Value(Value, -3, 'A');  /* display idle current */
+
+        Pos++;                          /* next position */
+      }
+
+      /* restore probes */
+      #ifndef HW_FIXED_SIGNAL_OUTPUT
+      ADC_DDR = (1 << TP1) | (1 << TP3);     /* probe 1 & 3 */
+      #else
+      ADC_DDR = 0;                      /* set HiZ mode */
+      #endif
+
+      /* wait for key press to return to normal UI */
+      TestKey(0, CHECK_BAT);
+
+      Flag &= ~RUN_AUTO_TEST;           /* clear flag */
+      Flag |= CHANGE_PULSE | DISPLAY_PULSE | DISPLAY_FREQ;  /* restore */
+      Test = 0;                         /* reset feedback */
+    }
+    #endif
   }
 
 
@@ -1201,6 +1559,11 @@ void Servo_Check(void)
   SIGNAL_DDR &= ~(1 << SIGNAL_OUT);     /* set HiZ mode */
   #endif
 
+  #ifdef SERVO_AUTO_TEST
+  /* local constant for auto test */
+  #undef SERVO_TEST_TIME
+  #endif
+
   /* local constants for sweeping */
   #undef SERVO_STEP_TIME
   #undef SERVO_SWEEP_TOP
@@ -1215,10 +1578,12 @@ void Servo_Check(void)
   #undef PULSE_STEP
 
   /* local constants for Mode */
+  #undef MODE_AUTO
   #undef MODE_FREQ
   #undef MODE_PULSE
 
   /* local constants for Flag */
+  #undef RUN_AUTO_TEST
   #undef TOGGLE_SWEEP
   #undef DISPLAY_FREQ
   #undef DISPLAY_PULSE
@@ -1228,16 +1593,263 @@ void Servo_Check(void)
   #undef RUN_FLAG
 }
 
+#endif
+
+
+
+/* ************************************************************************
+ *   DDS signal generator (sine/triangle)
+ * ************************************************************************ */
+
+
+#ifdef SW_DDS
+
+/*
+ *  DDS signal generator
+ *  - uses probe #2 (OC1B) as PWM output
+ *    and probe #1 & probe #3 as ground
+ *  - alternative: dedicated signal output via OC1B
+ *  - 8 bit fast PWM at f_MCU/256, requires external RC low pass filter
+ *  - Timer0 ISR updates duty cycle with sample rate of f_MCU/512 based on
+ *    a 16 bit phase accumulator
+ *  - waveforms: sine (quarter wave table) and triangle
+ *  - requires additional keys (e.g. rotary encoder)
+ *  - requires idle sleep mode to keep timers running when MCU is sleeping
+ */
+
+void DDS_Generator(void)
+{
+  uint8_t           Flag = 1;           /* loop control */
+  uint8_t           Test;               /* user feedback */
+  uint16_t          Step;               /* phase increment */
+  uint16_t          Temp;               /* temporary value */
+  uint32_t          Value;              /* temporary value */
+  unsigned char     *String = NULL;     /* string pointer (EEPROM) */
+
+  /*
+   *  local constants
+   *  - f_sample = f_MCU / (prescaler * (1 + top)) = f_MCU / 512
+   *  - f_out = step * f_sample / 2^16
+   *  - default: 100Hz
+   *  - max.: f_sample / 8 (8 samples per period)
+   */
+
+  #define DDS_DEFAULT_STEP  (uint16_t)((100UL * 65536UL * 512UL) / CPU_FREQ)
+  #define DDS_MAX_STEP      8192
+
+  /* buffer for sine table */
+  if (Scratch_Acquire(SCRATCH_DDS) == NULL) return;
+
+  ShortCircuit(0);                      /* make sure probes are not shorted */
+
+  /* display info */
+  LCD_Clear();
+  #ifdef UI_COLORED_TITLES
+    /* display: DDS */
+    Display_ColoredEEString_Space(DDS_str, COLOR_TITLE);
+  #else
+    Display_EEString_Space(DDS_str);    /* display: DDS */
+  #endif
+  #ifndef HW_FIXED_SIGNAL_OUTPUT
+  ProbePinout(PROBES_PWM);              /* show probes used */
+  #endif
+
+  #ifndef HW_FIXED_SIGNAL_OUTPUT
+  /* set up probes: #1 and #3 are signal ground, #2 is signal output */
+  ADC_PORT = 0;                         /* pull down directly: */
+  ADC_DDR = (1 << TP1) | (1 << TP3);    /* probe 1 & 3 */
+  R_DDR = (1 << R_RL_2);                /* enable Rl for probe 2 */
+  R_PORT = 0;                           /* pull down probe 2 initially */
+  #endif
+
+  #ifdef HW_FIXED_SIGNAL_OUTPUT
+  /* dedicated output via OC1B */
+  SIGNAL_PORT &= ~(1 << SIGNAL_OUT);    /* low by default */
+  SIGNAL_DDR |= (1 << SIGNAL_OUT);      /* enable output */
+  #endif
+
+  /* copy sine table to RAM (keeps ISR short) */
+  Test = 0;
+  while (Test < DDS_TABLE_SIZE)
+  {
+    DDS_Table[Test] = DATA_read_byte(&DDS_Sine_table[Test]);
+    Test++;
+  }
+
+  /* set start values */
+  DDS_Wave = DDS_SINE;             /* sine */
+  DDS_Phase = 0;                   /* reset phase */
+  Step = DDS_DEFAULT_STEP;         /* default frequency */
+  DDS_Step = Step;
+  DDS_Mode = 1;                    /* Timer0 ISR: DDS */
+
+
+  /*
+   *  set up Timer1 for PWM output
+   *  - fast PWM mode, 8 bit (top 0xFF)
+   *  - OC1B non-inverted output
+   *  - prescaler 1:1
+   */
+
+  OCR1B = 128;                          /* mid level */
+  TCCR1A = (1 << WGM10) | (1 << COM1B1);
+  TCCR1B = (1 << WGM12) | (1 << CS10);  /* start timer */
+
+
+  /*
+   *  set up Timer0 as sample clock
+   *  - CTC mode, top by OCR0A
+   *  - prescaler 1:8, top 63
+   */
+
+  TCNT0 = 0;                            /* reset counter */
+  OCR0A = 63;                           /* 512 MCU cycles */
+  TCCR0A = (1 << WGM01);                /* CTC mode */
+  TIFR0 = (1 << OCF0A);                 /* clear flag */
+  TIMSK0 = (1 << OCIE0A);               /* enable output compare A match interrupt */
+  TCCR0B = (1 << CS01);                 /* start timer: prescaler 1:8 */
+
+
+  /*
+   *  processing loop
+   */
+
+  while (Flag > 0)
+  {
+    /* update phase increment (16 bit value used by ISR) */
+    cli();                              /* disable interrupts */
+    DDS_Step = Step;
+    sei();                              /* enable interrupts */
+
+    /*
+     *  display waveform and frequency
+     *  - f_out = step * f_sample / 2^16
+     *          = step * (f_MCU / 1024) / 2^15
+     *  - in 0.01Hz, split division to prevent an overflow
+     */
+
+    if (DDS_Wave == DDS_SINE)           /* sine */
+    {
+      String = (unsigned char *)DDS_Sine_str;
+    }
+    else                                /* triangle */
+    {
+      String = (unsigned char *)DDS_Triangle_str;
+    }
+
+    Value = Step;
+    Value *= (CPU_FREQ / 1024);
+    Value /= 128;
+    Value *= 100;                       /* scale to 0.01Hz */
+    Value /= 256;
+
+    LCD_ClearLine2();
+    Display_EEString_Space(String);     /* display waveform */
+    Display_FullValue(Value, 2, 0);     /* display frequency */
+    Display_EEString(Hertz_str);        /* display: Hz */
+
+
+    /*
+     *  user feedback
+     */
+
+    /* wait for user feedback */
+    Test = TestKey(0, CHECK_KEY_TWICE | CHECK_BAT);
+
+    /* consider rotary encoder's turning velocity */
+    Temp = UI.KeyStep;             /* get velocity (1-7) */
+
+    if (Temp > 1)                  /* larger step */
+    {
+      /* increase step size based on turning velocity */
+
+      /* step^3: 8 27 64 125 216 343 */
+      Temp = Temp * Temp * Temp;
+    }
+
+    /* process user input */
+    if (Test == KEY_RIGHT)         /* encoder: right turn */
+    {
+      /* increase frequency */
+      Step += Temp;
+      if (Step > DDS_MAX_STEP) Step = DDS_MAX_STEP;     /* upper limit */
+    }
+    else if (Test == KEY_LEFT)     /* encoder: left turn */
+    {
+      /* decrease frequency */
+      if (Step > Temp) Step -= Temp;
+      else Step = 1;                    /* lower limit */
+    }
+    else if (Test == KEY_SHORT)    /* short key press */
+    {
+      /* toggle waveform */
+      if (DDS_Wave == DDS_SINE) DDS_Wave = DDS_TRIANGLE;
+      else DDS_Wave = DDS_SINE;
+    }
+    else if (Test == KEY_TWICE)    /* two short key presses */
+    {
+      Flag = 0;                         /* end loop */
+    }
+    else if (Test == KEY_LONG)     /* long key press */
+    {
+      Step = DDS_DEFAULT_STEP;          /* set default frequency */
+    }
+  }
+
+
+  /*
+   *  clean up
+   */
+
+  TCCR0B = 0;                 /* disable Timer0 */
+  TIMSK0 = 0;                 /* disable interrupts for Timer0 */
+  TCCR0A = 0;                 /* reset flags */
+  DDS_Mode = 0;               /* reset ISR mode */
+  TCCR1B = 0;                 /* disable Timer1 */
+  TCCR1A = 0;                 /* reset flags (also frees PB2) */
+
+  #ifndef HW_FIXED_SIGNAL_OUTPUT
+  R_DDR = 0;                  /* set HiZ mode */
+  #endif
+
+  #ifdef HW_FIXED_SIGNAL_OUTPUT
+  SIGNAL_DDR &= ~(1 << SIGNAL_OUT);     /* set HiZ mode */
+  #endif
+
+  Scratch_Release(SCRATCH_DDS);         /* free buffer */
+
+  /* local constants */
+  #undef DDS_DEFAULT_STEP
+  #undef DDS_MAX_STEP
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   shared ISR for signal tools
+ * ************************************************************************ */
 
 
+#if defined (SW_SERVO) || defined (SW_DDS)
+
 /*
  *  ISR for match of Timer0's OCR0A (Output Compare Register A)
  *  - sweep timer for servo check  
+ *  - sample clock for DDS signal generator
  */
 
 ISR(TIMER0_COMPA_vect, ISR_BLOCK)
 {
+  #ifdef SW_SERVO
   uint16_t          Temp;     /* temp. value */
+  #endif
+  #ifdef SW_DDS
+  uint16_t          Phase;    /* phase */
+  uint8_t           Index;    /* table index */
+  uint8_t           Value;    /* sample */
+  #endif
 
   /*
    *  hints:
@@ -1246,6 +1858,46 @@ ISR(TIMER0_COMPA_vect, ISR_BLOCK)
    *    (no nested interrupts)
    */
 
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_TIMER0]++;   /* count ISR call */
+  #endif
+
+  #ifdef SW_DDS
+  if (DDS_Mode)               /* DDS signal generator */
+  {
+    /* advance phase */
+    Phase = DDS_Phase + DDS_Step;
+    DDS_Phase = Phase;
+    Index = Phase >> 8;       /* upper 8 bits: 256 samples per period */
+
+    if (DDS_Wave == DDS_SINE)      /* sine */
+    {
+      /*
+       *  quarter wave table
+       *  - 2nd and 4th quarter: mirrored index
+       *  - 3rd and 4th quarter: negative half
+       */
+
+      Value = Index & 0x3F;        /* index within quarter */
+      if (Index & 0x40) Value ^= 0x3F;  /* mirror */
+      Value = DDS_Table[Value];    /* amplitude (0-127) */
+
+      if (Index & 0x80) Value = 127 - Value;  /* negative half */
+      else Value += 128;                      /* positive half */
+    }
+    else                           /* triangle */
+    {
+      Value = Index << 1;          /* rising edge */
+      if (Index & 0x80) Value = ~Value;  /* falling edge */
+    }
+
+    OCR1B = Value;            /* update duty cycle (buffered by timer) */
+
+    return;
+  }
+  #endif
+
+  #ifdef SW_SERVO
   /* toggle values for PWM */
   #define SERVO_LEFT_NORM     (((CPU_FREQ / 10000) * 10) / 16)   /* 1.0ms */
   #define SERVO_RIGHT_NORM    (((CPU_FREQ / 10000) * 20) / 16)   /* 2.0ms */
@@ -1282,6 +1934,7 @@ ISR(TIMER0_COMPA_vect, ISR_BLOCK)
 
   #undef SERVO_LEFT_NORM
   #undef SERVO_RIGHT_NORM
+  #endif
 }
 
 #endif
@@ -1295,6 +1948,49 @@ ISR(TIMER0_COMPA_vect, ISR_BLOCK)
 
 #ifdef SW_SQUAREWAVE
 
+#ifdef SQUAREWAVE_FRACTIONAL
+
+/*
+ *  ISR for overflow of Timer1
+ *  - dithers top value for fractional period
+ *  - the fraction accumulator adds an extra timer step to the next
+ *    period on each overflow (sigma-delta style)
+ */
+
+ISR(TIMER1_OVF_vect, ISR_BLOCK)
+{
+  uint8_t           Accu;          /* fraction accumulator */
+
+  /*
+   *  hints:
+   *  - the TOV1 interrupt flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   *  - OCR1A is double buffered and updated at top
+   */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_TIMER1]++;   /* count ISR call */
+  #endif
+
+  Accu = SquareAccu + SquareFrac;  /* add fraction */
+
+  if (Accu < SquareAccu)           /* overflow */
+  {
+    OCR1A = SquareTop + 1;         /* long period */
+  }
+  else                             /* no overflow */
+  {
+    OCR1A = SquareTop;             /* short period */
+  }
+
+  SquareAccu = Accu;               /* save accumulator */
+}
+
+#endif
+
+
+
 /*
  *  create square wave signal with variable frequency
  *  - uses probe #2 (OC1B) as output
@@ -1302,6 +1998,7 @@ ISR(TIMER0_COMPA_vect, ISR_BLOCK)
  *  - alternative: dedicated signal output via OC1B
  *  - requires additional keys (e.g. rotary encoder)
  *  - requires idle sleep mode to keep timer running when MCU is sleeping
+ *  - fractional period: top value plus a fraction in 1/256 steps
  */
 
 void SquareWave_SignalGenerator(void)
@@ -1315,6 +2012,11 @@ void SquareWave_SignalGenerator(void)
   uint16_t          Step;               /* step size */
   uint16_t          Temp;               /* temporary value */
   uint32_t          Value;              /* temporary value */
+  #ifdef SQUAREWAVE_FRACTIONAL
+  uint8_t           Frac = 0;           /* fractional part of top value */
+  uint32_t          Period;             /* top value in 1/256 */
+  uint32_t          Rest;               /* remainder */
+  #endif
 
   /*
       fast PWM:             f_PWM = f_MCU / (prescaler * (1 + top))
@@ -1415,18 +2117,35 @@ void SquareWave_SignalGenerator(void)
       Bits = DATA_read_byte(&T1_RegBits_table[Index]);
 
       /* adjust top value for changed prescaler */
+      #ifdef SQUAREWAVE_FRACTIONAL
+      Period = Top;                /* top value */
+      Period <<= 8;                /* in 1/256 */
+      Period |= Frac;              /* add fraction */
+      #endif
       if (Index > Test)            /* larger prescaler */
       {
         /* decrease top value by same factor as the prescaler increased */
         Temp = Prescaler / Step;
+        #ifdef SQUAREWAVE_FRACTIONAL
+        Period /= Temp;
+        #else
         Top /= Temp;
+        #endif
       }
       else                         /* smaller prescaler */
       {
         /* increase top value by same factor as the prescaler decreased */
         Temp = Step / Prescaler;
+        #ifdef SQUAREWAVE_FRACTIONAL
+        Period *= Temp;
+        #else
         Top *= Temp;  
+        #endif
       }
+      #ifdef SQUAREWAVE_FRACTIONAL
+      Top = Period >> 8;           /* integer part */
+      Frac = (uint8_t)Period;      /* fractional part */
+      #endif
     }
 
 
@@ -1439,6 +2158,15 @@ void SquareWave_SignalGenerator(void)
     TCNT1 = 0;                               /* reset counter */
     OCR1B = Top / 2;                         /* 50% duty cycle */
     OCR1A = Top;                             /* top value for frequency */
+    #ifdef SQUAREWAVE_FRACTIONAL
+    /* fractional period: dither top value via overflow interrupt */
+    SquareTop = Top;                         /* integer part */
+    SquareFrac = Frac;                       /* fractional part */
+    SquareAccu = 0;                          /* reset accumulator */
+    TIFR1 = (1 << TOV1);                     /* clear overflow flag */
+    if (Frac) TIMSK1 = (1 << TOIE1);         /* enable overflow interrupt */
+    else TIMSK1 = 0;                         /* disable interrupt */
+    #endif
     TCCR1B = (1 << WGM13) | (1 << WGM12) | Bits;    /* (re)start timer */
 
 
@@ -1465,7 +2193,19 @@ void SquareWave_SignalGenerator(void)
       Temp /= 8;              /* next lower prescaler */
     }
 
+    #ifdef SQUAREWAVE_FRACTIONAL
+    /* / (1 + top + frac), divisor in 1/256 */
+    Period = Top + 1;
+    Period <<= 8;
+    Period |= Frac;
+    Rest = Value % Period;              /* remainder */
+    Value /= Period;                    /* integer part */
+    Value <<= 8;                        /* * 256 */
+    Rest <<= 8;                         /* * 256 (fits: period < 2^24) */
+    Value += Rest / Period;             /* add fractional part */
+    #else
     Value /= Top + 1;                   /* / (1 + top) */
+    #endif
     LCD_ClearLine2();
     Display_FullValue(Value, Test, 0);  /* display frequency */
     Display_EEString(Hertz_str);        /* display: Hz */
@@ -1490,6 +2230,61 @@ void SquareWave_SignalGenerator(void)
       Step *= Step;                /* ^2 */
     }
 
+    #ifdef SQUAREWAVE_FRACTIONAL
+    /*
+     *  fractional period
+     *  - step size in 1/256 of top value
+     *  - fine steps between SQUARE_FRAC_MIN and 12 bits (prescaler 1 only)
+     *    scaled by top value (for keeping the relative step size)
+     *  - full steps otherwise
+     */
+
+    if ((Test == KEY_RIGHT) || (Test == KEY_LEFT))
+    {
+      Value = Step;                     /* step size */
+      if ((Top >= SQUARE_FRAC_MIN) && (Top < 0x0FFF))
+      {
+        Value *= (Top >> 8) + 1;        /* fine step */
+      }
+      else
+      {
+        Value <<= 8;                    /* full step */
+      }
+
+      Period = Top;                     /* top value */
+      Period <<= 8;                     /* in 1/256 */
+      Period |= Frac;                   /* add fraction */
+
+      if (Test == KEY_RIGHT)       /* encoder: right turn */
+      {
+        /* increase frequency -> decrease top value */
+        if (Period > (Value + 0x0300))  /* above lower limit */
+        {
+          Period -= Value;
+        }
+        else                            /* underflow */
+        {
+          Period = 0x0300;              /* lower limit: 3 */
+        }
+      }
+      else                         /* encoder: left turn */
+      {
+        /* decrease frequency -> increase top value */
+        Period += Value;
+        if (Period > 0xFFFE00)          /* overflow */
+        {
+          Period = 0xFFFE00;            /* upper limit: 0xFFFE */
+        }
+      }
+
+      Top = Period >> 8;                /* integer part */
+      Frac = (uint8_t)Period;           /* fractional part */
+      if (Top < SQUARE_FRAC_MIN)        /* too fast for dithering */
+      {
+        Frac = 0;                       /* integer top value only */
+      }
+    }
+    #else
     /* process user input */
     if (Test == KEY_RIGHT)         /* encoder: right turn */
     {
@@ -1511,6 +2306,7 @@ void SquareWave_SignalGenerator(void)
       }
       Top = Temp;                       /* set new value */
     }
+    #endif
     else if (Test == KEY_TWICE)    /* two short key presses */
     {
       Flag = 0;                         /* end loop */
@@ -1522,6 +2318,9 @@ void SquareWave_SignalGenerator(void)
       Prescaler = 1;                    /* prescaler 1/1 */
       Bits = (1 << CS10);               /* register bits for prescaler 1 */
       Top = (CPU_FREQ / 1000) - 1;      /* top = f_MCU / (prescaler * f) - 1 */
+      #ifdef SQUAREWAVE_FRACTIONAL
+      Frac = 0;                         /* no fraction */
+      #endif
     }
   }
 
@@ -1532,6 +2331,9 @@ void SquareWave_SignalGenerator(void)
 
   TCCR1B = 0;                 /* disable timer */
   TCCR1A = 0;                 /* reset flags (also frees PB2) */
+  #ifdef SQUAREWAVE_FRACTIONAL
+  TIMSK1 = 0;                 /* disable interrupts for Timer1 */
+  #endif
 
   #ifndef HW_FIXED_SIGNAL_OUTPUT
   R_DDR = 0;                  /* set HiZ mode */
@@ -35,6 +35,216 @@
 #define DIR_NONE         0b00000000     /* no turn or error */
 #define DIR_RESET        0b00000001     /* reset state */
 
+#ifdef INPUT_QUEUE
+/* input event queue */
+#define KEY_QUEUE_SIZE   8                             /* number of events */
+#define KEY_OVF_US       (262144UL / MCU_CYCLES_PER_US) /* Timer2 overflow (in s) */
+#define KEY_LONG_TICKS   (300000UL / KEY_OVF_US)        /* long key press (300ms) */
+#endif
+
+#ifdef UI_PART_DETECT
+/* part detection */
+#define PART_STABLE      2         /* checks with same result in a row */
+#endif
+
+#ifdef ENCODER_PCINT
+/* PCINT# of encoder's A & B pins */
+#define ENC_PCINT_A      (ENCODER_PCINT + ENCODER_A)
+#define ENC_PCINT_B      (ENCODER_PCINT + ENCODER_B)
+
+/* PCINT0-7 */
+#if (ENC_PCINT_A >= 0) && (ENC_PCINT_A <= 7)
+  #define BIT_PC_IRQ     PCIE0          /* Pin Change Interrupt Enable 0 */
+  #define BIT_PC_FLAG    PCIF0          /* Pin Change Interrupt Flag 0 */
+  #define REG_PC_MASK    PCMSK0         /* Pin Change Mask Register 0 */
+  #define ISR_PINCHANGE  PCINT0_vect    /* ISR */
+#endif
+
+/* PCINT8-15 */
+#if (ENC_PCINT_A >= 8) && (ENC_PCINT_A <= 15)
+  #define BIT_PC_IRQ     PCIE1          /* Pin Change Interrupt Enable 1 */
+  #define BIT_PC_FLAG    PCIF1          /* Pin Change Interrupt Flag 1 */
+  #define REG_PC_MASK    PCMSK1         /* Pin Change Mask Register 1 */
+  #define ISR_PINCHANGE  PCINT1_vect    /* ISR */
+#endif
+
+/* PCINT16-23 */
+#if (ENC_PCINT_A >= 16) && (ENC_PCINT_A <= 23)
+  #define BIT_PC_IRQ     PCIE2          /* Pin Change Interrupt Enable 2 */
+  #define BIT_PC_FLAG    PCIF2          /* Pin Change Interrupt Flag 2 */
+  #define REG_PC_MASK    PCMSK2         /* Pin Change Mask Register 2 */
+  #define ISR_PINCHANGE  PCINT2_vect    /* ISR */
+#endif
+
+/* PCINT24-31 */
+#if (ENC_PCINT_A >= 24) && (ENC_PCINT_A <= 31)
+  #define BIT_PC_IRQ     PCIE3          /* Pin Change Interrupt Enable 3 */
+  #define BIT_PC_FLAG    PCIF3          /* Pin Change Interrupt Flag 3 */
+  #define REG_PC_MASK    PCMSK3         /* Pin Change Mask Register 3 */
+  #define ISR_PINCHANGE  PCINT3_vect    /* ISR */
+#endif
+
+/* other users of the same ISR */
+#if defined (SERIAL_BITBANG) && ((ENC_PCINT_A / 8) == (SERIAL_PCINT / 8))
+  #error <<< Encoder: bit-bang serial uses same PCINT bank! >>>
+#endif
+
+#if defined (SW_IR_RX_PCINT) && ((ENC_PCINT_A / 8) == (IR_PCINT / 8))
+  #error <<< Encoder: IR detector edge capture uses same PCINT bank! >>>
+#endif
+
+#if defined (SW_DHTXX_PCINT) && ((ENC_PCINT_A / 8) == ((ADC_PCINT + TP2) / 8))
+  #error <<< Encoder: DHTxx edge capture uses same PCINT bank! >>>
+#endif
+
+#if defined (TOUCH_PCINT) && ((ENC_PCINT_A / 8) == (TOUCH_PCINT / 8))
+  #error <<< Encoder: touch screen uses same PCINT bank! >>>
+#endif
+#endif
+
+#ifdef UI_DEEP_SLEEP
+/* PCINT# of test push button */
+#define BTN_PCINT        (BUTTON_PCINT + TEST_BUTTON)
+
+/* PCINT0-7 */
+#if (BTN_PCINT >= 0) && (BTN_PCINT <= 7)
+  #define BTN_PC_IRQ     PCIE0          /* Pin Change Interrupt Enable 0 */
+  #define BTN_PC_MASK    PCMSK0         /* Pin Change Mask Register 0 */
+  #define BTN_PINCHANGE  PCINT0_vect    /* ISR */
+#endif
+
+/* PCINT8-15 */
+#if (BTN_PCINT >= 8) && (BTN_PCINT <= 15)
+  #define BTN_PC_IRQ     PCIE1          /* Pin Change Interrupt Enable 1 */
+  #define BTN_PC_MASK    PCMSK1         /* Pin Change Mask Register 1 */
+  #define BTN_PINCHANGE  PCINT1_vect    /* ISR */
+#endif
+
+/* PCINT16-23 */
+#if (BTN_PCINT >= 16) && (BTN_PCINT <= 23)
+  #define BTN_PC_IRQ     PCIE2          /* Pin Change Interrupt Enable 2 */
+  #define BTN_PC_MASK    PCMSK2         /* Pin Change Mask Register 2 */
+  #define BTN_PINCHANGE  PCINT2_vect    /* ISR */
+#endif
+
+/* PCINT24-31 */
+#if (BTN_PCINT >= 24) && (BTN_PCINT <= 31)
+  #define BTN_PC_IRQ     PCIE3          /* Pin Change Interrupt Enable 3 */
+  #define BTN_PC_MASK    PCMSK3         /* Pin Change Mask Register 3 */
+  #define BTN_PINCHANGE  PCINT3_vect    /* ISR */
+#endif
+
+/* ISR shared with encoder or touch screen (both don't mind the button) */
+#if defined (ENCODER_PCINT) && ((BTN_PCINT / 8) == (ENC_PCINT_A / 8))
+  #define BTN_SHARED_ISR
+#endif
+
+#if defined (TOUCH_PCINT) && ((BTN_PCINT / 8) == (TOUCH_PCINT / 8))
+  #define BTN_SHARED_ISR
+#endif
+
+/* other users of the same ISR */
+#if defined (SW_IR_RX_PCINT) && ((BTN_PCINT / 8) == (IR_PCINT / 8))
+  #error <<< Deep sleep: IR detector edge capture uses same PCINT bank! >>>
+#endif
+
+#if defined (SW_DHTXX_PCINT) && ((BTN_PCINT / 8) == ((ADC_PCINT + TP2) / 8))
+  #error <<< Deep sleep: DHTxx edge capture uses same PCINT bank! >>>
+#endif
+#endif
+
+
+/*
+ *  local variables
+ */
+
+#ifdef INPUT_QUEUE
+/* input event queue (filled by Timer2 overflow ISR) */
+volatile Key_Event_Type  KeyQueue[KEY_QUEUE_SIZE];    /* events */
+volatile uint8_t    KeyHead = 0;        /* position for next event */
+volatile uint8_t    KeyTail = 0;        /* position of oldest event */
+uint8_t             KeyTicks = 0;       /* press duration (in Timer2 overflows) */
+uint16_t            KeyTime;            /* time of last event taken (in ms) */
+#endif
+
+#ifdef ENCODER_PCINT
+/* rotary encoder */
+volatile uint8_t    EncAB;              /* last AB state */
+volatile int8_t     EncCount = 0;       /* Gray code pulses (CW: +, CCW: -) */
+#endif
+
+#ifdef UI_DEEP_SLEEP
+/* power-down sleep */
+volatile uint8_t    WatchdogWake;       /* woken up by watchdog */
+#endif
+
+#ifdef SYSTEM_TASKS
+/* background tasks */
+uint8_t             CursorState;        /* blinking cursor: 1 on, 0 off */
+  #ifdef POWER_OFF_TIMEOUT
+  uint16_t          PwrSeconds;         /* auto power-off (in s) */
+  #endif
+#endif
+
+#ifdef FUNC_SCRATCH
+/* scratch arena */
+uint8_t             ScratchOwner = SCRATCH_FREE;  /* current user */
+#endif
+
+
+
+#ifdef FUNC_SCRATCH
+
+/* ************************************************************************
+ *   scratch arena
+ * ************************************************************************ */
+
+
+/*
+ *  acquire scratch arena
+ *  - shared buffer for tools which never run at the same time
+ *  - size is set at compile time for the largest user (SCRATCH_SIZE)
+ *
+ *  requires:
+ *  - Owner: ID of user (SCRATCH_*)
+ *
+ *  returns:
+ *  - pointer to arena
+ *  - NULL if arena is used by someone else
+ */
+
+void *Scratch_Acquire(uint8_t Owner)
+{
+  void              *Buffer = NULL;     /* return value */
+
+  if ((ScratchOwner == SCRATCH_FREE) || (ScratchOwner == Owner))
+  {
+    ScratchOwner = Owner;          /* take ownership */
+    Buffer = &Scratch[0];          /* start of arena */
+  }
+
+  return Buffer;
+}
+
+
+
+/*
+ *  release scratch arena
+ *
+ *  requires:
+ *  - Owner: ID of user (SCRATCH_*)
+ */
+
+void Scratch_Release(uint8_t Owner)
+{
+  if (ScratchOwner == Owner)       /* current user */
+  {
+    ScratchOwner = SCRATCH_FREE;   /* free arena */
+  }
+}
+
+#endif
+
 
 
 /* ************************************************************************
@@ -42,17 +252,43 @@
  * ************************************************************************ */
 
 
+/*
+ *  get power of ten
+ *  - taken from table instead of multiplying by 10
+ *
+ *  requires:
+ *  - Exponent: 0 - 9
+ *
+ *  returns:
+ *  - 10^Exponent
+ */
+
+uint32_t Power10(uint8_t Exponent)
+{
+  uint32_t          Value = 1;     /* return value (10^0) */
+
+  if ((Exponent > 0) && (Exponent <= NUM_POWER10))
+  {
+    /* table starts with 10^9 */
+    Value = DATA_read_dword(&Power10_table[NUM_POWER10 - Exponent]);
+  }
+
+  return Value;
+}
+
+
+
 /*
  *  get number of digits of a value
+ *  - compares with powers of ten instead of dividing by 10
  */
 
 uint8_t NumberOfDigits(uint32_t Value)
 {
   uint8_t           Counter = 1;   /* return value */
 
-  while (Value >= 10)
+  while ((Counter <= NUM_POWER10) && (Value >= Power10(Counter)))
   {
-    Value /= 10;
     Counter++;
   }
 
@@ -61,6 +297,70 @@ uint8_t NumberOfDigits(uint32_t Value)
 
 
 
+/*
+ *  rescale value
+ *  - single multiplication or division by a power of ten from table
+ *  - saturates at UINT32_MAX when downscaling would overflow
+ *
+ *  requires:
+ *  - value and scale (*10^x)
+ *  - new scale (*10^x)
+ *
+ *  returns:
+ *  - rescaled value
+ */
+
+uint32_t RescaleValue(uint32_t Value, int8_t Scale, int8_t NewScale)
+{
+  uint32_t          NewValue;      /* return value */
+  uint32_t          Factor;        /* power of ten */
+  int8_t            Steps;         /* number of 10^1 steps */
+  uint8_t           Length;        /* number of digits */
+
+  NewValue = Value;           /* take old value */
+  Steps = NewScale - Scale;   /* scale difference */
+
+  if (Steps > 0)              /* upscale */
+  {
+    if (Steps > NUM_POWER10)  /* larger than any 32 bit value */
+    {
+      NewValue = 0;           /* nothing left */
+    }
+    else
+    {
+      NewValue /= Power10(Steps);
+    }
+  }
+  else if ((Steps < 0) && (Value > 0))  /* downscale */
+  {
+    Steps = -Steps;                     /* make positive */
+    Length = NumberOfDigits(Value) + Steps;  /* digits of new value */
+
+    if (Length > 10)          /* more digits than 32 bits can hold */
+    {
+      NewValue = UINT32_MAX;  /* saturate */
+    }
+    else
+    {
+      Factor = Power10(Steps);
+
+      /* 10 digits: might exceed 2^32 */
+      if ((Length == 10) && (Value > (UINT32_MAX / Factor)))
+      {
+        NewValue = UINT32_MAX;          /* saturate */
+      }
+      else
+      {
+        NewValue *= Factor;
+      }
+    }
+  }
+
+  return NewValue;
+}
+
+
+
 /*
  *  compare two scaled values
  *
@@ -94,23 +394,15 @@ int8_t CmpValue(uint32_t Value1, int8_t Scale1, uint32_t Value2, int8_t Scale2)
   }
   else if (Len1 == Len2)      /* same length */
   {
-    /* re-scale to longer value */
-    Len1 -= Scale1;           /* just number of digits */
-    Len2 -= Scale2;           /* just number of digits */
-
-    while (Len1 > Len2)       /* up-scale Value #2 */
+    /* re-scale to longer value (saturates on overflow) */
+    if (Scale2 > Scale1)      /* up-scale Value #2 */
     {
-      Value2 *= 10;
-      Len2++;
-      /* Scale2-- */
+      Value2 = RescaleValue(Value2, Scale2, Scale1);
     }
-
-    while (Len2 > Len1)       /* up-scale Value #1 */
+    else if (Scale1 > Scale2) /* up-scale Value #1 */
     {
-      Value1 *= 10;
-      Len1++;
-      /* Scale1-- */
-    }   
+      Value1 = RescaleValue(Value1, Scale1, Scale2);
+    }
 
     Flag = 10;                /* perform direct comparison */
   }
@@ -141,42 +433,6 @@ int8_t CmpValue(uint32_t Value1, int8_t Scale1, uint32_t Value2, int8_t Scale2)
 
 
 
-/*
- *  rescale value
- *
- *  requires:
- *  - value and scale (*10^x)
- *  - new scale (*10^x)
- *
- *  returns:
- *  - rescaled value
- */
-
-uint32_t RescaleValue(uint32_t Value, int8_t Scale, int8_t NewScale)
-{
-  uint32_t          NewValue;      /* return value */
-
-  NewValue = Value;           /* take old value */
-
-  while (Scale != NewScale)   /* processing loop */
-  {
-    if (NewScale > Scale)     /* upscale */
-    {
-      NewValue /= 10;
-      Scale++;
-    }
-    else                      /* downscale */
-    {
-      NewValue *= 10;
-      Scale--;
-    }
-  }
-
-  return NewValue;
-}
-
-
-
 #ifdef SW_R_TRIMMER
 
 /*
@@ -284,6 +540,49 @@ int32_t RoundSignedValue(int32_t Value, uint8_t Scale, uint8_t RoundScale)
 
 
 
+#ifdef FUNC_STATS_SQRT
+
+/*
+ *  integer square root
+ *
+ *  requires:
+ *  - Value: radicand
+ *
+ *  returns:
+ *  - square root (rounded down)
+ */
+
+uint16_t Stats_Sqrt(uint32_t Value)
+{
+  uint32_t          Root = 0;           /* root */
+  uint32_t          Bit;                /* bit mask */
+
+  Bit = (uint32_t)1 << 30;         /* highest power of 4 */
+
+  while (Bit > Value) Bit >>= 2;
+
+  while (Bit > 0)
+  {
+    if (Value >= Root + Bit)
+    {
+      Value -= Root + Bit;
+      Root = (Root >> 1) + Bit;
+    }
+    else
+    {
+      Root >>= 1;
+    }
+
+    Bit >>= 2;
+  }
+
+  return (uint16_t)Root;
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   conversion functions
  * ************************************************************************ */
@@ -436,7 +735,155 @@ void PassiveBuzzer(uint8_t Mode)
  * ************************************************************************ */
 
 
-#ifdef HW_ENCODER 
+#ifdef INPUT_QUEUE
+
+/*
+ *  scan test push button and add events to queue
+ *  - called by the Timer2 overflow ISR (system tick), so key presses
+ *    aren't lost while the tester is busy
+ *  - sampling interval of 13-33ms (depends on MCU clock) also
+ *    debounces the push button
+ *  - a long key press is queued as soon as it's detected
+ *  - events are dropped when the queue is full
+ *
+ *  requires:
+ *  - Time: current system tick (in ms, lower 16 bits)
+ */
+
+void Key_Scan(uint16_t Time)
+{
+  uint8_t           Key = KEY_NONE;     /* event */
+  uint8_t           Pos;                /* queue position */
+
+  if (!(BUTTON_PIN & (1 << TEST_BUTTON)))    /* test button pressed */
+  {
+    if (KeyTicks < UINT8_MAX) KeyTicks++;    /* prevent overflow */
+
+    if (KeyTicks == KEY_LONG_TICKS)     /* reached long key press */
+    {
+      Key = KEY_LONG;
+    }
+  }
+  else                                  /* test button released */
+  {
+    if ((KeyTicks > 0) && (KeyTicks < KEY_LONG_TICKS))
+    {
+      Key = KEY_SHORT;                  /* short key press */
+    }
+
+    KeyTicks = 0;                       /* reset duration */
+  }
+
+  if (Key != KEY_NONE)                  /* got event */
+  {
+    Pos = (KeyHead + 1) % KEY_QUEUE_SIZE;    /* next position */
+
+    if (Pos != KeyTail)                 /* queue not full */
+    {
+      KeyQueue[KeyHead].Key = Key;      /* add event */
+      KeyQueue[KeyHead].Time = Time;
+      KeyHead = Pos;                    /* update position */
+    }
+  }
+}
+
+
+
+/*
+ *  get next event from input queue (non-blocking)
+ *  - can be used by tools to check for a key press between measurements
+ *  - time of event is saved in KeyTime
+ *
+ *  returns:
+ *  - KEY_NONE if queue is empty
+ *  - KEY_SHORT for short press of test key
+ *  - KEY_LONG for long press of test key
+ */
+
+uint8_t Key_Get(void)
+{
+  uint8_t           Key = KEY_NONE;     /* return value */
+  uint8_t           Pos;                /* queue position */
+
+  Pos = KeyTail;
+
+  if (Pos != KeyHead)                   /* queue not empty */
+  {
+    Key = KeyQueue[Pos].Key;            /* get event */
+    KeyTime = KeyQueue[Pos].Time;
+    KeyTail = (Pos + 1) % KEY_QUEUE_SIZE;    /* remove event */
+  }
+
+  return Key;
+}
+
+
+
+/*
+ *  remove all events from input queue
+ *  - call after polling the test push button directly
+ */
+
+void Key_Flush(void)
+{
+  KeyTail = KeyHead;                    /* empty queue */
+}
+
+
+
+/*
+ *  check for second short key press after a short key press
+ *  - waits up to 250ms after the first key press
+ *
+ *  returns:
+ *  - KEY_SHORT for single short key press
+ *  - KEY_TWICE for two short key presses
+ */
+
+uint8_t Key_Twice(void)
+{
+  uint8_t           Key = KEY_SHORT;    /* return value */
+  uint8_t           Run = 1;            /* loop control */
+  uint16_t          Time;               /* time of first key press */
+
+  Time = KeyTime;                       /* save time of first key press */
+
+  while (Run)
+  {
+    if (KeyTail != KeyHead)             /* got another event */
+    {
+      if (KeyQueue[KeyTail].Key == KEY_SHORT)     /* short key press */
+      {
+        Key_Get();                      /* remove event */
+
+        if ((uint16_t)(KeyTime - Time) <= 250)    /* quick succession */
+        {
+          Key = KEY_TWICE;              /* signal two key presses */
+          MilliSleep(200);              /* smooth UI */
+        }
+      }
+
+      /* keep any other event for next call */
+      Run = 0;                          /* end loop */
+    }
+    else if ((uint16_t)((uint16_t)SysTick_Get() - Time) > 250)
+    {
+      Run = 0;                          /* timeout */
+    }
+    else                                /* keep waiting */
+    {
+      MilliSleep(10);                   /* wait 10ms */
+    }
+  }
+
+  return Key;
+}
+
+#endif
+
+
+
+#if defined (HW_ENCODER) && ! defined (ENCODER_PCINT)
 
 /*
  *  read rotary encoder
@@ -493,53 +940,235 @@ uint8_t ReadEncoder(void)
   /* process signals */
   if (Old_AB != AB)        /* signals changed */
   {
-    /* check if only one bit has changed (Gray code) */
-    Temp = AB ^ Old_AB;                 /* get bit difference */
-    if (!(Temp & 0b00000001))           /* B hasn't changed */
+    /* check if only one bit has changed (Gray code) */
+    Temp = AB ^ Old_AB;                 /* get bit difference */
+    if (!(Temp & 0b00000001))           /* B hasn't changed */
+    {
+      Temp >>= 1;                       /* shift right to get A */
+    }
+
+    if (Temp == 1)                      /* valid change */
+    {
+      /*
+       *  detect direction
+       *  - check sequence: next AB for AB=11, AB=10, AB=01, AB=00
+       *  - right turn (CW):
+       *    Gray code for AB: 00-10-11-01 -> check sequence 01110010
+       *  - left turn (CCW):
+       *    Gray code for AB: 00-01-11-10 -> check sequence 10001101
+       */
+
+      Temp = 0b01110010;                /* expected values for a right turn */
+      Temp >>= (Old_AB * 2);            /* get expected value by shifting */
+      Temp &= 0b00000011;               /* select value */
+      if (Temp == AB)                   /* value matches */
+        Temp = KEY_RIGHT;               /* turn to the right */
+      else                              /* value mismatches */
+        Temp = KEY_LEFT;                /* turn to the left */
+
+      /* step/detent logic */
+      UI.EncPulses++;                   /* got a new pulse */
+
+      if (Temp != UI.EncDir)            /* direction has changed */
+      {     
+        UI.EncPulses = 1;               /* first pulse for new direction */
+        UI.EncTicks = 1;                /* enable time counter */
+      }
+
+      UI.EncDir = Temp;                 /* update direction */
+
+      if (UI.EncPulses >= ENCODER_PULSES)    /* reached step */
+      {
+        UI.EncPulses = 0;               /* reset pulses */
+        Key = Temp;                     /* signal valid step */
+      }
+    }
+    else                                /* invalid change */
+    {
+      UI.EncDir = DIR_RESET;            /* reset direction state */
+    }
+  }
+
+  return Key;
+}
+
+#endif
+
+
+
+#ifdef ENCODER_PCINT
+
+/*
+ *  get AB state of rotary encoder
+ *  - A & B have pull-up resistors
+ *
+ *  returns:
+ *  - AB state (1 = open / 0 = closed)
+ */
+
+uint8_t Encoder_AB(void)
+{
+  uint8_t           AB = 0;             /* return value */
+  uint8_t           Temp;               /* temporary value */
+
+  Temp = ENCODER_PIN;
+  if (Temp & (1 << ENCODER_A)) AB = 0b00000010;
+  if (Temp & (1 << ENCODER_B)) AB |= 0b00000001;
+
+  return AB;
+}
+
+
+
+/*
+ *  set up pin change interrupt for rotary encoder
+ *  - requires dedicated pins for A & B (not shared with display)
+ *  - should be called at firmware startup
+ */
+
+void Encoder_Init(void)
+{
+  /* set encoder's A & B pins to input */
+  ENCODER_DDR &= ~((1 << ENCODER_A) | (1 << ENCODER_B));
+
+  EncAB = Encoder_AB();                 /* get current state */
+  EncCount = 0;                         /* reset pulses */
+
+  /* enable pin change interrupt for A & B */
+  REG_PC_MASK |= (1 << (ENC_PCINT_A % 8)) | (1 << (ENC_PCINT_B % 8));
+  PCIFR = (1 << BIT_PC_FLAG);           /* clear interrupt flag */
+  PCICR |= (1 << BIT_PC_IRQ);           /* enable pin change interrupt */
+}
+
+
+
+/*
+ *  ISR for pin change of rotary encoder's A & B
+ *  - decodes Gray code and accumulates pulses
+ */
+
+ISR(ISR_PINCHANGE, ISR_BLOCK)
+{
+  uint8_t           AB;                 /* new AB state */
+  uint8_t           Old_AB;             /* old AB state */
+  uint8_t           Temp;               /* temporary value */
+  int8_t            Count;              /* pulses */
+
+  /*
+   *  hints:
+   *  - the interrupt flag is cleared automatically
+   *  - all other interrupts are disabled
+   */
+
+  #ifdef SW_PERF_COUNTERS
+  PerfCount[PERF_PCINT]++;    /* count ISR call */
+  #endif
+
+  AB = Encoder_AB();               /* get AB state */
+  Old_AB = EncAB;                  /* get last state */
+
+  if (Old_AB == AB) return;        /* no change (glitch) */
+
+  EncAB = AB;                      /* save new state */
+  Count = EncCount;
+
+  /* check if only one bit has changed (Gray code) */
+  Temp = AB ^ Old_AB;              /* get bit difference */
+  if (Temp == 0b00000011)          /* both changed (missed pulse) */
+  {
+    Count = 0;                     /* reset pulses */
+  }
+  else                             /* valid change */
+  {
+    /* detect direction (see ReadEncoder() for the check sequence) */
+    Temp = 0b01110010;             /* expected values for a right turn */
+    Temp >>= (Old_AB * 2);         /* get expected value by shifting */
+    Temp &= 0b00000011;            /* select value */
+
+    if (Temp == AB)                /* right turn */
+    {
+      if (Count < 127) Count++;    /* prevent overflow */
+    }
+    else                           /* left turn */
+    {
+      if (Count > -127) Count--;   /* prevent underflow */
+    }
+  }
+
+  EncCount = Count;                /* save pulses */
+}
+
+
+
+/*
+ *  read rotary encoder
+ *  - consumes pulses accumulated by the pin change interrupt
+ *  - adds delay of 0.5ms to keep the timing of TestKey()
+ *
+ *  returns user action:
+ *  - KEY_NONE for no turn or invalid signal
+ *  - KEY_RIGHT for right/clockwise turn
+ *  - KEY_LEFT for left/counter-clockwise turn
+ */
+
+uint8_t ReadEncoder(void)
+{
+  uint8_t           Key = KEY_NONE;     /* return value */
+  uint8_t           Dir = DIR_NONE;     /* direction of pulses */
+  int8_t            Count;              /* pulses */
+
+  wait500us();                          /* same delay as polling */
+
+  /* first scan */
+  if (UI.EncDir == DIR_RESET)
+  {
+    UI.EncDir = DIR_NONE;               /* reset direction */
+    UI.EncTicks = 0;                    /* reset time counter */
+  }
+
+  /* time counter */
+  if (UI.EncTicks > 0)        /* after first pulse */
+  {
+    if (UI.EncTicks < 250)    /* prevent overflow */
     {
-      Temp >>= 1;                       /* shift right to get A */
+      UI.EncTicks++;          /* increase counter */
     }
+  }
 
-    if (Temp == 1)                      /* valid change */
-    {
-      /*
-       *  detect direction
-       *  - check sequence: next AB for AB=11, AB=10, AB=01, AB=00
-       *  - right turn (CW):
-       *    Gray code for AB: 00-10-11-01 -> check sequence 01110010
-       *  - left turn (CCW):
-       *    Gray code for AB: 00-01-11-10 -> check sequence 10001101
-       */
-
-      Temp = 0b01110010;                /* expected values for a right turn */
-      Temp >>= (Old_AB * 2);            /* get expected value by shifting */
-      Temp &= 0b00000011;               /* select value */
-      if (Temp == AB)                   /* value matches */
-        Temp = KEY_RIGHT;               /* turn to the right */
-      else                              /* value mismatches */
-        Temp = KEY_LEFT;                /* turn to the left */
-
-      /* step/detent logic */
-      UI.EncPulses++;                   /* got a new pulse */
+  cli();                                /* disable interrupts */
+  Count = EncCount;                     /* get pulses */
 
-      if (Temp != UI.EncDir)            /* direction has changed */
-      {     
-        UI.EncPulses = 1;               /* first pulse for new direction */
-        UI.EncTicks = 1;                /* enable time counter */
-      }
+  if (Count >= ENCODER_PULSES)          /* step to the right */
+  {
+    EncCount = Count - ENCODER_PULSES;  /* consume pulses */
+    Key = KEY_RIGHT;
+  }
+  else if (Count <= -ENCODER_PULSES)    /* step to the left */
+  {
+    EncCount = Count + ENCODER_PULSES;  /* consume pulses */
+    Key = KEY_LEFT;
+  }
+  sei();                                /* enable interrupts */
 
-      UI.EncDir = Temp;                 /* update direction */
+  /* direction of current or pending pulses */
+  if (Key)                              /* got step */
+  {
+    Dir = Key;
+  }
+  else if (Count > 0)                   /* pulses to the right */
+  {
+    Dir = KEY_RIGHT;
+  }
+  else if (Count < 0)                   /* pulses to the left */
+  {
+    Dir = KEY_LEFT;
+  }
 
-      if (UI.EncPulses >= ENCODER_PULSES)    /* reached step */
-      {
-        UI.EncPulses = 0;               /* reset pulses */
-        Key = Temp;                     /* signal valid step */
-      }
-    }
-    else                                /* invalid change */
-    {
-      UI.EncDir = DIR_RESET;            /* reset direction state */
-    }
+  /* start time counter for new direction */
+  if ((Dir != DIR_NONE) && (Dir != UI.EncDir))
+  {
+    UI.EncTicks = 1;                    /* enable time counter */
+    UI.EncDir = Dir;                    /* update direction */
   }
 
   return Key;
@@ -834,6 +1463,218 @@ uint8_t ReadTouchScreen(uint8_t Mode)
 
 
 
+#ifdef SYSTEM_TASKS
+
+/*
+ *  run background tasks
+ *  - cooperative scheduler for housekeeping while waiting for user feedback
+ *  - each task runs to completion when its software timer expires
+ *  - battery monitoring (every 100ms)
+ *    with BAT_BACKGROUND: light sampling every 100ms
+ *  - blinking cursor (every 500ms)
+ *  - optional auto-power-off (every 1s)
+ *  - optional drift check of fixed cap (every 60s)
+ *
+ *  requires:
+ *  - Mode: feedback mode of TestKey() (bitfield)
+ *    CURSOR_BLINK     blinking cursor
+ *    CHECK_BAT        check battery (and power off on low battery)
+ *    CHECK_REFCAP     drift check of fixed cap
+ *
+ *  returns:
+ *  - events (bitfield)
+ *    TASK_NONE        no event
+ *    TASK_POWER_OFF   auto-power-off timeout
+ */
+
+uint8_t RunTasks(uint8_t Mode)
+{
+  uint8_t           Events = TASK_NONE; /* return value */
+
+  #ifndef BAT_NONE
+  /* battery monitoring */
+  if (SysTimer_Expired(SYS_TIMER_BAT))  /* every 100ms */
+  {
+    #ifdef BAT_BACKGROUND
+    if (Mode & CHECK_BAT)               /* battery check requested */
+    {
+      SampleBattery();                  /* light sampling */
+    }
+    #endif
+
+    if (Cfg.BatTimer > 1)               /* timeout not zero yet */
+    {
+      Cfg.BatTimer--;                   /* decrease timeout counter */
+    }
+    else                                /* timeout triggered */
+    {
+      if (Mode & CHECK_BAT)             /* battery check requested */
+      {
+        CheckBattery();                 /* check battery */
+                                        /* also powers off on low battery */
+      }
+    }
+  }
+  #endif
+
+  /* blinking cursor */
+  if (SysTimer_Expired(SYS_TIMER_CURSOR))    /* every 500ms */
+  {
+    if (Mode & CURSOR_BLINK)            /* blinking cursor enabled */
+    {
+      CursorState ^= 1;                 /* toggle state */
+      LCD_Cursor(CursorState);          /* update cursor */
+    }
+  }
+
+  #ifdef POWER_OFF_TIMEOUT
+  /* automatic power-off */
+  if (SysTimer_Expired(SYS_TIMER_PWR))  /* every 1s */
+  {
+    if (PwrSeconds > 0)                 /* power-off timeout enabled */
+    {
+      if (PwrSeconds > 1)               /* some time left */
+      {
+        PwrSeconds--;                   /* decrease counter */
+      }
+      else                              /* timeout */
+      {
+        Events |= TASK_POWER_OFF;       /* signal power-off */
+      }
+    }
+  }
+  #endif
+
+  #ifdef ADJUST_CAP_DRIFT
+  /* drift check of fixed cap */
+  if (Mode & CHECK_REFCAP)              /* tester is idle */
+  {
+    /* check timer only when idle to keep the expiry pending */
+    if (SysTimer_Expired(SYS_TIMER_REFCAP))  /* every 60s */
+    {
+      RefCap_Drift();                   /* update offsets */
+    }
+  }
+  #endif
+
+  return Events;
+}
+
+#endif
+
+
+
+#ifdef UI_DEEP_SLEEP
+
+/*
+ *  enter power-down sleep mode while waiting for user feedback
+ *  - wakes up on a pin change of the test push button, the rotary
+ *    encoder (ENCODER_PCINT) or the touch screen (TOUCH_PCINT)
+ *  - Timer2 isn't clocked in power-down mode, so the watchdog is
+ *    switched to interrupt mode for a 1s wake-up and back to reset
+ *    mode afterwards
+ *  - returns immediately when some user feedback is pending already
+ *
+ *  returns:
+ *  - 1 when woken up by the watchdog (1s passed)
+ *  - 0 otherwise
+ */
+
+uint8_t DeepSleep(void)
+{
+  uint8_t           Test;               /* temp. value */
+
+  WatchdogWake = 0;                /* reset flag */
+
+  #ifdef I2C_TWI_IRQ
+  /* TWI isn't clocked in power-down mode */
+  I2C_Flush();                     /* finish queued I2C jobs */
+  #endif
+
+  cli();                           /* disable interrupts */
+
+  /* check for pending user feedback */
+  Test = BUTTON_PIN & (1 << TEST_BUTTON);    /* low active */
+  #ifdef ENCODER_PCINT
+  if (EncCount != 0) Test = 0;     /* pulses not consumed yet */
+  #endif
+  #ifdef TOUCH_PCINT
+  if (! (TOUCH_PIN & (1 << TOUCH_PEN))) Test = 0;     /* screen touched */
+  #endif
+
+  if (Test)                        /* nothing pending */
+  {
+    /*
+     *  arm wake-up sources
+     *  - encoder and touch screen have their own pin change interrupts
+     *  - a stale interrupt flag just causes an early wake-up
+     */
+
+    BTN_PC_MASK |= (1 << (BTN_PCINT % 8));   /* enable test button pin */
+    PCICR |= (1 << BTN_PC_IRQ);              /* enable pin change interrupt */
+
+    /* watchdog: interrupt mode, timeout 1s (timed sequence) */
+    wdt_reset();
+    WDTCSR = (1 << WDCE) | (1 << WDE);
+    WDTCSR = (1 << WDIE) | (1 << WDP2) | (1 << WDP1);
+
+    /*
+     *  sleep
+     *  - sei() executes the next instruction before any pending
+     *    interrupt, so a wake-up can't get lost
+     */
+
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);     /* set sleep mode to "power down" */
+    sleep_enable();                /* enable sleep */
+    sei();                         /* enable interrupts */
+    sleep_cpu();                   /* sleep */
+    /* woken up */
+    sleep_disable();               /* disable sleep */
+
+    /* restore watchdog and pin change interrupt */
+    wdt_enable(WDTO_2S);           /* reset mode, timeout 2s */
+    cli();                         /* disable interrupts */
+    BTN_PC_MASK &= ~(1 << (BTN_PCINT % 8));  /* disable test button pin */
+    #ifndef BTN_SHARED_ISR
+    PCICR &= ~(1 << BTN_PC_IRQ);             /* disable pin change interrupt */
+    #endif
+  }
+
+  set_sleep_mode(Cfg.SleepMode);   /* restore default sleep mode */
+  sei();                           /* enable interrupts */
+
+  return WatchdogWake;
+}
+
+
+
+/*
+ *  ISR for watchdog timeout (interrupt mode)
+ *  - wakes up the MCU from power-down sleep
+ */
+
+ISR(WDT_vect, ISR_BLOCK)
+{
+  WatchdogWake = 1;                /* signal timeout */
+}
+
+
+
+#ifndef BTN_SHARED_ISR
+
+/*
+ *  ISR for pin change of test push button
+ *  - just wakes up the MCU from power-down sleep
+ */
+
+EMPTY_INTERRUPT(BTN_PINCHANGE)
+
+#endif
+
+#endif
+
+
+
 /*
  *  get user feedback
  *  - test push button
@@ -856,6 +1697,8 @@ uint8_t ReadTouchScreen(uint8_t Mode)
  *    CHECK_KEY_TWICE  check for two short test key presses
  *    CHECK_BAT        check battery (and power off on low battery)
  *    CURSOR_TEXT      show text instead of cursor (UI.KeyHint)
+ *    CHECK_PART       check for a new part (probes open, then part connected)
+ *    CHECK_REFCAP     drift check of fixed cap (ADJUST_CAP_DRIFT)
  *
  *  returns:
  *  - KEY_TIMEOUT     reached timeout (no key press)
@@ -866,6 +1709,7 @@ uint8_t ReadTouchScreen(uint8_t Mode)
  *  - KEY_LEFT        left key (e.g. rotary encoder turned left)
  *  - KEY_INCDEC      increase and decrease keys both pressed
  *  - KEY_POWER_OFF   power off requested
+ *  - KEY_PROBE       new part connected
  *  The turning velocity (speed-up) is returned via UI.KeyStep (1-7).
  */
 
@@ -873,7 +1717,9 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
 {
   uint8_t           Key = KEY_TIMEOUT;  /* return value */
   uint8_t           Run = 1;            /* loop control */
+  #if ! defined (INPUT_QUEUE) || ! defined (SYSTEM_TASKS)
   uint8_t           Ticks = 0;          /* time counter */
+  #endif
   uint8_t           Test;               /* temp. value */
   #ifdef HW_ENCODER
   uint8_t           Timeout2;           /* step timeout */
@@ -890,6 +1736,14 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
   #ifdef UI_COLORED_CURSOR
   uint16_t          Color;              /* pen color */
   #endif
+  #ifdef UI_PART_DETECT
+  uint8_t           PartTicks = 0;      /* time counter for part checks */
+  uint8_t           PartOpen = 0;       /* probes were open */
+  uint8_t           PartCount = 0;      /* checks in a row */
+  #endif
+  #ifdef UI_DEEP_SLEEP
+  uint8_t           Sleep = 0;          /* power-down sleep */
+  #endif
 
 
   /*
@@ -920,6 +1774,16 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
   UI.KeyStep = 1;             /* default level #1 */
   #endif
 
+  #ifdef UI_SHADOW_GRID
+  /* output is done, so finish any pending text line */
+  Shadow_Flush();
+  #endif
+
+  #ifdef FUNC_LCD_FLUSH
+  /* output is done, so update display */
+  LCD_Flush();
+  #endif
+
   #ifdef POWER_OFF_TIMEOUT
   /* init power-off timeout */
   if (Cfg.OP_Control & OP_PWR_TIMEOUT)  /* power-off timeout enabled */
@@ -972,6 +1836,32 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
     LCD_Cursor(1);            /* enable cursor on display */
   }
 
+  #ifdef UI_DEEP_SLEEP
+  /* power-down sleep: no timeout and nothing to do periodically */
+  if ((Timeout == 0) && ! (Mode & (CURSOR_BLINK | CHECK_PART)))
+  {
+    Sleep = 1;                /* enable */
+  }
+  #endif
+
+  #ifdef SYSTEM_TICK
+  if (Timeout > 0)            /* timeout enabled */
+  {
+    /* deadline for feedback timeout */
+    SysTimer_Start(SYS_TIMER_KEY, Timeout, 0);
+  }
+  #endif
+
+  #ifdef SYSTEM_TASKS
+  /* init background tasks */
+  CursorState = 1;                      /* cursor is on */
+  SysTimer_Start(SYS_TIMER_CURSOR, 500, 500);
+    #ifdef POWER_OFF_TIMEOUT
+    PwrSeconds = PwrTimeout / 2;        /* 500ms -> s */
+    SysTimer_Start(SYS_TIMER_PWR, 1000, 1000);
+    #endif
+  #endif
+
 
   /*
    *  wait for user feedback or timeout
@@ -982,6 +1872,12 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
     /* take care about feedback timeout */
     if (Timeout > 0)               /* timeout enabled */
     {
+      #ifdef SYSTEM_TICK
+      if (SysTimer_Expired(SYS_TIMER_KEY))   /* deadline reached */
+      {
+        Run = 0;                   /* end loop */
+      }
+      #else
       if (Timeout > DELAY_TICK)    /* some time left */
       {
         Timeout -= DELAY_TICK;     /* decrease timeout */
@@ -990,6 +1886,7 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
       {
         Run = 0;                   /* end loop */
       }
+      #endif
     }
 
 
@@ -998,6 +1895,21 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
      *  - push button is low active
      */
 
+    #ifdef INPUT_QUEUE
+    Test = Key_Get();         /* get queued event of test button */
+
+    if (Test != KEY_NONE)     /* test button pressed */
+    {
+      Key = Test;             /* save key */
+      Run = 0;                /* end loop */
+
+      /* check for second key press if requested */
+      if ((Key == KEY_SHORT) && (Mode & CHECK_KEY_TWICE))
+      {
+        Key = Key_Twice();
+      }
+    }
+    #else
     Test = BUTTON_PIN & (1 << TEST_BUTTON);  /* get button status */
 
     if (Test == 0)            /* test button pressed */
@@ -1059,6 +1971,7 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
         }
       }
     }
+    #endif
     else                      /* no key press */
     {
       /*
@@ -1152,9 +2065,20 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
       #ifdef SERIAL_RW
       if (Cfg.OP_Control & OP_RX_LOCKED)     /* buffer locked */
       {
-        /* we received a command via the serial interface */
-        Key = KEY_COMMAND;         /* remote command */
-        break;                     /* exit loop */
+        #ifdef SW_REMOTE_TOOLS
+        if (UI.RemoteTool)         /* tool run by remote command */
+        {
+          /* process command and get simulated key */
+          Key = Tool_Command();
+          if (Key != KEY_NONE) break;   /* exit loop */
+        }
+        else
+        #endif
+        {
+          /* we received a command via the serial interface */
+          Key = KEY_COMMAND;         /* remote command */
+          break;                     /* exit loop */
+        }
       }
       #endif
 
@@ -1162,9 +2086,66 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
        *  timing
        */
 
+      #ifdef UI_DEEP_SLEEP
+      #ifdef HW_ENCODER
+      if (Sleep && (Steps == 0))        /* not within encoder steps */
+      #else
+      if (Sleep)
+      #endif
+      {
+        /* sleep until user feedback or watchdog timeout */
+        if (DeepSleep())                /* 1s passed */
+        {
+          #ifndef BAT_NONE
+          /* battery monitoring */
+          if (Cfg.BatTimer > 10)        /* more than 1s left */
+          {
+            Cfg.BatTimer -= 10;         /* decrease timeout counter */
+          }
+          else                          /* timeout triggered */
+          {
+            Cfg.BatTimer = 1;           /* keep timeout */
+
+            if (Mode & CHECK_BAT)       /* battery check requested */
+            {
+              CheckBattery();           /* check battery */
+                                        /* also powers off on low battery */
+            }
+          }
+          #endif
+
+          #ifdef POWER_OFF_TIMEOUT
+          /* automatic power-off */
+          if (PwrTimeout > 0)           /* power-off timeout enabled */
+          {
+            if (PwrTimeout > 2)         /* some time left */
+            {
+              PwrTimeout -= 2;          /* decrease counter (2x 500ms) */
+            }
+            else                        /* timeout */
+            {
+              Key = KEY_POWER_OFF;      /* signal power-off */
+              Run = 0;                  /* exit loop */
+            }
+          }
+          #endif
+        }
+
+        /* the delay below debounces a woken up input */
+      }
+      #endif
+
       /* delay for next loop run */
       MilliSleep(DELAY_TICK);           /* wait a little bit */
 
+      #ifdef SYSTEM_TASKS
+      /* background tasks */
+      if (RunTasks(Mode) & TASK_POWER_OFF)   /* auto-power-off */
+      {
+        Key = KEY_POWER_OFF;            /* signal power-off */
+        Run = 0;                        /* exit loop */
+      }
+      #else
       Ticks++;                          /* increase counter */
 
       #ifndef BAT_NONE
@@ -1173,7 +2154,11 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
        *  - for battery monitoring
        */
 
+      #ifdef SYSTEM_TICK
+      if (SysTimer_Expired(SYS_TIMER_BAT))   /* every 100ms */
+      #else
       if (Ticks % DELAY_100 == 0)       /* every 100ms */
+      #endif
       {
         if (Cfg.BatTimer > 1)           /* timeout not zero yet */
         {
@@ -1225,14 +2210,58 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
           {
             PwrTimeout--;               /* decrease counter */
           }
-          else                          /* timeout */
+          else                          /* timeout */
+          {
+            Key = KEY_POWER_OFF;        /* signal power-off */
+            Run = 0;                    /* exit loop */
+          }
+        }
+        #endif
+      }
+      #endif
+
+      #ifdef UI_PART_DETECT
+      /*
+       *  part detection
+       *  - probes have to be open first and then a part has to be
+       *    connected, each for PART_STABLE checks in a row
+       */
+
+      if (Mode & CHECK_PART)            /* part detection requested */
+      {
+        PartTicks++;                    /* increase counter */
+
+        if (PartTicks >= (PART_POLL / DELAY_TICK))    /* time to check */
+        {
+          PartTicks = 0;                /* reset counter */
+          Test = PartPresent();         /* check probes */
+
+          if (Test == PartOpen)         /* change we're waiting for */
+          {
+            PartCount++;                /* one more in a row */
+
+            if (PartCount >= PART_STABLE)    /* stable state */
+            {
+              PartCount = 0;            /* reset counter */
+
+              if (PartOpen)             /* new part */
+              {
+                Key = KEY_PROBE;        /* probe part */
+                Run = 0;                /* exit loop */
+              }
+              else                      /* probes open */
+              {
+                PartOpen = 1;           /* now wait for new part */
+              }
+            }
+          }
+          else                          /* no or undecided change */
           {
-            Key = KEY_POWER_OFF;        /* signal power-off */
-            Run = 0;                    /* exit loop */
+            PartCount = 0;              /* reset counter */
           }
         }
-        #endif
       }
+      #endif
     }
 
     /* check if we should exit anyway */
@@ -1447,6 +2476,8 @@ void MarkItem(uint8_t Item, uint8_t Selected)
  *  menu tool
  *  - expects title in first line
  *  - outputs menu starting in second line
+ *  - redraws items only when the list window changes, otherwise just
+ *    updates the indicators of the formerly and newly selected item
  *
  *  requires:
  *  - Items: number of menu items
@@ -1464,6 +2495,7 @@ uint8_t MenuTool(uint8_t Items, uint8_t Type, void *Menu[], unsigned char *Unit)
 {
   uint8_t           Selected = 0;       /* return value / selected item */
   uint8_t           First = 0;          /* first item listed */
+  uint8_t           Old = 0;            /* formerly selected item */
   uint8_t           Run = 2;            /* loop control flag */
   uint8_t           Lines;              /* line number */
   uint8_t           n;                  /* temp value */
@@ -1505,21 +2537,21 @@ uint8_t MenuTool(uint8_t Items, uint8_t Type, void *Menu[], unsigned char *Unit)
      *  - starting in line #2
      */
 
-    Address = &Menu[First];        /* get address of first item */
-    n = 0;                         /* reset counter */
-
-    while (n < Lines)
+    if (Run > 1)                   /* list changed */
     {
-      LCD_CharPos(1, n + 2);       /* move to start of line */
+      Address = &Menu[First];      /* get address of first item */
+      n = 0;                       /* reset counter */
 
-      /* display indicator for multiline displays */
-      if (Lines > 1)
+      while (n < Lines)
       {
-        MarkItem(First + n, Selected);
-      }
+        LCD_CharPos(1, n + 2);     /* move to start of line */
+
+        /* display indicator for multiline displays */
+        if (Lines > 1)
+        {
+          MarkItem(First + n, Selected);
+        }
 
-      if (Run > 1)            /* list changed */
-      {
         /* display item or value */
         if (Type == 1)                  /* fixed string */
         {
@@ -1537,15 +2569,28 @@ uint8_t MenuTool(uint8_t Items, uint8_t Type, void *Menu[], unsigned char *Unit)
           Display_EEString(Unit);
         }  
 
-        LCD_ClearLine(0);     /* clear rest of this line */
-      }
+        LCD_ClearLine(0);          /* clear rest of this line */
 
-      Address += 2;                /* next address (2 byte steps) */
-      n++;                         /* next item */
+        Address += 2;              /* next address (2 byte steps) */
+        n++;                       /* next item */
 
-      if (n > Items) n = Lines;    /* end loop for a short list */
+        if (n > Items) n = Lines;  /* end loop for a short list */
+      }
+    }
+    else                           /* just selection changed */
+    {
+      /*
+       *  update indicators of formerly and newly selected item
+       *  - both are within the listed items
+       */
+
+      LCD_CharPos(1, Old - First + 2);       /* line of former item */
+      MarkItem(Old, Selected);               /* unmark */
+      LCD_CharPos(1, Selected - First + 2);  /* line of new item */
+      MarkItem(Selected, Selected);          /* mark */
     }
 
+    Old = Selected;      /* save selection */
     Run = 1;             /* reset loop flag (changed list) */
 
     /* show navigation help for 2-line displays */
@@ -1808,6 +2853,88 @@ void AdjustmentMenu(uint8_t Mode)
 
 
 
+#ifdef UI_PRESETS
+
+/*
+ *  preset menu
+ *  - select measurement preset
+ *  - offer to save profile when preset is changed
+ */
+
+void PresetMenu(void)
+{
+  void              *Item_Str[2];       /* menu item strings */
+  uint8_t           ID;                 /* ID of selected item */
+
+  /* set up menu (item position matches preset ID) */
+  Item_Str[PRESET_FULL] = (void *)PresetFull_str;
+  Item_Str[PRESET_FAST] = (void *)PresetFast_str;
+
+  /* display title */
+  LCD_Clear();                     /* clear display */
+  #ifdef UI_COLORED_TITLES
+    Display_ColoredEEString(Preset_str, COLOR_TITLE);  /* display: Preset */
+  #else
+    Display_EEString(Preset_str);                      /* display: Preset */
+  #endif
+
+  /* run menu */
+  ID = MenuTool(2, 1, Item_Str, NULL);  /* menu dialog */
+
+  if (ID != NV.Preset)             /* preset changed */
+  {
+    NV.Preset = ID;                /* set new preset */
+
+    /* offer to save profile (only changed bytes are written) */
+    AdjustmentMenu(STORAGE_SAVE);
+  }
+}
+
+#endif
+
+
+
+#ifdef UI_ENGLISH_2ND
+
+/*
+ *  language menu
+ *  - select UI language
+ *  - offer to save profile when language is changed
+ */
+
+void LanguageMenu(void)
+{
+  void              *Item_Str[2];       /* menu item strings */
+  uint8_t           ID;                 /* ID of selected item */
+
+  /* set up menu (item position matches language ID) */
+  Item_Str[LANGUAGE_1ST] = (void *)LangName_str;
+  Item_Str[LANGUAGE_2ND] = (void *)LangName_2nd_str;
+
+  /* display title */
+  LCD_Clear();                     /* clear display */
+  #ifdef UI_COLORED_TITLES
+    Display_ColoredEEString(Language_str, COLOR_TITLE);  /* display: Language */
+  #else
+    Display_EEString(Language_str);                      /* display: Language */
+  #endif
+
+  /* run menu */
+  ID = MenuTool(2, 1, Item_Str, NULL);  /* menu dialog */
+
+  if (ID != NV.Language)           /* language changed */
+  {
+    NV.Language = ID;              /* set new language */
+
+    /* offer to save profile (only changed bytes are written) */
+    AdjustmentMenu(STORAGE_SAVE);
+  }
+}
+
+#endif
+
+
+
 /*
  *  local constants for main menu
  */
@@ -1853,6 +2980,25 @@ void AdjustmentMenu(uint8_t Mode)
 #define MENUITEM_FLASHLIGHT       37
 #define MENUITEM_DS18S20          38
 #define MENUITEM_PHOTODIODE       39
+#define MENUITEM_SCOPE            40
+#define MENUITEM_SORTING          41
+#define MENUITEM_COMPARE          42
+#define MENUITEM_TWEEZERS         43
+#define MENUITEM_CURVE            44
+#define MENUITEM_MATCHING         45
+#define MENUITEM_DISPLAY_BENCH    46
+#define MENUITEM_DDS              47
+#define MENUITEM_I2C_SCAN         48
+#define MENUITEM_HISTORY          49
+#define MENUITEM_LOGGER           50
+#define MENUITEM_LEAD_ADJUST      51
+#define MENUITEM_MEMORY           52
+#define MENUITEM_REPEAT           53
+#define MENUITEM_PRESET           54
+#define MENUITEM_LANGUAGE         55
+#define MENUITEM_LED_BINNING      56
+#define MENUITEM_CRYSTAL_RING     57
+#define MENUITEM_PERF             58
 
 
 /*
@@ -2074,14 +3220,130 @@ uint8_t PresentMainMenu(void)
     #define ITEM_34      0
   #endif
 
+  #ifdef SW_SCOPE
+    #define ITEM_35      1
+  #else
+    #define ITEM_35      0
+  #endif
+
+  #ifdef SW_SORTING
+    #define ITEM_36      1
+  #else
+    #define ITEM_36      0
+  #endif
+
+  #ifdef SW_COMPARE
+    #define ITEM_37      1
+  #else
+    #define ITEM_37      0
+  #endif
+
+  #ifdef UI_TWEEZERS
+    #define ITEM_38      1
+  #else
+    #define ITEM_38      0
+  #endif
+
+  #ifdef SW_CURVE_TRACER
+    #define ITEM_39      1
+  #else
+    #define ITEM_39      0
+  #endif
+
+  #ifdef SW_MATCHING
+    #define ITEM_40      1
+  #else
+    #define ITEM_40      0
+  #endif
+
+  #ifdef SW_DISPLAY_BENCH
+    #define ITEM_41      1
+  #else
+    #define ITEM_41      0
+  #endif
+
+  #ifdef SW_DDS
+    #define ITEM_42      1
+  #else
+    #define ITEM_42      0
+  #endif
+
+  #ifdef SW_I2C_SCAN
+    #define ITEM_43      1
+  #else
+    #define ITEM_43      0
+  #endif
+
+  #ifdef SW_HISTORY
+    #define ITEM_44      1
+  #else
+    #define ITEM_44      0
+  #endif
+
+  #ifdef SW_LOGGER
+    #define ITEM_45      1
+  #else
+    #define ITEM_45      0
+  #endif
+
+  #ifdef SW_LEAD_ADJUST
+    #define ITEM_46      1
+  #else
+    #define ITEM_46      0
+  #endif
+
+  #ifdef SW_STACK_CHECK
+    #define ITEM_47      1
+  #else
+    #define ITEM_47      0
+  #endif
+
+  #ifdef SW_REPEAT_STATS
+    #define ITEM_48      1
+  #else
+    #define ITEM_48      0
+  #endif
+
+  #ifdef UI_PRESETS
+    #define ITEM_49      1
+  #else
+    #define ITEM_49      0
+  #endif
+
+  #ifdef UI_ENGLISH_2ND
+    #define ITEM_50      1
+  #else
+    #define ITEM_50      0
+  #endif
+
+  #ifdef SW_LED_BINNING
+    #define ITEM_51      1
+  #else
+    #define ITEM_51      0
+  #endif
+
+  #ifdef CRYSTAL_RINGDOWN
+    #define ITEM_52      1
+  #else
+    #define ITEM_52      0
+  #endif
+
+  #ifdef SW_PERF_COUNTERS
+    #define ITEM_53      1
+  #else
+    #define ITEM_53      0
+  #endif
+
 
   #define ITEMS_PACK_0   (ITEM_01 + ITEM_02 + ITEM_03 + ITEM_04 + ITEM_05 + ITEM_06 + ITEM_07 + ITEM_08 + ITEM_09 + ITEM_10)
   #define ITEMS_PACK_1   (ITEM_11 + ITEM_12 + ITEM_13 + ITEM_14 + ITEM_15 + ITEM_16 + ITEM_17 + ITEM_18 + ITEM_19 + ITEM_20)
   #define ITEMS_PACK_2   (ITEM_21 + ITEM_22 + ITEM_23 + ITEM_24 + ITEM_25 + ITEM_26 + ITEM_27 + ITEM_28 + ITEM_29 + ITEM_30)
-  #define ITEMS_PACK_3   (ITEM_31 + ITEM_32 + ITEM_33 + ITEM_34)
+  #define ITEMS_PACK_3   (ITEM_31 + ITEM_32 + ITEM_33 + ITEM_34 + ITEM_35 + ITEM_36 + ITEM_37 + ITEM_38 + ITEM_39 + ITEM_40)
+  #define ITEMS_PACK_4   (ITEM_41 + ITEM_42 + ITEM_43 + ITEM_44 + ITEM_45 + ITEM_46 + ITEM_47 + ITEM_48 + ITEM_49 + ITEM_50)
+  #define ITEMS_PACK_5   (ITEM_51 + ITEM_52 + ITEM_53)
 
   /* number of menu items */
-  #define MENU_ITEMS     (ITEMS_BASIC + ITEMS_PACK_0 + ITEMS_PACK_1 + ITEMS_PACK_2 + ITEMS_PACK_3)
+  #define MENU_ITEMS     (ITEMS_BASIC + ITEMS_PACK_0 + ITEMS_PACK_1 + ITEMS_PACK_2 + ITEMS_PACK_3 + ITEMS_PACK_4 + ITEMS_PACK_5)
 
 
   /*
@@ -2117,6 +3379,13 @@ uint8_t PresentMainMenu(void)
   n++;
   #endif
 
+  #ifdef SW_DDS
+  /* DDS signal generator */
+  Item_Str[n] = (void *)DDS_str;
+  Item_ID[n] = MENUITEM_DDS;
+  n++;
+  #endif
+
   #ifdef HW_ZENER
   /* Zener tool */
   Item_Str[n] = (void *)Zener_str;
@@ -2187,6 +3456,55 @@ uint8_t PresentMainMenu(void)
   n++;
   #endif
 
+  #ifdef SW_SORTING
+  /* sorting tool */
+  Item_Str[n] = (void *)Sorting_str;
+  Item_ID[n] = MENUITEM_SORTING;
+  n++;
+  #endif
+
+  #ifdef SW_LED_BINNING
+  /* LED binning tool */
+  Item_Str[n] = (void *)LED_Binning_str;
+  Item_ID[n] = MENUITEM_LED_BINNING;
+  n++;
+  #endif
+
+  #ifdef SW_COMPARE
+  /* compare tool */
+  Item_Str[n] = (void *)Compare_str;
+  Item_ID[n] = MENUITEM_COMPARE;
+  n++;
+  #endif
+
+  #ifdef SW_MATCHING
+  /* matching tool */
+  Item_Str[n] = (void *)Matching_str;
+  Item_ID[n] = MENUITEM_MATCHING;
+  n++;
+  #endif
+
+  #ifdef SW_HISTORY
+  /* measurement history */
+  Item_Str[n] = (void *)History_str;
+  Item_ID[n] = MENUITEM_HISTORY;
+  n++;
+  #endif
+
+  #ifdef SW_REPEAT_STATS
+  /* repeat measurement */
+  Item_Str[n] = (void *)Repeat_str;
+  Item_ID[n] = MENUITEM_REPEAT;
+  n++;
+  #endif
+
+  #ifdef SW_LOGGER
+  /* data logger */
+  Item_Str[n] = (void *)Logger_str;
+  Item_ID[n] = MENUITEM_LOGGER;
+  n++;
+  #endif
+
   #ifdef HW_LC_METER
   /* LC meter */
   Item_Str[n] = (void *)LC_Meter_str;
@@ -2208,6 +3526,13 @@ uint8_t PresentMainMenu(void)
   n++;
   #endif
 
+  #ifdef CRYSTAL_RINGDOWN
+  /* crystal ringdown test */
+  Item_Str[n] = (void *)CrystalRing_str;
+  Item_ID[n] = MENUITEM_CRYSTAL_RING;
+  n++;
+  #endif
+
   #ifdef HW_EVENT_COUNTER
   /* event counter */
   Item_Str[n] = (void *)EventCounter_str;
@@ -2250,6 +3575,20 @@ uint8_t PresentMainMenu(void)
   n++;
   #endif
 
+  #ifdef SW_SCOPE
+  /* scope */
+  Item_Str[n] = (void *)Scope_str;
+  Item_ID[n] = MENUITEM_SCOPE;
+  n++;
+  #endif
+
+  #ifdef SW_CURVE_TRACER
+  /* I-V curve tracer */
+  Item_Str[n] = (void *)Curve_str;
+  Item_ID[n] = MENUITEM_CURVE;
+  n++;
+  #endif
+
   #ifdef SW_SERVO
   /* servo check */
   Item_Str[n] = (void *)Servo_str;
@@ -2264,6 +3603,13 @@ uint8_t PresentMainMenu(void)
   n++;
   #endif
 
+  #ifdef SW_I2C_SCAN
+  /* I2C scan tool */
+  Item_Str[n] = (void *)I2C_Scan_str;
+  Item_ID[n] = MENUITEM_I2C_SCAN;
+  n++;
+  #endif
+
   #ifdef SW_DS18B20
   /* DS18B20 sensor */
   Item_Str[n] = (void *)DS18B20_str;
@@ -2306,6 +3652,13 @@ uint8_t PresentMainMenu(void)
   n++;  
   #endif
 
+  #ifdef UI_TWEEZERS
+  /* two-terminal mode */
+  Item_Str[n] = (void *)Tweezers_str;
+  Item_ID[n] = MENUITEM_TWEEZERS;
+  n++;
+  #endif
+
 
   /*
    *  tester management and settings
@@ -2321,6 +3674,13 @@ uint8_t PresentMainMenu(void)
   Item_ID[n] = MENUITEM_ADJUSTMENT;
   n++;
 
+  #ifdef SW_LEAD_ADJUST
+  /* adjustment of lead offsets */
+  Item_Str[n] = (void *)LeadAdjust_str;
+  Item_ID[n] = MENUITEM_LEAD_ADJUST;
+  n++;
+  #endif
+
   #ifdef SW_CONTRAST
   /* LCD contrast */
   Item_Str[n] = (void *)Contrast_str;
@@ -2335,6 +3695,20 @@ uint8_t PresentMainMenu(void)
   n++;
   #endif
 
+  #ifdef UI_PRESETS
+  /* measurement preset */
+  Item_Str[n] = (void *)Preset_str;
+  Item_ID[n] = MENUITEM_PRESET;
+  n++;
+  #endif
+
+  #ifdef UI_ENGLISH_2ND
+  /* UI language */
+  Item_Str[n] = (void *)Language_str;
+  Item_ID[n] = MENUITEM_LANGUAGE;
+  n++;
+  #endif
+
   /* save self-adjustment values */
   Item_Str[n] = (void *)Save_str;
   Item_ID[n] = MENUITEM_SAVE;
@@ -2350,6 +3724,20 @@ uint8_t PresentMainMenu(void)
   Item_ID[n] = MENUITEM_SHOW;
   n++;
 
+  #ifdef SW_STACK_CHECK
+  /* SRAM usage */
+  Item_Str[n] = (void *)Memory_str;
+  Item_ID[n] = MENUITEM_MEMORY;
+  n++;
+  #endif
+
+  #ifdef SW_PERF_COUNTERS
+  /* performance counters */
+  Item_Str[n] = (void *)Perf_str;
+  Item_ID[n] = MENUITEM_PERF;
+  n++;
+  #endif
+
   #ifdef SW_FONT_TEST
   /* font test */
   Item_Str[n] = (void *)FontTest_str;
@@ -2364,6 +3752,13 @@ uint8_t PresentMainMenu(void)
   n++;
   #endif
 
+  #ifdef SW_DISPLAY_BENCH
+  /* display benchmark */
+  Item_Str[n] = (void *)DisplayBench_str;
+  Item_ID[n] = MENUITEM_DISPLAY_BENCH;
+  n++;
+  #endif
+
   #ifdef SW_POWER_OFF
   /* power off tester */
   Item_Str[n] = (void *)PowerOff_str;
@@ -2399,6 +3794,8 @@ uint8_t PresentMainMenu(void)
   #undef ITEMS_PACK_1
   #undef ITEMS_PACK_2
   #undef ITEMS_PACK_3
+  #undef ITEMS_PACK_4
+  #undef ITEMS_PACK_5
 
   #undef ITEM_01
   #undef ITEM_02
@@ -2434,6 +3831,25 @@ uint8_t PresentMainMenu(void)
   #undef ITEM_32
   #undef ITEM_33
   #undef ITEM_34
+  #undef ITEM_35
+  #undef ITEM_36
+  #undef ITEM_37
+  #undef ITEM_38
+  #undef ITEM_39
+  #undef ITEM_40
+  #undef ITEM_41
+  #undef ITEM_42
+  #undef ITEM_43
+  #undef ITEM_44
+  #undef ITEM_45
+  #undef ITEM_46
+  #undef ITEM_47
+  #undef ITEM_48
+  #undef ITEM_49
+  #undef ITEM_50
+  #undef ITEM_51
+  #undef ITEM_52
+  #undef ITEM_53
 
   return(ID);                 /* return item ID */
 }
@@ -2457,6 +3873,14 @@ uint8_t MainMenu(void)
   uint16_t          Frequency;          /* PWM frequency */  
   #endif
 
+  #ifdef SW_REMOTE_TOOLS
+  if (UI.RemoteTool)          /* tool selected by remote command */
+  {
+    ID = UI.RemoteTool;       /* skip menu */
+    Serial_Ctrl(SER_RX_RESUME);    /* receive commands while tool runs */
+  }
+  else
+  #endif
   ID = PresentMainMenu();     /* create menu and get user feedback */
 
   #ifdef POWER_OFF_TIMEOUT
@@ -2482,7 +3906,7 @@ uint8_t MainMenu(void)
 
     /* self-test */
     case MENUITEM_SELFTEST:
-      Flag = SelfTest();
+      Flag = SelfTest(SELFTEST_DISPLAY);
       break;
 
     /* self-adjustment */
@@ -2490,6 +3914,18 @@ uint8_t MainMenu(void)
       Flag = SelfAdjustment();
       break;
 
+    #ifdef SW_LEAD_ADJUST
+    /* adjustment of lead offsets */
+    case MENUITEM_LEAD_ADJUST:
+      Flag = LeadAdjustment();
+      if (Flag)                    /* success */
+      {
+        /* offer to save offsets (only changed bytes are written) */
+        AdjustmentMenu(STORAGE_SAVE);
+      }
+      break;
+    #endif
+
     /* save adjustment values */
     case MENUITEM_SAVE:
       AdjustmentMenu(STORAGE_SAVE);
@@ -2536,6 +3972,13 @@ uint8_t MainMenu(void)
       break;
     #endif
 
+    #ifdef SW_DDS
+    /* DDS signal generator */
+    case MENUITEM_DDS:
+      DDS_Generator();
+      break;
+    #endif
+
     #ifdef HW_ZENER
     /* Zener tool */
     case MENUITEM_ZENER:
@@ -2599,6 +4042,20 @@ uint8_t MainMenu(void)
       break;
     #endif
 
+    #ifdef UI_PRESETS
+    /* measurement preset */
+    case MENUITEM_PRESET:
+      PresetMenu();
+      break;
+    #endif
+
+    #ifdef UI_ENGLISH_2ND
+    /* UI language */
+    case MENUITEM_LANGUAGE:
+      LanguageMenu();
+      break;
+    #endif
+
     #ifdef SW_IR_TRANSMITTER
     /* IR RC transmitter */
     case MENUITEM_IR_TRANSMITTER:
@@ -2662,6 +4119,13 @@ uint8_t MainMenu(void)
       break;
     #endif
 
+    #ifdef SW_I2C_SCAN
+    /* I2C scan tool */
+    case MENUITEM_I2C_SCAN:
+      I2C_Scan_Tool();
+      break;
+    #endif
+
     #ifdef SW_FONT_TEST
     /* font test */
     case MENUITEM_FONT_TEST:
@@ -2704,6 +4168,13 @@ uint8_t MainMenu(void)
       break;
     #endif
 
+    #ifdef CRYSTAL_RINGDOWN
+    /* crystal ringdown test */
+    case MENUITEM_CRYSTAL_RING:
+      CrystalRingdown();
+      break;
+    #endif
+
     #ifdef HW_LOGIC_PROBE
     /* logic probe */
     case MENUITEM_LOGIC_PROBE:
@@ -2739,6 +4210,20 @@ uint8_t MainMenu(void)
       break;
     #endif
 
+    #ifdef SW_DISPLAY_BENCH
+    /* display benchmark */
+    case MENUITEM_DISPLAY_BENCH:
+      DisplayBench();
+      break;
+    #endif
+
+    #ifdef SW_STACK_CHECK
+    /* SRAM usage */
+    case MENUITEM_MEMORY:
+      Memory_Tool();
+      break;
+    #endif
+
     #ifdef HW_FLASHLIGHT
     /* flashlight / general purpose switched output */
     case MENUITEM_FLASHLIGHT:
@@ -2759,6 +4244,91 @@ uint8_t MainMenu(void)
       PhotodiodeCheck();
       break;
     #endif
+
+    #ifdef SW_SCOPE
+    /* scope */
+    case MENUITEM_SCOPE:
+      Scope_Tool();
+      break;
+    #endif
+
+    #ifdef SW_SORTING
+    /* sorting tool */
+    case MENUITEM_SORTING:
+      Sorting_Tool();
+      break;
+    #endif
+
+    #ifdef SW_LED_BINNING
+    /* LED binning tool */
+    case MENUITEM_LED_BINNING:
+      LED_Binning_Tool();
+      break;
+    #endif
+
+    #ifdef SW_COMPARE
+    /* compare tool */
+    case MENUITEM_COMPARE:
+      Compare_Tool();
+      break;
+    #endif
+
+    #ifdef UI_TWEEZERS
+    /* two-terminal mode */
+    case MENUITEM_TWEEZERS:
+      Cfg.OP_Mode ^= OP_TWEEZERS;       /* toggle mode */
+      Flag = KEY_EXIT;                  /* back to probing */
+      break;
+    #endif
+
+    #ifdef SW_CURVE_TRACER
+    /* I-V curve tracer */
+    case MENUITEM_CURVE:
+      CurveTracer_Tool();
+      break;
+    #endif
+
+    #ifdef SW_MATCHING
+    /* matching tool */
+    case MENUITEM_MATCHING:
+      Matching_Tool();
+      break;
+    #endif
+
+    #ifdef SW_HISTORY
+    /* measurement history */
+    case MENUITEM_HISTORY:
+      History_Tool();
+      break;
+    #endif
+
+    #ifdef SW_REPEAT_STATS
+    /* repeat measurement */
+    case MENUITEM_REPEAT:
+      Repeat_Tool();
+      break;
+    #endif
+
+    #ifdef SW_LOGGER
+    /* data logger */
+    case MENUITEM_LOGGER:
+      Logger_Tool();
+      break;
+    #endif
+
+    #ifdef SW_REMOTE_TOOLS
+    /* unsupported item ID sent by remote command */
+    default:
+      Flag = 0;               /* signal error */
+      break;
+    #endif
+
+    #ifdef SW_PERF_COUNTERS
+    /* performance counters */
+    case MENUITEM_PERF:
+      Perf_Tool();
+      break;
+    #endif
   }
 
   #ifdef POWER_OFF_TIMEOUT
@@ -2769,6 +4339,14 @@ uint8_t MainMenu(void)
   }
   #endif
 
+  #ifdef SW_REMOTE_TOOLS
+  if (UI.RemoteTool)          /* tool run by remote command */
+  {
+    Tool_Done(Flag);          /* send completion message */
+    Flag = KEY_EXIT;          /* return to probing cycle */
+  }
+  #endif
+
 
   /*
    *  display result
@@ -2870,6 +4448,25 @@ uint8_t MainMenu(void)
 #undef MENUITEM_FLASHLIGHT
 #undef MENUITEM_DS18S20
 #undef MENUITEM_PHOTODIODE
+#undef MENUITEM_SCOPE
+#undef MENUITEM_SORTING
+#undef MENUITEM_COMPARE
+#undef MENUITEM_TWEEZERS
+#undef MENUITEM_CURVE
+#undef MENUITEM_MATCHING
+#undef MENUITEM_DISPLAY_BENCH
+#undef MENUITEM_DDS
+#undef MENUITEM_I2C_SCAN
+#undef MENUITEM_HISTORY
+#undef MENUITEM_LOGGER
+#undef MENUITEM_LEAD_ADJUST
+#undef MENUITEM_MEMORY
+#undef MENUITEM_REPEAT
+#undef MENUITEM_PRESET
+#undef MENUITEM_LANGUAGE
+#undef MENUITEM_LED_BINNING
+#undef MENUITEM_CRYSTAL_RING
+#undef MENUITEM_PERF
 
 
 
@@ -2878,6 +4475,17 @@ uint8_t MainMenu(void)
  * ************************************************************************ */
 
 
+/* local constants */
+#ifdef UI_DEEP_SLEEP
+  #undef BTN_PCINT
+  #undef BTN_PC_IRQ
+  #undef BTN_PC_MASK
+  #undef BTN_PINCHANGE
+  #ifdef BTN_SHARED_ISR
+    #undef BTN_SHARED_ISR
+  #endif
+#endif
+
 /* source management */
 #undef USER_C
 
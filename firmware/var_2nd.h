@@ -0,0 +1,490 @@
+/* ************************************************************************
+ *
+ *   second language selectable at runtime: English
+ *
+ *   (c) 2012-2023 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/*
+ *  hints:
+ *  - included twice by variables.h
+ *  - VAR_2ND_RENAME: rename English strings to *_2nd_str before
+ *    var_english.h is included a second time
+ *  - VAR_2ND_SELECT: declare renamed strings and replace each language
+ *    specific string by a runtime selection based on NV.Language
+ *  - LangName_str isn't replaced, since the language menu needs the names
+ *    of both languages
+ *  - keep in sync with the strings of the var_*.h files
+ */
+
+
+/*
+ *  rename English strings
+ */
+
+#if defined (VAR_2ND_RENAME)
+  #define Tester_str               Tester_2nd_str
+  #define Probing_str              Probing_2nd_str
+  #define Timeout_str              Timeout_2nd_str
+  #define Failed1_str              Failed1_2nd_str
+  #define Failed2_str              Failed2_2nd_str
+  #define Done_str                 Done_2nd_str
+  #define Select_str               Select_2nd_str
+  #define Selftest_str             Selftest_2nd_str
+  #define Adjustment_str           Adjustment_2nd_str
+  #define Save_str                 Save_2nd_str
+  #define Load_str                 Load_2nd_str
+  #define Show_str                 Show_2nd_str
+  #define Remove_str               Remove_2nd_str
+  #define Create_str               Create_2nd_str
+  #define ShortCircuit_str         ShortCircuit_2nd_str
+  #define DischargeFailed_str      DischargeFailed_2nd_str
+  #define Error_str                Error_2nd_str
+  #define Exit_str                 Exit_2nd_str
+  #define Checksum_str             Checksum_2nd_str
+  #define BJT_str                  BJT_2nd_str
+  #define Thyristor_str            Thyristor_2nd_str
+  #define Triac_str                Triac_2nd_str
+  #define PUT_str                  PUT_2nd_str
+  #define Bye_str                  Bye_2nd_str
+  #define Hertz_str                Hertz_2nd_str
+  #define Battery_str              Battery_2nd_str
+  #define OK_str                   OK_2nd_str
+  #define Weak_str                 Weak_2nd_str
+  #define Low_str                  Low_2nd_str
+  #define External_str             External_2nd_str
+  #define Menu_or_Test_str         Menu_or_Test_2nd_str
+  #define PWM_str                  PWM_2nd_str
+  #define SquareWave_str           SquareWave_2nd_str
+  #define Zener_str                Zener_2nd_str
+  #define Min_str                  Min_2nd_str
+  #define FreqCounter_str          FreqCounter_2nd_str
+  #define CounterChannel_str       CounterChannel_2nd_str
+  #define FreqInput_str            FreqInput_2nd_str
+  #define LF_Crystal_str           LF_Crystal_2nd_str
+  #define HF_Crystal_str           HF_Crystal_2nd_str
+  #define RingTester_str           RingTester_2nd_str
+  #define RingPass_str             RingPass_2nd_str
+  #define RingFail_str             RingFail_2nd_str
+  #define EventCounter_str         EventCounter_2nd_str
+  #define Count_str                Count_2nd_str
+  #define Time_str                 Time_2nd_str
+  #define Events_str               Events_2nd_str
+  #define Stop_str                 Stop_2nd_str
+  #define LC_Meter_str             LC_Meter_2nd_str
+  #define Adjusting_str            Adjusting_2nd_str
+  #define LogicProbe_str           LogicProbe_2nd_str
+  #define Encoder_str              Encoder_2nd_str
+  #define TurnRight_str            TurnRight_2nd_str
+  #define Contrast_str             Contrast_2nd_str
+  #define IR_Detector_str          IR_Detector_2nd_str
+  #define IR_Transmitter_str       IR_Transmitter_2nd_str
+  #define IR_Send_str              IR_Send_2nd_str
+  #define OptoCoupler_str          OptoCoupler_2nd_str
+  #define None_str                 None_2nd_str
+  #define CTR_str                  CTR_2nd_str
+  #define Start_str                Start_2nd_str
+  #define UJT_str                  UJT_2nd_str
+  #define Servo_str                Servo_2nd_str
+  #define Sweep_str                Sweep_2nd_str
+  #define ServoAuto_str            ServoAuto_2nd_str
+  #define CapLeak_str              CapLeak_2nd_str
+  #define CapCharge_str            CapCharge_2nd_str
+  #define CapHigh_str              CapHigh_2nd_str
+  #define CapLow_str               CapLow_2nd_str
+  #define CapDischarge_str         CapDischarge_2nd_str
+  #define Monitor_R_str            Monitor_R_2nd_str
+  #define Monitor_C_str            Monitor_C_2nd_str
+  #define Monitor_L_str            Monitor_L_2nd_str
+  #define Monitor_RCL_str          Monitor_RCL_2nd_str
+  #define Monitor_RL_str           Monitor_RL_2nd_str
+  #define TouchSetup_str           TouchSetup_2nd_str
+  #define PowerOff_str             PowerOff_2nd_str
+  #define OneWire_Scan_str         OneWire_Scan_2nd_str
+  #define Bus_str                  Bus_2nd_str
+  #define ContinuityCheck_str      ContinuityCheck_2nd_str
+  #define FontTest_str             FontTest_2nd_str
+  #define SymbolTest_str           SymbolTest_2nd_str
+  #define DisplayBench_str         DisplayBench_2nd_str
+  #define Flashlight_str           Flashlight_2nd_str
+  #define Photodiode_str           Photodiode_2nd_str
+  #define NoBias_str               NoBias_2nd_str
+  #define ReverseBias_str          ReverseBias_2nd_str
+  #define Scope_str                Scope_2nd_str
+  #define Rising_str               Rising_2nd_str
+  #define Falling_str              Falling_2nd_str
+  #define Discharge_str            Discharge_2nd_str
+  #define Sorting_str              Sorting_2nd_str
+  #define Compare_str              Compare_2nd_str
+  #define Pass_str                 Pass_2nd_str
+  #define Tweezers_str             Tweezers_2nd_str
+  #define Curve_str                Curve_2nd_str
+  #define Matching_str             Matching_2nd_str
+  #define History_str              History_2nd_str
+  #define Repeat_str               Repeat_2nd_str
+  #define Logger_str               Logger_2nd_str
+  #define LeadAdjust_str           LeadAdjust_2nd_str
+  #define Memory_str               Memory_2nd_str
+  #define Perf_str                 Perf_2nd_str
+  #define Preset_str               Preset_2nd_str
+  #define PresetFull_str           PresetFull_2nd_str
+  #define PresetFast_str           PresetFast_2nd_str
+  #define Language_str             Language_2nd_str
+  #define LangName_str             LangName_2nd_str
+  #define LED_Binning_str          LED_Binning_2nd_str
+  #define CrystalRing_str          CrystalRing_2nd_str
+#endif
+
+
+
+/*
+ *  runtime selection
+ */
+
+#if defined (VAR_2ND_SELECT)
+
+  /* selected language */
+  #define LANG_2ND            (NV.Language == LANGUAGE_2ND)
+
+  /* renamed English strings */
+  extern const unsigned char Tester_2nd_str[];
+  extern const unsigned char Probing_2nd_str[];
+  extern const unsigned char Timeout_2nd_str[];
+  extern const unsigned char Failed1_2nd_str[];
+  extern const unsigned char Failed2_2nd_str[];
+  extern const unsigned char Done_2nd_str[];
+  extern const unsigned char Select_2nd_str[];
+  extern const unsigned char Selftest_2nd_str[];
+  extern const unsigned char Adjustment_2nd_str[];
+  extern const unsigned char Save_2nd_str[];
+  extern const unsigned char Load_2nd_str[];
+  extern const unsigned char Show_2nd_str[];
+  extern const unsigned char Remove_2nd_str[];
+  extern const unsigned char Create_2nd_str[];
+  extern const unsigned char ShortCircuit_2nd_str[];
+  extern const unsigned char DischargeFailed_2nd_str[];
+  extern const unsigned char Error_2nd_str[];
+  extern const unsigned char Exit_2nd_str[];
+  extern const unsigned char Checksum_2nd_str[];
+  extern const unsigned char BJT_2nd_str[];
+  extern const unsigned char Thyristor_2nd_str[];
+  extern const unsigned char Triac_2nd_str[];
+  extern const unsigned char PUT_2nd_str[];
+  extern const unsigned char Bye_2nd_str[];
+  extern const unsigned char Hertz_2nd_str[];
+  extern const unsigned char Battery_2nd_str[];
+  extern const unsigned char OK_2nd_str[];
+  extern const unsigned char Weak_2nd_str[];
+  extern const unsigned char Low_2nd_str[];
+  extern const unsigned char External_2nd_str[];
+  extern const unsigned char Menu_or_Test_2nd_str[];
+  extern const unsigned char PWM_2nd_str[];
+  extern const unsigned char SquareWave_2nd_str[];
+  extern const unsigned char Zener_2nd_str[];
+  extern const unsigned char Min_2nd_str[];
+  extern const unsigned char FreqCounter_2nd_str[];
+  extern const unsigned char CounterChannel_2nd_str[];
+  extern const unsigned char FreqInput_2nd_str[];
+  extern const unsigned char LF_Crystal_2nd_str[];
+  extern const unsigned char HF_Crystal_2nd_str[];
+  extern const unsigned char RingTester_2nd_str[];
+  extern const unsigned char RingPass_2nd_str[];
+  extern const unsigned char RingFail_2nd_str[];
+  extern const unsigned char EventCounter_2nd_str[];
+  extern const unsigned char Count_2nd_str[];
+  extern const unsigned char Time_2nd_str[];
+  extern const unsigned char Events_2nd_str[];
+  extern const unsigned char Stop_2nd_str[];
+  extern const unsigned char LC_Meter_2nd_str[];
+  extern const unsigned char Adjusting_2nd_str[];
+  extern const unsigned char LogicProbe_2nd_str[];
+  extern const unsigned char Encoder_2nd_str[];
+  extern const unsigned char TurnRight_2nd_str[];
+  extern const unsigned char Contrast_2nd_str[];
+  extern const unsigned char IR_Detector_2nd_str[];
+  extern const unsigned char IR_Transmitter_2nd_str[];
+  extern const unsigned char IR_Send_2nd_str[];
+  extern const unsigned char OptoCoupler_2nd_str[];
+  extern const unsigned char None_2nd_str[];
+  extern const unsigned char CTR_2nd_str[];
+  extern const unsigned char Start_2nd_str[];
+  extern const unsigned char UJT_2nd_str[];
+  extern const unsigned char Servo_2nd_str[];
+  extern const unsigned char Sweep_2nd_str[];
+  extern const unsigned char ServoAuto_2nd_str[];
+  extern const unsigned char CapLeak_2nd_str[];
+  extern const unsigned char CapCharge_2nd_str[];
+  extern const unsigned char CapHigh_2nd_str[];
+  extern const unsigned char CapLow_2nd_str[];
+  extern const unsigned char CapDischarge_2nd_str[];
+  extern const unsigned char Monitor_R_2nd_str[];
+  extern const unsigned char Monitor_C_2nd_str[];
+  extern const unsigned char Monitor_L_2nd_str[];
+  extern const unsigned char Monitor_RCL_2nd_str[];
+  extern const unsigned char Monitor_RL_2nd_str[];
+  extern const unsigned char TouchSetup_2nd_str[];
+  extern const unsigned char PowerOff_2nd_str[];
+  extern const unsigned char OneWire_Scan_2nd_str[];
+  extern const unsigned char Bus_2nd_str[];
+  extern const unsigned char ContinuityCheck_2nd_str[];
+  extern const unsigned char FontTest_2nd_str[];
+  extern const unsigned char SymbolTest_2nd_str[];
+  extern const unsigned char DisplayBench_2nd_str[];
+  extern const unsigned char Flashlight_2nd_str[];
+  extern const unsigned char Photodiode_2nd_str[];
+  extern const unsigned char NoBias_2nd_str[];
+  extern const unsigned char ReverseBias_2nd_str[];
+  extern const unsigned char Scope_2nd_str[];
+  extern const unsigned char Rising_2nd_str[];
+  extern const unsigned char Falling_2nd_str[];
+  extern const unsigned char Discharge_2nd_str[];
+  extern const unsigned char Sorting_2nd_str[];
+  extern const unsigned char Compare_2nd_str[];
+  extern const unsigned char Pass_2nd_str[];
+  extern const unsigned char Tweezers_2nd_str[];
+  extern const unsigned char Curve_2nd_str[];
+  extern const unsigned char Matching_2nd_str[];
+  extern const unsigned char History_2nd_str[];
+  extern const unsigned char Repeat_2nd_str[];
+  extern const unsigned char Logger_2nd_str[];
+  extern const unsigned char LeadAdjust_2nd_str[];
+  extern const unsigned char Memory_2nd_str[];
+  extern const unsigned char Perf_2nd_str[];
+  extern const unsigned char Preset_2nd_str[];
+  extern const unsigned char PresetFull_2nd_str[];
+  extern const unsigned char PresetFast_2nd_str[];
+  extern const unsigned char Language_2nd_str[];
+  extern const unsigned char LangName_2nd_str[];
+  extern const unsigned char LED_Binning_2nd_str[];
+  extern const unsigned char CrystalRing_2nd_str[];
+
+  /* select string based on language */
+  #undef Tester_str
+  #define Tester_str (LANG_2ND ? Tester_2nd_str : Tester_str)
+  #undef Probing_str
+  #define Probing_str (LANG_2ND ? Probing_2nd_str : Probing_str)
+  #undef Timeout_str
+  #define Timeout_str (LANG_2ND ? Timeout_2nd_str : Timeout_str)
+  #undef Failed1_str
+  #define Failed1_str (LANG_2ND ? Failed1_2nd_str : Failed1_str)
+  #undef Failed2_str
+  #define Failed2_str (LANG_2ND ? Failed2_2nd_str : Failed2_str)
+  #undef Done_str
+  #define Done_str (LANG_2ND ? Done_2nd_str : Done_str)
+  #undef Select_str
+  #define Select_str (LANG_2ND ? Select_2nd_str : Select_str)
+  #undef Selftest_str
+  #define Selftest_str (LANG_2ND ? Selftest_2nd_str : Selftest_str)
+  #undef Adjustment_str
+  #define Adjustment_str (LANG_2ND ? Adjustment_2nd_str : Adjustment_str)
+  #undef Save_str
+  #define Save_str (LANG_2ND ? Save_2nd_str : Save_str)
+  #undef Load_str
+  #define Load_str (LANG_2ND ? Load_2nd_str : Load_str)
+  #undef Show_str
+  #define Show_str (LANG_2ND ? Show_2nd_str : Show_str)
+  #undef Remove_str
+  #define Remove_str (LANG_2ND ? Remove_2nd_str : Remove_str)
+  #undef Create_str
+  #define Create_str (LANG_2ND ? Create_2nd_str : Create_str)
+  #undef ShortCircuit_str
+  #define ShortCircuit_str (LANG_2ND ? ShortCircuit_2nd_str : ShortCircuit_str)
+  #undef DischargeFailed_str
+  #define DischargeFailed_str (LANG_2ND ? DischargeFailed_2nd_str : DischargeFailed_str)
+  #undef Error_str
+  #define Error_str (LANG_2ND ? Error_2nd_str : Error_str)
+  #undef Exit_str
+  #define Exit_str (LANG_2ND ? Exit_2nd_str : Exit_str)
+  #undef Checksum_str
+  #define Checksum_str (LANG_2ND ? Checksum_2nd_str : Checksum_str)
+  #undef BJT_str
+  #define BJT_str (LANG_2ND ? BJT_2nd_str : BJT_str)
+  #undef Thyristor_str
+  #define Thyristor_str (LANG_2ND ? Thyristor_2nd_str : Thyristor_str)
+  #undef Triac_str
+  #define Triac_str (LANG_2ND ? Triac_2nd_str : Triac_str)
+  #undef PUT_str
+  #define PUT_str (LANG_2ND ? PUT_2nd_str : PUT_str)
+  #undef Bye_str
+  #define Bye_str (LANG_2ND ? Bye_2nd_str : Bye_str)
+  #undef Hertz_str
+  #define Hertz_str (LANG_2ND ? Hertz_2nd_str : Hertz_str)
+  #undef Battery_str
+  #define Battery_str (LANG_2ND ? Battery_2nd_str : Battery_str)
+  #undef OK_str
+  #define OK_str (LANG_2ND ? OK_2nd_str : OK_str)
+  #undef Weak_str
+  #define Weak_str (LANG_2ND ? Weak_2nd_str : Weak_str)
+  #undef Low_str
+  #define Low_str (LANG_2ND ? Low_2nd_str : Low_str)
+  #undef External_str
+  #define External_str (LANG_2ND ? External_2nd_str : External_str)
+  #undef Menu_or_Test_str
+  #define Menu_or_Test_str (LANG_2ND ? Menu_or_Test_2nd_str : Menu_or_Test_str)
+  #undef PWM_str
+  #define PWM_str (LANG_2ND ? PWM_2nd_str : PWM_str)
+  #undef SquareWave_str
+  #define SquareWave_str (LANG_2ND ? SquareWave_2nd_str : SquareWave_str)
+  #undef Zener_str
+  #define Zener_str (LANG_2ND ? Zener_2nd_str : Zener_str)
+  #undef Min_str
+  #define Min_str (LANG_2ND ? Min_2nd_str : Min_str)
+  #undef FreqCounter_str
+  #define FreqCounter_str (LANG_2ND ? FreqCounter_2nd_str : FreqCounter_str)
+  #undef CounterChannel_str
+  #define CounterChannel_str (LANG_2ND ? CounterChannel_2nd_str : CounterChannel_str)
+  #undef FreqInput_str
+  #define FreqInput_str (LANG_2ND ? FreqInput_2nd_str : FreqInput_str)
+  #undef LF_Crystal_str
+  #define LF_Crystal_str (LANG_2ND ? LF_Crystal_2nd_str : LF_Crystal_str)
+  #undef HF_Crystal_str
+  #define HF_Crystal_str (LANG_2ND ? HF_Crystal_2nd_str : HF_Crystal_str)
+  #undef RingTester_str
+  #define RingTester_str (LANG_2ND ? RingTester_2nd_str : RingTester_str)
+  #undef RingPass_str
+  #define RingPass_str (LANG_2ND ? RingPass_2nd_str : RingPass_str)
+  #undef RingFail_str
+  #define RingFail_str (LANG_2ND ? RingFail_2nd_str : RingFail_str)
+  #undef EventCounter_str
+  #define EventCounter_str (LANG_2ND ? EventCounter_2nd_str : EventCounter_str)
+  #undef Count_str
+  #define Count_str (LANG_2ND ? Count_2nd_str : Count_str)
+  #undef Time_str
+  #define Time_str (LANG_2ND ? Time_2nd_str : Time_str)
+  #undef Events_str
+  #define Events_str (LANG_2ND ? Events_2nd_str : Events_str)
+  #undef Stop_str
+  #define Stop_str (LANG_2ND ? Stop_2nd_str : Stop_str)
+  #undef LC_Meter_str
+  #define LC_Meter_str (LANG_2ND ? LC_Meter_2nd_str : LC_Meter_str)
+  #undef Adjusting_str
+  #define Adjusting_str (LANG_2ND ? Adjusting_2nd_str : Adjusting_str)
+  #undef LogicProbe_str
+  #define LogicProbe_str (LANG_2ND ? LogicProbe_2nd_str : LogicProbe_str)
+  #undef Encoder_str
+  #define Encoder_str (LANG_2ND ? Encoder_2nd_str : Encoder_str)
+  #undef TurnRight_str
+  #define TurnRight_str (LANG_2ND ? TurnRight_2nd_str : TurnRight_str)
+  #undef Contrast_str
+  #define Contrast_str (LANG_2ND ? Contrast_2nd_str : Contrast_str)
+  #undef IR_Detector_str
+  #define IR_Detector_str (LANG_2ND ? IR_Detector_2nd_str : IR_Detector_str)
+  #undef IR_Transmitter_str
+  #define IR_Transmitter_str (LANG_2ND ? IR_Transmitter_2nd_str : IR_Transmitter_str)
+  #undef IR_Send_str
+  #define IR_Send_str (LANG_2ND ? IR_Send_2nd_str : IR_Send_str)
+  #undef OptoCoupler_str
+  #define OptoCoupler_str (LANG_2ND ? OptoCoupler_2nd_str : OptoCoupler_str)
+  #undef None_str
+  #define None_str (LANG_2ND ? None_2nd_str : None_str)
+  #undef CTR_str
+  #define CTR_str (LANG_2ND ? CTR_2nd_str : CTR_str)
+  #undef Start_str
+  #define Start_str (LANG_2ND ? Start_2nd_str : Start_str)
+  #undef UJT_str
+  #define UJT_str (LANG_2ND ? UJT_2nd_str : UJT_str)
+  #undef Servo_str
+  #define Servo_str (LANG_2ND ? Servo_2nd_str : Servo_str)
+  #undef Sweep_str
+  #define Sweep_str (LANG_2ND ? Sweep_2nd_str : Sweep_str)
+  #undef ServoAuto_str
+  #define ServoAuto_str (LANG_2ND ? ServoAuto_2nd_str : ServoAuto_str)
+  #undef CapLeak_str
+  #define CapLeak_str (LANG_2ND ? CapLeak_2nd_str : CapLeak_str)
+  #undef CapCharge_str
+  #define CapCharge_str (LANG_2ND ? CapCharge_2nd_str : CapCharge_str)
+  #undef CapHigh_str
+  #define CapHigh_str (LANG_2ND ? CapHigh_2nd_str : CapHigh_str)
+  #undef CapLow_str
+  #define CapLow_str (LANG_2ND ? CapLow_2nd_str : CapLow_str)
+  #undef CapDischarge_str
+  #define CapDischarge_str (LANG_2ND ? CapDischarge_2nd_str : CapDischarge_str)
+  #undef Monitor_R_str
+  #define Monitor_R_str (LANG_2ND ? Monitor_R_2nd_str : Monitor_R_str)
+  #undef Monitor_C_str
+  #define Monitor_C_str (LANG_2ND ? Monitor_C_2nd_str : Monitor_C_str)
+  #undef Monitor_L_str
+  #define Monitor_L_str (LANG_2ND ? Monitor_L_2nd_str : Monitor_L_str)
+  #undef Monitor_RCL_str
+  #define Monitor_RCL_str (LANG_2ND ? Monitor_RCL_2nd_str : Monitor_RCL_str)
+  #undef Monitor_RL_str
+  #define Monitor_RL_str (LANG_2ND ? Monitor_RL_2nd_str : Monitor_RL_str)
+  #undef TouchSetup_str
+  #define TouchSetup_str (LANG_2ND ? TouchSetup_2nd_str : TouchSetup_str)
+  #undef PowerOff_str
+  #define PowerOff_str (LANG_2ND ? PowerOff_2nd_str : PowerOff_str)
+  #undef OneWire_Scan_str
+  #define OneWire_Scan_str (LANG_2ND ? OneWire_Scan_2nd_str : OneWire_Scan_str)
+  #undef Bus_str
+  #define Bus_str (LANG_2ND ? Bus_2nd_str : Bus_str)
+  #undef ContinuityCheck_str
+  #define ContinuityCheck_str (LANG_2ND ? ContinuityCheck_2nd_str : ContinuityCheck_str)
+  #undef FontTest_str
+  #define FontTest_str (LANG_2ND ? FontTest_2nd_str : FontTest_str)
+  #undef SymbolTest_str
+  #define SymbolTest_str (LANG_2ND ? SymbolTest_2nd_str : SymbolTest_str)
+  #undef DisplayBench_str
+  #define DisplayBench_str (LANG_2ND ? DisplayBench_2nd_str : DisplayBench_str)
+  #undef Flashlight_str
+  #define Flashlight_str (LANG_2ND ? Flashlight_2nd_str : Flashlight_str)
+  #undef Photodiode_str
+  #define Photodiode_str (LANG_2ND ? Photodiode_2nd_str : Photodiode_str)
+  #undef NoBias_str
+  #define NoBias_str (LANG_2ND ? NoBias_2nd_str : NoBias_str)
+  #undef ReverseBias_str
+  #define ReverseBias_str (LANG_2ND ? ReverseBias_2nd_str : ReverseBias_str)
+  #undef Scope_str
+  #define Scope_str (LANG_2ND ? Scope_2nd_str : Scope_str)
+  #undef Rising_str
+  #define Rising_str (LANG_2ND ? Rising_2nd_str : Rising_str)
+  #undef Falling_str
+  #define Falling_str (LANG_2ND ? Falling_2nd_str : Falling_str)
+  #undef Discharge_str
+  #define Discharge_str (LANG_2ND ? Discharge_2nd_str : Discharge_str)
+  #undef Sorting_str
+  #define Sorting_str (LANG_2ND ? Sorting_2nd_str : Sorting_str)
+  #undef Compare_str
+  #define Compare_str (LANG_2ND ? Compare_2nd_str : Compare_str)
+  #undef Pass_str
+  #define Pass_str (LANG_2ND ? Pass_2nd_str : Pass_str)
+  #undef Tweezers_str
+  #define Tweezers_str (LANG_2ND ? Tweezers_2nd_str : Tweezers_str)
+  #undef Curve_str
+  #define Curve_str (LANG_2ND ? Curve_2nd_str : Curve_str)
+  #undef Matching_str
+  #define Matching_str (LANG_2ND ? Matching_2nd_str : Matching_str)
+  #undef History_str
+  #define History_str (LANG_2ND ? History_2nd_str : History_str)
+  #undef Repeat_str
+  #define Repeat_str (LANG_2ND ? Repeat_2nd_str : Repeat_str)
+  #undef Logger_str
+  #define Logger_str (LANG_2ND ? Logger_2nd_str : Logger_str)
+  #undef LeadAdjust_str
+  #define LeadAdjust_str (LANG_2ND ? LeadAdjust_2nd_str : LeadAdjust_str)
+  #undef Memory_str
+  #define Memory_str (LANG_2ND ? Memory_2nd_str : Memory_str)
+  #undef Perf_str
+  #define Perf_str (LANG_2ND ? Perf_2nd_str : Perf_str)
+  #undef Preset_str
+  #define Preset_str (LANG_2ND ? Preset_2nd_str : Preset_str)
+  #undef PresetFull_str
+  #define PresetFull_str (LANG_2ND ? PresetFull_2nd_str : PresetFull_str)
+  #undef PresetFast_str
+  #define PresetFast_str (LANG_2ND ? PresetFast_2nd_str : PresetFast_str)
+  #undef Language_str
+  #define Language_str (LANG_2ND ? Language_2nd_str : Language_str)
+  #undef LED_Binning_str
+  #define LED_Binning_str (LANG_2ND ? LED_Binning_2nd_str : LED_Binning_str)
+  #undef CrystalRing_str
+  #define CrystalRing_str (LANG_2ND ? CrystalRing_2nd_str : CrystalRing_str)
+  #undef LangName_str
+
+#endif
+
+
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
@@ -102,6 +102,11 @@
     const unsigned char RingTester_str[] MEM_TYPE = "Ring Tester";
   #endif
 
+  #ifdef RING_TESTER_AUTO
+    const unsigned char RingPass_str[] MEM_TYPE = "pass";
+    const unsigned char RingFail_str[] MEM_TYPE = "fail";
+  #endif
+
   #ifdef HW_EVENT_COUNTER
     const unsigned char EventCounter_str[] MEM_TYPE = "Citac udalosti";
     const unsigned char Count_str[] MEM_TYPE = "Pocitat";
@@ -153,9 +158,16 @@
 
   #ifdef SW_SERVO
     const unsigned char Servo_str[] MEM_TYPE = "Servo";
+  #endif
+
+  #if defined (SW_SERVO) || defined (PWM_SWEEP)
     const unsigned char Sweep_str[] MEM_TYPE = "<->";
   #endif
 
+  #ifdef SERVO_AUTO_TEST
+    const unsigned char ServoAuto_str[] MEM_TYPE = "<|>";
+  #endif
+
   #ifdef SW_CAP_LEAKAGE
     const unsigned char CapLeak_str[] MEM_TYPE = "Cap unik";
     const unsigned char CapCharge_str[] MEM_TYPE = "Nabijeni";
@@ -209,6 +221,10 @@
     const unsigned char SymbolTest_str[] MEM_TYPE = "Symbols";
   #endif
 
+  #ifdef SW_DISPLAY_BENCH
+    const unsigned char DisplayBench_str[] MEM_TYPE = "Display Bench";
+  #endif
+
   #ifdef HW_FLASHLIGHT
     const unsigned char Flashlight_str[] MEM_TYPE = "Flashlight";
   #endif
@@ -219,6 +235,83 @@
     const unsigned char ReverseBias_str[] MEM_TYPE = "rev";
   #endif
 
+  #ifdef SW_SCOPE
+    const unsigned char Scope_str[] MEM_TYPE = "Scope";
+    const unsigned char Rising_str[] MEM_TYPE = "rise";
+    const unsigned char Falling_str[] MEM_TYPE = "fall";
+  #endif
+
+  #ifdef DISCHARGE_ADAPTIVE
+    const unsigned char Discharge_str[] MEM_TYPE = "Discharge";
+  #endif
+
+  #ifdef SW_SORTING
+    const unsigned char Sorting_str[] MEM_TYPE = "Sorting";
+  #endif
+
+  #ifdef SW_COMPARE
+    const unsigned char Compare_str[] MEM_TYPE = "Compare";
+  #endif
+
+  #if defined (SW_SORTING) || defined (SW_COMPARE)
+    const unsigned char Pass_str[] MEM_TYPE = "pass";
+  #endif
+
+  #ifdef UI_TWEEZERS
+    const unsigned char Tweezers_str[] MEM_TYPE = "Tweezers";
+  #endif
+
+  #ifdef SW_CURVE_TRACER
+    const unsigned char Curve_str[] MEM_TYPE = "I-V Curve";
+  #endif
+
+  #ifdef SW_MATCHING
+    const unsigned char Matching_str[] MEM_TYPE = "Matching";
+  #endif
+
+  #ifdef SW_HISTORY
+    const unsigned char History_str[] MEM_TYPE = "History";
+  #endif
+
+  #ifdef SW_REPEAT_STATS
+    const unsigned char Repeat_str[] MEM_TYPE = "Repeat";
+  #endif
+
+  #ifdef SW_LOGGER
+    const unsigned char Logger_str[] MEM_TYPE = "Logger";
+  #endif
+
+  #ifdef SW_LEAD_ADJUST
+    const unsigned char LeadAdjust_str[] MEM_TYPE = "Lead Adjust";
+  #endif
+
+  #ifdef SW_STACK_CHECK
+    const unsigned char Memory_str[] MEM_TYPE = "Memory";
+  #endif
+
+  #ifdef SW_PERF_COUNTERS
+    const unsigned char Perf_str[] MEM_TYPE = "Counters";
+  #endif
+
+  #ifdef UI_PRESETS
+    const unsigned char Preset_str[] MEM_TYPE = "Preset";
+    const unsigned char PresetFull_str[] MEM_TYPE = "Full";
+    const unsigned char PresetFast_str[] MEM_TYPE = "Fast";
+  #endif
+
+  #ifdef UI_ENGLISH_2ND
+    const unsigned char Language_str[] MEM_TYPE = "Language";
+    const unsigned char LangName_str[] MEM_TYPE = "Cesky";
+  #endif
+
+  #ifdef SW_LED_BINNING
+    const unsigned char LED_Binning_str[] MEM_TYPE = "LED Binning";
+  #endif
+
+  #ifdef CRYSTAL_RINGDOWN
+    const unsigned char CrystalRing_str[] MEM_TYPE = "Crystal Ringdown";
+  #endif
+
 #endif
 
 
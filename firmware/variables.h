@@ -53,6 +53,20 @@
       uint8_t       RX_Char;                 /* RX char (bit buffer) */
       uint8_t       RX_Bits;                 /* bit counter for RX char */
     #endif
+    #ifdef SERIAL_RX_QUEUE
+      char          RX_Queue[SERIAL_RX_QUEUE][RX_BUFFER_SIZE];  /* command queue */
+      uint8_t       RX_In = 0;               /* line filled by ISR */
+      uint8_t       RX_Out = 0;              /* line to process next */
+      volatile uint8_t  RX_Count = 0;        /* number of queued commands */
+    #endif
+  #endif
+  #ifdef SERIAL_TX_BUFFER
+    uint8_t         TX_Buffer[TX_BUFFER_SIZE];    /* serial TX ring buffer */
+    volatile uint8_t  TX_Head = 0;           /* write position */
+    volatile uint8_t  TX_Tail = 0;           /* read position */
+  #endif
+  #ifdef FUNC_SCRATCH
+    uint8_t         Scratch[SCRATCH_SIZE];   /* scratch arena */
   #endif
 
   /* configuration */
@@ -60,6 +74,10 @@
   Config_Type       Cfg;                     /* tester modes, offsets and values */
   Adjust_Type       NV;                      /* basic adjustment offsets and values */
 
+  #ifdef ADC_INTERRUPT
+    Sampling_Type   Sampling;                /* interrupt driven ADC sampling */
+  #endif
+
   #ifdef HW_TOUCH
     Touch_Type      Touch;                   /* touch screen adjustment offsets */
   #endif
@@ -75,12 +93,43 @@
   Semi_Type         Semi;                    /* common semiconductor */
   AltSemi_Type      AltSemi;                 /* special semiconductor */
 
+  #ifdef SW_HFE_SWEEP
+    hFE_Type        hFE_Sweep[HFE_SWEEP_POINTS];  /* hFE sweep */
+  #endif
+
   #if defined (SW_INDUCTOR) || defined (HW_LC_METER)
     Inductor_Type   Inductor;                /* inductor */
   #endif
 
+  #ifdef ESR_PIPELINED
+    uint16_t        ESR_Spread;              /* spread of last ESR reading */
+  #endif
+
+  #ifdef ESR_TOOL_FAST
+    uint8_t         ESR_Pulses = 0;          /* pulse pairs (0 = default) */
+  #endif
+
   #ifdef UI_SERIAL_COMMANDS
     Info_Type       Info;                    /* additional component data */
+    #ifdef SW_BURST
+    uint8_t         BurstRuns = 0;           /* remaining burst runs */
+    uint8_t         BurstCount = 0;          /* burst records sent */
+    #endif
+    #ifdef SW_BIN_FRAMES
+    Frame_Type      Frame;                   /* binary frames */
+    #endif
+  #endif
+
+  #ifdef SW_PROFILER
+    Profile_Type    Profile;                 /* probing profiler */
+  #endif
+
+  #ifdef SW_POWER_STATS
+    SleepStats_Type SleepStats;              /* power-state statistics */
+  #endif
+
+  #ifdef SW_PERF_COUNTERS
+    volatile uint32_t PerfCount[NUM_PERF_COUNTERS];   /* performance counters */
   #endif
 
   #ifdef HW_SPI
@@ -116,15 +165,53 @@
     #define NV_C_ZERO         C_ZERO
   #endif
 
+  /* manage Contrast and optional RingMin */
+  #ifdef RING_TESTER_AUTO
+    #define NV_RING           LCD_CONTRAST, RING_TESTER_MIN
+  #else
+    #define NV_RING           LCD_CONTRAST
+  #endif
+
+  /* manage optional Preset */
+  #ifdef UI_PRESETS
+    #define NV_PRESET         NV_RING, PRESET_FULL
+  #else
+    #define NV_PRESET         NV_RING
+  #endif
+
+  /* manage optional Language */
+  #ifdef UI_ENGLISH_2ND
+    #define NV_CONTRAST       NV_PRESET, LANGUAGE_1ST
+  #else
+    #define NV_CONTRAST       NV_PRESET
+  #endif
+
+  #ifndef ADJUST_WEAR_LEVEL
+
   /* basic adjustment values: profile #1 */
-  const Adjust_Type     NV_Adjust_1 EEMEM = {R_MCU_LOW, R_MCU_HIGH, NV_R_ZERO, NV_C_ZERO, UREF_OFFSET, COMPARATOR_OFFSET, LCD_CONTRAST, 0};
+  const Adjust_Type     NV_Adjust_1 EEMEM = {R_MCU_LOW, R_MCU_HIGH, NV_R_ZERO, NV_C_ZERO, UREF_OFFSET, COMPARATOR_OFFSET, NV_CONTRAST, 0};
 
   /* basic adjustment values: profile #2 */
-  const Adjust_Type     NV_Adjust_2 EEMEM = {R_MCU_LOW, R_MCU_HIGH, NV_R_ZERO, NV_C_ZERO, UREF_OFFSET, COMPARATOR_OFFSET, LCD_CONTRAST, 0};
+  const Adjust_Type     NV_Adjust_2 EEMEM = {R_MCU_LOW, R_MCU_HIGH, NV_R_ZERO, NV_C_ZERO, UREF_OFFSET, COMPARATOR_OFFSET, NV_CONTRAST, 0};
 
   #ifdef UI_THREE_PROFILES
     /* basic adjustment values: profile #3 */
-    const Adjust_Type   NV_Adjust_3 EEMEM = {R_MCU_LOW, R_MCU_HIGH, NV_R_ZERO, NV_C_ZERO, UREF_OFFSET, COMPARATOR_OFFSET, LCD_CONTRAST, 0};
+    const Adjust_Type   NV_Adjust_3 EEMEM = {R_MCU_LOW, R_MCU_HIGH, NV_R_ZERO, NV_C_ZERO, UREF_OFFSET, COMPARATOR_OFFSET, NV_CONTRAST, 0};
+  #endif
+
+  #else
+
+  /* basic adjustment values: profile #1 (rotating slots, defaults in first one) */
+  const Adjust_Type     NV_Adjust_1[ADJUST_SLOTS] EEMEM = {{R_MCU_LOW, R_MCU_HIGH, NV_R_ZERO, NV_C_ZERO, UREF_OFFSET, COMPARATOR_OFFSET, NV_CONTRAST, 0, 0}};
+
+  /* basic adjustment values: profile #2 (rotating slots, defaults in first one) */
+  const Adjust_Type     NV_Adjust_2[ADJUST_SLOTS] EEMEM = {{R_MCU_LOW, R_MCU_HIGH, NV_R_ZERO, NV_C_ZERO, UREF_OFFSET, COMPARATOR_OFFSET, NV_CONTRAST, 0, 0}};
+
+  #ifdef UI_THREE_PROFILES
+    /* basic adjustment values: profile #3 (rotating slots, defaults in first one) */
+    const Adjust_Type   NV_Adjust_3[ADJUST_SLOTS] EEMEM = {{R_MCU_LOW, R_MCU_HIGH, NV_R_ZERO, NV_C_ZERO, UREF_OFFSET, COMPARATOR_OFFSET, NV_CONTRAST, 0, 0}};
+  #endif
+
   #endif
 
   #ifdef HW_TOUCH
@@ -132,6 +219,26 @@
     const Touch_Type    NV_Touch EEMEM = {0, 0, 0, 0, 0};
   #endif
 
+  #ifdef SW_IR_LEARN
+    /* IR learn: raw pulse trains */
+    const IR_Learn_Type NV_IR_Learn[IR_LEARN_SLOTS] EEMEM = {{0}};
+  #endif
+
+  #ifdef SW_LED_BINNING
+    /* LED binning: bins (2.000V, 20mV) */
+    const LED_Bins_Type NV_LED_Bins EEMEM = {2000, 20};
+  #endif
+
+  #ifdef DS18B20_ROM_CACHE
+    /* DS18B20: ROM codes of last bus search */
+    const DS18B20_Cache_Type NV_DS18B20_Cache EEMEM = {0};
+  #endif
+
+  #ifdef SERIAL_MULTIDROP
+    /* serial multi-drop mode: address */
+    const uint8_t NV_Serial_Addr EEMEM = SERIAL_ADDRESS;
+  #endif
+
 
   /*
    *  constant strings
@@ -154,9 +261,19 @@
   #include "var_russian_2.h"
   #include "var_spanish.h"
 
+  #ifdef UI_ENGLISH_2ND
+    /* second language: English strings renamed to *_2nd_str */
+    #define VAR_2ND_RENAME
+    #include "var_2nd.h"
+    #undef VAR_2ND_RENAME
+    #define VAR_ENGLISH_2ND
+    #include "var_english.h"
+    #undef VAR_ENGLISH_2ND
+  #endif
+
 
   /* firmware */
-  const unsigned char Version_str[] MEM_TYPE = "v1.51m";
+  const unsigned char Version_str[] MEM_TYPE = "v1.52m";
 
 
   /* common terms and texts */
@@ -203,7 +320,7 @@
     const unsigned char Profile3_str[] MEM_TYPE = "#3";
   #endif
 
-  #ifdef SW_ESR_TOOL
+  #if defined (SW_ESR_TOOL) || ((defined (SW_LOGGER) || defined (SW_REPEAT_STATS)) && (defined (SW_ESR) || defined (SW_OLD_ESR)))
     const unsigned char ESR_str[] MEM_TYPE = "ESR";
   #endif
 
@@ -242,6 +359,10 @@
     const unsigned char IR_SIRC_20_str[] MEM_TYPE = "SIRC-20";
   #endif
 
+  #ifdef SW_IR_LEARN
+    const unsigned char IR_Raw_str[] MEM_TYPE = "Raw";
+  #endif
+
   #ifdef SW_OPTO_COUPLER
     const unsigned char If_str[] MEM_TYPE = "If";
     const unsigned char t_on_str[] MEM_TYPE = "t_on";
@@ -279,6 +400,10 @@
     const unsigned char CRC_str[] MEM_TYPE = "CRC";
   #endif
 
+  #ifdef SW_I2C_SCAN
+    const unsigned char I2C_Scan_str[] MEM_TYPE = "I2C Scan";
+  #endif
+
   #ifdef HW_LOGIC_PROBE
     const unsigned char TTL_str[] MEM_TYPE = "TTL";
     const unsigned char CMOS_str[] MEM_TYPE = "CMOS";
@@ -302,6 +427,62 @@
     const unsigned char U_loss_str[] MEM_TYPE = "V_l";
   #endif
 
+  #ifdef FONT_CACHE
+    /* glyphs cached in RAM: digits, dot, minus, prefixes and units */
+    const unsigned char FontCache_table[FONT_CACHE_CHARS] MEM_TYPE = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+    #ifdef UI_COMMA
+      ',',
+    #else
+      '.',
+    #endif
+      '-', 'p', 'n', LCD_CHAR_MICRO, 'm', 'k', 'M', 'V', 'A', 'F', 'H', 'z', LCD_CHAR_OMEGA};
+  #endif
+
+  #if defined (EVENT_COUNTER_LOG) || defined (THERMOCOUPLE_LOG)
+    const unsigned char Log_str[] MEM_TYPE = "Log";
+  #endif
+
+  #ifdef SW_LOGGER
+    const unsigned char Log_R_str[] MEM_TYPE = "R";
+    const unsigned char Log_C_str[] MEM_TYPE = "C";
+    #ifdef SW_INDUCTOR
+    const unsigned char Log_L_str[] MEM_TYPE = "L";
+    #endif
+    const unsigned char Log_U_str[] MEM_TYPE = "U";
+    const unsigned char Log_Header_str[] MEM_TYPE = "ms,";
+  #endif
+
+  #ifdef SW_DDS
+    const unsigned char DDS_str[] MEM_TYPE = "DDS";
+    const unsigned char DDS_Sine_str[] MEM_TYPE = "sin";
+    const unsigned char DDS_Triangle_str[] MEM_TYPE = "tri";
+  #endif
+
+  #if defined (FREQ_COUNTER_STATS) || defined (THERMOCOUPLE_LOG) || defined (SW_REPEAT_STATS)
+    const unsigned char StatsMin_str[] MEM_TYPE = "min";
+    const unsigned char StatsMax_str[] MEM_TYPE = "max";
+    const unsigned char StatsMean_str[] MEM_TYPE = "avg";
+    const unsigned char StatsDev_str[] MEM_TYPE = "sd";
+  #endif
+
+  #ifdef PHOTODIODE_TIMING
+    const unsigned char PD_Rise_str[] MEM_TYPE = "t_r";
+    const unsigned char PD_Fall_str[] MEM_TYPE = "t_f";
+  #endif
+
+  #ifdef ENCODER_STATS
+    const unsigned char EncSteps_str[] MEM_TYPE = "St/D";
+    const unsigned char EncBounce_str[] MEM_TYPE = "t_b";
+    const unsigned char EncSpeed_str[] MEM_TYPE = "v_max";
+  #endif
+
+  #ifdef SW_DISPLAY_BENCH
+    const unsigned char BenchClear_str[] MEM_TYPE = "Clr";
+    const unsigned char BenchLine_str[] MEM_TYPE = "Line";
+    const unsigned char BenchChar_str[] MEM_TYPE = "Char";
+    const unsigned char BenchSymbol_str[] MEM_TYPE = "Sym";
+  #endif
+
   /* component symbols */
   const unsigned char Cap_str[] MEM_TYPE = {'-', LCD_CHAR_CAP, '-',0};
   const unsigned char Diode_AC_str[] MEM_TYPE = {'-', LCD_CHAR_DIODE_AC, '-', 0};
@@ -372,65 +553,270 @@
     #ifdef SW_SCHOTTKY_BJT
       const unsigned char Cmd_V_F_clamp_str[] MEM_TYPE = "V_F_clamp";
     #endif
+    #ifdef SW_HFE_SWEEP
+      const unsigned char Cmd_h_FE_sweep_str[] MEM_TYPE = "h_FE_sweep";
+    #endif
+    #ifdef SW_PROFILER
+      const unsigned char Cmd_PROF_str[] MEM_TYPE = "PROF";
+    #endif
+    const unsigned char Cmd_ALL_str[] MEM_TYPE = "ALL";
+    #ifdef SW_STREAM
+      const unsigned char Cmd_MON_R_str[] MEM_TYPE = "MON_R";
+      const unsigned char Cmd_MON_C_str[] MEM_TYPE = "MON_C";
+      #ifdef SW_INDUCTOR
+      const unsigned char Cmd_MON_L_str[] MEM_TYPE = "MON_L";
+      #endif
+    #endif
+    #ifdef SW_RAW_STREAM
+      const unsigned char Cmd_RAW_str[] MEM_TYPE = "RAW";
+    #endif
+    #ifdef SW_BIN_FRAMES
+      const unsigned char Cmd_BIN_str[] MEM_TYPE = "BIN";
+      const unsigned char Cmd_TXT_str[] MEM_TYPE = "TXT";
+    #endif
+    #ifdef SERIAL_MULTIDROP
+      const unsigned char Cmd_ADDR_str[] MEM_TYPE = "ADDR";
+    #endif
+    #ifdef SW_REMOTE_TOOLS
+      const unsigned char Cmd_TOOL_str[] MEM_TYPE = "TOOL";
+      const unsigned char Cmd_KEY_str[] MEM_TYPE = "KEY";
+      #ifdef HW_FREQ_COUNTER
+      const unsigned char Cmd_F_str[] MEM_TYPE = "F";
+      #endif
+      #ifdef SW_DS18B20
+      const unsigned char Cmd_T_str[] MEM_TYPE = "T";
+      #endif
+    #endif
+    #if defined (SW_STREAM) || defined (SW_RAW_STREAM) || defined (SW_REMOTE_TOOLS)
+      const unsigned char Cmd_STOP_str[] MEM_TYPE = "STOP";
+    #endif
+    const unsigned char Cmd_APROBE_str[] MEM_TYPE = "APROBE";
+    const unsigned char Cmd_CANCEL_str[] MEM_TYPE = "CANCEL";
+    const unsigned char Cmd_DONE_str[] MEM_TYPE = "DONE";
+    #ifdef SW_BURST
+      const unsigned char Cmd_BURST_str[] MEM_TYPE = "BURST";
+    #endif
+    #ifdef EVENT_COUNTER_LOG
+      const unsigned char Cmd_EVLOG_str[] MEM_TYPE = "EVLOG";
+    #endif
+    #ifdef SW_HISTORY
+      const unsigned char Cmd_HIST_str[] MEM_TYPE = "HIST";
+    #endif
+    #ifdef SW_REPEAT_STATS
+      const unsigned char Cmd_REPEAT_str[] MEM_TYPE = "REPEAT";
+    #endif
+    #ifdef SW_STACK_CHECK
+      const unsigned char Cmd_MEM_str[] MEM_TYPE = "MEM";
+    #endif
+    #ifdef SW_PERF_COUNTERS
+      const unsigned char Cmd_PERF_str[] MEM_TYPE = "PERF";
+    #endif
+    #ifdef SW_CYCLE_BENCH
+      const unsigned char Cmd_BENCH_str[] MEM_TYPE = "BENCH";
+      const unsigned char Bench_ReadU_str[] MEM_TYPE = "ReadU";
+      const unsigned char Bench_LCD_Char_str[] MEM_TYPE = "LCD_Char";
+      const unsigned char Bench_Value_str[] MEM_TYPE = "Display_Value";
+      const unsigned char Bench_FindCommand_str[] MEM_TYPE = "FindCommand";
+      #if defined (FUNC_EVALUE) || defined (FUNC_COLORCODE) || defined (FUNC_EIA96)
+      const unsigned char Bench_ENorm_str[] MEM_TYPE = "GetENormValue";
+      #endif
+    #endif
+    #ifdef SW_SELFTEST_REPORT
+      const unsigned char Cmd_SELFTEST_str[] MEM_TYPE = "SELFTEST";
+      const unsigned char Cmd_PASS_str[] MEM_TYPE = "PASS";
+      const unsigned char Cmd_FAIL_str[] MEM_TYPE = "FAIL";
+      const unsigned char Cmd_SKIP_str[] MEM_TYPE = "SKIP";
+    #endif
+    #ifdef SW_POWER_STATS
+      const unsigned char Cmd_PWR_str[] MEM_TYPE = "PWR";
+    #endif
 
     /* command reference table */
     const Cmd_Type Cmd_Table[] MEM_TYPE = {
-      {CMD_VER, Cmd_VER_str},
-      {CMD_OFF, Cmd_OFF_str},
-      {CMD_PROBE, Cmd_PROBE_str},
-      {CMD_COMP, Cmd_COMP_str},
-      {CMD_MSG, Cmd_MSG_str},
-      {CMD_QTY, Cmd_QTY_str},
-      {CMD_NEXT, Cmd_NEXT_str},
-      {CMD_TYPE, Cmd_TYPE_str},
-      {CMD_HINT, Cmd_HINT_str},
-      {CMD_MHINT, Cmd_MHINT_str},
-      {CMD_PIN, Cmd_PIN_str},
-      {CMD_R, Cmd_R_str},
-      {CMD_C, Cmd_C_str},
+      CMD_ENTRY(CMD_VER, Cmd_VER_str),
+      CMD_ENTRY(CMD_OFF, Cmd_OFF_str),
+      CMD_ENTRY(CMD_PROBE, Cmd_PROBE_str),
+      CMD_ENTRY(CMD_COMP, Cmd_COMP_str),
+      CMD_ENTRY(CMD_MSG, Cmd_MSG_str),
+      CMD_ENTRY(CMD_QTY, Cmd_QTY_str),
+      CMD_ENTRY(CMD_NEXT, Cmd_NEXT_str),
+      CMD_ENTRY(CMD_TYPE, Cmd_TYPE_str),
+      CMD_ENTRY(CMD_HINT, Cmd_HINT_str),
+      CMD_ENTRY(CMD_MHINT, Cmd_MHINT_str),
+      CMD_ENTRY(CMD_PIN, Cmd_PIN_str),
+      #ifdef SW_PROFILER
+        CMD_ENTRY(CMD_PROF, Cmd_PROF_str),
+      #endif
+      CMD_ENTRY(CMD_R, Cmd_R_str),
+      CMD_ENTRY(CMD_C, Cmd_C_str),
       #ifdef SW_INDUCTOR
-        {CMD_L, Cmd_L_str},
+        CMD_ENTRY(CMD_L, Cmd_L_str),
       #endif
       #if defined (SW_ESR) || defined (SW_OLD_ESR)
-        {CMD_ESR, Cmd_ESR_str},
+        CMD_ENTRY(CMD_ESR, Cmd_ESR_str),
       #endif
-      {CMD_I_L, I_leak_str},
-      {CMD_V_F, Cmd_V_F_str},
-      {CMD_V_F2, Cmd_V_F2_str},
-      {CMD_C_D, Cmd_C_D_str},
-      {CMD_I_R, I_R_str},
-      {CMD_R_BE, Cmd_R_BE_str},
-      {CMD_H_FE, Cmd_h_FE_str},
+      CMD_ENTRY(CMD_I_L, I_leak_str),
+      CMD_ENTRY(CMD_V_F, Cmd_V_F_str),
+      CMD_ENTRY(CMD_V_F2, Cmd_V_F2_str),
+      CMD_ENTRY(CMD_C_D, Cmd_C_D_str),
+      CMD_ENTRY(CMD_I_R, I_R_str),
+      CMD_ENTRY(CMD_R_BE, Cmd_R_BE_str),
+      CMD_ENTRY(CMD_H_FE, Cmd_h_FE_str),
       #ifdef SW_REVERSE_HFE
-        {CMD_H_FE_R, Cmd_h_FE_r_str},
+        CMD_ENTRY(CMD_H_FE_R, Cmd_h_FE_r_str),
       #endif
-      {CMD_V_BE, Cmd_V_BE_str},
-      {CMD_I_CEO, Cmd_I_CEO_str},
-      {CMD_V_TH, Cmd_V_TH_str},
-      {CMD_C_GS, Cmd_C_GS_str},
-      {CMD_R_DS, Cmd_R_DS_str},
-      {CMD_V_GS_OFF, Cmd_V_GS_off_str},
-      {CMD_I_DSS, Cmd_I_DSS_str},
-      {CMD_C_GE, Cmd_C_GE_str},
-      {CMD_V_GT, V_GT_str},
-      {CMD_V_T, Cmd_V_T_str},
+      CMD_ENTRY(CMD_V_BE, Cmd_V_BE_str),
+      CMD_ENTRY(CMD_I_CEO, Cmd_I_CEO_str),
+      CMD_ENTRY(CMD_V_TH, Cmd_V_TH_str),
+      CMD_ENTRY(CMD_C_GS, Cmd_C_GS_str),
+      CMD_ENTRY(CMD_R_DS, Cmd_R_DS_str),
+      CMD_ENTRY(CMD_V_GS_OFF, Cmd_V_GS_off_str),
+      CMD_ENTRY(CMD_I_DSS, Cmd_I_DSS_str),
+      CMD_ENTRY(CMD_C_GE, Cmd_C_GE_str),
+      CMD_ENTRY(CMD_V_GT, V_GT_str),
+      CMD_ENTRY(CMD_V_T, Cmd_V_T_str),
       #ifdef SW_UJT
-        {CMD_R_BB, R_BB_str},
+        CMD_ENTRY(CMD_R_BB, R_BB_str),
       #endif
       #ifdef SW_HFE_CURRENT
-        {CMD_I_C, Cmd_I_C_str},
-        {CMD_I_E, Cmd_I_E_str},
+        CMD_ENTRY(CMD_I_C, Cmd_I_C_str),
+        CMD_ENTRY(CMD_I_E, Cmd_I_E_str),
       #endif
       #ifdef HW_PROBE_ZENER
-        {CMD_V_Z, Cmd_V_Z_str},
+        CMD_ENTRY(CMD_V_Z, Cmd_V_Z_str),
       #endif
       #ifdef SW_C_VLOSS
-        {CMD_V_L, U_loss_str},
+        CMD_ENTRY(CMD_V_L, U_loss_str),
       #endif
       #ifdef SW_SCHOTTKY_BJT
-        {CMD_V_F_CLAMP, Cmd_V_F_clamp_str},
+        CMD_ENTRY(CMD_V_F_CLAMP, Cmd_V_F_clamp_str),
+      #endif
+      #ifdef SW_HFE_SWEEP
+        CMD_ENTRY(CMD_H_FE_SWEEP, Cmd_h_FE_sweep_str),
+      #endif
+      CMD_ENTRY(CMD_ALL, Cmd_ALL_str),
+      #ifdef SW_STREAM
+        CMD_ENTRY(CMD_MON_R, Cmd_MON_R_str),
+        CMD_ENTRY(CMD_MON_C, Cmd_MON_C_str),
+        #ifdef SW_INDUCTOR
+        CMD_ENTRY(CMD_MON_L, Cmd_MON_L_str),
+        #endif
+      #endif
+      #ifdef SW_RAW_STREAM
+        CMD_ENTRY(CMD_RAW, Cmd_RAW_str),
+      #endif
+      #ifdef SW_BIN_FRAMES
+        CMD_ENTRY(CMD_BIN, Cmd_BIN_str),
+        CMD_ENTRY(CMD_TXT, Cmd_TXT_str),
       #endif
-      {0, 0}
+      #ifdef SERIAL_MULTIDROP
+        CMD_ENTRY(CMD_ADDR, Cmd_ADDR_str),
+      #endif
+      #ifdef SW_REMOTE_TOOLS
+        CMD_ENTRY(CMD_TOOL, Cmd_TOOL_str),
+        CMD_ENTRY(CMD_KEY, Cmd_KEY_str),
+      #endif
+      #if defined (SW_STREAM) || defined (SW_RAW_STREAM) || defined (SW_REMOTE_TOOLS)
+        CMD_ENTRY(CMD_STOP, Cmd_STOP_str),
+      #endif
+      CMD_ENTRY(CMD_APROBE, Cmd_APROBE_str),
+      CMD_ENTRY(CMD_CANCEL, Cmd_CANCEL_str),
+      #ifdef SW_BURST
+        CMD_ENTRY(CMD_BURST, Cmd_BURST_str),
+      #endif
+      #ifdef SW_POWER_STATS
+        CMD_ENTRY(CMD_PWR, Cmd_PWR_str),
+      #endif
+      #ifdef EVENT_COUNTER_LOG
+        CMD_ENTRY(CMD_EVLOG, Cmd_EVLOG_str),
+      #endif
+      #ifdef SW_HISTORY
+        CMD_ENTRY(CMD_HIST, Cmd_HIST_str),
+      #endif
+      #ifdef SW_REPEAT_STATS
+        CMD_ENTRY(CMD_REPEAT, Cmd_REPEAT_str),
+      #endif
+      #ifdef SW_SELFTEST_REPORT
+        CMD_ENTRY(CMD_SELFTEST, Cmd_SELFTEST_str),
+      #endif
+      #ifdef SW_STACK_CHECK
+        CMD_ENTRY(CMD_MEM, Cmd_MEM_str),
+      #endif
+      #ifdef SW_CYCLE_BENCH
+        CMD_ENTRY(CMD_BENCH, Cmd_BENCH_str),
+      #endif
+      #ifdef SW_PERF_COUNTERS
+        CMD_ENTRY(CMD_PERF, Cmd_PERF_str),
+      #endif
+      {0, 0, 0}
+    };
+
+    #ifdef SW_PROFILER
+      /* profiler stages */
+      const unsigned char Prof_DIS_str[] MEM_TYPE = "DIS";
+      const unsigned char Prof_CHK_str[] MEM_TYPE = "CHK";
+      const unsigned char Prof_CAP_str[] MEM_TYPE = "CAP";
+      const unsigned char Prof_SHOW_str[] MEM_TYPE = "SHOW";
+      const unsigned char Prof_ESR_str[] MEM_TYPE = "ESR";
+      const unsigned char Prof_LCAP_str[] MEM_TYPE = "LCAP";
+      const unsigned char Prof_SCAP_str[] MEM_TYPE = "SCAP";
+      const unsigned char Prof_IND_str[] MEM_TYPE = "IND";
+      const unsigned char Prof_CYCLE_str[] MEM_TYPE = "CYCLE";
+
+      /* stage reference table (same order as stage IDs) */
+      const Cmd_Type Prof_Table[NUM_PROF_STAGES] MEM_TYPE = {
+        CMD_ENTRY(PROF_DISCHARGE, Prof_DIS_str),
+        CMD_ENTRY(PROF_CHECKPROBES, Prof_CHK_str),
+        CMD_ENTRY(PROF_MEASURECAP, Prof_CAP_str),
+        CMD_ENTRY(PROF_SHOW, Prof_SHOW_str),
+        CMD_ENTRY(PROF_ESR, Prof_ESR_str),
+        CMD_ENTRY(PROF_LARGECAP, Prof_LCAP_str),
+        CMD_ENTRY(PROF_SMALLCAP, Prof_SCAP_str),
+        CMD_ENTRY(PROF_INDUCTOR, Prof_IND_str),
+        CMD_ENTRY(PROF_CYCLE, Prof_CYCLE_str)
+      };
+    #endif
+
+    #ifdef SW_POWER_STATS
+      /* power states */
+      const unsigned char Pwr_UP_str[] MEM_TYPE = "UP";
+      const unsigned char Pwr_IDLE_str[] MEM_TYPE = "IDLE";
+      const unsigned char Pwr_SAVE_str[] MEM_TYPE = "SAVE";
+      const unsigned char Pwr_RUN_str[] MEM_TYPE = "RUN";
+      #ifdef BAT_BACKGROUND
+      const unsigned char Pwr_BAT_str[] MEM_TYPE = "BAT";
+      #endif
+    #endif
+  #endif
+
+  #ifdef SW_STACK_CHECK
+    /* SRAM usage */
+    const unsigned char Mem_DATA_str[] MEM_TYPE = "DATA";
+    const unsigned char Mem_STACK_str[] MEM_TYPE = "STACK";
+    const unsigned char Mem_FREE_str[] MEM_TYPE = "FREE";
+  #endif
+
+  #ifdef SW_PERF_COUNTERS
+    /* performance counters */
+    const unsigned char Perf_ADC_str[] MEM_TYPE = "ADC";
+    const unsigned char Perf_BUS_str[] MEM_TYPE = "BUS";
+    const unsigned char Perf_EE_str[] MEM_TYPE = "EE";
+    const unsigned char Perf_RX_str[] MEM_TYPE = "RX";
+    const unsigned char Perf_T0_str[] MEM_TYPE = "T0";
+    const unsigned char Perf_T1_str[] MEM_TYPE = "T1";
+    const unsigned char Perf_T2_str[] MEM_TYPE = "T2";
+    const unsigned char Perf_PCI_str[] MEM_TYPE = "PCI";
+
+    /* counter reference table */
+    const Cmd_Type Perf_Table[NUM_PERF_COUNTERS] MEM_TYPE = {
+      CMD_ENTRY(PERF_ADC, Perf_ADC_str),
+      CMD_ENTRY(PERF_BUS, Perf_BUS_str),
+      CMD_ENTRY(PERF_EEPROM, Perf_EE_str),
+      CMD_ENTRY(PERF_RX, Perf_RX_str),
+      CMD_ENTRY(PERF_TIMER0, Perf_T0_str),
+      CMD_ENTRY(PERF_TIMER1, Perf_T1_str),
+      CMD_ENTRY(PERF_TIMER2, Perf_T2_str),
+      CMD_ENTRY(PERF_PCINT, Perf_PCI_str)
     };
   #endif
 
@@ -443,6 +829,22 @@
   /* unit prefixes: f, p, n, , m, 0, k, M (used by value display) */
   const unsigned char Prefix_table[NUM_PREFIXES] MEM_TYPE = {'f', 'p', 'n', LCD_CHAR_MICRO, 'm', 0, 'k', 'M'};
 
+  /* pin designators of semiconductors: component ID, pin A, pin B, pin C */
+  const unsigned char SemiPin_table[] MEM_TYPE = {
+    COMP_BJT, 'B', 'C', 'E',            /* base, collector, emitter */
+    COMP_FET, 'G', 'D', 'S',            /* gate, drain, source */
+    COMP_IGBT, 'G', 'C', 'E',           /* gate, collector, emitter */
+    COMP_THYRISTOR, 'G', 'A', 'C',      /* gate, anode, cathode */
+    COMP_TRIAC, 'G', '2', '1',          /* gate, MT2, MT1 */
+    COMP_PUT, 'G', 'A', 'C',            /* gate, anode, cathode */
+    #ifdef SW_UJT
+    COMP_UJT, 'E', '2', '1',            /* emitter, B2, B1 */
+    #endif
+    COMP_NONE};
+
+  /* powers of ten: 10^9 - 10^1 (used by value to string conversion) */
+  const uint32_t Power10_table[NUM_POWER10] MEM_TYPE = {1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10};
+
   /* voltage based factors for large caps (using Rl) */
   /* voltage in mV:                                          300    325    350    375    400    425    450    475    500    525    550    575    600    625    650   675   700   725   750   775   800   825   850   875   900   925   950   975  1000  1025  1050  1075  1100  1125  1150  1175  1200  1225  1250  1275  1300  1325  1350  1375  1400 */
   const uint16_t LargeCap_table[NUM_LARGE_CAP] MEM_TYPE = {23022, 21195, 19629, 18272, 17084, 16036, 15104, 14271, 13520, 12841, 12224, 11660, 11143, 10668, 10229, 9822, 9445, 9093, 8765, 8458, 8170, 7900, 7645, 7405, 7178, 6963, 6760, 6567, 6384, 6209, 6043, 5885, 5733, 5589, 5450, 5318, 5191, 5069, 4952, 4839, 4731, 4627, 4526, 4430, 4336};
@@ -457,13 +859,98 @@
     const uint16_t PWM_Freq_table[NUM_PWM_FREQ] MEM_TYPE = {100, 250, 500, 1000, 2500, 5000, 10000, 25000};
   #endif
 
+  #ifdef SW_SORTING
+    /* sorting tool: tolerances in % */
+    const uint8_t Sort_Tol_table[NUM_SORT_TOL] MEM_TYPE = {1, 2, 5, 10, 20};
+  #endif
+
+  #ifdef SW_LED_BINNING
+    /* LED binning: bin widths in mV */
+    const uint8_t LED_Step_table[NUM_LED_STEPS] MEM_TYPE = {10, 20, 50, 100};
+  #endif
+
+  #if defined (ONEWIRE_IO_PIN) || defined (ONEWIRE_PROBES)
+    /* OneWire: CRC-8 for low and high nibble (X^8 + X^5 + X^4 + 1, reflected) */
+    const uint8_t CRC8_Low_table[NUM_CRC8_NIBBLE] MEM_TYPE = {0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41};
+    const uint8_t CRC8_High_table[NUM_CRC8_NIBBLE] MEM_TYPE = {0x00, 0x9D, 0x23, 0xBE, 0x46, 0xDB, 0x65, 0xF8, 0x8C, 0x11, 0xAF, 0x32, 0xCA, 0x57, 0xE9, 0x74};
+  #endif
+
+  #ifdef SW_LOGGER
+    /* data logger: intervals in 0.1s and numbers of samples */
+    const uint16_t Log_Interval_table[NUM_LOG_INTERVALS] MEM_TYPE = {1, 2, 5, 10, 20, 50, 100, 300, 600};
+    const uint16_t Log_Count_table[NUM_LOG_COUNTS] MEM_TYPE = {10, 50, 100, 500, 1000, 5000, 10000, 30000, 60000};
+  #endif
+
   #ifdef SW_INDUCTOR
     /* ratio based factors for inductors */
     /* ratio:                                                200   225   250   275   300   325   350   375   400   425   450   475   500   525   550   575   600   625  650  675  700  725  750  775  800  825  850  875  900  925  950  975 */
     const uint16_t Inductor_table[NUM_INDUCTOR] MEM_TYPE = {4481, 3923, 3476, 3110, 2804, 2544, 2321, 2128, 1958, 1807, 1673, 1552, 1443, 1343, 1252, 1169, 1091, 1020, 953, 890, 831, 775, 721, 670, 621, 574, 527, 481, 434, 386, 334, 271};
   #endif
 
-  #if defined (HW_FREQ_COUNTER) || defined (SW_SQUAREWAVE)
+  #ifdef FACTOR_SLOPES
+    /* slopes between factors: (entry n - entry n+1) * 2^Shift / Step */
+    /* large caps: 2^8 / 25mV */
+    const uint16_t LargeCap_slope[NUM_LARGE_CAP - 1] MEM_TYPE = {18708, 16036, 13896, 12165, 10732, 9544, 8530, 7690, 6953, 6318, 5775, 5294, 4864, 4495, 4168, 3860, 3604, 3359, 3144, 2949, 2765, 2611, 2458, 2324, 2202, 2079, 1976, 1874, 1792, 1700, 1618, 1556, 1475, 1423, 1352, 1300, 1249, 1198, 1157, 1106, 1065, 1034, 983, 963, 44401};
+    /* small caps: 2^15 / 50mV */
+    const uint16_t SmallCap_slope[NUM_SMALL_CAP - 1] MEM_TYPE = {33423, 30802, 27525, 25559, 22938, 21627, 20316, 18350};
+    #ifdef SW_INDUCTOR
+    /* inductors: 2^11 / 25 */
+    const uint16_t Inductor_slope[NUM_INDUCTOR - 1] MEM_TYPE = {45711, 36618, 29983, 25068, 21299, 18268, 15811, 13926, 12370, 10977, 9912, 8929, 8192, 7455, 6799, 6390, 5816, 5489, 5161, 4833, 4588, 4424, 4178, 4014, 3850, 3850, 3768, 3850, 3932, 4260, 5161};
+    #endif
+  #endif
+
+  /* factor tables for GetFactor() (in order of table IDs) */
+  const Factor_Type Factor_table[NUM_FACTOR_TABLES] MEM_TYPE = {
+    #ifdef FACTOR_SLOPES
+    {1000, 50, NUM_SMALL_CAP - 2, 1311, SmallCap_table, SmallCap_slope, 15},
+    {300, 25, NUM_LARGE_CAP - 2, 2622, LargeCap_table, LargeCap_slope, 8},
+      #ifdef SW_INDUCTOR
+      {200, 25, NUM_INDUCTOR - 2, 2622, Inductor_table, Inductor_slope, 11},
+      #endif
+    #else
+    {1000, 50, NUM_SMALL_CAP - 2, 1311, SmallCap_table},
+    {300, 25, NUM_LARGE_CAP - 2, 2622, LargeCap_table},
+      #ifdef SW_INDUCTOR
+      {200, 25, NUM_INDUCTOR - 2, 2622, Inductor_table},
+      #endif
+    #endif
+  };
+
+  #ifdef SW_DDS
+    /* DDS: quarter sine wave, amplitude 127.5 (sampled at mid of steps) */
+    const uint8_t DDS_Sine_table[DDS_TABLE_SIZE] MEM_TYPE = {2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 32, 36, 39, 41, 44, 47, 50, 53, 56, 59, 61, 64, 67, 70, 72, 75, 77, 80, 82, 84, 87, 89, 91, 93, 96, 98, 100, 101, 103, 105, 107, 109, 110, 112, 113, 115, 116, 117, 118, 120, 121, 122, 122, 123, 124, 125, 125, 126, 126, 127, 127, 127, 127, 127};
+  #endif
+
+  #if defined (SW_IR_RECEIVER) || defined (HW_IR_RECEIVER)
+    /* IR decoder: start pulses (time units in 50s, timing control, class), 0 terminates table */
+    const uint8_t IR_StartPulse_table[] MEM_TYPE = {
+      179, IR_RELAX_LONG, IR_START_NEC,      /* 9ms */
+      162, IR_RELAX_LONG, IR_START_PROTON,   /* 8ms */
+      168, IR_STD_TOLER, IR_START_JVC,       /* 8.44ms */
+      184, IR_RELAX_LONG, IR_START_JVC,      /* 9 - 9.5ms */
+      70, IR_STD_TOLER, IR_START_MATSUSHITA, /* 3.5ms */
+      #ifdef SW_IR_RX_EXTRA
+      79, IR_RELAX_LONG, IR_START_RCA,       /* 4ms */
+      #endif
+      11, IR_STD_TOLER, IR_START_MOTOROLA,   /* 512s */
+      #ifdef SW_IR_RX_EXTRA
+      10, IR_STD_TOLER, IR_START_THOMSON,    /* 500s */
+      #endif
+      89, IR_STD_TOLER, IR_START_SAMSUNG,    /* 4.5ms */
+      48, IR_STD_TOLER, IR_START_SIRC,       /* 2.4ms */
+      #ifdef SW_IR_RX_EXTRA
+      4, IR_STD_TOLER, IR_START_RECS80,      /* 141s */
+      #endif
+      6, IR_STD_TOLER, IR_START_SHARP,       /* 320s */
+      17, IR_STD_TOLER, IR_START_RC5,        /* 889s */
+      #ifdef SW_IR_RX_EXTRA
+      22, IR_STD_TOLER, IR_START_UPD1986C,   /* 1120s */
+      #endif
+      53, IR_STD_TOLER, IR_START_RC6,        /* 2664s */
+      0};
+  #endif
+
+  #if defined (HW_FREQ_COUNTER) || defined (SW_SQUAREWAVE) || defined (HW_LC_METER)
     /* Timer1 prescalers and corresponding register bits */
     const uint16_t T1_Prescaler_table[NUM_TIMER1] MEM_TYPE = {1, 8, 64, 256, 1024};
     const uint8_t T1_RegBits_table[NUM_TIMER1] MEM_TYPE = {(1 << CS10), (1 << CS11), (1 << CS11) | (1 << CS10), (1 << CS12), (1 << CS12) | (1 << CS10)};
@@ -489,7 +976,7 @@
     const uint16_t E24_table[NUM_E24] MEM_TYPE = {100, 110, 120, 130, 150, 160, 180, 200, 220, 240, 270, 300, 330, 360, 390, 430, 470, 510, 560, 620, 680, 750, 820, 910};
   #endif
 
-  #ifdef SW_E96
+  #if defined (SW_E96) && ! defined (SW_E192)
     /* E96 (in 0.01) */
     const uint16_t E96_table[NUM_E96] MEM_TYPE = {
       100, 102, 105, 107, 110, 113, 115, 118, 121, 124, 127, 130, 133, 137, 140, 143, 147, 150, 154, 158, 162, 165, 169, 174,
@@ -498,6 +985,19 @@
       562, 576, 590, 604, 619, 634, 649, 665, 681, 698, 715, 732, 750, 768, 787, 806, 825, 845, 866, 887, 909, 931, 953, 976}; 
   #endif
 
+  #ifdef SW_E192
+    /* E192 (in 0.01), E96 is every second value */
+    const uint16_t E192_table[NUM_E192] MEM_TYPE = {
+      100, 101, 102, 104, 105, 106, 107, 109, 110, 111, 113, 114, 115, 117, 118, 120, 121, 123, 124, 126, 127, 129, 130, 132,
+      133, 135, 137, 138, 140, 142, 143, 145, 147, 149, 150, 152, 154, 156, 158, 160, 162, 164, 165, 167, 169, 172, 174, 176,
+      178, 180, 182, 184, 187, 189, 191, 193, 196, 198, 200, 203, 205, 208, 210, 213, 215, 218, 221, 223, 226, 229, 232, 234,
+      237, 240, 243, 246, 249, 252, 255, 258, 261, 264, 267, 271, 274, 277, 280, 284, 287, 291, 294, 298, 301, 305, 309, 312,
+      316, 320, 324, 328, 332, 336, 340, 344, 348, 352, 357, 361, 365, 370, 374, 379, 383, 388, 392, 397, 402, 407, 412, 417,
+      422, 427, 432, 437, 442, 448, 453, 459, 464, 470, 475, 481, 487, 493, 499, 505, 511, 517, 523, 530, 536, 542, 549, 556,
+      562, 569, 576, 583, 590, 597, 604, 612, 619, 626, 634, 642, 649, 657, 665, 673, 681, 690, 698, 706, 715, 723, 732, 741,
+      750, 759, 768, 777, 787, 796, 806, 816, 825, 835, 845, 856, 866, 876, 887, 898, 909, 920, 931, 942, 953, 965, 976, 988};
+  #endif
+
   #ifdef FUNC_COLORCODE
     /* band colors based on value                               0                 1                 2               3                  4                  5                 6                7                  8                9 */
     const uint16_t ColorCode_table[NUM_COLOR_CODES] MEM_TYPE = {COLOR_CODE_BLACK, COLOR_CODE_BROWN, COLOR_CODE_RED, COLOR_CODE_ORANGE, COLOR_CODE_YELLOW, COLOR_CODE_GREEN, COLOR_CODE_BLUE, COLOR_CODE_VIOLET, COLOR_CODE_GREY, COLOR_CODE_WHITE};
@@ -533,6 +1033,32 @@
   /* register bits for ADC MUX input channels based on probe ID (ADC0-7 only) */
   const uint8_t Channel_table[] MEM_TYPE = {TP1, TP2, TP3};
 
+  #ifdef PROBE_TABLE
+    /* helpers for resolving register bits based on probe ID */
+    #define PERM_RL(n)   (((n) == 0) ? (1 << R_RL_1) : (((n) == 1) ? (1 << R_RL_2) : (1 << R_RL_3)))
+    #define PERM_RH(n)   (((n) == 0) ? (1 << R_RH_1) : (((n) == 1) ? (1 << R_RH_2) : (1 << R_RH_3)))
+    #define PERM_PIN(n)  (((n) == 0) ? (1 << TP1) : (((n) == 1) ? (1 << TP2) : (1 << TP3)))
+    #define PERM_CH(n)   (((n) == 0) ? TP1 : (((n) == 1) ? TP2 : TP3))
+    #define PERM(a, b, c) {a, b, c, PERM_RL(a), PERM_RL(b), PERM_RL(c), PERM_RH(a), PERM_RH(b), PERM_RH(c), PERM_PIN(a), PERM_PIN(b), PERM_PIN(c), PERM_CH(a), PERM_CH(b), PERM_CH(c)}
+
+    /* resolved probe settings for all permutations (same order as Probe_Type) */
+    /* index: probe-1 * 2 + (probe-2 > probe-3) */
+    const uint8_t Probe_table[NUM_PROBE_PERMS][PROBE_PERM_SIZE] MEM_TYPE = {
+      PERM(PROBE_1, PROBE_2, PROBE_3),
+      PERM(PROBE_1, PROBE_3, PROBE_2),
+      PERM(PROBE_2, PROBE_1, PROBE_3),
+      PERM(PROBE_2, PROBE_3, PROBE_1),
+      PERM(PROBE_3, PROBE_1, PROBE_2),
+      PERM(PROBE_3, PROBE_2, PROBE_1)
+    };
+
+    #undef PERM
+    #undef PERM_CH
+    #undef PERM_PIN
+    #undef PERM_RH
+    #undef PERM_RL
+  #endif
+
 
 
 /* ************************************************************************
@@ -559,6 +1085,20 @@
       extern uint8_t     RX_Char;            /* RX char (bit buffer) */
       extern uint8_t     RX_Bits;            /* bit counter for RX char */
     #endif
+    #ifdef SERIAL_RX_QUEUE
+      extern char        RX_Queue[][RX_BUFFER_SIZE];  /* command queue */
+      extern uint8_t     RX_In;              /* line filled by ISR */
+      extern uint8_t     RX_Out;             /* line to process next */
+      extern volatile uint8_t  RX_Count;     /* number of queued commands */
+    #endif
+  #endif
+  #ifdef SERIAL_TX_BUFFER
+    extern uint8_t       TX_Buffer[];        /* serial TX ring buffer */
+    extern volatile uint8_t  TX_Head;        /* write position */
+    extern volatile uint8_t  TX_Tail;        /* read position */
+  #endif
+  #ifdef FUNC_SCRATCH
+    extern uint8_t       Scratch[];          /* scratch arena */
   #endif
 
   /* configuration */
@@ -566,6 +1106,10 @@
   extern Config_Type     Cfg;                /* offsets and values */
   extern Adjust_Type     NV;                 /* basic adjustment offsets and values */
 
+  #ifdef ADC_INTERRUPT
+    extern Sampling_Type Sampling;           /* interrupt driven ADC sampling */
+  #endif
+
   #ifdef HW_TOUCH
     extern Touch_Type    Touch;              /* touch screen adjustment offsets */
   #endif
@@ -581,12 +1125,43 @@
   extern Semi_Type       Semi;               /* common semiconductor */
   extern AltSemi_Type    AltSemi;            /* special semiconductor */
 
+  #ifdef SW_HFE_SWEEP
+    extern hFE_Type      hFE_Sweep[];        /* hFE sweep */
+  #endif
+
   #if defined (SW_INDUCTOR) || defined (HW_LC_METER)
     extern Inductor_Type Inductor;           /* inductor */
   #endif
 
+  #ifdef ESR_PIPELINED
+    extern uint16_t      ESR_Spread;         /* spread of last ESR reading */
+  #endif
+
+  #ifdef ESR_TOOL_FAST
+    extern uint8_t       ESR_Pulses;         /* pulse pairs (0 = default) */
+  #endif
+
   #ifdef UI_SERIAL_COMMANDS
     extern Info_Type     Info;               /* additional component data */
+    #ifdef SW_BURST
+    extern uint8_t       BurstRuns;          /* remaining burst runs */
+    extern uint8_t       BurstCount;         /* burst records sent */
+    #endif
+    #ifdef SW_BIN_FRAMES
+    extern Frame_Type    Frame;              /* binary frames */
+    #endif
+  #endif
+
+  #ifdef SW_PROFILER
+    extern Profile_Type  Profile;            /* probing profiler */
+  #endif
+
+  #ifdef SW_POWER_STATS
+    extern SleepStats_Type SleepStats;       /* power-state statistics */
+  #endif
+
+  #ifdef SW_PERF_COUNTERS
+    extern volatile uint32_t PerfCount[];    /* performance counters */
   #endif
 
   #ifdef HW_SPI
@@ -608,6 +1183,8 @@
    *  - stored in EEPROM
    */
 
+  #ifndef ADJUST_WEAR_LEVEL
+
   /* basic adjustment values: profile #1 */
   extern const Adjust_Type    NV_Adjust_1;
 
@@ -619,11 +1196,46 @@
     extern const Adjust_Type  NV_Adjust_3;
   #endif
 
+  #else
+
+  /* basic adjustment values: profile #1 (rotating slots) */
+  extern const Adjust_Type    NV_Adjust_1[ADJUST_SLOTS];
+
+  /* basic adjustment values: profile #2 (rotating slots) */
+  extern const Adjust_Type    NV_Adjust_2[ADJUST_SLOTS];
+
+  #ifdef UI_THREE_PROFILES
+    /* basic adjustment values: profile #3 (rotating slots) */
+    extern const Adjust_Type  NV_Adjust_3[ADJUST_SLOTS];
+  #endif
+
+  #endif
+
   #ifdef HW_TOUCH
     /* touch screen adjustment offsets */
     extern const Touch_Type   NV_Touch;
   #endif
 
+  #ifdef SW_IR_LEARN
+    /* IR learn: raw pulse trains */
+    extern const IR_Learn_Type NV_IR_Learn[];
+  #endif
+
+  #ifdef SW_LED_BINNING
+    /* LED binning: bins */
+    extern const LED_Bins_Type NV_LED_Bins;
+  #endif
+
+  #ifdef DS18B20_ROM_CACHE
+    /* DS18B20: ROM codes of last bus search */
+    extern const DS18B20_Cache_Type NV_DS18B20_Cache;
+  #endif
+
+  #ifdef SERIAL_MULTIDROP
+    /* serial multi-drop mode: address */
+    extern const uint8_t NV_Serial_Addr;
+  #endif
+
 
   /*
    *  constant strings
@@ -653,6 +1265,7 @@
   extern const unsigned char Error_str[];
   extern const unsigned char Exit_str[];
   extern const unsigned char BJT_str[];
+  extern const unsigned char Thyristor_str[];
   extern const unsigned char Triac_str[];
   extern const unsigned char PUT_str[];
   extern const unsigned char MOS_str[];
@@ -661,13 +1274,16 @@
   extern const unsigned char Enhancement_str[];
   extern const unsigned char Depletion_str[];
   extern const unsigned char Cgs_str[];
+  extern const unsigned char IGBT_str[];
   extern const unsigned char NPN_str[];
   extern const unsigned char PNP_str[];
   extern const unsigned char h_FE_str[];
   extern const unsigned char V_BE_str[];
+  extern const unsigned char V_GT_str[];
   extern const unsigned char I_CEO_str[];
   extern const unsigned char Vf_str[];
   extern const unsigned char Vth_str[];
+  extern const unsigned char V_T_str[];
   extern const unsigned char URef_str[];
   extern const unsigned char RhLow_str[];
   extern const unsigned char RhHigh_str[];
@@ -683,6 +1299,7 @@
   extern const unsigned char Checksum_str[];
   extern const unsigned char Profile1_str[];
   extern const unsigned char Profile2_str[];
+  extern const unsigned char R_DS_str[];
 
 
   /* units */
@@ -698,7 +1315,7 @@
     extern const unsigned char Menu_or_Test_str[];
   #endif
 
-  #ifdef SW_ESR_TOOL
+  #if defined (SW_ESR_TOOL) || ((defined (SW_LOGGER) || defined (SW_REPEAT_STATS)) && (defined (SW_ESR) || defined (SW_OLD_ESR)))
     extern const unsigned char ESR_str[];
   #endif
 
@@ -733,6 +1350,11 @@
     extern const unsigned char RingTester_str[];
   #endif
 
+  #ifdef RING_TESTER_AUTO
+    extern const unsigned char RingPass_str[];
+    extern const unsigned char RingFail_str[];
+  #endif
+
   #ifdef HW_EVENT_COUNTER
     extern const unsigned char EventCounter_str[];
     extern const unsigned char Count_str[];
@@ -807,6 +1429,10 @@
     extern const unsigned char IR_SIRC_20_str[];
   #endif
 
+  #ifdef SW_IR_LEARN
+    extern const unsigned char IR_Raw_str[];
+  #endif
+
   #ifdef SW_OPTO_COUPLER
     extern const unsigned char OptoCoupler_str[];
     extern const unsigned char None_str[];
@@ -827,9 +1453,16 @@
 
   #ifdef SW_SERVO
     extern const unsigned char Servo_str[];
+  #endif
+
+  #if defined (SW_SERVO) || defined (PWM_SWEEP)
     extern const unsigned char Sweep_str[];
   #endif
 
+  #ifdef SERVO_AUTO_TEST
+    extern const unsigned char ServoAuto_str[];
+  #endif
+
   #ifdef HW_TOUCH
     extern const unsigned char TouchSetup_str[];
   #endif
@@ -887,6 +1520,10 @@
     extern const unsigned char CRC_str[];
   #endif
 
+  #ifdef SW_I2C_SCAN
+    extern const unsigned char I2C_Scan_str[];
+  #endif
+
   #ifdef SW_FONT_TEST
     extern const unsigned char FontTest_str[];
   #endif
@@ -895,6 +1532,56 @@
     extern const unsigned char SymbolTest_str[];
   #endif
 
+  #ifdef FONT_CACHE
+    extern const unsigned char FontCache_table[];
+  #endif
+
+  #if defined (EVENT_COUNTER_LOG) || defined (THERMOCOUPLE_LOG)
+    extern const unsigned char Log_str[];
+  #endif
+
+  #ifdef SW_LOGGER
+    extern const unsigned char Log_R_str[];
+    extern const unsigned char Log_C_str[];
+    #ifdef SW_INDUCTOR
+    extern const unsigned char Log_L_str[];
+    #endif
+    extern const unsigned char Log_U_str[];
+    extern const unsigned char Log_Header_str[];
+  #endif
+
+  #ifdef SW_DDS
+    extern const unsigned char DDS_str[];
+    extern const unsigned char DDS_Sine_str[];
+    extern const unsigned char DDS_Triangle_str[];
+  #endif
+
+  #if defined (FREQ_COUNTER_STATS) || defined (THERMOCOUPLE_LOG) || defined (SW_REPEAT_STATS)
+    extern const unsigned char StatsMin_str[];
+    extern const unsigned char StatsMax_str[];
+    extern const unsigned char StatsMean_str[];
+    extern const unsigned char StatsDev_str[];
+  #endif
+
+  #ifdef PHOTODIODE_TIMING
+    extern const unsigned char PD_Rise_str[];
+    extern const unsigned char PD_Fall_str[];
+  #endif
+
+  #ifdef ENCODER_STATS
+    extern const unsigned char EncSteps_str[];
+    extern const unsigned char EncBounce_str[];
+    extern const unsigned char EncSpeed_str[];
+  #endif
+
+  #ifdef SW_DISPLAY_BENCH
+    extern const unsigned char DisplayBench_str[];
+    extern const unsigned char BenchClear_str[];
+    extern const unsigned char BenchLine_str[];
+    extern const unsigned char BenchChar_str[];
+    extern const unsigned char BenchSymbol_str[];
+  #endif
+
   #ifdef SW_CONTINUITY_CHECK
     extern const unsigned char ContinuityCheck_str[];
   #endif
@@ -919,6 +1606,83 @@
     extern const unsigned char ReverseBias_str[];
   #endif
 
+  #ifdef SW_SCOPE
+    extern const unsigned char Scope_str[];
+    extern const unsigned char Rising_str[];
+    extern const unsigned char Falling_str[];
+  #endif
+
+  #ifdef DISCHARGE_ADAPTIVE
+    extern const unsigned char Discharge_str[];
+  #endif
+
+  #ifdef SW_SORTING
+    extern const unsigned char Sorting_str[];
+  #endif
+
+  #ifdef SW_COMPARE
+    extern const unsigned char Compare_str[];
+  #endif
+
+  #if defined (SW_SORTING) || defined (SW_COMPARE)
+    extern const unsigned char Pass_str[];
+  #endif
+
+  #ifdef UI_TWEEZERS
+    extern const unsigned char Tweezers_str[];
+  #endif
+
+  #ifdef SW_CURVE_TRACER
+    extern const unsigned char Curve_str[];
+  #endif
+
+  #ifdef SW_MATCHING
+    extern const unsigned char Matching_str[];
+  #endif
+
+  #ifdef SW_HISTORY
+    extern const unsigned char History_str[];
+  #endif
+
+  #ifdef SW_REPEAT_STATS
+    extern const unsigned char Repeat_str[];
+  #endif
+
+  #ifdef SW_LOGGER
+    extern const unsigned char Logger_str[];
+  #endif
+
+  #ifdef SW_LEAD_ADJUST
+    extern const unsigned char LeadAdjust_str[];
+  #endif
+
+  #ifdef SW_STACK_CHECK
+    extern const unsigned char Memory_str[];
+  #endif
+
+  #ifdef SW_PERF_COUNTERS
+    extern const unsigned char Perf_str[];
+  #endif
+
+  #ifdef UI_PRESETS
+    extern const unsigned char Preset_str[];
+    extern const unsigned char PresetFull_str[];
+    extern const unsigned char PresetFast_str[];
+  #endif
+
+  #ifdef UI_ENGLISH_2ND
+    extern const unsigned char Language_str[];
+    extern const unsigned char LangName_str[];
+  #endif
+
+  #ifdef SW_LED_BINNING
+    extern const unsigned char LED_Binning_str[];
+  #endif
+
+  #ifdef CRYSTAL_RINGDOWN
+    extern const unsigned char CrystalRing_str[];
+  #endif
+
 
   /* remote commands */
   #ifdef UI_SERIAL_COMMANDS
@@ -978,9 +1742,114 @@
     #ifdef HW_PROBE_ZENER
       extern const unsigned char Cmd_V_Z_str[];
     #endif
+    #ifdef SW_HFE_SWEEP
+      extern const unsigned char Cmd_h_FE_sweep_str[];
+    #endif
+    #ifdef SW_PROFILER
+      extern const unsigned char Cmd_PROF_str[];
+    #endif
+    extern const unsigned char Cmd_ALL_str[];
+    #ifdef SW_STREAM
+      extern const unsigned char Cmd_MON_R_str[];
+      extern const unsigned char Cmd_MON_C_str[];
+      #ifdef SW_INDUCTOR
+      extern const unsigned char Cmd_MON_L_str[];
+      #endif
+    #endif
+    #ifdef SW_RAW_STREAM
+      extern const unsigned char Cmd_RAW_str[];
+    #endif
+    #ifdef SW_BIN_FRAMES
+      extern const unsigned char Cmd_BIN_str[];
+      extern const unsigned char Cmd_TXT_str[];
+    #endif
+    #ifdef SERIAL_MULTIDROP
+      extern const unsigned char Cmd_ADDR_str[];
+    #endif
+    #ifdef SW_REMOTE_TOOLS
+      extern const unsigned char Cmd_TOOL_str[];
+      extern const unsigned char Cmd_KEY_str[];
+      #ifdef HW_FREQ_COUNTER
+      extern const unsigned char Cmd_F_str[];
+      #endif
+      #ifdef SW_DS18B20
+      extern const unsigned char Cmd_T_str[];
+      #endif
+    #endif
+    #if defined (SW_STREAM) || defined (SW_RAW_STREAM) || defined (SW_REMOTE_TOOLS)
+      extern const unsigned char Cmd_STOP_str[];
+    #endif
+    extern const unsigned char Cmd_APROBE_str[];
+    extern const unsigned char Cmd_CANCEL_str[];
+    extern const unsigned char Cmd_DONE_str[];
+    #ifdef SW_BURST
+      extern const unsigned char Cmd_BURST_str[];
+    #endif
+    #ifdef SW_POWER_STATS
+      extern const unsigned char Cmd_PWR_str[];
+    #endif
+    #ifdef EVENT_COUNTER_LOG
+      extern const unsigned char Cmd_EVLOG_str[];
+    #endif
+    #ifdef SW_HISTORY
+      extern const unsigned char Cmd_HIST_str[];
+    #endif
+    #ifdef SW_REPEAT_STATS
+      extern const unsigned char Cmd_REPEAT_str[];
+    #endif
+    #ifdef SW_STACK_CHECK
+      extern const unsigned char Cmd_MEM_str[];
+    #endif
+    #ifdef SW_PERF_COUNTERS
+      extern const unsigned char Cmd_PERF_str[];
+    #endif
+    #ifdef SW_CYCLE_BENCH
+      extern const unsigned char Cmd_BENCH_str[];
+      extern const unsigned char Bench_ReadU_str[];
+      extern const unsigned char Bench_LCD_Char_str[];
+      extern const unsigned char Bench_Value_str[];
+      extern const unsigned char Bench_FindCommand_str[];
+      #if defined (FUNC_EVALUE) || defined (FUNC_COLORCODE) || defined (FUNC_EIA96)
+      extern const unsigned char Bench_ENorm_str[];
+      #endif
+    #endif
+    #ifdef SW_SELFTEST_REPORT
+      extern const unsigned char Cmd_SELFTEST_str[];
+      extern const unsigned char Cmd_PASS_str[];
+      extern const unsigned char Cmd_FAIL_str[];
+      extern const unsigned char Cmd_SKIP_str[];
+    #endif
 
     /* command reference table */
     extern const Cmd_Type Cmd_Table[];
+
+    #ifdef SW_PROFILER
+      /* profiler stage reference table */
+      extern const Cmd_Type Prof_Table[];
+    #endif
+
+    #ifdef SW_POWER_STATS
+      /* power states */
+      extern const unsigned char Pwr_UP_str[];
+      extern const unsigned char Pwr_IDLE_str[];
+      extern const unsigned char Pwr_SAVE_str[];
+      extern const unsigned char Pwr_RUN_str[];
+      #ifdef BAT_BACKGROUND
+      extern const unsigned char Pwr_BAT_str[];
+      #endif
+    #endif
+  #endif
+
+  #ifdef SW_STACK_CHECK
+    /* SRAM usage */
+    extern const unsigned char Mem_DATA_str[];
+    extern const unsigned char Mem_STACK_str[];
+    extern const unsigned char Mem_FREE_str[];
+  #endif
+
+  #ifdef SW_PERF_COUNTERS
+    /* performance counters */
+    extern const Cmd_Type Perf_Table[];
   #endif
 
 
@@ -992,6 +1861,10 @@
 
   /* unit prefixes: p, n, , m, 0, k, M (used by value display) */
   extern const unsigned char Prefix_table[];
+  extern const uint32_t Power10_table[];
+
+  /* pin designators of semiconductors */
+  extern const unsigned char SemiPin_table[];
 
   /* voltage based factors for large caps (using Rl) */
   extern const uint16_t LargeCap_table[];
@@ -1004,12 +1877,47 @@
     extern const uint16_t PWM_Freq_table[];
   #endif
 
+  #ifdef SW_SORTING
+    /* sorting tool: tolerances */
+    extern const uint8_t Sort_Tol_table[];
+  #endif
+
+  #ifdef SW_LED_BINNING
+    /* LED binning: bin widths */
+    extern const uint8_t LED_Step_table[];
+  #endif
+
+  #if defined (ONEWIRE_IO_PIN) || defined (ONEWIRE_PROBES)
+    /* OneWire: CRC-8 for low and high nibble */
+    extern const uint8_t CRC8_Low_table[];
+    extern const uint8_t CRC8_High_table[];
+  #endif
+
+  #ifdef SW_LOGGER
+    /* data logger: intervals and numbers of samples */
+    extern const uint16_t Log_Interval_table[];
+    extern const uint16_t Log_Count_table[];
+  #endif
+
   #ifdef SW_INDUCTOR
     /* voltage based factors for inductors */
     extern const uint16_t Inductor_table[];
   #endif
 
-  #if defined (HW_FREQ_COUNTER) || defined (SW_SQUAREWAVE)
+  /* factor tables for GetFactor() */
+  extern const Factor_Type Factor_table[];
+
+  #ifdef SW_DDS
+    /* DDS: quarter sine wave */
+    extern const uint8_t DDS_Sine_table[];
+  #endif
+
+  #if defined (SW_IR_RECEIVER) || defined (HW_IR_RECEIVER)
+    /* IR decoder: start pulses */
+    extern const uint8_t IR_StartPulse_table[];
+  #endif
+
+  #if defined (HW_FREQ_COUNTER) || defined (SW_SQUAREWAVE) || defined (HW_LC_METER)
     /* Timer1 prescalers and corresponding register bits */
     extern const uint16_t T1_Prescaler_table[];
     extern const uint8_t T1_RegBits_table[];
@@ -1034,11 +1942,16 @@
     extern const uint16_t E24_table[];
   #endif
 
-  #ifdef SW_E96
+  #if defined (SW_E96) && ! defined (SW_E192)
     /* E96 (in 0.01) */
     extern const uint16_t E96_table[];
   #endif
 
+  #ifdef SW_E192
+    /* E192 (in 0.01) */
+    extern const uint16_t E192_table[];
+  #endif
+
   #ifdef FUNC_COLORCODE
     /* band colors based on value */
     extern const uint16_t ColorCode_table[];
@@ -1072,6 +1985,24 @@
   /* register bits for ADC MUX input channels based on probe ID (ADC0-7 only) */
   extern const uint8_t Channel_table[];
 
+  #ifdef PROBE_TABLE
+    /* resolved probe settings for all permutations */
+    extern const uint8_t Probe_table[][PROBE_PERM_SIZE];
+  #endif
+
+#endif
+
+
+
+/*
+ *  second language selectable at runtime
+ *  - replaces language specific strings by runtime selection
+ */
+
+#ifdef UI_ENGLISH_2ND
+  #define VAR_2ND_SELECT
+  #include "var_2nd.h"
+  #undef VAR_2ND_SELECT
 #endif
 
 